@@ -0,0 +1,64 @@
+// Loads and unloads a shared library over and over, and prints the average time of a
+// dlopen()/dlclose() pair in microseconds. Used by bench_shared.sh.
+//
+// Usage: bench_dlopen <library> [iterations]
+
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#	define _POSIX_C_SOURCE 200112L
+#endif
+
+#include <dlfcn.h> /* dlopen(), dlclose() */
+#include <stdio.h> /* printf(), fprintf() */
+#include <stdlib.h> /* atoi() */
+#include <time.h> /* clock_gettime() */
+
+static double vkelBenchGetMicroseconds(void)
+{
+	struct timespec now;
+	
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	
+	return (double) now.tv_sec * 1000000.0 + (double) now.tv_nsec / 1000.0;
+}
+
+int main(int argc, char **argv)
+{
+	int iterations = (argc > 2) ? atoi(argv[2]) : 2000;
+	double start;
+	int i;
+	
+	if (argc < 2 || iterations <= 0)
+	{
+		fprintf(stderr, "usage: %s <library> [iterations]\n", argv[0]);
+		return 2;
+	}
+	
+	// Warm the page cache, so the first iteration isn't reading the disk
+	{
+		void *library = dlopen(argv[1], RTLD_NOW | RTLD_LOCAL);
+		
+		if (!library)
+		{
+			fprintf(stderr, "%s\n", dlerror());
+			return 1;
+		}
+		
+		dlclose(library);
+	}
+	
+	start = vkelBenchGetMicroseconds();
+	
+	for (i = 0; i < iterations; ++i)
+	{
+		void *library = dlopen(argv[1], RTLD_NOW | RTLD_LOCAL);
+		
+		if (!library)
+			return 1;
+		
+		dlclose(library);
+	}
+	
+	printf("%.1f\n", (vkelBenchGetMicroseconds() - start) / (double) iterations);
+	
+	return 0;
+}
@@ -0,0 +1,62 @@
+#!/bin/sh
+# Compares vkel built as a shared library at an older revision against the working tree:
+# the exported dynamic symbols and dynamic relocations (which the dynamic linker processes
+# on every load), the library size, and the average time of a dlopen()/dlclose() pair.
+#
+# Pass the revision to compare against, e.g. the one before the function pointers were moved
+# into vkelTable, or the revision a branch started from.
+#
+# Usage: tests/bench_shared.sh <old revision> [iterations]
+
+set -e
+
+if [ -z "$1" ]; then
+	echo "usage: $0 <old revision> [iterations]" >&2
+	exit 2
+fi
+
+OLD_REVISION=$1
+ITERATIONS=${2:-2000}
+CC=${CC:-cc}
+
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+WORK=$(mktemp -d)
+trap 'rm -rf "$WORK"' EXIT
+
+mkdir "$WORK/old"
+git -C "$ROOT" show "$OLD_REVISION:vkel.c" > "$WORK/old/vkel.c"
+git -C "$ROOT" show "$OLD_REVISION:vkel.h" > "$WORK/old/vkel.h"
+
+# Each built the way the README of its revision says
+$CC -O2 -fPIC -shared -o "$WORK/libvkel_old.so" "$WORK/old/vkel.c" -ldl -pthread
+$CC -O2 -fPIC -shared -fvisibility=hidden -DVKEL_SHARED -DVKEL_BUILD -o "$WORK/libvkel_new.so" "$ROOT/vkel.c" -ldl -pthread
+$CC -O2 -o "$WORK/bench_dlopen" "$ROOT/tests/bench_dlopen.c" -ldl
+
+# Defined (exported) dynamic symbols
+exported_symbols() {
+	readelf --dyn-syms -W "$1" | awk '$1 ~ /^[0-9]+:$/ && $7 != "UND"' | wc -l
+}
+
+relocations() {
+	readelf -r -W "$1" | awk '$1 ~ /^[0-9a-f]+$/ && $3 ~ /^R_/' | wc -l
+}
+
+glob_dat_relocations() {
+	readelf -r -W "$1" | grep -c GLOB_DAT || true
+}
+
+library_size() {
+	wc -c < "$1"
+}
+
+printf '%-28s %12s %12s\n' "" "$OLD_REVISION" "working tree"
+
+for measure in exported_symbols relocations glob_dat_relocations library_size; do
+	printf '%-28s %12s %12s\n' "$measure" \
+		"$($measure "$WORK/libvkel_old.so" | tr -d ' ')" \
+		"$($measure "$WORK/libvkel_new.so" | tr -d ' ')"
+done
+
+printf '%-28s %12s %12s\n' "dlopen+dlclose (us)" \
+	"$("$WORK/bench_dlopen" "$WORK/libvkel_old.so" "$ITERATIONS")" \
+	"$("$WORK/bench_dlopen" "$WORK/libvkel_new.so" "$ITERATIONS")"
@@ -0,0 +1,303 @@
+// Drives vkel_layer.c the way the Vulkan loader does, on top of the mock driver (mock_icd.c):
+// negotiates the layer interface, creates an instance and two devices through the chain, records
+// draws, and destroys everything again.
+//
+// With instrumenting off, the layer must hand out the driver's functions as is. With
+// VKEL_LAYER_INSTRUMENT=1, it must hand out its own, and report every call the driver got.
+//
+// Usage: layer_test <layer library> <driver library>
+
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#	define _POSIX_C_SOURCE 200112L
+#endif
+
+#define VKEL_NO_FUNCTION_MACROS
+#include "vkel.h"
+
+#include <dlfcn.h> /* dlopen(), dlsym(), dlclose() */
+#include <stdio.h> /* fopen(), fgets(), fprintf() */
+#include <stdlib.h> /* getenv(), setenv() */
+#include <string.h> /* strcmp(), strncmp() */
+
+#include "mock_icd.h"
+
+#define VKEL_TEST_REPORT_PATH "layer_test_report.txt"
+#define VKEL_TEST_DRAW_COUNT 1000
+
+#define VKEL_TEST_CHECK(condition) \
+	do { \
+		if (!(condition)) \
+		{ \
+			fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+			return 1; \
+		} \
+	} while (0)
+
+
+// The loader's side of the layer interface (version 2), as declared by vk_layer.h
+
+typedef struct VkelTestInstanceLink {
+	struct VkelTestInstanceLink *pNext;
+	PFN_vkGetInstanceProcAddr pfnNextGetInstanceProcAddr;
+	PFN_vkVoidFunction pfnNextGetPhysicalDeviceProcAddr;
+} VkelTestInstanceLink;
+
+typedef struct VkelTestInstanceCreateInfo {
+	VkStructureType sType;
+	const void *pNext;
+	int function;
+	union {
+		VkelTestInstanceLink *pLayerInfo;
+		PFN_vkVoidFunction pfnSetInstanceLoaderData;
+	} u;
+} VkelTestInstanceCreateInfo;
+
+typedef struct VkelTestDeviceLink {
+	struct VkelTestDeviceLink *pNext;
+	PFN_vkGetInstanceProcAddr pfnNextGetInstanceProcAddr;
+	PFN_vkGetDeviceProcAddr pfnNextGetDeviceProcAddr;
+} VkelTestDeviceLink;
+
+typedef struct VkelTestDeviceCreateInfo {
+	VkStructureType sType;
+	const void *pNext;
+	int function;
+	union {
+		VkelTestDeviceLink *pLayerInfo;
+		PFN_vkVoidFunction pfnSetDeviceLoaderData;
+	} u;
+} VkelTestDeviceCreateInfo;
+
+typedef struct VkelTestNegotiateLayerInterface {
+	int sType;
+	void *pNext;
+	uint32_t loaderLayerInterfaceVersion;
+	PFN_vkGetInstanceProcAddr pfnGetInstanceProcAddr;
+	PFN_vkGetDeviceProcAddr pfnGetDeviceProcAddr;
+	PFN_vkVoidFunction pfnGetPhysicalDeviceProcAddr;
+} VkelTestNegotiateLayerInterface;
+
+typedef VkResult (VKAPI_PTR *PFN_vkelTestNegotiateLoaderLayerInterfaceVersion)(VkelTestNegotiateLayerInterface *pVersionStruct);
+
+#define VKEL_TEST_LAYER_LINK_INFO 0
+#define VKEL_TEST_NEGOTIATE_INTERFACE_STRUCT 1
+
+
+// Returns the calls of pName in the layer's report, or 0 if it isn't listed
+static unsigned long vkelTestGetReportedCalls(const char *pPath, const char *pName)
+{
+	FILE *file = fopen(pPath, "r");
+	char line[256];
+	unsigned long calls = 0;
+	size_t nameLength = strlen(pName);
+	
+	if (!file)
+		return 0;
+	
+	while (fgets(line, sizeof(line), file))
+	{
+		if (!strncmp(line, pName, nameLength) && line[nameLength] == ' ')
+		{
+			calls = strtoul(line + nameLength, NULL, 10);
+			break;
+		}
+	}
+	
+	fclose(file);
+	
+	return calls;
+}
+
+static VkResult vkelTestCreateDevice(PFN_vkGetInstanceProcAddr layerGetInstanceProcAddr, PFN_vkGetInstanceProcAddr icdGetInstanceProcAddr, VkInstance instance, VkPhysicalDevice physicalDevice, VkDevice *pDevice)
+{
+	PFN_vkCreateDevice createDevice = (PFN_vkCreateDevice) layerGetInstanceProcAddr(instance, "vkCreateDevice");
+	VkelTestDeviceLink link;
+	VkelTestDeviceCreateInfo chainInfo;
+	VkDeviceCreateInfo createInfo;
+	
+	memset(&link, 0, sizeof(link));
+	link.pfnNextGetInstanceProcAddr = icdGetInstanceProcAddr;
+	link.pfnNextGetDeviceProcAddr = (PFN_vkGetDeviceProcAddr) icdGetInstanceProcAddr(instance, "vkGetDeviceProcAddr");
+	
+	memset(&chainInfo, 0, sizeof(chainInfo));
+	chainInfo.sType = VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO;
+	chainInfo.function = VKEL_TEST_LAYER_LINK_INFO;
+	chainInfo.u.pLayerInfo = &link;
+	
+	memset(&createInfo, 0, sizeof(createInfo));
+	createInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+	createInfo.pNext = &chainInfo;
+	
+	return createDevice(physicalDevice, &createInfo, NULL, pDevice);
+}
+
+int main(int argc, char **argv)
+{
+	const char *pInstrument = getenv("VKEL_LAYER_INSTRUMENT");
+	int instrument = pInstrument && pInstrument[0] && strcmp(pInstrument, "0");
+	
+	void *layerLibrary;
+	void *icdLibrary;
+	const VkelMockCalls *pCalls;
+	
+	PFN_vkelTestNegotiateLoaderLayerInterfaceVersion negotiate;
+	VkelTestNegotiateLayerInterface negotiateInfo;
+	PFN_vkGetInstanceProcAddr icdGetInstanceProcAddr;
+	PFN_vkGetDeviceProcAddr icdGetDeviceProcAddr;
+	PFN_vkGetInstanceProcAddr getInstanceProcAddr;
+	PFN_vkGetDeviceProcAddr getDeviceProcAddr;
+	
+	VkelTestInstanceLink instanceLink;
+	VkelTestInstanceCreateInfo instanceChainInfo;
+	VkInstanceCreateInfo instanceCreateInfo;
+	VkInstance instance;
+	
+	PFN_vkEnumeratePhysicalDevices enumeratePhysicalDevices;
+	VkPhysicalDevice physicalDevice;
+	uint32_t physicalDeviceCount = 1;
+	
+	VkDevice devices[2];
+	PFN_vkAllocateCommandBuffers allocateCommandBuffers;
+	PFN_vkFreeCommandBuffers freeCommandBuffers;
+	PFN_vkCmdDraw cmdDraw;
+	VkCommandBufferAllocateInfo allocateInfo;
+	VkCommandBuffer commandBuffer;
+	uint32_t i;
+	
+	if (argc < 3)
+	{
+		fprintf(stderr, "usage: %s <layer library> <driver library>\n", argv[0]);
+		return 2;
+	}
+	
+	// The layer writes its report when unloaded
+	setenv("VKEL_LAYER_OUTPUT", VKEL_TEST_REPORT_PATH, 1);
+	remove(VKEL_TEST_REPORT_PATH);
+	
+	layerLibrary = dlopen(argv[1], RTLD_NOW | RTLD_LOCAL);
+	icdLibrary = dlopen(argv[2], RTLD_NOW | RTLD_LOCAL);
+	
+	VKEL_TEST_CHECK(layerLibrary && icdLibrary);
+	
+	negotiate = (PFN_vkelTestNegotiateLoaderLayerInterfaceVersion) dlsym(layerLibrary, "vkNegotiateLoaderLayerInterfaceVersion");
+	icdGetInstanceProcAddr = (PFN_vkGetInstanceProcAddr) dlsym(icdLibrary, "vk_icdGetInstanceProcAddr");
+	pCalls = (const VkelMockCalls*) dlsym(icdLibrary, "vkelMockCalls");
+	
+	VKEL_TEST_CHECK(negotiate && icdGetInstanceProcAddr && pCalls);
+	
+	// Negotiate
+	
+	memset(&negotiateInfo, 0, sizeof(negotiateInfo));
+	negotiateInfo.sType = VKEL_TEST_NEGOTIATE_INTERFACE_STRUCT;
+	negotiateInfo.loaderLayerInterfaceVersion = 1;
+	
+	VKEL_TEST_CHECK(negotiate(&negotiateInfo) != VK_SUCCESS);
+	
+	negotiateInfo.loaderLayerInterfaceVersion = 5;
+	
+	VKEL_TEST_CHECK(negotiate(&negotiateInfo) == VK_SUCCESS);
+	VKEL_TEST_CHECK(negotiateInfo.loaderLayerInterfaceVersion == 2);
+	VKEL_TEST_CHECK(negotiateInfo.pfnGetInstanceProcAddr && negotiateInfo.pfnGetDeviceProcAddr);
+	
+	getInstanceProcAddr = negotiateInfo.pfnGetInstanceProcAddr;
+	getDeviceProcAddr = negotiateInfo.pfnGetDeviceProcAddr;
+	
+	VKEL_TEST_CHECK(getInstanceProcAddr(VK_NULL_HANDLE, "vkGetInstanceProcAddr") == (PFN_vkVoidFunction) getInstanceProcAddr);
+	VKEL_TEST_CHECK(getInstanceProcAddr(VK_NULL_HANDLE, "vkEnumeratePhysicalDevices") == NULL);
+	
+	// Instance
+	
+	memset(&instanceLink, 0, sizeof(instanceLink));
+	instanceLink.pfnNextGetInstanceProcAddr = icdGetInstanceProcAddr;
+	
+	memset(&instanceChainInfo, 0, sizeof(instanceChainInfo));
+	instanceChainInfo.sType = VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO;
+	instanceChainInfo.function = VKEL_TEST_LAYER_LINK_INFO;
+	instanceChainInfo.u.pLayerInfo = &instanceLink;
+	
+	memset(&instanceCreateInfo, 0, sizeof(instanceCreateInfo));
+	instanceCreateInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+	instanceCreateInfo.pNext = &instanceChainInfo;
+	
+	VKEL_TEST_CHECK(((PFN_vkCreateInstance) getInstanceProcAddr(VK_NULL_HANDLE, "vkCreateInstance"))(&instanceCreateInfo, NULL, &instance) == VK_SUCCESS);
+	VKEL_TEST_CHECK(pCalls->createInstance == 1);
+	// The layer passes the next link on to the next layer
+	VKEL_TEST_CHECK(instanceChainInfo.u.pLayerInfo == NULL);
+	
+	enumeratePhysicalDevices = (PFN_vkEnumeratePhysicalDevices) getInstanceProcAddr(instance, "vkEnumeratePhysicalDevices");
+	
+	VKEL_TEST_CHECK(enumeratePhysicalDevices);
+	VKEL_TEST_CHECK((enumeratePhysicalDevices == (PFN_vkEnumeratePhysicalDevices) icdGetInstanceProcAddr(instance, "vkEnumeratePhysicalDevices")) == !instrument);
+	VKEL_TEST_CHECK(getInstanceProcAddr(instance, "vkGetInstanceProcAddr") == (PFN_vkVoidFunction) getInstanceProcAddr);
+	
+	VKEL_TEST_CHECK(enumeratePhysicalDevices(instance, &physicalDeviceCount, &physicalDevice) == VK_SUCCESS);
+	VKEL_TEST_CHECK(physicalDeviceCount == 1);
+	
+	// Devices
+	
+	VKEL_TEST_CHECK(vkelTestCreateDevice(getInstanceProcAddr, icdGetInstanceProcAddr, instance, physicalDevice, &devices[0]) == VK_SUCCESS);
+	VKEL_TEST_CHECK(vkelTestCreateDevice(getInstanceProcAddr, icdGetInstanceProcAddr, instance, physicalDevice, &devices[1]) == VK_SUCCESS);
+	VKEL_TEST_CHECK(pCalls->createDevice == 2);
+	
+	icdGetDeviceProcAddr = (PFN_vkGetDeviceProcAddr) icdGetInstanceProcAddr(instance, "vkGetDeviceProcAddr");
+	
+	allocateCommandBuffers = (PFN_vkAllocateCommandBuffers) getDeviceProcAddr(devices[0], "vkAllocateCommandBuffers");
+	freeCommandBuffers = (PFN_vkFreeCommandBuffers) getDeviceProcAddr(devices[0], "vkFreeCommandBuffers");
+	cmdDraw = (PFN_vkCmdDraw) getDeviceProcAddr(devices[0], "vkCmdDraw");
+	
+	VKEL_TEST_CHECK(allocateCommandBuffers && freeCommandBuffers && cmdDraw);
+	VKEL_TEST_CHECK((allocateCommandBuffers == (PFN_vkAllocateCommandBuffers) icdGetDeviceProcAddr(devices[0], "vkAllocateCommandBuffers")) == !instrument);
+	VKEL_TEST_CHECK((freeCommandBuffers == (PFN_vkFreeCommandBuffers) icdGetDeviceProcAddr(devices[0], "vkFreeCommandBuffers")) == !instrument);
+	VKEL_TEST_CHECK((cmdDraw == (PFN_vkCmdDraw) icdGetDeviceProcAddr(devices[0], "vkCmdDraw")) == !instrument);
+	
+	// The layer always keeps its own, and doesn't make up what the driver lacks
+	VKEL_TEST_CHECK(getDeviceProcAddr(devices[0], "vkGetDeviceProcAddr") == (PFN_vkVoidFunction) getDeviceProcAddr);
+	VKEL_TEST_CHECK(getDeviceProcAddr(devices[0], "vkDestroyDevice") != icdGetDeviceProcAddr(devices[0], "vkDestroyDevice"));
+	VKEL_TEST_CHECK(getDeviceProcAddr(devices[0], "vkCmdDrawIndexed") == NULL);
+	
+	memset(&allocateInfo, 0, sizeof(allocateInfo));
+	allocateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+	allocateInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+	allocateInfo.commandBufferCount = 1;
+	
+	VKEL_TEST_CHECK(allocateCommandBuffers(devices[0], &allocateInfo, &commandBuffer) == VK_SUCCESS);
+	
+	for (i = 0; i < VKEL_TEST_DRAW_COUNT; ++i)
+		cmdDraw(commandBuffer, 3, 1, 0, 0);
+	
+	freeCommandBuffers(devices[0], VK_NULL_HANDLE, 1, &commandBuffer);
+	
+	VKEL_TEST_CHECK(pCalls->cmdDraw == VKEL_TEST_DRAW_COUNT);
+	
+	((PFN_vkDestroyDevice) getDeviceProcAddr(devices[1], "vkDestroyDevice"))(devices[1], NULL);
+	((PFN_vkDestroyDevice) getDeviceProcAddr(devices[0], "vkDestroyDevice"))(devices[0], NULL);
+	
+	VKEL_TEST_CHECK(pCalls->destroyDevice == 2);
+	
+	((PFN_vkDestroyInstance) getInstanceProcAddr(instance, "vkDestroyInstance"))(instance, NULL);
+	
+	VKEL_TEST_CHECK(pCalls->destroyInstance == 1);
+	
+	// Report
+	
+	dlclose(layerLibrary);
+	
+	if (instrument)
+	{
+		VKEL_TEST_CHECK(vkelTestGetReportedCalls(VKEL_TEST_REPORT_PATH, "vkEnumeratePhysicalDevices") == pCalls->enumeratePhysicalDevices);
+		VKEL_TEST_CHECK(vkelTestGetReportedCalls(VKEL_TEST_REPORT_PATH, "vkAllocateCommandBuffers") == pCalls->allocateCommandBuffers);
+		VKEL_TEST_CHECK(vkelTestGetReportedCalls(VKEL_TEST_REPORT_PATH, "vkFreeCommandBuffers") == pCalls->freeCommandBuffers);
+		VKEL_TEST_CHECK(vkelTestGetReportedCalls(VKEL_TEST_REPORT_PATH, "vkCmdDraw") == VKEL_TEST_DRAW_COUNT);
+	}
+	else
+	{
+		// Nothing to report, as the layer was never part of a call
+		VKEL_TEST_CHECK(fopen(VKEL_TEST_REPORT_PATH, "r") == NULL);
+	}
+	
+	dlclose(icdLibrary);
+	
+	printf("layer_test: %s passed\n", instrument ? "instrumented" : "pass-through");
+	
+	return 0;
+}
@@ -0,0 +1,198 @@
+// A Vulkan driver that implements just enough to build a layer chain on top of it, and counts
+// every call it gets (see mock_icd.h).
+//
+// The driver also does the loader's part of creating dispatchable handles: their first pointer
+// is the dispatch key, shared by an instance and its physical devices, and by a device and its
+// command buffers. Layers find their instance or device by this key.
+
+#define VKEL_NO_FUNCTION_MACROS
+#include "vkel.h"
+
+#include <stdlib.h> /* calloc(), free() */
+#include <string.h> /* strcmp() */
+
+#include "mock_icd.h"
+
+#define VKEL_MOCK_EXPORT __attribute__((visibility("default")))
+
+
+typedef struct VkelMockHandle {
+	const void *dispatchKey;
+} VkelMockHandle;
+
+typedef struct VkelMockDevice {
+	const void *dispatchKey;
+	int dispatch;
+} VkelMockDevice;
+
+VKEL_MOCK_EXPORT VkelMockCalls vkelMockCalls;
+
+static int vkelMockInstanceDispatch;
+
+static VkelMockHandle vkelMockInstance = { &vkelMockInstanceDispatch };
+static VkelMockHandle vkelMockPhysicalDevice = { &vkelMockInstanceDispatch };
+
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelMockCreateInstance(const VkInstanceCreateInfo *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkInstance *pInstance)
+{
+	(void) pCreateInfo;
+	(void) pAllocator;
+	
+	vkelMockCalls.createInstance++;
+	
+	*pInstance = (VkInstance) &vkelMockInstance;
+	
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelMockDestroyInstance(VkInstance instance, const VkAllocationCallbacks *pAllocator)
+{
+	(void) instance;
+	(void) pAllocator;
+	
+	vkelMockCalls.destroyInstance++;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelMockEnumeratePhysicalDevices(VkInstance instance, uint32_t *pPhysicalDeviceCount, VkPhysicalDevice *pPhysicalDevices)
+{
+	(void) instance;
+	
+	vkelMockCalls.enumeratePhysicalDevices++;
+	
+	if (!pPhysicalDevices)
+	{
+		*pPhysicalDeviceCount = 1;
+		return VK_SUCCESS;
+	}
+	
+	if (!*pPhysicalDeviceCount)
+		return VK_INCOMPLETE;
+	
+	pPhysicalDevices[0] = (VkPhysicalDevice) &vkelMockPhysicalDevice;
+	*pPhysicalDeviceCount = 1;
+	
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelMockCreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkDevice *pDevice)
+{
+	VkelMockDevice *pMockDevice = (VkelMockDevice*) calloc(1, sizeof(VkelMockDevice));
+	
+	(void) physicalDevice;
+	(void) pCreateInfo;
+	(void) pAllocator;
+	
+	vkelMockCalls.createDevice++;
+	
+	if (!pMockDevice)
+		return VK_ERROR_OUT_OF_HOST_MEMORY;
+	
+	// Every device has a dispatch key of its own
+	pMockDevice->dispatchKey = &pMockDevice->dispatch;
+	
+	*pDevice = (VkDevice) pMockDevice;
+	
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelMockDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator)
+{
+	(void) pAllocator;
+	
+	vkelMockCalls.destroyDevice++;
+	
+	free(device);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelMockAllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo *pAllocateInfo, VkCommandBuffer *pCommandBuffers)
+{
+	uint32_t i;
+	
+	vkelMockCalls.allocateCommandBuffers++;
+	
+	for (i = 0; i < pAllocateInfo->commandBufferCount; ++i)
+	{
+		VkelMockHandle *pCommandBuffer = (VkelMockHandle*) calloc(1, sizeof(VkelMockHandle));
+		
+		if (!pCommandBuffer)
+		{
+			while (i--)
+				free(pCommandBuffers[i]);
+			
+			return VK_ERROR_OUT_OF_HOST_MEMORY;
+		}
+		
+		pCommandBuffer->dispatchKey = ((const VkelMockDevice*) device)->dispatchKey;
+		
+		pCommandBuffers[i] = (VkCommandBuffer) pCommandBuffer;
+	}
+	
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelMockFreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount, const VkCommandBuffer *pCommandBuffers)
+{
+	uint32_t i;
+	
+	(void) device;
+	(void) commandPool;
+	
+	vkelMockCalls.freeCommandBuffers++;
+	
+	for (i = 0; i < commandBufferCount; ++i)
+		free(pCommandBuffers[i]);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelMockCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance)
+{
+	(void) commandBuffer;
+	(void) vertexCount;
+	(void) instanceCount;
+	(void) firstVertex;
+	(void) firstInstance;
+	
+	vkelMockCalls.cmdDraw++;
+}
+
+
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkelMockGetDeviceProcAddr(VkDevice device, const char *pName)
+{
+	(void) device;
+	
+	if (!strcmp(pName, "vkGetDeviceProcAddr"))
+		return (PFN_vkVoidFunction) vkelMockGetDeviceProcAddr;
+	
+	if (!strcmp(pName, "vkDestroyDevice"))
+		return (PFN_vkVoidFunction) vkelMockDestroyDevice;
+	
+	if (!strcmp(pName, "vkAllocateCommandBuffers"))
+		return (PFN_vkVoidFunction) vkelMockAllocateCommandBuffers;
+	
+	if (!strcmp(pName, "vkFreeCommandBuffers"))
+		return (PFN_vkVoidFunction) vkelMockFreeCommandBuffers;
+	
+	if (!strcmp(pName, "vkCmdDraw"))
+		return (PFN_vkVoidFunction) vkelMockCmdDraw;
+	
+	return NULL;
+}
+
+VKEL_MOCK_EXPORT VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vk_icdGetInstanceProcAddr(VkInstance instance, const char *pName)
+{
+	if (!strcmp(pName, "vkCreateInstance"))
+		return (PFN_vkVoidFunction) vkelMockCreateInstance;
+	
+	if (!instance)
+		return NULL;
+	
+	if (!strcmp(pName, "vkDestroyInstance"))
+		return (PFN_vkVoidFunction) vkelMockDestroyInstance;
+	
+	if (!strcmp(pName, "vkEnumeratePhysicalDevices"))
+		return (PFN_vkVoidFunction) vkelMockEnumeratePhysicalDevices;
+	
+	if (!strcmp(pName, "vkCreateDevice"))
+		return (PFN_vkVoidFunction) vkelMockCreateDevice;
+	
+	return vkelMockGetDeviceProcAddr(VK_NULL_HANDLE, pName);
+}
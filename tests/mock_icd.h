@@ -0,0 +1,22 @@
+// A Vulkan driver that implements just enough to build a layer chain on top of it, and counts
+// every call it gets. See mock_icd.c.
+
+#ifndef VKEL_MOCK_ICD_H_
+#define VKEL_MOCK_ICD_H_
+
+#include <stdint.h>
+
+typedef struct VkelMockCalls {
+	uint32_t createInstance;
+	uint32_t destroyInstance;
+	uint32_t enumeratePhysicalDevices;
+	uint32_t createDevice;
+	uint32_t destroyDevice;
+	uint32_t allocateCommandBuffers;
+	uint32_t freeCommandBuffers;
+	uint32_t cmdDraw;
+} VkelMockCalls;
+
+// The driver exports its counts as "vkelMockCalls"
+
+#endif /* VKEL_MOCK_ICD_H_ */
@@ -13,6 +13,9 @@
 //     Vulkan (library)
 //     Windows (header) - needed for library loading on Windows
 //     dlfcn (header) - needed for library loading on non-Windows OS'
+//     dirent (header) - needed for vkelInitDirectICD() on non-Windows OS'
+//     pthread (header) - needed for vkelInitAsync() on non-Windows OS'
+//     fcntl, unistd (headers) - needed for vkelPrewarm() on non-Windows OS'
 //     Standard C Libraries (stdio, stdlib, string, assert) - needed for NULL, malloc()
 //                                                 calloc(), free(), memset(), assert()
 //
@@ -96,6 +99,11 @@
 ** limitations under the License.
 */
 
+// For clock_gettime() and posix_fadvise()
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#	define _POSIX_C_SOURCE 200112L
+#endif
+
 #include "vkel.h"
 
 #ifdef __cplusplus
@@ -106,6 +114,8 @@ extern "C" {
 #include <stdio.h> /* NULL, printf() */
 #include <stdlib.h> /* malloc(), calloc(), free() */
 #include <string.h> /* memset() */
+#include <stddef.h> /* offsetof() */
+#include <stdint.h> /* SIZE_MAX */
 #include <assert.h> /* assert() */
 
 
@@ -128,6 +138,13 @@ extern "C" {
 #else
 
 #include <dlfcn.h>
+#include <dirent.h>
+#include <pthread.h>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
 
 #endif
 
@@ -136,1363 +153,7688 @@ extern "C" {
 #	define vkelPlatformOpenLibrary(name) LoadLibraryA(name)
 #	define vkelPlatformCloseLibrary(handle) FreeLibrary((HMODULE) handle)
 #	define vkelPlatformGetProcAddr(handle, name) GetProcAddress((HMODULE) handle, name)
+#	define VKEL_PLATFORM_LIBRARY_NAME "vulkan-1.dll"
 // #elif defined(__APPLE__) || defined(__linux__) || defined(__ANDROID__) || defined(__unix__ )
 #else
 #define vkelPlatformOpenLibrary(name) dlopen(name, RTLD_LAZY | RTLD_LOCAL)
 #define vkelPlatformCloseLibrary(handle) dlclose(handle)
 #define vkelPlatformGetProcAddr(handle, name) dlsym(handle, name)
+#define VKEL_PLATFORM_LIBRARY_NAME "libvulkan.so.1"
 // #else
 // #	error VKEL Unsupported Platform
 #endif
 
-static void *vkelVkLibHandle;
 
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+#	define VkelPlatformMutex SRWLOCK
+#	define VKEL_PLATFORM_MUTEX_INITIALIZER SRWLOCK_INIT
+#	define vkelPlatformLockMutex(mutex) AcquireSRWLockExclusive(mutex)
+#	define vkelPlatformTryLockMutex(mutex) TryAcquireSRWLockExclusive(mutex)
+#	define vkelPlatformUnlockMutex(mutex) ReleaseSRWLockExclusive(mutex)
+#else
+#	define VkelPlatformMutex pthread_mutex_t
+#	define VKEL_PLATFORM_MUTEX_INITIALIZER PTHREAD_MUTEX_INITIALIZER
+#	define vkelPlatformLockMutex(mutex) pthread_mutex_lock(mutex)
+#	define vkelPlatformTryLockMutex(mutex) (pthread_mutex_trylock(mutex) == 0)
+#	define vkelPlatformUnlockMutex(mutex) pthread_mutex_unlock(mutex)
+#endif
 
-// Instance and device extension names
-VkBool32 VKEL_AMD_gcn_shader;
-VkBool32 VKEL_AMD_rasterization_order;
-VkBool32 VKEL_AMD_shader_explicit_vertex_parameter;
-VkBool32 VKEL_AMD_shader_trinary_minmax;
-VkBool32 VKEL_EXT_debug_marker;
-VkBool32 VKEL_EXT_debug_report;
-VkBool32 VKEL_IMG_filter_cubic;
-VkBool32 VKEL_IMG_format_pvrtc;
-VkBool32 VKEL_KHR_android_surface;
-VkBool32 VKEL_KHR_display;
-VkBool32 VKEL_KHR_display_swapchain;
-VkBool32 VKEL_KHR_mir_surface;
-VkBool32 VKEL_KHR_sampler_mirror_clamp_to_edge;
-VkBool32 VKEL_KHR_surface;
-VkBool32 VKEL_KHR_swapchain;
-VkBool32 VKEL_KHR_wayland_surface;
-VkBool32 VKEL_KHR_win32_surface;
-VkBool32 VKEL_KHR_xcb_surface;
-VkBool32 VKEL_KHR_xlib_surface;
-VkBool32 VKEL_NV_dedicated_allocation;
-VkBool32 VKEL_NV_glsl_shader;
-
-// Instance and device layer names
-VkBool32 VKEL_LAYER_GOOGLE_unique_objects;
-VkBool32 VKEL_LAYER_LUNARG_api_dump;
-VkBool32 VKEL_LAYER_LUNARG_device_limits;
-VkBool32 VKEL_LAYER_LUNARG_draw_state;
-VkBool32 VKEL_LAYER_LUNARG_image;
-VkBool32 VKEL_LAYER_LUNARG_mem_tracker;
-VkBool32 VKEL_LAYER_LUNARG_object_tracker;
-VkBool32 VKEL_LAYER_LUNARG_param_checker;
-VkBool32 VKEL_LAYER_LUNARG_screenshot;
-VkBool32 VKEL_LAYER_LUNARG_swapchain;
-VkBool32 VKEL_LAYER_LUNARG_threading;
-VkBool32 VKEL_LAYER_LUNARG_vktrace;
-
-
-// Functions
-PFN_vkAcquireNextImageKHR __vkAcquireNextImageKHR;
-PFN_vkAllocateCommandBuffers __vkAllocateCommandBuffers;
-PFN_vkAllocateDescriptorSets __vkAllocateDescriptorSets;
-PFN_vkAllocateMemory __vkAllocateMemory;
-PFN_vkAllocationFunction __vkAllocationFunction;
-PFN_vkBeginCommandBuffer __vkBeginCommandBuffer;
-PFN_vkBindBufferMemory __vkBindBufferMemory;
-PFN_vkBindImageMemory __vkBindImageMemory;
-PFN_vkCmdBeginQuery __vkCmdBeginQuery;
-PFN_vkCmdBeginRenderPass __vkCmdBeginRenderPass;
-PFN_vkCmdBindDescriptorSets __vkCmdBindDescriptorSets;
-PFN_vkCmdBindIndexBuffer __vkCmdBindIndexBuffer;
-PFN_vkCmdBindPipeline __vkCmdBindPipeline;
-PFN_vkCmdBindVertexBuffers __vkCmdBindVertexBuffers;
-PFN_vkCmdBlitImage __vkCmdBlitImage;
-PFN_vkCmdClearAttachments __vkCmdClearAttachments;
-PFN_vkCmdClearColorImage __vkCmdClearColorImage;
-PFN_vkCmdClearDepthStencilImage __vkCmdClearDepthStencilImage;
-PFN_vkCmdCopyBuffer __vkCmdCopyBuffer;
-PFN_vkCmdCopyBufferToImage __vkCmdCopyBufferToImage;
-PFN_vkCmdCopyImage __vkCmdCopyImage;
-PFN_vkCmdCopyImageToBuffer __vkCmdCopyImageToBuffer;
-PFN_vkCmdCopyQueryPoolResults __vkCmdCopyQueryPoolResults;
-PFN_vkCmdDebugMarkerBeginEXT __vkCmdDebugMarkerBeginEXT;
-PFN_vkCmdDebugMarkerEndEXT __vkCmdDebugMarkerEndEXT;
-PFN_vkCmdDebugMarkerInsertEXT __vkCmdDebugMarkerInsertEXT;
-PFN_vkCmdDispatch __vkCmdDispatch;
-PFN_vkCmdDispatchIndirect __vkCmdDispatchIndirect;
-PFN_vkCmdDraw __vkCmdDraw;
-PFN_vkCmdDrawIndexed __vkCmdDrawIndexed;
-PFN_vkCmdDrawIndexedIndirect __vkCmdDrawIndexedIndirect;
-PFN_vkCmdDrawIndirect __vkCmdDrawIndirect;
-PFN_vkCmdEndQuery __vkCmdEndQuery;
-PFN_vkCmdEndRenderPass __vkCmdEndRenderPass;
-PFN_vkCmdExecuteCommands __vkCmdExecuteCommands;
-PFN_vkCmdFillBuffer __vkCmdFillBuffer;
-PFN_vkCmdNextSubpass __vkCmdNextSubpass;
-PFN_vkCmdPipelineBarrier __vkCmdPipelineBarrier;
-PFN_vkCmdPushConstants __vkCmdPushConstants;
-PFN_vkCmdResetEvent __vkCmdResetEvent;
-PFN_vkCmdResetQueryPool __vkCmdResetQueryPool;
-PFN_vkCmdResolveImage __vkCmdResolveImage;
-PFN_vkCmdSetBlendConstants __vkCmdSetBlendConstants;
-PFN_vkCmdSetDepthBias __vkCmdSetDepthBias;
-PFN_vkCmdSetDepthBounds __vkCmdSetDepthBounds;
-PFN_vkCmdSetEvent __vkCmdSetEvent;
-PFN_vkCmdSetLineWidth __vkCmdSetLineWidth;
-PFN_vkCmdSetScissor __vkCmdSetScissor;
-PFN_vkCmdSetStencilCompareMask __vkCmdSetStencilCompareMask;
-PFN_vkCmdSetStencilReference __vkCmdSetStencilReference;
-PFN_vkCmdSetStencilWriteMask __vkCmdSetStencilWriteMask;
-PFN_vkCmdSetViewport __vkCmdSetViewport;
-PFN_vkCmdUpdateBuffer __vkCmdUpdateBuffer;
-PFN_vkCmdWaitEvents __vkCmdWaitEvents;
-PFN_vkCmdWriteTimestamp __vkCmdWriteTimestamp;
-PFN_vkCreateBuffer __vkCreateBuffer;
-PFN_vkCreateBufferView __vkCreateBufferView;
-PFN_vkCreateCommandPool __vkCreateCommandPool;
-PFN_vkCreateComputePipelines __vkCreateComputePipelines;
-PFN_vkCreateDebugReportCallbackEXT __vkCreateDebugReportCallbackEXT;
-PFN_vkCreateDescriptorPool __vkCreateDescriptorPool;
-PFN_vkCreateDescriptorSetLayout __vkCreateDescriptorSetLayout;
-PFN_vkCreateDevice __vkCreateDevice;
-PFN_vkCreateDisplayModeKHR __vkCreateDisplayModeKHR;
-PFN_vkCreateDisplayPlaneSurfaceKHR __vkCreateDisplayPlaneSurfaceKHR;
-PFN_vkCreateEvent __vkCreateEvent;
-PFN_vkCreateFence __vkCreateFence;
-PFN_vkCreateFramebuffer __vkCreateFramebuffer;
-PFN_vkCreateGraphicsPipelines __vkCreateGraphicsPipelines;
-PFN_vkCreateImage __vkCreateImage;
-PFN_vkCreateImageView __vkCreateImageView;
-PFN_vkCreateInstance __vkCreateInstance;
-PFN_vkCreatePipelineCache __vkCreatePipelineCache;
-PFN_vkCreatePipelineLayout __vkCreatePipelineLayout;
-PFN_vkCreateQueryPool __vkCreateQueryPool;
-PFN_vkCreateRenderPass __vkCreateRenderPass;
-PFN_vkCreateSampler __vkCreateSampler;
-PFN_vkCreateSemaphore __vkCreateSemaphore;
-PFN_vkCreateShaderModule __vkCreateShaderModule;
-PFN_vkCreateSharedSwapchainsKHR __vkCreateSharedSwapchainsKHR;
-PFN_vkCreateSwapchainKHR __vkCreateSwapchainKHR;
-PFN_vkDebugMarkerSetObjectNameEXT __vkDebugMarkerSetObjectNameEXT;
-PFN_vkDebugMarkerSetObjectTagEXT __vkDebugMarkerSetObjectTagEXT;
-PFN_vkDebugReportCallbackEXT __vkDebugReportCallbackEXT;
-PFN_vkDebugReportMessageEXT __vkDebugReportMessageEXT;
-PFN_vkDestroyBuffer __vkDestroyBuffer;
-PFN_vkDestroyBufferView __vkDestroyBufferView;
-PFN_vkDestroyCommandPool __vkDestroyCommandPool;
-PFN_vkDestroyDebugReportCallbackEXT __vkDestroyDebugReportCallbackEXT;
-PFN_vkDestroyDescriptorPool __vkDestroyDescriptorPool;
-PFN_vkDestroyDescriptorSetLayout __vkDestroyDescriptorSetLayout;
-PFN_vkDestroyDevice __vkDestroyDevice;
-PFN_vkDestroyEvent __vkDestroyEvent;
-PFN_vkDestroyFence __vkDestroyFence;
-PFN_vkDestroyFramebuffer __vkDestroyFramebuffer;
-PFN_vkDestroyImage __vkDestroyImage;
-PFN_vkDestroyImageView __vkDestroyImageView;
-PFN_vkDestroyInstance __vkDestroyInstance;
-PFN_vkDestroyPipeline __vkDestroyPipeline;
-PFN_vkDestroyPipelineCache __vkDestroyPipelineCache;
-PFN_vkDestroyPipelineLayout __vkDestroyPipelineLayout;
-PFN_vkDestroyQueryPool __vkDestroyQueryPool;
-PFN_vkDestroyRenderPass __vkDestroyRenderPass;
-PFN_vkDestroySampler __vkDestroySampler;
-PFN_vkDestroySemaphore __vkDestroySemaphore;
-PFN_vkDestroyShaderModule __vkDestroyShaderModule;
-PFN_vkDestroySurfaceKHR __vkDestroySurfaceKHR;
-PFN_vkDestroySwapchainKHR __vkDestroySwapchainKHR;
-PFN_vkDeviceWaitIdle __vkDeviceWaitIdle;
-PFN_vkEndCommandBuffer __vkEndCommandBuffer;
-PFN_vkEnumerateDeviceExtensionProperties __vkEnumerateDeviceExtensionProperties;
-PFN_vkEnumerateDeviceLayerProperties __vkEnumerateDeviceLayerProperties;
-PFN_vkEnumerateInstanceExtensionProperties __vkEnumerateInstanceExtensionProperties;
-PFN_vkEnumerateInstanceLayerProperties __vkEnumerateInstanceLayerProperties;
-PFN_vkEnumeratePhysicalDevices __vkEnumeratePhysicalDevices;
-PFN_vkFlushMappedMemoryRanges __vkFlushMappedMemoryRanges;
-PFN_vkFreeCommandBuffers __vkFreeCommandBuffers;
-PFN_vkFreeDescriptorSets __vkFreeDescriptorSets;
-PFN_vkFreeFunction __vkFreeFunction;
-PFN_vkFreeMemory __vkFreeMemory;
-PFN_vkGetBufferMemoryRequirements __vkGetBufferMemoryRequirements;
-PFN_vkGetDeviceMemoryCommitment __vkGetDeviceMemoryCommitment;
-PFN_vkGetDeviceProcAddr __vkGetDeviceProcAddr;
-PFN_vkGetDeviceQueue __vkGetDeviceQueue;
-PFN_vkGetDisplayModePropertiesKHR __vkGetDisplayModePropertiesKHR;
-PFN_vkGetDisplayPlaneCapabilitiesKHR __vkGetDisplayPlaneCapabilitiesKHR;
-PFN_vkGetDisplayPlaneSupportedDisplaysKHR __vkGetDisplayPlaneSupportedDisplaysKHR;
-PFN_vkGetEventStatus __vkGetEventStatus;
-PFN_vkGetFenceStatus __vkGetFenceStatus;
-PFN_vkGetImageMemoryRequirements __vkGetImageMemoryRequirements;
-PFN_vkGetImageSparseMemoryRequirements __vkGetImageSparseMemoryRequirements;
-PFN_vkGetImageSubresourceLayout __vkGetImageSubresourceLayout;
-PFN_vkGetInstanceProcAddr __vkGetInstanceProcAddr;
-PFN_vkGetPhysicalDeviceDisplayPlanePropertiesKHR __vkGetPhysicalDeviceDisplayPlanePropertiesKHR;
-PFN_vkGetPhysicalDeviceDisplayPropertiesKHR __vkGetPhysicalDeviceDisplayPropertiesKHR;
-PFN_vkGetPhysicalDeviceFeatures __vkGetPhysicalDeviceFeatures;
-PFN_vkGetPhysicalDeviceFormatProperties __vkGetPhysicalDeviceFormatProperties;
-PFN_vkGetPhysicalDeviceImageFormatProperties __vkGetPhysicalDeviceImageFormatProperties;
-PFN_vkGetPhysicalDeviceMemoryProperties __vkGetPhysicalDeviceMemoryProperties;
-PFN_vkGetPhysicalDeviceProperties __vkGetPhysicalDeviceProperties;
-PFN_vkGetPhysicalDeviceQueueFamilyProperties __vkGetPhysicalDeviceQueueFamilyProperties;
-PFN_vkGetPhysicalDeviceSparseImageFormatProperties __vkGetPhysicalDeviceSparseImageFormatProperties;
-PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR __vkGetPhysicalDeviceSurfaceCapabilitiesKHR;
-PFN_vkGetPhysicalDeviceSurfaceFormatsKHR __vkGetPhysicalDeviceSurfaceFormatsKHR;
-PFN_vkGetPhysicalDeviceSurfacePresentModesKHR __vkGetPhysicalDeviceSurfacePresentModesKHR;
-PFN_vkGetPhysicalDeviceSurfaceSupportKHR __vkGetPhysicalDeviceSurfaceSupportKHR;
-PFN_vkGetPipelineCacheData __vkGetPipelineCacheData;
-PFN_vkGetQueryPoolResults __vkGetQueryPoolResults;
-PFN_vkGetRenderAreaGranularity __vkGetRenderAreaGranularity;
-PFN_vkGetSwapchainImagesKHR __vkGetSwapchainImagesKHR;
-PFN_vkInternalAllocationNotification __vkInternalAllocationNotification;
-PFN_vkInternalFreeNotification __vkInternalFreeNotification;
-PFN_vkInvalidateMappedMemoryRanges __vkInvalidateMappedMemoryRanges;
-PFN_vkMapMemory __vkMapMemory;
-PFN_vkMergePipelineCaches __vkMergePipelineCaches;
-PFN_vkQueueBindSparse __vkQueueBindSparse;
-PFN_vkQueuePresentKHR __vkQueuePresentKHR;
-PFN_vkQueueSubmit __vkQueueSubmit;
-PFN_vkQueueWaitIdle __vkQueueWaitIdle;
-PFN_vkReallocationFunction __vkReallocationFunction;
-PFN_vkResetCommandBuffer __vkResetCommandBuffer;
-PFN_vkResetCommandPool __vkResetCommandPool;
-PFN_vkResetDescriptorPool __vkResetDescriptorPool;
-PFN_vkResetEvent __vkResetEvent;
-PFN_vkResetFences __vkResetFences;
-PFN_vkSetEvent __vkSetEvent;
-PFN_vkUnmapMemory __vkUnmapMemory;
-PFN_vkUpdateDescriptorSets __vkUpdateDescriptorSets;
-PFN_vkVoidFunction __vkVoidFunction;
-PFN_vkWaitForFences __vkWaitForFences;
 
-#ifdef VK_USE_PLATFORM_ANDROID_KHR
-PFN_vkCreateAndroidSurfaceKHR __vkCreateAndroidSurfaceKHR;
-#endif /* VK_USE_PLATFORM_ANDROID_KHR */
+static void* vkelAtomicLoadPointer(void* volatile *pPointer)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return __atomic_load_n(pPointer, __ATOMIC_ACQUIRE);
+#elif defined(_MSC_VER)
+	void *pointer = *pPointer;
+	MemoryBarrier();
+	return pointer;
+#else
+#	error vkel needs atomic loads and stores for this compiler
+#endif
+}
 
-#ifdef VK_USE_PLATFORM_MIR_KHR
-PFN_vkCreateMirSurfaceKHR __vkCreateMirSurfaceKHR;
-PFN_vkGetPhysicalDeviceMirPresentationSupportKHR __vkGetPhysicalDeviceMirPresentationSupportKHR;
-#endif /* VK_USE_PLATFORM_MIR_KHR */
+static void vkelAtomicStorePointer(void* volatile *pPointer, void *pointer)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	__atomic_store_n(pPointer, pointer, __ATOMIC_RELEASE);
+#elif defined(_MSC_VER)
+	MemoryBarrier();
+	*pPointer = pointer;
+#else
+#	error vkel needs atomic loads and stores for this compiler
+#endif
+}
 
-#ifdef VK_USE_PLATFORM_WAYLAND_KHR
-PFN_vkCreateWaylandSurfaceKHR __vkCreateWaylandSurfaceKHR;
-PFN_vkGetPhysicalDeviceWaylandPresentationSupportKHR __vkGetPhysicalDeviceWaylandPresentationSupportKHR;
-#endif /* VK_USE_PLATFORM_WAYLAND_KHR */
+// Functions of vkelTable that other threads may be calling are replaced with a store
+// per function, so a concurrent call gets either the old or the new function, but never
+// a torn pointer. The device level functions are instead swapped as a whole.
+#if defined(__GNUC__) || defined(__clang__)
+#	define vkelAtomicStoreProc(proc, value) __atomic_store_n(&(proc), (value), __ATOMIC_RELAXED)
+#else
+#	define vkelAtomicStoreProc(proc, value) ((proc) = (value))
+#endif
 
-#ifdef VK_USE_PLATFORM_WIN32_KHR
-PFN_vkCreateWin32SurfaceKHR __vkCreateWin32SurfaceKHR;
-PFN_vkGetPhysicalDeviceWin32PresentationSupportKHR __vkGetPhysicalDeviceWin32PresentationSupportKHR;
-#endif /* VK_USE_PLATFORM_WIN32_KHR */
+static void *vkelVkLibHandle;
 
-#ifdef VK_USE_PLATFORM_XCB_KHR
-PFN_vkCreateXcbSurfaceKHR __vkCreateXcbSurfaceKHR;
-PFN_vkGetPhysicalDeviceXcbPresentationSupportKHR __vkGetPhysicalDeviceXcbPresentationSupportKHR;
-#endif /* VK_USE_PLATFORM_XCB_KHR */
+// Set when vkelInitDirectICD() loaded an ICD instead of the Vulkan loader
+static PFN_vkGetInstanceProcAddr vkelIcdGetInstanceProcAddr;
+
+static VkAllocationCallbacks vkelAllocationCallbacks;
+static const VkAllocationCallbacks *vkelAllocator;
+
+
+static const char* const vkelExtensionNames[] = {
+	"VK_KHR_surface",
+	"VK_KHR_swapchain",
+	"VK_KHR_display",
+	"VK_KHR_display_swapchain",
+	"VK_KHR_xlib_surface",
+	"VK_KHR_xcb_surface",
+	"VK_KHR_wayland_surface",
+	"VK_KHR_mir_surface",
+	"VK_KHR_android_surface",
+	"VK_KHR_win32_surface",
+	"VK_KHR_sampler_mirror_clamp_to_edge",
+	"VK_EXT_debug_report",
+	"VK_NV_glsl_shader",
+	"VK_IMG_filter_cubic",
+	"VK_AMD_rasterization_order",
+	"VK_AMD_shader_trinary_minmax",
+	"VK_AMD_shader_explicit_vertex_parameter",
+	"VK_EXT_debug_marker",
+	"VK_AMD_gcn_shader",
+	"VK_NV_dedicated_allocation",
+	"VK_IMG_format_pvrtc",
+	NULL
+};
+
+static const uint32_t vkelExtensionIdsByName[] = {
+	VKEL_EXT_ID_AMD_gcn_shader,
+	VKEL_EXT_ID_AMD_rasterization_order,
+	VKEL_EXT_ID_AMD_shader_explicit_vertex_parameter,
+	VKEL_EXT_ID_AMD_shader_trinary_minmax,
+	VKEL_EXT_ID_EXT_debug_marker,
+	VKEL_EXT_ID_EXT_debug_report,
+	VKEL_EXT_ID_IMG_filter_cubic,
+	VKEL_EXT_ID_IMG_format_pvrtc,
+	VKEL_EXT_ID_KHR_android_surface,
+	VKEL_EXT_ID_KHR_display,
+	VKEL_EXT_ID_KHR_display_swapchain,
+	VKEL_EXT_ID_KHR_mir_surface,
+	VKEL_EXT_ID_KHR_sampler_mirror_clamp_to_edge,
+	VKEL_EXT_ID_KHR_surface,
+	VKEL_EXT_ID_KHR_swapchain,
+	VKEL_EXT_ID_KHR_wayland_surface,
+	VKEL_EXT_ID_KHR_win32_surface,
+	VKEL_EXT_ID_KHR_xcb_surface,
+	VKEL_EXT_ID_KHR_xlib_surface,
+	VKEL_EXT_ID_NV_dedicated_allocation,
+	VKEL_EXT_ID_NV_glsl_shader,
+	VKEL_EXT_ID_COUNT
+};
+
+
+static const char* const vkelLayerNames[] = {
+	"VK_LAYER_LUNARG_api_dump",
+	"VK_LAYER_LUNARG_device_limits",
+	"VK_LAYER_LUNARG_draw_state",
+	"VK_LAYER_LUNARG_image",
+	"VK_LAYER_LUNARG_mem_tracker",
+	"VK_LAYER_LUNARG_object_tracker",
+	"VK_LAYER_LUNARG_param_checker",
+	"VK_LAYER_LUNARG_screenshot",
+	"VK_LAYER_LUNARG_swapchain",
+	"VK_LAYER_LUNARG_threading",
+	"VK_LAYER_GOOGLE_unique_objects",
+	"VK_LAYER_LUNARG_vktrace",
+	NULL
+};
+
+static const uint32_t vkelLayerIdsByName[] = {
+	VKEL_LAYER_ID_GOOGLE_unique_objects,
+	VKEL_LAYER_ID_LUNARG_api_dump,
+	VKEL_LAYER_ID_LUNARG_device_limits,
+	VKEL_LAYER_ID_LUNARG_draw_state,
+	VKEL_LAYER_ID_LUNARG_image,
+	VKEL_LAYER_ID_LUNARG_mem_tracker,
+	VKEL_LAYER_ID_LUNARG_object_tracker,
+	VKEL_LAYER_ID_LUNARG_param_checker,
+	VKEL_LAYER_ID_LUNARG_screenshot,
+	VKEL_LAYER_ID_LUNARG_swapchain,
+	VKEL_LAYER_ID_LUNARG_threading,
+	VKEL_LAYER_ID_LUNARG_vktrace,
+	VKEL_LAYER_ID_COUNT
+};
+
+
+static VkelCapabilities vkelInstanceCapabilities;
+
+
+// What the device level vk* macros call until initialized
+static VkelDeviceTable vkelNullDeviceTable;
+
+// Functions, along with what's needed to share them (see vkelGetTable())
+VkelTable vkelTable = {
+	0, 0, 0, 0,
+	NULL, NULL, NULL, NULL,
+	
+	NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+	NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+	NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+	NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+	NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+	NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+	NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+	NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+	NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+	NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+	NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+	
+	&vkelNullDeviceTable
+};
 
-#ifdef VK_USE_PLATFORM_XLIB_KHR
-PFN_vkCreateXlibSurfaceKHR __vkCreateXlibSurfaceKHR;
-PFN_vkGetPhysicalDeviceXlibPresentationSupportKHR __vkGetPhysicalDeviceXlibPresentationSupportKHR;
-#endif /* VK_USE_PLATFORM_XLIB_KHR */
+// The entry vkelTable.pDeviceTable belongs to, whose device is VK_NULL_HANDLE
+// when the functions are the ones loaded by vkelInit()/vkelInstanceInit()
+static void* volatile vkelCurrentDevice;
 
 
-PFN_vkVoidFunction vkelGetProcAddr(const char *name)
+#ifdef VKEL_FALLBACK_STUBS
+
+typedef struct VkelStub
 {
-	return (PFN_vkVoidFunction) vkelPlatformGetProcAddr(vkelVkLibHandle, name);
-}
+	size_t offset;
+	PFN_vkVoidFunction stub;
+} VkelStub;
 
-PFN_vkVoidFunction vkelGetInstanceProcAddr(VkInstance instance, const char *pName)
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubCreateInstance(const VkInstanceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkInstance* pInstance)
 {
-	PFN_vkVoidFunction proc = (PFN_vkVoidFunction) vkGetInstanceProcAddr(instance, pName);
-	
-	if (!proc)
-		proc = (PFN_vkVoidFunction) vkelGetProcAddr(pName);
-	
-	return proc;
+	(void) pCreateInfo; (void) pAllocator; (void) pInstance;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
 }
 
-PFN_vkVoidFunction vkelGetDeviceProcAddr(VkDevice device, const char *pName)
+static VKAPI_ATTR void VKAPI_CALL vkelStubDestroyInstance(VkInstance instance, const VkAllocationCallbacks* pAllocator)
 {
-	PFN_vkVoidFunction proc = (PFN_vkVoidFunction) vkGetDeviceProcAddr(device, pName);
-	
-	if (!proc)
-		proc = (PFN_vkVoidFunction) vkelGetInstanceProcAddr(NULL, pName);
-	
-	return proc;
+	(void) instance; (void) pAllocator;
 }
 
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubEnumeratePhysicalDevices(VkInstance instance, uint32_t* pPhysicalDeviceCount, VkPhysicalDevice* pPhysicalDevices)
+{
+	(void) instance; (void) pPhysicalDeviceCount; (void) pPhysicalDevices;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
 
-static int vkel_strcmp(const char *str1, const char *str2)
+static VKAPI_ATTR void VKAPI_CALL vkelStubGetPhysicalDeviceFeatures(VkPhysicalDevice physicalDevice, VkPhysicalDeviceFeatures* pFeatures)
 {
-	while (*str1 && (*str1 == *str2))
-	{
-		str1++, str2++;
-	}
+	(void) physicalDevice; (void) pFeatures;
+}
 
-	return *(const unsigned char*) str1 - *(const unsigned char*) str2;
+static VKAPI_ATTR void VKAPI_CALL vkelStubGetPhysicalDeviceFormatProperties(VkPhysicalDevice physicalDevice, VkFormat format, VkFormatProperties* pFormatProperties)
+{
+	(void) physicalDevice; (void) format; (void) pFormatProperties;
 }
 
-static void vkel_strpy(char *dest, char *src)
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubGetPhysicalDeviceImageFormatProperties(VkPhysicalDevice physicalDevice, VkFormat format, VkImageType type, VkImageTiling tiling, VkImageUsageFlags usage, VkImageCreateFlags flags, VkImageFormatProperties* pImageFormatProperties)
 {
-	while (*dest++ = *src++);
+	(void) physicalDevice; (void) format; (void) type; (void) tiling; (void) usage; (void) flags; (void) pImageFormatProperties;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
 }
 
+static VKAPI_ATTR void VKAPI_CALL vkelStubGetPhysicalDeviceProperties(VkPhysicalDevice physicalDevice, VkPhysicalDeviceProperties* pProperties)
+{
+	(void) physicalDevice; (void) pProperties;
+}
 
-void vkelDeleteNames(uint32_t nameCount, char **names)
+static VKAPI_ATTR void VKAPI_CALL vkelStubGetPhysicalDeviceQueueFamilyProperties(VkPhysicalDevice physicalDevice, uint32_t* pQueueFamilyPropertyCount, VkQueueFamilyProperties* pQueueFamilyProperties)
 {
-	// assert(names);
-	if (!names)
-		return;
-	
-	uint32_t nameIndex = 0;
-	for (nameIndex = 0; nameIndex < nameCount; nameIndex++)
-	{
-		// assert(names[nameIndex]);
-		if (!names[nameIndex])
-			continue;
+	(void) physicalDevice; (void) pQueueFamilyPropertyCount; (void) pQueueFamilyProperties;
+}
 
-		free(names[nameIndex]);
-	}
+static VKAPI_ATTR void VKAPI_CALL vkelStubGetPhysicalDeviceMemoryProperties(VkPhysicalDevice physicalDevice, VkPhysicalDeviceMemoryProperties* pMemoryProperties)
+{
+	(void) physicalDevice; (void) pMemoryProperties;
+}
 
-	free(names);
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkelStubGetInstanceProcAddr(VkInstance instance, const char* pName)
+{
+	(void) instance; (void) pName;
+	return (PFN_vkVoidFunction) 0;
 }
 
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkelStubGetDeviceProcAddr(VkDevice device, const char* pName)
+{
+	(void) device; (void) pName;
+	return (PFN_vkVoidFunction) 0;
+}
 
-char** vkelGetInstanceExtensionNames(const char *pLayerName, uint32_t *extensionNameCount)
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubCreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDevice* pDevice)
 {
-	assert(extensionNameCount);
+	(void) physicalDevice; (void) pCreateInfo; (void) pAllocator; (void) pDevice;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
 
+static VKAPI_ATTR void VKAPI_CALL vkelStubDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator)
+{
+	(void) device; (void) pAllocator;
+}
 
-	VkResult err;
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubEnumerateInstanceExtensionProperties(const char* pLayerName, uint32_t* pPropertyCount, VkExtensionProperties* pProperties)
+{
+	(void) pLayerName; (void) pPropertyCount; (void) pProperties;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
 
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubEnumerateDeviceExtensionProperties(VkPhysicalDevice physicalDevice, const char* pLayerName, uint32_t* pPropertyCount, VkExtensionProperties* pProperties)
+{
+	(void) physicalDevice; (void) pLayerName; (void) pPropertyCount; (void) pProperties;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
 
-	uint32_t extPropertyCount;
-	err = vkEnumerateInstanceExtensionProperties(pLayerName, &extPropertyCount, NULL);
-	assert(!err);
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubEnumerateInstanceLayerProperties(uint32_t* pPropertyCount, VkLayerProperties* pProperties)
+{
+	(void) pPropertyCount; (void) pProperties;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
 
-	(*extensionNameCount) = extPropertyCount;
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubEnumerateDeviceLayerProperties(VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkLayerProperties* pProperties)
+{
+	(void) physicalDevice; (void) pPropertyCount; (void) pProperties;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
 
-	if (extPropertyCount < 1)
-		return NULL;
+static VKAPI_ATTR void VKAPI_CALL vkelStubGetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue* pQueue)
+{
+	(void) device; (void) queueFamilyIndex; (void) queueIndex; (void) pQueue;
+}
 
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence)
+{
+	(void) queue; (void) submitCount; (void) pSubmits; (void) fence;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
 
-	char **extensionNames = (char**) calloc(extPropertyCount, sizeof(char*));
-	
-	uint32_t extensionNameIndex = 0;
-	for (extensionNameIndex = 0; extensionNameIndex < extPropertyCount; extensionNameIndex++)
-	{
-		extensionNames[extensionNameIndex] = (char*)calloc(VK_MAX_EXTENSION_NAME_SIZE, sizeof(char));
-	}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubQueueWaitIdle(VkQueue queue)
+{
+	(void) queue;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
 
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubDeviceWaitIdle(VkDevice device)
+{
+	(void) device;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
 
-	VkExtensionProperties *extProperties = (VkExtensionProperties*) calloc(extPropertyCount, sizeof(VkExtensionProperties));
-	assert(extProperties);
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubAllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo, const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory)
+{
+	(void) device; (void) pAllocateInfo; (void) pAllocator; (void) pMemory;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
 
+static VKAPI_ATTR void VKAPI_CALL vkelStubFreeMemory(VkDevice device, VkDeviceMemory memory, const VkAllocationCallbacks* pAllocator)
+{
+	(void) device; (void) memory; (void) pAllocator;
+}
 
-	err = vkEnumerateInstanceExtensionProperties(pLayerName, &extPropertyCount, extProperties);
-	assert(!err);
-	
-	uint32_t extPropertyIndex = 0;
-	for (extPropertyIndex = 0; extPropertyIndex < extPropertyCount; extPropertyIndex++)
-	{
-		VkExtensionProperties extProperty = extProperties[extPropertyIndex];
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubMapMemory(VkDevice device, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size, VkMemoryMapFlags flags, void** ppData)
+{
+	(void) device; (void) memory; (void) offset; (void) size; (void) flags; (void) ppData;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
 
-		vkel_strpy(extensionNames[extPropertyIndex], extProperty.extensionName);
-	}
+static VKAPI_ATTR void VKAPI_CALL vkelStubUnmapMemory(VkDevice device, VkDeviceMemory memory)
+{
+	(void) device; (void) memory;
+}
 
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubFlushMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount, const VkMappedMemoryRange* pMemoryRanges)
+{
+	(void) device; (void) memoryRangeCount; (void) pMemoryRanges;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
 
-	free(extProperties);
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubInvalidateMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount, const VkMappedMemoryRange* pMemoryRanges)
+{
+	(void) device; (void) memoryRangeCount; (void) pMemoryRanges;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
 
+static VKAPI_ATTR void VKAPI_CALL vkelStubGetDeviceMemoryCommitment(VkDevice device, VkDeviceMemory memory, VkDeviceSize* pCommittedMemoryInBytes)
+{
+	(void) device; (void) memory; (void) pCommittedMemoryInBytes;
+}
 
-	return extensionNames;
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubBindBufferMemory(VkDevice device, VkBuffer buffer, VkDeviceMemory memory, VkDeviceSize memoryOffset)
+{
+	(void) device; (void) buffer; (void) memory; (void) memoryOffset;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
 }
 
-char** vkelGetInstanceLayerNames(uint32_t *layerNameCount)
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubBindImageMemory(VkDevice device, VkImage image, VkDeviceMemory memory, VkDeviceSize memoryOffset)
 {
-	assert(layerNameCount);
+	(void) device; (void) image; (void) memory; (void) memoryOffset;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
 
+static VKAPI_ATTR void VKAPI_CALL vkelStubGetBufferMemoryRequirements(VkDevice device, VkBuffer buffer, VkMemoryRequirements* pMemoryRequirements)
+{
+	(void) device; (void) buffer; (void) pMemoryRequirements;
+}
 
-	VkResult err;
+static VKAPI_ATTR void VKAPI_CALL vkelStubGetImageMemoryRequirements(VkDevice device, VkImage image, VkMemoryRequirements* pMemoryRequirements)
+{
+	(void) device; (void) image; (void) pMemoryRequirements;
+}
 
+static VKAPI_ATTR void VKAPI_CALL vkelStubGetImageSparseMemoryRequirements(VkDevice device, VkImage image, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements* pSparseMemoryRequirements)
+{
+	(void) device; (void) image; (void) pSparseMemoryRequirementCount; (void) pSparseMemoryRequirements;
+}
 
-	uint32_t layerPropertyCount;
-	err = vkEnumerateInstanceLayerProperties(&layerPropertyCount, NULL);
-	assert(!err);
+static VKAPI_ATTR void VKAPI_CALL vkelStubGetPhysicalDeviceSparseImageFormatProperties(VkPhysicalDevice physicalDevice, VkFormat format, VkImageType type, VkSampleCountFlagBits samples, VkImageUsageFlags usage, VkImageTiling tiling, uint32_t* pPropertyCount, VkSparseImageFormatProperties* pProperties)
+{
+	(void) physicalDevice; (void) format; (void) type; (void) samples; (void) usage; (void) tiling; (void) pPropertyCount; (void) pProperties;
+}
 
-	(*layerNameCount) = layerPropertyCount;
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubQueueBindSparse(VkQueue queue, uint32_t bindInfoCount, const VkBindSparseInfo* pBindInfo, VkFence fence)
+{
+	(void) queue; (void) bindInfoCount; (void) pBindInfo; (void) fence;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
 
-	if (layerPropertyCount < 1)
-		return NULL;
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubCreateFence(VkDevice device, const VkFenceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkFence* pFence)
+{
+	(void) device; (void) pCreateInfo; (void) pAllocator; (void) pFence;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
 
+static VKAPI_ATTR void VKAPI_CALL vkelStubDestroyFence(VkDevice device, VkFence fence, const VkAllocationCallbacks* pAllocator)
+{
+	(void) device; (void) fence; (void) pAllocator;
+}
 
-	char **layerNames = (char**) calloc(layerPropertyCount, sizeof(char*));
-	
-	uint32_t layerNameIndex = 0;
-	for (layerNameIndex = 0; layerNameIndex < layerPropertyCount; layerNameIndex++)
-	{
-		layerNames[layerNameIndex] = (char*) calloc(VK_MAX_EXTENSION_NAME_SIZE, sizeof(char));
-	}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubResetFences(VkDevice device, uint32_t fenceCount, const VkFence* pFences)
+{
+	(void) device; (void) fenceCount; (void) pFences;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
 
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubGetFenceStatus(VkDevice device, VkFence fence)
+{
+	(void) device; (void) fence;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
 
-	VkLayerProperties *layerProperties = (VkLayerProperties*) calloc(layerPropertyCount, sizeof(VkLayerProperties));
-	assert(layerProperties);
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence* pFences, VkBool32 waitAll, uint64_t timeout)
+{
+	(void) device; (void) fenceCount; (void) pFences; (void) waitAll; (void) timeout;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
 
-	err = vkEnumerateInstanceLayerProperties(&layerPropertyCount, layerProperties);
-	assert(!err);
-	
-	uint32_t layerPropertyIndex = 0;
-	for (layerPropertyIndex = 0; layerPropertyIndex < layerPropertyCount; layerPropertyIndex++)
-	{
-		VkLayerProperties layerProperty = layerProperties[layerPropertyIndex];
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubCreateSemaphore(VkDevice device, const VkSemaphoreCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSemaphore* pSemaphore)
+{
+	(void) device; (void) pCreateInfo; (void) pAllocator; (void) pSemaphore;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
 
-		vkel_strpy(layerNames[layerPropertyIndex], layerProperty.layerName);
-	}
+static VKAPI_ATTR void VKAPI_CALL vkelStubDestroySemaphore(VkDevice device, VkSemaphore semaphore, const VkAllocationCallbacks* pAllocator)
+{
+	(void) device; (void) semaphore; (void) pAllocator;
+}
 
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubCreateEvent(VkDevice device, const VkEventCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkEvent* pEvent)
+{
+	(void) device; (void) pCreateInfo; (void) pAllocator; (void) pEvent;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
 
-	free(layerProperties);
+static VKAPI_ATTR void VKAPI_CALL vkelStubDestroyEvent(VkDevice device, VkEvent event, const VkAllocationCallbacks* pAllocator)
+{
+	(void) device; (void) event; (void) pAllocator;
+}
 
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubGetEventStatus(VkDevice device, VkEvent event)
+{
+	(void) device; (void) event;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
 
-	return layerNames;
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubSetEvent(VkDevice device, VkEvent event)
+{
+	(void) device; (void) event;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
 }
 
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubResetEvent(VkDevice device, VkEvent event)
+{
+	(void) device; (void) event;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
 
-char** vkelGetDeviceExtensionNames(VkPhysicalDevice physicalDevice, const char *pLayerName, uint32_t *extensionNameCount)
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubCreateQueryPool(VkDevice device, const VkQueryPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkQueryPool* pQueryPool)
 {
-	assert(extensionNameCount);
+	(void) device; (void) pCreateInfo; (void) pAllocator; (void) pQueryPool;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
 
+static VKAPI_ATTR void VKAPI_CALL vkelStubDestroyQueryPool(VkDevice device, VkQueryPool queryPool, const VkAllocationCallbacks* pAllocator)
+{
+	(void) device; (void) queryPool; (void) pAllocator;
+}
 
-	VkResult err;
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubGetQueryPoolResults(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, size_t dataSize, void* pData, VkDeviceSize stride, VkQueryResultFlags flags)
+{
+	(void) device; (void) queryPool; (void) firstQuery; (void) queryCount; (void) dataSize; (void) pData; (void) stride; (void) flags;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
 
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubCreateBuffer(VkDevice device, const VkBufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBuffer* pBuffer)
+{
+	(void) device; (void) pCreateInfo; (void) pAllocator; (void) pBuffer;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
 
-	uint32_t extPropertyCount;
-	err = vkEnumerateDeviceExtensionProperties(physicalDevice, pLayerName, &extPropertyCount, NULL);
-	assert(!err);
+static VKAPI_ATTR void VKAPI_CALL vkelStubDestroyBuffer(VkDevice device, VkBuffer buffer, const VkAllocationCallbacks* pAllocator)
+{
+	(void) device; (void) buffer; (void) pAllocator;
+}
 
-	(*extensionNameCount) = extPropertyCount;
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubCreateBufferView(VkDevice device, const VkBufferViewCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBufferView* pView)
+{
+	(void) device; (void) pCreateInfo; (void) pAllocator; (void) pView;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
 
-	if (extPropertyCount < 1)
-		return NULL;
+static VKAPI_ATTR void VKAPI_CALL vkelStubDestroyBufferView(VkDevice device, VkBufferView bufferView, const VkAllocationCallbacks* pAllocator)
+{
+	(void) device; (void) bufferView; (void) pAllocator;
+}
 
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubCreateImage(VkDevice device, const VkImageCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkImage* pImage)
+{
+	(void) device; (void) pCreateInfo; (void) pAllocator; (void) pImage;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
 
-	char **extensionNames = (char**) calloc(extPropertyCount, sizeof(char*));
-	
-	uint32_t extensionNameIndex = 0;
-	for (extensionNameIndex = 0; extensionNameIndex < extPropertyCount; extensionNameIndex++)
-	{
-		extensionNames[extensionNameIndex] = (char*) calloc(VK_MAX_EXTENSION_NAME_SIZE, sizeof(char));
-	}
+static VKAPI_ATTR void VKAPI_CALL vkelStubDestroyImage(VkDevice device, VkImage image, const VkAllocationCallbacks* pAllocator)
+{
+	(void) device; (void) image; (void) pAllocator;
+}
 
+static VKAPI_ATTR void VKAPI_CALL vkelStubGetImageSubresourceLayout(VkDevice device, VkImage image, const VkImageSubresource* pSubresource, VkSubresourceLayout* pLayout)
+{
+	(void) device; (void) image; (void) pSubresource; (void) pLayout;
+}
 
-	VkExtensionProperties *extProperties = (VkExtensionProperties*) calloc(extPropertyCount, sizeof(VkExtensionProperties));
-	assert(extProperties);
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubCreateImageView(VkDevice device, const VkImageViewCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkImageView* pView)
+{
+	(void) device; (void) pCreateInfo; (void) pAllocator; (void) pView;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
 
+static VKAPI_ATTR void VKAPI_CALL vkelStubDestroyImageView(VkDevice device, VkImageView imageView, const VkAllocationCallbacks* pAllocator)
+{
+	(void) device; (void) imageView; (void) pAllocator;
+}
 
-	err = vkEnumerateDeviceExtensionProperties(physicalDevice, pLayerName, &extPropertyCount, extProperties);
-	assert(!err);
-	
-	uint32_t extPropertyIndex = 0;
-	for (extPropertyIndex = 0; extPropertyIndex < extPropertyCount; extPropertyIndex++)
-	{
-		VkExtensionProperties extProperty = extProperties[extPropertyIndex];
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule)
+{
+	(void) device; (void) pCreateInfo; (void) pAllocator; (void) pShaderModule;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
 
-		vkel_strpy(extensionNames[extPropertyIndex], extProperty.extensionName);
-	}
+static VKAPI_ATTR void VKAPI_CALL vkelStubDestroyShaderModule(VkDevice device, VkShaderModule shaderModule, const VkAllocationCallbacks* pAllocator)
+{
+	(void) device; (void) shaderModule; (void) pAllocator;
+}
 
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubCreatePipelineCache(VkDevice device, const VkPipelineCacheCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineCache* pPipelineCache)
+{
+	(void) device; (void) pCreateInfo; (void) pAllocator; (void) pPipelineCache;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
 
-	free(extProperties);
+static VKAPI_ATTR void VKAPI_CALL vkelStubDestroyPipelineCache(VkDevice device, VkPipelineCache pipelineCache, const VkAllocationCallbacks* pAllocator)
+{
+	(void) device; (void) pipelineCache; (void) pAllocator;
+}
 
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubGetPipelineCacheData(VkDevice device, VkPipelineCache pipelineCache, size_t* pDataSize, void* pData)
+{
+	(void) device; (void) pipelineCache; (void) pDataSize; (void) pData;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
 
-	return extensionNames;
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubMergePipelineCaches(VkDevice device, VkPipelineCache dstCache, uint32_t srcCacheCount, const VkPipelineCache* pSrcCaches)
+{
+	(void) device; (void) dstCache; (void) srcCacheCount; (void) pSrcCaches;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
 }
 
-char** vkelGetDeviceLayerNames(VkPhysicalDevice physicalDevice, uint32_t *layerNameCount)
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkGraphicsPipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines)
 {
-	assert(layerNameCount);
+	(void) device; (void) pipelineCache; (void) createInfoCount; (void) pCreateInfos; (void) pAllocator; (void) pPipelines;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
 
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubCreateComputePipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkComputePipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines)
+{
+	(void) device; (void) pipelineCache; (void) createInfoCount; (void) pCreateInfos; (void) pAllocator; (void) pPipelines;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
 
-	VkResult err;
+static VKAPI_ATTR void VKAPI_CALL vkelStubDestroyPipeline(VkDevice device, VkPipeline pipeline, const VkAllocationCallbacks* pAllocator)
+{
+	(void) device; (void) pipeline; (void) pAllocator;
+}
 
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubCreatePipelineLayout(VkDevice device, const VkPipelineLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineLayout* pPipelineLayout)
+{
+	(void) device; (void) pCreateInfo; (void) pAllocator; (void) pPipelineLayout;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
 
-	uint32_t layerPropertyCount;
-	err = vkEnumerateDeviceLayerProperties(physicalDevice, &layerPropertyCount, NULL);
-	assert(!err);
+static VKAPI_ATTR void VKAPI_CALL vkelStubDestroyPipelineLayout(VkDevice device, VkPipelineLayout pipelineLayout, const VkAllocationCallbacks* pAllocator)
+{
+	(void) device; (void) pipelineLayout; (void) pAllocator;
+}
 
-	(*layerNameCount) = layerPropertyCount;
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubCreateSampler(VkDevice device, const VkSamplerCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSampler* pSampler)
+{
+	(void) device; (void) pCreateInfo; (void) pAllocator; (void) pSampler;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
 
-	if (layerPropertyCount < 1)
-		return NULL;
+static VKAPI_ATTR void VKAPI_CALL vkelStubDestroySampler(VkDevice device, VkSampler sampler, const VkAllocationCallbacks* pAllocator)
+{
+	(void) device; (void) sampler; (void) pAllocator;
+}
 
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubCreateDescriptorSetLayout(VkDevice device, const VkDescriptorSetLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorSetLayout* pSetLayout)
+{
+	(void) device; (void) pCreateInfo; (void) pAllocator; (void) pSetLayout;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
 
-	char **layerNames = (char**) calloc(layerPropertyCount, sizeof(char*));
-	
-	uint32_t layerNameIndex = 0;
-	for (layerNameIndex = 0; layerNameIndex < layerPropertyCount; layerNameIndex++)
-	{
-		layerNames[layerNameIndex] = (char*) calloc(VK_MAX_EXTENSION_NAME_SIZE, sizeof(char));
-	}
+static VKAPI_ATTR void VKAPI_CALL vkelStubDestroyDescriptorSetLayout(VkDevice device, VkDescriptorSetLayout descriptorSetLayout, const VkAllocationCallbacks* pAllocator)
+{
+	(void) device; (void) descriptorSetLayout; (void) pAllocator;
+}
 
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubCreateDescriptorPool(VkDevice device, const VkDescriptorPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorPool* pDescriptorPool)
+{
+	(void) device; (void) pCreateInfo; (void) pAllocator; (void) pDescriptorPool;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
 
-	VkLayerProperties *layerProperties = (VkLayerProperties*) calloc(layerPropertyCount, sizeof(VkLayerProperties));
-	assert(layerProperties);
+static VKAPI_ATTR void VKAPI_CALL vkelStubDestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool, const VkAllocationCallbacks* pAllocator)
+{
+	(void) device; (void) descriptorPool; (void) pAllocator;
+}
 
-	err = vkEnumerateDeviceLayerProperties(physicalDevice, &layerPropertyCount, layerProperties);
-	assert(!err);
-	
-	uint32_t layerPropertyIndex = 0;
-	for (layerPropertyIndex = 0; layerPropertyIndex < layerPropertyCount; layerPropertyIndex++)
-	{
-		VkLayerProperties layerProperty = layerProperties[layerPropertyIndex];
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubResetDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool, VkDescriptorPoolResetFlags flags)
+{
+	(void) device; (void) descriptorPool; (void) flags;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
 
-		vkel_strpy(layerNames[layerPropertyIndex], layerProperty.layerName);
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubAllocateDescriptorSets(VkDevice device, const VkDescriptorSetAllocateInfo* pAllocateInfo, VkDescriptorSet* pDescriptorSets)
+{
+	(void) device; (void) pAllocateInfo; (void) pDescriptorSets;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubFreeDescriptorSets(VkDevice device, VkDescriptorPool descriptorPool, uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets)
+{
+	(void) device; (void) descriptorPool; (void) descriptorSetCount; (void) pDescriptorSets;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubUpdateDescriptorSets(VkDevice device, uint32_t descriptorWriteCount, const VkWriteDescriptorSet* pDescriptorWrites, uint32_t descriptorCopyCount, const VkCopyDescriptorSet* pDescriptorCopies)
+{
+	(void) device; (void) descriptorWriteCount; (void) pDescriptorWrites; (void) descriptorCopyCount; (void) pDescriptorCopies;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubCreateFramebuffer(VkDevice device, const VkFramebufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkFramebuffer* pFramebuffer)
+{
+	(void) device; (void) pCreateInfo; (void) pAllocator; (void) pFramebuffer;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubDestroyFramebuffer(VkDevice device, VkFramebuffer framebuffer, const VkAllocationCallbacks* pAllocator)
+{
+	(void) device; (void) framebuffer; (void) pAllocator;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubCreateRenderPass(VkDevice device, const VkRenderPassCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass)
+{
+	(void) device; (void) pCreateInfo; (void) pAllocator; (void) pRenderPass;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubDestroyRenderPass(VkDevice device, VkRenderPass renderPass, const VkAllocationCallbacks* pAllocator)
+{
+	(void) device; (void) renderPass; (void) pAllocator;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubGetRenderAreaGranularity(VkDevice device, VkRenderPass renderPass, VkExtent2D* pGranularity)
+{
+	(void) device; (void) renderPass; (void) pGranularity;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubCreateCommandPool(VkDevice device, const VkCommandPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkCommandPool* pCommandPool)
+{
+	(void) device; (void) pCreateInfo; (void) pAllocator; (void) pCommandPool;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubDestroyCommandPool(VkDevice device, VkCommandPool commandPool, const VkAllocationCallbacks* pAllocator)
+{
+	(void) device; (void) commandPool; (void) pAllocator;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubResetCommandPool(VkDevice device, VkCommandPool commandPool, VkCommandPoolResetFlags flags)
+{
+	(void) device; (void) commandPool; (void) flags;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubAllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo* pAllocateInfo, VkCommandBuffer* pCommandBuffers)
+{
+	(void) device; (void) pAllocateInfo; (void) pCommandBuffers;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubFreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount, const VkCommandBuffer* pCommandBuffers)
+{
+	(void) device; (void) commandPool; (void) commandBufferCount; (void) pCommandBuffers;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubBeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo* pBeginInfo)
+{
+	(void) commandBuffer; (void) pBeginInfo;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubEndCommandBuffer(VkCommandBuffer commandBuffer)
+{
+	(void) commandBuffer;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags)
+{
+	(void) commandBuffer; (void) flags;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline)
+{
+	(void) commandBuffer; (void) pipelineBindPoint; (void) pipeline;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdSetViewport(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkViewport* pViewports)
+{
+	(void) commandBuffer; (void) firstViewport; (void) viewportCount; (void) pViewports;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdSetScissor(VkCommandBuffer commandBuffer, uint32_t firstScissor, uint32_t scissorCount, const VkRect2D* pScissors)
+{
+	(void) commandBuffer; (void) firstScissor; (void) scissorCount; (void) pScissors;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdSetLineWidth(VkCommandBuffer commandBuffer, float lineWidth)
+{
+	(void) commandBuffer; (void) lineWidth;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdSetDepthBias(VkCommandBuffer commandBuffer, float depthBiasConstantFactor, float depthBiasClamp, float depthBiasSlopeFactor)
+{
+	(void) commandBuffer; (void) depthBiasConstantFactor; (void) depthBiasClamp; (void) depthBiasSlopeFactor;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdSetBlendConstants(VkCommandBuffer commandBuffer, const float blendConstants[4])
+{
+	(void) commandBuffer; (void) blendConstants;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdSetDepthBounds(VkCommandBuffer commandBuffer, float minDepthBounds, float maxDepthBounds)
+{
+	(void) commandBuffer; (void) minDepthBounds; (void) maxDepthBounds;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdSetStencilCompareMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t compareMask)
+{
+	(void) commandBuffer; (void) faceMask; (void) compareMask;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdSetStencilWriteMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t writeMask)
+{
+	(void) commandBuffer; (void) faceMask; (void) writeMask;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdSetStencilReference(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t reference)
+{
+	(void) commandBuffer; (void) faceMask; (void) reference;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdBindDescriptorSets(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t firstSet, uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets, uint32_t dynamicOffsetCount, const uint32_t* pDynamicOffsets)
+{
+	(void) commandBuffer; (void) pipelineBindPoint; (void) layout; (void) firstSet; (void) descriptorSetCount; (void) pDescriptorSets; (void) dynamicOffsetCount; (void) pDynamicOffsets;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkIndexType indexType)
+{
+	(void) commandBuffer; (void) buffer; (void) offset; (void) indexType;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdBindVertexBuffers(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, const VkBuffer* pBuffers, const VkDeviceSize* pOffsets)
+{
+	(void) commandBuffer; (void) firstBinding; (void) bindingCount; (void) pBuffers; (void) pOffsets;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance)
+{
+	(void) commandBuffer; (void) vertexCount; (void) instanceCount; (void) firstVertex; (void) firstInstance;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance)
+{
+	(void) commandBuffer; (void) indexCount; (void) instanceCount; (void) firstIndex; (void) vertexOffset; (void) firstInstance;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride)
+{
+	(void) commandBuffer; (void) buffer; (void) offset; (void) drawCount; (void) stride;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdDrawIndexedIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride)
+{
+	(void) commandBuffer; (void) buffer; (void) offset; (void) drawCount; (void) stride;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdDispatch(VkCommandBuffer commandBuffer, uint32_t x, uint32_t y, uint32_t z)
+{
+	(void) commandBuffer; (void) x; (void) y; (void) z;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset)
+{
+	(void) commandBuffer; (void) buffer; (void) offset;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, uint32_t regionCount, const VkBufferCopy* pRegions)
+{
+	(void) commandBuffer; (void) srcBuffer; (void) dstBuffer; (void) regionCount; (void) pRegions;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdCopyImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageCopy* pRegions)
+{
+	(void) commandBuffer; (void) srcImage; (void) srcImageLayout; (void) dstImage; (void) dstImageLayout; (void) regionCount; (void) pRegions;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdBlitImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageBlit* pRegions, VkFilter filter)
+{
+	(void) commandBuffer; (void) srcImage; (void) srcImageLayout; (void) dstImage; (void) dstImageLayout; (void) regionCount; (void) pRegions; (void) filter;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdCopyBufferToImage(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkBufferImageCopy* pRegions)
+{
+	(void) commandBuffer; (void) srcBuffer; (void) dstImage; (void) dstImageLayout; (void) regionCount; (void) pRegions;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdCopyImageToBuffer(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkBuffer dstBuffer, uint32_t regionCount, const VkBufferImageCopy* pRegions)
+{
+	(void) commandBuffer; (void) srcImage; (void) srcImageLayout; (void) dstBuffer; (void) regionCount; (void) pRegions;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize dataSize, const void* pData)
+{
+	(void) commandBuffer; (void) dstBuffer; (void) dstOffset; (void) dataSize; (void) pData;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize size, uint32_t data)
+{
+	(void) commandBuffer; (void) dstBuffer; (void) dstOffset; (void) size; (void) data;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdClearColorImage(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const VkClearColorValue* pColor, uint32_t rangeCount, const VkImageSubresourceRange* pRanges)
+{
+	(void) commandBuffer; (void) image; (void) imageLayout; (void) pColor; (void) rangeCount; (void) pRanges;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdClearDepthStencilImage(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const VkClearDepthStencilValue* pDepthStencil, uint32_t rangeCount, const VkImageSubresourceRange* pRanges)
+{
+	(void) commandBuffer; (void) image; (void) imageLayout; (void) pDepthStencil; (void) rangeCount; (void) pRanges;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdClearAttachments(VkCommandBuffer commandBuffer, uint32_t attachmentCount, const VkClearAttachment* pAttachments, uint32_t rectCount, const VkClearRect* pRects)
+{
+	(void) commandBuffer; (void) attachmentCount; (void) pAttachments; (void) rectCount; (void) pRects;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdResolveImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageResolve* pRegions)
+{
+	(void) commandBuffer; (void) srcImage; (void) srcImageLayout; (void) dstImage; (void) dstImageLayout; (void) regionCount; (void) pRegions;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdSetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask)
+{
+	(void) commandBuffer; (void) event; (void) stageMask;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdResetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask)
+{
+	(void) commandBuffer; (void) event; (void) stageMask;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers, uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers)
+{
+	(void) commandBuffer; (void) eventCount; (void) pEvents; (void) srcStageMask; (void) dstStageMask; (void) memoryBarrierCount; (void) pMemoryBarriers; (void) bufferMemoryBarrierCount; (void) pBufferMemoryBarriers; (void) imageMemoryBarrierCount; (void) pImageMemoryBarriers;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdPipelineBarrier(VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, VkDependencyFlags dependencyFlags, uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers, uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers)
+{
+	(void) commandBuffer; (void) srcStageMask; (void) dstStageMask; (void) dependencyFlags; (void) memoryBarrierCount; (void) pMemoryBarriers; (void) bufferMemoryBarrierCount; (void) pBufferMemoryBarriers; (void) imageMemoryBarrierCount; (void) pImageMemoryBarriers;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query, VkQueryControlFlags flags)
+{
+	(void) commandBuffer; (void) queryPool; (void) query; (void) flags;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query)
+{
+	(void) commandBuffer; (void) queryPool; (void) query;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdResetQueryPool(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount)
+{
+	(void) commandBuffer; (void) queryPool; (void) firstQuery; (void) queryCount;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdWriteTimestamp(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage, VkQueryPool queryPool, uint32_t query)
+{
+	(void) commandBuffer; (void) pipelineStage; (void) queryPool; (void) query;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdCopyQueryPoolResults(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize stride, VkQueryResultFlags flags)
+{
+	(void) commandBuffer; (void) queryPool; (void) firstQuery; (void) queryCount; (void) dstBuffer; (void) dstOffset; (void) stride; (void) flags;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout layout, VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size, const void* pValues)
+{
+	(void) commandBuffer; (void) layout; (void) stageFlags; (void) offset; (void) size; (void) pValues;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin, VkSubpassContents contents)
+{
+	(void) commandBuffer; (void) pRenderPassBegin; (void) contents;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpassContents contents)
+{
+	(void) commandBuffer; (void) contents;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdEndRenderPass(VkCommandBuffer commandBuffer)
+{
+	(void) commandBuffer;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount, const VkCommandBuffer* pCommandBuffers)
+{
+	(void) commandBuffer; (void) commandBufferCount; (void) pCommandBuffers;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubDestroySurfaceKHR(VkInstance instance, VkSurfaceKHR surface, const VkAllocationCallbacks* pAllocator)
+{
+	(void) instance; (void) surface; (void) pAllocator;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubGetPhysicalDeviceSurfaceSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, VkSurfaceKHR surface, VkBool32* pSupported)
+{
+	(void) physicalDevice; (void) queueFamilyIndex; (void) surface; (void) pSupported;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubGetPhysicalDeviceSurfaceCapabilitiesKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, VkSurfaceCapabilitiesKHR* pSurfaceCapabilities)
+{
+	(void) physicalDevice; (void) surface; (void) pSurfaceCapabilities;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubGetPhysicalDeviceSurfaceFormatsKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pSurfaceFormatCount, VkSurfaceFormatKHR* pSurfaceFormats)
+{
+	(void) physicalDevice; (void) surface; (void) pSurfaceFormatCount; (void) pSurfaceFormats;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubGetPhysicalDeviceSurfacePresentModesKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pPresentModeCount, VkPresentModeKHR* pPresentModes)
+{
+	(void) physicalDevice; (void) surface; (void) pPresentModeCount; (void) pPresentModes;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubCreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchain)
+{
+	(void) device; (void) pCreateInfo; (void) pAllocator; (void) pSwapchain;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubDestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain, const VkAllocationCallbacks* pAllocator)
+{
+	(void) device; (void) swapchain; (void) pAllocator;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubGetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchain, uint32_t* pSwapchainImageCount, VkImage* pSwapchainImages)
+{
+	(void) device; (void) swapchain; (void) pSwapchainImageCount; (void) pSwapchainImages;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubAcquireNextImageKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout, VkSemaphore semaphore, VkFence fence, uint32_t* pImageIndex)
+{
+	(void) device; (void) swapchain; (void) timeout; (void) semaphore; (void) fence; (void) pImageIndex;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR* pPresentInfo)
+{
+	(void) queue; (void) pPresentInfo;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubGetPhysicalDeviceDisplayPropertiesKHR(VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayPropertiesKHR* pProperties)
+{
+	(void) physicalDevice; (void) pPropertyCount; (void) pProperties;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubGetPhysicalDeviceDisplayPlanePropertiesKHR(VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayPlanePropertiesKHR* pProperties)
+{
+	(void) physicalDevice; (void) pPropertyCount; (void) pProperties;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubGetDisplayPlaneSupportedDisplaysKHR(VkPhysicalDevice physicalDevice, uint32_t planeIndex, uint32_t* pDisplayCount, VkDisplayKHR* pDisplays)
+{
+	(void) physicalDevice; (void) planeIndex; (void) pDisplayCount; (void) pDisplays;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubGetDisplayModePropertiesKHR(VkPhysicalDevice physicalDevice, VkDisplayKHR display, uint32_t* pPropertyCount, VkDisplayModePropertiesKHR* pProperties)
+{
+	(void) physicalDevice; (void) display; (void) pPropertyCount; (void) pProperties;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubCreateDisplayModeKHR(VkPhysicalDevice physicalDevice, VkDisplayKHR display, const VkDisplayModeCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDisplayModeKHR* pMode)
+{
+	(void) physicalDevice; (void) display; (void) pCreateInfo; (void) pAllocator; (void) pMode;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubGetDisplayPlaneCapabilitiesKHR(VkPhysicalDevice physicalDevice, VkDisplayModeKHR mode, uint32_t planeIndex, VkDisplayPlaneCapabilitiesKHR* pCapabilities)
+{
+	(void) physicalDevice; (void) mode; (void) planeIndex; (void) pCapabilities;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubCreateDisplayPlaneSurfaceKHR(VkInstance instance, const VkDisplaySurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+	(void) instance; (void) pCreateInfo; (void) pAllocator; (void) pSurface;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubCreateSharedSwapchainsKHR(VkDevice device, uint32_t swapchainCount, const VkSwapchainCreateInfoKHR* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchains)
+{
+	(void) device; (void) swapchainCount; (void) pCreateInfos; (void) pAllocator; (void) pSwapchains;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
+
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubCreateXlibSurfaceKHR(VkInstance instance, const VkXlibSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+	(void) instance; (void) pCreateInfo; (void) pAllocator; (void) pSurface;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
+#endif /* VK_USE_PLATFORM_XLIB_KHR */
+
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+static VKAPI_ATTR VkBool32 VKAPI_CALL vkelStubGetPhysicalDeviceXlibPresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, Display* dpy, VisualID visualID)
+{
+	(void) physicalDevice; (void) queueFamilyIndex; (void) dpy; (void) visualID;
+	return (VkBool32) 0;
+}
+#endif /* VK_USE_PLATFORM_XLIB_KHR */
+
+#ifdef VK_USE_PLATFORM_XCB_KHR
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubCreateXcbSurfaceKHR(VkInstance instance, const VkXcbSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+	(void) instance; (void) pCreateInfo; (void) pAllocator; (void) pSurface;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
+#endif /* VK_USE_PLATFORM_XCB_KHR */
+
+#ifdef VK_USE_PLATFORM_XCB_KHR
+static VKAPI_ATTR VkBool32 VKAPI_CALL vkelStubGetPhysicalDeviceXcbPresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, xcb_connection_t* connection, xcb_visualid_t visual_id)
+{
+	(void) physicalDevice; (void) queueFamilyIndex; (void) connection; (void) visual_id;
+	return (VkBool32) 0;
+}
+#endif /* VK_USE_PLATFORM_XCB_KHR */
+
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubCreateWaylandSurfaceKHR(VkInstance instance, const VkWaylandSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+	(void) instance; (void) pCreateInfo; (void) pAllocator; (void) pSurface;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
+#endif /* VK_USE_PLATFORM_WAYLAND_KHR */
+
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+static VKAPI_ATTR VkBool32 VKAPI_CALL vkelStubGetPhysicalDeviceWaylandPresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, struct wl_display* display)
+{
+	(void) physicalDevice; (void) queueFamilyIndex; (void) display;
+	return (VkBool32) 0;
+}
+#endif /* VK_USE_PLATFORM_WAYLAND_KHR */
+
+#ifdef VK_USE_PLATFORM_MIR_KHR
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubCreateMirSurfaceKHR(VkInstance instance, const VkMirSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+	(void) instance; (void) pCreateInfo; (void) pAllocator; (void) pSurface;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
+#endif /* VK_USE_PLATFORM_MIR_KHR */
+
+#ifdef VK_USE_PLATFORM_MIR_KHR
+static VKAPI_ATTR VkBool32 VKAPI_CALL vkelStubGetPhysicalDeviceMirPresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, MirConnection* connection)
+{
+	(void) physicalDevice; (void) queueFamilyIndex; (void) connection;
+	return (VkBool32) 0;
+}
+#endif /* VK_USE_PLATFORM_MIR_KHR */
+
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubCreateAndroidSurfaceKHR(VkInstance instance, const VkAndroidSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+	(void) instance; (void) pCreateInfo; (void) pAllocator; (void) pSurface;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
+#endif /* VK_USE_PLATFORM_ANDROID_KHR */
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubCreateWin32SurfaceKHR(VkInstance instance, const VkWin32SurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+	(void) instance; (void) pCreateInfo; (void) pAllocator; (void) pSurface;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
+#endif /* VK_USE_PLATFORM_WIN32_KHR */
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+static VKAPI_ATTR VkBool32 VKAPI_CALL vkelStubGetPhysicalDeviceWin32PresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex)
+{
+	(void) physicalDevice; (void) queueFamilyIndex;
+	return (VkBool32) 0;
+}
+#endif /* VK_USE_PLATFORM_WIN32_KHR */
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubCreateDebugReportCallbackEXT(VkInstance instance, const VkDebugReportCallbackCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDebugReportCallbackEXT* pCallback)
+{
+	(void) instance; (void) pCreateInfo; (void) pAllocator; (void) pCallback;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubDestroyDebugReportCallbackEXT(VkInstance instance, VkDebugReportCallbackEXT callback, const VkAllocationCallbacks* pAllocator)
+{
+	(void) instance; (void) callback; (void) pAllocator;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubDebugReportMessageEXT(VkInstance instance, VkDebugReportFlagsEXT flags, VkDebugReportObjectTypeEXT objectType, uint64_t object, size_t location, int32_t messageCode, const char* pLayerPrefix, const char* pMessage)
+{
+	(void) instance; (void) flags; (void) objectType; (void) object; (void) location; (void) messageCode; (void) pLayerPrefix; (void) pMessage;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubDebugMarkerSetObjectTagEXT(VkDevice device, VkDebugMarkerObjectTagInfoEXT* pTagInfo)
+{
+	(void) device; (void) pTagInfo;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelStubDebugMarkerSetObjectNameEXT(VkDevice device, VkDebugMarkerObjectNameInfoEXT* pNameInfo)
+{
+	(void) device; (void) pNameInfo;
+	return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdDebugMarkerBeginEXT(VkCommandBuffer commandBuffer, VkDebugMarkerMarkerInfoEXT* pMarkerInfo)
+{
+	(void) commandBuffer; (void) pMarkerInfo;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdDebugMarkerEndEXT(VkCommandBuffer commandBuffer)
+{
+	(void) commandBuffer;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelStubCmdDebugMarkerInsertEXT(VkCommandBuffer commandBuffer, VkDebugMarkerMarkerInfoEXT* pMarkerInfo)
+{
+	(void) commandBuffer; (void) pMarkerInfo;
+}
+
+
+// Sorted by offset
+static const VkelStub vkelStubs[] = {
+	{ offsetof(VkelTable, CreateInstance), (PFN_vkVoidFunction) vkelStubCreateInstance },
+	{ offsetof(VkelTable, DestroyInstance), (PFN_vkVoidFunction) vkelStubDestroyInstance },
+	{ offsetof(VkelTable, EnumeratePhysicalDevices), (PFN_vkVoidFunction) vkelStubEnumeratePhysicalDevices },
+	{ offsetof(VkelTable, GetPhysicalDeviceFeatures), (PFN_vkVoidFunction) vkelStubGetPhysicalDeviceFeatures },
+	{ offsetof(VkelTable, GetPhysicalDeviceFormatProperties), (PFN_vkVoidFunction) vkelStubGetPhysicalDeviceFormatProperties },
+	{ offsetof(VkelTable, GetPhysicalDeviceImageFormatProperties), (PFN_vkVoidFunction) vkelStubGetPhysicalDeviceImageFormatProperties },
+	{ offsetof(VkelTable, GetPhysicalDeviceProperties), (PFN_vkVoidFunction) vkelStubGetPhysicalDeviceProperties },
+	{ offsetof(VkelTable, GetPhysicalDeviceQueueFamilyProperties), (PFN_vkVoidFunction) vkelStubGetPhysicalDeviceQueueFamilyProperties },
+	{ offsetof(VkelTable, GetPhysicalDeviceMemoryProperties), (PFN_vkVoidFunction) vkelStubGetPhysicalDeviceMemoryProperties },
+	{ offsetof(VkelTable, GetInstanceProcAddr), (PFN_vkVoidFunction) vkelStubGetInstanceProcAddr },
+	{ offsetof(VkelTable, GetDeviceProcAddr), (PFN_vkVoidFunction) vkelStubGetDeviceProcAddr },
+	{ offsetof(VkelTable, CreateDevice), (PFN_vkVoidFunction) vkelStubCreateDevice },
+	{ offsetof(VkelTable, DestroyDevice), (PFN_vkVoidFunction) vkelStubDestroyDevice },
+	{ offsetof(VkelTable, EnumerateInstanceExtensionProperties), (PFN_vkVoidFunction) vkelStubEnumerateInstanceExtensionProperties },
+	{ offsetof(VkelTable, EnumerateDeviceExtensionProperties), (PFN_vkVoidFunction) vkelStubEnumerateDeviceExtensionProperties },
+	{ offsetof(VkelTable, EnumerateInstanceLayerProperties), (PFN_vkVoidFunction) vkelStubEnumerateInstanceLayerProperties },
+	{ offsetof(VkelTable, EnumerateDeviceLayerProperties), (PFN_vkVoidFunction) vkelStubEnumerateDeviceLayerProperties },
+	{ offsetof(VkelTable, GetDeviceQueue), (PFN_vkVoidFunction) vkelStubGetDeviceQueue },
+	{ offsetof(VkelTable, QueueSubmit), (PFN_vkVoidFunction) vkelStubQueueSubmit },
+	{ offsetof(VkelTable, QueueWaitIdle), (PFN_vkVoidFunction) vkelStubQueueWaitIdle },
+	{ offsetof(VkelTable, DeviceWaitIdle), (PFN_vkVoidFunction) vkelStubDeviceWaitIdle },
+	{ offsetof(VkelTable, AllocateMemory), (PFN_vkVoidFunction) vkelStubAllocateMemory },
+	{ offsetof(VkelTable, FreeMemory), (PFN_vkVoidFunction) vkelStubFreeMemory },
+	{ offsetof(VkelTable, MapMemory), (PFN_vkVoidFunction) vkelStubMapMemory },
+	{ offsetof(VkelTable, UnmapMemory), (PFN_vkVoidFunction) vkelStubUnmapMemory },
+	{ offsetof(VkelTable, FlushMappedMemoryRanges), (PFN_vkVoidFunction) vkelStubFlushMappedMemoryRanges },
+	{ offsetof(VkelTable, InvalidateMappedMemoryRanges), (PFN_vkVoidFunction) vkelStubInvalidateMappedMemoryRanges },
+	{ offsetof(VkelTable, GetDeviceMemoryCommitment), (PFN_vkVoidFunction) vkelStubGetDeviceMemoryCommitment },
+	{ offsetof(VkelTable, BindBufferMemory), (PFN_vkVoidFunction) vkelStubBindBufferMemory },
+	{ offsetof(VkelTable, BindImageMemory), (PFN_vkVoidFunction) vkelStubBindImageMemory },
+	{ offsetof(VkelTable, GetBufferMemoryRequirements), (PFN_vkVoidFunction) vkelStubGetBufferMemoryRequirements },
+	{ offsetof(VkelTable, GetImageMemoryRequirements), (PFN_vkVoidFunction) vkelStubGetImageMemoryRequirements },
+	{ offsetof(VkelTable, GetImageSparseMemoryRequirements), (PFN_vkVoidFunction) vkelStubGetImageSparseMemoryRequirements },
+	{ offsetof(VkelTable, GetPhysicalDeviceSparseImageFormatProperties), (PFN_vkVoidFunction) vkelStubGetPhysicalDeviceSparseImageFormatProperties },
+	{ offsetof(VkelTable, QueueBindSparse), (PFN_vkVoidFunction) vkelStubQueueBindSparse },
+	{ offsetof(VkelTable, CreateFence), (PFN_vkVoidFunction) vkelStubCreateFence },
+	{ offsetof(VkelTable, DestroyFence), (PFN_vkVoidFunction) vkelStubDestroyFence },
+	{ offsetof(VkelTable, ResetFences), (PFN_vkVoidFunction) vkelStubResetFences },
+	{ offsetof(VkelTable, GetFenceStatus), (PFN_vkVoidFunction) vkelStubGetFenceStatus },
+	{ offsetof(VkelTable, WaitForFences), (PFN_vkVoidFunction) vkelStubWaitForFences },
+	{ offsetof(VkelTable, CreateSemaphore), (PFN_vkVoidFunction) vkelStubCreateSemaphore },
+	{ offsetof(VkelTable, DestroySemaphore), (PFN_vkVoidFunction) vkelStubDestroySemaphore },
+	{ offsetof(VkelTable, CreateEvent), (PFN_vkVoidFunction) vkelStubCreateEvent },
+	{ offsetof(VkelTable, DestroyEvent), (PFN_vkVoidFunction) vkelStubDestroyEvent },
+	{ offsetof(VkelTable, GetEventStatus), (PFN_vkVoidFunction) vkelStubGetEventStatus },
+	{ offsetof(VkelTable, SetEvent), (PFN_vkVoidFunction) vkelStubSetEvent },
+	{ offsetof(VkelTable, ResetEvent), (PFN_vkVoidFunction) vkelStubResetEvent },
+	{ offsetof(VkelTable, CreateQueryPool), (PFN_vkVoidFunction) vkelStubCreateQueryPool },
+	{ offsetof(VkelTable, DestroyQueryPool), (PFN_vkVoidFunction) vkelStubDestroyQueryPool },
+	{ offsetof(VkelTable, GetQueryPoolResults), (PFN_vkVoidFunction) vkelStubGetQueryPoolResults },
+	{ offsetof(VkelTable, CreateBuffer), (PFN_vkVoidFunction) vkelStubCreateBuffer },
+	{ offsetof(VkelTable, DestroyBuffer), (PFN_vkVoidFunction) vkelStubDestroyBuffer },
+	{ offsetof(VkelTable, CreateBufferView), (PFN_vkVoidFunction) vkelStubCreateBufferView },
+	{ offsetof(VkelTable, DestroyBufferView), (PFN_vkVoidFunction) vkelStubDestroyBufferView },
+	{ offsetof(VkelTable, CreateImage), (PFN_vkVoidFunction) vkelStubCreateImage },
+	{ offsetof(VkelTable, DestroyImage), (PFN_vkVoidFunction) vkelStubDestroyImage },
+	{ offsetof(VkelTable, GetImageSubresourceLayout), (PFN_vkVoidFunction) vkelStubGetImageSubresourceLayout },
+	{ offsetof(VkelTable, CreateImageView), (PFN_vkVoidFunction) vkelStubCreateImageView },
+	{ offsetof(VkelTable, DestroyImageView), (PFN_vkVoidFunction) vkelStubDestroyImageView },
+	{ offsetof(VkelTable, CreateShaderModule), (PFN_vkVoidFunction) vkelStubCreateShaderModule },
+	{ offsetof(VkelTable, DestroyShaderModule), (PFN_vkVoidFunction) vkelStubDestroyShaderModule },
+	{ offsetof(VkelTable, CreatePipelineCache), (PFN_vkVoidFunction) vkelStubCreatePipelineCache },
+	{ offsetof(VkelTable, DestroyPipelineCache), (PFN_vkVoidFunction) vkelStubDestroyPipelineCache },
+	{ offsetof(VkelTable, GetPipelineCacheData), (PFN_vkVoidFunction) vkelStubGetPipelineCacheData },
+	{ offsetof(VkelTable, MergePipelineCaches), (PFN_vkVoidFunction) vkelStubMergePipelineCaches },
+	{ offsetof(VkelTable, CreateGraphicsPipelines), (PFN_vkVoidFunction) vkelStubCreateGraphicsPipelines },
+	{ offsetof(VkelTable, CreateComputePipelines), (PFN_vkVoidFunction) vkelStubCreateComputePipelines },
+	{ offsetof(VkelTable, DestroyPipeline), (PFN_vkVoidFunction) vkelStubDestroyPipeline },
+	{ offsetof(VkelTable, CreatePipelineLayout), (PFN_vkVoidFunction) vkelStubCreatePipelineLayout },
+	{ offsetof(VkelTable, DestroyPipelineLayout), (PFN_vkVoidFunction) vkelStubDestroyPipelineLayout },
+	{ offsetof(VkelTable, CreateSampler), (PFN_vkVoidFunction) vkelStubCreateSampler },
+	{ offsetof(VkelTable, DestroySampler), (PFN_vkVoidFunction) vkelStubDestroySampler },
+	{ offsetof(VkelTable, CreateDescriptorSetLayout), (PFN_vkVoidFunction) vkelStubCreateDescriptorSetLayout },
+	{ offsetof(VkelTable, DestroyDescriptorSetLayout), (PFN_vkVoidFunction) vkelStubDestroyDescriptorSetLayout },
+	{ offsetof(VkelTable, CreateDescriptorPool), (PFN_vkVoidFunction) vkelStubCreateDescriptorPool },
+	{ offsetof(VkelTable, DestroyDescriptorPool), (PFN_vkVoidFunction) vkelStubDestroyDescriptorPool },
+	{ offsetof(VkelTable, ResetDescriptorPool), (PFN_vkVoidFunction) vkelStubResetDescriptorPool },
+	{ offsetof(VkelTable, AllocateDescriptorSets), (PFN_vkVoidFunction) vkelStubAllocateDescriptorSets },
+	{ offsetof(VkelTable, FreeDescriptorSets), (PFN_vkVoidFunction) vkelStubFreeDescriptorSets },
+	{ offsetof(VkelTable, UpdateDescriptorSets), (PFN_vkVoidFunction) vkelStubUpdateDescriptorSets },
+	{ offsetof(VkelTable, CreateFramebuffer), (PFN_vkVoidFunction) vkelStubCreateFramebuffer },
+	{ offsetof(VkelTable, DestroyFramebuffer), (PFN_vkVoidFunction) vkelStubDestroyFramebuffer },
+	{ offsetof(VkelTable, CreateRenderPass), (PFN_vkVoidFunction) vkelStubCreateRenderPass },
+	{ offsetof(VkelTable, DestroyRenderPass), (PFN_vkVoidFunction) vkelStubDestroyRenderPass },
+	{ offsetof(VkelTable, GetRenderAreaGranularity), (PFN_vkVoidFunction) vkelStubGetRenderAreaGranularity },
+	{ offsetof(VkelTable, CreateCommandPool), (PFN_vkVoidFunction) vkelStubCreateCommandPool },
+	{ offsetof(VkelTable, DestroyCommandPool), (PFN_vkVoidFunction) vkelStubDestroyCommandPool },
+	{ offsetof(VkelTable, ResetCommandPool), (PFN_vkVoidFunction) vkelStubResetCommandPool },
+	{ offsetof(VkelTable, AllocateCommandBuffers), (PFN_vkVoidFunction) vkelStubAllocateCommandBuffers },
+	{ offsetof(VkelTable, FreeCommandBuffers), (PFN_vkVoidFunction) vkelStubFreeCommandBuffers },
+	{ offsetof(VkelTable, BeginCommandBuffer), (PFN_vkVoidFunction) vkelStubBeginCommandBuffer },
+	{ offsetof(VkelTable, EndCommandBuffer), (PFN_vkVoidFunction) vkelStubEndCommandBuffer },
+	{ offsetof(VkelTable, ResetCommandBuffer), (PFN_vkVoidFunction) vkelStubResetCommandBuffer },
+	{ offsetof(VkelTable, CmdBindPipeline), (PFN_vkVoidFunction) vkelStubCmdBindPipeline },
+	{ offsetof(VkelTable, CmdSetViewport), (PFN_vkVoidFunction) vkelStubCmdSetViewport },
+	{ offsetof(VkelTable, CmdSetScissor), (PFN_vkVoidFunction) vkelStubCmdSetScissor },
+	{ offsetof(VkelTable, CmdSetLineWidth), (PFN_vkVoidFunction) vkelStubCmdSetLineWidth },
+	{ offsetof(VkelTable, CmdSetDepthBias), (PFN_vkVoidFunction) vkelStubCmdSetDepthBias },
+	{ offsetof(VkelTable, CmdSetBlendConstants), (PFN_vkVoidFunction) vkelStubCmdSetBlendConstants },
+	{ offsetof(VkelTable, CmdSetDepthBounds), (PFN_vkVoidFunction) vkelStubCmdSetDepthBounds },
+	{ offsetof(VkelTable, CmdSetStencilCompareMask), (PFN_vkVoidFunction) vkelStubCmdSetStencilCompareMask },
+	{ offsetof(VkelTable, CmdSetStencilWriteMask), (PFN_vkVoidFunction) vkelStubCmdSetStencilWriteMask },
+	{ offsetof(VkelTable, CmdSetStencilReference), (PFN_vkVoidFunction) vkelStubCmdSetStencilReference },
+	{ offsetof(VkelTable, CmdBindDescriptorSets), (PFN_vkVoidFunction) vkelStubCmdBindDescriptorSets },
+	{ offsetof(VkelTable, CmdBindIndexBuffer), (PFN_vkVoidFunction) vkelStubCmdBindIndexBuffer },
+	{ offsetof(VkelTable, CmdBindVertexBuffers), (PFN_vkVoidFunction) vkelStubCmdBindVertexBuffers },
+	{ offsetof(VkelTable, CmdDraw), (PFN_vkVoidFunction) vkelStubCmdDraw },
+	{ offsetof(VkelTable, CmdDrawIndexed), (PFN_vkVoidFunction) vkelStubCmdDrawIndexed },
+	{ offsetof(VkelTable, CmdDrawIndirect), (PFN_vkVoidFunction) vkelStubCmdDrawIndirect },
+	{ offsetof(VkelTable, CmdDrawIndexedIndirect), (PFN_vkVoidFunction) vkelStubCmdDrawIndexedIndirect },
+	{ offsetof(VkelTable, CmdDispatch), (PFN_vkVoidFunction) vkelStubCmdDispatch },
+	{ offsetof(VkelTable, CmdDispatchIndirect), (PFN_vkVoidFunction) vkelStubCmdDispatchIndirect },
+	{ offsetof(VkelTable, CmdCopyBuffer), (PFN_vkVoidFunction) vkelStubCmdCopyBuffer },
+	{ offsetof(VkelTable, CmdCopyImage), (PFN_vkVoidFunction) vkelStubCmdCopyImage },
+	{ offsetof(VkelTable, CmdBlitImage), (PFN_vkVoidFunction) vkelStubCmdBlitImage },
+	{ offsetof(VkelTable, CmdCopyBufferToImage), (PFN_vkVoidFunction) vkelStubCmdCopyBufferToImage },
+	{ offsetof(VkelTable, CmdCopyImageToBuffer), (PFN_vkVoidFunction) vkelStubCmdCopyImageToBuffer },
+	{ offsetof(VkelTable, CmdUpdateBuffer), (PFN_vkVoidFunction) vkelStubCmdUpdateBuffer },
+	{ offsetof(VkelTable, CmdFillBuffer), (PFN_vkVoidFunction) vkelStubCmdFillBuffer },
+	{ offsetof(VkelTable, CmdClearColorImage), (PFN_vkVoidFunction) vkelStubCmdClearColorImage },
+	{ offsetof(VkelTable, CmdClearDepthStencilImage), (PFN_vkVoidFunction) vkelStubCmdClearDepthStencilImage },
+	{ offsetof(VkelTable, CmdClearAttachments), (PFN_vkVoidFunction) vkelStubCmdClearAttachments },
+	{ offsetof(VkelTable, CmdResolveImage), (PFN_vkVoidFunction) vkelStubCmdResolveImage },
+	{ offsetof(VkelTable, CmdSetEvent), (PFN_vkVoidFunction) vkelStubCmdSetEvent },
+	{ offsetof(VkelTable, CmdResetEvent), (PFN_vkVoidFunction) vkelStubCmdResetEvent },
+	{ offsetof(VkelTable, CmdWaitEvents), (PFN_vkVoidFunction) vkelStubCmdWaitEvents },
+	{ offsetof(VkelTable, CmdPipelineBarrier), (PFN_vkVoidFunction) vkelStubCmdPipelineBarrier },
+	{ offsetof(VkelTable, CmdBeginQuery), (PFN_vkVoidFunction) vkelStubCmdBeginQuery },
+	{ offsetof(VkelTable, CmdEndQuery), (PFN_vkVoidFunction) vkelStubCmdEndQuery },
+	{ offsetof(VkelTable, CmdResetQueryPool), (PFN_vkVoidFunction) vkelStubCmdResetQueryPool },
+	{ offsetof(VkelTable, CmdWriteTimestamp), (PFN_vkVoidFunction) vkelStubCmdWriteTimestamp },
+	{ offsetof(VkelTable, CmdCopyQueryPoolResults), (PFN_vkVoidFunction) vkelStubCmdCopyQueryPoolResults },
+	{ offsetof(VkelTable, CmdPushConstants), (PFN_vkVoidFunction) vkelStubCmdPushConstants },
+	{ offsetof(VkelTable, CmdBeginRenderPass), (PFN_vkVoidFunction) vkelStubCmdBeginRenderPass },
+	{ offsetof(VkelTable, CmdNextSubpass), (PFN_vkVoidFunction) vkelStubCmdNextSubpass },
+	{ offsetof(VkelTable, CmdEndRenderPass), (PFN_vkVoidFunction) vkelStubCmdEndRenderPass },
+	{ offsetof(VkelTable, CmdExecuteCommands), (PFN_vkVoidFunction) vkelStubCmdExecuteCommands },
+	{ offsetof(VkelTable, DestroySurfaceKHR), (PFN_vkVoidFunction) vkelStubDestroySurfaceKHR },
+	{ offsetof(VkelTable, GetPhysicalDeviceSurfaceSupportKHR), (PFN_vkVoidFunction) vkelStubGetPhysicalDeviceSurfaceSupportKHR },
+	{ offsetof(VkelTable, GetPhysicalDeviceSurfaceCapabilitiesKHR), (PFN_vkVoidFunction) vkelStubGetPhysicalDeviceSurfaceCapabilitiesKHR },
+	{ offsetof(VkelTable, GetPhysicalDeviceSurfaceFormatsKHR), (PFN_vkVoidFunction) vkelStubGetPhysicalDeviceSurfaceFormatsKHR },
+	{ offsetof(VkelTable, GetPhysicalDeviceSurfacePresentModesKHR), (PFN_vkVoidFunction) vkelStubGetPhysicalDeviceSurfacePresentModesKHR },
+	{ offsetof(VkelTable, CreateSwapchainKHR), (PFN_vkVoidFunction) vkelStubCreateSwapchainKHR },
+	{ offsetof(VkelTable, DestroySwapchainKHR), (PFN_vkVoidFunction) vkelStubDestroySwapchainKHR },
+	{ offsetof(VkelTable, GetSwapchainImagesKHR), (PFN_vkVoidFunction) vkelStubGetSwapchainImagesKHR },
+	{ offsetof(VkelTable, AcquireNextImageKHR), (PFN_vkVoidFunction) vkelStubAcquireNextImageKHR },
+	{ offsetof(VkelTable, QueuePresentKHR), (PFN_vkVoidFunction) vkelStubQueuePresentKHR },
+	{ offsetof(VkelTable, GetPhysicalDeviceDisplayPropertiesKHR), (PFN_vkVoidFunction) vkelStubGetPhysicalDeviceDisplayPropertiesKHR },
+	{ offsetof(VkelTable, GetPhysicalDeviceDisplayPlanePropertiesKHR), (PFN_vkVoidFunction) vkelStubGetPhysicalDeviceDisplayPlanePropertiesKHR },
+	{ offsetof(VkelTable, GetDisplayPlaneSupportedDisplaysKHR), (PFN_vkVoidFunction) vkelStubGetDisplayPlaneSupportedDisplaysKHR },
+	{ offsetof(VkelTable, GetDisplayModePropertiesKHR), (PFN_vkVoidFunction) vkelStubGetDisplayModePropertiesKHR },
+	{ offsetof(VkelTable, CreateDisplayModeKHR), (PFN_vkVoidFunction) vkelStubCreateDisplayModeKHR },
+	{ offsetof(VkelTable, GetDisplayPlaneCapabilitiesKHR), (PFN_vkVoidFunction) vkelStubGetDisplayPlaneCapabilitiesKHR },
+	{ offsetof(VkelTable, CreateDisplayPlaneSurfaceKHR), (PFN_vkVoidFunction) vkelStubCreateDisplayPlaneSurfaceKHR },
+	{ offsetof(VkelTable, CreateSharedSwapchainsKHR), (PFN_vkVoidFunction) vkelStubCreateSharedSwapchainsKHR },
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+	{ offsetof(VkelTable, CreateXlibSurfaceKHR), (PFN_vkVoidFunction) vkelStubCreateXlibSurfaceKHR },
+#endif /* VK_USE_PLATFORM_XLIB_KHR */
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+	{ offsetof(VkelTable, GetPhysicalDeviceXlibPresentationSupportKHR), (PFN_vkVoidFunction) vkelStubGetPhysicalDeviceXlibPresentationSupportKHR },
+#endif /* VK_USE_PLATFORM_XLIB_KHR */
+#ifdef VK_USE_PLATFORM_XCB_KHR
+	{ offsetof(VkelTable, CreateXcbSurfaceKHR), (PFN_vkVoidFunction) vkelStubCreateXcbSurfaceKHR },
+#endif /* VK_USE_PLATFORM_XCB_KHR */
+#ifdef VK_USE_PLATFORM_XCB_KHR
+	{ offsetof(VkelTable, GetPhysicalDeviceXcbPresentationSupportKHR), (PFN_vkVoidFunction) vkelStubGetPhysicalDeviceXcbPresentationSupportKHR },
+#endif /* VK_USE_PLATFORM_XCB_KHR */
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+	{ offsetof(VkelTable, CreateWaylandSurfaceKHR), (PFN_vkVoidFunction) vkelStubCreateWaylandSurfaceKHR },
+#endif /* VK_USE_PLATFORM_WAYLAND_KHR */
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+	{ offsetof(VkelTable, GetPhysicalDeviceWaylandPresentationSupportKHR), (PFN_vkVoidFunction) vkelStubGetPhysicalDeviceWaylandPresentationSupportKHR },
+#endif /* VK_USE_PLATFORM_WAYLAND_KHR */
+#ifdef VK_USE_PLATFORM_MIR_KHR
+	{ offsetof(VkelTable, CreateMirSurfaceKHR), (PFN_vkVoidFunction) vkelStubCreateMirSurfaceKHR },
+#endif /* VK_USE_PLATFORM_MIR_KHR */
+#ifdef VK_USE_PLATFORM_MIR_KHR
+	{ offsetof(VkelTable, GetPhysicalDeviceMirPresentationSupportKHR), (PFN_vkVoidFunction) vkelStubGetPhysicalDeviceMirPresentationSupportKHR },
+#endif /* VK_USE_PLATFORM_MIR_KHR */
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+	{ offsetof(VkelTable, CreateAndroidSurfaceKHR), (PFN_vkVoidFunction) vkelStubCreateAndroidSurfaceKHR },
+#endif /* VK_USE_PLATFORM_ANDROID_KHR */
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+	{ offsetof(VkelTable, CreateWin32SurfaceKHR), (PFN_vkVoidFunction) vkelStubCreateWin32SurfaceKHR },
+#endif /* VK_USE_PLATFORM_WIN32_KHR */
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+	{ offsetof(VkelTable, GetPhysicalDeviceWin32PresentationSupportKHR), (PFN_vkVoidFunction) vkelStubGetPhysicalDeviceWin32PresentationSupportKHR },
+#endif /* VK_USE_PLATFORM_WIN32_KHR */
+	{ offsetof(VkelTable, CreateDebugReportCallbackEXT), (PFN_vkVoidFunction) vkelStubCreateDebugReportCallbackEXT },
+	{ offsetof(VkelTable, DestroyDebugReportCallbackEXT), (PFN_vkVoidFunction) vkelStubDestroyDebugReportCallbackEXT },
+	{ offsetof(VkelTable, DebugReportMessageEXT), (PFN_vkVoidFunction) vkelStubDebugReportMessageEXT },
+	{ offsetof(VkelTable, DebugMarkerSetObjectTagEXT), (PFN_vkVoidFunction) vkelStubDebugMarkerSetObjectTagEXT },
+	{ offsetof(VkelTable, DebugMarkerSetObjectNameEXT), (PFN_vkVoidFunction) vkelStubDebugMarkerSetObjectNameEXT },
+	{ offsetof(VkelTable, CmdDebugMarkerBeginEXT), (PFN_vkVoidFunction) vkelStubCmdDebugMarkerBeginEXT },
+	{ offsetof(VkelTable, CmdDebugMarkerEndEXT), (PFN_vkVoidFunction) vkelStubCmdDebugMarkerEndEXT },
+	{ offsetof(VkelTable, CmdDebugMarkerInsertEXT), (PFN_vkVoidFunction) vkelStubCmdDebugMarkerInsertEXT },
+};
+
+// Sorted by offset
+static const VkelStub vkelDeviceStubs[] = {
+	{ offsetof(VkelDeviceTable, DestroyDevice), (PFN_vkVoidFunction) vkelStubDestroyDevice },
+	{ offsetof(VkelDeviceTable, GetDeviceQueue), (PFN_vkVoidFunction) vkelStubGetDeviceQueue },
+	{ offsetof(VkelDeviceTable, QueueSubmit), (PFN_vkVoidFunction) vkelStubQueueSubmit },
+	{ offsetof(VkelDeviceTable, QueueWaitIdle), (PFN_vkVoidFunction) vkelStubQueueWaitIdle },
+	{ offsetof(VkelDeviceTable, DeviceWaitIdle), (PFN_vkVoidFunction) vkelStubDeviceWaitIdle },
+	{ offsetof(VkelDeviceTable, AllocateMemory), (PFN_vkVoidFunction) vkelStubAllocateMemory },
+	{ offsetof(VkelDeviceTable, FreeMemory), (PFN_vkVoidFunction) vkelStubFreeMemory },
+	{ offsetof(VkelDeviceTable, MapMemory), (PFN_vkVoidFunction) vkelStubMapMemory },
+	{ offsetof(VkelDeviceTable, UnmapMemory), (PFN_vkVoidFunction) vkelStubUnmapMemory },
+	{ offsetof(VkelDeviceTable, FlushMappedMemoryRanges), (PFN_vkVoidFunction) vkelStubFlushMappedMemoryRanges },
+	{ offsetof(VkelDeviceTable, InvalidateMappedMemoryRanges), (PFN_vkVoidFunction) vkelStubInvalidateMappedMemoryRanges },
+	{ offsetof(VkelDeviceTable, GetDeviceMemoryCommitment), (PFN_vkVoidFunction) vkelStubGetDeviceMemoryCommitment },
+	{ offsetof(VkelDeviceTable, BindBufferMemory), (PFN_vkVoidFunction) vkelStubBindBufferMemory },
+	{ offsetof(VkelDeviceTable, BindImageMemory), (PFN_vkVoidFunction) vkelStubBindImageMemory },
+	{ offsetof(VkelDeviceTable, GetBufferMemoryRequirements), (PFN_vkVoidFunction) vkelStubGetBufferMemoryRequirements },
+	{ offsetof(VkelDeviceTable, GetImageMemoryRequirements), (PFN_vkVoidFunction) vkelStubGetImageMemoryRequirements },
+	{ offsetof(VkelDeviceTable, GetImageSparseMemoryRequirements), (PFN_vkVoidFunction) vkelStubGetImageSparseMemoryRequirements },
+	{ offsetof(VkelDeviceTable, QueueBindSparse), (PFN_vkVoidFunction) vkelStubQueueBindSparse },
+	{ offsetof(VkelDeviceTable, CreateFence), (PFN_vkVoidFunction) vkelStubCreateFence },
+	{ offsetof(VkelDeviceTable, DestroyFence), (PFN_vkVoidFunction) vkelStubDestroyFence },
+	{ offsetof(VkelDeviceTable, ResetFences), (PFN_vkVoidFunction) vkelStubResetFences },
+	{ offsetof(VkelDeviceTable, GetFenceStatus), (PFN_vkVoidFunction) vkelStubGetFenceStatus },
+	{ offsetof(VkelDeviceTable, WaitForFences), (PFN_vkVoidFunction) vkelStubWaitForFences },
+	{ offsetof(VkelDeviceTable, CreateSemaphore), (PFN_vkVoidFunction) vkelStubCreateSemaphore },
+	{ offsetof(VkelDeviceTable, DestroySemaphore), (PFN_vkVoidFunction) vkelStubDestroySemaphore },
+	{ offsetof(VkelDeviceTable, CreateEvent), (PFN_vkVoidFunction) vkelStubCreateEvent },
+	{ offsetof(VkelDeviceTable, DestroyEvent), (PFN_vkVoidFunction) vkelStubDestroyEvent },
+	{ offsetof(VkelDeviceTable, GetEventStatus), (PFN_vkVoidFunction) vkelStubGetEventStatus },
+	{ offsetof(VkelDeviceTable, SetEvent), (PFN_vkVoidFunction) vkelStubSetEvent },
+	{ offsetof(VkelDeviceTable, ResetEvent), (PFN_vkVoidFunction) vkelStubResetEvent },
+	{ offsetof(VkelDeviceTable, CreateQueryPool), (PFN_vkVoidFunction) vkelStubCreateQueryPool },
+	{ offsetof(VkelDeviceTable, DestroyQueryPool), (PFN_vkVoidFunction) vkelStubDestroyQueryPool },
+	{ offsetof(VkelDeviceTable, GetQueryPoolResults), (PFN_vkVoidFunction) vkelStubGetQueryPoolResults },
+	{ offsetof(VkelDeviceTable, CreateBuffer), (PFN_vkVoidFunction) vkelStubCreateBuffer },
+	{ offsetof(VkelDeviceTable, DestroyBuffer), (PFN_vkVoidFunction) vkelStubDestroyBuffer },
+	{ offsetof(VkelDeviceTable, CreateBufferView), (PFN_vkVoidFunction) vkelStubCreateBufferView },
+	{ offsetof(VkelDeviceTable, DestroyBufferView), (PFN_vkVoidFunction) vkelStubDestroyBufferView },
+	{ offsetof(VkelDeviceTable, CreateImage), (PFN_vkVoidFunction) vkelStubCreateImage },
+	{ offsetof(VkelDeviceTable, DestroyImage), (PFN_vkVoidFunction) vkelStubDestroyImage },
+	{ offsetof(VkelDeviceTable, GetImageSubresourceLayout), (PFN_vkVoidFunction) vkelStubGetImageSubresourceLayout },
+	{ offsetof(VkelDeviceTable, CreateImageView), (PFN_vkVoidFunction) vkelStubCreateImageView },
+	{ offsetof(VkelDeviceTable, DestroyImageView), (PFN_vkVoidFunction) vkelStubDestroyImageView },
+	{ offsetof(VkelDeviceTable, CreateShaderModule), (PFN_vkVoidFunction) vkelStubCreateShaderModule },
+	{ offsetof(VkelDeviceTable, DestroyShaderModule), (PFN_vkVoidFunction) vkelStubDestroyShaderModule },
+	{ offsetof(VkelDeviceTable, CreatePipelineCache), (PFN_vkVoidFunction) vkelStubCreatePipelineCache },
+	{ offsetof(VkelDeviceTable, DestroyPipelineCache), (PFN_vkVoidFunction) vkelStubDestroyPipelineCache },
+	{ offsetof(VkelDeviceTable, GetPipelineCacheData), (PFN_vkVoidFunction) vkelStubGetPipelineCacheData },
+	{ offsetof(VkelDeviceTable, MergePipelineCaches), (PFN_vkVoidFunction) vkelStubMergePipelineCaches },
+	{ offsetof(VkelDeviceTable, CreateGraphicsPipelines), (PFN_vkVoidFunction) vkelStubCreateGraphicsPipelines },
+	{ offsetof(VkelDeviceTable, CreateComputePipelines), (PFN_vkVoidFunction) vkelStubCreateComputePipelines },
+	{ offsetof(VkelDeviceTable, DestroyPipeline), (PFN_vkVoidFunction) vkelStubDestroyPipeline },
+	{ offsetof(VkelDeviceTable, CreatePipelineLayout), (PFN_vkVoidFunction) vkelStubCreatePipelineLayout },
+	{ offsetof(VkelDeviceTable, DestroyPipelineLayout), (PFN_vkVoidFunction) vkelStubDestroyPipelineLayout },
+	{ offsetof(VkelDeviceTable, CreateSampler), (PFN_vkVoidFunction) vkelStubCreateSampler },
+	{ offsetof(VkelDeviceTable, DestroySampler), (PFN_vkVoidFunction) vkelStubDestroySampler },
+	{ offsetof(VkelDeviceTable, CreateDescriptorSetLayout), (PFN_vkVoidFunction) vkelStubCreateDescriptorSetLayout },
+	{ offsetof(VkelDeviceTable, DestroyDescriptorSetLayout), (PFN_vkVoidFunction) vkelStubDestroyDescriptorSetLayout },
+	{ offsetof(VkelDeviceTable, CreateDescriptorPool), (PFN_vkVoidFunction) vkelStubCreateDescriptorPool },
+	{ offsetof(VkelDeviceTable, DestroyDescriptorPool), (PFN_vkVoidFunction) vkelStubDestroyDescriptorPool },
+	{ offsetof(VkelDeviceTable, ResetDescriptorPool), (PFN_vkVoidFunction) vkelStubResetDescriptorPool },
+	{ offsetof(VkelDeviceTable, AllocateDescriptorSets), (PFN_vkVoidFunction) vkelStubAllocateDescriptorSets },
+	{ offsetof(VkelDeviceTable, FreeDescriptorSets), (PFN_vkVoidFunction) vkelStubFreeDescriptorSets },
+	{ offsetof(VkelDeviceTable, UpdateDescriptorSets), (PFN_vkVoidFunction) vkelStubUpdateDescriptorSets },
+	{ offsetof(VkelDeviceTable, CreateFramebuffer), (PFN_vkVoidFunction) vkelStubCreateFramebuffer },
+	{ offsetof(VkelDeviceTable, DestroyFramebuffer), (PFN_vkVoidFunction) vkelStubDestroyFramebuffer },
+	{ offsetof(VkelDeviceTable, CreateRenderPass), (PFN_vkVoidFunction) vkelStubCreateRenderPass },
+	{ offsetof(VkelDeviceTable, DestroyRenderPass), (PFN_vkVoidFunction) vkelStubDestroyRenderPass },
+	{ offsetof(VkelDeviceTable, GetRenderAreaGranularity), (PFN_vkVoidFunction) vkelStubGetRenderAreaGranularity },
+	{ offsetof(VkelDeviceTable, CreateCommandPool), (PFN_vkVoidFunction) vkelStubCreateCommandPool },
+	{ offsetof(VkelDeviceTable, DestroyCommandPool), (PFN_vkVoidFunction) vkelStubDestroyCommandPool },
+	{ offsetof(VkelDeviceTable, ResetCommandPool), (PFN_vkVoidFunction) vkelStubResetCommandPool },
+	{ offsetof(VkelDeviceTable, AllocateCommandBuffers), (PFN_vkVoidFunction) vkelStubAllocateCommandBuffers },
+	{ offsetof(VkelDeviceTable, FreeCommandBuffers), (PFN_vkVoidFunction) vkelStubFreeCommandBuffers },
+	{ offsetof(VkelDeviceTable, BeginCommandBuffer), (PFN_vkVoidFunction) vkelStubBeginCommandBuffer },
+	{ offsetof(VkelDeviceTable, EndCommandBuffer), (PFN_vkVoidFunction) vkelStubEndCommandBuffer },
+	{ offsetof(VkelDeviceTable, ResetCommandBuffer), (PFN_vkVoidFunction) vkelStubResetCommandBuffer },
+	{ offsetof(VkelDeviceTable, CmdBindPipeline), (PFN_vkVoidFunction) vkelStubCmdBindPipeline },
+	{ offsetof(VkelDeviceTable, CmdSetViewport), (PFN_vkVoidFunction) vkelStubCmdSetViewport },
+	{ offsetof(VkelDeviceTable, CmdSetScissor), (PFN_vkVoidFunction) vkelStubCmdSetScissor },
+	{ offsetof(VkelDeviceTable, CmdSetLineWidth), (PFN_vkVoidFunction) vkelStubCmdSetLineWidth },
+	{ offsetof(VkelDeviceTable, CmdSetDepthBias), (PFN_vkVoidFunction) vkelStubCmdSetDepthBias },
+	{ offsetof(VkelDeviceTable, CmdSetBlendConstants), (PFN_vkVoidFunction) vkelStubCmdSetBlendConstants },
+	{ offsetof(VkelDeviceTable, CmdSetDepthBounds), (PFN_vkVoidFunction) vkelStubCmdSetDepthBounds },
+	{ offsetof(VkelDeviceTable, CmdSetStencilCompareMask), (PFN_vkVoidFunction) vkelStubCmdSetStencilCompareMask },
+	{ offsetof(VkelDeviceTable, CmdSetStencilWriteMask), (PFN_vkVoidFunction) vkelStubCmdSetStencilWriteMask },
+	{ offsetof(VkelDeviceTable, CmdSetStencilReference), (PFN_vkVoidFunction) vkelStubCmdSetStencilReference },
+	{ offsetof(VkelDeviceTable, CmdBindDescriptorSets), (PFN_vkVoidFunction) vkelStubCmdBindDescriptorSets },
+	{ offsetof(VkelDeviceTable, CmdBindIndexBuffer), (PFN_vkVoidFunction) vkelStubCmdBindIndexBuffer },
+	{ offsetof(VkelDeviceTable, CmdBindVertexBuffers), (PFN_vkVoidFunction) vkelStubCmdBindVertexBuffers },
+	{ offsetof(VkelDeviceTable, CmdDraw), (PFN_vkVoidFunction) vkelStubCmdDraw },
+	{ offsetof(VkelDeviceTable, CmdDrawIndexed), (PFN_vkVoidFunction) vkelStubCmdDrawIndexed },
+	{ offsetof(VkelDeviceTable, CmdDrawIndirect), (PFN_vkVoidFunction) vkelStubCmdDrawIndirect },
+	{ offsetof(VkelDeviceTable, CmdDrawIndexedIndirect), (PFN_vkVoidFunction) vkelStubCmdDrawIndexedIndirect },
+	{ offsetof(VkelDeviceTable, CmdDispatch), (PFN_vkVoidFunction) vkelStubCmdDispatch },
+	{ offsetof(VkelDeviceTable, CmdDispatchIndirect), (PFN_vkVoidFunction) vkelStubCmdDispatchIndirect },
+	{ offsetof(VkelDeviceTable, CmdCopyBuffer), (PFN_vkVoidFunction) vkelStubCmdCopyBuffer },
+	{ offsetof(VkelDeviceTable, CmdCopyImage), (PFN_vkVoidFunction) vkelStubCmdCopyImage },
+	{ offsetof(VkelDeviceTable, CmdBlitImage), (PFN_vkVoidFunction) vkelStubCmdBlitImage },
+	{ offsetof(VkelDeviceTable, CmdCopyBufferToImage), (PFN_vkVoidFunction) vkelStubCmdCopyBufferToImage },
+	{ offsetof(VkelDeviceTable, CmdCopyImageToBuffer), (PFN_vkVoidFunction) vkelStubCmdCopyImageToBuffer },
+	{ offsetof(VkelDeviceTable, CmdUpdateBuffer), (PFN_vkVoidFunction) vkelStubCmdUpdateBuffer },
+	{ offsetof(VkelDeviceTable, CmdFillBuffer), (PFN_vkVoidFunction) vkelStubCmdFillBuffer },
+	{ offsetof(VkelDeviceTable, CmdClearColorImage), (PFN_vkVoidFunction) vkelStubCmdClearColorImage },
+	{ offsetof(VkelDeviceTable, CmdClearDepthStencilImage), (PFN_vkVoidFunction) vkelStubCmdClearDepthStencilImage },
+	{ offsetof(VkelDeviceTable, CmdClearAttachments), (PFN_vkVoidFunction) vkelStubCmdClearAttachments },
+	{ offsetof(VkelDeviceTable, CmdResolveImage), (PFN_vkVoidFunction) vkelStubCmdResolveImage },
+	{ offsetof(VkelDeviceTable, CmdSetEvent), (PFN_vkVoidFunction) vkelStubCmdSetEvent },
+	{ offsetof(VkelDeviceTable, CmdResetEvent), (PFN_vkVoidFunction) vkelStubCmdResetEvent },
+	{ offsetof(VkelDeviceTable, CmdWaitEvents), (PFN_vkVoidFunction) vkelStubCmdWaitEvents },
+	{ offsetof(VkelDeviceTable, CmdPipelineBarrier), (PFN_vkVoidFunction) vkelStubCmdPipelineBarrier },
+	{ offsetof(VkelDeviceTable, CmdBeginQuery), (PFN_vkVoidFunction) vkelStubCmdBeginQuery },
+	{ offsetof(VkelDeviceTable, CmdEndQuery), (PFN_vkVoidFunction) vkelStubCmdEndQuery },
+	{ offsetof(VkelDeviceTable, CmdResetQueryPool), (PFN_vkVoidFunction) vkelStubCmdResetQueryPool },
+	{ offsetof(VkelDeviceTable, CmdWriteTimestamp), (PFN_vkVoidFunction) vkelStubCmdWriteTimestamp },
+	{ offsetof(VkelDeviceTable, CmdCopyQueryPoolResults), (PFN_vkVoidFunction) vkelStubCmdCopyQueryPoolResults },
+	{ offsetof(VkelDeviceTable, CmdPushConstants), (PFN_vkVoidFunction) vkelStubCmdPushConstants },
+	{ offsetof(VkelDeviceTable, CmdBeginRenderPass), (PFN_vkVoidFunction) vkelStubCmdBeginRenderPass },
+	{ offsetof(VkelDeviceTable, CmdNextSubpass), (PFN_vkVoidFunction) vkelStubCmdNextSubpass },
+	{ offsetof(VkelDeviceTable, CmdEndRenderPass), (PFN_vkVoidFunction) vkelStubCmdEndRenderPass },
+	{ offsetof(VkelDeviceTable, CmdExecuteCommands), (PFN_vkVoidFunction) vkelStubCmdExecuteCommands },
+	{ offsetof(VkelDeviceTable, CreateSwapchainKHR), (PFN_vkVoidFunction) vkelStubCreateSwapchainKHR },
+	{ offsetof(VkelDeviceTable, DestroySwapchainKHR), (PFN_vkVoidFunction) vkelStubDestroySwapchainKHR },
+	{ offsetof(VkelDeviceTable, GetSwapchainImagesKHR), (PFN_vkVoidFunction) vkelStubGetSwapchainImagesKHR },
+	{ offsetof(VkelDeviceTable, AcquireNextImageKHR), (PFN_vkVoidFunction) vkelStubAcquireNextImageKHR },
+	{ offsetof(VkelDeviceTable, QueuePresentKHR), (PFN_vkVoidFunction) vkelStubQueuePresentKHR },
+	{ offsetof(VkelDeviceTable, CreateSharedSwapchainsKHR), (PFN_vkVoidFunction) vkelStubCreateSharedSwapchainsKHR },
+	{ offsetof(VkelDeviceTable, DebugMarkerSetObjectTagEXT), (PFN_vkVoidFunction) vkelStubDebugMarkerSetObjectTagEXT },
+	{ offsetof(VkelDeviceTable, DebugMarkerSetObjectNameEXT), (PFN_vkVoidFunction) vkelStubDebugMarkerSetObjectNameEXT },
+	{ offsetof(VkelDeviceTable, CmdDebugMarkerBeginEXT), (PFN_vkVoidFunction) vkelStubCmdDebugMarkerBeginEXT },
+	{ offsetof(VkelDeviceTable, CmdDebugMarkerEndEXT), (PFN_vkVoidFunction) vkelStubCmdDebugMarkerEndEXT },
+	{ offsetof(VkelDeviceTable, CmdDebugMarkerInsertEXT), (PFN_vkVoidFunction) vkelStubCmdDebugMarkerInsertEXT },
+};
+
+static PFN_vkVoidFunction* vkelGetTableSlot(void *pTable, size_t offset)
+{
+	return (PFN_vkVoidFunction*) ((char*) pTable + offset);
+}
+
+static void vkelFillStubs(void *pTable, const VkelStub *pStubs, size_t stubCount)
+{
+	size_t i;
+	
+	// Only ever replaces NULL, which no other thread can be calling
+	for (i = 0; i < stubCount; ++i)
+		if (!*vkelGetTableSlot(pTable, pStubs[i].offset))
+			vkelAtomicStoreProc(*vkelGetTableSlot(pTable, pStubs[i].offset), pStubs[i].stub);
+}
+
+static const VkelStub* vkelFindStub(size_t offset)
+{
+	size_t first = 0;
+	size_t last = sizeof(vkelStubs) / sizeof(vkelStubs[0]);
+	
+	while (first < last)
+	{
+		size_t middle = first + (last - first) / 2;
+		
+		if (vkelStubs[middle].offset < offset)
+			first = middle + 1;
+		else
+			last = middle;
+	}
+	
+	return ((first < (sizeof(vkelStubs) / sizeof(vkelStubs[0]))) && (vkelStubs[first].offset == offset)) ? &vkelStubs[first] : NULL;
+}
+
+#	define vkelIsStub(pTable, name) ((pTable)->name == vkelStub##name)
+#else
+#	define vkelIsStub(pTable, name) 0
+#endif /* VKEL_FALLBACK_STUBS */
+
+typedef struct VkelDeviceMember
+{
+	size_t tableOffset;
+	size_t deviceTableOffset;
+} VkelDeviceMember;
+
+// Sorted by the offset in VkelTable
+static const VkelDeviceMember vkelDeviceMembers[] = {
+	{ offsetof(VkelTable, DestroyDevice), offsetof(VkelDeviceTable, DestroyDevice) },
+	{ offsetof(VkelTable, GetDeviceQueue), offsetof(VkelDeviceTable, GetDeviceQueue) },
+	{ offsetof(VkelTable, QueueSubmit), offsetof(VkelDeviceTable, QueueSubmit) },
+	{ offsetof(VkelTable, QueueWaitIdle), offsetof(VkelDeviceTable, QueueWaitIdle) },
+	{ offsetof(VkelTable, DeviceWaitIdle), offsetof(VkelDeviceTable, DeviceWaitIdle) },
+	{ offsetof(VkelTable, AllocateMemory), offsetof(VkelDeviceTable, AllocateMemory) },
+	{ offsetof(VkelTable, FreeMemory), offsetof(VkelDeviceTable, FreeMemory) },
+	{ offsetof(VkelTable, MapMemory), offsetof(VkelDeviceTable, MapMemory) },
+	{ offsetof(VkelTable, UnmapMemory), offsetof(VkelDeviceTable, UnmapMemory) },
+	{ offsetof(VkelTable, FlushMappedMemoryRanges), offsetof(VkelDeviceTable, FlushMappedMemoryRanges) },
+	{ offsetof(VkelTable, InvalidateMappedMemoryRanges), offsetof(VkelDeviceTable, InvalidateMappedMemoryRanges) },
+	{ offsetof(VkelTable, GetDeviceMemoryCommitment), offsetof(VkelDeviceTable, GetDeviceMemoryCommitment) },
+	{ offsetof(VkelTable, BindBufferMemory), offsetof(VkelDeviceTable, BindBufferMemory) },
+	{ offsetof(VkelTable, BindImageMemory), offsetof(VkelDeviceTable, BindImageMemory) },
+	{ offsetof(VkelTable, GetBufferMemoryRequirements), offsetof(VkelDeviceTable, GetBufferMemoryRequirements) },
+	{ offsetof(VkelTable, GetImageMemoryRequirements), offsetof(VkelDeviceTable, GetImageMemoryRequirements) },
+	{ offsetof(VkelTable, GetImageSparseMemoryRequirements), offsetof(VkelDeviceTable, GetImageSparseMemoryRequirements) },
+	{ offsetof(VkelTable, QueueBindSparse), offsetof(VkelDeviceTable, QueueBindSparse) },
+	{ offsetof(VkelTable, CreateFence), offsetof(VkelDeviceTable, CreateFence) },
+	{ offsetof(VkelTable, DestroyFence), offsetof(VkelDeviceTable, DestroyFence) },
+	{ offsetof(VkelTable, ResetFences), offsetof(VkelDeviceTable, ResetFences) },
+	{ offsetof(VkelTable, GetFenceStatus), offsetof(VkelDeviceTable, GetFenceStatus) },
+	{ offsetof(VkelTable, WaitForFences), offsetof(VkelDeviceTable, WaitForFences) },
+	{ offsetof(VkelTable, CreateSemaphore), offsetof(VkelDeviceTable, CreateSemaphore) },
+	{ offsetof(VkelTable, DestroySemaphore), offsetof(VkelDeviceTable, DestroySemaphore) },
+	{ offsetof(VkelTable, CreateEvent), offsetof(VkelDeviceTable, CreateEvent) },
+	{ offsetof(VkelTable, DestroyEvent), offsetof(VkelDeviceTable, DestroyEvent) },
+	{ offsetof(VkelTable, GetEventStatus), offsetof(VkelDeviceTable, GetEventStatus) },
+	{ offsetof(VkelTable, SetEvent), offsetof(VkelDeviceTable, SetEvent) },
+	{ offsetof(VkelTable, ResetEvent), offsetof(VkelDeviceTable, ResetEvent) },
+	{ offsetof(VkelTable, CreateQueryPool), offsetof(VkelDeviceTable, CreateQueryPool) },
+	{ offsetof(VkelTable, DestroyQueryPool), offsetof(VkelDeviceTable, DestroyQueryPool) },
+	{ offsetof(VkelTable, GetQueryPoolResults), offsetof(VkelDeviceTable, GetQueryPoolResults) },
+	{ offsetof(VkelTable, CreateBuffer), offsetof(VkelDeviceTable, CreateBuffer) },
+	{ offsetof(VkelTable, DestroyBuffer), offsetof(VkelDeviceTable, DestroyBuffer) },
+	{ offsetof(VkelTable, CreateBufferView), offsetof(VkelDeviceTable, CreateBufferView) },
+	{ offsetof(VkelTable, DestroyBufferView), offsetof(VkelDeviceTable, DestroyBufferView) },
+	{ offsetof(VkelTable, CreateImage), offsetof(VkelDeviceTable, CreateImage) },
+	{ offsetof(VkelTable, DestroyImage), offsetof(VkelDeviceTable, DestroyImage) },
+	{ offsetof(VkelTable, GetImageSubresourceLayout), offsetof(VkelDeviceTable, GetImageSubresourceLayout) },
+	{ offsetof(VkelTable, CreateImageView), offsetof(VkelDeviceTable, CreateImageView) },
+	{ offsetof(VkelTable, DestroyImageView), offsetof(VkelDeviceTable, DestroyImageView) },
+	{ offsetof(VkelTable, CreateShaderModule), offsetof(VkelDeviceTable, CreateShaderModule) },
+	{ offsetof(VkelTable, DestroyShaderModule), offsetof(VkelDeviceTable, DestroyShaderModule) },
+	{ offsetof(VkelTable, CreatePipelineCache), offsetof(VkelDeviceTable, CreatePipelineCache) },
+	{ offsetof(VkelTable, DestroyPipelineCache), offsetof(VkelDeviceTable, DestroyPipelineCache) },
+	{ offsetof(VkelTable, GetPipelineCacheData), offsetof(VkelDeviceTable, GetPipelineCacheData) },
+	{ offsetof(VkelTable, MergePipelineCaches), offsetof(VkelDeviceTable, MergePipelineCaches) },
+	{ offsetof(VkelTable, CreateGraphicsPipelines), offsetof(VkelDeviceTable, CreateGraphicsPipelines) },
+	{ offsetof(VkelTable, CreateComputePipelines), offsetof(VkelDeviceTable, CreateComputePipelines) },
+	{ offsetof(VkelTable, DestroyPipeline), offsetof(VkelDeviceTable, DestroyPipeline) },
+	{ offsetof(VkelTable, CreatePipelineLayout), offsetof(VkelDeviceTable, CreatePipelineLayout) },
+	{ offsetof(VkelTable, DestroyPipelineLayout), offsetof(VkelDeviceTable, DestroyPipelineLayout) },
+	{ offsetof(VkelTable, CreateSampler), offsetof(VkelDeviceTable, CreateSampler) },
+	{ offsetof(VkelTable, DestroySampler), offsetof(VkelDeviceTable, DestroySampler) },
+	{ offsetof(VkelTable, CreateDescriptorSetLayout), offsetof(VkelDeviceTable, CreateDescriptorSetLayout) },
+	{ offsetof(VkelTable, DestroyDescriptorSetLayout), offsetof(VkelDeviceTable, DestroyDescriptorSetLayout) },
+	{ offsetof(VkelTable, CreateDescriptorPool), offsetof(VkelDeviceTable, CreateDescriptorPool) },
+	{ offsetof(VkelTable, DestroyDescriptorPool), offsetof(VkelDeviceTable, DestroyDescriptorPool) },
+	{ offsetof(VkelTable, ResetDescriptorPool), offsetof(VkelDeviceTable, ResetDescriptorPool) },
+	{ offsetof(VkelTable, AllocateDescriptorSets), offsetof(VkelDeviceTable, AllocateDescriptorSets) },
+	{ offsetof(VkelTable, FreeDescriptorSets), offsetof(VkelDeviceTable, FreeDescriptorSets) },
+	{ offsetof(VkelTable, UpdateDescriptorSets), offsetof(VkelDeviceTable, UpdateDescriptorSets) },
+	{ offsetof(VkelTable, CreateFramebuffer), offsetof(VkelDeviceTable, CreateFramebuffer) },
+	{ offsetof(VkelTable, DestroyFramebuffer), offsetof(VkelDeviceTable, DestroyFramebuffer) },
+	{ offsetof(VkelTable, CreateRenderPass), offsetof(VkelDeviceTable, CreateRenderPass) },
+	{ offsetof(VkelTable, DestroyRenderPass), offsetof(VkelDeviceTable, DestroyRenderPass) },
+	{ offsetof(VkelTable, GetRenderAreaGranularity), offsetof(VkelDeviceTable, GetRenderAreaGranularity) },
+	{ offsetof(VkelTable, CreateCommandPool), offsetof(VkelDeviceTable, CreateCommandPool) },
+	{ offsetof(VkelTable, DestroyCommandPool), offsetof(VkelDeviceTable, DestroyCommandPool) },
+	{ offsetof(VkelTable, ResetCommandPool), offsetof(VkelDeviceTable, ResetCommandPool) },
+	{ offsetof(VkelTable, AllocateCommandBuffers), offsetof(VkelDeviceTable, AllocateCommandBuffers) },
+	{ offsetof(VkelTable, FreeCommandBuffers), offsetof(VkelDeviceTable, FreeCommandBuffers) },
+	{ offsetof(VkelTable, BeginCommandBuffer), offsetof(VkelDeviceTable, BeginCommandBuffer) },
+	{ offsetof(VkelTable, EndCommandBuffer), offsetof(VkelDeviceTable, EndCommandBuffer) },
+	{ offsetof(VkelTable, ResetCommandBuffer), offsetof(VkelDeviceTable, ResetCommandBuffer) },
+	{ offsetof(VkelTable, CmdBindPipeline), offsetof(VkelDeviceTable, CmdBindPipeline) },
+	{ offsetof(VkelTable, CmdSetViewport), offsetof(VkelDeviceTable, CmdSetViewport) },
+	{ offsetof(VkelTable, CmdSetScissor), offsetof(VkelDeviceTable, CmdSetScissor) },
+	{ offsetof(VkelTable, CmdSetLineWidth), offsetof(VkelDeviceTable, CmdSetLineWidth) },
+	{ offsetof(VkelTable, CmdSetDepthBias), offsetof(VkelDeviceTable, CmdSetDepthBias) },
+	{ offsetof(VkelTable, CmdSetBlendConstants), offsetof(VkelDeviceTable, CmdSetBlendConstants) },
+	{ offsetof(VkelTable, CmdSetDepthBounds), offsetof(VkelDeviceTable, CmdSetDepthBounds) },
+	{ offsetof(VkelTable, CmdSetStencilCompareMask), offsetof(VkelDeviceTable, CmdSetStencilCompareMask) },
+	{ offsetof(VkelTable, CmdSetStencilWriteMask), offsetof(VkelDeviceTable, CmdSetStencilWriteMask) },
+	{ offsetof(VkelTable, CmdSetStencilReference), offsetof(VkelDeviceTable, CmdSetStencilReference) },
+	{ offsetof(VkelTable, CmdBindDescriptorSets), offsetof(VkelDeviceTable, CmdBindDescriptorSets) },
+	{ offsetof(VkelTable, CmdBindIndexBuffer), offsetof(VkelDeviceTable, CmdBindIndexBuffer) },
+	{ offsetof(VkelTable, CmdBindVertexBuffers), offsetof(VkelDeviceTable, CmdBindVertexBuffers) },
+	{ offsetof(VkelTable, CmdDraw), offsetof(VkelDeviceTable, CmdDraw) },
+	{ offsetof(VkelTable, CmdDrawIndexed), offsetof(VkelDeviceTable, CmdDrawIndexed) },
+	{ offsetof(VkelTable, CmdDrawIndirect), offsetof(VkelDeviceTable, CmdDrawIndirect) },
+	{ offsetof(VkelTable, CmdDrawIndexedIndirect), offsetof(VkelDeviceTable, CmdDrawIndexedIndirect) },
+	{ offsetof(VkelTable, CmdDispatch), offsetof(VkelDeviceTable, CmdDispatch) },
+	{ offsetof(VkelTable, CmdDispatchIndirect), offsetof(VkelDeviceTable, CmdDispatchIndirect) },
+	{ offsetof(VkelTable, CmdCopyBuffer), offsetof(VkelDeviceTable, CmdCopyBuffer) },
+	{ offsetof(VkelTable, CmdCopyImage), offsetof(VkelDeviceTable, CmdCopyImage) },
+	{ offsetof(VkelTable, CmdBlitImage), offsetof(VkelDeviceTable, CmdBlitImage) },
+	{ offsetof(VkelTable, CmdCopyBufferToImage), offsetof(VkelDeviceTable, CmdCopyBufferToImage) },
+	{ offsetof(VkelTable, CmdCopyImageToBuffer), offsetof(VkelDeviceTable, CmdCopyImageToBuffer) },
+	{ offsetof(VkelTable, CmdUpdateBuffer), offsetof(VkelDeviceTable, CmdUpdateBuffer) },
+	{ offsetof(VkelTable, CmdFillBuffer), offsetof(VkelDeviceTable, CmdFillBuffer) },
+	{ offsetof(VkelTable, CmdClearColorImage), offsetof(VkelDeviceTable, CmdClearColorImage) },
+	{ offsetof(VkelTable, CmdClearDepthStencilImage), offsetof(VkelDeviceTable, CmdClearDepthStencilImage) },
+	{ offsetof(VkelTable, CmdClearAttachments), offsetof(VkelDeviceTable, CmdClearAttachments) },
+	{ offsetof(VkelTable, CmdResolveImage), offsetof(VkelDeviceTable, CmdResolveImage) },
+	{ offsetof(VkelTable, CmdSetEvent), offsetof(VkelDeviceTable, CmdSetEvent) },
+	{ offsetof(VkelTable, CmdResetEvent), offsetof(VkelDeviceTable, CmdResetEvent) },
+	{ offsetof(VkelTable, CmdWaitEvents), offsetof(VkelDeviceTable, CmdWaitEvents) },
+	{ offsetof(VkelTable, CmdPipelineBarrier), offsetof(VkelDeviceTable, CmdPipelineBarrier) },
+	{ offsetof(VkelTable, CmdBeginQuery), offsetof(VkelDeviceTable, CmdBeginQuery) },
+	{ offsetof(VkelTable, CmdEndQuery), offsetof(VkelDeviceTable, CmdEndQuery) },
+	{ offsetof(VkelTable, CmdResetQueryPool), offsetof(VkelDeviceTable, CmdResetQueryPool) },
+	{ offsetof(VkelTable, CmdWriteTimestamp), offsetof(VkelDeviceTable, CmdWriteTimestamp) },
+	{ offsetof(VkelTable, CmdCopyQueryPoolResults), offsetof(VkelDeviceTable, CmdCopyQueryPoolResults) },
+	{ offsetof(VkelTable, CmdPushConstants), offsetof(VkelDeviceTable, CmdPushConstants) },
+	{ offsetof(VkelTable, CmdBeginRenderPass), offsetof(VkelDeviceTable, CmdBeginRenderPass) },
+	{ offsetof(VkelTable, CmdNextSubpass), offsetof(VkelDeviceTable, CmdNextSubpass) },
+	{ offsetof(VkelTable, CmdEndRenderPass), offsetof(VkelDeviceTable, CmdEndRenderPass) },
+	{ offsetof(VkelTable, CmdExecuteCommands), offsetof(VkelDeviceTable, CmdExecuteCommands) },
+	{ offsetof(VkelTable, CreateSwapchainKHR), offsetof(VkelDeviceTable, CreateSwapchainKHR) },
+	{ offsetof(VkelTable, DestroySwapchainKHR), offsetof(VkelDeviceTable, DestroySwapchainKHR) },
+	{ offsetof(VkelTable, GetSwapchainImagesKHR), offsetof(VkelDeviceTable, GetSwapchainImagesKHR) },
+	{ offsetof(VkelTable, AcquireNextImageKHR), offsetof(VkelDeviceTable, AcquireNextImageKHR) },
+	{ offsetof(VkelTable, QueuePresentKHR), offsetof(VkelDeviceTable, QueuePresentKHR) },
+	{ offsetof(VkelTable, CreateSharedSwapchainsKHR), offsetof(VkelDeviceTable, CreateSharedSwapchainsKHR) },
+	{ offsetof(VkelTable, DebugMarkerSetObjectTagEXT), offsetof(VkelDeviceTable, DebugMarkerSetObjectTagEXT) },
+	{ offsetof(VkelTable, DebugMarkerSetObjectNameEXT), offsetof(VkelDeviceTable, DebugMarkerSetObjectNameEXT) },
+	{ offsetof(VkelTable, CmdDebugMarkerBeginEXT), offsetof(VkelDeviceTable, CmdDebugMarkerBeginEXT) },
+	{ offsetof(VkelTable, CmdDebugMarkerEndEXT), offsetof(VkelDeviceTable, CmdDebugMarkerEndEXT) },
+	{ offsetof(VkelTable, CmdDebugMarkerInsertEXT), offsetof(VkelDeviceTable, CmdDebugMarkerInsertEXT) },
+};
+
+static const VkelDeviceMember* vkelFindDeviceMember(size_t tableOffset)
+{
+	size_t first = 0;
+	size_t last = sizeof(vkelDeviceMembers) / sizeof(vkelDeviceMembers[0]);
+	
+	while (first < last)
+	{
+		size_t middle = first + (last - first) / 2;
+		
+		if (vkelDeviceMembers[middle].tableOffset < tableOffset)
+			first = middle + 1;
+		else
+			last = middle;
+	}
+	
+	return ((first < (sizeof(vkelDeviceMembers) / sizeof(vkelDeviceMembers[0]))) && (vkelDeviceMembers[first].tableOffset == tableOffset)) ? &vkelDeviceMembers[first] : NULL;
+}
+
+
+VkBool32 vkelIsFunctionLoaded(size_t tableOffset)
+{
+	assert(tableOffset < sizeof(VkelTable));
+	
+	// The device level functions are the ones the vk* macros call
+	const VkelDeviceMember *pMember = vkelFindDeviceMember(tableOffset);
+	
+	const void *pFunction = pMember ? ((const char*) vkelGetDeviceTable() + pMember->deviceTableOffset) : ((const char*) &vkelTable + tableOffset);
+	
+	PFN_vkVoidFunction function = (PFN_vkVoidFunction) vkelAtomicLoadPointer((void* volatile*) pFunction);
+	
+#ifdef VKEL_FALLBACK_STUBS
+	const VkelStub *pStub = vkelFindStub(tableOffset);
+	
+	if (pStub && (function == pStub->stub))
+		return VK_FALSE;
+#endif
+	
+	return function ? VK_TRUE : VK_FALSE;
+}
+
+
+#ifdef VKEL_RECORD_USAGE
+
+static volatile uint8_t vkelCommandUsage[174];
+static volatile uint8_t vkelExtensionUsage[VKEL_EXT_ID_COUNT + 1];
+static volatile uint8_t vkelLayerUsage[VKEL_LAYER_ID_COUNT + 1];
+
+
+static void vkelRecordUsage(volatile uint8_t *pUsage)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	// Only written once, so hot functions don't keep bouncing the cache line between threads
+	if (!__atomic_load_n(pUsage, __ATOMIC_RELAXED))
+		__atomic_store_n(pUsage, 1, __ATOMIC_RELAXED);
+#else
+	if (!*pUsage)
+		*pUsage = 1;
+#endif
+}
+
+static const char* const vkelCommandNames[] = {
+	"vkCreateInstance",
+	"vkDestroyInstance",
+	"vkEnumeratePhysicalDevices",
+	"vkGetPhysicalDeviceFeatures",
+	"vkGetPhysicalDeviceFormatProperties",
+	"vkGetPhysicalDeviceImageFormatProperties",
+	"vkGetPhysicalDeviceProperties",
+	"vkGetPhysicalDeviceQueueFamilyProperties",
+	"vkGetPhysicalDeviceMemoryProperties",
+	"vkGetInstanceProcAddr",
+	"vkGetDeviceProcAddr",
+	"vkCreateDevice",
+	"vkDestroyDevice",
+	"vkEnumerateInstanceExtensionProperties",
+	"vkEnumerateDeviceExtensionProperties",
+	"vkEnumerateInstanceLayerProperties",
+	"vkEnumerateDeviceLayerProperties",
+	"vkGetDeviceQueue",
+	"vkQueueSubmit",
+	"vkQueueWaitIdle",
+	"vkDeviceWaitIdle",
+	"vkAllocateMemory",
+	"vkFreeMemory",
+	"vkMapMemory",
+	"vkUnmapMemory",
+	"vkFlushMappedMemoryRanges",
+	"vkInvalidateMappedMemoryRanges",
+	"vkGetDeviceMemoryCommitment",
+	"vkBindBufferMemory",
+	"vkBindImageMemory",
+	"vkGetBufferMemoryRequirements",
+	"vkGetImageMemoryRequirements",
+	"vkGetImageSparseMemoryRequirements",
+	"vkGetPhysicalDeviceSparseImageFormatProperties",
+	"vkQueueBindSparse",
+	"vkCreateFence",
+	"vkDestroyFence",
+	"vkResetFences",
+	"vkGetFenceStatus",
+	"vkWaitForFences",
+	"vkCreateSemaphore",
+	"vkDestroySemaphore",
+	"vkCreateEvent",
+	"vkDestroyEvent",
+	"vkGetEventStatus",
+	"vkSetEvent",
+	"vkResetEvent",
+	"vkCreateQueryPool",
+	"vkDestroyQueryPool",
+	"vkGetQueryPoolResults",
+	"vkCreateBuffer",
+	"vkDestroyBuffer",
+	"vkCreateBufferView",
+	"vkDestroyBufferView",
+	"vkCreateImage",
+	"vkDestroyImage",
+	"vkGetImageSubresourceLayout",
+	"vkCreateImageView",
+	"vkDestroyImageView",
+	"vkCreateShaderModule",
+	"vkDestroyShaderModule",
+	"vkCreatePipelineCache",
+	"vkDestroyPipelineCache",
+	"vkGetPipelineCacheData",
+	"vkMergePipelineCaches",
+	"vkCreateGraphicsPipelines",
+	"vkCreateComputePipelines",
+	"vkDestroyPipeline",
+	"vkCreatePipelineLayout",
+	"vkDestroyPipelineLayout",
+	"vkCreateSampler",
+	"vkDestroySampler",
+	"vkCreateDescriptorSetLayout",
+	"vkDestroyDescriptorSetLayout",
+	"vkCreateDescriptorPool",
+	"vkDestroyDescriptorPool",
+	"vkResetDescriptorPool",
+	"vkAllocateDescriptorSets",
+	"vkFreeDescriptorSets",
+	"vkUpdateDescriptorSets",
+	"vkCreateFramebuffer",
+	"vkDestroyFramebuffer",
+	"vkCreateRenderPass",
+	"vkDestroyRenderPass",
+	"vkGetRenderAreaGranularity",
+	"vkCreateCommandPool",
+	"vkDestroyCommandPool",
+	"vkResetCommandPool",
+	"vkAllocateCommandBuffers",
+	"vkFreeCommandBuffers",
+	"vkBeginCommandBuffer",
+	"vkEndCommandBuffer",
+	"vkResetCommandBuffer",
+	"vkCmdBindPipeline",
+	"vkCmdSetViewport",
+	"vkCmdSetScissor",
+	"vkCmdSetLineWidth",
+	"vkCmdSetDepthBias",
+	"vkCmdSetBlendConstants",
+	"vkCmdSetDepthBounds",
+	"vkCmdSetStencilCompareMask",
+	"vkCmdSetStencilWriteMask",
+	"vkCmdSetStencilReference",
+	"vkCmdBindDescriptorSets",
+	"vkCmdBindIndexBuffer",
+	"vkCmdBindVertexBuffers",
+	"vkCmdDraw",
+	"vkCmdDrawIndexed",
+	"vkCmdDrawIndirect",
+	"vkCmdDrawIndexedIndirect",
+	"vkCmdDispatch",
+	"vkCmdDispatchIndirect",
+	"vkCmdCopyBuffer",
+	"vkCmdCopyImage",
+	"vkCmdBlitImage",
+	"vkCmdCopyBufferToImage",
+	"vkCmdCopyImageToBuffer",
+	"vkCmdUpdateBuffer",
+	"vkCmdFillBuffer",
+	"vkCmdClearColorImage",
+	"vkCmdClearDepthStencilImage",
+	"vkCmdClearAttachments",
+	"vkCmdResolveImage",
+	"vkCmdSetEvent",
+	"vkCmdResetEvent",
+	"vkCmdWaitEvents",
+	"vkCmdPipelineBarrier",
+	"vkCmdBeginQuery",
+	"vkCmdEndQuery",
+	"vkCmdResetQueryPool",
+	"vkCmdWriteTimestamp",
+	"vkCmdCopyQueryPoolResults",
+	"vkCmdPushConstants",
+	"vkCmdBeginRenderPass",
+	"vkCmdNextSubpass",
+	"vkCmdEndRenderPass",
+	"vkCmdExecuteCommands",
+	"vkDestroySurfaceKHR",
+	"vkGetPhysicalDeviceSurfaceSupportKHR",
+	"vkGetPhysicalDeviceSurfaceCapabilitiesKHR",
+	"vkGetPhysicalDeviceSurfaceFormatsKHR",
+	"vkGetPhysicalDeviceSurfacePresentModesKHR",
+	"vkCreateSwapchainKHR",
+	"vkDestroySwapchainKHR",
+	"vkGetSwapchainImagesKHR",
+	"vkAcquireNextImageKHR",
+	"vkQueuePresentKHR",
+	"vkGetPhysicalDeviceDisplayPropertiesKHR",
+	"vkGetPhysicalDeviceDisplayPlanePropertiesKHR",
+	"vkGetDisplayPlaneSupportedDisplaysKHR",
+	"vkGetDisplayModePropertiesKHR",
+	"vkCreateDisplayModeKHR",
+	"vkGetDisplayPlaneCapabilitiesKHR",
+	"vkCreateDisplayPlaneSurfaceKHR",
+	"vkCreateSharedSwapchainsKHR",
+	"vkCreateXlibSurfaceKHR",
+	"vkGetPhysicalDeviceXlibPresentationSupportKHR",
+	"vkCreateXcbSurfaceKHR",
+	"vkGetPhysicalDeviceXcbPresentationSupportKHR",
+	"vkCreateWaylandSurfaceKHR",
+	"vkGetPhysicalDeviceWaylandPresentationSupportKHR",
+	"vkCreateMirSurfaceKHR",
+	"vkGetPhysicalDeviceMirPresentationSupportKHR",
+	"vkCreateAndroidSurfaceKHR",
+	"vkCreateWin32SurfaceKHR",
+	"vkGetPhysicalDeviceWin32PresentationSupportKHR",
+	"vkCreateDebugReportCallbackEXT",
+	"vkDestroyDebugReportCallbackEXT",
+	"vkDebugReportMessageEXT",
+	"vkDebugMarkerSetObjectTagEXT",
+	"vkDebugMarkerSetObjectNameEXT",
+	"vkCmdDebugMarkerBeginEXT",
+	"vkCmdDebugMarkerEndEXT",
+	"vkCmdDebugMarkerInsertEXT",
+};
+
+// The entry whose recording functions the device level vk* macros call, the one bound to
+// the thread (see vkelBindDevice()) or else the published one
+static const VkelDevice* vkelGetRecordedDevice(void)
+{
+#ifdef VKEL_THREAD_DEVICE
+	// Which is followed by the table of recording functions, see vkelCreateDeviceEntry()
+	if (vkelThreadDeviceTable)
+		return (const VkelDevice*) (const void*) vkelThreadDeviceTable - 1;
+#endif
+	
+	return (const VkelDevice*) vkelAtomicLoadPointer(&vkelCurrentDevice);
+}
+
+
+static PFN_vkCreateInstance vkelRecordedCreateInstance;
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordCreateInstance(const VkInstanceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkInstance* pInstance)
+{
+	vkelRecordUsage(&vkelCommandUsage[0]);
+	return vkelRecordedCreateInstance(pCreateInfo, pAllocator, pInstance);
+}
+
+static PFN_vkDestroyInstance vkelRecordedDestroyInstance;
+static VKAPI_ATTR void VKAPI_CALL vkelRecordDestroyInstance(VkInstance instance, const VkAllocationCallbacks* pAllocator)
+{
+	vkelRecordUsage(&vkelCommandUsage[1]);
+	vkelRecordedDestroyInstance(instance, pAllocator);
+}
+
+static PFN_vkEnumeratePhysicalDevices vkelRecordedEnumeratePhysicalDevices;
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordEnumeratePhysicalDevices(VkInstance instance, uint32_t* pPhysicalDeviceCount, VkPhysicalDevice* pPhysicalDevices)
+{
+	vkelRecordUsage(&vkelCommandUsage[2]);
+	return vkelRecordedEnumeratePhysicalDevices(instance, pPhysicalDeviceCount, pPhysicalDevices);
+}
+
+static PFN_vkGetPhysicalDeviceFeatures vkelRecordedGetPhysicalDeviceFeatures;
+static VKAPI_ATTR void VKAPI_CALL vkelRecordGetPhysicalDeviceFeatures(VkPhysicalDevice physicalDevice, VkPhysicalDeviceFeatures* pFeatures)
+{
+	vkelRecordUsage(&vkelCommandUsage[3]);
+	vkelRecordedGetPhysicalDeviceFeatures(physicalDevice, pFeatures);
+}
+
+static PFN_vkGetPhysicalDeviceFormatProperties vkelRecordedGetPhysicalDeviceFormatProperties;
+static VKAPI_ATTR void VKAPI_CALL vkelRecordGetPhysicalDeviceFormatProperties(VkPhysicalDevice physicalDevice, VkFormat format, VkFormatProperties* pFormatProperties)
+{
+	vkelRecordUsage(&vkelCommandUsage[4]);
+	vkelRecordedGetPhysicalDeviceFormatProperties(physicalDevice, format, pFormatProperties);
+}
+
+static PFN_vkGetPhysicalDeviceImageFormatProperties vkelRecordedGetPhysicalDeviceImageFormatProperties;
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordGetPhysicalDeviceImageFormatProperties(VkPhysicalDevice physicalDevice, VkFormat format, VkImageType type, VkImageTiling tiling, VkImageUsageFlags usage, VkImageCreateFlags flags, VkImageFormatProperties* pImageFormatProperties)
+{
+	vkelRecordUsage(&vkelCommandUsage[5]);
+	return vkelRecordedGetPhysicalDeviceImageFormatProperties(physicalDevice, format, type, tiling, usage, flags, pImageFormatProperties);
+}
+
+static PFN_vkGetPhysicalDeviceProperties vkelRecordedGetPhysicalDeviceProperties;
+static VKAPI_ATTR void VKAPI_CALL vkelRecordGetPhysicalDeviceProperties(VkPhysicalDevice physicalDevice, VkPhysicalDeviceProperties* pProperties)
+{
+	vkelRecordUsage(&vkelCommandUsage[6]);
+	vkelRecordedGetPhysicalDeviceProperties(physicalDevice, pProperties);
+}
+
+static PFN_vkGetPhysicalDeviceQueueFamilyProperties vkelRecordedGetPhysicalDeviceQueueFamilyProperties;
+static VKAPI_ATTR void VKAPI_CALL vkelRecordGetPhysicalDeviceQueueFamilyProperties(VkPhysicalDevice physicalDevice, uint32_t* pQueueFamilyPropertyCount, VkQueueFamilyProperties* pQueueFamilyProperties)
+{
+	vkelRecordUsage(&vkelCommandUsage[7]);
+	vkelRecordedGetPhysicalDeviceQueueFamilyProperties(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
+}
+
+static PFN_vkGetPhysicalDeviceMemoryProperties vkelRecordedGetPhysicalDeviceMemoryProperties;
+static VKAPI_ATTR void VKAPI_CALL vkelRecordGetPhysicalDeviceMemoryProperties(VkPhysicalDevice physicalDevice, VkPhysicalDeviceMemoryProperties* pMemoryProperties)
+{
+	vkelRecordUsage(&vkelCommandUsage[8]);
+	vkelRecordedGetPhysicalDeviceMemoryProperties(physicalDevice, pMemoryProperties);
+}
+
+static PFN_vkGetInstanceProcAddr vkelRecordedGetInstanceProcAddr;
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkelRecordGetInstanceProcAddr(VkInstance instance, const char* pName)
+{
+	vkelRecordUsage(&vkelCommandUsage[9]);
+	return vkelRecordedGetInstanceProcAddr(instance, pName);
+}
+
+static PFN_vkGetDeviceProcAddr vkelRecordedGetDeviceProcAddr;
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkelRecordGetDeviceProcAddr(VkDevice device, const char* pName)
+{
+	vkelRecordUsage(&vkelCommandUsage[10]);
+	return vkelRecordedGetDeviceProcAddr(device, pName);
+}
+
+static PFN_vkCreateDevice vkelRecordedCreateDevice;
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordCreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDevice* pDevice)
+{
+	vkelRecordUsage(&vkelCommandUsage[11]);
+	return vkelRecordedCreateDevice(physicalDevice, pCreateInfo, pAllocator, pDevice);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator)
+{
+	vkelRecordUsage(&vkelCommandUsage[12]);
+	vkelGetRecordedDevice()->table.DestroyDevice(device, pAllocator);
+}
+
+static PFN_vkEnumerateInstanceExtensionProperties vkelRecordedEnumerateInstanceExtensionProperties;
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordEnumerateInstanceExtensionProperties(const char* pLayerName, uint32_t* pPropertyCount, VkExtensionProperties* pProperties)
+{
+	vkelRecordUsage(&vkelCommandUsage[13]);
+	return vkelRecordedEnumerateInstanceExtensionProperties(pLayerName, pPropertyCount, pProperties);
+}
+
+static PFN_vkEnumerateDeviceExtensionProperties vkelRecordedEnumerateDeviceExtensionProperties;
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordEnumerateDeviceExtensionProperties(VkPhysicalDevice physicalDevice, const char* pLayerName, uint32_t* pPropertyCount, VkExtensionProperties* pProperties)
+{
+	vkelRecordUsage(&vkelCommandUsage[14]);
+	return vkelRecordedEnumerateDeviceExtensionProperties(physicalDevice, pLayerName, pPropertyCount, pProperties);
+}
+
+static PFN_vkEnumerateInstanceLayerProperties vkelRecordedEnumerateInstanceLayerProperties;
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordEnumerateInstanceLayerProperties(uint32_t* pPropertyCount, VkLayerProperties* pProperties)
+{
+	vkelRecordUsage(&vkelCommandUsage[15]);
+	return vkelRecordedEnumerateInstanceLayerProperties(pPropertyCount, pProperties);
+}
+
+static PFN_vkEnumerateDeviceLayerProperties vkelRecordedEnumerateDeviceLayerProperties;
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordEnumerateDeviceLayerProperties(VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkLayerProperties* pProperties)
+{
+	vkelRecordUsage(&vkelCommandUsage[16]);
+	return vkelRecordedEnumerateDeviceLayerProperties(physicalDevice, pPropertyCount, pProperties);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordGetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue* pQueue)
+{
+	vkelRecordUsage(&vkelCommandUsage[17]);
+	vkelGetRecordedDevice()->table.GetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence)
+{
+	vkelRecordUsage(&vkelCommandUsage[18]);
+	return vkelGetRecordedDevice()->table.QueueSubmit(queue, submitCount, pSubmits, fence);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordQueueWaitIdle(VkQueue queue)
+{
+	vkelRecordUsage(&vkelCommandUsage[19]);
+	return vkelGetRecordedDevice()->table.QueueWaitIdle(queue);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordDeviceWaitIdle(VkDevice device)
+{
+	vkelRecordUsage(&vkelCommandUsage[20]);
+	return vkelGetRecordedDevice()->table.DeviceWaitIdle(device);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordAllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo, const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory)
+{
+	vkelRecordUsage(&vkelCommandUsage[21]);
+	return vkelGetRecordedDevice()->table.AllocateMemory(device, pAllocateInfo, pAllocator, pMemory);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordFreeMemory(VkDevice device, VkDeviceMemory memory, const VkAllocationCallbacks* pAllocator)
+{
+	vkelRecordUsage(&vkelCommandUsage[22]);
+	vkelGetRecordedDevice()->table.FreeMemory(device, memory, pAllocator);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordMapMemory(VkDevice device, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size, VkMemoryMapFlags flags, void** ppData)
+{
+	vkelRecordUsage(&vkelCommandUsage[23]);
+	return vkelGetRecordedDevice()->table.MapMemory(device, memory, offset, size, flags, ppData);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordUnmapMemory(VkDevice device, VkDeviceMemory memory)
+{
+	vkelRecordUsage(&vkelCommandUsage[24]);
+	vkelGetRecordedDevice()->table.UnmapMemory(device, memory);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordFlushMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount, const VkMappedMemoryRange* pMemoryRanges)
+{
+	vkelRecordUsage(&vkelCommandUsage[25]);
+	return vkelGetRecordedDevice()->table.FlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordInvalidateMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount, const VkMappedMemoryRange* pMemoryRanges)
+{
+	vkelRecordUsage(&vkelCommandUsage[26]);
+	return vkelGetRecordedDevice()->table.InvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordGetDeviceMemoryCommitment(VkDevice device, VkDeviceMemory memory, VkDeviceSize* pCommittedMemoryInBytes)
+{
+	vkelRecordUsage(&vkelCommandUsage[27]);
+	vkelGetRecordedDevice()->table.GetDeviceMemoryCommitment(device, memory, pCommittedMemoryInBytes);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordBindBufferMemory(VkDevice device, VkBuffer buffer, VkDeviceMemory memory, VkDeviceSize memoryOffset)
+{
+	vkelRecordUsage(&vkelCommandUsage[28]);
+	return vkelGetRecordedDevice()->table.BindBufferMemory(device, buffer, memory, memoryOffset);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordBindImageMemory(VkDevice device, VkImage image, VkDeviceMemory memory, VkDeviceSize memoryOffset)
+{
+	vkelRecordUsage(&vkelCommandUsage[29]);
+	return vkelGetRecordedDevice()->table.BindImageMemory(device, image, memory, memoryOffset);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordGetBufferMemoryRequirements(VkDevice device, VkBuffer buffer, VkMemoryRequirements* pMemoryRequirements)
+{
+	vkelRecordUsage(&vkelCommandUsage[30]);
+	vkelGetRecordedDevice()->table.GetBufferMemoryRequirements(device, buffer, pMemoryRequirements);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordGetImageMemoryRequirements(VkDevice device, VkImage image, VkMemoryRequirements* pMemoryRequirements)
+{
+	vkelRecordUsage(&vkelCommandUsage[31]);
+	vkelGetRecordedDevice()->table.GetImageMemoryRequirements(device, image, pMemoryRequirements);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordGetImageSparseMemoryRequirements(VkDevice device, VkImage image, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements* pSparseMemoryRequirements)
+{
+	vkelRecordUsage(&vkelCommandUsage[32]);
+	vkelGetRecordedDevice()->table.GetImageSparseMemoryRequirements(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+}
+
+static PFN_vkGetPhysicalDeviceSparseImageFormatProperties vkelRecordedGetPhysicalDeviceSparseImageFormatProperties;
+static VKAPI_ATTR void VKAPI_CALL vkelRecordGetPhysicalDeviceSparseImageFormatProperties(VkPhysicalDevice physicalDevice, VkFormat format, VkImageType type, VkSampleCountFlagBits samples, VkImageUsageFlags usage, VkImageTiling tiling, uint32_t* pPropertyCount, VkSparseImageFormatProperties* pProperties)
+{
+	vkelRecordUsage(&vkelCommandUsage[33]);
+	vkelRecordedGetPhysicalDeviceSparseImageFormatProperties(physicalDevice, format, type, samples, usage, tiling, pPropertyCount, pProperties);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordQueueBindSparse(VkQueue queue, uint32_t bindInfoCount, const VkBindSparseInfo* pBindInfo, VkFence fence)
+{
+	vkelRecordUsage(&vkelCommandUsage[34]);
+	return vkelGetRecordedDevice()->table.QueueBindSparse(queue, bindInfoCount, pBindInfo, fence);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordCreateFence(VkDevice device, const VkFenceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkFence* pFence)
+{
+	vkelRecordUsage(&vkelCommandUsage[35]);
+	return vkelGetRecordedDevice()->table.CreateFence(device, pCreateInfo, pAllocator, pFence);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordDestroyFence(VkDevice device, VkFence fence, const VkAllocationCallbacks* pAllocator)
+{
+	vkelRecordUsage(&vkelCommandUsage[36]);
+	vkelGetRecordedDevice()->table.DestroyFence(device, fence, pAllocator);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordResetFences(VkDevice device, uint32_t fenceCount, const VkFence* pFences)
+{
+	vkelRecordUsage(&vkelCommandUsage[37]);
+	return vkelGetRecordedDevice()->table.ResetFences(device, fenceCount, pFences);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordGetFenceStatus(VkDevice device, VkFence fence)
+{
+	vkelRecordUsage(&vkelCommandUsage[38]);
+	return vkelGetRecordedDevice()->table.GetFenceStatus(device, fence);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence* pFences, VkBool32 waitAll, uint64_t timeout)
+{
+	vkelRecordUsage(&vkelCommandUsage[39]);
+	return vkelGetRecordedDevice()->table.WaitForFences(device, fenceCount, pFences, waitAll, timeout);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordCreateSemaphore(VkDevice device, const VkSemaphoreCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSemaphore* pSemaphore)
+{
+	vkelRecordUsage(&vkelCommandUsage[40]);
+	return vkelGetRecordedDevice()->table.CreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordDestroySemaphore(VkDevice device, VkSemaphore semaphore, const VkAllocationCallbacks* pAllocator)
+{
+	vkelRecordUsage(&vkelCommandUsage[41]);
+	vkelGetRecordedDevice()->table.DestroySemaphore(device, semaphore, pAllocator);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordCreateEvent(VkDevice device, const VkEventCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkEvent* pEvent)
+{
+	vkelRecordUsage(&vkelCommandUsage[42]);
+	return vkelGetRecordedDevice()->table.CreateEvent(device, pCreateInfo, pAllocator, pEvent);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordDestroyEvent(VkDevice device, VkEvent event, const VkAllocationCallbacks* pAllocator)
+{
+	vkelRecordUsage(&vkelCommandUsage[43]);
+	vkelGetRecordedDevice()->table.DestroyEvent(device, event, pAllocator);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordGetEventStatus(VkDevice device, VkEvent event)
+{
+	vkelRecordUsage(&vkelCommandUsage[44]);
+	return vkelGetRecordedDevice()->table.GetEventStatus(device, event);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordSetEvent(VkDevice device, VkEvent event)
+{
+	vkelRecordUsage(&vkelCommandUsage[45]);
+	return vkelGetRecordedDevice()->table.SetEvent(device, event);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordResetEvent(VkDevice device, VkEvent event)
+{
+	vkelRecordUsage(&vkelCommandUsage[46]);
+	return vkelGetRecordedDevice()->table.ResetEvent(device, event);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordCreateQueryPool(VkDevice device, const VkQueryPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkQueryPool* pQueryPool)
+{
+	vkelRecordUsage(&vkelCommandUsage[47]);
+	return vkelGetRecordedDevice()->table.CreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordDestroyQueryPool(VkDevice device, VkQueryPool queryPool, const VkAllocationCallbacks* pAllocator)
+{
+	vkelRecordUsage(&vkelCommandUsage[48]);
+	vkelGetRecordedDevice()->table.DestroyQueryPool(device, queryPool, pAllocator);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordGetQueryPoolResults(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, size_t dataSize, void* pData, VkDeviceSize stride, VkQueryResultFlags flags)
+{
+	vkelRecordUsage(&vkelCommandUsage[49]);
+	return vkelGetRecordedDevice()->table.GetQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordCreateBuffer(VkDevice device, const VkBufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBuffer* pBuffer)
+{
+	vkelRecordUsage(&vkelCommandUsage[50]);
+	return vkelGetRecordedDevice()->table.CreateBuffer(device, pCreateInfo, pAllocator, pBuffer);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordDestroyBuffer(VkDevice device, VkBuffer buffer, const VkAllocationCallbacks* pAllocator)
+{
+	vkelRecordUsage(&vkelCommandUsage[51]);
+	vkelGetRecordedDevice()->table.DestroyBuffer(device, buffer, pAllocator);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordCreateBufferView(VkDevice device, const VkBufferViewCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBufferView* pView)
+{
+	vkelRecordUsage(&vkelCommandUsage[52]);
+	return vkelGetRecordedDevice()->table.CreateBufferView(device, pCreateInfo, pAllocator, pView);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordDestroyBufferView(VkDevice device, VkBufferView bufferView, const VkAllocationCallbacks* pAllocator)
+{
+	vkelRecordUsage(&vkelCommandUsage[53]);
+	vkelGetRecordedDevice()->table.DestroyBufferView(device, bufferView, pAllocator);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordCreateImage(VkDevice device, const VkImageCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkImage* pImage)
+{
+	vkelRecordUsage(&vkelCommandUsage[54]);
+	return vkelGetRecordedDevice()->table.CreateImage(device, pCreateInfo, pAllocator, pImage);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordDestroyImage(VkDevice device, VkImage image, const VkAllocationCallbacks* pAllocator)
+{
+	vkelRecordUsage(&vkelCommandUsage[55]);
+	vkelGetRecordedDevice()->table.DestroyImage(device, image, pAllocator);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordGetImageSubresourceLayout(VkDevice device, VkImage image, const VkImageSubresource* pSubresource, VkSubresourceLayout* pLayout)
+{
+	vkelRecordUsage(&vkelCommandUsage[56]);
+	vkelGetRecordedDevice()->table.GetImageSubresourceLayout(device, image, pSubresource, pLayout);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordCreateImageView(VkDevice device, const VkImageViewCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkImageView* pView)
+{
+	vkelRecordUsage(&vkelCommandUsage[57]);
+	return vkelGetRecordedDevice()->table.CreateImageView(device, pCreateInfo, pAllocator, pView);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordDestroyImageView(VkDevice device, VkImageView imageView, const VkAllocationCallbacks* pAllocator)
+{
+	vkelRecordUsage(&vkelCommandUsage[58]);
+	vkelGetRecordedDevice()->table.DestroyImageView(device, imageView, pAllocator);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule)
+{
+	vkelRecordUsage(&vkelCommandUsage[59]);
+	return vkelGetRecordedDevice()->table.CreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordDestroyShaderModule(VkDevice device, VkShaderModule shaderModule, const VkAllocationCallbacks* pAllocator)
+{
+	vkelRecordUsage(&vkelCommandUsage[60]);
+	vkelGetRecordedDevice()->table.DestroyShaderModule(device, shaderModule, pAllocator);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordCreatePipelineCache(VkDevice device, const VkPipelineCacheCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineCache* pPipelineCache)
+{
+	vkelRecordUsage(&vkelCommandUsage[61]);
+	return vkelGetRecordedDevice()->table.CreatePipelineCache(device, pCreateInfo, pAllocator, pPipelineCache);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordDestroyPipelineCache(VkDevice device, VkPipelineCache pipelineCache, const VkAllocationCallbacks* pAllocator)
+{
+	vkelRecordUsage(&vkelCommandUsage[62]);
+	vkelGetRecordedDevice()->table.DestroyPipelineCache(device, pipelineCache, pAllocator);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordGetPipelineCacheData(VkDevice device, VkPipelineCache pipelineCache, size_t* pDataSize, void* pData)
+{
+	vkelRecordUsage(&vkelCommandUsage[63]);
+	return vkelGetRecordedDevice()->table.GetPipelineCacheData(device, pipelineCache, pDataSize, pData);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordMergePipelineCaches(VkDevice device, VkPipelineCache dstCache, uint32_t srcCacheCount, const VkPipelineCache* pSrcCaches)
+{
+	vkelRecordUsage(&vkelCommandUsage[64]);
+	return vkelGetRecordedDevice()->table.MergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkGraphicsPipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines)
+{
+	vkelRecordUsage(&vkelCommandUsage[65]);
+	return vkelGetRecordedDevice()->table.CreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordCreateComputePipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkComputePipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines)
+{
+	vkelRecordUsage(&vkelCommandUsage[66]);
+	return vkelGetRecordedDevice()->table.CreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordDestroyPipeline(VkDevice device, VkPipeline pipeline, const VkAllocationCallbacks* pAllocator)
+{
+	vkelRecordUsage(&vkelCommandUsage[67]);
+	vkelGetRecordedDevice()->table.DestroyPipeline(device, pipeline, pAllocator);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordCreatePipelineLayout(VkDevice device, const VkPipelineLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineLayout* pPipelineLayout)
+{
+	vkelRecordUsage(&vkelCommandUsage[68]);
+	return vkelGetRecordedDevice()->table.CreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordDestroyPipelineLayout(VkDevice device, VkPipelineLayout pipelineLayout, const VkAllocationCallbacks* pAllocator)
+{
+	vkelRecordUsage(&vkelCommandUsage[69]);
+	vkelGetRecordedDevice()->table.DestroyPipelineLayout(device, pipelineLayout, pAllocator);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordCreateSampler(VkDevice device, const VkSamplerCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSampler* pSampler)
+{
+	vkelRecordUsage(&vkelCommandUsage[70]);
+	return vkelGetRecordedDevice()->table.CreateSampler(device, pCreateInfo, pAllocator, pSampler);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordDestroySampler(VkDevice device, VkSampler sampler, const VkAllocationCallbacks* pAllocator)
+{
+	vkelRecordUsage(&vkelCommandUsage[71]);
+	vkelGetRecordedDevice()->table.DestroySampler(device, sampler, pAllocator);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordCreateDescriptorSetLayout(VkDevice device, const VkDescriptorSetLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorSetLayout* pSetLayout)
+{
+	vkelRecordUsage(&vkelCommandUsage[72]);
+	return vkelGetRecordedDevice()->table.CreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordDestroyDescriptorSetLayout(VkDevice device, VkDescriptorSetLayout descriptorSetLayout, const VkAllocationCallbacks* pAllocator)
+{
+	vkelRecordUsage(&vkelCommandUsage[73]);
+	vkelGetRecordedDevice()->table.DestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordCreateDescriptorPool(VkDevice device, const VkDescriptorPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorPool* pDescriptorPool)
+{
+	vkelRecordUsage(&vkelCommandUsage[74]);
+	return vkelGetRecordedDevice()->table.CreateDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordDestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool, const VkAllocationCallbacks* pAllocator)
+{
+	vkelRecordUsage(&vkelCommandUsage[75]);
+	vkelGetRecordedDevice()->table.DestroyDescriptorPool(device, descriptorPool, pAllocator);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordResetDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool, VkDescriptorPoolResetFlags flags)
+{
+	vkelRecordUsage(&vkelCommandUsage[76]);
+	return vkelGetRecordedDevice()->table.ResetDescriptorPool(device, descriptorPool, flags);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordAllocateDescriptorSets(VkDevice device, const VkDescriptorSetAllocateInfo* pAllocateInfo, VkDescriptorSet* pDescriptorSets)
+{
+	vkelRecordUsage(&vkelCommandUsage[77]);
+	return vkelGetRecordedDevice()->table.AllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordFreeDescriptorSets(VkDevice device, VkDescriptorPool descriptorPool, uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets)
+{
+	vkelRecordUsage(&vkelCommandUsage[78]);
+	return vkelGetRecordedDevice()->table.FreeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordUpdateDescriptorSets(VkDevice device, uint32_t descriptorWriteCount, const VkWriteDescriptorSet* pDescriptorWrites, uint32_t descriptorCopyCount, const VkCopyDescriptorSet* pDescriptorCopies)
+{
+	vkelRecordUsage(&vkelCommandUsage[79]);
+	vkelGetRecordedDevice()->table.UpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordCreateFramebuffer(VkDevice device, const VkFramebufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkFramebuffer* pFramebuffer)
+{
+	vkelRecordUsage(&vkelCommandUsage[80]);
+	return vkelGetRecordedDevice()->table.CreateFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordDestroyFramebuffer(VkDevice device, VkFramebuffer framebuffer, const VkAllocationCallbacks* pAllocator)
+{
+	vkelRecordUsage(&vkelCommandUsage[81]);
+	vkelGetRecordedDevice()->table.DestroyFramebuffer(device, framebuffer, pAllocator);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordCreateRenderPass(VkDevice device, const VkRenderPassCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass)
+{
+	vkelRecordUsage(&vkelCommandUsage[82]);
+	return vkelGetRecordedDevice()->table.CreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordDestroyRenderPass(VkDevice device, VkRenderPass renderPass, const VkAllocationCallbacks* pAllocator)
+{
+	vkelRecordUsage(&vkelCommandUsage[83]);
+	vkelGetRecordedDevice()->table.DestroyRenderPass(device, renderPass, pAllocator);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordGetRenderAreaGranularity(VkDevice device, VkRenderPass renderPass, VkExtent2D* pGranularity)
+{
+	vkelRecordUsage(&vkelCommandUsage[84]);
+	vkelGetRecordedDevice()->table.GetRenderAreaGranularity(device, renderPass, pGranularity);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordCreateCommandPool(VkDevice device, const VkCommandPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkCommandPool* pCommandPool)
+{
+	vkelRecordUsage(&vkelCommandUsage[85]);
+	return vkelGetRecordedDevice()->table.CreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordDestroyCommandPool(VkDevice device, VkCommandPool commandPool, const VkAllocationCallbacks* pAllocator)
+{
+	vkelRecordUsage(&vkelCommandUsage[86]);
+	vkelGetRecordedDevice()->table.DestroyCommandPool(device, commandPool, pAllocator);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordResetCommandPool(VkDevice device, VkCommandPool commandPool, VkCommandPoolResetFlags flags)
+{
+	vkelRecordUsage(&vkelCommandUsage[87]);
+	return vkelGetRecordedDevice()->table.ResetCommandPool(device, commandPool, flags);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordAllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo* pAllocateInfo, VkCommandBuffer* pCommandBuffers)
+{
+	vkelRecordUsage(&vkelCommandUsage[88]);
+	return vkelGetRecordedDevice()->table.AllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordFreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount, const VkCommandBuffer* pCommandBuffers)
+{
+	vkelRecordUsage(&vkelCommandUsage[89]);
+	vkelGetRecordedDevice()->table.FreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordBeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo* pBeginInfo)
+{
+	vkelRecordUsage(&vkelCommandUsage[90]);
+	return vkelGetRecordedDevice()->table.BeginCommandBuffer(commandBuffer, pBeginInfo);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordEndCommandBuffer(VkCommandBuffer commandBuffer)
+{
+	vkelRecordUsage(&vkelCommandUsage[91]);
+	return vkelGetRecordedDevice()->table.EndCommandBuffer(commandBuffer);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags)
+{
+	vkelRecordUsage(&vkelCommandUsage[92]);
+	return vkelGetRecordedDevice()->table.ResetCommandBuffer(commandBuffer, flags);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline)
+{
+	vkelRecordUsage(&vkelCommandUsage[93]);
+	vkelGetRecordedDevice()->table.CmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdSetViewport(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkViewport* pViewports)
+{
+	vkelRecordUsage(&vkelCommandUsage[94]);
+	vkelGetRecordedDevice()->table.CmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdSetScissor(VkCommandBuffer commandBuffer, uint32_t firstScissor, uint32_t scissorCount, const VkRect2D* pScissors)
+{
+	vkelRecordUsage(&vkelCommandUsage[95]);
+	vkelGetRecordedDevice()->table.CmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdSetLineWidth(VkCommandBuffer commandBuffer, float lineWidth)
+{
+	vkelRecordUsage(&vkelCommandUsage[96]);
+	vkelGetRecordedDevice()->table.CmdSetLineWidth(commandBuffer, lineWidth);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdSetDepthBias(VkCommandBuffer commandBuffer, float depthBiasConstantFactor, float depthBiasClamp, float depthBiasSlopeFactor)
+{
+	vkelRecordUsage(&vkelCommandUsage[97]);
+	vkelGetRecordedDevice()->table.CmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdSetBlendConstants(VkCommandBuffer commandBuffer, const float blendConstants[4])
+{
+	vkelRecordUsage(&vkelCommandUsage[98]);
+	vkelGetRecordedDevice()->table.CmdSetBlendConstants(commandBuffer, blendConstants);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdSetDepthBounds(VkCommandBuffer commandBuffer, float minDepthBounds, float maxDepthBounds)
+{
+	vkelRecordUsage(&vkelCommandUsage[99]);
+	vkelGetRecordedDevice()->table.CmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdSetStencilCompareMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t compareMask)
+{
+	vkelRecordUsage(&vkelCommandUsage[100]);
+	vkelGetRecordedDevice()->table.CmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdSetStencilWriteMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t writeMask)
+{
+	vkelRecordUsage(&vkelCommandUsage[101]);
+	vkelGetRecordedDevice()->table.CmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdSetStencilReference(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t reference)
+{
+	vkelRecordUsage(&vkelCommandUsage[102]);
+	vkelGetRecordedDevice()->table.CmdSetStencilReference(commandBuffer, faceMask, reference);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdBindDescriptorSets(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t firstSet, uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets, uint32_t dynamicOffsetCount, const uint32_t* pDynamicOffsets)
+{
+	vkelRecordUsage(&vkelCommandUsage[103]);
+	vkelGetRecordedDevice()->table.CmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkIndexType indexType)
+{
+	vkelRecordUsage(&vkelCommandUsage[104]);
+	vkelGetRecordedDevice()->table.CmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdBindVertexBuffers(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, const VkBuffer* pBuffers, const VkDeviceSize* pOffsets)
+{
+	vkelRecordUsage(&vkelCommandUsage[105]);
+	vkelGetRecordedDevice()->table.CmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance)
+{
+	vkelRecordUsage(&vkelCommandUsage[106]);
+	vkelGetRecordedDevice()->table.CmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance)
+{
+	vkelRecordUsage(&vkelCommandUsage[107]);
+	vkelGetRecordedDevice()->table.CmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride)
+{
+	vkelRecordUsage(&vkelCommandUsage[108]);
+	vkelGetRecordedDevice()->table.CmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdDrawIndexedIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride)
+{
+	vkelRecordUsage(&vkelCommandUsage[109]);
+	vkelGetRecordedDevice()->table.CmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdDispatch(VkCommandBuffer commandBuffer, uint32_t x, uint32_t y, uint32_t z)
+{
+	vkelRecordUsage(&vkelCommandUsage[110]);
+	vkelGetRecordedDevice()->table.CmdDispatch(commandBuffer, x, y, z);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset)
+{
+	vkelRecordUsage(&vkelCommandUsage[111]);
+	vkelGetRecordedDevice()->table.CmdDispatchIndirect(commandBuffer, buffer, offset);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, uint32_t regionCount, const VkBufferCopy* pRegions)
+{
+	vkelRecordUsage(&vkelCommandUsage[112]);
+	vkelGetRecordedDevice()->table.CmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdCopyImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageCopy* pRegions)
+{
+	vkelRecordUsage(&vkelCommandUsage[113]);
+	vkelGetRecordedDevice()->table.CmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdBlitImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageBlit* pRegions, VkFilter filter)
+{
+	vkelRecordUsage(&vkelCommandUsage[114]);
+	vkelGetRecordedDevice()->table.CmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdCopyBufferToImage(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkBufferImageCopy* pRegions)
+{
+	vkelRecordUsage(&vkelCommandUsage[115]);
+	vkelGetRecordedDevice()->table.CmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdCopyImageToBuffer(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkBuffer dstBuffer, uint32_t regionCount, const VkBufferImageCopy* pRegions)
+{
+	vkelRecordUsage(&vkelCommandUsage[116]);
+	vkelGetRecordedDevice()->table.CmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize dataSize, const void* pData)
+{
+	vkelRecordUsage(&vkelCommandUsage[117]);
+	vkelGetRecordedDevice()->table.CmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize size, uint32_t data)
+{
+	vkelRecordUsage(&vkelCommandUsage[118]);
+	vkelGetRecordedDevice()->table.CmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdClearColorImage(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const VkClearColorValue* pColor, uint32_t rangeCount, const VkImageSubresourceRange* pRanges)
+{
+	vkelRecordUsage(&vkelCommandUsage[119]);
+	vkelGetRecordedDevice()->table.CmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdClearDepthStencilImage(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const VkClearDepthStencilValue* pDepthStencil, uint32_t rangeCount, const VkImageSubresourceRange* pRanges)
+{
+	vkelRecordUsage(&vkelCommandUsage[120]);
+	vkelGetRecordedDevice()->table.CmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdClearAttachments(VkCommandBuffer commandBuffer, uint32_t attachmentCount, const VkClearAttachment* pAttachments, uint32_t rectCount, const VkClearRect* pRects)
+{
+	vkelRecordUsage(&vkelCommandUsage[121]);
+	vkelGetRecordedDevice()->table.CmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdResolveImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageResolve* pRegions)
+{
+	vkelRecordUsage(&vkelCommandUsage[122]);
+	vkelGetRecordedDevice()->table.CmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdSetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask)
+{
+	vkelRecordUsage(&vkelCommandUsage[123]);
+	vkelGetRecordedDevice()->table.CmdSetEvent(commandBuffer, event, stageMask);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdResetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask)
+{
+	vkelRecordUsage(&vkelCommandUsage[124]);
+	vkelGetRecordedDevice()->table.CmdResetEvent(commandBuffer, event, stageMask);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers, uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers)
+{
+	vkelRecordUsage(&vkelCommandUsage[125]);
+	vkelGetRecordedDevice()->table.CmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdPipelineBarrier(VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, VkDependencyFlags dependencyFlags, uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers, uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers)
+{
+	vkelRecordUsage(&vkelCommandUsage[126]);
+	vkelGetRecordedDevice()->table.CmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query, VkQueryControlFlags flags)
+{
+	vkelRecordUsage(&vkelCommandUsage[127]);
+	vkelGetRecordedDevice()->table.CmdBeginQuery(commandBuffer, queryPool, query, flags);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query)
+{
+	vkelRecordUsage(&vkelCommandUsage[128]);
+	vkelGetRecordedDevice()->table.CmdEndQuery(commandBuffer, queryPool, query);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdResetQueryPool(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount)
+{
+	vkelRecordUsage(&vkelCommandUsage[129]);
+	vkelGetRecordedDevice()->table.CmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdWriteTimestamp(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage, VkQueryPool queryPool, uint32_t query)
+{
+	vkelRecordUsage(&vkelCommandUsage[130]);
+	vkelGetRecordedDevice()->table.CmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdCopyQueryPoolResults(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize stride, VkQueryResultFlags flags)
+{
+	vkelRecordUsage(&vkelCommandUsage[131]);
+	vkelGetRecordedDevice()->table.CmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout layout, VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size, const void* pValues)
+{
+	vkelRecordUsage(&vkelCommandUsage[132]);
+	vkelGetRecordedDevice()->table.CmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin, VkSubpassContents contents)
+{
+	vkelRecordUsage(&vkelCommandUsage[133]);
+	vkelGetRecordedDevice()->table.CmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpassContents contents)
+{
+	vkelRecordUsage(&vkelCommandUsage[134]);
+	vkelGetRecordedDevice()->table.CmdNextSubpass(commandBuffer, contents);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdEndRenderPass(VkCommandBuffer commandBuffer)
+{
+	vkelRecordUsage(&vkelCommandUsage[135]);
+	vkelGetRecordedDevice()->table.CmdEndRenderPass(commandBuffer);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount, const VkCommandBuffer* pCommandBuffers)
+{
+	vkelRecordUsage(&vkelCommandUsage[136]);
+	vkelGetRecordedDevice()->table.CmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
+}
+
+static PFN_vkDestroySurfaceKHR vkelRecordedDestroySurfaceKHR;
+static VKAPI_ATTR void VKAPI_CALL vkelRecordDestroySurfaceKHR(VkInstance instance, VkSurfaceKHR surface, const VkAllocationCallbacks* pAllocator)
+{
+	vkelRecordUsage(&vkelCommandUsage[137]);
+	vkelRecordedDestroySurfaceKHR(instance, surface, pAllocator);
+}
+
+static PFN_vkGetPhysicalDeviceSurfaceSupportKHR vkelRecordedGetPhysicalDeviceSurfaceSupportKHR;
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordGetPhysicalDeviceSurfaceSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, VkSurfaceKHR surface, VkBool32* pSupported)
+{
+	vkelRecordUsage(&vkelCommandUsage[138]);
+	return vkelRecordedGetPhysicalDeviceSurfaceSupportKHR(physicalDevice, queueFamilyIndex, surface, pSupported);
+}
+
+static PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR vkelRecordedGetPhysicalDeviceSurfaceCapabilitiesKHR;
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordGetPhysicalDeviceSurfaceCapabilitiesKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, VkSurfaceCapabilitiesKHR* pSurfaceCapabilities)
+{
+	vkelRecordUsage(&vkelCommandUsage[139]);
+	return vkelRecordedGetPhysicalDeviceSurfaceCapabilitiesKHR(physicalDevice, surface, pSurfaceCapabilities);
+}
+
+static PFN_vkGetPhysicalDeviceSurfaceFormatsKHR vkelRecordedGetPhysicalDeviceSurfaceFormatsKHR;
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordGetPhysicalDeviceSurfaceFormatsKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pSurfaceFormatCount, VkSurfaceFormatKHR* pSurfaceFormats)
+{
+	vkelRecordUsage(&vkelCommandUsage[140]);
+	return vkelRecordedGetPhysicalDeviceSurfaceFormatsKHR(physicalDevice, surface, pSurfaceFormatCount, pSurfaceFormats);
+}
+
+static PFN_vkGetPhysicalDeviceSurfacePresentModesKHR vkelRecordedGetPhysicalDeviceSurfacePresentModesKHR;
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordGetPhysicalDeviceSurfacePresentModesKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pPresentModeCount, VkPresentModeKHR* pPresentModes)
+{
+	vkelRecordUsage(&vkelCommandUsage[141]);
+	return vkelRecordedGetPhysicalDeviceSurfacePresentModesKHR(physicalDevice, surface, pPresentModeCount, pPresentModes);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordCreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchain)
+{
+	vkelRecordUsage(&vkelCommandUsage[142]);
+	return vkelGetRecordedDevice()->table.CreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordDestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain, const VkAllocationCallbacks* pAllocator)
+{
+	vkelRecordUsage(&vkelCommandUsage[143]);
+	vkelGetRecordedDevice()->table.DestroySwapchainKHR(device, swapchain, pAllocator);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordGetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchain, uint32_t* pSwapchainImageCount, VkImage* pSwapchainImages)
+{
+	vkelRecordUsage(&vkelCommandUsage[144]);
+	return vkelGetRecordedDevice()->table.GetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordAcquireNextImageKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout, VkSemaphore semaphore, VkFence fence, uint32_t* pImageIndex)
+{
+	vkelRecordUsage(&vkelCommandUsage[145]);
+	return vkelGetRecordedDevice()->table.AcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR* pPresentInfo)
+{
+	vkelRecordUsage(&vkelCommandUsage[146]);
+	return vkelGetRecordedDevice()->table.QueuePresentKHR(queue, pPresentInfo);
+}
+
+static PFN_vkGetPhysicalDeviceDisplayPropertiesKHR vkelRecordedGetPhysicalDeviceDisplayPropertiesKHR;
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordGetPhysicalDeviceDisplayPropertiesKHR(VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayPropertiesKHR* pProperties)
+{
+	vkelRecordUsage(&vkelCommandUsage[147]);
+	return vkelRecordedGetPhysicalDeviceDisplayPropertiesKHR(physicalDevice, pPropertyCount, pProperties);
+}
+
+static PFN_vkGetPhysicalDeviceDisplayPlanePropertiesKHR vkelRecordedGetPhysicalDeviceDisplayPlanePropertiesKHR;
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordGetPhysicalDeviceDisplayPlanePropertiesKHR(VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayPlanePropertiesKHR* pProperties)
+{
+	vkelRecordUsage(&vkelCommandUsage[148]);
+	return vkelRecordedGetPhysicalDeviceDisplayPlanePropertiesKHR(physicalDevice, pPropertyCount, pProperties);
+}
+
+static PFN_vkGetDisplayPlaneSupportedDisplaysKHR vkelRecordedGetDisplayPlaneSupportedDisplaysKHR;
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordGetDisplayPlaneSupportedDisplaysKHR(VkPhysicalDevice physicalDevice, uint32_t planeIndex, uint32_t* pDisplayCount, VkDisplayKHR* pDisplays)
+{
+	vkelRecordUsage(&vkelCommandUsage[149]);
+	return vkelRecordedGetDisplayPlaneSupportedDisplaysKHR(physicalDevice, planeIndex, pDisplayCount, pDisplays);
+}
+
+static PFN_vkGetDisplayModePropertiesKHR vkelRecordedGetDisplayModePropertiesKHR;
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordGetDisplayModePropertiesKHR(VkPhysicalDevice physicalDevice, VkDisplayKHR display, uint32_t* pPropertyCount, VkDisplayModePropertiesKHR* pProperties)
+{
+	vkelRecordUsage(&vkelCommandUsage[150]);
+	return vkelRecordedGetDisplayModePropertiesKHR(physicalDevice, display, pPropertyCount, pProperties);
+}
+
+static PFN_vkCreateDisplayModeKHR vkelRecordedCreateDisplayModeKHR;
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordCreateDisplayModeKHR(VkPhysicalDevice physicalDevice, VkDisplayKHR display, const VkDisplayModeCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDisplayModeKHR* pMode)
+{
+	vkelRecordUsage(&vkelCommandUsage[151]);
+	return vkelRecordedCreateDisplayModeKHR(physicalDevice, display, pCreateInfo, pAllocator, pMode);
+}
+
+static PFN_vkGetDisplayPlaneCapabilitiesKHR vkelRecordedGetDisplayPlaneCapabilitiesKHR;
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordGetDisplayPlaneCapabilitiesKHR(VkPhysicalDevice physicalDevice, VkDisplayModeKHR mode, uint32_t planeIndex, VkDisplayPlaneCapabilitiesKHR* pCapabilities)
+{
+	vkelRecordUsage(&vkelCommandUsage[152]);
+	return vkelRecordedGetDisplayPlaneCapabilitiesKHR(physicalDevice, mode, planeIndex, pCapabilities);
+}
+
+static PFN_vkCreateDisplayPlaneSurfaceKHR vkelRecordedCreateDisplayPlaneSurfaceKHR;
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordCreateDisplayPlaneSurfaceKHR(VkInstance instance, const VkDisplaySurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+	vkelRecordUsage(&vkelCommandUsage[153]);
+	return vkelRecordedCreateDisplayPlaneSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordCreateSharedSwapchainsKHR(VkDevice device, uint32_t swapchainCount, const VkSwapchainCreateInfoKHR* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchains)
+{
+	vkelRecordUsage(&vkelCommandUsage[154]);
+	return vkelGetRecordedDevice()->table.CreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
+}
+
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+static PFN_vkCreateXlibSurfaceKHR vkelRecordedCreateXlibSurfaceKHR;
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordCreateXlibSurfaceKHR(VkInstance instance, const VkXlibSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+	vkelRecordUsage(&vkelCommandUsage[155]);
+	return vkelRecordedCreateXlibSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
+}
+#endif /* VK_USE_PLATFORM_XLIB_KHR */
+
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+static PFN_vkGetPhysicalDeviceXlibPresentationSupportKHR vkelRecordedGetPhysicalDeviceXlibPresentationSupportKHR;
+static VKAPI_ATTR VkBool32 VKAPI_CALL vkelRecordGetPhysicalDeviceXlibPresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, Display* dpy, VisualID visualID)
+{
+	vkelRecordUsage(&vkelCommandUsage[156]);
+	return vkelRecordedGetPhysicalDeviceXlibPresentationSupportKHR(physicalDevice, queueFamilyIndex, dpy, visualID);
+}
+#endif /* VK_USE_PLATFORM_XLIB_KHR */
+
+#ifdef VK_USE_PLATFORM_XCB_KHR
+static PFN_vkCreateXcbSurfaceKHR vkelRecordedCreateXcbSurfaceKHR;
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordCreateXcbSurfaceKHR(VkInstance instance, const VkXcbSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+	vkelRecordUsage(&vkelCommandUsage[157]);
+	return vkelRecordedCreateXcbSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
+}
+#endif /* VK_USE_PLATFORM_XCB_KHR */
+
+#ifdef VK_USE_PLATFORM_XCB_KHR
+static PFN_vkGetPhysicalDeviceXcbPresentationSupportKHR vkelRecordedGetPhysicalDeviceXcbPresentationSupportKHR;
+static VKAPI_ATTR VkBool32 VKAPI_CALL vkelRecordGetPhysicalDeviceXcbPresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, xcb_connection_t* connection, xcb_visualid_t visual_id)
+{
+	vkelRecordUsage(&vkelCommandUsage[158]);
+	return vkelRecordedGetPhysicalDeviceXcbPresentationSupportKHR(physicalDevice, queueFamilyIndex, connection, visual_id);
+}
+#endif /* VK_USE_PLATFORM_XCB_KHR */
+
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+static PFN_vkCreateWaylandSurfaceKHR vkelRecordedCreateWaylandSurfaceKHR;
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordCreateWaylandSurfaceKHR(VkInstance instance, const VkWaylandSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+	vkelRecordUsage(&vkelCommandUsage[159]);
+	return vkelRecordedCreateWaylandSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
+}
+#endif /* VK_USE_PLATFORM_WAYLAND_KHR */
+
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+static PFN_vkGetPhysicalDeviceWaylandPresentationSupportKHR vkelRecordedGetPhysicalDeviceWaylandPresentationSupportKHR;
+static VKAPI_ATTR VkBool32 VKAPI_CALL vkelRecordGetPhysicalDeviceWaylandPresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, struct wl_display* display)
+{
+	vkelRecordUsage(&vkelCommandUsage[160]);
+	return vkelRecordedGetPhysicalDeviceWaylandPresentationSupportKHR(physicalDevice, queueFamilyIndex, display);
+}
+#endif /* VK_USE_PLATFORM_WAYLAND_KHR */
+
+#ifdef VK_USE_PLATFORM_MIR_KHR
+static PFN_vkCreateMirSurfaceKHR vkelRecordedCreateMirSurfaceKHR;
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordCreateMirSurfaceKHR(VkInstance instance, const VkMirSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+	vkelRecordUsage(&vkelCommandUsage[161]);
+	return vkelRecordedCreateMirSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
+}
+#endif /* VK_USE_PLATFORM_MIR_KHR */
+
+#ifdef VK_USE_PLATFORM_MIR_KHR
+static PFN_vkGetPhysicalDeviceMirPresentationSupportKHR vkelRecordedGetPhysicalDeviceMirPresentationSupportKHR;
+static VKAPI_ATTR VkBool32 VKAPI_CALL vkelRecordGetPhysicalDeviceMirPresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, MirConnection* connection)
+{
+	vkelRecordUsage(&vkelCommandUsage[162]);
+	return vkelRecordedGetPhysicalDeviceMirPresentationSupportKHR(physicalDevice, queueFamilyIndex, connection);
+}
+#endif /* VK_USE_PLATFORM_MIR_KHR */
+
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+static PFN_vkCreateAndroidSurfaceKHR vkelRecordedCreateAndroidSurfaceKHR;
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordCreateAndroidSurfaceKHR(VkInstance instance, const VkAndroidSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+	vkelRecordUsage(&vkelCommandUsage[163]);
+	return vkelRecordedCreateAndroidSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
+}
+#endif /* VK_USE_PLATFORM_ANDROID_KHR */
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+static PFN_vkCreateWin32SurfaceKHR vkelRecordedCreateWin32SurfaceKHR;
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordCreateWin32SurfaceKHR(VkInstance instance, const VkWin32SurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+	vkelRecordUsage(&vkelCommandUsage[164]);
+	return vkelRecordedCreateWin32SurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
+}
+#endif /* VK_USE_PLATFORM_WIN32_KHR */
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+static PFN_vkGetPhysicalDeviceWin32PresentationSupportKHR vkelRecordedGetPhysicalDeviceWin32PresentationSupportKHR;
+static VKAPI_ATTR VkBool32 VKAPI_CALL vkelRecordGetPhysicalDeviceWin32PresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex)
+{
+	vkelRecordUsage(&vkelCommandUsage[165]);
+	return vkelRecordedGetPhysicalDeviceWin32PresentationSupportKHR(physicalDevice, queueFamilyIndex);
+}
+#endif /* VK_USE_PLATFORM_WIN32_KHR */
+
+static PFN_vkCreateDebugReportCallbackEXT vkelRecordedCreateDebugReportCallbackEXT;
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordCreateDebugReportCallbackEXT(VkInstance instance, const VkDebugReportCallbackCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDebugReportCallbackEXT* pCallback)
+{
+	vkelRecordUsage(&vkelCommandUsage[166]);
+	return vkelRecordedCreateDebugReportCallbackEXT(instance, pCreateInfo, pAllocator, pCallback);
+}
+
+static PFN_vkDestroyDebugReportCallbackEXT vkelRecordedDestroyDebugReportCallbackEXT;
+static VKAPI_ATTR void VKAPI_CALL vkelRecordDestroyDebugReportCallbackEXT(VkInstance instance, VkDebugReportCallbackEXT callback, const VkAllocationCallbacks* pAllocator)
+{
+	vkelRecordUsage(&vkelCommandUsage[167]);
+	vkelRecordedDestroyDebugReportCallbackEXT(instance, callback, pAllocator);
+}
+
+static PFN_vkDebugReportMessageEXT vkelRecordedDebugReportMessageEXT;
+static VKAPI_ATTR void VKAPI_CALL vkelRecordDebugReportMessageEXT(VkInstance instance, VkDebugReportFlagsEXT flags, VkDebugReportObjectTypeEXT objectType, uint64_t object, size_t location, int32_t messageCode, const char* pLayerPrefix, const char* pMessage)
+{
+	vkelRecordUsage(&vkelCommandUsage[168]);
+	vkelRecordedDebugReportMessageEXT(instance, flags, objectType, object, location, messageCode, pLayerPrefix, pMessage);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordDebugMarkerSetObjectTagEXT(VkDevice device, VkDebugMarkerObjectTagInfoEXT* pTagInfo)
+{
+	vkelRecordUsage(&vkelCommandUsage[169]);
+	return vkelGetRecordedDevice()->table.DebugMarkerSetObjectTagEXT(device, pTagInfo);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelRecordDebugMarkerSetObjectNameEXT(VkDevice device, VkDebugMarkerObjectNameInfoEXT* pNameInfo)
+{
+	vkelRecordUsage(&vkelCommandUsage[170]);
+	return vkelGetRecordedDevice()->table.DebugMarkerSetObjectNameEXT(device, pNameInfo);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdDebugMarkerBeginEXT(VkCommandBuffer commandBuffer, VkDebugMarkerMarkerInfoEXT* pMarkerInfo)
+{
+	vkelRecordUsage(&vkelCommandUsage[171]);
+	vkelGetRecordedDevice()->table.CmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdDebugMarkerEndEXT(VkCommandBuffer commandBuffer)
+{
+	vkelRecordUsage(&vkelCommandUsage[172]);
+	vkelGetRecordedDevice()->table.CmdDebugMarkerEndEXT(commandBuffer);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelRecordCmdDebugMarkerInsertEXT(VkCommandBuffer commandBuffer, VkDebugMarkerMarkerInfoEXT* pMarkerInfo)
+{
+	vkelRecordUsage(&vkelCommandUsage[173]);
+	vkelGetRecordedDevice()->table.CmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo);
+}
+
+
+VkBool32 vkelWriteUsageProfile(const char *pPath)
+{
+	FILE *file = fopen(pPath, "w");
+	
+	if (!file)
+		return VK_FALSE;
+	
+	
+	uint32_t commandIndex = 0;
+	for (commandIndex = 0; commandIndex < (sizeof(vkelCommandNames) / sizeof(vkelCommandNames[0])); commandIndex++)
+		if (vkelCommandUsage[commandIndex])
+			fprintf(file, "%s\n", vkelCommandNames[commandIndex]);
+	
+	uint32_t extensionId = 0;
+	for (extensionId = 0; extensionId < VKEL_EXT_ID_COUNT; extensionId++)
+		if (vkelExtensionUsage[extensionId])
+			fprintf(file, "%s\n", vkelExtensionNames[extensionId]);
+	
+	uint32_t layerId = 0;
+	for (layerId = 0; layerId < VKEL_LAYER_ID_COUNT; layerId++)
+		if (vkelLayerUsage[layerId])
+			fprintf(file, "%s\n", vkelLayerNames[layerId]);
+	
+	
+	return (fclose(file) == 0) ? VK_TRUE : VK_FALSE;
+}
+
+
+static void vkelWriteUsageProfileAtExit(void)
+{
+	const char *pPath = getenv("VKEL_USAGE_PROFILE");
+	
+	if (pPath && *pPath)
+		vkelWriteUsageProfile(pPath);
+}
+
+static void vkelRecordUsageProcs(void)
+{
+	static VkBool32 registeredAtExit = VK_FALSE;
+	
+	if (!registeredAtExit && getenv("VKEL_USAGE_PROFILE"))
+		registeredAtExit = (atexit(vkelWriteUsageProfileAtExit) == 0) ? VK_TRUE : VK_FALSE;
+	
+	
+	if (vkelTable.CreateInstance && (vkelTable.CreateInstance != vkelRecordCreateInstance) && !vkelIsStub(&vkelTable, CreateInstance))
+	{
+		vkelRecordedCreateInstance = vkelTable.CreateInstance;
+		vkelTable.CreateInstance = vkelRecordCreateInstance;
+	}
+	if (vkelTable.DestroyInstance && (vkelTable.DestroyInstance != vkelRecordDestroyInstance) && !vkelIsStub(&vkelTable, DestroyInstance))
+	{
+		vkelRecordedDestroyInstance = vkelTable.DestroyInstance;
+		vkelTable.DestroyInstance = vkelRecordDestroyInstance;
+	}
+	if (vkelTable.EnumeratePhysicalDevices && (vkelTable.EnumeratePhysicalDevices != vkelRecordEnumeratePhysicalDevices) && !vkelIsStub(&vkelTable, EnumeratePhysicalDevices))
+	{
+		vkelRecordedEnumeratePhysicalDevices = vkelTable.EnumeratePhysicalDevices;
+		vkelTable.EnumeratePhysicalDevices = vkelRecordEnumeratePhysicalDevices;
+	}
+	if (vkelTable.GetPhysicalDeviceFeatures && (vkelTable.GetPhysicalDeviceFeatures != vkelRecordGetPhysicalDeviceFeatures) && !vkelIsStub(&vkelTable, GetPhysicalDeviceFeatures))
+	{
+		vkelRecordedGetPhysicalDeviceFeatures = vkelTable.GetPhysicalDeviceFeatures;
+		vkelTable.GetPhysicalDeviceFeatures = vkelRecordGetPhysicalDeviceFeatures;
+	}
+	if (vkelTable.GetPhysicalDeviceFormatProperties && (vkelTable.GetPhysicalDeviceFormatProperties != vkelRecordGetPhysicalDeviceFormatProperties) && !vkelIsStub(&vkelTable, GetPhysicalDeviceFormatProperties))
+	{
+		vkelRecordedGetPhysicalDeviceFormatProperties = vkelTable.GetPhysicalDeviceFormatProperties;
+		vkelTable.GetPhysicalDeviceFormatProperties = vkelRecordGetPhysicalDeviceFormatProperties;
+	}
+	if (vkelTable.GetPhysicalDeviceImageFormatProperties && (vkelTable.GetPhysicalDeviceImageFormatProperties != vkelRecordGetPhysicalDeviceImageFormatProperties) && !vkelIsStub(&vkelTable, GetPhysicalDeviceImageFormatProperties))
+	{
+		vkelRecordedGetPhysicalDeviceImageFormatProperties = vkelTable.GetPhysicalDeviceImageFormatProperties;
+		vkelTable.GetPhysicalDeviceImageFormatProperties = vkelRecordGetPhysicalDeviceImageFormatProperties;
+	}
+	if (vkelTable.GetPhysicalDeviceProperties && (vkelTable.GetPhysicalDeviceProperties != vkelRecordGetPhysicalDeviceProperties) && !vkelIsStub(&vkelTable, GetPhysicalDeviceProperties))
+	{
+		vkelRecordedGetPhysicalDeviceProperties = vkelTable.GetPhysicalDeviceProperties;
+		vkelTable.GetPhysicalDeviceProperties = vkelRecordGetPhysicalDeviceProperties;
+	}
+	if (vkelTable.GetPhysicalDeviceQueueFamilyProperties && (vkelTable.GetPhysicalDeviceQueueFamilyProperties != vkelRecordGetPhysicalDeviceQueueFamilyProperties) && !vkelIsStub(&vkelTable, GetPhysicalDeviceQueueFamilyProperties))
+	{
+		vkelRecordedGetPhysicalDeviceQueueFamilyProperties = vkelTable.GetPhysicalDeviceQueueFamilyProperties;
+		vkelTable.GetPhysicalDeviceQueueFamilyProperties = vkelRecordGetPhysicalDeviceQueueFamilyProperties;
+	}
+	if (vkelTable.GetPhysicalDeviceMemoryProperties && (vkelTable.GetPhysicalDeviceMemoryProperties != vkelRecordGetPhysicalDeviceMemoryProperties) && !vkelIsStub(&vkelTable, GetPhysicalDeviceMemoryProperties))
+	{
+		vkelRecordedGetPhysicalDeviceMemoryProperties = vkelTable.GetPhysicalDeviceMemoryProperties;
+		vkelTable.GetPhysicalDeviceMemoryProperties = vkelRecordGetPhysicalDeviceMemoryProperties;
+	}
+	if (vkelTable.GetInstanceProcAddr && (vkelTable.GetInstanceProcAddr != vkelRecordGetInstanceProcAddr) && !vkelIsStub(&vkelTable, GetInstanceProcAddr))
+	{
+		vkelRecordedGetInstanceProcAddr = vkelTable.GetInstanceProcAddr;
+		vkelTable.GetInstanceProcAddr = vkelRecordGetInstanceProcAddr;
+	}
+	if (vkelTable.GetDeviceProcAddr && (vkelTable.GetDeviceProcAddr != vkelRecordGetDeviceProcAddr) && !vkelIsStub(&vkelTable, GetDeviceProcAddr))
+	{
+		vkelRecordedGetDeviceProcAddr = vkelTable.GetDeviceProcAddr;
+		vkelTable.GetDeviceProcAddr = vkelRecordGetDeviceProcAddr;
+	}
+	if (vkelTable.CreateDevice && (vkelTable.CreateDevice != vkelRecordCreateDevice) && !vkelIsStub(&vkelTable, CreateDevice))
+	{
+		vkelRecordedCreateDevice = vkelTable.CreateDevice;
+		vkelTable.CreateDevice = vkelRecordCreateDevice;
+	}
+	if (vkelTable.EnumerateInstanceExtensionProperties && (vkelTable.EnumerateInstanceExtensionProperties != vkelRecordEnumerateInstanceExtensionProperties) && !vkelIsStub(&vkelTable, EnumerateInstanceExtensionProperties))
+	{
+		vkelRecordedEnumerateInstanceExtensionProperties = vkelTable.EnumerateInstanceExtensionProperties;
+		vkelTable.EnumerateInstanceExtensionProperties = vkelRecordEnumerateInstanceExtensionProperties;
+	}
+	if (vkelTable.EnumerateDeviceExtensionProperties && (vkelTable.EnumerateDeviceExtensionProperties != vkelRecordEnumerateDeviceExtensionProperties) && !vkelIsStub(&vkelTable, EnumerateDeviceExtensionProperties))
+	{
+		vkelRecordedEnumerateDeviceExtensionProperties = vkelTable.EnumerateDeviceExtensionProperties;
+		vkelTable.EnumerateDeviceExtensionProperties = vkelRecordEnumerateDeviceExtensionProperties;
+	}
+	if (vkelTable.EnumerateInstanceLayerProperties && (vkelTable.EnumerateInstanceLayerProperties != vkelRecordEnumerateInstanceLayerProperties) && !vkelIsStub(&vkelTable, EnumerateInstanceLayerProperties))
+	{
+		vkelRecordedEnumerateInstanceLayerProperties = vkelTable.EnumerateInstanceLayerProperties;
+		vkelTable.EnumerateInstanceLayerProperties = vkelRecordEnumerateInstanceLayerProperties;
+	}
+	if (vkelTable.EnumerateDeviceLayerProperties && (vkelTable.EnumerateDeviceLayerProperties != vkelRecordEnumerateDeviceLayerProperties) && !vkelIsStub(&vkelTable, EnumerateDeviceLayerProperties))
+	{
+		vkelRecordedEnumerateDeviceLayerProperties = vkelTable.EnumerateDeviceLayerProperties;
+		vkelTable.EnumerateDeviceLayerProperties = vkelRecordEnumerateDeviceLayerProperties;
+	}
+	if (vkelTable.GetPhysicalDeviceSparseImageFormatProperties && (vkelTable.GetPhysicalDeviceSparseImageFormatProperties != vkelRecordGetPhysicalDeviceSparseImageFormatProperties) && !vkelIsStub(&vkelTable, GetPhysicalDeviceSparseImageFormatProperties))
+	{
+		vkelRecordedGetPhysicalDeviceSparseImageFormatProperties = vkelTable.GetPhysicalDeviceSparseImageFormatProperties;
+		vkelTable.GetPhysicalDeviceSparseImageFormatProperties = vkelRecordGetPhysicalDeviceSparseImageFormatProperties;
+	}
+	if (vkelTable.DestroySurfaceKHR && (vkelTable.DestroySurfaceKHR != vkelRecordDestroySurfaceKHR) && !vkelIsStub(&vkelTable, DestroySurfaceKHR))
+	{
+		vkelRecordedDestroySurfaceKHR = vkelTable.DestroySurfaceKHR;
+		vkelTable.DestroySurfaceKHR = vkelRecordDestroySurfaceKHR;
+	}
+	if (vkelTable.GetPhysicalDeviceSurfaceSupportKHR && (vkelTable.GetPhysicalDeviceSurfaceSupportKHR != vkelRecordGetPhysicalDeviceSurfaceSupportKHR) && !vkelIsStub(&vkelTable, GetPhysicalDeviceSurfaceSupportKHR))
+	{
+		vkelRecordedGetPhysicalDeviceSurfaceSupportKHR = vkelTable.GetPhysicalDeviceSurfaceSupportKHR;
+		vkelTable.GetPhysicalDeviceSurfaceSupportKHR = vkelRecordGetPhysicalDeviceSurfaceSupportKHR;
+	}
+	if (vkelTable.GetPhysicalDeviceSurfaceCapabilitiesKHR && (vkelTable.GetPhysicalDeviceSurfaceCapabilitiesKHR != vkelRecordGetPhysicalDeviceSurfaceCapabilitiesKHR) && !vkelIsStub(&vkelTable, GetPhysicalDeviceSurfaceCapabilitiesKHR))
+	{
+		vkelRecordedGetPhysicalDeviceSurfaceCapabilitiesKHR = vkelTable.GetPhysicalDeviceSurfaceCapabilitiesKHR;
+		vkelTable.GetPhysicalDeviceSurfaceCapabilitiesKHR = vkelRecordGetPhysicalDeviceSurfaceCapabilitiesKHR;
+	}
+	if (vkelTable.GetPhysicalDeviceSurfaceFormatsKHR && (vkelTable.GetPhysicalDeviceSurfaceFormatsKHR != vkelRecordGetPhysicalDeviceSurfaceFormatsKHR) && !vkelIsStub(&vkelTable, GetPhysicalDeviceSurfaceFormatsKHR))
+	{
+		vkelRecordedGetPhysicalDeviceSurfaceFormatsKHR = vkelTable.GetPhysicalDeviceSurfaceFormatsKHR;
+		vkelTable.GetPhysicalDeviceSurfaceFormatsKHR = vkelRecordGetPhysicalDeviceSurfaceFormatsKHR;
+	}
+	if (vkelTable.GetPhysicalDeviceSurfacePresentModesKHR && (vkelTable.GetPhysicalDeviceSurfacePresentModesKHR != vkelRecordGetPhysicalDeviceSurfacePresentModesKHR) && !vkelIsStub(&vkelTable, GetPhysicalDeviceSurfacePresentModesKHR))
+	{
+		vkelRecordedGetPhysicalDeviceSurfacePresentModesKHR = vkelTable.GetPhysicalDeviceSurfacePresentModesKHR;
+		vkelTable.GetPhysicalDeviceSurfacePresentModesKHR = vkelRecordGetPhysicalDeviceSurfacePresentModesKHR;
+	}
+	if (vkelTable.GetPhysicalDeviceDisplayPropertiesKHR && (vkelTable.GetPhysicalDeviceDisplayPropertiesKHR != vkelRecordGetPhysicalDeviceDisplayPropertiesKHR) && !vkelIsStub(&vkelTable, GetPhysicalDeviceDisplayPropertiesKHR))
+	{
+		vkelRecordedGetPhysicalDeviceDisplayPropertiesKHR = vkelTable.GetPhysicalDeviceDisplayPropertiesKHR;
+		vkelTable.GetPhysicalDeviceDisplayPropertiesKHR = vkelRecordGetPhysicalDeviceDisplayPropertiesKHR;
+	}
+	if (vkelTable.GetPhysicalDeviceDisplayPlanePropertiesKHR && (vkelTable.GetPhysicalDeviceDisplayPlanePropertiesKHR != vkelRecordGetPhysicalDeviceDisplayPlanePropertiesKHR) && !vkelIsStub(&vkelTable, GetPhysicalDeviceDisplayPlanePropertiesKHR))
+	{
+		vkelRecordedGetPhysicalDeviceDisplayPlanePropertiesKHR = vkelTable.GetPhysicalDeviceDisplayPlanePropertiesKHR;
+		vkelTable.GetPhysicalDeviceDisplayPlanePropertiesKHR = vkelRecordGetPhysicalDeviceDisplayPlanePropertiesKHR;
+	}
+	if (vkelTable.GetDisplayPlaneSupportedDisplaysKHR && (vkelTable.GetDisplayPlaneSupportedDisplaysKHR != vkelRecordGetDisplayPlaneSupportedDisplaysKHR) && !vkelIsStub(&vkelTable, GetDisplayPlaneSupportedDisplaysKHR))
+	{
+		vkelRecordedGetDisplayPlaneSupportedDisplaysKHR = vkelTable.GetDisplayPlaneSupportedDisplaysKHR;
+		vkelTable.GetDisplayPlaneSupportedDisplaysKHR = vkelRecordGetDisplayPlaneSupportedDisplaysKHR;
+	}
+	if (vkelTable.GetDisplayModePropertiesKHR && (vkelTable.GetDisplayModePropertiesKHR != vkelRecordGetDisplayModePropertiesKHR) && !vkelIsStub(&vkelTable, GetDisplayModePropertiesKHR))
+	{
+		vkelRecordedGetDisplayModePropertiesKHR = vkelTable.GetDisplayModePropertiesKHR;
+		vkelTable.GetDisplayModePropertiesKHR = vkelRecordGetDisplayModePropertiesKHR;
+	}
+	if (vkelTable.CreateDisplayModeKHR && (vkelTable.CreateDisplayModeKHR != vkelRecordCreateDisplayModeKHR) && !vkelIsStub(&vkelTable, CreateDisplayModeKHR))
+	{
+		vkelRecordedCreateDisplayModeKHR = vkelTable.CreateDisplayModeKHR;
+		vkelTable.CreateDisplayModeKHR = vkelRecordCreateDisplayModeKHR;
+	}
+	if (vkelTable.GetDisplayPlaneCapabilitiesKHR && (vkelTable.GetDisplayPlaneCapabilitiesKHR != vkelRecordGetDisplayPlaneCapabilitiesKHR) && !vkelIsStub(&vkelTable, GetDisplayPlaneCapabilitiesKHR))
+	{
+		vkelRecordedGetDisplayPlaneCapabilitiesKHR = vkelTable.GetDisplayPlaneCapabilitiesKHR;
+		vkelTable.GetDisplayPlaneCapabilitiesKHR = vkelRecordGetDisplayPlaneCapabilitiesKHR;
+	}
+	if (vkelTable.CreateDisplayPlaneSurfaceKHR && (vkelTable.CreateDisplayPlaneSurfaceKHR != vkelRecordCreateDisplayPlaneSurfaceKHR) && !vkelIsStub(&vkelTable, CreateDisplayPlaneSurfaceKHR))
+	{
+		vkelRecordedCreateDisplayPlaneSurfaceKHR = vkelTable.CreateDisplayPlaneSurfaceKHR;
+		vkelTable.CreateDisplayPlaneSurfaceKHR = vkelRecordCreateDisplayPlaneSurfaceKHR;
+	}
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+	if (vkelTable.CreateXlibSurfaceKHR && (vkelTable.CreateXlibSurfaceKHR != vkelRecordCreateXlibSurfaceKHR) && !vkelIsStub(&vkelTable, CreateXlibSurfaceKHR))
+	{
+		vkelRecordedCreateXlibSurfaceKHR = vkelTable.CreateXlibSurfaceKHR;
+		vkelTable.CreateXlibSurfaceKHR = vkelRecordCreateXlibSurfaceKHR;
+	}
+#endif /* VK_USE_PLATFORM_XLIB_KHR */
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+	if (vkelTable.GetPhysicalDeviceXlibPresentationSupportKHR && (vkelTable.GetPhysicalDeviceXlibPresentationSupportKHR != vkelRecordGetPhysicalDeviceXlibPresentationSupportKHR) && !vkelIsStub(&vkelTable, GetPhysicalDeviceXlibPresentationSupportKHR))
+	{
+		vkelRecordedGetPhysicalDeviceXlibPresentationSupportKHR = vkelTable.GetPhysicalDeviceXlibPresentationSupportKHR;
+		vkelTable.GetPhysicalDeviceXlibPresentationSupportKHR = vkelRecordGetPhysicalDeviceXlibPresentationSupportKHR;
+	}
+#endif /* VK_USE_PLATFORM_XLIB_KHR */
+#ifdef VK_USE_PLATFORM_XCB_KHR
+	if (vkelTable.CreateXcbSurfaceKHR && (vkelTable.CreateXcbSurfaceKHR != vkelRecordCreateXcbSurfaceKHR) && !vkelIsStub(&vkelTable, CreateXcbSurfaceKHR))
+	{
+		vkelRecordedCreateXcbSurfaceKHR = vkelTable.CreateXcbSurfaceKHR;
+		vkelTable.CreateXcbSurfaceKHR = vkelRecordCreateXcbSurfaceKHR;
+	}
+#endif /* VK_USE_PLATFORM_XCB_KHR */
+#ifdef VK_USE_PLATFORM_XCB_KHR
+	if (vkelTable.GetPhysicalDeviceXcbPresentationSupportKHR && (vkelTable.GetPhysicalDeviceXcbPresentationSupportKHR != vkelRecordGetPhysicalDeviceXcbPresentationSupportKHR) && !vkelIsStub(&vkelTable, GetPhysicalDeviceXcbPresentationSupportKHR))
+	{
+		vkelRecordedGetPhysicalDeviceXcbPresentationSupportKHR = vkelTable.GetPhysicalDeviceXcbPresentationSupportKHR;
+		vkelTable.GetPhysicalDeviceXcbPresentationSupportKHR = vkelRecordGetPhysicalDeviceXcbPresentationSupportKHR;
+	}
+#endif /* VK_USE_PLATFORM_XCB_KHR */
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+	if (vkelTable.CreateWaylandSurfaceKHR && (vkelTable.CreateWaylandSurfaceKHR != vkelRecordCreateWaylandSurfaceKHR) && !vkelIsStub(&vkelTable, CreateWaylandSurfaceKHR))
+	{
+		vkelRecordedCreateWaylandSurfaceKHR = vkelTable.CreateWaylandSurfaceKHR;
+		vkelTable.CreateWaylandSurfaceKHR = vkelRecordCreateWaylandSurfaceKHR;
+	}
+#endif /* VK_USE_PLATFORM_WAYLAND_KHR */
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+	if (vkelTable.GetPhysicalDeviceWaylandPresentationSupportKHR && (vkelTable.GetPhysicalDeviceWaylandPresentationSupportKHR != vkelRecordGetPhysicalDeviceWaylandPresentationSupportKHR) && !vkelIsStub(&vkelTable, GetPhysicalDeviceWaylandPresentationSupportKHR))
+	{
+		vkelRecordedGetPhysicalDeviceWaylandPresentationSupportKHR = vkelTable.GetPhysicalDeviceWaylandPresentationSupportKHR;
+		vkelTable.GetPhysicalDeviceWaylandPresentationSupportKHR = vkelRecordGetPhysicalDeviceWaylandPresentationSupportKHR;
+	}
+#endif /* VK_USE_PLATFORM_WAYLAND_KHR */
+#ifdef VK_USE_PLATFORM_MIR_KHR
+	if (vkelTable.CreateMirSurfaceKHR && (vkelTable.CreateMirSurfaceKHR != vkelRecordCreateMirSurfaceKHR) && !vkelIsStub(&vkelTable, CreateMirSurfaceKHR))
+	{
+		vkelRecordedCreateMirSurfaceKHR = vkelTable.CreateMirSurfaceKHR;
+		vkelTable.CreateMirSurfaceKHR = vkelRecordCreateMirSurfaceKHR;
+	}
+#endif /* VK_USE_PLATFORM_MIR_KHR */
+#ifdef VK_USE_PLATFORM_MIR_KHR
+	if (vkelTable.GetPhysicalDeviceMirPresentationSupportKHR && (vkelTable.GetPhysicalDeviceMirPresentationSupportKHR != vkelRecordGetPhysicalDeviceMirPresentationSupportKHR) && !vkelIsStub(&vkelTable, GetPhysicalDeviceMirPresentationSupportKHR))
+	{
+		vkelRecordedGetPhysicalDeviceMirPresentationSupportKHR = vkelTable.GetPhysicalDeviceMirPresentationSupportKHR;
+		vkelTable.GetPhysicalDeviceMirPresentationSupportKHR = vkelRecordGetPhysicalDeviceMirPresentationSupportKHR;
+	}
+#endif /* VK_USE_PLATFORM_MIR_KHR */
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+	if (vkelTable.CreateAndroidSurfaceKHR && (vkelTable.CreateAndroidSurfaceKHR != vkelRecordCreateAndroidSurfaceKHR) && !vkelIsStub(&vkelTable, CreateAndroidSurfaceKHR))
+	{
+		vkelRecordedCreateAndroidSurfaceKHR = vkelTable.CreateAndroidSurfaceKHR;
+		vkelTable.CreateAndroidSurfaceKHR = vkelRecordCreateAndroidSurfaceKHR;
+	}
+#endif /* VK_USE_PLATFORM_ANDROID_KHR */
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+	if (vkelTable.CreateWin32SurfaceKHR && (vkelTable.CreateWin32SurfaceKHR != vkelRecordCreateWin32SurfaceKHR) && !vkelIsStub(&vkelTable, CreateWin32SurfaceKHR))
+	{
+		vkelRecordedCreateWin32SurfaceKHR = vkelTable.CreateWin32SurfaceKHR;
+		vkelTable.CreateWin32SurfaceKHR = vkelRecordCreateWin32SurfaceKHR;
+	}
+#endif /* VK_USE_PLATFORM_WIN32_KHR */
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+	if (vkelTable.GetPhysicalDeviceWin32PresentationSupportKHR && (vkelTable.GetPhysicalDeviceWin32PresentationSupportKHR != vkelRecordGetPhysicalDeviceWin32PresentationSupportKHR) && !vkelIsStub(&vkelTable, GetPhysicalDeviceWin32PresentationSupportKHR))
+	{
+		vkelRecordedGetPhysicalDeviceWin32PresentationSupportKHR = vkelTable.GetPhysicalDeviceWin32PresentationSupportKHR;
+		vkelTable.GetPhysicalDeviceWin32PresentationSupportKHR = vkelRecordGetPhysicalDeviceWin32PresentationSupportKHR;
+	}
+#endif /* VK_USE_PLATFORM_WIN32_KHR */
+	if (vkelTable.CreateDebugReportCallbackEXT && (vkelTable.CreateDebugReportCallbackEXT != vkelRecordCreateDebugReportCallbackEXT) && !vkelIsStub(&vkelTable, CreateDebugReportCallbackEXT))
+	{
+		vkelRecordedCreateDebugReportCallbackEXT = vkelTable.CreateDebugReportCallbackEXT;
+		vkelTable.CreateDebugReportCallbackEXT = vkelRecordCreateDebugReportCallbackEXT;
+	}
+	if (vkelTable.DestroyDebugReportCallbackEXT && (vkelTable.DestroyDebugReportCallbackEXT != vkelRecordDestroyDebugReportCallbackEXT) && !vkelIsStub(&vkelTable, DestroyDebugReportCallbackEXT))
+	{
+		vkelRecordedDestroyDebugReportCallbackEXT = vkelTable.DestroyDebugReportCallbackEXT;
+		vkelTable.DestroyDebugReportCallbackEXT = vkelRecordDestroyDebugReportCallbackEXT;
+	}
+	if (vkelTable.DebugReportMessageEXT && (vkelTable.DebugReportMessageEXT != vkelRecordDebugReportMessageEXT) && !vkelIsStub(&vkelTable, DebugReportMessageEXT))
+	{
+		vkelRecordedDebugReportMessageEXT = vkelTable.DebugReportMessageEXT;
+		vkelTable.DebugReportMessageEXT = vkelRecordDebugReportMessageEXT;
+	}
+}
+
+// Fills the table the device level vk* macros call through, kept along with pTable
+static void vkelRecordDeviceUsageProcs(const VkelDeviceTable *pTable, VkelDeviceTable *pRecordTable)
+{
+	*pRecordTable = *pTable;
+	
+	if (pTable->DestroyDevice && !vkelIsStub(pTable, DestroyDevice))
+		pRecordTable->DestroyDevice = vkelRecordDestroyDevice;
+	if (pTable->GetDeviceQueue && !vkelIsStub(pTable, GetDeviceQueue))
+		pRecordTable->GetDeviceQueue = vkelRecordGetDeviceQueue;
+	if (pTable->QueueSubmit && !vkelIsStub(pTable, QueueSubmit))
+		pRecordTable->QueueSubmit = vkelRecordQueueSubmit;
+	if (pTable->QueueWaitIdle && !vkelIsStub(pTable, QueueWaitIdle))
+		pRecordTable->QueueWaitIdle = vkelRecordQueueWaitIdle;
+	if (pTable->DeviceWaitIdle && !vkelIsStub(pTable, DeviceWaitIdle))
+		pRecordTable->DeviceWaitIdle = vkelRecordDeviceWaitIdle;
+	if (pTable->AllocateMemory && !vkelIsStub(pTable, AllocateMemory))
+		pRecordTable->AllocateMemory = vkelRecordAllocateMemory;
+	if (pTable->FreeMemory && !vkelIsStub(pTable, FreeMemory))
+		pRecordTable->FreeMemory = vkelRecordFreeMemory;
+	if (pTable->MapMemory && !vkelIsStub(pTable, MapMemory))
+		pRecordTable->MapMemory = vkelRecordMapMemory;
+	if (pTable->UnmapMemory && !vkelIsStub(pTable, UnmapMemory))
+		pRecordTable->UnmapMemory = vkelRecordUnmapMemory;
+	if (pTable->FlushMappedMemoryRanges && !vkelIsStub(pTable, FlushMappedMemoryRanges))
+		pRecordTable->FlushMappedMemoryRanges = vkelRecordFlushMappedMemoryRanges;
+	if (pTable->InvalidateMappedMemoryRanges && !vkelIsStub(pTable, InvalidateMappedMemoryRanges))
+		pRecordTable->InvalidateMappedMemoryRanges = vkelRecordInvalidateMappedMemoryRanges;
+	if (pTable->GetDeviceMemoryCommitment && !vkelIsStub(pTable, GetDeviceMemoryCommitment))
+		pRecordTable->GetDeviceMemoryCommitment = vkelRecordGetDeviceMemoryCommitment;
+	if (pTable->BindBufferMemory && !vkelIsStub(pTable, BindBufferMemory))
+		pRecordTable->BindBufferMemory = vkelRecordBindBufferMemory;
+	if (pTable->BindImageMemory && !vkelIsStub(pTable, BindImageMemory))
+		pRecordTable->BindImageMemory = vkelRecordBindImageMemory;
+	if (pTable->GetBufferMemoryRequirements && !vkelIsStub(pTable, GetBufferMemoryRequirements))
+		pRecordTable->GetBufferMemoryRequirements = vkelRecordGetBufferMemoryRequirements;
+	if (pTable->GetImageMemoryRequirements && !vkelIsStub(pTable, GetImageMemoryRequirements))
+		pRecordTable->GetImageMemoryRequirements = vkelRecordGetImageMemoryRequirements;
+	if (pTable->GetImageSparseMemoryRequirements && !vkelIsStub(pTable, GetImageSparseMemoryRequirements))
+		pRecordTable->GetImageSparseMemoryRequirements = vkelRecordGetImageSparseMemoryRequirements;
+	if (pTable->QueueBindSparse && !vkelIsStub(pTable, QueueBindSparse))
+		pRecordTable->QueueBindSparse = vkelRecordQueueBindSparse;
+	if (pTable->CreateFence && !vkelIsStub(pTable, CreateFence))
+		pRecordTable->CreateFence = vkelRecordCreateFence;
+	if (pTable->DestroyFence && !vkelIsStub(pTable, DestroyFence))
+		pRecordTable->DestroyFence = vkelRecordDestroyFence;
+	if (pTable->ResetFences && !vkelIsStub(pTable, ResetFences))
+		pRecordTable->ResetFences = vkelRecordResetFences;
+	if (pTable->GetFenceStatus && !vkelIsStub(pTable, GetFenceStatus))
+		pRecordTable->GetFenceStatus = vkelRecordGetFenceStatus;
+	if (pTable->WaitForFences && !vkelIsStub(pTable, WaitForFences))
+		pRecordTable->WaitForFences = vkelRecordWaitForFences;
+	if (pTable->CreateSemaphore && !vkelIsStub(pTable, CreateSemaphore))
+		pRecordTable->CreateSemaphore = vkelRecordCreateSemaphore;
+	if (pTable->DestroySemaphore && !vkelIsStub(pTable, DestroySemaphore))
+		pRecordTable->DestroySemaphore = vkelRecordDestroySemaphore;
+	if (pTable->CreateEvent && !vkelIsStub(pTable, CreateEvent))
+		pRecordTable->CreateEvent = vkelRecordCreateEvent;
+	if (pTable->DestroyEvent && !vkelIsStub(pTable, DestroyEvent))
+		pRecordTable->DestroyEvent = vkelRecordDestroyEvent;
+	if (pTable->GetEventStatus && !vkelIsStub(pTable, GetEventStatus))
+		pRecordTable->GetEventStatus = vkelRecordGetEventStatus;
+	if (pTable->SetEvent && !vkelIsStub(pTable, SetEvent))
+		pRecordTable->SetEvent = vkelRecordSetEvent;
+	if (pTable->ResetEvent && !vkelIsStub(pTable, ResetEvent))
+		pRecordTable->ResetEvent = vkelRecordResetEvent;
+	if (pTable->CreateQueryPool && !vkelIsStub(pTable, CreateQueryPool))
+		pRecordTable->CreateQueryPool = vkelRecordCreateQueryPool;
+	if (pTable->DestroyQueryPool && !vkelIsStub(pTable, DestroyQueryPool))
+		pRecordTable->DestroyQueryPool = vkelRecordDestroyQueryPool;
+	if (pTable->GetQueryPoolResults && !vkelIsStub(pTable, GetQueryPoolResults))
+		pRecordTable->GetQueryPoolResults = vkelRecordGetQueryPoolResults;
+	if (pTable->CreateBuffer && !vkelIsStub(pTable, CreateBuffer))
+		pRecordTable->CreateBuffer = vkelRecordCreateBuffer;
+	if (pTable->DestroyBuffer && !vkelIsStub(pTable, DestroyBuffer))
+		pRecordTable->DestroyBuffer = vkelRecordDestroyBuffer;
+	if (pTable->CreateBufferView && !vkelIsStub(pTable, CreateBufferView))
+		pRecordTable->CreateBufferView = vkelRecordCreateBufferView;
+	if (pTable->DestroyBufferView && !vkelIsStub(pTable, DestroyBufferView))
+		pRecordTable->DestroyBufferView = vkelRecordDestroyBufferView;
+	if (pTable->CreateImage && !vkelIsStub(pTable, CreateImage))
+		pRecordTable->CreateImage = vkelRecordCreateImage;
+	if (pTable->DestroyImage && !vkelIsStub(pTable, DestroyImage))
+		pRecordTable->DestroyImage = vkelRecordDestroyImage;
+	if (pTable->GetImageSubresourceLayout && !vkelIsStub(pTable, GetImageSubresourceLayout))
+		pRecordTable->GetImageSubresourceLayout = vkelRecordGetImageSubresourceLayout;
+	if (pTable->CreateImageView && !vkelIsStub(pTable, CreateImageView))
+		pRecordTable->CreateImageView = vkelRecordCreateImageView;
+	if (pTable->DestroyImageView && !vkelIsStub(pTable, DestroyImageView))
+		pRecordTable->DestroyImageView = vkelRecordDestroyImageView;
+	if (pTable->CreateShaderModule && !vkelIsStub(pTable, CreateShaderModule))
+		pRecordTable->CreateShaderModule = vkelRecordCreateShaderModule;
+	if (pTable->DestroyShaderModule && !vkelIsStub(pTable, DestroyShaderModule))
+		pRecordTable->DestroyShaderModule = vkelRecordDestroyShaderModule;
+	if (pTable->CreatePipelineCache && !vkelIsStub(pTable, CreatePipelineCache))
+		pRecordTable->CreatePipelineCache = vkelRecordCreatePipelineCache;
+	if (pTable->DestroyPipelineCache && !vkelIsStub(pTable, DestroyPipelineCache))
+		pRecordTable->DestroyPipelineCache = vkelRecordDestroyPipelineCache;
+	if (pTable->GetPipelineCacheData && !vkelIsStub(pTable, GetPipelineCacheData))
+		pRecordTable->GetPipelineCacheData = vkelRecordGetPipelineCacheData;
+	if (pTable->MergePipelineCaches && !vkelIsStub(pTable, MergePipelineCaches))
+		pRecordTable->MergePipelineCaches = vkelRecordMergePipelineCaches;
+	if (pTable->CreateGraphicsPipelines && !vkelIsStub(pTable, CreateGraphicsPipelines))
+		pRecordTable->CreateGraphicsPipelines = vkelRecordCreateGraphicsPipelines;
+	if (pTable->CreateComputePipelines && !vkelIsStub(pTable, CreateComputePipelines))
+		pRecordTable->CreateComputePipelines = vkelRecordCreateComputePipelines;
+	if (pTable->DestroyPipeline && !vkelIsStub(pTable, DestroyPipeline))
+		pRecordTable->DestroyPipeline = vkelRecordDestroyPipeline;
+	if (pTable->CreatePipelineLayout && !vkelIsStub(pTable, CreatePipelineLayout))
+		pRecordTable->CreatePipelineLayout = vkelRecordCreatePipelineLayout;
+	if (pTable->DestroyPipelineLayout && !vkelIsStub(pTable, DestroyPipelineLayout))
+		pRecordTable->DestroyPipelineLayout = vkelRecordDestroyPipelineLayout;
+	if (pTable->CreateSampler && !vkelIsStub(pTable, CreateSampler))
+		pRecordTable->CreateSampler = vkelRecordCreateSampler;
+	if (pTable->DestroySampler && !vkelIsStub(pTable, DestroySampler))
+		pRecordTable->DestroySampler = vkelRecordDestroySampler;
+	if (pTable->CreateDescriptorSetLayout && !vkelIsStub(pTable, CreateDescriptorSetLayout))
+		pRecordTable->CreateDescriptorSetLayout = vkelRecordCreateDescriptorSetLayout;
+	if (pTable->DestroyDescriptorSetLayout && !vkelIsStub(pTable, DestroyDescriptorSetLayout))
+		pRecordTable->DestroyDescriptorSetLayout = vkelRecordDestroyDescriptorSetLayout;
+	if (pTable->CreateDescriptorPool && !vkelIsStub(pTable, CreateDescriptorPool))
+		pRecordTable->CreateDescriptorPool = vkelRecordCreateDescriptorPool;
+	if (pTable->DestroyDescriptorPool && !vkelIsStub(pTable, DestroyDescriptorPool))
+		pRecordTable->DestroyDescriptorPool = vkelRecordDestroyDescriptorPool;
+	if (pTable->ResetDescriptorPool && !vkelIsStub(pTable, ResetDescriptorPool))
+		pRecordTable->ResetDescriptorPool = vkelRecordResetDescriptorPool;
+	if (pTable->AllocateDescriptorSets && !vkelIsStub(pTable, AllocateDescriptorSets))
+		pRecordTable->AllocateDescriptorSets = vkelRecordAllocateDescriptorSets;
+	if (pTable->FreeDescriptorSets && !vkelIsStub(pTable, FreeDescriptorSets))
+		pRecordTable->FreeDescriptorSets = vkelRecordFreeDescriptorSets;
+	if (pTable->UpdateDescriptorSets && !vkelIsStub(pTable, UpdateDescriptorSets))
+		pRecordTable->UpdateDescriptorSets = vkelRecordUpdateDescriptorSets;
+	if (pTable->CreateFramebuffer && !vkelIsStub(pTable, CreateFramebuffer))
+		pRecordTable->CreateFramebuffer = vkelRecordCreateFramebuffer;
+	if (pTable->DestroyFramebuffer && !vkelIsStub(pTable, DestroyFramebuffer))
+		pRecordTable->DestroyFramebuffer = vkelRecordDestroyFramebuffer;
+	if (pTable->CreateRenderPass && !vkelIsStub(pTable, CreateRenderPass))
+		pRecordTable->CreateRenderPass = vkelRecordCreateRenderPass;
+	if (pTable->DestroyRenderPass && !vkelIsStub(pTable, DestroyRenderPass))
+		pRecordTable->DestroyRenderPass = vkelRecordDestroyRenderPass;
+	if (pTable->GetRenderAreaGranularity && !vkelIsStub(pTable, GetRenderAreaGranularity))
+		pRecordTable->GetRenderAreaGranularity = vkelRecordGetRenderAreaGranularity;
+	if (pTable->CreateCommandPool && !vkelIsStub(pTable, CreateCommandPool))
+		pRecordTable->CreateCommandPool = vkelRecordCreateCommandPool;
+	if (pTable->DestroyCommandPool && !vkelIsStub(pTable, DestroyCommandPool))
+		pRecordTable->DestroyCommandPool = vkelRecordDestroyCommandPool;
+	if (pTable->ResetCommandPool && !vkelIsStub(pTable, ResetCommandPool))
+		pRecordTable->ResetCommandPool = vkelRecordResetCommandPool;
+	if (pTable->AllocateCommandBuffers && !vkelIsStub(pTable, AllocateCommandBuffers))
+		pRecordTable->AllocateCommandBuffers = vkelRecordAllocateCommandBuffers;
+	if (pTable->FreeCommandBuffers && !vkelIsStub(pTable, FreeCommandBuffers))
+		pRecordTable->FreeCommandBuffers = vkelRecordFreeCommandBuffers;
+	if (pTable->BeginCommandBuffer && !vkelIsStub(pTable, BeginCommandBuffer))
+		pRecordTable->BeginCommandBuffer = vkelRecordBeginCommandBuffer;
+	if (pTable->EndCommandBuffer && !vkelIsStub(pTable, EndCommandBuffer))
+		pRecordTable->EndCommandBuffer = vkelRecordEndCommandBuffer;
+	if (pTable->ResetCommandBuffer && !vkelIsStub(pTable, ResetCommandBuffer))
+		pRecordTable->ResetCommandBuffer = vkelRecordResetCommandBuffer;
+	if (pTable->CmdBindPipeline && !vkelIsStub(pTable, CmdBindPipeline))
+		pRecordTable->CmdBindPipeline = vkelRecordCmdBindPipeline;
+	if (pTable->CmdSetViewport && !vkelIsStub(pTable, CmdSetViewport))
+		pRecordTable->CmdSetViewport = vkelRecordCmdSetViewport;
+	if (pTable->CmdSetScissor && !vkelIsStub(pTable, CmdSetScissor))
+		pRecordTable->CmdSetScissor = vkelRecordCmdSetScissor;
+	if (pTable->CmdSetLineWidth && !vkelIsStub(pTable, CmdSetLineWidth))
+		pRecordTable->CmdSetLineWidth = vkelRecordCmdSetLineWidth;
+	if (pTable->CmdSetDepthBias && !vkelIsStub(pTable, CmdSetDepthBias))
+		pRecordTable->CmdSetDepthBias = vkelRecordCmdSetDepthBias;
+	if (pTable->CmdSetBlendConstants && !vkelIsStub(pTable, CmdSetBlendConstants))
+		pRecordTable->CmdSetBlendConstants = vkelRecordCmdSetBlendConstants;
+	if (pTable->CmdSetDepthBounds && !vkelIsStub(pTable, CmdSetDepthBounds))
+		pRecordTable->CmdSetDepthBounds = vkelRecordCmdSetDepthBounds;
+	if (pTable->CmdSetStencilCompareMask && !vkelIsStub(pTable, CmdSetStencilCompareMask))
+		pRecordTable->CmdSetStencilCompareMask = vkelRecordCmdSetStencilCompareMask;
+	if (pTable->CmdSetStencilWriteMask && !vkelIsStub(pTable, CmdSetStencilWriteMask))
+		pRecordTable->CmdSetStencilWriteMask = vkelRecordCmdSetStencilWriteMask;
+	if (pTable->CmdSetStencilReference && !vkelIsStub(pTable, CmdSetStencilReference))
+		pRecordTable->CmdSetStencilReference = vkelRecordCmdSetStencilReference;
+	if (pTable->CmdBindDescriptorSets && !vkelIsStub(pTable, CmdBindDescriptorSets))
+		pRecordTable->CmdBindDescriptorSets = vkelRecordCmdBindDescriptorSets;
+	if (pTable->CmdBindIndexBuffer && !vkelIsStub(pTable, CmdBindIndexBuffer))
+		pRecordTable->CmdBindIndexBuffer = vkelRecordCmdBindIndexBuffer;
+	if (pTable->CmdBindVertexBuffers && !vkelIsStub(pTable, CmdBindVertexBuffers))
+		pRecordTable->CmdBindVertexBuffers = vkelRecordCmdBindVertexBuffers;
+	if (pTable->CmdDraw && !vkelIsStub(pTable, CmdDraw))
+		pRecordTable->CmdDraw = vkelRecordCmdDraw;
+	if (pTable->CmdDrawIndexed && !vkelIsStub(pTable, CmdDrawIndexed))
+		pRecordTable->CmdDrawIndexed = vkelRecordCmdDrawIndexed;
+	if (pTable->CmdDrawIndirect && !vkelIsStub(pTable, CmdDrawIndirect))
+		pRecordTable->CmdDrawIndirect = vkelRecordCmdDrawIndirect;
+	if (pTable->CmdDrawIndexedIndirect && !vkelIsStub(pTable, CmdDrawIndexedIndirect))
+		pRecordTable->CmdDrawIndexedIndirect = vkelRecordCmdDrawIndexedIndirect;
+	if (pTable->CmdDispatch && !vkelIsStub(pTable, CmdDispatch))
+		pRecordTable->CmdDispatch = vkelRecordCmdDispatch;
+	if (pTable->CmdDispatchIndirect && !vkelIsStub(pTable, CmdDispatchIndirect))
+		pRecordTable->CmdDispatchIndirect = vkelRecordCmdDispatchIndirect;
+	if (pTable->CmdCopyBuffer && !vkelIsStub(pTable, CmdCopyBuffer))
+		pRecordTable->CmdCopyBuffer = vkelRecordCmdCopyBuffer;
+	if (pTable->CmdCopyImage && !vkelIsStub(pTable, CmdCopyImage))
+		pRecordTable->CmdCopyImage = vkelRecordCmdCopyImage;
+	if (pTable->CmdBlitImage && !vkelIsStub(pTable, CmdBlitImage))
+		pRecordTable->CmdBlitImage = vkelRecordCmdBlitImage;
+	if (pTable->CmdCopyBufferToImage && !vkelIsStub(pTable, CmdCopyBufferToImage))
+		pRecordTable->CmdCopyBufferToImage = vkelRecordCmdCopyBufferToImage;
+	if (pTable->CmdCopyImageToBuffer && !vkelIsStub(pTable, CmdCopyImageToBuffer))
+		pRecordTable->CmdCopyImageToBuffer = vkelRecordCmdCopyImageToBuffer;
+	if (pTable->CmdUpdateBuffer && !vkelIsStub(pTable, CmdUpdateBuffer))
+		pRecordTable->CmdUpdateBuffer = vkelRecordCmdUpdateBuffer;
+	if (pTable->CmdFillBuffer && !vkelIsStub(pTable, CmdFillBuffer))
+		pRecordTable->CmdFillBuffer = vkelRecordCmdFillBuffer;
+	if (pTable->CmdClearColorImage && !vkelIsStub(pTable, CmdClearColorImage))
+		pRecordTable->CmdClearColorImage = vkelRecordCmdClearColorImage;
+	if (pTable->CmdClearDepthStencilImage && !vkelIsStub(pTable, CmdClearDepthStencilImage))
+		pRecordTable->CmdClearDepthStencilImage = vkelRecordCmdClearDepthStencilImage;
+	if (pTable->CmdClearAttachments && !vkelIsStub(pTable, CmdClearAttachments))
+		pRecordTable->CmdClearAttachments = vkelRecordCmdClearAttachments;
+	if (pTable->CmdResolveImage && !vkelIsStub(pTable, CmdResolveImage))
+		pRecordTable->CmdResolveImage = vkelRecordCmdResolveImage;
+	if (pTable->CmdSetEvent && !vkelIsStub(pTable, CmdSetEvent))
+		pRecordTable->CmdSetEvent = vkelRecordCmdSetEvent;
+	if (pTable->CmdResetEvent && !vkelIsStub(pTable, CmdResetEvent))
+		pRecordTable->CmdResetEvent = vkelRecordCmdResetEvent;
+	if (pTable->CmdWaitEvents && !vkelIsStub(pTable, CmdWaitEvents))
+		pRecordTable->CmdWaitEvents = vkelRecordCmdWaitEvents;
+	if (pTable->CmdPipelineBarrier && !vkelIsStub(pTable, CmdPipelineBarrier))
+		pRecordTable->CmdPipelineBarrier = vkelRecordCmdPipelineBarrier;
+	if (pTable->CmdBeginQuery && !vkelIsStub(pTable, CmdBeginQuery))
+		pRecordTable->CmdBeginQuery = vkelRecordCmdBeginQuery;
+	if (pTable->CmdEndQuery && !vkelIsStub(pTable, CmdEndQuery))
+		pRecordTable->CmdEndQuery = vkelRecordCmdEndQuery;
+	if (pTable->CmdResetQueryPool && !vkelIsStub(pTable, CmdResetQueryPool))
+		pRecordTable->CmdResetQueryPool = vkelRecordCmdResetQueryPool;
+	if (pTable->CmdWriteTimestamp && !vkelIsStub(pTable, CmdWriteTimestamp))
+		pRecordTable->CmdWriteTimestamp = vkelRecordCmdWriteTimestamp;
+	if (pTable->CmdCopyQueryPoolResults && !vkelIsStub(pTable, CmdCopyQueryPoolResults))
+		pRecordTable->CmdCopyQueryPoolResults = vkelRecordCmdCopyQueryPoolResults;
+	if (pTable->CmdPushConstants && !vkelIsStub(pTable, CmdPushConstants))
+		pRecordTable->CmdPushConstants = vkelRecordCmdPushConstants;
+	if (pTable->CmdBeginRenderPass && !vkelIsStub(pTable, CmdBeginRenderPass))
+		pRecordTable->CmdBeginRenderPass = vkelRecordCmdBeginRenderPass;
+	if (pTable->CmdNextSubpass && !vkelIsStub(pTable, CmdNextSubpass))
+		pRecordTable->CmdNextSubpass = vkelRecordCmdNextSubpass;
+	if (pTable->CmdEndRenderPass && !vkelIsStub(pTable, CmdEndRenderPass))
+		pRecordTable->CmdEndRenderPass = vkelRecordCmdEndRenderPass;
+	if (pTable->CmdExecuteCommands && !vkelIsStub(pTable, CmdExecuteCommands))
+		pRecordTable->CmdExecuteCommands = vkelRecordCmdExecuteCommands;
+	if (pTable->CreateSwapchainKHR && !vkelIsStub(pTable, CreateSwapchainKHR))
+		pRecordTable->CreateSwapchainKHR = vkelRecordCreateSwapchainKHR;
+	if (pTable->DestroySwapchainKHR && !vkelIsStub(pTable, DestroySwapchainKHR))
+		pRecordTable->DestroySwapchainKHR = vkelRecordDestroySwapchainKHR;
+	if (pTable->GetSwapchainImagesKHR && !vkelIsStub(pTable, GetSwapchainImagesKHR))
+		pRecordTable->GetSwapchainImagesKHR = vkelRecordGetSwapchainImagesKHR;
+	if (pTable->AcquireNextImageKHR && !vkelIsStub(pTable, AcquireNextImageKHR))
+		pRecordTable->AcquireNextImageKHR = vkelRecordAcquireNextImageKHR;
+	if (pTable->QueuePresentKHR && !vkelIsStub(pTable, QueuePresentKHR))
+		pRecordTable->QueuePresentKHR = vkelRecordQueuePresentKHR;
+	if (pTable->CreateSharedSwapchainsKHR && !vkelIsStub(pTable, CreateSharedSwapchainsKHR))
+		pRecordTable->CreateSharedSwapchainsKHR = vkelRecordCreateSharedSwapchainsKHR;
+	if (pTable->DebugMarkerSetObjectTagEXT && !vkelIsStub(pTable, DebugMarkerSetObjectTagEXT))
+		pRecordTable->DebugMarkerSetObjectTagEXT = vkelRecordDebugMarkerSetObjectTagEXT;
+	if (pTable->DebugMarkerSetObjectNameEXT && !vkelIsStub(pTable, DebugMarkerSetObjectNameEXT))
+		pRecordTable->DebugMarkerSetObjectNameEXT = vkelRecordDebugMarkerSetObjectNameEXT;
+	if (pTable->CmdDebugMarkerBeginEXT && !vkelIsStub(pTable, CmdDebugMarkerBeginEXT))
+		pRecordTable->CmdDebugMarkerBeginEXT = vkelRecordCmdDebugMarkerBeginEXT;
+	if (pTable->CmdDebugMarkerEndEXT && !vkelIsStub(pTable, CmdDebugMarkerEndEXT))
+		pRecordTable->CmdDebugMarkerEndEXT = vkelRecordCmdDebugMarkerEndEXT;
+	if (pTable->CmdDebugMarkerInsertEXT && !vkelIsStub(pTable, CmdDebugMarkerInsertEXT))
+		pRecordTable->CmdDebugMarkerInsertEXT = vkelRecordCmdDebugMarkerInsertEXT;
+}
+
+#endif /* VKEL_RECORD_USAGE */
+
+
+static int vkel_strcmp(const char *str1, const char *str2)
+{
+	while (*str1 && (*str1 == *str2))
+	{
+		str1++, str2++;
+	}
+
+	return *(const unsigned char*) str1 - *(const unsigned char*) str2;
+}
+
+static void vkel_strpy(char *dest, const char *src)
+{
+	while (*dest++ = *src++);
+}
+
+
+PFN_vkVoidFunction vkelGetProcAddr(const char *name)
+{
+	// An ICD only exports vk_icdGetInstanceProcAddr, everything
+	// else (before vkelInstanceInit()) has to go through it
+	if (vkelIcdGetInstanceProcAddr)
+	{
+		if (!vkel_strcmp(name, "vkGetInstanceProcAddr"))
+			return (PFN_vkVoidFunction) vkelIcdGetInstanceProcAddr;
+		
+		return vkelIcdGetInstanceProcAddr(NULL, name);
+	}
+	
+	return (PFN_vkVoidFunction) vkelPlatformGetProcAddr(vkelVkLibHandle, name);
+}
+
+PFN_vkVoidFunction vkelGetInstanceProcAddr(VkInstance instance, const char *pName)
+{
+	PFN_vkVoidFunction proc = (PFN_vkVoidFunction) vkGetInstanceProcAddr(instance, pName);
+	
+	if (!proc)
+		proc = (PFN_vkVoidFunction) vkelGetProcAddr(pName);
+	
+	return proc;
+}
+
+PFN_vkVoidFunction vkelGetDeviceProcAddr(VkDevice device, const char *pName)
+{
+	PFN_vkVoidFunction proc = (PFN_vkVoidFunction) vkGetDeviceProcAddr(device, pName);
+	
+	if (!proc)
+		proc = (PFN_vkVoidFunction) vkelGetInstanceProcAddr(NULL, pName);
+	
+	return proc;
+}
+
+
+
+#define VKEL_ALLOCATION_ALIGNMENT 16
+
+static void* vkel_malloc(size_t size, VkSystemAllocationScope allocationScope)
+{
+	if (vkelAllocator)
+		return vkelAllocator->pfnAllocation(vkelAllocator->pUserData, size, VKEL_ALLOCATION_ALIGNMENT, allocationScope);
+	
+	return malloc(size);
+}
+
+static void* vkel_calloc(size_t count, size_t size, VkSystemAllocationScope allocationScope)
+{
+	if (!vkelAllocator)
+		return calloc(count, size);
+	
+	// Like calloc(), fail rather than allocate a wrapped around size
+	if (size && count > SIZE_MAX / size)
+		return NULL;
+	
+	void *memory = vkel_malloc(count * size, allocationScope);
+	
+	if (memory)
+		memset(memory, 0, count * size);
+	
+	return memory;
+}
+
+static void vkel_free(void *memory)
+{
+	if (vkelAllocator)
+		vkelAllocator->pfnFree(vkelAllocator->pUserData, memory);
+	else
+		free(memory);
+}
+
+
+void vkelSetAllocator(const VkAllocationCallbacks *pAllocator)
+{
+	if (!pAllocator)
+	{
+		vkelAllocator = NULL;
+		return;
+	}
+	
+	assert(pAllocator->pfnAllocation);
+	assert(pAllocator->pfnFree);
+	
+	// Copy the callbacks, so the caller doesn't have to keep them alive
+	vkelAllocationCallbacks = *pAllocator;
+	vkelAllocator = &vkelAllocationCallbacks;
+}
+
+const VkAllocationCallbacks* vkelGetAllocator(void)
+{
+	return vkelAllocator;
+}
+
+
+void vkelDeleteNames(uint32_t nameCount, char **names)
+{
+	// assert(names);
+	if (!names)
+		return;
+	
+	uint32_t nameIndex = 0;
+	for (nameIndex = 0; nameIndex < nameCount; nameIndex++)
+	{
+		// assert(names[nameIndex]);
+		if (!names[nameIndex])
+			continue;
+
+		vkel_free(names[nameIndex]);
+	}
+
+	vkel_free(names);
+}
+
+
+typedef struct VkelEnumeration
+{
+	struct VkelEnumeration *pNext;
+	
+	// VK_NULL_HANDLE for instance extensions and layers
+	VkPhysicalDevice physicalDevice;
+	// VkLayerProperties instead of VkExtensionProperties
+	VkBool32 layers;
+	// Empty when not enumerating the extensions of a specific layer
+	char layerName[VK_MAX_EXTENSION_NAME_SIZE];
+	
+	uint32_t propertyCount;
+	void *pProperties;
+	
+	// One for being in vkelEnumerations, and one per caller still reading the properties
+	uint32_t referenceCount;
+} VkelEnumeration;
+
+static VkelEnumeration *vkelEnumerations;
+
+// Changed by every invalidation, so results enumerated meanwhile aren't kept
+static uint32_t vkelEnumerationGeneration;
+
+static VkelPlatformMutex vkelEnumerationMutex = VKEL_PLATFORM_MUTEX_INITIALIZER;
+
+
+// The functions enumerating physical devices, for threads that can't read vkelTable
+// while another thread may be loading it (see vkelProbePhysicalDevicesAsync())
+typedef struct VkelEnumerateProcs
+{
+	PFN_vkEnumerateDeviceExtensionProperties enumerateDeviceExtensionProperties;
+	PFN_vkEnumerateDeviceLayerProperties enumerateDeviceLayerProperties;
+} VkelEnumerateProcs;
+
+// Calls through vkelTable when pProcs is NULL
+static VkResult vkelEnumerateProperties(VkPhysicalDevice physicalDevice, VkBool32 layers, const char *pLayerName, uint32_t *pPropertyCount, void *pProperties, const VkelEnumerateProcs *pProcs)
+{
+	if (physicalDevice && pProcs)
+	{
+		if (layers)
+			return pProcs->enumerateDeviceLayerProperties(physicalDevice, pPropertyCount, (VkLayerProperties*) pProperties);
+		
+		return pProcs->enumerateDeviceExtensionProperties(physicalDevice, pLayerName, pPropertyCount, (VkExtensionProperties*) pProperties);
+	}
+	
+	if (physicalDevice)
+	{
+		if (layers)
+			return vkEnumerateDeviceLayerProperties(physicalDevice, pPropertyCount, (VkLayerProperties*) pProperties);
+		
+		return vkEnumerateDeviceExtensionProperties(physicalDevice, pLayerName, pPropertyCount, (VkExtensionProperties*) pProperties);
+	}
+	
+	if (layers)
+		return vkEnumerateInstanceLayerProperties(pPropertyCount, (VkLayerProperties*) pProperties);
+	
+	return vkEnumerateInstanceExtensionProperties(pLayerName, pPropertyCount, (VkExtensionProperties*) pProperties);
+}
+
+static VkelEnumeration* vkelFindEnumeration(VkPhysicalDevice physicalDevice, VkBool32 layers, const char *pLayerName)
+{
+	VkelEnumeration *enumeration = vkelEnumerations;
+	
+	for (; enumeration; enumeration = enumeration->pNext)
+		if ((enumeration->physicalDevice == physicalDevice) && (enumeration->layers == layers) && !vkel_strcmp(enumeration->layerName, pLayerName))
+			return enumeration;
+	
+	return NULL;
+}
+
+// Called with vkelEnumerationMutex held
+static void vkelUnreferenceEnumeration(VkelEnumeration *enumeration)
+{
+	if (!--enumeration->referenceCount)
+		vkel_free(enumeration);
+}
+
+static void vkelReleaseEnumeration(VkelEnumeration *enumeration)
+{
+	if (!enumeration)
+		return;
+	
+	vkelPlatformLockMutex(&vkelEnumerationMutex);
+	
+	vkelUnreferenceEnumeration(enumeration);
+	
+	vkelPlatformUnlockMutex(&vkelEnumerationMutex);
+}
+
+// The results are kept until invalidated, while the returned properties stay valid (even
+// when invalidated by another thread) until *pEnumeration is passed to vkelReleaseEnumeration()
+static const void* vkelEnumerate(VkPhysicalDevice physicalDevice, VkBool32 layers, const char *pLayerName, uint32_t *propertyCount, VkelEnumeration **pEnumeration, const VkelEnumerateProcs *pProcs)
+{
+	(*pEnumeration) = NULL;
+	
+	if (!pLayerName)
+		pLayerName = "";
+	
+	// Can't be the name of a layer
+	if (strlen(pLayerName) >= VK_MAX_EXTENSION_NAME_SIZE)
+	{
+		(*propertyCount) = 0;
+		
+		return NULL;
+	}
+	
+	
+	vkelPlatformLockMutex(&vkelEnumerationMutex);
+	
+	VkelEnumeration *enumeration = vkelFindEnumeration(physicalDevice, layers, pLayerName);
+	
+	if (enumeration)
+		enumeration->referenceCount++;
+	
+	uint32_t generation = vkelEnumerationGeneration;
+	
+	vkelPlatformUnlockMutex(&vkelEnumerationMutex);
+	
+	if (enumeration)
+	{
+		(*pEnumeration) = enumeration;
+		(*propertyCount) = enumeration->propertyCount;
+		
+		return enumeration->pProperties;
+	}
+	
+	
+	// Enumerating happens without holding the lock, so different
+	// physical devices can be enumerated at the same time
+	const char *pEnumeratedLayerName = (*pLayerName) ? pLayerName : NULL;
+	const size_t propertySize = layers ? sizeof(VkLayerProperties) : sizeof(VkExtensionProperties);
+	
+	VkResult err;
+	
+	uint32_t count = 0;
+	
+	// Properties can be added between the two calls, in which case
+	// VK_INCOMPLETE is returned and the count is queried again
+	do
+	{
+		err = vkelEnumerateProperties(physicalDevice, layers, pEnumeratedLayerName, &count, NULL, pProcs);
+		
+		if (err < 0)
+		{
+			(*propertyCount) = 0;
+			
+			return NULL;
+		}
+		
+		enumeration = (VkelEnumeration*) vkel_calloc(1, sizeof(VkelEnumeration) + count * propertySize, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+		
+		if (!enumeration)
+		{
+			(*propertyCount) = 0;
+			
+			return NULL;
+		}
+		
+		enumeration->pProperties = count ? (void*) (enumeration + 1) : NULL;
+		
+		err = vkelEnumerateProperties(physicalDevice, layers, pEnumeratedLayerName, &count, enumeration->pProperties, pProcs);
+		
+		// Neither failures nor truncated lists are kept
+		if ((err < 0) || (err == VK_INCOMPLETE))
+		{
+			vkel_free(enumeration);
+			
+			if (err < 0)
+			{
+				(*propertyCount) = 0;
+				
+				return NULL;
+			}
+		}
+	}
+	while (err == VK_INCOMPLETE);
+	
+	enumeration->physicalDevice = physicalDevice;
+	enumeration->layers = layers;
+	vkel_strpy(enumeration->layerName, pLayerName);
+	
+	enumeration->propertyCount = count;
+	
+	
+	vkelPlatformLockMutex(&vkelEnumerationMutex);
+	
+	VkelEnumeration *existing = vkelFindEnumeration(physicalDevice, layers, pLayerName);
+	
+	// Enumerated by another thread in the meantime
+	if (existing)
+	{
+		vkel_free(enumeration);
+		enumeration = existing;
+		enumeration->referenceCount++;
+	}
+	// Or invalidated, when it may have been enumerated from before (like of a handle
+	// vkelInstanceInit() let go of), so it's only handed to the caller
+	else if (generation != vkelEnumerationGeneration)
+		enumeration->referenceCount = 1;
+	else
+	{
+		enumeration->pNext = vkelEnumerations;
+		enumeration->referenceCount = 2;
+		vkelEnumerations = enumeration;
+	}
+	
+	vkelPlatformUnlockMutex(&vkelEnumerationMutex);
+	
+	
+	(*pEnumeration) = enumeration;
+	(*propertyCount) = enumeration->propertyCount;
+	
+	return enumeration->pProperties;
+}
+
+
+void vkelInvalidateEnumerations(VkPhysicalDevice physicalDevice)
+{
+	vkelPlatformLockMutex(&vkelEnumerationMutex);
+	
+	vkelEnumerationGeneration++;
+	
+	VkelEnumeration **pEnumeration = &vkelEnumerations;
+	
+	while (*pEnumeration)
+	{
+		VkelEnumeration *enumeration = *pEnumeration;
+		
+		if (enumeration->physicalDevice == physicalDevice)
+		{
+			*pEnumeration = enumeration->pNext;
+			vkelUnreferenceEnumeration(enumeration);
+		}
+		else
+			pEnumeration = &enumeration->pNext;
+	}
+	
+	vkelPlatformUnlockMutex(&vkelEnumerationMutex);
+}
+
+// A new instance can hand out the handles of an earlier instance's physical
+// devices, so their results are dropped while the instance level ones are kept
+static void vkelInvalidatePhysicalDeviceEnumerations(void)
+{
+	vkelPlatformLockMutex(&vkelEnumerationMutex);
+	
+	vkelEnumerationGeneration++;
+	
+	VkelEnumeration **pEnumeration = &vkelEnumerations;
+	
+	while (*pEnumeration)
+	{
+		VkelEnumeration *enumeration = *pEnumeration;
+		
+		if (enumeration->physicalDevice != VK_NULL_HANDLE)
+		{
+			*pEnumeration = enumeration->pNext;
+			vkelUnreferenceEnumeration(enumeration);
+		}
+		else
+			pEnumeration = &enumeration->pNext;
+	}
+	
+	vkelPlatformUnlockMutex(&vkelEnumerationMutex);
+}
+
+void vkelInvalidateAllEnumerations(void)
+{
+	vkelPlatformLockMutex(&vkelEnumerationMutex);
+	
+	vkelEnumerationGeneration++;
+	
+	while (vkelEnumerations)
+	{
+		VkelEnumeration *enumeration = vkelEnumerations;
+		
+		vkelEnumerations = enumeration->pNext;
+		vkelUnreferenceEnumeration(enumeration);
+	}
+	
+	vkelPlatformUnlockMutex(&vkelEnumerationMutex);
+}
+
+
+static const VkExtensionProperties* vkelEnumerateInstanceExtensions(const char *pLayerName, uint32_t *extPropertyCount, VkelEnumeration **pEnumeration)
+{
+	return (const VkExtensionProperties*) vkelEnumerate(VK_NULL_HANDLE, VK_FALSE, pLayerName, extPropertyCount, pEnumeration, NULL);
+}
+
+static const VkLayerProperties* vkelEnumerateInstanceLayers(uint32_t *layerPropertyCount, VkelEnumeration **pEnumeration)
+{
+	return (const VkLayerProperties*) vkelEnumerate(VK_NULL_HANDLE, VK_TRUE, NULL, layerPropertyCount, pEnumeration, NULL);
+}
+
+
+static const VkExtensionProperties* vkelEnumerateDeviceExtensions(VkPhysicalDevice physicalDevice, const char *pLayerName, uint32_t *extPropertyCount, VkelEnumeration **pEnumeration)
+{
+	assert(physicalDevice);
+	
+	return (const VkExtensionProperties*) vkelEnumerate(physicalDevice, VK_FALSE, pLayerName, extPropertyCount, pEnumeration, NULL);
+}
+
+static const VkLayerProperties* vkelEnumerateDeviceLayers(VkPhysicalDevice physicalDevice, uint32_t *layerPropertyCount, VkelEnumeration **pEnumeration)
+{
+	assert(physicalDevice);
+	
+	return (const VkLayerProperties*) vkelEnumerate(physicalDevice, VK_TRUE, NULL, layerPropertyCount, pEnumeration, NULL);
+}
+
+
+// Both VkExtensionProperties and VkLayerProperties start with their name,
+// so the names are simply read every propertyStride bytes
+static char** vkelCopyNames(uint32_t nameCount, const char *pFirstName, size_t propertyStride)
+{
+	if (nameCount < 1)
+		return NULL;
+	
+	
+	char **names = (char**) vkel_calloc(nameCount, sizeof(char*), VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+	
+	// The allocator can fail (see vkelSetAllocator())
+	if (!names)
+		return NULL;
+	
+	uint32_t nameIndex = 0;
+	for (nameIndex = 0; nameIndex < nameCount; nameIndex++)
+	{
+		names[nameIndex] = (char*) vkel_calloc(VK_MAX_EXTENSION_NAME_SIZE, sizeof(char), VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+		
+		if (!names[nameIndex])
+		{
+			vkelDeleteNames(nameIndex, names);
+			return NULL;
+		}
+		
+		vkel_strpy(names[nameIndex], (char*) (pFirstName + nameIndex * propertyStride));
+	}
+	
+	
+	return names;
+}
+
+static uint32_t vkelMatchNames(uint32_t nameCount, const char* const *pNames, VkBool32 *pSupported, uint32_t propertyCount, const char *pFirstName, size_t propertyStride)
+{
+	uint32_t supportedCount = 0;
+	
+	uint32_t nameIndex = 0;
+	for (nameIndex = 0; nameIndex < nameCount; nameIndex++)
+	{
+		VkBool32 supported = VK_FALSE;
+		
+		uint32_t propertyIndex = 0;
+		for (propertyIndex = 0; propertyIndex < propertyCount; propertyIndex++)
+		{
+			if (!vkel_strcmp(pFirstName + propertyIndex * propertyStride, pNames[nameIndex]))
+			{
+				supported = VK_TRUE;
+				break;
+			}
+		}
+		
+		if (supported)
+			supportedCount++;
+		
+		if (pSupported)
+			pSupported[nameIndex] = supported;
+	}
+	
+	return supportedCount;
+}
+
+
+char** vkelGetInstanceExtensionNames(const char *pLayerName, uint32_t *extensionNameCount)
+{
+	assert(extensionNameCount);
+	
+	
+	VkelEnumeration *enumeration;
+	const VkExtensionProperties *extProperties = vkelEnumerateInstanceExtensions(pLayerName, extensionNameCount, &enumeration);
+	
+	char **extensionNames = extProperties ? vkelCopyNames((*extensionNameCount), extProperties->extensionName, sizeof(VkExtensionProperties)) : NULL;
+	
+	vkelReleaseEnumeration(enumeration);
+	
+	if (!extensionNames)
+		(*extensionNameCount) = 0;
+	
+	
+	return extensionNames;
+}
+
+char** vkelGetInstanceLayerNames(uint32_t *layerNameCount)
+{
+	assert(layerNameCount);
+	
+	
+	VkelEnumeration *enumeration;
+	const VkLayerProperties *layerProperties = vkelEnumerateInstanceLayers(layerNameCount, &enumeration);
+	
+	char **layerNames = layerProperties ? vkelCopyNames((*layerNameCount), layerProperties->layerName, sizeof(VkLayerProperties)) : NULL;
+	
+	vkelReleaseEnumeration(enumeration);
+	
+	if (!layerNames)
+		(*layerNameCount) = 0;
+	
+	
+	return layerNames;
+}
+
+
+char** vkelGetDeviceExtensionNames(VkPhysicalDevice physicalDevice, const char *pLayerName, uint32_t *extensionNameCount)
+{
+	assert(extensionNameCount);
+	
+	
+	VkelEnumeration *enumeration;
+	const VkExtensionProperties *extProperties = vkelEnumerateDeviceExtensions(physicalDevice, pLayerName, extensionNameCount, &enumeration);
+	
+	char **extensionNames = extProperties ? vkelCopyNames((*extensionNameCount), extProperties->extensionName, sizeof(VkExtensionProperties)) : NULL;
+	
+	vkelReleaseEnumeration(enumeration);
+	
+	if (!extensionNames)
+		(*extensionNameCount) = 0;
+	
+	
+	return extensionNames;
+}
+
+char** vkelGetDeviceLayerNames(VkPhysicalDevice physicalDevice, uint32_t *layerNameCount)
+{
+	assert(layerNameCount);
+	
+	
+	VkelEnumeration *enumeration;
+	const VkLayerProperties *layerProperties = vkelEnumerateDeviceLayers(physicalDevice, layerNameCount, &enumeration);
+	
+	char **layerNames = layerProperties ? vkelCopyNames((*layerNameCount), layerProperties->layerName, sizeof(VkLayerProperties)) : NULL;
+	
+	vkelReleaseEnumeration(enumeration);
+	
+	if (!layerNames)
+		(*layerNameCount) = 0;
+	
+	
+	return layerNames;
+}
+
+
+uint32_t vkelQueryInstanceLayers(uint32_t layerNameCount, const char* const *pLayerNames, VkBool32 *pSupported)
+{
+	uint32_t layerPropertyCount = 0;
+	VkelEnumeration *enumeration;
+	const VkLayerProperties *layerProperties = vkelEnumerateInstanceLayers(&layerPropertyCount, &enumeration);
+	
+	uint32_t supportedCount = vkelMatchNames(layerNameCount, pLayerNames, pSupported, layerPropertyCount, layerProperties ? layerProperties->layerName : NULL, sizeof(VkLayerProperties));
+	
+	vkelReleaseEnumeration(enumeration);
+	
+	return supportedCount;
+}
+
+uint32_t vkelQueryInstanceExtensions(const char *pLayerName, uint32_t extensionNameCount, const char* const *pExtensionNames, VkBool32 *pSupported)
+{
+	uint32_t extPropertyCount = 0;
+	VkelEnumeration *enumeration;
+	const VkExtensionProperties *extProperties = vkelEnumerateInstanceExtensions(pLayerName, &extPropertyCount, &enumeration);
+	
+	uint32_t supportedCount = vkelMatchNames(extensionNameCount, pExtensionNames, pSupported, extPropertyCount, extProperties ? extProperties->extensionName : NULL, sizeof(VkExtensionProperties));
+	
+	vkelReleaseEnumeration(enumeration);
+	
+	return supportedCount;
+}
+
+
+uint32_t vkelQueryDeviceLayers(VkPhysicalDevice physicalDevice, uint32_t layerNameCount, const char* const *pLayerNames, VkBool32 *pSupported)
+{
+	uint32_t layerPropertyCount = 0;
+	VkelEnumeration *enumeration;
+	const VkLayerProperties *layerProperties = vkelEnumerateDeviceLayers(physicalDevice, &layerPropertyCount, &enumeration);
+	
+	uint32_t supportedCount = vkelMatchNames(layerNameCount, pLayerNames, pSupported, layerPropertyCount, layerProperties ? layerProperties->layerName : NULL, sizeof(VkLayerProperties));
+	
+	vkelReleaseEnumeration(enumeration);
+	
+	return supportedCount;
+}
+
+uint32_t vkelQueryDeviceExtensions(VkPhysicalDevice physicalDevice, const char *pLayerName, uint32_t extensionNameCount, const char* const *pExtensionNames, VkBool32 *pSupported)
+{
+	uint32_t extPropertyCount = 0;
+	VkelEnumeration *enumeration;
+	const VkExtensionProperties *extProperties = vkelEnumerateDeviceExtensions(physicalDevice, pLayerName, &extPropertyCount, &enumeration);
+	
+	uint32_t supportedCount = vkelMatchNames(extensionNameCount, pExtensionNames, pSupported, extPropertyCount, extProperties ? extProperties->extensionName : NULL, sizeof(VkExtensionProperties));
+	
+	vkelReleaseEnumeration(enumeration);
+	
+	return supportedCount;
+}
+
+
+static uint32_t vkelFindId(const char *pName, const char* const *pNames, const uint32_t *pIdsByName, uint32_t idCount)
+{
+	if (!pName)
+		return idCount;
+	
+	uint32_t first = 0;
+	uint32_t last = idCount;
+	
+	while (first < last)
+	{
+		uint32_t middle = first + (last - first) / 2;
+		
+		int order = vkel_strcmp(pNames[pIdsByName[middle]], pName);
+		
+		if (order == 0)
+			return pIdsByName[middle];
+		
+		if (order < 0)
+			first = middle + 1;
+		else
+			last = middle;
+	}
+	
+	return idCount;
+}
+
+
+const char* vkelGetExtensionName(VkelExtensionId extensionId)
+{
+	return ((uint32_t) extensionId < VKEL_EXT_ID_COUNT) ? vkelExtensionNames[extensionId] : NULL;
+}
+
+const char* vkelGetLayerName(VkelLayerId layerId)
+{
+	return ((uint32_t) layerId < VKEL_LAYER_ID_COUNT) ? vkelLayerNames[layerId] : NULL;
+}
+
+
+VkelExtensionId vkelFindExtensionId(const char *pExtensionName)
+{
+	return (VkelExtensionId) vkelFindId(pExtensionName, vkelExtensionNames, vkelExtensionIdsByName, VKEL_EXT_ID_COUNT);
+}
+
+VkelLayerId vkelFindLayerId(const char *pLayerName)
+{
+	return (VkelLayerId) vkelFindId(pLayerName, vkelLayerNames, vkelLayerIdsByName, VKEL_LAYER_ID_COUNT);
+}
+
+
+// Map enumerated names to their IDs (once), so checking them
+// later doesn't involve any string comparisons
+static void vkelMapExtensions(VkelCapabilities *pCapabilities, uint32_t extPropertyCount, const VkExtensionProperties *extProperties)
+{
+	memset(pCapabilities->extensions, 0, sizeof(pCapabilities->extensions));
+	
+	uint32_t extPropertyIndex = 0;
+	for (extPropertyIndex = 0; extPropertyIndex < extPropertyCount; extPropertyIndex++)
+	{
+		uint32_t extensionId = (uint32_t) vkelFindExtensionId(extProperties[extPropertyIndex].extensionName);
+		
+		if (extensionId < VKEL_EXT_ID_COUNT)
+			pCapabilities->extensions[extensionId / 32] |= 1u << (extensionId % 32);
+	}
+}
+
+static void vkelMapLayers(VkelCapabilities *pCapabilities, uint32_t layerPropertyCount, const VkLayerProperties *layerProperties)
+{
+	memset(pCapabilities->layers, 0, sizeof(pCapabilities->layers));
+	
+	uint32_t layerPropertyIndex = 0;
+	for (layerPropertyIndex = 0; layerPropertyIndex < layerPropertyCount; layerPropertyIndex++)
+	{
+		uint32_t layerId = (uint32_t) vkelFindLayerId(layerProperties[layerPropertyIndex].layerName);
+		
+		if (layerId < VKEL_LAYER_ID_COUNT)
+			pCapabilities->layers[layerId / 32] |= 1u << (layerId % 32);
+	}
+}
+
+
+static void vkelGetInstanceSupport(VkelCapabilities *pCapabilities)
+{
+	VkelEnumeration *enumeration;
+	
+	uint32_t extPropertyCount = 0;
+	const VkExtensionProperties *extProperties = vkelEnumerateInstanceExtensions(NULL, &extPropertyCount, &enumeration);
+	
+	vkelMapExtensions(pCapabilities, extPropertyCount, extProperties);
+	vkelReleaseEnumeration(enumeration);
+	
+	
+	uint32_t layerPropertyCount = 0;
+	const VkLayerProperties *layerProperties = vkelEnumerateInstanceLayers(&layerPropertyCount, &enumeration);
+	
+	vkelMapLayers(pCapabilities, layerPropertyCount, layerProperties);
+	vkelReleaseEnumeration(enumeration);
+}
+
+static void vkelMapPhysicalDeviceCapabilities(VkPhysicalDevice physicalDevice, VkelCapabilities *pCapabilities, const VkelEnumerateProcs *pProcs)
+{
+	assert(physicalDevice);
+	
+	
+	VkelEnumeration *enumeration;
+	
+	uint32_t extPropertyCount = 0;
+	const VkExtensionProperties *extProperties = (const VkExtensionProperties*) vkelEnumerate(physicalDevice, VK_FALSE, NULL, &extPropertyCount, &enumeration, pProcs);
+	
+	vkelMapExtensions(pCapabilities, extPropertyCount, extProperties);
+	vkelReleaseEnumeration(enumeration);
+	
+	
+	uint32_t layerPropertyCount = 0;
+	const VkLayerProperties *layerProperties = (const VkLayerProperties*) vkelEnumerate(physicalDevice, VK_TRUE, NULL, &layerPropertyCount, &enumeration, pProcs);
+	
+	vkelMapLayers(pCapabilities, layerPropertyCount, layerProperties);
+	vkelReleaseEnumeration(enumeration);
+}
+
+void vkelGetPhysicalDeviceCapabilities(VkPhysicalDevice physicalDevice, VkelCapabilities *pCapabilities)
+{
+	assert(pCapabilities);
+	
+	vkelMapPhysicalDeviceCapabilities(physicalDevice, pCapabilities, NULL);
+}
+
+
+const VkelCapabilities* vkelGetInstanceCapabilities(void)
+{
+	return &vkelInstanceCapabilities;
+}
+
+const VkelCapabilities* vkelGetDeviceCapabilities(void)
+{
+	static VkelCapabilities noCapabilities;
+	
+	const VkelDevice *entry = (const VkelDevice*) vkelAtomicLoadPointer(&vkelCurrentDevice);
+	
+	return entry ? &entry->capabilities : &noCapabilities;
+}
+
+
+void vkelIntersectCapabilities(VkelCapabilities *pCapabilities, const VkelCapabilities *pOther)
+{
+	uint32_t wordIndex = 0;
+	for (wordIndex = 0; wordIndex < VKEL_EXT_WORD_COUNT; wordIndex++)
+		pCapabilities->extensions[wordIndex] &= pOther->extensions[wordIndex];
+	
+	for (wordIndex = 0; wordIndex < VKEL_LAYER_WORD_COUNT; wordIndex++)
+		pCapabilities->layers[wordIndex] &= pOther->layers[wordIndex];
+}
+
+void vkelUniteCapabilities(VkelCapabilities *pCapabilities, const VkelCapabilities *pOther)
+{
+	uint32_t wordIndex = 0;
+	for (wordIndex = 0; wordIndex < VKEL_EXT_WORD_COUNT; wordIndex++)
+		pCapabilities->extensions[wordIndex] |= pOther->extensions[wordIndex];
+	
+	for (wordIndex = 0; wordIndex < VKEL_LAYER_WORD_COUNT; wordIndex++)
+		pCapabilities->layers[wordIndex] |= pOther->layers[wordIndex];
+}
+
+VkBool32 vkelCompareCapabilities(const VkelCapabilities *pCapabilities, const VkelCapabilities *pOther)
+{
+	return memcmp(pCapabilities, pOther, sizeof(VkelCapabilities)) ? VK_FALSE : VK_TRUE;
+}
+
+
+VkBool32 vkelHasExtension(VkelExtensionId extensionId)
+{
+	if ((uint32_t) extensionId >= VKEL_EXT_ID_COUNT)
+		return VK_FALSE;
+	
+#ifdef VKEL_RECORD_USAGE
+	vkelRecordUsage(&vkelExtensionUsage[extensionId]);
+#endif
+	
+	return (vkelCapabilitiesHasExtension(&vkelInstanceCapabilities, extensionId) | vkelCapabilitiesHasExtension(vkelGetDeviceCapabilities(), extensionId)) ? VK_TRUE : VK_FALSE;
+}
+
+VkBool32 vkelHasLayer(VkelLayerId layerId)
+{
+	if ((uint32_t) layerId >= VKEL_LAYER_ID_COUNT)
+		return VK_FALSE;
+	
+#ifdef VKEL_RECORD_USAGE
+	vkelRecordUsage(&vkelLayerUsage[layerId]);
+#endif
+	
+	return (vkelCapabilitiesHasLayer(&vkelInstanceCapabilities, layerId) | vkelCapabilitiesHasLayer(vkelGetDeviceCapabilities(), layerId)) ? VK_TRUE : VK_FALSE;
+}
+
+
+static uint32_t vkelCountBits(uint32_t value)
+{
+	uint32_t count = 0;
+	
+	for (; value; value &= value - 1)
+		count++;
+	
+	return count;
+}
+
+// Returns VK_FALSE if the physical device doesn't meet the requirements
+static VkBool32 vkelRankPhysicalDevice(VkPhysicalDevice physicalDevice, const VkelDeviceRequirements *pRequirements, VkelRankedDevice *pRankedDevice)
+{
+	VkelCapabilities capabilities;
+	vkelGetPhysicalDeviceCapabilities(physicalDevice, &capabilities);
+	
+	uint32_t optionalCount = 0;
+	
+	uint32_t wordIndex = 0;
+	for (wordIndex = 0; wordIndex < VKEL_EXT_WORD_COUNT; wordIndex++)
+	{
+		if ((capabilities.extensions[wordIndex] & pRequirements->required.extensions[wordIndex]) != pRequirements->required.extensions[wordIndex])
+			return VK_FALSE;
+		
+		optionalCount += vkelCountBits(capabilities.extensions[wordIndex] & pRequirements->optional.extensions[wordIndex]);
+	}
+	
+	for (wordIndex = 0; wordIndex < VKEL_LAYER_WORD_COUNT; wordIndex++)
+	{
+		if ((capabilities.layers[wordIndex] & pRequirements->required.layers[wordIndex]) != pRequirements->required.layers[wordIndex])
+			return VK_FALSE;
+		
+		optionalCount += vkelCountBits(capabilities.layers[wordIndex] & pRequirements->optional.layers[wordIndex]);
+	}
+	
+	
+	uint32_t queueFamilyCount = 0;
+	vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueFamilyCount, NULL);
+	
+	VkQueueFamilyProperties *queueFamilies = (VkQueueFamilyProperties*) vkel_calloc(queueFamilyCount + 1, sizeof(VkQueueFamilyProperties), VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+	
+	if (!queueFamilies)
+		return VK_FALSE;
+	
+	vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueFamilyCount, queueFamilies);
+	
+	uint32_t queueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	uint32_t queueScore = 0;
+	
+	uint32_t familyIndex = 0;
+	for (familyIndex = 0; familyIndex < queueFamilyCount; familyIndex++)
+	{
+		VkQueueFlags flags = queueFamilies[familyIndex].queueFlags;
+		
+		if (!queueFamilies[familyIndex].queueCount)
+			continue;
+		
+		if ((queueFamilyIndex == VK_QUEUE_FAMILY_IGNORED) && ((flags & pRequirements->queueFlags) == pRequirements->queueFlags))
+			queueFamilyIndex = familyIndex;
+		
+		// Async compute, and transfers which don't compete with rendering
+		if ((flags & VK_QUEUE_COMPUTE_BIT) && !(flags & VK_QUEUE_GRAPHICS_BIT))
+			queueScore |= 2;
+		else if ((flags & VK_QUEUE_TRANSFER_BIT) && !(flags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT)))
+			queueScore |= 1;
+	}
+	
+	vkel_free(queueFamilies);
+	
+	if (queueFamilyIndex == VK_QUEUE_FAMILY_IGNORED)
+		return VK_FALSE;
+	
+	
+	VkPhysicalDeviceProperties properties;
+	vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+	
+	VkPhysicalDeviceMemoryProperties memoryProperties;
+	vkGetPhysicalDeviceMemoryProperties(physicalDevice, &memoryProperties);
+	
+	VkDeviceSize deviceLocalMemorySize = 0;
+	
+	uint32_t heapIndex = 0;
+	for (heapIndex = 0; heapIndex < memoryProperties.memoryHeapCount; heapIndex++)
+		if (memoryProperties.memoryHeaps[heapIndex].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT)
+			deviceLocalMemorySize += memoryProperties.memoryHeaps[heapIndex].size;
+	
+	uint64_t typeScore = 0;
+	
+	switch (properties.deviceType)
+	{
+	case VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU: typeScore = 4; break;
+	case VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU: typeScore = 3; break;
+	case VK_PHYSICAL_DEVICE_TYPE_VIRTUAL_GPU: typeScore = 2; break;
+	case VK_PHYSICAL_DEVICE_TYPE_CPU: typeScore = 1; break;
+	default: typeScore = 0; break;
+	}
+	
+	// In MiB, 40 bits is plenty
+	uint64_t memoryScore = deviceLocalMemorySize >> 20;
+	
+	if (memoryScore > 0xFFFFFFFFFFull)
+		memoryScore = 0xFFFFFFFFFFull;
+	
+	pRankedDevice->physicalDevice = physicalDevice;
+	pRankedDevice->deviceType = properties.deviceType;
+	pRankedDevice->deviceLocalMemorySize = deviceLocalMemorySize;
+	pRankedDevice->queueFamilyIndex = queueFamilyIndex;
+	pRankedDevice->optionalCount = optionalCount;
+	pRankedDevice->score = (typeScore << 56) | ((uint64_t) ((optionalCount < 0xFF) ? optionalCount : 0xFF) << 48) | (memoryScore << 8) | queueScore;
+	
+	return VK_TRUE;
+}
+
+VkResult vkelRankPhysicalDevices(VkInstance instance, const VkelDeviceRequirements *pRequirements, uint32_t *pRankedDeviceCount, VkelRankedDevice *pRankedDevices)
+{
+	assert(pRankedDeviceCount);
+	
+	VkelDeviceRequirements noRequirements;
+	
+	if (!pRequirements)
+	{
+		memset(&noRequirements, 0, sizeof(noRequirements));
+		pRequirements = &noRequirements;
+	}
+	
+	
+	uint32_t physicalDeviceCount = 0;
+	VkResult result = vkEnumeratePhysicalDevices(instance, &physicalDeviceCount, NULL);
+	
+	if (result != VK_SUCCESS)
+		return result;
+	
+	VkPhysicalDevice *physicalDevices = (VkPhysicalDevice*) vkel_calloc(physicalDeviceCount + 1, sizeof(VkPhysicalDevice), VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+	VkelRankedDevice *rankedDevices = (VkelRankedDevice*) vkel_calloc(physicalDeviceCount + 1, sizeof(VkelRankedDevice), VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+	
+	if (!physicalDevices || !rankedDevices)
+	{
+		vkel_free(physicalDevices);
+		vkel_free(rankedDevices);
+		
+		return VK_ERROR_OUT_OF_HOST_MEMORY;
+	}
+	
+	result = vkEnumeratePhysicalDevices(instance, &physicalDeviceCount, physicalDevices);
+	
+	if (result < VK_SUCCESS)
+	{
+		vkel_free(physicalDevices);
+		vkel_free(rankedDevices);
+		
+		return result;
+	}
+	
+	
+	uint32_t rankedDeviceCount = 0;
+	
+	uint32_t physicalDeviceIndex = 0;
+	for (physicalDeviceIndex = 0; physicalDeviceIndex < physicalDeviceCount; physicalDeviceIndex++)
+	{
+		VkelRankedDevice rankedDevice;
+		
+		if (!vkelRankPhysicalDevice(physicalDevices[physicalDeviceIndex], pRequirements, &rankedDevice))
+			continue;
+		
+		// Insertion sort, as there are only a few and equal scores keep the enumeration order
+		uint32_t rankIndex = rankedDeviceCount++;
+		
+		for (; (rankIndex > 0) && (rankedDevices[rankIndex - 1].score < rankedDevice.score); rankIndex--)
+			rankedDevices[rankIndex] = rankedDevices[rankIndex - 1];
+		
+		rankedDevices[rankIndex] = rankedDevice;
+	}
+	
+	
+	result = VK_SUCCESS;
+	
+	if (pRankedDevices)
+	{
+		if (*pRankedDeviceCount < rankedDeviceCount)
+			result = VK_INCOMPLETE;
+		else
+			*pRankedDeviceCount = rankedDeviceCount;
+		
+		memcpy(pRankedDevices, rankedDevices, *pRankedDeviceCount * sizeof(VkelRankedDevice));
+	}
+	else
+		*pRankedDeviceCount = rankedDeviceCount;
+	
+	vkel_free(physicalDevices);
+	vkel_free(rankedDevices);
+	
+	
+	return result;
+}
+
+VkPhysicalDevice vkelSelectPhysicalDevice(VkInstance instance, const VkelDeviceRequirements *pRequirements)
+{
+	VkelRankedDevice rankedDevice;
+	uint32_t rankedDeviceCount = 1;
+	
+	VkResult result = vkelRankPhysicalDevices(instance, pRequirements, &rankedDeviceCount, &rankedDevice);
+	
+	if ((result < VK_SUCCESS) || !rankedDeviceCount)
+		return VK_NULL_HANDLE;
+	
+	return rankedDevice.physicalDevice;
+}
+
+
+VkBool32 vkelIsInstanceLayerSupported(const char *pLayerName)
+{
+	return (vkelQueryInstanceLayers(1, &pLayerName, NULL) == 1) ? VK_TRUE : VK_FALSE;
+}
+
+VkBool32 vkelIsInstanceExtensionSupported(const char *pLayerName, const char *pExtensionName)
+{
+	return (vkelQueryInstanceExtensions(pLayerName, 1, &pExtensionName, NULL) == 1) ? VK_TRUE : VK_FALSE;
+}
+
+
+VkBool32 vkelIsDeviceLayerSupported(VkPhysicalDevice physicalDevice, const char *pLayerName)
+{
+	return (vkelQueryDeviceLayers(physicalDevice, 1, &pLayerName, NULL) == 1) ? VK_TRUE : VK_FALSE;
+}
+
+VkBool32 vkelIsDeviceExtensionSupported(VkPhysicalDevice physicalDevice, const char *pLayerName, const char *pExtensionName)
+{
+	return (vkelQueryDeviceExtensions(physicalDevice, pLayerName, 1, &pExtensionName, NULL) == 1) ? VK_TRUE : VK_FALSE;
+}
+
+
+#ifdef VKEL_THREAD_DEVICE
+
+VKEL_THREAD_LOCAL const VkelDeviceTable *vkelThreadDeviceTable;
+
+static VKEL_THREAD_LOCAL VkDevice vkelThreadDevice;
+
+
+// The table the vk* macros call through for the entry
+static const VkelDeviceTable* vkelGetBoundDeviceTable(const VkelDevice *entry)
+{
+#ifdef VKEL_RECORD_USAGE
+	// The recording functions, see vkelRegisterDevice()
+	return (const VkelDeviceTable*) (entry + 1);
+#else
+	return &entry->table;
+#endif
+}
+
+VkBool32 vkelBindDevice(VkDevice device)
+{
+	const VkelDevice *entry;
+	
+	if (!device)
+	{
+		vkelThreadDevice = VK_NULL_HANDLE;
+		vkelThreadDeviceTable = NULL;
+		return VK_TRUE;
+	}
+	
+	entry = vkelGetDevice(device);
+	
+	if (!entry)
+		return VK_FALSE;
+	
+	vkelThreadDevice = device;
+	vkelThreadDeviceTable = vkelGetBoundDeviceTable(entry);
+	
+	return VK_TRUE;
+}
+
+// Called at quiescent points, a bound device which was unregistered goes back to vkelTable.pDeviceTable
+static void vkelRefreshThreadDevice(void)
+{
+	const VkelDevice *entry = vkelThreadDevice ? vkelGetDevice(vkelThreadDevice) : NULL;
+	
+	if (!entry)
+		vkelThreadDevice = VK_NULL_HANDLE;
+	
+	vkelThreadDeviceTable = entry ? vkelGetBoundDeviceTable(entry) : NULL;
+}
+
+#endif /* VKEL_THREAD_DEVICE */
+
+
+typedef struct VkelRetired
+{
+	struct VkelRetired *next;
+	void *pointer;
+	uint64_t epoch;
+} VkelRetired;
+
+// Only taken by writers, readers never lock
+static VkelPlatformMutex vkelRetireMutex = VKEL_PLATFORM_MUTEX_INITIALIZER;
+static VkelRetired *vkelRetiredList;
+
+// Advanced whenever something is retired
+static volatile uint64_t vkelEpoch = 1;
+
+// The epoch each online thread saw at its last quiescent point, 0 for unused slots
+static volatile uint64_t vkelThreadEpochs[VKEL_MAX_THREADS];
+static VKEL_THREAD_LOCAL int vkelThreadSlot = -1;
+
+// Until a thread has come online, or once one couldn't (and reads without a slot), the readers
+// of retired pointers are unknown, and they are parked until vkelUninit()
+static volatile uint64_t vkelThreadsOnline;
+static volatile uint64_t vkelThreadsUntracked;
+
+
+static uint64_t vkelAtomicLoad64(volatile uint64_t *pValue)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return __atomic_load_n(pValue, __ATOMIC_SEQ_CST);
+#elif defined(_MSC_VER)
+	return (uint64_t) InterlockedCompareExchange64((volatile LONG64*) pValue, 0, 0);
+#else
+#	error vkel needs 64-bit atomics for this compiler
+#endif
+}
+
+static void vkelAtomicStore64(volatile uint64_t *pValue, uint64_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	__atomic_store_n(pValue, value, __ATOMIC_SEQ_CST);
+#elif defined(_MSC_VER)
+	InterlockedExchange64((volatile LONG64*) pValue, (LONG64) value);
+#else
+#	error vkel needs 64-bit atomics for this compiler
+#endif
+}
+
+static uint64_t vkelAtomicIncrement64(volatile uint64_t *pValue)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return __atomic_add_fetch(pValue, 1, __ATOMIC_SEQ_CST);
+#elif defined(_MSC_VER)
+	return (uint64_t) InterlockedIncrement64((volatile LONG64*) pValue);
+#else
+#	error vkel needs 64-bit atomics for this compiler
+#endif
+}
+
+static VkBool32 vkelAtomicClaim64(volatile uint64_t *pValue, uint64_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	uint64_t expected = 0;
+	
+	return __atomic_compare_exchange_n(pValue, &expected, value, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST) ? VK_TRUE : VK_FALSE;
+#elif defined(_MSC_VER)
+	return (InterlockedCompareExchange64((volatile LONG64*) pValue, (LONG64) value, 0) == 0) ? VK_TRUE : VK_FALSE;
+#else
+#	error vkel needs 64-bit atomics for this compiler
+#endif
+}
+
+
+// Frees everything retired before the oldest quiescent point of the online threads.
+// Skipped when another thread is already reclaiming, so it never waits.
+static void vkelReclaim(void)
+{
+	uint64_t oldestEpoch = ~(uint64_t) 0;
+	VkelRetired **link = &vkelRetiredList;
+	uint32_t i;
+	
+	if (!vkelAtomicLoad64(&vkelThreadsOnline) || vkelAtomicLoad64(&vkelThreadsUntracked))
+		return;
+	
+	if (!vkelPlatformTryLockMutex(&vkelRetireMutex))
+		return;
+	
+	for (i = 0; i < VKEL_MAX_THREADS; ++i)
+	{
+		uint64_t epoch = vkelAtomicLoad64(&vkelThreadEpochs[i]);
+		
+		if (epoch && (epoch < oldestEpoch))
+			oldestEpoch = epoch;
+	}
+	
+	while (*link)
+	{
+		VkelRetired *retired = *link;
+		
+		if (retired->epoch <= oldestEpoch)
+		{
+			*link = retired->next;
+			
+			vkel_free(retired->pointer);
+			vkel_free(retired);
+		}
+		else
+			link = &retired->next;
+	}
+	
+	vkelPlatformUnlockMutex(&vkelRetireMutex);
+}
+
+// Must be called after the pointer was unpublished
+static void vkelRetire(void *pointer)
+{
+	if (!pointer)
+		return;
+	
+	VkelRetired *retired = (VkelRetired*) vkel_malloc(sizeof(VkelRetired), VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+	
+	// Leaked rather than freed while it might still be in use
+	if (!retired)
+		return;
+	
+	retired->pointer = pointer;
+	
+	vkelPlatformLockMutex(&vkelRetireMutex);
+	
+	retired->epoch = vkelAtomicIncrement64(&vkelEpoch);
+	retired->next = vkelRetiredList;
+	vkelRetiredList = retired;
+	
+	vkelPlatformUnlockMutex(&vkelRetireMutex);
+	
+	
+	vkelReclaim();
+}
+
+// Called by vkelUninit(), when no other thread may be using vkel anymore
+static void vkelReclaimAll(void)
+{
+	vkelPlatformLockMutex(&vkelRetireMutex);
+	
+	while (vkelRetiredList)
+	{
+		VkelRetired *retired = vkelRetiredList;
+		
+		vkelRetiredList = retired->next;
+		
+		vkel_free(retired->pointer);
+		vkel_free(retired);
+	}
+	
+	vkelPlatformUnlockMutex(&vkelRetireMutex);
+}
+
+
+VkBool32 vkelQuiescent(void)
+{
+	uint64_t epoch = vkelAtomicLoad64(&vkelEpoch);
+	
+	if (vkelThreadSlot < 0)
+	{
+		int i;
+		
+		for (i = 0; (i < VKEL_MAX_THREADS) && (vkelThreadSlot < 0); ++i)
+			if (vkelAtomicClaim64(&vkelThreadEpochs[i], epoch))
+				vkelThreadSlot = i;
+		
+		if (vkelThreadSlot < 0)
+		{
+			vkelAtomicStore64(&vkelThreadsUntracked, 1);
+			return VK_FALSE;
+		}
+		
+		vkelAtomicStore64(&vkelThreadsOnline, 1);
+	}
+	else
+		vkelAtomicStore64(&vkelThreadEpochs[vkelThreadSlot], epoch);
+	
+#ifdef VKEL_THREAD_DEVICE
+	vkelRefreshThreadDevice();
+#endif
+	
+	vkelReclaim();
+	
+	
+	return VK_TRUE;
+}
+
+void vkelThreadOffline(void)
+{
+	if (vkelThreadSlot < 0)
+		return;
+	
+	vkelAtomicStore64(&vkelThreadEpochs[vkelThreadSlot], 0);
+	vkelThreadSlot = -1;
+}
+
+
+const VkelDevice* vkelGetCurrentDevice(void)
+{
+	const VkelDevice *entry = (const VkelDevice*) vkelAtomicLoadPointer(&vkelCurrentDevice);
+	
+	// Not a device, but the functions loaded by vkelInit()/vkelInstanceInit()
+	return (entry && entry->device) ? entry : NULL;
+}
+
+
+static VkelDevice* vkelCreateDeviceEntry(void)
+{
+#ifdef VKEL_RECORD_USAGE
+	// Followed by the table of recording functions the vk* macros call through
+	return (VkelDevice*) vkel_calloc(1, sizeof(VkelDevice) + sizeof(VkelDeviceTable), VK_SYSTEM_ALLOCATION_SCOPE_DEVICE);
+#else
+	return (VkelDevice*) vkel_calloc(1, sizeof(VkelDevice), VK_SYSTEM_ALLOCATION_SCOPE_DEVICE);
+#endif
+}
+
+// Makes the entry the one the device level vk* macros and the device capabilities come
+// from (NULL for none), while the previous one is freed once no thread can be using it
+static void vkelPublishDevice(VkelDevice *entry)
+{
+	const VkelDeviceTable *pTable = entry ? &entry->table : &vkelNullDeviceTable;
+	
+	if (entry)
+	{
+#ifdef VKEL_FALLBACK_STUBS
+		vkelFillStubs(&entry->table, vkelDeviceStubs, sizeof(vkelDeviceStubs) / sizeof(vkelDeviceStubs[0]));
+#endif
+		
+#ifdef VKEL_RECORD_USAGE
+		vkelRecordDeviceUsageProcs(&entry->table, (VkelDeviceTable*) (entry + 1));
+		pTable = (const VkelDeviceTable*) (entry + 1);
+#endif
+	}
+	
+	
+	vkelPlatformLockMutex(&vkelRetireMutex);
+	
+	VkelDevice *previous = (VkelDevice*) vkelCurrentDevice;
+	
+	// The recording functions call through the entry, so it goes first
+	vkelAtomicStorePointer(&vkelCurrentDevice, entry);
+	vkelAtomicStorePointer((void* volatile*) &vkelTable.pDeviceTable, (void*) pTable);
+	
+	vkelTable.pDeviceExtensions = vkelGetDeviceCapabilities()->extensions;
+	vkelTable.pDeviceLayers = vkelGetDeviceCapabilities()->layers;
+	
+	vkelPlatformUnlockMutex(&vkelRetireMutex);
+	
+	
+	vkelRetire(previous);
+}
+
+// Until vkelDeviceInit(), the device level functions are the ones vkelTable was loaded with
+static VkBool32 vkelPublishInstanceDevice(const VkelCapabilities *pDeviceCapabilities)
+{
+	VkelDevice *entry = vkelCreateDeviceEntry();
+	
+	if (!entry)
+		return VK_FALSE;
+	
+	entry->table.DestroyDevice = vkelTable.DestroyDevice;
+	entry->table.GetDeviceQueue = vkelTable.GetDeviceQueue;
+	entry->table.QueueSubmit = vkelTable.QueueSubmit;
+	entry->table.QueueWaitIdle = vkelTable.QueueWaitIdle;
+	entry->table.DeviceWaitIdle = vkelTable.DeviceWaitIdle;
+	entry->table.AllocateMemory = vkelTable.AllocateMemory;
+	entry->table.FreeMemory = vkelTable.FreeMemory;
+	entry->table.MapMemory = vkelTable.MapMemory;
+	entry->table.UnmapMemory = vkelTable.UnmapMemory;
+	entry->table.FlushMappedMemoryRanges = vkelTable.FlushMappedMemoryRanges;
+	entry->table.InvalidateMappedMemoryRanges = vkelTable.InvalidateMappedMemoryRanges;
+	entry->table.GetDeviceMemoryCommitment = vkelTable.GetDeviceMemoryCommitment;
+	entry->table.BindBufferMemory = vkelTable.BindBufferMemory;
+	entry->table.BindImageMemory = vkelTable.BindImageMemory;
+	entry->table.GetBufferMemoryRequirements = vkelTable.GetBufferMemoryRequirements;
+	entry->table.GetImageMemoryRequirements = vkelTable.GetImageMemoryRequirements;
+	entry->table.GetImageSparseMemoryRequirements = vkelTable.GetImageSparseMemoryRequirements;
+	entry->table.QueueBindSparse = vkelTable.QueueBindSparse;
+	entry->table.CreateFence = vkelTable.CreateFence;
+	entry->table.DestroyFence = vkelTable.DestroyFence;
+	entry->table.ResetFences = vkelTable.ResetFences;
+	entry->table.GetFenceStatus = vkelTable.GetFenceStatus;
+	entry->table.WaitForFences = vkelTable.WaitForFences;
+	entry->table.CreateSemaphore = vkelTable.CreateSemaphore;
+	entry->table.DestroySemaphore = vkelTable.DestroySemaphore;
+	entry->table.CreateEvent = vkelTable.CreateEvent;
+	entry->table.DestroyEvent = vkelTable.DestroyEvent;
+	entry->table.GetEventStatus = vkelTable.GetEventStatus;
+	entry->table.SetEvent = vkelTable.SetEvent;
+	entry->table.ResetEvent = vkelTable.ResetEvent;
+	entry->table.CreateQueryPool = vkelTable.CreateQueryPool;
+	entry->table.DestroyQueryPool = vkelTable.DestroyQueryPool;
+	entry->table.GetQueryPoolResults = vkelTable.GetQueryPoolResults;
+	entry->table.CreateBuffer = vkelTable.CreateBuffer;
+	entry->table.DestroyBuffer = vkelTable.DestroyBuffer;
+	entry->table.CreateBufferView = vkelTable.CreateBufferView;
+	entry->table.DestroyBufferView = vkelTable.DestroyBufferView;
+	entry->table.CreateImage = vkelTable.CreateImage;
+	entry->table.DestroyImage = vkelTable.DestroyImage;
+	entry->table.GetImageSubresourceLayout = vkelTable.GetImageSubresourceLayout;
+	entry->table.CreateImageView = vkelTable.CreateImageView;
+	entry->table.DestroyImageView = vkelTable.DestroyImageView;
+	entry->table.CreateShaderModule = vkelTable.CreateShaderModule;
+	entry->table.DestroyShaderModule = vkelTable.DestroyShaderModule;
+	entry->table.CreatePipelineCache = vkelTable.CreatePipelineCache;
+	entry->table.DestroyPipelineCache = vkelTable.DestroyPipelineCache;
+	entry->table.GetPipelineCacheData = vkelTable.GetPipelineCacheData;
+	entry->table.MergePipelineCaches = vkelTable.MergePipelineCaches;
+	entry->table.CreateGraphicsPipelines = vkelTable.CreateGraphicsPipelines;
+	entry->table.CreateComputePipelines = vkelTable.CreateComputePipelines;
+	entry->table.DestroyPipeline = vkelTable.DestroyPipeline;
+	entry->table.CreatePipelineLayout = vkelTable.CreatePipelineLayout;
+	entry->table.DestroyPipelineLayout = vkelTable.DestroyPipelineLayout;
+	entry->table.CreateSampler = vkelTable.CreateSampler;
+	entry->table.DestroySampler = vkelTable.DestroySampler;
+	entry->table.CreateDescriptorSetLayout = vkelTable.CreateDescriptorSetLayout;
+	entry->table.DestroyDescriptorSetLayout = vkelTable.DestroyDescriptorSetLayout;
+	entry->table.CreateDescriptorPool = vkelTable.CreateDescriptorPool;
+	entry->table.DestroyDescriptorPool = vkelTable.DestroyDescriptorPool;
+	entry->table.ResetDescriptorPool = vkelTable.ResetDescriptorPool;
+	entry->table.AllocateDescriptorSets = vkelTable.AllocateDescriptorSets;
+	entry->table.FreeDescriptorSets = vkelTable.FreeDescriptorSets;
+	entry->table.UpdateDescriptorSets = vkelTable.UpdateDescriptorSets;
+	entry->table.CreateFramebuffer = vkelTable.CreateFramebuffer;
+	entry->table.DestroyFramebuffer = vkelTable.DestroyFramebuffer;
+	entry->table.CreateRenderPass = vkelTable.CreateRenderPass;
+	entry->table.DestroyRenderPass = vkelTable.DestroyRenderPass;
+	entry->table.GetRenderAreaGranularity = vkelTable.GetRenderAreaGranularity;
+	entry->table.CreateCommandPool = vkelTable.CreateCommandPool;
+	entry->table.DestroyCommandPool = vkelTable.DestroyCommandPool;
+	entry->table.ResetCommandPool = vkelTable.ResetCommandPool;
+	entry->table.AllocateCommandBuffers = vkelTable.AllocateCommandBuffers;
+	entry->table.FreeCommandBuffers = vkelTable.FreeCommandBuffers;
+	entry->table.BeginCommandBuffer = vkelTable.BeginCommandBuffer;
+	entry->table.EndCommandBuffer = vkelTable.EndCommandBuffer;
+	entry->table.ResetCommandBuffer = vkelTable.ResetCommandBuffer;
+	entry->table.CmdBindPipeline = vkelTable.CmdBindPipeline;
+	entry->table.CmdSetViewport = vkelTable.CmdSetViewport;
+	entry->table.CmdSetScissor = vkelTable.CmdSetScissor;
+	entry->table.CmdSetLineWidth = vkelTable.CmdSetLineWidth;
+	entry->table.CmdSetDepthBias = vkelTable.CmdSetDepthBias;
+	entry->table.CmdSetBlendConstants = vkelTable.CmdSetBlendConstants;
+	entry->table.CmdSetDepthBounds = vkelTable.CmdSetDepthBounds;
+	entry->table.CmdSetStencilCompareMask = vkelTable.CmdSetStencilCompareMask;
+	entry->table.CmdSetStencilWriteMask = vkelTable.CmdSetStencilWriteMask;
+	entry->table.CmdSetStencilReference = vkelTable.CmdSetStencilReference;
+	entry->table.CmdBindDescriptorSets = vkelTable.CmdBindDescriptorSets;
+	entry->table.CmdBindIndexBuffer = vkelTable.CmdBindIndexBuffer;
+	entry->table.CmdBindVertexBuffers = vkelTable.CmdBindVertexBuffers;
+	entry->table.CmdDraw = vkelTable.CmdDraw;
+	entry->table.CmdDrawIndexed = vkelTable.CmdDrawIndexed;
+	entry->table.CmdDrawIndirect = vkelTable.CmdDrawIndirect;
+	entry->table.CmdDrawIndexedIndirect = vkelTable.CmdDrawIndexedIndirect;
+	entry->table.CmdDispatch = vkelTable.CmdDispatch;
+	entry->table.CmdDispatchIndirect = vkelTable.CmdDispatchIndirect;
+	entry->table.CmdCopyBuffer = vkelTable.CmdCopyBuffer;
+	entry->table.CmdCopyImage = vkelTable.CmdCopyImage;
+	entry->table.CmdBlitImage = vkelTable.CmdBlitImage;
+	entry->table.CmdCopyBufferToImage = vkelTable.CmdCopyBufferToImage;
+	entry->table.CmdCopyImageToBuffer = vkelTable.CmdCopyImageToBuffer;
+	entry->table.CmdUpdateBuffer = vkelTable.CmdUpdateBuffer;
+	entry->table.CmdFillBuffer = vkelTable.CmdFillBuffer;
+	entry->table.CmdClearColorImage = vkelTable.CmdClearColorImage;
+	entry->table.CmdClearDepthStencilImage = vkelTable.CmdClearDepthStencilImage;
+	entry->table.CmdClearAttachments = vkelTable.CmdClearAttachments;
+	entry->table.CmdResolveImage = vkelTable.CmdResolveImage;
+	entry->table.CmdSetEvent = vkelTable.CmdSetEvent;
+	entry->table.CmdResetEvent = vkelTable.CmdResetEvent;
+	entry->table.CmdWaitEvents = vkelTable.CmdWaitEvents;
+	entry->table.CmdPipelineBarrier = vkelTable.CmdPipelineBarrier;
+	entry->table.CmdBeginQuery = vkelTable.CmdBeginQuery;
+	entry->table.CmdEndQuery = vkelTable.CmdEndQuery;
+	entry->table.CmdResetQueryPool = vkelTable.CmdResetQueryPool;
+	entry->table.CmdWriteTimestamp = vkelTable.CmdWriteTimestamp;
+	entry->table.CmdCopyQueryPoolResults = vkelTable.CmdCopyQueryPoolResults;
+	entry->table.CmdPushConstants = vkelTable.CmdPushConstants;
+	entry->table.CmdBeginRenderPass = vkelTable.CmdBeginRenderPass;
+	entry->table.CmdNextSubpass = vkelTable.CmdNextSubpass;
+	entry->table.CmdEndRenderPass = vkelTable.CmdEndRenderPass;
+	entry->table.CmdExecuteCommands = vkelTable.CmdExecuteCommands;
+	entry->table.CreateSwapchainKHR = vkelTable.CreateSwapchainKHR;
+	entry->table.DestroySwapchainKHR = vkelTable.DestroySwapchainKHR;
+	entry->table.GetSwapchainImagesKHR = vkelTable.GetSwapchainImagesKHR;
+	entry->table.AcquireNextImageKHR = vkelTable.AcquireNextImageKHR;
+	entry->table.QueuePresentKHR = vkelTable.QueuePresentKHR;
+	entry->table.CreateSharedSwapchainsKHR = vkelTable.CreateSharedSwapchainsKHR;
+	entry->table.DebugMarkerSetObjectTagEXT = vkelTable.DebugMarkerSetObjectTagEXT;
+	entry->table.DebugMarkerSetObjectNameEXT = vkelTable.DebugMarkerSetObjectNameEXT;
+	entry->table.CmdDebugMarkerBeginEXT = vkelTable.CmdDebugMarkerBeginEXT;
+	entry->table.CmdDebugMarkerEndEXT = vkelTable.CmdDebugMarkerEndEXT;
+	entry->table.CmdDebugMarkerInsertEXT = vkelTable.CmdDebugMarkerInsertEXT;
+	
+	if (pDeviceCapabilities)
+		entry->capabilities = *pDeviceCapabilities;
+	
+	vkelPublishDevice(entry);
+	
+	return VK_TRUE;
+}
+
+// Set when using the table of another copy of vkel
+static const VkelTable *vkelSourceTable;
+
+
+static void vkelUpdateTable(void)
+{
+	vkelTable.version = VKEL_TABLE_VERSION;
+	vkelTable.size = sizeof(VkelTable);
+	
+	vkelTable.extensionIdCount = VKEL_EXT_ID_COUNT;
+	vkelTable.layerIdCount = VKEL_LAYER_ID_COUNT;
+	
+	vkelTable.pInstanceExtensions = vkelInstanceCapabilities.extensions;
+	vkelTable.pInstanceLayers = vkelInstanceCapabilities.layers;
+	
+#ifdef VKEL_FALLBACK_STUBS
+	vkelFillStubs(&vkelTable, vkelStubs, sizeof(vkelStubs) / sizeof(vkelStubs[0]));
+#endif
+}
+
+
+// Members beyond the size are from a newer version of vkel
+#define VKEL_TABLE_MEMBER(pTable, member) ((offsetof(VkelTable, member) < (pTable)->size) ? (pTable)->member : NULL)
+
+static void vkelCopyTableProcs(const VkelTable *pTable)
+{
+	vkelTable.CreateInstance = VKEL_TABLE_MEMBER(pTable, CreateInstance);
+	vkelTable.DestroyInstance = VKEL_TABLE_MEMBER(pTable, DestroyInstance);
+	vkelTable.EnumeratePhysicalDevices = VKEL_TABLE_MEMBER(pTable, EnumeratePhysicalDevices);
+	vkelTable.GetPhysicalDeviceFeatures = VKEL_TABLE_MEMBER(pTable, GetPhysicalDeviceFeatures);
+	vkelTable.GetPhysicalDeviceFormatProperties = VKEL_TABLE_MEMBER(pTable, GetPhysicalDeviceFormatProperties);
+	vkelTable.GetPhysicalDeviceImageFormatProperties = VKEL_TABLE_MEMBER(pTable, GetPhysicalDeviceImageFormatProperties);
+	vkelTable.GetPhysicalDeviceProperties = VKEL_TABLE_MEMBER(pTable, GetPhysicalDeviceProperties);
+	vkelTable.GetPhysicalDeviceQueueFamilyProperties = VKEL_TABLE_MEMBER(pTable, GetPhysicalDeviceQueueFamilyProperties);
+	vkelTable.GetPhysicalDeviceMemoryProperties = VKEL_TABLE_MEMBER(pTable, GetPhysicalDeviceMemoryProperties);
+	vkelTable.GetInstanceProcAddr = VKEL_TABLE_MEMBER(pTable, GetInstanceProcAddr);
+	vkelTable.GetDeviceProcAddr = VKEL_TABLE_MEMBER(pTable, GetDeviceProcAddr);
+	vkelTable.CreateDevice = VKEL_TABLE_MEMBER(pTable, CreateDevice);
+	vkelTable.DestroyDevice = VKEL_TABLE_MEMBER(pTable, DestroyDevice);
+	vkelTable.EnumerateInstanceExtensionProperties = VKEL_TABLE_MEMBER(pTable, EnumerateInstanceExtensionProperties);
+	vkelTable.EnumerateDeviceExtensionProperties = VKEL_TABLE_MEMBER(pTable, EnumerateDeviceExtensionProperties);
+	vkelTable.EnumerateInstanceLayerProperties = VKEL_TABLE_MEMBER(pTable, EnumerateInstanceLayerProperties);
+	vkelTable.EnumerateDeviceLayerProperties = VKEL_TABLE_MEMBER(pTable, EnumerateDeviceLayerProperties);
+	vkelTable.GetDeviceQueue = VKEL_TABLE_MEMBER(pTable, GetDeviceQueue);
+	vkelTable.QueueSubmit = VKEL_TABLE_MEMBER(pTable, QueueSubmit);
+	vkelTable.QueueWaitIdle = VKEL_TABLE_MEMBER(pTable, QueueWaitIdle);
+	vkelTable.DeviceWaitIdle = VKEL_TABLE_MEMBER(pTable, DeviceWaitIdle);
+	vkelTable.AllocateMemory = VKEL_TABLE_MEMBER(pTable, AllocateMemory);
+	vkelTable.FreeMemory = VKEL_TABLE_MEMBER(pTable, FreeMemory);
+	vkelTable.MapMemory = VKEL_TABLE_MEMBER(pTable, MapMemory);
+	vkelTable.UnmapMemory = VKEL_TABLE_MEMBER(pTable, UnmapMemory);
+	vkelTable.FlushMappedMemoryRanges = VKEL_TABLE_MEMBER(pTable, FlushMappedMemoryRanges);
+	vkelTable.InvalidateMappedMemoryRanges = VKEL_TABLE_MEMBER(pTable, InvalidateMappedMemoryRanges);
+	vkelTable.GetDeviceMemoryCommitment = VKEL_TABLE_MEMBER(pTable, GetDeviceMemoryCommitment);
+	vkelTable.BindBufferMemory = VKEL_TABLE_MEMBER(pTable, BindBufferMemory);
+	vkelTable.BindImageMemory = VKEL_TABLE_MEMBER(pTable, BindImageMemory);
+	vkelTable.GetBufferMemoryRequirements = VKEL_TABLE_MEMBER(pTable, GetBufferMemoryRequirements);
+	vkelTable.GetImageMemoryRequirements = VKEL_TABLE_MEMBER(pTable, GetImageMemoryRequirements);
+	vkelTable.GetImageSparseMemoryRequirements = VKEL_TABLE_MEMBER(pTable, GetImageSparseMemoryRequirements);
+	vkelTable.GetPhysicalDeviceSparseImageFormatProperties = VKEL_TABLE_MEMBER(pTable, GetPhysicalDeviceSparseImageFormatProperties);
+	vkelTable.QueueBindSparse = VKEL_TABLE_MEMBER(pTable, QueueBindSparse);
+	vkelTable.CreateFence = VKEL_TABLE_MEMBER(pTable, CreateFence);
+	vkelTable.DestroyFence = VKEL_TABLE_MEMBER(pTable, DestroyFence);
+	vkelTable.ResetFences = VKEL_TABLE_MEMBER(pTable, ResetFences);
+	vkelTable.GetFenceStatus = VKEL_TABLE_MEMBER(pTable, GetFenceStatus);
+	vkelTable.WaitForFences = VKEL_TABLE_MEMBER(pTable, WaitForFences);
+	vkelTable.CreateSemaphore = VKEL_TABLE_MEMBER(pTable, CreateSemaphore);
+	vkelTable.DestroySemaphore = VKEL_TABLE_MEMBER(pTable, DestroySemaphore);
+	vkelTable.CreateEvent = VKEL_TABLE_MEMBER(pTable, CreateEvent);
+	vkelTable.DestroyEvent = VKEL_TABLE_MEMBER(pTable, DestroyEvent);
+	vkelTable.GetEventStatus = VKEL_TABLE_MEMBER(pTable, GetEventStatus);
+	vkelTable.SetEvent = VKEL_TABLE_MEMBER(pTable, SetEvent);
+	vkelTable.ResetEvent = VKEL_TABLE_MEMBER(pTable, ResetEvent);
+	vkelTable.CreateQueryPool = VKEL_TABLE_MEMBER(pTable, CreateQueryPool);
+	vkelTable.DestroyQueryPool = VKEL_TABLE_MEMBER(pTable, DestroyQueryPool);
+	vkelTable.GetQueryPoolResults = VKEL_TABLE_MEMBER(pTable, GetQueryPoolResults);
+	vkelTable.CreateBuffer = VKEL_TABLE_MEMBER(pTable, CreateBuffer);
+	vkelTable.DestroyBuffer = VKEL_TABLE_MEMBER(pTable, DestroyBuffer);
+	vkelTable.CreateBufferView = VKEL_TABLE_MEMBER(pTable, CreateBufferView);
+	vkelTable.DestroyBufferView = VKEL_TABLE_MEMBER(pTable, DestroyBufferView);
+	vkelTable.CreateImage = VKEL_TABLE_MEMBER(pTable, CreateImage);
+	vkelTable.DestroyImage = VKEL_TABLE_MEMBER(pTable, DestroyImage);
+	vkelTable.GetImageSubresourceLayout = VKEL_TABLE_MEMBER(pTable, GetImageSubresourceLayout);
+	vkelTable.CreateImageView = VKEL_TABLE_MEMBER(pTable, CreateImageView);
+	vkelTable.DestroyImageView = VKEL_TABLE_MEMBER(pTable, DestroyImageView);
+	vkelTable.CreateShaderModule = VKEL_TABLE_MEMBER(pTable, CreateShaderModule);
+	vkelTable.DestroyShaderModule = VKEL_TABLE_MEMBER(pTable, DestroyShaderModule);
+	vkelTable.CreatePipelineCache = VKEL_TABLE_MEMBER(pTable, CreatePipelineCache);
+	vkelTable.DestroyPipelineCache = VKEL_TABLE_MEMBER(pTable, DestroyPipelineCache);
+	vkelTable.GetPipelineCacheData = VKEL_TABLE_MEMBER(pTable, GetPipelineCacheData);
+	vkelTable.MergePipelineCaches = VKEL_TABLE_MEMBER(pTable, MergePipelineCaches);
+	vkelTable.CreateGraphicsPipelines = VKEL_TABLE_MEMBER(pTable, CreateGraphicsPipelines);
+	vkelTable.CreateComputePipelines = VKEL_TABLE_MEMBER(pTable, CreateComputePipelines);
+	vkelTable.DestroyPipeline = VKEL_TABLE_MEMBER(pTable, DestroyPipeline);
+	vkelTable.CreatePipelineLayout = VKEL_TABLE_MEMBER(pTable, CreatePipelineLayout);
+	vkelTable.DestroyPipelineLayout = VKEL_TABLE_MEMBER(pTable, DestroyPipelineLayout);
+	vkelTable.CreateSampler = VKEL_TABLE_MEMBER(pTable, CreateSampler);
+	vkelTable.DestroySampler = VKEL_TABLE_MEMBER(pTable, DestroySampler);
+	vkelTable.CreateDescriptorSetLayout = VKEL_TABLE_MEMBER(pTable, CreateDescriptorSetLayout);
+	vkelTable.DestroyDescriptorSetLayout = VKEL_TABLE_MEMBER(pTable, DestroyDescriptorSetLayout);
+	vkelTable.CreateDescriptorPool = VKEL_TABLE_MEMBER(pTable, CreateDescriptorPool);
+	vkelTable.DestroyDescriptorPool = VKEL_TABLE_MEMBER(pTable, DestroyDescriptorPool);
+	vkelTable.ResetDescriptorPool = VKEL_TABLE_MEMBER(pTable, ResetDescriptorPool);
+	vkelTable.AllocateDescriptorSets = VKEL_TABLE_MEMBER(pTable, AllocateDescriptorSets);
+	vkelTable.FreeDescriptorSets = VKEL_TABLE_MEMBER(pTable, FreeDescriptorSets);
+	vkelTable.UpdateDescriptorSets = VKEL_TABLE_MEMBER(pTable, UpdateDescriptorSets);
+	vkelTable.CreateFramebuffer = VKEL_TABLE_MEMBER(pTable, CreateFramebuffer);
+	vkelTable.DestroyFramebuffer = VKEL_TABLE_MEMBER(pTable, DestroyFramebuffer);
+	vkelTable.CreateRenderPass = VKEL_TABLE_MEMBER(pTable, CreateRenderPass);
+	vkelTable.DestroyRenderPass = VKEL_TABLE_MEMBER(pTable, DestroyRenderPass);
+	vkelTable.GetRenderAreaGranularity = VKEL_TABLE_MEMBER(pTable, GetRenderAreaGranularity);
+	vkelTable.CreateCommandPool = VKEL_TABLE_MEMBER(pTable, CreateCommandPool);
+	vkelTable.DestroyCommandPool = VKEL_TABLE_MEMBER(pTable, DestroyCommandPool);
+	vkelTable.ResetCommandPool = VKEL_TABLE_MEMBER(pTable, ResetCommandPool);
+	vkelTable.AllocateCommandBuffers = VKEL_TABLE_MEMBER(pTable, AllocateCommandBuffers);
+	vkelTable.FreeCommandBuffers = VKEL_TABLE_MEMBER(pTable, FreeCommandBuffers);
+	vkelTable.BeginCommandBuffer = VKEL_TABLE_MEMBER(pTable, BeginCommandBuffer);
+	vkelTable.EndCommandBuffer = VKEL_TABLE_MEMBER(pTable, EndCommandBuffer);
+	vkelTable.ResetCommandBuffer = VKEL_TABLE_MEMBER(pTable, ResetCommandBuffer);
+	vkelTable.CmdBindPipeline = VKEL_TABLE_MEMBER(pTable, CmdBindPipeline);
+	vkelTable.CmdSetViewport = VKEL_TABLE_MEMBER(pTable, CmdSetViewport);
+	vkelTable.CmdSetScissor = VKEL_TABLE_MEMBER(pTable, CmdSetScissor);
+	vkelTable.CmdSetLineWidth = VKEL_TABLE_MEMBER(pTable, CmdSetLineWidth);
+	vkelTable.CmdSetDepthBias = VKEL_TABLE_MEMBER(pTable, CmdSetDepthBias);
+	vkelTable.CmdSetBlendConstants = VKEL_TABLE_MEMBER(pTable, CmdSetBlendConstants);
+	vkelTable.CmdSetDepthBounds = VKEL_TABLE_MEMBER(pTable, CmdSetDepthBounds);
+	vkelTable.CmdSetStencilCompareMask = VKEL_TABLE_MEMBER(pTable, CmdSetStencilCompareMask);
+	vkelTable.CmdSetStencilWriteMask = VKEL_TABLE_MEMBER(pTable, CmdSetStencilWriteMask);
+	vkelTable.CmdSetStencilReference = VKEL_TABLE_MEMBER(pTable, CmdSetStencilReference);
+	vkelTable.CmdBindDescriptorSets = VKEL_TABLE_MEMBER(pTable, CmdBindDescriptorSets);
+	vkelTable.CmdBindIndexBuffer = VKEL_TABLE_MEMBER(pTable, CmdBindIndexBuffer);
+	vkelTable.CmdBindVertexBuffers = VKEL_TABLE_MEMBER(pTable, CmdBindVertexBuffers);
+	vkelTable.CmdDraw = VKEL_TABLE_MEMBER(pTable, CmdDraw);
+	vkelTable.CmdDrawIndexed = VKEL_TABLE_MEMBER(pTable, CmdDrawIndexed);
+	vkelTable.CmdDrawIndirect = VKEL_TABLE_MEMBER(pTable, CmdDrawIndirect);
+	vkelTable.CmdDrawIndexedIndirect = VKEL_TABLE_MEMBER(pTable, CmdDrawIndexedIndirect);
+	vkelTable.CmdDispatch = VKEL_TABLE_MEMBER(pTable, CmdDispatch);
+	vkelTable.CmdDispatchIndirect = VKEL_TABLE_MEMBER(pTable, CmdDispatchIndirect);
+	vkelTable.CmdCopyBuffer = VKEL_TABLE_MEMBER(pTable, CmdCopyBuffer);
+	vkelTable.CmdCopyImage = VKEL_TABLE_MEMBER(pTable, CmdCopyImage);
+	vkelTable.CmdBlitImage = VKEL_TABLE_MEMBER(pTable, CmdBlitImage);
+	vkelTable.CmdCopyBufferToImage = VKEL_TABLE_MEMBER(pTable, CmdCopyBufferToImage);
+	vkelTable.CmdCopyImageToBuffer = VKEL_TABLE_MEMBER(pTable, CmdCopyImageToBuffer);
+	vkelTable.CmdUpdateBuffer = VKEL_TABLE_MEMBER(pTable, CmdUpdateBuffer);
+	vkelTable.CmdFillBuffer = VKEL_TABLE_MEMBER(pTable, CmdFillBuffer);
+	vkelTable.CmdClearColorImage = VKEL_TABLE_MEMBER(pTable, CmdClearColorImage);
+	vkelTable.CmdClearDepthStencilImage = VKEL_TABLE_MEMBER(pTable, CmdClearDepthStencilImage);
+	vkelTable.CmdClearAttachments = VKEL_TABLE_MEMBER(pTable, CmdClearAttachments);
+	vkelTable.CmdResolveImage = VKEL_TABLE_MEMBER(pTable, CmdResolveImage);
+	vkelTable.CmdSetEvent = VKEL_TABLE_MEMBER(pTable, CmdSetEvent);
+	vkelTable.CmdResetEvent = VKEL_TABLE_MEMBER(pTable, CmdResetEvent);
+	vkelTable.CmdWaitEvents = VKEL_TABLE_MEMBER(pTable, CmdWaitEvents);
+	vkelTable.CmdPipelineBarrier = VKEL_TABLE_MEMBER(pTable, CmdPipelineBarrier);
+	vkelTable.CmdBeginQuery = VKEL_TABLE_MEMBER(pTable, CmdBeginQuery);
+	vkelTable.CmdEndQuery = VKEL_TABLE_MEMBER(pTable, CmdEndQuery);
+	vkelTable.CmdResetQueryPool = VKEL_TABLE_MEMBER(pTable, CmdResetQueryPool);
+	vkelTable.CmdWriteTimestamp = VKEL_TABLE_MEMBER(pTable, CmdWriteTimestamp);
+	vkelTable.CmdCopyQueryPoolResults = VKEL_TABLE_MEMBER(pTable, CmdCopyQueryPoolResults);
+	vkelTable.CmdPushConstants = VKEL_TABLE_MEMBER(pTable, CmdPushConstants);
+	vkelTable.CmdBeginRenderPass = VKEL_TABLE_MEMBER(pTable, CmdBeginRenderPass);
+	vkelTable.CmdNextSubpass = VKEL_TABLE_MEMBER(pTable, CmdNextSubpass);
+	vkelTable.CmdEndRenderPass = VKEL_TABLE_MEMBER(pTable, CmdEndRenderPass);
+	vkelTable.CmdExecuteCommands = VKEL_TABLE_MEMBER(pTable, CmdExecuteCommands);
+	vkelTable.DestroySurfaceKHR = VKEL_TABLE_MEMBER(pTable, DestroySurfaceKHR);
+	vkelTable.GetPhysicalDeviceSurfaceSupportKHR = VKEL_TABLE_MEMBER(pTable, GetPhysicalDeviceSurfaceSupportKHR);
+	vkelTable.GetPhysicalDeviceSurfaceCapabilitiesKHR = VKEL_TABLE_MEMBER(pTable, GetPhysicalDeviceSurfaceCapabilitiesKHR);
+	vkelTable.GetPhysicalDeviceSurfaceFormatsKHR = VKEL_TABLE_MEMBER(pTable, GetPhysicalDeviceSurfaceFormatsKHR);
+	vkelTable.GetPhysicalDeviceSurfacePresentModesKHR = VKEL_TABLE_MEMBER(pTable, GetPhysicalDeviceSurfacePresentModesKHR);
+	vkelTable.CreateSwapchainKHR = VKEL_TABLE_MEMBER(pTable, CreateSwapchainKHR);
+	vkelTable.DestroySwapchainKHR = VKEL_TABLE_MEMBER(pTable, DestroySwapchainKHR);
+	vkelTable.GetSwapchainImagesKHR = VKEL_TABLE_MEMBER(pTable, GetSwapchainImagesKHR);
+	vkelTable.AcquireNextImageKHR = VKEL_TABLE_MEMBER(pTable, AcquireNextImageKHR);
+	vkelTable.QueuePresentKHR = VKEL_TABLE_MEMBER(pTable, QueuePresentKHR);
+	vkelTable.GetPhysicalDeviceDisplayPropertiesKHR = VKEL_TABLE_MEMBER(pTable, GetPhysicalDeviceDisplayPropertiesKHR);
+	vkelTable.GetPhysicalDeviceDisplayPlanePropertiesKHR = VKEL_TABLE_MEMBER(pTable, GetPhysicalDeviceDisplayPlanePropertiesKHR);
+	vkelTable.GetDisplayPlaneSupportedDisplaysKHR = VKEL_TABLE_MEMBER(pTable, GetDisplayPlaneSupportedDisplaysKHR);
+	vkelTable.GetDisplayModePropertiesKHR = VKEL_TABLE_MEMBER(pTable, GetDisplayModePropertiesKHR);
+	vkelTable.CreateDisplayModeKHR = VKEL_TABLE_MEMBER(pTable, CreateDisplayModeKHR);
+	vkelTable.GetDisplayPlaneCapabilitiesKHR = VKEL_TABLE_MEMBER(pTable, GetDisplayPlaneCapabilitiesKHR);
+	vkelTable.CreateDisplayPlaneSurfaceKHR = VKEL_TABLE_MEMBER(pTable, CreateDisplayPlaneSurfaceKHR);
+	vkelTable.CreateSharedSwapchainsKHR = VKEL_TABLE_MEMBER(pTable, CreateSharedSwapchainsKHR);
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+	vkelTable.CreateXlibSurfaceKHR = VKEL_TABLE_MEMBER(pTable, CreateXlibSurfaceKHR);
+#endif /* VK_USE_PLATFORM_XLIB_KHR */
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+	vkelTable.GetPhysicalDeviceXlibPresentationSupportKHR = VKEL_TABLE_MEMBER(pTable, GetPhysicalDeviceXlibPresentationSupportKHR);
+#endif /* VK_USE_PLATFORM_XLIB_KHR */
+#ifdef VK_USE_PLATFORM_XCB_KHR
+	vkelTable.CreateXcbSurfaceKHR = VKEL_TABLE_MEMBER(pTable, CreateXcbSurfaceKHR);
+#endif /* VK_USE_PLATFORM_XCB_KHR */
+#ifdef VK_USE_PLATFORM_XCB_KHR
+	vkelTable.GetPhysicalDeviceXcbPresentationSupportKHR = VKEL_TABLE_MEMBER(pTable, GetPhysicalDeviceXcbPresentationSupportKHR);
+#endif /* VK_USE_PLATFORM_XCB_KHR */
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+	vkelTable.CreateWaylandSurfaceKHR = VKEL_TABLE_MEMBER(pTable, CreateWaylandSurfaceKHR);
+#endif /* VK_USE_PLATFORM_WAYLAND_KHR */
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+	vkelTable.GetPhysicalDeviceWaylandPresentationSupportKHR = VKEL_TABLE_MEMBER(pTable, GetPhysicalDeviceWaylandPresentationSupportKHR);
+#endif /* VK_USE_PLATFORM_WAYLAND_KHR */
+#ifdef VK_USE_PLATFORM_MIR_KHR
+	vkelTable.CreateMirSurfaceKHR = VKEL_TABLE_MEMBER(pTable, CreateMirSurfaceKHR);
+#endif /* VK_USE_PLATFORM_MIR_KHR */
+#ifdef VK_USE_PLATFORM_MIR_KHR
+	vkelTable.GetPhysicalDeviceMirPresentationSupportKHR = VKEL_TABLE_MEMBER(pTable, GetPhysicalDeviceMirPresentationSupportKHR);
+#endif /* VK_USE_PLATFORM_MIR_KHR */
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+	vkelTable.CreateAndroidSurfaceKHR = VKEL_TABLE_MEMBER(pTable, CreateAndroidSurfaceKHR);
+#endif /* VK_USE_PLATFORM_ANDROID_KHR */
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+	vkelTable.CreateWin32SurfaceKHR = VKEL_TABLE_MEMBER(pTable, CreateWin32SurfaceKHR);
+#endif /* VK_USE_PLATFORM_WIN32_KHR */
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+	vkelTable.GetPhysicalDeviceWin32PresentationSupportKHR = VKEL_TABLE_MEMBER(pTable, GetPhysicalDeviceWin32PresentationSupportKHR);
+#endif /* VK_USE_PLATFORM_WIN32_KHR */
+	vkelTable.CreateDebugReportCallbackEXT = VKEL_TABLE_MEMBER(pTable, CreateDebugReportCallbackEXT);
+	vkelTable.DestroyDebugReportCallbackEXT = VKEL_TABLE_MEMBER(pTable, DestroyDebugReportCallbackEXT);
+	vkelTable.DebugReportMessageEXT = VKEL_TABLE_MEMBER(pTable, DebugReportMessageEXT);
+	vkelTable.DebugMarkerSetObjectTagEXT = VKEL_TABLE_MEMBER(pTable, DebugMarkerSetObjectTagEXT);
+	vkelTable.DebugMarkerSetObjectNameEXT = VKEL_TABLE_MEMBER(pTable, DebugMarkerSetObjectNameEXT);
+	vkelTable.CmdDebugMarkerBeginEXT = VKEL_TABLE_MEMBER(pTable, CmdDebugMarkerBeginEXT);
+	vkelTable.CmdDebugMarkerEndEXT = VKEL_TABLE_MEMBER(pTable, CmdDebugMarkerEndEXT);
+	vkelTable.CmdDebugMarkerInsertEXT = VKEL_TABLE_MEMBER(pTable, CmdDebugMarkerInsertEXT);
+}
+
+
+static void vkelCopyCapabilityBits(uint32_t *pBits, uint32_t idCount, const uint32_t *pOtherBits, uint32_t otherIdCount)
+{
+	memset(pBits, 0, ((idCount + 31) / 32) * sizeof(uint32_t));
+	
+	if (!pOtherBits)
+		return;
+	
+	uint32_t id = 0;
+	for (id = 0; (id < idCount) && (id < otherIdCount); id++)
+		if (pOtherBits[id / 32] & (1u << (id % 32)))
+			pBits[id / 32] |= 1u << (id % 32);
+}
+
+
+const VkelTable* vkelGetTable(void)
+{
+	return (vkelTable.version == VKEL_TABLE_VERSION) ? &vkelTable : NULL;
+}
+
+VkBool32 vkelInitFromTable(const VkelTable *pTable)
+{
+	if (!pTable || (pTable->version != VKEL_TABLE_VERSION) || (pTable->size < offsetof(VkelTable, pDeviceLayers) + sizeof(pTable->pDeviceLayers)))
+		return VK_FALSE;
+	
+	// Sharing the table with itself
+	if (pTable == &vkelTable)
+		return VK_TRUE;
+	
+	
+	vkelUninit();
+	
+	vkelCopyTableProcs(pTable);
+	
+	vkelCopyCapabilityBits(vkelInstanceCapabilities.extensions, VKEL_EXT_ID_COUNT, pTable->pInstanceExtensions, pTable->extensionIdCount);
+	vkelCopyCapabilityBits(vkelInstanceCapabilities.layers, VKEL_LAYER_ID_COUNT, pTable->pInstanceLayers, pTable->layerIdCount);
+	VkelCapabilities deviceCapabilities;
+	
+	vkelCopyCapabilityBits(deviceCapabilities.extensions, VKEL_EXT_ID_COUNT, pTable->pDeviceExtensions, pTable->extensionIdCount);
+	vkelCopyCapabilityBits(deviceCapabilities.layers, VKEL_LAYER_ID_COUNT, pTable->pDeviceLayers, pTable->layerIdCount);
+	
+	// The device level functions shared are those of the other copy's vkelTable,
+	// as its device table is freed whenever it calls vkelDeviceInit()
+	if (!vkelPublishInstanceDevice(&deviceCapabilities))
+		return VK_FALSE;
+	
+	vkelSourceTable = pTable;
+	
+	vkelUpdateTable();
+	
+	
+	return VK_TRUE;
+}
+
+VkBool32 vkelInitShared(void)
+{
+	PFN_vkelGetSharedTable pfnGetSharedTable = NULL;
+	
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+	pfnGetSharedTable = (PFN_vkelGetSharedTable) GetProcAddress(GetModuleHandleA(NULL), "vkelGetSharedTable");
+#else
+	// The application and everything loaded with RTLD_GLOBAL
+	void *globalHandle = dlopen(NULL, RTLD_LAZY);
+	
+	if (globalHandle)
+	{
+		*(void**) (&pfnGetSharedTable) = dlsym(globalHandle, "vkelGetSharedTable");
+		dlclose(globalHandle);
+	}
+#endif
+	
+	if (pfnGetSharedTable && vkelInitFromTable(pfnGetSharedTable()))
+		return VK_TRUE;
+	
+	return vkelInit();
+}
+
+
+#ifdef VKEL_EXPORT_TABLE
+VKEL_EXPORT const VkelTable* vkelGetSharedTable(void)
+{
+	return vkelGetTable();
+}
+#endif /* VKEL_EXPORT_TABLE */
+
+
+static VkBool32 vkelInitProcs(void)
+{
+	vkelTable.AcquireNextImageKHR = (PFN_vkAcquireNextImageKHR) vkelGetProcAddr("vkAcquireNextImageKHR");
+	vkelTable.AllocateCommandBuffers = (PFN_vkAllocateCommandBuffers) vkelGetProcAddr("vkAllocateCommandBuffers");
+	vkelTable.AllocateDescriptorSets = (PFN_vkAllocateDescriptorSets) vkelGetProcAddr("vkAllocateDescriptorSets");
+	vkelTable.AllocateMemory = (PFN_vkAllocateMemory) vkelGetProcAddr("vkAllocateMemory");
+	vkelTable.BeginCommandBuffer = (PFN_vkBeginCommandBuffer) vkelGetProcAddr("vkBeginCommandBuffer");
+	vkelTable.BindBufferMemory = (PFN_vkBindBufferMemory) vkelGetProcAddr("vkBindBufferMemory");
+	vkelTable.BindImageMemory = (PFN_vkBindImageMemory) vkelGetProcAddr("vkBindImageMemory");
+	vkelTable.CmdBeginQuery = (PFN_vkCmdBeginQuery) vkelGetProcAddr("vkCmdBeginQuery");
+	vkelTable.CmdBeginRenderPass = (PFN_vkCmdBeginRenderPass) vkelGetProcAddr("vkCmdBeginRenderPass");
+	vkelTable.CmdBindDescriptorSets = (PFN_vkCmdBindDescriptorSets) vkelGetProcAddr("vkCmdBindDescriptorSets");
+	vkelTable.CmdBindIndexBuffer = (PFN_vkCmdBindIndexBuffer) vkelGetProcAddr("vkCmdBindIndexBuffer");
+	vkelTable.CmdBindPipeline = (PFN_vkCmdBindPipeline) vkelGetProcAddr("vkCmdBindPipeline");
+	vkelTable.CmdBindVertexBuffers = (PFN_vkCmdBindVertexBuffers) vkelGetProcAddr("vkCmdBindVertexBuffers");
+	vkelTable.CmdBlitImage = (PFN_vkCmdBlitImage) vkelGetProcAddr("vkCmdBlitImage");
+	vkelTable.CmdClearAttachments = (PFN_vkCmdClearAttachments) vkelGetProcAddr("vkCmdClearAttachments");
+	vkelTable.CmdClearColorImage = (PFN_vkCmdClearColorImage) vkelGetProcAddr("vkCmdClearColorImage");
+	vkelTable.CmdClearDepthStencilImage = (PFN_vkCmdClearDepthStencilImage) vkelGetProcAddr("vkCmdClearDepthStencilImage");
+	vkelTable.CmdCopyBuffer = (PFN_vkCmdCopyBuffer) vkelGetProcAddr("vkCmdCopyBuffer");
+	vkelTable.CmdCopyBufferToImage = (PFN_vkCmdCopyBufferToImage) vkelGetProcAddr("vkCmdCopyBufferToImage");
+	vkelTable.CmdCopyImage = (PFN_vkCmdCopyImage) vkelGetProcAddr("vkCmdCopyImage");
+	vkelTable.CmdCopyImageToBuffer = (PFN_vkCmdCopyImageToBuffer) vkelGetProcAddr("vkCmdCopyImageToBuffer");
+	vkelTable.CmdCopyQueryPoolResults = (PFN_vkCmdCopyQueryPoolResults) vkelGetProcAddr("vkCmdCopyQueryPoolResults");
+	vkelTable.CmdDebugMarkerBeginEXT = (PFN_vkCmdDebugMarkerBeginEXT) vkelGetProcAddr("vkCmdDebugMarkerBeginEXT");
+	vkelTable.CmdDebugMarkerEndEXT = (PFN_vkCmdDebugMarkerEndEXT) vkelGetProcAddr("vkCmdDebugMarkerEndEXT");
+	vkelTable.CmdDebugMarkerInsertEXT = (PFN_vkCmdDebugMarkerInsertEXT) vkelGetProcAddr("vkCmdDebugMarkerInsertEXT");
+	vkelTable.CmdDispatch = (PFN_vkCmdDispatch) vkelGetProcAddr("vkCmdDispatch");
+	vkelTable.CmdDispatchIndirect = (PFN_vkCmdDispatchIndirect) vkelGetProcAddr("vkCmdDispatchIndirect");
+	vkelTable.CmdDraw = (PFN_vkCmdDraw) vkelGetProcAddr("vkCmdDraw");
+	vkelTable.CmdDrawIndexed = (PFN_vkCmdDrawIndexed) vkelGetProcAddr("vkCmdDrawIndexed");
+	vkelTable.CmdDrawIndexedIndirect = (PFN_vkCmdDrawIndexedIndirect) vkelGetProcAddr("vkCmdDrawIndexedIndirect");
+	vkelTable.CmdDrawIndirect = (PFN_vkCmdDrawIndirect) vkelGetProcAddr("vkCmdDrawIndirect");
+	vkelTable.CmdEndQuery = (PFN_vkCmdEndQuery) vkelGetProcAddr("vkCmdEndQuery");
+	vkelTable.CmdEndRenderPass = (PFN_vkCmdEndRenderPass) vkelGetProcAddr("vkCmdEndRenderPass");
+	vkelTable.CmdExecuteCommands = (PFN_vkCmdExecuteCommands) vkelGetProcAddr("vkCmdExecuteCommands");
+	vkelTable.CmdFillBuffer = (PFN_vkCmdFillBuffer) vkelGetProcAddr("vkCmdFillBuffer");
+	vkelTable.CmdNextSubpass = (PFN_vkCmdNextSubpass) vkelGetProcAddr("vkCmdNextSubpass");
+	vkelTable.CmdPipelineBarrier = (PFN_vkCmdPipelineBarrier) vkelGetProcAddr("vkCmdPipelineBarrier");
+	vkelTable.CmdPushConstants = (PFN_vkCmdPushConstants) vkelGetProcAddr("vkCmdPushConstants");
+	vkelTable.CmdResetEvent = (PFN_vkCmdResetEvent) vkelGetProcAddr("vkCmdResetEvent");
+	vkelTable.CmdResetQueryPool = (PFN_vkCmdResetQueryPool) vkelGetProcAddr("vkCmdResetQueryPool");
+	vkelTable.CmdResolveImage = (PFN_vkCmdResolveImage) vkelGetProcAddr("vkCmdResolveImage");
+	vkelTable.CmdSetBlendConstants = (PFN_vkCmdSetBlendConstants) vkelGetProcAddr("vkCmdSetBlendConstants");
+	vkelTable.CmdSetDepthBias = (PFN_vkCmdSetDepthBias) vkelGetProcAddr("vkCmdSetDepthBias");
+	vkelTable.CmdSetDepthBounds = (PFN_vkCmdSetDepthBounds) vkelGetProcAddr("vkCmdSetDepthBounds");
+	vkelTable.CmdSetEvent = (PFN_vkCmdSetEvent) vkelGetProcAddr("vkCmdSetEvent");
+	vkelTable.CmdSetLineWidth = (PFN_vkCmdSetLineWidth) vkelGetProcAddr("vkCmdSetLineWidth");
+	vkelTable.CmdSetScissor = (PFN_vkCmdSetScissor) vkelGetProcAddr("vkCmdSetScissor");
+	vkelTable.CmdSetStencilCompareMask = (PFN_vkCmdSetStencilCompareMask) vkelGetProcAddr("vkCmdSetStencilCompareMask");
+	vkelTable.CmdSetStencilReference = (PFN_vkCmdSetStencilReference) vkelGetProcAddr("vkCmdSetStencilReference");
+	vkelTable.CmdSetStencilWriteMask = (PFN_vkCmdSetStencilWriteMask) vkelGetProcAddr("vkCmdSetStencilWriteMask");
+	vkelTable.CmdSetViewport = (PFN_vkCmdSetViewport) vkelGetProcAddr("vkCmdSetViewport");
+	vkelTable.CmdUpdateBuffer = (PFN_vkCmdUpdateBuffer) vkelGetProcAddr("vkCmdUpdateBuffer");
+	vkelTable.CmdWaitEvents = (PFN_vkCmdWaitEvents) vkelGetProcAddr("vkCmdWaitEvents");
+	vkelTable.CmdWriteTimestamp = (PFN_vkCmdWriteTimestamp) vkelGetProcAddr("vkCmdWriteTimestamp");
+	vkelTable.CreateBuffer = (PFN_vkCreateBuffer) vkelGetProcAddr("vkCreateBuffer");
+	vkelTable.CreateBufferView = (PFN_vkCreateBufferView) vkelGetProcAddr("vkCreateBufferView");
+	vkelTable.CreateCommandPool = (PFN_vkCreateCommandPool) vkelGetProcAddr("vkCreateCommandPool");
+	vkelTable.CreateComputePipelines = (PFN_vkCreateComputePipelines) vkelGetProcAddr("vkCreateComputePipelines");
+	vkelTable.CreateDebugReportCallbackEXT = (PFN_vkCreateDebugReportCallbackEXT) vkelGetProcAddr("vkCreateDebugReportCallbackEXT");
+	vkelTable.CreateDescriptorPool = (PFN_vkCreateDescriptorPool) vkelGetProcAddr("vkCreateDescriptorPool");
+	vkelTable.CreateDescriptorSetLayout = (PFN_vkCreateDescriptorSetLayout) vkelGetProcAddr("vkCreateDescriptorSetLayout");
+	vkelTable.CreateDevice = (PFN_vkCreateDevice) vkelGetProcAddr("vkCreateDevice");
+	vkelTable.CreateDisplayModeKHR = (PFN_vkCreateDisplayModeKHR) vkelGetProcAddr("vkCreateDisplayModeKHR");
+	vkelTable.CreateDisplayPlaneSurfaceKHR = (PFN_vkCreateDisplayPlaneSurfaceKHR) vkelGetProcAddr("vkCreateDisplayPlaneSurfaceKHR");
+	vkelTable.CreateEvent = (PFN_vkCreateEvent) vkelGetProcAddr("vkCreateEvent");
+	vkelTable.CreateFence = (PFN_vkCreateFence) vkelGetProcAddr("vkCreateFence");
+	vkelTable.CreateFramebuffer = (PFN_vkCreateFramebuffer) vkelGetProcAddr("vkCreateFramebuffer");
+	vkelTable.CreateGraphicsPipelines = (PFN_vkCreateGraphicsPipelines) vkelGetProcAddr("vkCreateGraphicsPipelines");
+	vkelTable.CreateImage = (PFN_vkCreateImage) vkelGetProcAddr("vkCreateImage");
+	vkelTable.CreateImageView = (PFN_vkCreateImageView) vkelGetProcAddr("vkCreateImageView");
+	vkelTable.CreateInstance = (PFN_vkCreateInstance) vkelGetProcAddr("vkCreateInstance");
+	vkelTable.CreatePipelineCache = (PFN_vkCreatePipelineCache) vkelGetProcAddr("vkCreatePipelineCache");
+	vkelTable.CreatePipelineLayout = (PFN_vkCreatePipelineLayout) vkelGetProcAddr("vkCreatePipelineLayout");
+	vkelTable.CreateQueryPool = (PFN_vkCreateQueryPool) vkelGetProcAddr("vkCreateQueryPool");
+	vkelTable.CreateRenderPass = (PFN_vkCreateRenderPass) vkelGetProcAddr("vkCreateRenderPass");
+	vkelTable.CreateSampler = (PFN_vkCreateSampler) vkelGetProcAddr("vkCreateSampler");
+	vkelTable.CreateSemaphore = (PFN_vkCreateSemaphore) vkelGetProcAddr("vkCreateSemaphore");
+	vkelTable.CreateShaderModule = (PFN_vkCreateShaderModule) vkelGetProcAddr("vkCreateShaderModule");
+	vkelTable.CreateSharedSwapchainsKHR = (PFN_vkCreateSharedSwapchainsKHR) vkelGetProcAddr("vkCreateSharedSwapchainsKHR");
+	vkelTable.CreateSwapchainKHR = (PFN_vkCreateSwapchainKHR) vkelGetProcAddr("vkCreateSwapchainKHR");
+	vkelTable.DebugMarkerSetObjectNameEXT = (PFN_vkDebugMarkerSetObjectNameEXT) vkelGetProcAddr("vkDebugMarkerSetObjectNameEXT");
+	vkelTable.DebugMarkerSetObjectTagEXT = (PFN_vkDebugMarkerSetObjectTagEXT) vkelGetProcAddr("vkDebugMarkerSetObjectTagEXT");
+	vkelTable.DebugReportMessageEXT = (PFN_vkDebugReportMessageEXT) vkelGetProcAddr("vkDebugReportMessageEXT");
+	vkelTable.DestroyBuffer = (PFN_vkDestroyBuffer) vkelGetProcAddr("vkDestroyBuffer");
+	vkelTable.DestroyBufferView = (PFN_vkDestroyBufferView) vkelGetProcAddr("vkDestroyBufferView");
+	vkelTable.DestroyCommandPool = (PFN_vkDestroyCommandPool) vkelGetProcAddr("vkDestroyCommandPool");
+	vkelTable.DestroyDebugReportCallbackEXT = (PFN_vkDestroyDebugReportCallbackEXT) vkelGetProcAddr("vkDestroyDebugReportCallbackEXT");
+	vkelTable.DestroyDescriptorPool = (PFN_vkDestroyDescriptorPool) vkelGetProcAddr("vkDestroyDescriptorPool");
+	vkelTable.DestroyDescriptorSetLayout = (PFN_vkDestroyDescriptorSetLayout) vkelGetProcAddr("vkDestroyDescriptorSetLayout");
+	vkelTable.DestroyDevice = (PFN_vkDestroyDevice) vkelGetProcAddr("vkDestroyDevice");
+	vkelTable.DestroyEvent = (PFN_vkDestroyEvent) vkelGetProcAddr("vkDestroyEvent");
+	vkelTable.DestroyFence = (PFN_vkDestroyFence) vkelGetProcAddr("vkDestroyFence");
+	vkelTable.DestroyFramebuffer = (PFN_vkDestroyFramebuffer) vkelGetProcAddr("vkDestroyFramebuffer");
+	vkelTable.DestroyImage = (PFN_vkDestroyImage) vkelGetProcAddr("vkDestroyImage");
+	vkelTable.DestroyImageView = (PFN_vkDestroyImageView) vkelGetProcAddr("vkDestroyImageView");
+	vkelTable.DestroyInstance = (PFN_vkDestroyInstance) vkelGetProcAddr("vkDestroyInstance");
+	vkelTable.DestroyPipeline = (PFN_vkDestroyPipeline) vkelGetProcAddr("vkDestroyPipeline");
+	vkelTable.DestroyPipelineCache = (PFN_vkDestroyPipelineCache) vkelGetProcAddr("vkDestroyPipelineCache");
+	vkelTable.DestroyPipelineLayout = (PFN_vkDestroyPipelineLayout) vkelGetProcAddr("vkDestroyPipelineLayout");
+	vkelTable.DestroyQueryPool = (PFN_vkDestroyQueryPool) vkelGetProcAddr("vkDestroyQueryPool");
+	vkelTable.DestroyRenderPass = (PFN_vkDestroyRenderPass) vkelGetProcAddr("vkDestroyRenderPass");
+	vkelTable.DestroySampler = (PFN_vkDestroySampler) vkelGetProcAddr("vkDestroySampler");
+	vkelTable.DestroySemaphore = (PFN_vkDestroySemaphore) vkelGetProcAddr("vkDestroySemaphore");
+	vkelTable.DestroyShaderModule = (PFN_vkDestroyShaderModule) vkelGetProcAddr("vkDestroyShaderModule");
+	vkelTable.DestroySurfaceKHR = (PFN_vkDestroySurfaceKHR) vkelGetProcAddr("vkDestroySurfaceKHR");
+	vkelTable.DestroySwapchainKHR = (PFN_vkDestroySwapchainKHR) vkelGetProcAddr("vkDestroySwapchainKHR");
+	vkelTable.DeviceWaitIdle = (PFN_vkDeviceWaitIdle) vkelGetProcAddr("vkDeviceWaitIdle");
+	vkelTable.EndCommandBuffer = (PFN_vkEndCommandBuffer) vkelGetProcAddr("vkEndCommandBuffer");
+	vkelTable.EnumerateDeviceExtensionProperties = (PFN_vkEnumerateDeviceExtensionProperties) vkelGetProcAddr("vkEnumerateDeviceExtensionProperties");
+	vkelTable.EnumerateDeviceLayerProperties = (PFN_vkEnumerateDeviceLayerProperties) vkelGetProcAddr("vkEnumerateDeviceLayerProperties");
+	vkelTable.EnumerateInstanceExtensionProperties = (PFN_vkEnumerateInstanceExtensionProperties) vkelGetProcAddr("vkEnumerateInstanceExtensionProperties");
+	vkelTable.EnumerateInstanceLayerProperties = (PFN_vkEnumerateInstanceLayerProperties) vkelGetProcAddr("vkEnumerateInstanceLayerProperties");
+	vkelTable.EnumeratePhysicalDevices = (PFN_vkEnumeratePhysicalDevices) vkelGetProcAddr("vkEnumeratePhysicalDevices");
+	vkelTable.FlushMappedMemoryRanges = (PFN_vkFlushMappedMemoryRanges) vkelGetProcAddr("vkFlushMappedMemoryRanges");
+	vkelTable.FreeCommandBuffers = (PFN_vkFreeCommandBuffers) vkelGetProcAddr("vkFreeCommandBuffers");
+	vkelTable.FreeDescriptorSets = (PFN_vkFreeDescriptorSets) vkelGetProcAddr("vkFreeDescriptorSets");
+	vkelTable.FreeMemory = (PFN_vkFreeMemory) vkelGetProcAddr("vkFreeMemory");
+	vkelTable.GetBufferMemoryRequirements = (PFN_vkGetBufferMemoryRequirements) vkelGetProcAddr("vkGetBufferMemoryRequirements");
+	vkelTable.GetDeviceMemoryCommitment = (PFN_vkGetDeviceMemoryCommitment) vkelGetProcAddr("vkGetDeviceMemoryCommitment");
+	vkelTable.GetDeviceProcAddr = (PFN_vkGetDeviceProcAddr) vkelGetProcAddr("vkGetDeviceProcAddr");
+	vkelTable.GetDeviceQueue = (PFN_vkGetDeviceQueue) vkelGetProcAddr("vkGetDeviceQueue");
+	vkelTable.GetDisplayModePropertiesKHR = (PFN_vkGetDisplayModePropertiesKHR) vkelGetProcAddr("vkGetDisplayModePropertiesKHR");
+	vkelTable.GetDisplayPlaneCapabilitiesKHR = (PFN_vkGetDisplayPlaneCapabilitiesKHR) vkelGetProcAddr("vkGetDisplayPlaneCapabilitiesKHR");
+	vkelTable.GetDisplayPlaneSupportedDisplaysKHR = (PFN_vkGetDisplayPlaneSupportedDisplaysKHR) vkelGetProcAddr("vkGetDisplayPlaneSupportedDisplaysKHR");
+	vkelTable.GetEventStatus = (PFN_vkGetEventStatus) vkelGetProcAddr("vkGetEventStatus");
+	vkelTable.GetFenceStatus = (PFN_vkGetFenceStatus) vkelGetProcAddr("vkGetFenceStatus");
+	vkelTable.GetImageMemoryRequirements = (PFN_vkGetImageMemoryRequirements) vkelGetProcAddr("vkGetImageMemoryRequirements");
+	vkelTable.GetImageSparseMemoryRequirements = (PFN_vkGetImageSparseMemoryRequirements) vkelGetProcAddr("vkGetImageSparseMemoryRequirements");
+	vkelTable.GetImageSubresourceLayout = (PFN_vkGetImageSubresourceLayout) vkelGetProcAddr("vkGetImageSubresourceLayout");
+	vkelTable.GetInstanceProcAddr = (PFN_vkGetInstanceProcAddr) vkelGetProcAddr("vkGetInstanceProcAddr");
+	vkelTable.GetPhysicalDeviceDisplayPlanePropertiesKHR = (PFN_vkGetPhysicalDeviceDisplayPlanePropertiesKHR) vkelGetProcAddr("vkGetPhysicalDeviceDisplayPlanePropertiesKHR");
+	vkelTable.GetPhysicalDeviceDisplayPropertiesKHR = (PFN_vkGetPhysicalDeviceDisplayPropertiesKHR) vkelGetProcAddr("vkGetPhysicalDeviceDisplayPropertiesKHR");
+	vkelTable.GetPhysicalDeviceFeatures = (PFN_vkGetPhysicalDeviceFeatures) vkelGetProcAddr("vkGetPhysicalDeviceFeatures");
+	vkelTable.GetPhysicalDeviceFormatProperties = (PFN_vkGetPhysicalDeviceFormatProperties) vkelGetProcAddr("vkGetPhysicalDeviceFormatProperties");
+	vkelTable.GetPhysicalDeviceImageFormatProperties = (PFN_vkGetPhysicalDeviceImageFormatProperties) vkelGetProcAddr("vkGetPhysicalDeviceImageFormatProperties");
+	vkelTable.GetPhysicalDeviceMemoryProperties = (PFN_vkGetPhysicalDeviceMemoryProperties) vkelGetProcAddr("vkGetPhysicalDeviceMemoryProperties");
+	vkelTable.GetPhysicalDeviceProperties = (PFN_vkGetPhysicalDeviceProperties) vkelGetProcAddr("vkGetPhysicalDeviceProperties");
+	vkelTable.GetPhysicalDeviceQueueFamilyProperties = (PFN_vkGetPhysicalDeviceQueueFamilyProperties) vkelGetProcAddr("vkGetPhysicalDeviceQueueFamilyProperties");
+	vkelTable.GetPhysicalDeviceSparseImageFormatProperties = (PFN_vkGetPhysicalDeviceSparseImageFormatProperties) vkelGetProcAddr("vkGetPhysicalDeviceSparseImageFormatProperties");
+	vkelTable.GetPhysicalDeviceSurfaceCapabilitiesKHR = (PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR) vkelGetProcAddr("vkGetPhysicalDeviceSurfaceCapabilitiesKHR");
+	vkelTable.GetPhysicalDeviceSurfaceFormatsKHR = (PFN_vkGetPhysicalDeviceSurfaceFormatsKHR) vkelGetProcAddr("vkGetPhysicalDeviceSurfaceFormatsKHR");
+	vkelTable.GetPhysicalDeviceSurfacePresentModesKHR = (PFN_vkGetPhysicalDeviceSurfacePresentModesKHR) vkelGetProcAddr("vkGetPhysicalDeviceSurfacePresentModesKHR");
+	vkelTable.GetPhysicalDeviceSurfaceSupportKHR = (PFN_vkGetPhysicalDeviceSurfaceSupportKHR) vkelGetProcAddr("vkGetPhysicalDeviceSurfaceSupportKHR");
+	vkelTable.GetPipelineCacheData = (PFN_vkGetPipelineCacheData) vkelGetProcAddr("vkGetPipelineCacheData");
+	vkelTable.GetQueryPoolResults = (PFN_vkGetQueryPoolResults) vkelGetProcAddr("vkGetQueryPoolResults");
+	vkelTable.GetRenderAreaGranularity = (PFN_vkGetRenderAreaGranularity) vkelGetProcAddr("vkGetRenderAreaGranularity");
+	vkelTable.GetSwapchainImagesKHR = (PFN_vkGetSwapchainImagesKHR) vkelGetProcAddr("vkGetSwapchainImagesKHR");
+	vkelTable.InvalidateMappedMemoryRanges = (PFN_vkInvalidateMappedMemoryRanges) vkelGetProcAddr("vkInvalidateMappedMemoryRanges");
+	vkelTable.MapMemory = (PFN_vkMapMemory) vkelGetProcAddr("vkMapMemory");
+	vkelTable.MergePipelineCaches = (PFN_vkMergePipelineCaches) vkelGetProcAddr("vkMergePipelineCaches");
+	vkelTable.QueueBindSparse = (PFN_vkQueueBindSparse) vkelGetProcAddr("vkQueueBindSparse");
+	vkelTable.QueuePresentKHR = (PFN_vkQueuePresentKHR) vkelGetProcAddr("vkQueuePresentKHR");
+	vkelTable.QueueSubmit = (PFN_vkQueueSubmit) vkelGetProcAddr("vkQueueSubmit");
+	vkelTable.QueueWaitIdle = (PFN_vkQueueWaitIdle) vkelGetProcAddr("vkQueueWaitIdle");
+	vkelTable.ResetCommandBuffer = (PFN_vkResetCommandBuffer) vkelGetProcAddr("vkResetCommandBuffer");
+	vkelTable.ResetCommandPool = (PFN_vkResetCommandPool) vkelGetProcAddr("vkResetCommandPool");
+	vkelTable.ResetDescriptorPool = (PFN_vkResetDescriptorPool) vkelGetProcAddr("vkResetDescriptorPool");
+	vkelTable.ResetEvent = (PFN_vkResetEvent) vkelGetProcAddr("vkResetEvent");
+	vkelTable.ResetFences = (PFN_vkResetFences) vkelGetProcAddr("vkResetFences");
+	vkelTable.SetEvent = (PFN_vkSetEvent) vkelGetProcAddr("vkSetEvent");
+	vkelTable.UnmapMemory = (PFN_vkUnmapMemory) vkelGetProcAddr("vkUnmapMemory");
+	vkelTable.UpdateDescriptorSets = (PFN_vkUpdateDescriptorSets) vkelGetProcAddr("vkUpdateDescriptorSets");
+	vkelTable.WaitForFences = (PFN_vkWaitForFences) vkelGetProcAddr("vkWaitForFences");
+
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+	vkelTable.CreateAndroidSurfaceKHR = (PFN_vkCreateAndroidSurfaceKHR) vkelGetProcAddr("vkCreateAndroidSurfaceKHR");
+#endif /* VK_USE_PLATFORM_ANDROID_KHR */
+
+#ifdef VK_USE_PLATFORM_MIR_KHR
+	vkelTable.CreateMirSurfaceKHR = (PFN_vkCreateMirSurfaceKHR) vkelGetProcAddr("vkCreateMirSurfaceKHR");
+	vkelTable.GetPhysicalDeviceMirPresentationSupportKHR = (PFN_vkGetPhysicalDeviceMirPresentationSupportKHR) vkelGetProcAddr("vkGetPhysicalDeviceMirPresentationSupportKHR");
+#endif /* VK_USE_PLATFORM_MIR_KHR */
+
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+	vkelTable.CreateWaylandSurfaceKHR = (PFN_vkCreateWaylandSurfaceKHR) vkelGetProcAddr("vkCreateWaylandSurfaceKHR");
+	vkelTable.GetPhysicalDeviceWaylandPresentationSupportKHR = (PFN_vkGetPhysicalDeviceWaylandPresentationSupportKHR) vkelGetProcAddr("vkGetPhysicalDeviceWaylandPresentationSupportKHR");
+#endif /* VK_USE_PLATFORM_WAYLAND_KHR */
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+	vkelTable.CreateWin32SurfaceKHR = (PFN_vkCreateWin32SurfaceKHR) vkelGetProcAddr("vkCreateWin32SurfaceKHR");
+	vkelTable.GetPhysicalDeviceWin32PresentationSupportKHR = (PFN_vkGetPhysicalDeviceWin32PresentationSupportKHR) vkelGetProcAddr("vkGetPhysicalDeviceWin32PresentationSupportKHR");
+#endif /* VK_USE_PLATFORM_WIN32_KHR */
+
+#ifdef VK_USE_PLATFORM_XCB_KHR
+	vkelTable.CreateXcbSurfaceKHR = (PFN_vkCreateXcbSurfaceKHR) vkelGetProcAddr("vkCreateXcbSurfaceKHR");
+	vkelTable.GetPhysicalDeviceXcbPresentationSupportKHR = (PFN_vkGetPhysicalDeviceXcbPresentationSupportKHR) vkelGetProcAddr("vkGetPhysicalDeviceXcbPresentationSupportKHR");
+#endif /* VK_USE_PLATFORM_XCB_KHR */
+
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+	vkelTable.CreateXlibSurfaceKHR = (PFN_vkCreateXlibSurfaceKHR) vkelGetProcAddr("vkCreateXlibSurfaceKHR");
+	vkelTable.GetPhysicalDeviceXlibPresentationSupportKHR = (PFN_vkGetPhysicalDeviceXlibPresentationSupportKHR) vkelGetProcAddr("vkGetPhysicalDeviceXlibPresentationSupportKHR");
+#endif /* VK_USE_PLATFORM_XLIB_KHR */
+
+
+	vkelGetInstanceSupport(&vkelInstanceCapabilities);
+
+	if (!vkelPublishInstanceDevice(NULL))
+		return VK_FALSE;
+
+#ifdef VKEL_RECORD_USAGE
+	vkelRecordUsageProcs();
+#endif
+
+	vkelUpdateTable();
+
+	
+	return VK_TRUE;
+}
+	
+VkBool32 vkelInit(void)
+{
+	// Already loaded from the Vulkan library, the functions
+	// and instance level results are all still valid
+	if (vkelVkLibHandle && !vkelIcdGetInstanceProcAddr)
+		return VK_TRUE;
+	
+	vkelUninit();
+	
+	vkelVkLibHandle = vkelPlatformOpenLibrary(VKEL_PLATFORM_LIBRARY_NAME);
+	
+	if (!vkelVkLibHandle)
+		return VK_FALSE;
+	
+	return vkelInitProcs();
+}
+
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+#	define VKEL_PATH_LIST_SEPARATOR ';'
+#else
+#	define VKEL_PATH_LIST_SEPARATOR ':'
+#endif
+
+#define VKEL_MAX_PATH 4096
+
+// Highest loader/ICD interface version vkel knows about, 3 and
+// above means that the ICD creates its own VkSurfaceKHR objects
+#define VKEL_ICD_INTERFACE_VERSION 5
+
+typedef VkResult (VKAPI_PTR *PFN_vkelNegotiateLoaderICDInterfaceVersion)(uint32_t *pVersion);
+
+
+static VkBool32 vkelIsAbsolutePath(const char *path)
+{
+	if ((path[0] == '/') || (path[0] == '\\'))
+		return VK_TRUE;
+	
+	// Windows drive letter, e.g. "C:"
+	if (path[0] && (path[1] == ':'))
+		return VK_TRUE;
+	
+	return VK_FALSE;
+}
+
+// Read "library_path" from an ICD manifest, a relative path is resolved relative
+// to the manifest, while a plain file name is left for the OS to search for
+static VkBool32 vkelReadIcdLibraryPath(const char *pManifestPath, char *pLibraryPath)
+{
+	FILE *file = fopen(pManifestPath, "rb");
+	
+	if (!file)
+		return VK_FALSE;
+	
+	fseek(file, 0, SEEK_END);
+	long size = ftell(file);
+	fseek(file, 0, SEEK_SET);
+	
+	if (size < 1)
+	{
+		fclose(file);
+		return VK_FALSE;
+	}
+	
+	char *manifest = (char*) vkel_malloc((size_t) size + 1, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+	
+	if (!manifest)
+	{
+		fclose(file);
+		return VK_FALSE;
+	}
+	
+	size = (long) fread(manifest, 1, (size_t) size, file);
+	manifest[size] = '\0';
+	
+	fclose(file);
+	
+	
+	VkBool32 found = VK_FALSE;
+	
+	const char *value = strstr(manifest, "\"library_path\"");
+	
+	if (value)
+	{
+		value += sizeof("\"library_path\"") - 1;
+		
+		while ((*value == ' ') || (*value == '\t') || (*value == '\r') || (*value == '\n') || (*value == ':'))
+			value++;
+		
+		if (*value == '"')
+		{
+			value++;
+			
+			size_t length = 0;
+			
+			const char *separator = strrchr(pManifestPath, '/');
+			
+			if (!separator)
+				separator = strrchr(pManifestPath, '\\');
+			
+			const char *slash = value;
+			
+			while (*slash && (*slash != '"') && (*slash != '/') && (*slash != '\\'))
+				slash++;
+			
+			// Relative to the directory containing the manifest
+			if (separator && ((*slash == '/') || (*slash == '\\')) && !vkelIsAbsolutePath(value))
+			{
+				length = (size_t) (separator - pManifestPath) + 1;
+				
+				// A directory that doesn't fit can't be cut short either
+				if (length >= VKEL_MAX_PATH)
+				{
+					vkel_free(manifest);
+					return VK_FALSE;
+				}
+				
+				memcpy(pLibraryPath, pManifestPath, length);
+			}
+			
+			while (*value && (*value != '"') && (length < (VKEL_MAX_PATH - 1)))
+			{
+				// JSON escapes, e.g. "C:\\Windows\\..." and "\/usr\/lib\/..."
+				if ((*value == '\\') && value[1])
+					value++;
+				
+				pLibraryPath[length++] = *value++;
+			}
+			
+			pLibraryPath[length] = '\0';
+			
+			// Stopping anywhere but the closing quote means the path didn't fit
+			found = (*value == '"') && (length > 0);
+		}
+	}
+	
+	vkel_free(manifest);
+	
+	return found;
+}
+
+// Open an ICD library and negotiate the interface version with it
+static void* vkelOpenIcdLibrary(const char *pLibraryPath, PFN_vkGetInstanceProcAddr *pIcdGetInstanceProcAddr)
+{
+	void *handle = vkelPlatformOpenLibrary(pLibraryPath);
+	
+	if (!handle)
+		return NULL;
+	
+	PFN_vkGetInstanceProcAddr icdGetInstanceProcAddr = (PFN_vkGetInstanceProcAddr) vkelPlatformGetProcAddr(handle, "vk_icdGetInstanceProcAddr");
+	
+	if (!icdGetInstanceProcAddr)
+	{
+		vkelPlatformCloseLibrary(handle);
+		return NULL;
+	}
+	
+	PFN_vkelNegotiateLoaderICDInterfaceVersion icdNegotiateLoaderICDInterfaceVersion = (PFN_vkelNegotiateLoaderICDInterfaceVersion) vkelPlatformGetProcAddr(handle, "vk_icdNegotiateLoaderICDInterfaceVersion");
+	
+	if (icdNegotiateLoaderICDInterfaceVersion)
+	{
+		uint32_t version = VKEL_ICD_INTERFACE_VERSION;
+		
+		if (icdNegotiateLoaderICDInterfaceVersion(&version) != VK_SUCCESS)
+		{
+			vkelPlatformCloseLibrary(handle);
+			return NULL;
+		}
+	}
+	
+	*pIcdGetInstanceProcAddr = icdGetInstanceProcAddr;
+	
+	return handle;
+}
+
+static VkBool32 vkelOpenIcd(const char *pManifestPath)
+{
+	char libraryPath[VKEL_MAX_PATH];
+	
+	if (!vkelReadIcdLibraryPath(pManifestPath, libraryPath))
+		return VK_FALSE;
+	
+	PFN_vkGetInstanceProcAddr icdGetInstanceProcAddr = NULL;
+	
+	void *handle = vkelOpenIcdLibrary(libraryPath, &icdGetInstanceProcAddr);
+	
+	if (!handle)
+		return VK_FALSE;
+	
+	vkelVkLibHandle = handle;
+	vkelIcdGetInstanceProcAddr = icdGetInstanceProcAddr;
+	
+	return VK_TRUE;
+}
+
+typedef VkBool32 (*PFN_vkelVisitPath)(const char *pPath, void *pUserData);
+
+// Visit each path of a VKEL_PATH_LIST_SEPARATOR separated list, until pfnVisit returns VK_TRUE
+static VkBool32 vkelVisitPathList(const char *pPaths, PFN_vkelVisitPath pfnVisit, void *pUserData)
+{
+	char path[VKEL_MAX_PATH];
+	
+	while (*pPaths)
+	{
+		size_t length = 0;
+		VkBool32 truncated = VK_FALSE;
+		
+		while (*pPaths && (*pPaths != VKEL_PATH_LIST_SEPARATOR))
+		{
+			if (length < (VKEL_MAX_PATH - 1))
+				path[length++] = *pPaths;
+			else
+				truncated = VK_TRUE;
+			
+			pPaths++;
+		}
+		
+		path[length] = '\0';
+		
+		if (*pPaths)
+			pPaths++;
+		
+		// Paths that don't fit are skipped, rather than visiting some other path they were cut to
+		if ((length > 0) && !truncated && pfnVisit(path, pUserData))
+			return VK_TRUE;
+	}
+	
+	return VK_FALSE;
+}
+
+// Visit each ICD manifest in a directory, until pfnVisit returns VK_TRUE
+static VkBool32 vkelVisitIcdDirectory(const char *pDirectory, PFN_vkelVisitPath pfnVisit, void *pUserData)
+{
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+	// ICDs are registered in the registry on Windows, use VK_ICD_FILENAMES
+	(void) pDirectory;
+	(void) pfnVisit;
+	(void) pUserData;
+	
+	return VK_FALSE;
+#else
+	DIR *directory = opendir(pDirectory);
+	
+	if (!directory)
+		return VK_FALSE;
+	
+	VkBool32 done = VK_FALSE;
+	
+	char manifestPath[VKEL_MAX_PATH];
+	
+	struct dirent *entry;
+	while (!done && (entry = readdir(directory)))
+	{
+		size_t length = strlen(entry->d_name);
+		
+		if ((length < 5) || strcmp(entry->d_name + length - 5, ".json"))
+			continue;
+		
+		if (snprintf(manifestPath, VKEL_MAX_PATH, "%s/%s", pDirectory, entry->d_name) >= VKEL_MAX_PATH)
+			continue;
+		
+		done = pfnVisit(manifestPath, pUserData);
+	}
+	
+	closedir(directory);
+	
+	return done;
+#endif
+}
+
+static VkBool32 vkelVisitOpenIcd(const char *pManifestPath, void *pUserData)
+{
+	(void) pUserData;
+	
+	return vkelOpenIcd(pManifestPath);
+}
+
+
+VkBool32 vkelInitDirectICD(const char *pManifestPath)
+{
+	vkelUninit();
+	
+	VkBool32 opened = VK_FALSE;
+	
+	if (pManifestPath)
+		opened = vkelOpenIcd(pManifestPath);
+	else
+	{
+		// Same as the Vulkan loader, VK_ICD_FILENAMES replaces the search
+		const char *icdFilenames = getenv("VK_ICD_FILENAMES");
+		
+		if (icdFilenames)
+			opened = vkelVisitPathList(icdFilenames, vkelVisitOpenIcd, NULL);
+		else
+			opened = vkelVisitIcdDirectory("/usr/share/vulkan/icd.d", vkelVisitOpenIcd, NULL) || vkelVisitIcdDirectory("/etc/vulkan/icd.d", vkelVisitOpenIcd, NULL);
+	}
+	
+	if (!opened)
+		return VK_FALSE;
+	
+	return vkelInitProcs();
+}
+	
+VkBool32 vkelInstanceInit(VkInstance instance)
+{
+	if (!vkelVkLibHandle && !vkelSourceTable && !vkelInit())
+		return VK_FALSE;
+	
+	
+	vkelTable.AcquireNextImageKHR = (PFN_vkAcquireNextImageKHR) vkelGetInstanceProcAddr(instance, "vkAcquireNextImageKHR");
+	vkelTable.AllocateCommandBuffers = (PFN_vkAllocateCommandBuffers) vkelGetInstanceProcAddr(instance, "vkAllocateCommandBuffers");
+	vkelTable.AllocateDescriptorSets = (PFN_vkAllocateDescriptorSets) vkelGetInstanceProcAddr(instance, "vkAllocateDescriptorSets");
+	vkelTable.AllocateMemory = (PFN_vkAllocateMemory) vkelGetInstanceProcAddr(instance, "vkAllocateMemory");
+	vkelTable.BeginCommandBuffer = (PFN_vkBeginCommandBuffer) vkelGetInstanceProcAddr(instance, "vkBeginCommandBuffer");
+	vkelTable.BindBufferMemory = (PFN_vkBindBufferMemory) vkelGetInstanceProcAddr(instance, "vkBindBufferMemory");
+	vkelTable.BindImageMemory = (PFN_vkBindImageMemory) vkelGetInstanceProcAddr(instance, "vkBindImageMemory");
+	vkelTable.CmdBeginQuery = (PFN_vkCmdBeginQuery) vkelGetInstanceProcAddr(instance, "vkCmdBeginQuery");
+	vkelTable.CmdBeginRenderPass = (PFN_vkCmdBeginRenderPass) vkelGetInstanceProcAddr(instance, "vkCmdBeginRenderPass");
+	vkelTable.CmdBindDescriptorSets = (PFN_vkCmdBindDescriptorSets) vkelGetInstanceProcAddr(instance, "vkCmdBindDescriptorSets");
+	vkelTable.CmdBindIndexBuffer = (PFN_vkCmdBindIndexBuffer) vkelGetInstanceProcAddr(instance, "vkCmdBindIndexBuffer");
+	vkelTable.CmdBindPipeline = (PFN_vkCmdBindPipeline) vkelGetInstanceProcAddr(instance, "vkCmdBindPipeline");
+	vkelTable.CmdBindVertexBuffers = (PFN_vkCmdBindVertexBuffers) vkelGetInstanceProcAddr(instance, "vkCmdBindVertexBuffers");
+	vkelTable.CmdBlitImage = (PFN_vkCmdBlitImage) vkelGetInstanceProcAddr(instance, "vkCmdBlitImage");
+	vkelTable.CmdClearAttachments = (PFN_vkCmdClearAttachments) vkelGetInstanceProcAddr(instance, "vkCmdClearAttachments");
+	vkelTable.CmdClearColorImage = (PFN_vkCmdClearColorImage) vkelGetInstanceProcAddr(instance, "vkCmdClearColorImage");
+	vkelTable.CmdClearDepthStencilImage = (PFN_vkCmdClearDepthStencilImage) vkelGetInstanceProcAddr(instance, "vkCmdClearDepthStencilImage");
+	vkelTable.CmdCopyBuffer = (PFN_vkCmdCopyBuffer) vkelGetInstanceProcAddr(instance, "vkCmdCopyBuffer");
+	vkelTable.CmdCopyBufferToImage = (PFN_vkCmdCopyBufferToImage) vkelGetInstanceProcAddr(instance, "vkCmdCopyBufferToImage");
+	vkelTable.CmdCopyImage = (PFN_vkCmdCopyImage) vkelGetInstanceProcAddr(instance, "vkCmdCopyImage");
+	vkelTable.CmdCopyImageToBuffer = (PFN_vkCmdCopyImageToBuffer) vkelGetInstanceProcAddr(instance, "vkCmdCopyImageToBuffer");
+	vkelTable.CmdCopyQueryPoolResults = (PFN_vkCmdCopyQueryPoolResults) vkelGetInstanceProcAddr(instance, "vkCmdCopyQueryPoolResults");
+	vkelTable.CmdDebugMarkerBeginEXT = (PFN_vkCmdDebugMarkerBeginEXT) vkelGetInstanceProcAddr(instance, "vkCmdDebugMarkerBeginEXT");
+	vkelTable.CmdDebugMarkerEndEXT = (PFN_vkCmdDebugMarkerEndEXT) vkelGetInstanceProcAddr(instance, "vkCmdDebugMarkerEndEXT");
+	vkelTable.CmdDebugMarkerInsertEXT = (PFN_vkCmdDebugMarkerInsertEXT) vkelGetInstanceProcAddr(instance, "vkCmdDebugMarkerInsertEXT");
+	vkelTable.CmdDispatch = (PFN_vkCmdDispatch) vkelGetInstanceProcAddr(instance, "vkCmdDispatch");
+	vkelTable.CmdDispatchIndirect = (PFN_vkCmdDispatchIndirect) vkelGetInstanceProcAddr(instance, "vkCmdDispatchIndirect");
+	vkelTable.CmdDraw = (PFN_vkCmdDraw) vkelGetInstanceProcAddr(instance, "vkCmdDraw");
+	vkelTable.CmdDrawIndexed = (PFN_vkCmdDrawIndexed) vkelGetInstanceProcAddr(instance, "vkCmdDrawIndexed");
+	vkelTable.CmdDrawIndexedIndirect = (PFN_vkCmdDrawIndexedIndirect) vkelGetInstanceProcAddr(instance, "vkCmdDrawIndexedIndirect");
+	vkelTable.CmdDrawIndirect = (PFN_vkCmdDrawIndirect) vkelGetInstanceProcAddr(instance, "vkCmdDrawIndirect");
+	vkelTable.CmdEndQuery = (PFN_vkCmdEndQuery) vkelGetInstanceProcAddr(instance, "vkCmdEndQuery");
+	vkelTable.CmdEndRenderPass = (PFN_vkCmdEndRenderPass) vkelGetInstanceProcAddr(instance, "vkCmdEndRenderPass");
+	vkelTable.CmdExecuteCommands = (PFN_vkCmdExecuteCommands) vkelGetInstanceProcAddr(instance, "vkCmdExecuteCommands");
+	vkelTable.CmdFillBuffer = (PFN_vkCmdFillBuffer) vkelGetInstanceProcAddr(instance, "vkCmdFillBuffer");
+	vkelTable.CmdNextSubpass = (PFN_vkCmdNextSubpass) vkelGetInstanceProcAddr(instance, "vkCmdNextSubpass");
+	vkelTable.CmdPipelineBarrier = (PFN_vkCmdPipelineBarrier) vkelGetInstanceProcAddr(instance, "vkCmdPipelineBarrier");
+	vkelTable.CmdPushConstants = (PFN_vkCmdPushConstants) vkelGetInstanceProcAddr(instance, "vkCmdPushConstants");
+	vkelTable.CmdResetEvent = (PFN_vkCmdResetEvent) vkelGetInstanceProcAddr(instance, "vkCmdResetEvent");
+	vkelTable.CmdResetQueryPool = (PFN_vkCmdResetQueryPool) vkelGetInstanceProcAddr(instance, "vkCmdResetQueryPool");
+	vkelTable.CmdResolveImage = (PFN_vkCmdResolveImage) vkelGetInstanceProcAddr(instance, "vkCmdResolveImage");
+	vkelTable.CmdSetBlendConstants = (PFN_vkCmdSetBlendConstants) vkelGetInstanceProcAddr(instance, "vkCmdSetBlendConstants");
+	vkelTable.CmdSetDepthBias = (PFN_vkCmdSetDepthBias) vkelGetInstanceProcAddr(instance, "vkCmdSetDepthBias");
+	vkelTable.CmdSetDepthBounds = (PFN_vkCmdSetDepthBounds) vkelGetInstanceProcAddr(instance, "vkCmdSetDepthBounds");
+	vkelTable.CmdSetEvent = (PFN_vkCmdSetEvent) vkelGetInstanceProcAddr(instance, "vkCmdSetEvent");
+	vkelTable.CmdSetLineWidth = (PFN_vkCmdSetLineWidth) vkelGetInstanceProcAddr(instance, "vkCmdSetLineWidth");
+	vkelTable.CmdSetScissor = (PFN_vkCmdSetScissor) vkelGetInstanceProcAddr(instance, "vkCmdSetScissor");
+	vkelTable.CmdSetStencilCompareMask = (PFN_vkCmdSetStencilCompareMask) vkelGetInstanceProcAddr(instance, "vkCmdSetStencilCompareMask");
+	vkelTable.CmdSetStencilReference = (PFN_vkCmdSetStencilReference) vkelGetInstanceProcAddr(instance, "vkCmdSetStencilReference");
+	vkelTable.CmdSetStencilWriteMask = (PFN_vkCmdSetStencilWriteMask) vkelGetInstanceProcAddr(instance, "vkCmdSetStencilWriteMask");
+	vkelTable.CmdSetViewport = (PFN_vkCmdSetViewport) vkelGetInstanceProcAddr(instance, "vkCmdSetViewport");
+	vkelTable.CmdUpdateBuffer = (PFN_vkCmdUpdateBuffer) vkelGetInstanceProcAddr(instance, "vkCmdUpdateBuffer");
+	vkelTable.CmdWaitEvents = (PFN_vkCmdWaitEvents) vkelGetInstanceProcAddr(instance, "vkCmdWaitEvents");
+	vkelTable.CmdWriteTimestamp = (PFN_vkCmdWriteTimestamp) vkelGetInstanceProcAddr(instance, "vkCmdWriteTimestamp");
+	vkelTable.CreateBuffer = (PFN_vkCreateBuffer) vkelGetInstanceProcAddr(instance, "vkCreateBuffer");
+	vkelTable.CreateBufferView = (PFN_vkCreateBufferView) vkelGetInstanceProcAddr(instance, "vkCreateBufferView");
+	vkelTable.CreateCommandPool = (PFN_vkCreateCommandPool) vkelGetInstanceProcAddr(instance, "vkCreateCommandPool");
+	vkelTable.CreateComputePipelines = (PFN_vkCreateComputePipelines) vkelGetInstanceProcAddr(instance, "vkCreateComputePipelines");
+	vkelTable.CreateDebugReportCallbackEXT = (PFN_vkCreateDebugReportCallbackEXT) vkelGetInstanceProcAddr(instance, "vkCreateDebugReportCallbackEXT");
+	vkelTable.CreateDescriptorPool = (PFN_vkCreateDescriptorPool) vkelGetInstanceProcAddr(instance, "vkCreateDescriptorPool");
+	vkelTable.CreateDescriptorSetLayout = (PFN_vkCreateDescriptorSetLayout) vkelGetInstanceProcAddr(instance, "vkCreateDescriptorSetLayout");
+	vkelTable.CreateDevice = (PFN_vkCreateDevice) vkelGetInstanceProcAddr(instance, "vkCreateDevice");
+	vkelTable.CreateDisplayModeKHR = (PFN_vkCreateDisplayModeKHR) vkelGetInstanceProcAddr(instance, "vkCreateDisplayModeKHR");
+	vkelTable.CreateDisplayPlaneSurfaceKHR = (PFN_vkCreateDisplayPlaneSurfaceKHR) vkelGetInstanceProcAddr(instance, "vkCreateDisplayPlaneSurfaceKHR");
+	vkelTable.CreateEvent = (PFN_vkCreateEvent) vkelGetInstanceProcAddr(instance, "vkCreateEvent");
+	vkelTable.CreateFence = (PFN_vkCreateFence) vkelGetInstanceProcAddr(instance, "vkCreateFence");
+	vkelTable.CreateFramebuffer = (PFN_vkCreateFramebuffer) vkelGetInstanceProcAddr(instance, "vkCreateFramebuffer");
+	vkelTable.CreateGraphicsPipelines = (PFN_vkCreateGraphicsPipelines) vkelGetInstanceProcAddr(instance, "vkCreateGraphicsPipelines");
+	vkelTable.CreateImage = (PFN_vkCreateImage) vkelGetInstanceProcAddr(instance, "vkCreateImage");
+	vkelTable.CreateImageView = (PFN_vkCreateImageView) vkelGetInstanceProcAddr(instance, "vkCreateImageView");
+	vkelTable.CreateInstance = (PFN_vkCreateInstance) vkelGetInstanceProcAddr(instance, "vkCreateInstance");
+	vkelTable.CreatePipelineCache = (PFN_vkCreatePipelineCache) vkelGetInstanceProcAddr(instance, "vkCreatePipelineCache");
+	vkelTable.CreatePipelineLayout = (PFN_vkCreatePipelineLayout) vkelGetInstanceProcAddr(instance, "vkCreatePipelineLayout");
+	vkelTable.CreateQueryPool = (PFN_vkCreateQueryPool) vkelGetInstanceProcAddr(instance, "vkCreateQueryPool");
+	vkelTable.CreateRenderPass = (PFN_vkCreateRenderPass) vkelGetInstanceProcAddr(instance, "vkCreateRenderPass");
+	vkelTable.CreateSampler = (PFN_vkCreateSampler) vkelGetInstanceProcAddr(instance, "vkCreateSampler");
+	vkelTable.CreateSemaphore = (PFN_vkCreateSemaphore) vkelGetInstanceProcAddr(instance, "vkCreateSemaphore");
+	vkelTable.CreateShaderModule = (PFN_vkCreateShaderModule) vkelGetInstanceProcAddr(instance, "vkCreateShaderModule");
+	vkelTable.CreateSharedSwapchainsKHR = (PFN_vkCreateSharedSwapchainsKHR) vkelGetInstanceProcAddr(instance, "vkCreateSharedSwapchainsKHR");
+	vkelTable.CreateSwapchainKHR = (PFN_vkCreateSwapchainKHR) vkelGetInstanceProcAddr(instance, "vkCreateSwapchainKHR");
+	vkelTable.DebugMarkerSetObjectNameEXT = (PFN_vkDebugMarkerSetObjectNameEXT) vkelGetInstanceProcAddr(instance, "vkDebugMarkerSetObjectNameEXT");
+	vkelTable.DebugMarkerSetObjectTagEXT = (PFN_vkDebugMarkerSetObjectTagEXT) vkelGetInstanceProcAddr(instance, "vkDebugMarkerSetObjectTagEXT");
+	vkelTable.DebugReportMessageEXT = (PFN_vkDebugReportMessageEXT) vkelGetInstanceProcAddr(instance, "vkDebugReportMessageEXT");
+	vkelTable.DestroyBuffer = (PFN_vkDestroyBuffer) vkelGetInstanceProcAddr(instance, "vkDestroyBuffer");
+	vkelTable.DestroyBufferView = (PFN_vkDestroyBufferView) vkelGetInstanceProcAddr(instance, "vkDestroyBufferView");
+	vkelTable.DestroyCommandPool = (PFN_vkDestroyCommandPool) vkelGetInstanceProcAddr(instance, "vkDestroyCommandPool");
+	vkelTable.DestroyDebugReportCallbackEXT = (PFN_vkDestroyDebugReportCallbackEXT) vkelGetInstanceProcAddr(instance, "vkDestroyDebugReportCallbackEXT");
+	vkelTable.DestroyDescriptorPool = (PFN_vkDestroyDescriptorPool) vkelGetInstanceProcAddr(instance, "vkDestroyDescriptorPool");
+	vkelTable.DestroyDescriptorSetLayout = (PFN_vkDestroyDescriptorSetLayout) vkelGetInstanceProcAddr(instance, "vkDestroyDescriptorSetLayout");
+	vkelTable.DestroyDevice = (PFN_vkDestroyDevice) vkelGetInstanceProcAddr(instance, "vkDestroyDevice");
+	vkelTable.DestroyEvent = (PFN_vkDestroyEvent) vkelGetInstanceProcAddr(instance, "vkDestroyEvent");
+	vkelTable.DestroyFence = (PFN_vkDestroyFence) vkelGetInstanceProcAddr(instance, "vkDestroyFence");
+	vkelTable.DestroyFramebuffer = (PFN_vkDestroyFramebuffer) vkelGetInstanceProcAddr(instance, "vkDestroyFramebuffer");
+	vkelTable.DestroyImage = (PFN_vkDestroyImage) vkelGetInstanceProcAddr(instance, "vkDestroyImage");
+	vkelTable.DestroyImageView = (PFN_vkDestroyImageView) vkelGetInstanceProcAddr(instance, "vkDestroyImageView");
+	vkelTable.DestroyInstance = (PFN_vkDestroyInstance) vkelGetInstanceProcAddr(instance, "vkDestroyInstance");
+	vkelTable.DestroyPipeline = (PFN_vkDestroyPipeline) vkelGetInstanceProcAddr(instance, "vkDestroyPipeline");
+	vkelTable.DestroyPipelineCache = (PFN_vkDestroyPipelineCache) vkelGetInstanceProcAddr(instance, "vkDestroyPipelineCache");
+	vkelTable.DestroyPipelineLayout = (PFN_vkDestroyPipelineLayout) vkelGetInstanceProcAddr(instance, "vkDestroyPipelineLayout");
+	vkelTable.DestroyQueryPool = (PFN_vkDestroyQueryPool) vkelGetInstanceProcAddr(instance, "vkDestroyQueryPool");
+	vkelTable.DestroyRenderPass = (PFN_vkDestroyRenderPass) vkelGetInstanceProcAddr(instance, "vkDestroyRenderPass");
+	vkelTable.DestroySampler = (PFN_vkDestroySampler) vkelGetInstanceProcAddr(instance, "vkDestroySampler");
+	vkelTable.DestroySemaphore = (PFN_vkDestroySemaphore) vkelGetInstanceProcAddr(instance, "vkDestroySemaphore");
+	vkelTable.DestroyShaderModule = (PFN_vkDestroyShaderModule) vkelGetInstanceProcAddr(instance, "vkDestroyShaderModule");
+	vkelTable.DestroySurfaceKHR = (PFN_vkDestroySurfaceKHR) vkelGetInstanceProcAddr(instance, "vkDestroySurfaceKHR");
+	vkelTable.DestroySwapchainKHR = (PFN_vkDestroySwapchainKHR) vkelGetInstanceProcAddr(instance, "vkDestroySwapchainKHR");
+	vkelTable.DeviceWaitIdle = (PFN_vkDeviceWaitIdle) vkelGetInstanceProcAddr(instance, "vkDeviceWaitIdle");
+	vkelTable.EndCommandBuffer = (PFN_vkEndCommandBuffer) vkelGetInstanceProcAddr(instance, "vkEndCommandBuffer");
+	vkelTable.EnumerateDeviceExtensionProperties = (PFN_vkEnumerateDeviceExtensionProperties) vkelGetInstanceProcAddr(instance, "vkEnumerateDeviceExtensionProperties");
+	vkelTable.EnumerateDeviceLayerProperties = (PFN_vkEnumerateDeviceLayerProperties) vkelGetInstanceProcAddr(instance, "vkEnumerateDeviceLayerProperties");
+	vkelTable.EnumerateInstanceExtensionProperties = (PFN_vkEnumerateInstanceExtensionProperties) vkelGetInstanceProcAddr(instance, "vkEnumerateInstanceExtensionProperties");
+	vkelTable.EnumerateInstanceLayerProperties = (PFN_vkEnumerateInstanceLayerProperties) vkelGetInstanceProcAddr(instance, "vkEnumerateInstanceLayerProperties");
+	vkelTable.EnumeratePhysicalDevices = (PFN_vkEnumeratePhysicalDevices) vkelGetInstanceProcAddr(instance, "vkEnumeratePhysicalDevices");
+	vkelTable.FlushMappedMemoryRanges = (PFN_vkFlushMappedMemoryRanges) vkelGetInstanceProcAddr(instance, "vkFlushMappedMemoryRanges");
+	vkelTable.FreeCommandBuffers = (PFN_vkFreeCommandBuffers) vkelGetInstanceProcAddr(instance, "vkFreeCommandBuffers");
+	vkelTable.FreeDescriptorSets = (PFN_vkFreeDescriptorSets) vkelGetInstanceProcAddr(instance, "vkFreeDescriptorSets");
+	vkelTable.FreeMemory = (PFN_vkFreeMemory) vkelGetInstanceProcAddr(instance, "vkFreeMemory");
+	vkelTable.GetBufferMemoryRequirements = (PFN_vkGetBufferMemoryRequirements) vkelGetInstanceProcAddr(instance, "vkGetBufferMemoryRequirements");
+	vkelTable.GetDeviceMemoryCommitment = (PFN_vkGetDeviceMemoryCommitment) vkelGetInstanceProcAddr(instance, "vkGetDeviceMemoryCommitment");
+	vkelTable.GetDeviceProcAddr = (PFN_vkGetDeviceProcAddr) vkelGetInstanceProcAddr(instance, "vkGetDeviceProcAddr");
+	vkelTable.GetDeviceQueue = (PFN_vkGetDeviceQueue) vkelGetInstanceProcAddr(instance, "vkGetDeviceQueue");
+	vkelTable.GetDisplayModePropertiesKHR = (PFN_vkGetDisplayModePropertiesKHR) vkelGetInstanceProcAddr(instance, "vkGetDisplayModePropertiesKHR");
+	vkelTable.GetDisplayPlaneCapabilitiesKHR = (PFN_vkGetDisplayPlaneCapabilitiesKHR) vkelGetInstanceProcAddr(instance, "vkGetDisplayPlaneCapabilitiesKHR");
+	vkelTable.GetDisplayPlaneSupportedDisplaysKHR = (PFN_vkGetDisplayPlaneSupportedDisplaysKHR) vkelGetInstanceProcAddr(instance, "vkGetDisplayPlaneSupportedDisplaysKHR");
+	vkelTable.GetEventStatus = (PFN_vkGetEventStatus) vkelGetInstanceProcAddr(instance, "vkGetEventStatus");
+	vkelTable.GetFenceStatus = (PFN_vkGetFenceStatus) vkelGetInstanceProcAddr(instance, "vkGetFenceStatus");
+	vkelTable.GetImageMemoryRequirements = (PFN_vkGetImageMemoryRequirements) vkelGetInstanceProcAddr(instance, "vkGetImageMemoryRequirements");
+	vkelTable.GetImageSparseMemoryRequirements = (PFN_vkGetImageSparseMemoryRequirements) vkelGetInstanceProcAddr(instance, "vkGetImageSparseMemoryRequirements");
+	vkelTable.GetImageSubresourceLayout = (PFN_vkGetImageSubresourceLayout) vkelGetInstanceProcAddr(instance, "vkGetImageSubresourceLayout");
+	vkelTable.GetInstanceProcAddr = (PFN_vkGetInstanceProcAddr) vkelGetInstanceProcAddr(instance, "vkGetInstanceProcAddr");
+	vkelTable.GetPhysicalDeviceDisplayPlanePropertiesKHR = (PFN_vkGetPhysicalDeviceDisplayPlanePropertiesKHR) vkelGetInstanceProcAddr(instance, "vkGetPhysicalDeviceDisplayPlanePropertiesKHR");
+	vkelTable.GetPhysicalDeviceDisplayPropertiesKHR = (PFN_vkGetPhysicalDeviceDisplayPropertiesKHR) vkelGetInstanceProcAddr(instance, "vkGetPhysicalDeviceDisplayPropertiesKHR");
+	vkelTable.GetPhysicalDeviceFeatures = (PFN_vkGetPhysicalDeviceFeatures) vkelGetInstanceProcAddr(instance, "vkGetPhysicalDeviceFeatures");
+	vkelTable.GetPhysicalDeviceFormatProperties = (PFN_vkGetPhysicalDeviceFormatProperties) vkelGetInstanceProcAddr(instance, "vkGetPhysicalDeviceFormatProperties");
+	vkelTable.GetPhysicalDeviceImageFormatProperties = (PFN_vkGetPhysicalDeviceImageFormatProperties) vkelGetInstanceProcAddr(instance, "vkGetPhysicalDeviceImageFormatProperties");
+	vkelTable.GetPhysicalDeviceMemoryProperties = (PFN_vkGetPhysicalDeviceMemoryProperties) vkelGetInstanceProcAddr(instance, "vkGetPhysicalDeviceMemoryProperties");
+	vkelTable.GetPhysicalDeviceProperties = (PFN_vkGetPhysicalDeviceProperties) vkelGetInstanceProcAddr(instance, "vkGetPhysicalDeviceProperties");
+	vkelTable.GetPhysicalDeviceQueueFamilyProperties = (PFN_vkGetPhysicalDeviceQueueFamilyProperties) vkelGetInstanceProcAddr(instance, "vkGetPhysicalDeviceQueueFamilyProperties");
+	vkelTable.GetPhysicalDeviceSparseImageFormatProperties = (PFN_vkGetPhysicalDeviceSparseImageFormatProperties) vkelGetInstanceProcAddr(instance, "vkGetPhysicalDeviceSparseImageFormatProperties");
+	vkelTable.GetPhysicalDeviceSurfaceCapabilitiesKHR = (PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR) vkelGetInstanceProcAddr(instance, "vkGetPhysicalDeviceSurfaceCapabilitiesKHR");
+	vkelTable.GetPhysicalDeviceSurfaceFormatsKHR = (PFN_vkGetPhysicalDeviceSurfaceFormatsKHR) vkelGetInstanceProcAddr(instance, "vkGetPhysicalDeviceSurfaceFormatsKHR");
+	vkelTable.GetPhysicalDeviceSurfacePresentModesKHR = (PFN_vkGetPhysicalDeviceSurfacePresentModesKHR) vkelGetInstanceProcAddr(instance, "vkGetPhysicalDeviceSurfacePresentModesKHR");
+	vkelTable.GetPhysicalDeviceSurfaceSupportKHR = (PFN_vkGetPhysicalDeviceSurfaceSupportKHR) vkelGetInstanceProcAddr(instance, "vkGetPhysicalDeviceSurfaceSupportKHR");
+	vkelTable.GetPipelineCacheData = (PFN_vkGetPipelineCacheData) vkelGetInstanceProcAddr(instance, "vkGetPipelineCacheData");
+	vkelTable.GetQueryPoolResults = (PFN_vkGetQueryPoolResults) vkelGetInstanceProcAddr(instance, "vkGetQueryPoolResults");
+	vkelTable.GetRenderAreaGranularity = (PFN_vkGetRenderAreaGranularity) vkelGetInstanceProcAddr(instance, "vkGetRenderAreaGranularity");
+	vkelTable.GetSwapchainImagesKHR = (PFN_vkGetSwapchainImagesKHR) vkelGetInstanceProcAddr(instance, "vkGetSwapchainImagesKHR");
+	vkelTable.InvalidateMappedMemoryRanges = (PFN_vkInvalidateMappedMemoryRanges) vkelGetInstanceProcAddr(instance, "vkInvalidateMappedMemoryRanges");
+	vkelTable.MapMemory = (PFN_vkMapMemory) vkelGetInstanceProcAddr(instance, "vkMapMemory");
+	vkelTable.MergePipelineCaches = (PFN_vkMergePipelineCaches) vkelGetInstanceProcAddr(instance, "vkMergePipelineCaches");
+	vkelTable.QueueBindSparse = (PFN_vkQueueBindSparse) vkelGetInstanceProcAddr(instance, "vkQueueBindSparse");
+	vkelTable.QueuePresentKHR = (PFN_vkQueuePresentKHR) vkelGetInstanceProcAddr(instance, "vkQueuePresentKHR");
+	vkelTable.QueueSubmit = (PFN_vkQueueSubmit) vkelGetInstanceProcAddr(instance, "vkQueueSubmit");
+	vkelTable.QueueWaitIdle = (PFN_vkQueueWaitIdle) vkelGetInstanceProcAddr(instance, "vkQueueWaitIdle");
+	vkelTable.ResetCommandBuffer = (PFN_vkResetCommandBuffer) vkelGetInstanceProcAddr(instance, "vkResetCommandBuffer");
+	vkelTable.ResetCommandPool = (PFN_vkResetCommandPool) vkelGetInstanceProcAddr(instance, "vkResetCommandPool");
+	vkelTable.ResetDescriptorPool = (PFN_vkResetDescriptorPool) vkelGetInstanceProcAddr(instance, "vkResetDescriptorPool");
+	vkelTable.ResetEvent = (PFN_vkResetEvent) vkelGetInstanceProcAddr(instance, "vkResetEvent");
+	vkelTable.ResetFences = (PFN_vkResetFences) vkelGetInstanceProcAddr(instance, "vkResetFences");
+	vkelTable.SetEvent = (PFN_vkSetEvent) vkelGetInstanceProcAddr(instance, "vkSetEvent");
+	vkelTable.UnmapMemory = (PFN_vkUnmapMemory) vkelGetInstanceProcAddr(instance, "vkUnmapMemory");
+	vkelTable.UpdateDescriptorSets = (PFN_vkUpdateDescriptorSets) vkelGetInstanceProcAddr(instance, "vkUpdateDescriptorSets");
+	vkelTable.WaitForFences = (PFN_vkWaitForFences) vkelGetInstanceProcAddr(instance, "vkWaitForFences");
+
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+	vkelTable.CreateAndroidSurfaceKHR = (PFN_vkCreateAndroidSurfaceKHR) vkelGetInstanceProcAddr(instance, "vkCreateAndroidSurfaceKHR");
+#endif /* VK_USE_PLATFORM_ANDROID_KHR */
+
+#ifdef VK_USE_PLATFORM_MIR_KHR
+	vkelTable.CreateMirSurfaceKHR = (PFN_vkCreateMirSurfaceKHR) vkelGetInstanceProcAddr(instance, "vkCreateMirSurfaceKHR");
+	vkelTable.GetPhysicalDeviceMirPresentationSupportKHR = (PFN_vkGetPhysicalDeviceMirPresentationSupportKHR) vkelGetInstanceProcAddr(instance, "vkGetPhysicalDeviceMirPresentationSupportKHR");
+#endif /* VK_USE_PLATFORM_MIR_KHR */
+
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+	vkelTable.CreateWaylandSurfaceKHR = (PFN_vkCreateWaylandSurfaceKHR) vkelGetInstanceProcAddr(instance, "vkCreateWaylandSurfaceKHR");
+	vkelTable.GetPhysicalDeviceWaylandPresentationSupportKHR = (PFN_vkGetPhysicalDeviceWaylandPresentationSupportKHR) vkelGetInstanceProcAddr(instance, "vkGetPhysicalDeviceWaylandPresentationSupportKHR");
+#endif /* VK_USE_PLATFORM_WAYLAND_KHR */
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+	vkelTable.CreateWin32SurfaceKHR = (PFN_vkCreateWin32SurfaceKHR) vkelGetInstanceProcAddr(instance, "vkCreateWin32SurfaceKHR");
+	vkelTable.GetPhysicalDeviceWin32PresentationSupportKHR = (PFN_vkGetPhysicalDeviceWin32PresentationSupportKHR) vkelGetInstanceProcAddr(instance, "vkGetPhysicalDeviceWin32PresentationSupportKHR");
+#endif /* VK_USE_PLATFORM_WIN32_KHR */
+
+#ifdef VK_USE_PLATFORM_XCB_KHR
+	vkelTable.CreateXcbSurfaceKHR = (PFN_vkCreateXcbSurfaceKHR) vkelGetInstanceProcAddr(instance, "vkCreateXcbSurfaceKHR");
+	vkelTable.GetPhysicalDeviceXcbPresentationSupportKHR = (PFN_vkGetPhysicalDeviceXcbPresentationSupportKHR) vkelGetInstanceProcAddr(instance, "vkGetPhysicalDeviceXcbPresentationSupportKHR");
+#endif /* VK_USE_PLATFORM_XCB_KHR */
+
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+	vkelTable.CreateXlibSurfaceKHR = (PFN_vkCreateXlibSurfaceKHR) vkelGetInstanceProcAddr(instance, "vkCreateXlibSurfaceKHR");
+	vkelTable.GetPhysicalDeviceXlibPresentationSupportKHR = (PFN_vkGetPhysicalDeviceXlibPresentationSupportKHR) vkelGetInstanceProcAddr(instance, "vkGetPhysicalDeviceXlibPresentationSupportKHR");
+#endif /* VK_USE_PLATFORM_XLIB_KHR */
+
+
+	vkelInvalidatePhysicalDeviceEnumerations();
+
+	// Goes back to the device level functions just loaded, which work with any device
+	if (!vkelPublishInstanceDevice(NULL))
+		return VK_FALSE;
+
+#ifdef VKEL_RECORD_USAGE
+	vkelRecordUsageProcs();
+#endif
+
+	vkelUpdateTable();
+
+	
+	return VK_TRUE;
+}
+	
+VkBool32 vkelDeviceInit(VkPhysicalDevice physicalDevice, VkDevice device)
+{
+	if (!vkelVkLibHandle && !vkelSourceTable && !vkelInit())
+		return VK_FALSE;
+	
+	
+	// The new table is built off to the side, so threads still calling through the
+	// current one (like after VK_ERROR_DEVICE_LOST) never see it partially loaded
+	VkelDevice *entry = vkelCreateDeviceEntry();
+	
+	if (!entry)
+		return VK_FALSE;
+	
+	entry->physicalDevice = physicalDevice;
+	entry->device = device;
+	
+	
+	// Instance level functions are kept, so recreating a device only reloads the device level functions
+	entry->table.AcquireNextImageKHR = (PFN_vkAcquireNextImageKHR) vkelGetDeviceProcAddr(device, "vkAcquireNextImageKHR");
+	entry->table.AllocateCommandBuffers = (PFN_vkAllocateCommandBuffers) vkelGetDeviceProcAddr(device, "vkAllocateCommandBuffers");
+	entry->table.AllocateDescriptorSets = (PFN_vkAllocateDescriptorSets) vkelGetDeviceProcAddr(device, "vkAllocateDescriptorSets");
+	entry->table.AllocateMemory = (PFN_vkAllocateMemory) vkelGetDeviceProcAddr(device, "vkAllocateMemory");
+	entry->table.BeginCommandBuffer = (PFN_vkBeginCommandBuffer) vkelGetDeviceProcAddr(device, "vkBeginCommandBuffer");
+	entry->table.BindBufferMemory = (PFN_vkBindBufferMemory) vkelGetDeviceProcAddr(device, "vkBindBufferMemory");
+	entry->table.BindImageMemory = (PFN_vkBindImageMemory) vkelGetDeviceProcAddr(device, "vkBindImageMemory");
+	entry->table.CmdBeginQuery = (PFN_vkCmdBeginQuery) vkelGetDeviceProcAddr(device, "vkCmdBeginQuery");
+	entry->table.CmdBeginRenderPass = (PFN_vkCmdBeginRenderPass) vkelGetDeviceProcAddr(device, "vkCmdBeginRenderPass");
+	entry->table.CmdBindDescriptorSets = (PFN_vkCmdBindDescriptorSets) vkelGetDeviceProcAddr(device, "vkCmdBindDescriptorSets");
+	entry->table.CmdBindIndexBuffer = (PFN_vkCmdBindIndexBuffer) vkelGetDeviceProcAddr(device, "vkCmdBindIndexBuffer");
+	entry->table.CmdBindPipeline = (PFN_vkCmdBindPipeline) vkelGetDeviceProcAddr(device, "vkCmdBindPipeline");
+	entry->table.CmdBindVertexBuffers = (PFN_vkCmdBindVertexBuffers) vkelGetDeviceProcAddr(device, "vkCmdBindVertexBuffers");
+	entry->table.CmdBlitImage = (PFN_vkCmdBlitImage) vkelGetDeviceProcAddr(device, "vkCmdBlitImage");
+	entry->table.CmdClearAttachments = (PFN_vkCmdClearAttachments) vkelGetDeviceProcAddr(device, "vkCmdClearAttachments");
+	entry->table.CmdClearColorImage = (PFN_vkCmdClearColorImage) vkelGetDeviceProcAddr(device, "vkCmdClearColorImage");
+	entry->table.CmdClearDepthStencilImage = (PFN_vkCmdClearDepthStencilImage) vkelGetDeviceProcAddr(device, "vkCmdClearDepthStencilImage");
+	entry->table.CmdCopyBuffer = (PFN_vkCmdCopyBuffer) vkelGetDeviceProcAddr(device, "vkCmdCopyBuffer");
+	entry->table.CmdCopyBufferToImage = (PFN_vkCmdCopyBufferToImage) vkelGetDeviceProcAddr(device, "vkCmdCopyBufferToImage");
+	entry->table.CmdCopyImage = (PFN_vkCmdCopyImage) vkelGetDeviceProcAddr(device, "vkCmdCopyImage");
+	entry->table.CmdCopyImageToBuffer = (PFN_vkCmdCopyImageToBuffer) vkelGetDeviceProcAddr(device, "vkCmdCopyImageToBuffer");
+	entry->table.CmdCopyQueryPoolResults = (PFN_vkCmdCopyQueryPoolResults) vkelGetDeviceProcAddr(device, "vkCmdCopyQueryPoolResults");
+	entry->table.CmdDebugMarkerBeginEXT = (PFN_vkCmdDebugMarkerBeginEXT) vkelGetDeviceProcAddr(device, "vkCmdDebugMarkerBeginEXT");
+	entry->table.CmdDebugMarkerEndEXT = (PFN_vkCmdDebugMarkerEndEXT) vkelGetDeviceProcAddr(device, "vkCmdDebugMarkerEndEXT");
+	entry->table.CmdDebugMarkerInsertEXT = (PFN_vkCmdDebugMarkerInsertEXT) vkelGetDeviceProcAddr(device, "vkCmdDebugMarkerInsertEXT");
+	entry->table.CmdDispatch = (PFN_vkCmdDispatch) vkelGetDeviceProcAddr(device, "vkCmdDispatch");
+	entry->table.CmdDispatchIndirect = (PFN_vkCmdDispatchIndirect) vkelGetDeviceProcAddr(device, "vkCmdDispatchIndirect");
+	entry->table.CmdDraw = (PFN_vkCmdDraw) vkelGetDeviceProcAddr(device, "vkCmdDraw");
+	entry->table.CmdDrawIndexed = (PFN_vkCmdDrawIndexed) vkelGetDeviceProcAddr(device, "vkCmdDrawIndexed");
+	entry->table.CmdDrawIndexedIndirect = (PFN_vkCmdDrawIndexedIndirect) vkelGetDeviceProcAddr(device, "vkCmdDrawIndexedIndirect");
+	entry->table.CmdDrawIndirect = (PFN_vkCmdDrawIndirect) vkelGetDeviceProcAddr(device, "vkCmdDrawIndirect");
+	entry->table.CmdEndQuery = (PFN_vkCmdEndQuery) vkelGetDeviceProcAddr(device, "vkCmdEndQuery");
+	entry->table.CmdEndRenderPass = (PFN_vkCmdEndRenderPass) vkelGetDeviceProcAddr(device, "vkCmdEndRenderPass");
+	entry->table.CmdExecuteCommands = (PFN_vkCmdExecuteCommands) vkelGetDeviceProcAddr(device, "vkCmdExecuteCommands");
+	entry->table.CmdFillBuffer = (PFN_vkCmdFillBuffer) vkelGetDeviceProcAddr(device, "vkCmdFillBuffer");
+	entry->table.CmdNextSubpass = (PFN_vkCmdNextSubpass) vkelGetDeviceProcAddr(device, "vkCmdNextSubpass");
+	entry->table.CmdPipelineBarrier = (PFN_vkCmdPipelineBarrier) vkelGetDeviceProcAddr(device, "vkCmdPipelineBarrier");
+	entry->table.CmdPushConstants = (PFN_vkCmdPushConstants) vkelGetDeviceProcAddr(device, "vkCmdPushConstants");
+	entry->table.CmdResetEvent = (PFN_vkCmdResetEvent) vkelGetDeviceProcAddr(device, "vkCmdResetEvent");
+	entry->table.CmdResetQueryPool = (PFN_vkCmdResetQueryPool) vkelGetDeviceProcAddr(device, "vkCmdResetQueryPool");
+	entry->table.CmdResolveImage = (PFN_vkCmdResolveImage) vkelGetDeviceProcAddr(device, "vkCmdResolveImage");
+	entry->table.CmdSetBlendConstants = (PFN_vkCmdSetBlendConstants) vkelGetDeviceProcAddr(device, "vkCmdSetBlendConstants");
+	entry->table.CmdSetDepthBias = (PFN_vkCmdSetDepthBias) vkelGetDeviceProcAddr(device, "vkCmdSetDepthBias");
+	entry->table.CmdSetDepthBounds = (PFN_vkCmdSetDepthBounds) vkelGetDeviceProcAddr(device, "vkCmdSetDepthBounds");
+	entry->table.CmdSetEvent = (PFN_vkCmdSetEvent) vkelGetDeviceProcAddr(device, "vkCmdSetEvent");
+	entry->table.CmdSetLineWidth = (PFN_vkCmdSetLineWidth) vkelGetDeviceProcAddr(device, "vkCmdSetLineWidth");
+	entry->table.CmdSetScissor = (PFN_vkCmdSetScissor) vkelGetDeviceProcAddr(device, "vkCmdSetScissor");
+	entry->table.CmdSetStencilCompareMask = (PFN_vkCmdSetStencilCompareMask) vkelGetDeviceProcAddr(device, "vkCmdSetStencilCompareMask");
+	entry->table.CmdSetStencilReference = (PFN_vkCmdSetStencilReference) vkelGetDeviceProcAddr(device, "vkCmdSetStencilReference");
+	entry->table.CmdSetStencilWriteMask = (PFN_vkCmdSetStencilWriteMask) vkelGetDeviceProcAddr(device, "vkCmdSetStencilWriteMask");
+	entry->table.CmdSetViewport = (PFN_vkCmdSetViewport) vkelGetDeviceProcAddr(device, "vkCmdSetViewport");
+	entry->table.CmdUpdateBuffer = (PFN_vkCmdUpdateBuffer) vkelGetDeviceProcAddr(device, "vkCmdUpdateBuffer");
+	entry->table.CmdWaitEvents = (PFN_vkCmdWaitEvents) vkelGetDeviceProcAddr(device, "vkCmdWaitEvents");
+	entry->table.CmdWriteTimestamp = (PFN_vkCmdWriteTimestamp) vkelGetDeviceProcAddr(device, "vkCmdWriteTimestamp");
+	entry->table.CreateBuffer = (PFN_vkCreateBuffer) vkelGetDeviceProcAddr(device, "vkCreateBuffer");
+	entry->table.CreateBufferView = (PFN_vkCreateBufferView) vkelGetDeviceProcAddr(device, "vkCreateBufferView");
+	entry->table.CreateCommandPool = (PFN_vkCreateCommandPool) vkelGetDeviceProcAddr(device, "vkCreateCommandPool");
+	entry->table.CreateComputePipelines = (PFN_vkCreateComputePipelines) vkelGetDeviceProcAddr(device, "vkCreateComputePipelines");
+	entry->table.CreateDescriptorPool = (PFN_vkCreateDescriptorPool) vkelGetDeviceProcAddr(device, "vkCreateDescriptorPool");
+	entry->table.CreateDescriptorSetLayout = (PFN_vkCreateDescriptorSetLayout) vkelGetDeviceProcAddr(device, "vkCreateDescriptorSetLayout");
+	entry->table.CreateEvent = (PFN_vkCreateEvent) vkelGetDeviceProcAddr(device, "vkCreateEvent");
+	entry->table.CreateFence = (PFN_vkCreateFence) vkelGetDeviceProcAddr(device, "vkCreateFence");
+	entry->table.CreateFramebuffer = (PFN_vkCreateFramebuffer) vkelGetDeviceProcAddr(device, "vkCreateFramebuffer");
+	entry->table.CreateGraphicsPipelines = (PFN_vkCreateGraphicsPipelines) vkelGetDeviceProcAddr(device, "vkCreateGraphicsPipelines");
+	entry->table.CreateImage = (PFN_vkCreateImage) vkelGetDeviceProcAddr(device, "vkCreateImage");
+	entry->table.CreateImageView = (PFN_vkCreateImageView) vkelGetDeviceProcAddr(device, "vkCreateImageView");
+	entry->table.CreatePipelineCache = (PFN_vkCreatePipelineCache) vkelGetDeviceProcAddr(device, "vkCreatePipelineCache");
+	entry->table.CreatePipelineLayout = (PFN_vkCreatePipelineLayout) vkelGetDeviceProcAddr(device, "vkCreatePipelineLayout");
+	entry->table.CreateQueryPool = (PFN_vkCreateQueryPool) vkelGetDeviceProcAddr(device, "vkCreateQueryPool");
+	entry->table.CreateRenderPass = (PFN_vkCreateRenderPass) vkelGetDeviceProcAddr(device, "vkCreateRenderPass");
+	entry->table.CreateSampler = (PFN_vkCreateSampler) vkelGetDeviceProcAddr(device, "vkCreateSampler");
+	entry->table.CreateSemaphore = (PFN_vkCreateSemaphore) vkelGetDeviceProcAddr(device, "vkCreateSemaphore");
+	entry->table.CreateShaderModule = (PFN_vkCreateShaderModule) vkelGetDeviceProcAddr(device, "vkCreateShaderModule");
+	entry->table.CreateSharedSwapchainsKHR = (PFN_vkCreateSharedSwapchainsKHR) vkelGetDeviceProcAddr(device, "vkCreateSharedSwapchainsKHR");
+	entry->table.CreateSwapchainKHR = (PFN_vkCreateSwapchainKHR) vkelGetDeviceProcAddr(device, "vkCreateSwapchainKHR");
+	entry->table.DebugMarkerSetObjectNameEXT = (PFN_vkDebugMarkerSetObjectNameEXT) vkelGetDeviceProcAddr(device, "vkDebugMarkerSetObjectNameEXT");
+	entry->table.DebugMarkerSetObjectTagEXT = (PFN_vkDebugMarkerSetObjectTagEXT) vkelGetDeviceProcAddr(device, "vkDebugMarkerSetObjectTagEXT");
+	entry->table.DestroyBuffer = (PFN_vkDestroyBuffer) vkelGetDeviceProcAddr(device, "vkDestroyBuffer");
+	entry->table.DestroyBufferView = (PFN_vkDestroyBufferView) vkelGetDeviceProcAddr(device, "vkDestroyBufferView");
+	entry->table.DestroyCommandPool = (PFN_vkDestroyCommandPool) vkelGetDeviceProcAddr(device, "vkDestroyCommandPool");
+	entry->table.DestroyDescriptorPool = (PFN_vkDestroyDescriptorPool) vkelGetDeviceProcAddr(device, "vkDestroyDescriptorPool");
+	entry->table.DestroyDescriptorSetLayout = (PFN_vkDestroyDescriptorSetLayout) vkelGetDeviceProcAddr(device, "vkDestroyDescriptorSetLayout");
+	entry->table.DestroyDevice = (PFN_vkDestroyDevice) vkelGetDeviceProcAddr(device, "vkDestroyDevice");
+	entry->table.DestroyEvent = (PFN_vkDestroyEvent) vkelGetDeviceProcAddr(device, "vkDestroyEvent");
+	entry->table.DestroyFence = (PFN_vkDestroyFence) vkelGetDeviceProcAddr(device, "vkDestroyFence");
+	entry->table.DestroyFramebuffer = (PFN_vkDestroyFramebuffer) vkelGetDeviceProcAddr(device, "vkDestroyFramebuffer");
+	entry->table.DestroyImage = (PFN_vkDestroyImage) vkelGetDeviceProcAddr(device, "vkDestroyImage");
+	entry->table.DestroyImageView = (PFN_vkDestroyImageView) vkelGetDeviceProcAddr(device, "vkDestroyImageView");
+	entry->table.DestroyPipeline = (PFN_vkDestroyPipeline) vkelGetDeviceProcAddr(device, "vkDestroyPipeline");
+	entry->table.DestroyPipelineCache = (PFN_vkDestroyPipelineCache) vkelGetDeviceProcAddr(device, "vkDestroyPipelineCache");
+	entry->table.DestroyPipelineLayout = (PFN_vkDestroyPipelineLayout) vkelGetDeviceProcAddr(device, "vkDestroyPipelineLayout");
+	entry->table.DestroyQueryPool = (PFN_vkDestroyQueryPool) vkelGetDeviceProcAddr(device, "vkDestroyQueryPool");
+	entry->table.DestroyRenderPass = (PFN_vkDestroyRenderPass) vkelGetDeviceProcAddr(device, "vkDestroyRenderPass");
+	entry->table.DestroySampler = (PFN_vkDestroySampler) vkelGetDeviceProcAddr(device, "vkDestroySampler");
+	entry->table.DestroySemaphore = (PFN_vkDestroySemaphore) vkelGetDeviceProcAddr(device, "vkDestroySemaphore");
+	entry->table.DestroyShaderModule = (PFN_vkDestroyShaderModule) vkelGetDeviceProcAddr(device, "vkDestroyShaderModule");
+	entry->table.DestroySwapchainKHR = (PFN_vkDestroySwapchainKHR) vkelGetDeviceProcAddr(device, "vkDestroySwapchainKHR");
+	entry->table.DeviceWaitIdle = (PFN_vkDeviceWaitIdle) vkelGetDeviceProcAddr(device, "vkDeviceWaitIdle");
+	entry->table.EndCommandBuffer = (PFN_vkEndCommandBuffer) vkelGetDeviceProcAddr(device, "vkEndCommandBuffer");
+	entry->table.FlushMappedMemoryRanges = (PFN_vkFlushMappedMemoryRanges) vkelGetDeviceProcAddr(device, "vkFlushMappedMemoryRanges");
+	entry->table.FreeCommandBuffers = (PFN_vkFreeCommandBuffers) vkelGetDeviceProcAddr(device, "vkFreeCommandBuffers");
+	entry->table.FreeDescriptorSets = (PFN_vkFreeDescriptorSets) vkelGetDeviceProcAddr(device, "vkFreeDescriptorSets");
+	entry->table.FreeMemory = (PFN_vkFreeMemory) vkelGetDeviceProcAddr(device, "vkFreeMemory");
+	entry->table.GetBufferMemoryRequirements = (PFN_vkGetBufferMemoryRequirements) vkelGetDeviceProcAddr(device, "vkGetBufferMemoryRequirements");
+	entry->table.GetDeviceMemoryCommitment = (PFN_vkGetDeviceMemoryCommitment) vkelGetDeviceProcAddr(device, "vkGetDeviceMemoryCommitment");
+	entry->table.GetDeviceQueue = (PFN_vkGetDeviceQueue) vkelGetDeviceProcAddr(device, "vkGetDeviceQueue");
+	entry->table.GetEventStatus = (PFN_vkGetEventStatus) vkelGetDeviceProcAddr(device, "vkGetEventStatus");
+	entry->table.GetFenceStatus = (PFN_vkGetFenceStatus) vkelGetDeviceProcAddr(device, "vkGetFenceStatus");
+	entry->table.GetImageMemoryRequirements = (PFN_vkGetImageMemoryRequirements) vkelGetDeviceProcAddr(device, "vkGetImageMemoryRequirements");
+	entry->table.GetImageSparseMemoryRequirements = (PFN_vkGetImageSparseMemoryRequirements) vkelGetDeviceProcAddr(device, "vkGetImageSparseMemoryRequirements");
+	entry->table.GetImageSubresourceLayout = (PFN_vkGetImageSubresourceLayout) vkelGetDeviceProcAddr(device, "vkGetImageSubresourceLayout");
+	entry->table.GetPipelineCacheData = (PFN_vkGetPipelineCacheData) vkelGetDeviceProcAddr(device, "vkGetPipelineCacheData");
+	entry->table.GetQueryPoolResults = (PFN_vkGetQueryPoolResults) vkelGetDeviceProcAddr(device, "vkGetQueryPoolResults");
+	entry->table.GetRenderAreaGranularity = (PFN_vkGetRenderAreaGranularity) vkelGetDeviceProcAddr(device, "vkGetRenderAreaGranularity");
+	entry->table.GetSwapchainImagesKHR = (PFN_vkGetSwapchainImagesKHR) vkelGetDeviceProcAddr(device, "vkGetSwapchainImagesKHR");
+	entry->table.InvalidateMappedMemoryRanges = (PFN_vkInvalidateMappedMemoryRanges) vkelGetDeviceProcAddr(device, "vkInvalidateMappedMemoryRanges");
+	entry->table.MapMemory = (PFN_vkMapMemory) vkelGetDeviceProcAddr(device, "vkMapMemory");
+	entry->table.MergePipelineCaches = (PFN_vkMergePipelineCaches) vkelGetDeviceProcAddr(device, "vkMergePipelineCaches");
+	entry->table.QueueBindSparse = (PFN_vkQueueBindSparse) vkelGetDeviceProcAddr(device, "vkQueueBindSparse");
+	entry->table.QueuePresentKHR = (PFN_vkQueuePresentKHR) vkelGetDeviceProcAddr(device, "vkQueuePresentKHR");
+	entry->table.QueueSubmit = (PFN_vkQueueSubmit) vkelGetDeviceProcAddr(device, "vkQueueSubmit");
+	entry->table.QueueWaitIdle = (PFN_vkQueueWaitIdle) vkelGetDeviceProcAddr(device, "vkQueueWaitIdle");
+	entry->table.ResetCommandBuffer = (PFN_vkResetCommandBuffer) vkelGetDeviceProcAddr(device, "vkResetCommandBuffer");
+	entry->table.ResetCommandPool = (PFN_vkResetCommandPool) vkelGetDeviceProcAddr(device, "vkResetCommandPool");
+	entry->table.ResetDescriptorPool = (PFN_vkResetDescriptorPool) vkelGetDeviceProcAddr(device, "vkResetDescriptorPool");
+	entry->table.ResetEvent = (PFN_vkResetEvent) vkelGetDeviceProcAddr(device, "vkResetEvent");
+	entry->table.ResetFences = (PFN_vkResetFences) vkelGetDeviceProcAddr(device, "vkResetFences");
+	entry->table.SetEvent = (PFN_vkSetEvent) vkelGetDeviceProcAddr(device, "vkSetEvent");
+	entry->table.UnmapMemory = (PFN_vkUnmapMemory) vkelGetDeviceProcAddr(device, "vkUnmapMemory");
+	entry->table.UpdateDescriptorSets = (PFN_vkUpdateDescriptorSets) vkelGetDeviceProcAddr(device, "vkUpdateDescriptorSets");
+	entry->table.WaitForFences = (PFN_vkWaitForFences) vkelGetDeviceProcAddr(device, "vkWaitForFences");
+
+
+	// Enumerated only once per physical device, so recreating a device
+	// (like after VK_ERROR_DEVICE_LOST) doesn't enumerate again
+	vkelGetPhysicalDeviceCapabilities(physicalDevice, &entry->capabilities);
+	
+	// Instead of updating vkelTable, whose device level members keep the functions loaded
+	// by vkelInit()/vkelInstanceInit(), the vk* macros go to the new table all at once
+	vkelPublishDevice(entry);
+
+	
+	return VK_TRUE;
+}
+	
+
+static void vkelLoadDeviceTable(VkelDeviceTable *pTable, VkDevice device)
+{
+	pTable->DestroyDevice = (PFN_vkDestroyDevice) vkGetDeviceProcAddr(device, "vkDestroyDevice");
+	pTable->GetDeviceQueue = (PFN_vkGetDeviceQueue) vkGetDeviceProcAddr(device, "vkGetDeviceQueue");
+	pTable->QueueSubmit = (PFN_vkQueueSubmit) vkGetDeviceProcAddr(device, "vkQueueSubmit");
+	pTable->QueueWaitIdle = (PFN_vkQueueWaitIdle) vkGetDeviceProcAddr(device, "vkQueueWaitIdle");
+	pTable->DeviceWaitIdle = (PFN_vkDeviceWaitIdle) vkGetDeviceProcAddr(device, "vkDeviceWaitIdle");
+	pTable->AllocateMemory = (PFN_vkAllocateMemory) vkGetDeviceProcAddr(device, "vkAllocateMemory");
+	pTable->FreeMemory = (PFN_vkFreeMemory) vkGetDeviceProcAddr(device, "vkFreeMemory");
+	pTable->MapMemory = (PFN_vkMapMemory) vkGetDeviceProcAddr(device, "vkMapMemory");
+	pTable->UnmapMemory = (PFN_vkUnmapMemory) vkGetDeviceProcAddr(device, "vkUnmapMemory");
+	pTable->FlushMappedMemoryRanges = (PFN_vkFlushMappedMemoryRanges) vkGetDeviceProcAddr(device, "vkFlushMappedMemoryRanges");
+	pTable->InvalidateMappedMemoryRanges = (PFN_vkInvalidateMappedMemoryRanges) vkGetDeviceProcAddr(device, "vkInvalidateMappedMemoryRanges");
+	pTable->GetDeviceMemoryCommitment = (PFN_vkGetDeviceMemoryCommitment) vkGetDeviceProcAddr(device, "vkGetDeviceMemoryCommitment");
+	pTable->BindBufferMemory = (PFN_vkBindBufferMemory) vkGetDeviceProcAddr(device, "vkBindBufferMemory");
+	pTable->BindImageMemory = (PFN_vkBindImageMemory) vkGetDeviceProcAddr(device, "vkBindImageMemory");
+	pTable->GetBufferMemoryRequirements = (PFN_vkGetBufferMemoryRequirements) vkGetDeviceProcAddr(device, "vkGetBufferMemoryRequirements");
+	pTable->GetImageMemoryRequirements = (PFN_vkGetImageMemoryRequirements) vkGetDeviceProcAddr(device, "vkGetImageMemoryRequirements");
+	pTable->GetImageSparseMemoryRequirements = (PFN_vkGetImageSparseMemoryRequirements) vkGetDeviceProcAddr(device, "vkGetImageSparseMemoryRequirements");
+	pTable->QueueBindSparse = (PFN_vkQueueBindSparse) vkGetDeviceProcAddr(device, "vkQueueBindSparse");
+	pTable->CreateFence = (PFN_vkCreateFence) vkGetDeviceProcAddr(device, "vkCreateFence");
+	pTable->DestroyFence = (PFN_vkDestroyFence) vkGetDeviceProcAddr(device, "vkDestroyFence");
+	pTable->ResetFences = (PFN_vkResetFences) vkGetDeviceProcAddr(device, "vkResetFences");
+	pTable->GetFenceStatus = (PFN_vkGetFenceStatus) vkGetDeviceProcAddr(device, "vkGetFenceStatus");
+	pTable->WaitForFences = (PFN_vkWaitForFences) vkGetDeviceProcAddr(device, "vkWaitForFences");
+	pTable->CreateSemaphore = (PFN_vkCreateSemaphore) vkGetDeviceProcAddr(device, "vkCreateSemaphore");
+	pTable->DestroySemaphore = (PFN_vkDestroySemaphore) vkGetDeviceProcAddr(device, "vkDestroySemaphore");
+	pTable->CreateEvent = (PFN_vkCreateEvent) vkGetDeviceProcAddr(device, "vkCreateEvent");
+	pTable->DestroyEvent = (PFN_vkDestroyEvent) vkGetDeviceProcAddr(device, "vkDestroyEvent");
+	pTable->GetEventStatus = (PFN_vkGetEventStatus) vkGetDeviceProcAddr(device, "vkGetEventStatus");
+	pTable->SetEvent = (PFN_vkSetEvent) vkGetDeviceProcAddr(device, "vkSetEvent");
+	pTable->ResetEvent = (PFN_vkResetEvent) vkGetDeviceProcAddr(device, "vkResetEvent");
+	pTable->CreateQueryPool = (PFN_vkCreateQueryPool) vkGetDeviceProcAddr(device, "vkCreateQueryPool");
+	pTable->DestroyQueryPool = (PFN_vkDestroyQueryPool) vkGetDeviceProcAddr(device, "vkDestroyQueryPool");
+	pTable->GetQueryPoolResults = (PFN_vkGetQueryPoolResults) vkGetDeviceProcAddr(device, "vkGetQueryPoolResults");
+	pTable->CreateBuffer = (PFN_vkCreateBuffer) vkGetDeviceProcAddr(device, "vkCreateBuffer");
+	pTable->DestroyBuffer = (PFN_vkDestroyBuffer) vkGetDeviceProcAddr(device, "vkDestroyBuffer");
+	pTable->CreateBufferView = (PFN_vkCreateBufferView) vkGetDeviceProcAddr(device, "vkCreateBufferView");
+	pTable->DestroyBufferView = (PFN_vkDestroyBufferView) vkGetDeviceProcAddr(device, "vkDestroyBufferView");
+	pTable->CreateImage = (PFN_vkCreateImage) vkGetDeviceProcAddr(device, "vkCreateImage");
+	pTable->DestroyImage = (PFN_vkDestroyImage) vkGetDeviceProcAddr(device, "vkDestroyImage");
+	pTable->GetImageSubresourceLayout = (PFN_vkGetImageSubresourceLayout) vkGetDeviceProcAddr(device, "vkGetImageSubresourceLayout");
+	pTable->CreateImageView = (PFN_vkCreateImageView) vkGetDeviceProcAddr(device, "vkCreateImageView");
+	pTable->DestroyImageView = (PFN_vkDestroyImageView) vkGetDeviceProcAddr(device, "vkDestroyImageView");
+	pTable->CreateShaderModule = (PFN_vkCreateShaderModule) vkGetDeviceProcAddr(device, "vkCreateShaderModule");
+	pTable->DestroyShaderModule = (PFN_vkDestroyShaderModule) vkGetDeviceProcAddr(device, "vkDestroyShaderModule");
+	pTable->CreatePipelineCache = (PFN_vkCreatePipelineCache) vkGetDeviceProcAddr(device, "vkCreatePipelineCache");
+	pTable->DestroyPipelineCache = (PFN_vkDestroyPipelineCache) vkGetDeviceProcAddr(device, "vkDestroyPipelineCache");
+	pTable->GetPipelineCacheData = (PFN_vkGetPipelineCacheData) vkGetDeviceProcAddr(device, "vkGetPipelineCacheData");
+	pTable->MergePipelineCaches = (PFN_vkMergePipelineCaches) vkGetDeviceProcAddr(device, "vkMergePipelineCaches");
+	pTable->CreateGraphicsPipelines = (PFN_vkCreateGraphicsPipelines) vkGetDeviceProcAddr(device, "vkCreateGraphicsPipelines");
+	pTable->CreateComputePipelines = (PFN_vkCreateComputePipelines) vkGetDeviceProcAddr(device, "vkCreateComputePipelines");
+	pTable->DestroyPipeline = (PFN_vkDestroyPipeline) vkGetDeviceProcAddr(device, "vkDestroyPipeline");
+	pTable->CreatePipelineLayout = (PFN_vkCreatePipelineLayout) vkGetDeviceProcAddr(device, "vkCreatePipelineLayout");
+	pTable->DestroyPipelineLayout = (PFN_vkDestroyPipelineLayout) vkGetDeviceProcAddr(device, "vkDestroyPipelineLayout");
+	pTable->CreateSampler = (PFN_vkCreateSampler) vkGetDeviceProcAddr(device, "vkCreateSampler");
+	pTable->DestroySampler = (PFN_vkDestroySampler) vkGetDeviceProcAddr(device, "vkDestroySampler");
+	pTable->CreateDescriptorSetLayout = (PFN_vkCreateDescriptorSetLayout) vkGetDeviceProcAddr(device, "vkCreateDescriptorSetLayout");
+	pTable->DestroyDescriptorSetLayout = (PFN_vkDestroyDescriptorSetLayout) vkGetDeviceProcAddr(device, "vkDestroyDescriptorSetLayout");
+	pTable->CreateDescriptorPool = (PFN_vkCreateDescriptorPool) vkGetDeviceProcAddr(device, "vkCreateDescriptorPool");
+	pTable->DestroyDescriptorPool = (PFN_vkDestroyDescriptorPool) vkGetDeviceProcAddr(device, "vkDestroyDescriptorPool");
+	pTable->ResetDescriptorPool = (PFN_vkResetDescriptorPool) vkGetDeviceProcAddr(device, "vkResetDescriptorPool");
+	pTable->AllocateDescriptorSets = (PFN_vkAllocateDescriptorSets) vkGetDeviceProcAddr(device, "vkAllocateDescriptorSets");
+	pTable->FreeDescriptorSets = (PFN_vkFreeDescriptorSets) vkGetDeviceProcAddr(device, "vkFreeDescriptorSets");
+	pTable->UpdateDescriptorSets = (PFN_vkUpdateDescriptorSets) vkGetDeviceProcAddr(device, "vkUpdateDescriptorSets");
+	pTable->CreateFramebuffer = (PFN_vkCreateFramebuffer) vkGetDeviceProcAddr(device, "vkCreateFramebuffer");
+	pTable->DestroyFramebuffer = (PFN_vkDestroyFramebuffer) vkGetDeviceProcAddr(device, "vkDestroyFramebuffer");
+	pTable->CreateRenderPass = (PFN_vkCreateRenderPass) vkGetDeviceProcAddr(device, "vkCreateRenderPass");
+	pTable->DestroyRenderPass = (PFN_vkDestroyRenderPass) vkGetDeviceProcAddr(device, "vkDestroyRenderPass");
+	pTable->GetRenderAreaGranularity = (PFN_vkGetRenderAreaGranularity) vkGetDeviceProcAddr(device, "vkGetRenderAreaGranularity");
+	pTable->CreateCommandPool = (PFN_vkCreateCommandPool) vkGetDeviceProcAddr(device, "vkCreateCommandPool");
+	pTable->DestroyCommandPool = (PFN_vkDestroyCommandPool) vkGetDeviceProcAddr(device, "vkDestroyCommandPool");
+	pTable->ResetCommandPool = (PFN_vkResetCommandPool) vkGetDeviceProcAddr(device, "vkResetCommandPool");
+	pTable->AllocateCommandBuffers = (PFN_vkAllocateCommandBuffers) vkGetDeviceProcAddr(device, "vkAllocateCommandBuffers");
+	pTable->FreeCommandBuffers = (PFN_vkFreeCommandBuffers) vkGetDeviceProcAddr(device, "vkFreeCommandBuffers");
+	pTable->BeginCommandBuffer = (PFN_vkBeginCommandBuffer) vkGetDeviceProcAddr(device, "vkBeginCommandBuffer");
+	pTable->EndCommandBuffer = (PFN_vkEndCommandBuffer) vkGetDeviceProcAddr(device, "vkEndCommandBuffer");
+	pTable->ResetCommandBuffer = (PFN_vkResetCommandBuffer) vkGetDeviceProcAddr(device, "vkResetCommandBuffer");
+	pTable->CmdBindPipeline = (PFN_vkCmdBindPipeline) vkGetDeviceProcAddr(device, "vkCmdBindPipeline");
+	pTable->CmdSetViewport = (PFN_vkCmdSetViewport) vkGetDeviceProcAddr(device, "vkCmdSetViewport");
+	pTable->CmdSetScissor = (PFN_vkCmdSetScissor) vkGetDeviceProcAddr(device, "vkCmdSetScissor");
+	pTable->CmdSetLineWidth = (PFN_vkCmdSetLineWidth) vkGetDeviceProcAddr(device, "vkCmdSetLineWidth");
+	pTable->CmdSetDepthBias = (PFN_vkCmdSetDepthBias) vkGetDeviceProcAddr(device, "vkCmdSetDepthBias");
+	pTable->CmdSetBlendConstants = (PFN_vkCmdSetBlendConstants) vkGetDeviceProcAddr(device, "vkCmdSetBlendConstants");
+	pTable->CmdSetDepthBounds = (PFN_vkCmdSetDepthBounds) vkGetDeviceProcAddr(device, "vkCmdSetDepthBounds");
+	pTable->CmdSetStencilCompareMask = (PFN_vkCmdSetStencilCompareMask) vkGetDeviceProcAddr(device, "vkCmdSetStencilCompareMask");
+	pTable->CmdSetStencilWriteMask = (PFN_vkCmdSetStencilWriteMask) vkGetDeviceProcAddr(device, "vkCmdSetStencilWriteMask");
+	pTable->CmdSetStencilReference = (PFN_vkCmdSetStencilReference) vkGetDeviceProcAddr(device, "vkCmdSetStencilReference");
+	pTable->CmdBindDescriptorSets = (PFN_vkCmdBindDescriptorSets) vkGetDeviceProcAddr(device, "vkCmdBindDescriptorSets");
+	pTable->CmdBindIndexBuffer = (PFN_vkCmdBindIndexBuffer) vkGetDeviceProcAddr(device, "vkCmdBindIndexBuffer");
+	pTable->CmdBindVertexBuffers = (PFN_vkCmdBindVertexBuffers) vkGetDeviceProcAddr(device, "vkCmdBindVertexBuffers");
+	pTable->CmdDraw = (PFN_vkCmdDraw) vkGetDeviceProcAddr(device, "vkCmdDraw");
+	pTable->CmdDrawIndexed = (PFN_vkCmdDrawIndexed) vkGetDeviceProcAddr(device, "vkCmdDrawIndexed");
+	pTable->CmdDrawIndirect = (PFN_vkCmdDrawIndirect) vkGetDeviceProcAddr(device, "vkCmdDrawIndirect");
+	pTable->CmdDrawIndexedIndirect = (PFN_vkCmdDrawIndexedIndirect) vkGetDeviceProcAddr(device, "vkCmdDrawIndexedIndirect");
+	pTable->CmdDispatch = (PFN_vkCmdDispatch) vkGetDeviceProcAddr(device, "vkCmdDispatch");
+	pTable->CmdDispatchIndirect = (PFN_vkCmdDispatchIndirect) vkGetDeviceProcAddr(device, "vkCmdDispatchIndirect");
+	pTable->CmdCopyBuffer = (PFN_vkCmdCopyBuffer) vkGetDeviceProcAddr(device, "vkCmdCopyBuffer");
+	pTable->CmdCopyImage = (PFN_vkCmdCopyImage) vkGetDeviceProcAddr(device, "vkCmdCopyImage");
+	pTable->CmdBlitImage = (PFN_vkCmdBlitImage) vkGetDeviceProcAddr(device, "vkCmdBlitImage");
+	pTable->CmdCopyBufferToImage = (PFN_vkCmdCopyBufferToImage) vkGetDeviceProcAddr(device, "vkCmdCopyBufferToImage");
+	pTable->CmdCopyImageToBuffer = (PFN_vkCmdCopyImageToBuffer) vkGetDeviceProcAddr(device, "vkCmdCopyImageToBuffer");
+	pTable->CmdUpdateBuffer = (PFN_vkCmdUpdateBuffer) vkGetDeviceProcAddr(device, "vkCmdUpdateBuffer");
+	pTable->CmdFillBuffer = (PFN_vkCmdFillBuffer) vkGetDeviceProcAddr(device, "vkCmdFillBuffer");
+	pTable->CmdClearColorImage = (PFN_vkCmdClearColorImage) vkGetDeviceProcAddr(device, "vkCmdClearColorImage");
+	pTable->CmdClearDepthStencilImage = (PFN_vkCmdClearDepthStencilImage) vkGetDeviceProcAddr(device, "vkCmdClearDepthStencilImage");
+	pTable->CmdClearAttachments = (PFN_vkCmdClearAttachments) vkGetDeviceProcAddr(device, "vkCmdClearAttachments");
+	pTable->CmdResolveImage = (PFN_vkCmdResolveImage) vkGetDeviceProcAddr(device, "vkCmdResolveImage");
+	pTable->CmdSetEvent = (PFN_vkCmdSetEvent) vkGetDeviceProcAddr(device, "vkCmdSetEvent");
+	pTable->CmdResetEvent = (PFN_vkCmdResetEvent) vkGetDeviceProcAddr(device, "vkCmdResetEvent");
+	pTable->CmdWaitEvents = (PFN_vkCmdWaitEvents) vkGetDeviceProcAddr(device, "vkCmdWaitEvents");
+	pTable->CmdPipelineBarrier = (PFN_vkCmdPipelineBarrier) vkGetDeviceProcAddr(device, "vkCmdPipelineBarrier");
+	pTable->CmdBeginQuery = (PFN_vkCmdBeginQuery) vkGetDeviceProcAddr(device, "vkCmdBeginQuery");
+	pTable->CmdEndQuery = (PFN_vkCmdEndQuery) vkGetDeviceProcAddr(device, "vkCmdEndQuery");
+	pTable->CmdResetQueryPool = (PFN_vkCmdResetQueryPool) vkGetDeviceProcAddr(device, "vkCmdResetQueryPool");
+	pTable->CmdWriteTimestamp = (PFN_vkCmdWriteTimestamp) vkGetDeviceProcAddr(device, "vkCmdWriteTimestamp");
+	pTable->CmdCopyQueryPoolResults = (PFN_vkCmdCopyQueryPoolResults) vkGetDeviceProcAddr(device, "vkCmdCopyQueryPoolResults");
+	pTable->CmdPushConstants = (PFN_vkCmdPushConstants) vkGetDeviceProcAddr(device, "vkCmdPushConstants");
+	pTable->CmdBeginRenderPass = (PFN_vkCmdBeginRenderPass) vkGetDeviceProcAddr(device, "vkCmdBeginRenderPass");
+	pTable->CmdNextSubpass = (PFN_vkCmdNextSubpass) vkGetDeviceProcAddr(device, "vkCmdNextSubpass");
+	pTable->CmdEndRenderPass = (PFN_vkCmdEndRenderPass) vkGetDeviceProcAddr(device, "vkCmdEndRenderPass");
+	pTable->CmdExecuteCommands = (PFN_vkCmdExecuteCommands) vkGetDeviceProcAddr(device, "vkCmdExecuteCommands");
+	pTable->CreateSwapchainKHR = (PFN_vkCreateSwapchainKHR) vkGetDeviceProcAddr(device, "vkCreateSwapchainKHR");
+	pTable->DestroySwapchainKHR = (PFN_vkDestroySwapchainKHR) vkGetDeviceProcAddr(device, "vkDestroySwapchainKHR");
+	pTable->GetSwapchainImagesKHR = (PFN_vkGetSwapchainImagesKHR) vkGetDeviceProcAddr(device, "vkGetSwapchainImagesKHR");
+	pTable->AcquireNextImageKHR = (PFN_vkAcquireNextImageKHR) vkGetDeviceProcAddr(device, "vkAcquireNextImageKHR");
+	pTable->QueuePresentKHR = (PFN_vkQueuePresentKHR) vkGetDeviceProcAddr(device, "vkQueuePresentKHR");
+	pTable->CreateSharedSwapchainsKHR = (PFN_vkCreateSharedSwapchainsKHR) vkGetDeviceProcAddr(device, "vkCreateSharedSwapchainsKHR");
+	pTable->DebugMarkerSetObjectTagEXT = (PFN_vkDebugMarkerSetObjectTagEXT) vkGetDeviceProcAddr(device, "vkDebugMarkerSetObjectTagEXT");
+	pTable->DebugMarkerSetObjectNameEXT = (PFN_vkDebugMarkerSetObjectNameEXT) vkGetDeviceProcAddr(device, "vkDebugMarkerSetObjectNameEXT");
+	pTable->CmdDebugMarkerBeginEXT = (PFN_vkCmdDebugMarkerBeginEXT) vkGetDeviceProcAddr(device, "vkCmdDebugMarkerBeginEXT");
+	pTable->CmdDebugMarkerEndEXT = (PFN_vkCmdDebugMarkerEndEXT) vkGetDeviceProcAddr(device, "vkCmdDebugMarkerEndEXT");
+	pTable->CmdDebugMarkerInsertEXT = (PFN_vkCmdDebugMarkerInsertEXT) vkGetDeviceProcAddr(device, "vkCmdDebugMarkerInsertEXT");
+
+#ifdef VKEL_FALLBACK_STUBS
+	vkelFillStubs(pTable, vkelDeviceStubs, sizeof(vkelDeviceStubs) / sizeof(vkelDeviceStubs[0]));
+#endif
+}
+
+#if (VKEL_MAX_DEVICES & (VKEL_MAX_DEVICES - 1)) != 0
+#	error VKEL_MAX_DEVICES must be a power of two
+#endif
+
+// Kept at most half full. Readers never lock, while registering
+// and unregistering is serialized by vkelDeviceRegistryMutex.
+VkelDeviceSlot vkelDeviceSlots[VKEL_DEVICE_SLOT_COUNT];
+static uint32_t vkelDeviceCount;
+
+static VkelPlatformMutex vkelDeviceRegistryMutex = VKEL_PLATFORM_MUTEX_INITIALIZER;
+
+static char vkelRemovedDeviceKey;
+
+static VkelDeviceSlot* vkelFindDeviceSlot(const void *key)
+{
+	uint32_t slotIndex = vkelHashDeviceKey(key);
+	
+	uint32_t probeCount = 0;
+	for (probeCount = 0; probeCount < VKEL_DEVICE_SLOT_COUNT; probeCount++)
+	{
+		VkelDeviceSlot *slot = &vkelDeviceSlots[slotIndex];
+		
+		void *slotKey = vkelAtomicLoadPointer(&slot->key);
+		
+		if (slotKey == key)
+			return slot;
+		
+		if (!slotKey)
+			break;
+		
+		slotIndex = (slotIndex + 1) & (VKEL_DEVICE_SLOT_COUNT - 1);
+	}
+	
+	return NULL;
+}
+
+
+// Removed slots would otherwise pile up until every miss probes the whole table. One
+// that no registered device is probed past can be made unused again, without readers
+// noticing. Called with vkelDeviceRegistryMutex held, with the index of a removed slot.
+static void vkelClearRemovedDeviceSlots(uint32_t slotIndex)
+{
+	const uint32_t slotMask = VKEL_DEVICE_SLOT_COUNT - 1;
+	
+	// Go to the last used slot of the run this slot is in
+	uint32_t probeCount = 0;
+	while (vkelDeviceSlots[(slotIndex + 1) & slotMask].key && (++probeCount < VKEL_DEVICE_SLOT_COUNT))
+		slotIndex = (slotIndex + 1) & slotMask;
+	
+	// Then check the removed slots of the run back to front, as clearing
+	// one ends the run for the removed slots in front of it
+	for (probeCount = 0; vkelDeviceSlots[slotIndex].key && (probeCount < VKEL_DEVICE_SLOT_COUNT); probeCount++)
+	{
+		if (vkelDeviceSlots[slotIndex].key == &vkelRemovedDeviceKey)
+		{
+			VkBool32 probedPast = VK_FALSE;
+			
+			uint32_t nextIndex = (slotIndex + 1) & slotMask;
+			
+			for (; vkelDeviceSlots[nextIndex].key && (nextIndex != slotIndex); nextIndex = (nextIndex + 1) & slotMask)
+			{
+				void *key = vkelDeviceSlots[nextIndex].key;
+				
+				// Found by probing from its hash, so it's probed past
+				// this slot when its hash comes at or before it
+				if ((key != &vkelRemovedDeviceKey) && (((nextIndex - vkelHashDeviceKey(key)) & slotMask) >= ((nextIndex - slotIndex) & slotMask)))
+				{
+					probedPast = VK_TRUE;
+					break;
+				}
+			}
+			
+			if (!probedPast)
+				vkelAtomicStorePointer(&vkelDeviceSlots[slotIndex].key, NULL);
+		}
+		
+		slotIndex = (slotIndex - 1) & slotMask;
+	}
+}
+
+
+const VkelDevice* vkelGetDispatchableDevice(const void *dispatchableHandle)
+{
+	if (!dispatchableHandle)
+		return NULL;
+	
+	VkelDeviceSlot *slot = vkelFindDeviceSlot(vkelGetDispatchKey(dispatchableHandle));
+	
+	if (!slot)
+		return NULL;
+	
+	return (const VkelDevice*) vkelAtomicLoadPointer(&slot->entry);
+}
+
+const VkelDevice* vkelGetDevice(VkDevice device)
+{
+	return vkelGetDispatchableDevice(device);
+}
+
+
+const VkelDevice* vkelRegisterDevice(VkPhysicalDevice physicalDevice, VkDevice device)
+{
+	assert(device);
+	
+	
+	const VkelDevice *existing = vkelGetDevice(device);
+	
+	// Without the loader (vkelInitDirectICD()) the key is the ICD's
+	// magic value, so only a single device can be registered
+	if (existing)
+		return (existing->device == device) ? existing : NULL;
+	
+	
+	void *key = vkelGetDispatchKey(device);
+	
+	
+	// Everything slow happens before taking the lock, so other
+	// registrations only wait for the slot to be published
+	VkelDevice *entry = vkelCreateDeviceEntry();
+	
+	if (!entry)
+		return NULL;
+	
+	entry->physicalDevice = physicalDevice;
+	entry->device = device;
+	
+	vkelGetPhysicalDeviceCapabilities(physicalDevice, &entry->capabilities);
+	vkelLoadDeviceTable(&entry->table, device);
+	
+#ifdef VKEL_RECORD_USAGE
+	// For threads binding the device (see vkelBindDevice())
+	vkelRecordDeviceUsageProcs(&entry->table, (VkelDeviceTable*) (entry + 1));
+#endif
+	
+	
+	vkelPlatformLockMutex(&vkelDeviceRegistryMutex);
+	
+	VkelDeviceSlot *slot = vkelFindDeviceSlot(key);
+	
+	if (slot)
+	{
+		// Registered by another thread in the meantime
+		vkelPlatformUnlockMutex(&vkelDeviceRegistryMutex);
+		
+		vkel_free(entry);
+		
+		existing = (const VkelDevice*) vkelAtomicLoadPointer(&slot->entry);
+		
+		return (existing->device == device) ? existing : NULL;
+	}
+	
+	if (vkelDeviceCount >= VKEL_MAX_DEVICES)
+	{
+		vkelPlatformUnlockMutex(&vkelDeviceRegistryMutex);
+		
+		vkel_free(entry);
+		
+		return NULL;
+	}
+	
+	uint32_t slotIndex = vkelHashDeviceKey(key);
+	
+	while (vkelDeviceSlots[slotIndex].key && (vkelDeviceSlots[slotIndex].key != &vkelRemovedDeviceKey))
+		slotIndex = (slotIndex + 1) & (VKEL_DEVICE_SLOT_COUNT - 1);
+	
+	slot = &vkelDeviceSlots[slotIndex];
+	
+	// The entry is published before the key, so a reader
+	// finding the key always finds a complete entry
+	vkelAtomicStorePointer(&slot->entry, entry);
+	vkelAtomicStorePointer(&slot->key, key);
+	
+	vkelDeviceCount++;
+	
+	vkelPlatformUnlockMutex(&vkelDeviceRegistryMutex);
+	
+	
+	return entry;
+}
+
+void vkelUnregisterDevice(VkDevice device)
+{
+	if (!device)
+		return;
+	
+	
+	vkelPlatformLockMutex(&vkelDeviceRegistryMutex);
+	
+	VkelDeviceSlot *slot = vkelFindDeviceSlot(vkelGetDispatchKey(device));
+	
+	VkelDevice *entry = NULL;
+	
+	if (slot)
+	{
+		entry = (VkelDevice*) slot->entry;
+		
+		// Removed keys keep probing going for other devices
+		vkelAtomicStorePointer(&slot->key, &vkelRemovedDeviceKey);
+		vkelAtomicStorePointer(&slot->entry, NULL);
+		
+		vkelDeviceCount--;
+		
+		vkelClearRemovedDeviceSlots((uint32_t) (slot - vkelDeviceSlots));
+	}
+	
+	vkelPlatformUnlockMutex(&vkelDeviceRegistryMutex);
+	
+	
+	// Other threads may still be calling through it
+	vkelRetire(entry);
+}
+	
+void vkelUninit(void)
+{
+	if (vkelVkLibHandle)
+	{
+		vkelPlatformCloseLibrary(vkelVkLibHandle);
+		vkelVkLibHandle = NULL;
+	}
+	
+	vkelIcdGetInstanceProcAddr = NULL;
+	
+	vkelSourceTable = NULL;
+	
+	vkelTable.version = 0;
+	
+	vkelPublishDevice(NULL);
+	vkelReclaimAll();
+	
+	vkelInvalidateAllEnumerations();
+}
+
+
+struct VkelTask_T
+{
+	VkBool32 (*pfnTask)(void *pUserData);
+	void *pUserData;
+	
+	VkBool32 result;
+	
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+	HANDLE thread;
+#else
+	pthread_t thread;
+	pthread_mutex_t mutex;
+	VkBool32 complete;
+#endif
+};
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+static DWORD WINAPI vkelTaskMain(LPVOID pTask)
+#else
+static void* vkelTaskMain(void *pTask)
+#endif
+{
+	VkelTask task = (VkelTask) pTask;
+	
+	VkBool32 result = task->pfnTask(task->pUserData);
+	
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+	task->result = result;
+	
+	return 0;
+#else
+	pthread_mutex_lock(&task->mutex);
+	task->result = result;
+	task->complete = VK_TRUE;
+	pthread_mutex_unlock(&task->mutex);
+	
+	return NULL;
+#endif
+}
+
+static VkelTask vkelStartTask(VkBool32 (*pfnTask)(void *pUserData), void *pUserData)
+{
+	VkelTask task = (VkelTask) vkel_calloc(1, sizeof(struct VkelTask_T), VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+	
+	if (!task)
+		return NULL;
+	
+	task->pfnTask = pfnTask;
+	task->pUserData = pUserData;
+	
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+	task->thread = CreateThread(NULL, 0, vkelTaskMain, task, 0, NULL);
+	
+	if (!task->thread)
+	{
+		vkel_free(task);
+		return NULL;
+	}
+#else
+	pthread_mutex_init(&task->mutex, NULL);
+	
+	if (pthread_create(&task->thread, NULL, vkelTaskMain, task))
+	{
+		pthread_mutex_destroy(&task->mutex);
+		vkel_free(task);
+		return NULL;
+	}
+#endif
+	
+	return task;
+}
+
+
+VkBool32 vkelIsTaskComplete(VkelTask task)
+{
+	assert(task);
+	
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+	return (WaitForSingleObject(task->thread, 0) == WAIT_OBJECT_0) ? VK_TRUE : VK_FALSE;
+#else
+	pthread_mutex_lock(&task->mutex);
+	VkBool32 complete = task->complete;
+	pthread_mutex_unlock(&task->mutex);
+	
+	return complete;
+#endif
+}
+
+VkBool32 vkelWaitTask(VkelTask task)
+{
+	if (!task)
+		return VK_FALSE;
+	
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+	WaitForSingleObject(task->thread, INFINITE);
+	CloseHandle(task->thread);
+#else
+	pthread_join(task->thread, NULL);
+	pthread_mutex_destroy(&task->mutex);
+#endif
+	
+	VkBool32 result = task->result;
+	
+	vkel_free(task);
+	
+	return result;
+}
+
+
+static VkBool32 vkelInitTask(void *pUserData)
+{
+	(void) pUserData;
+	
+	return vkelInit();
+}
+
+VkelTask vkelInitAsync(void)
+{
+	return vkelStartTask(vkelInitTask, NULL);
+}
+
+
+static VkelPlatformMutex vkelPrewarmMutex = VKEL_PLATFORM_MUTEX_INITIALIZER;
+static VkelPrewarmStats vkelPrewarmStats;
+
+static uint64_t vkelGetNanoseconds(void)
+{
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+	LARGE_INTEGER frequency, counter;
+	
+	QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&counter);
+	
+	return (uint64_t) ((double) counter.QuadPart * (1000000000.0 / (double) frequency.QuadPart));
+#else
+	struct timespec now;
+	
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	
+	return (uint64_t) now.tv_sec * 1000000000u + (uint64_t) now.tv_nsec;
+#endif
+}
+
+static VkBool32 vkelPrewarmFile(const char *pPath)
+{
+	uint64_t size = 0;
+	
+#if !defined(VK_USE_PLATFORM_WIN32_KHR) && defined(POSIX_FADV_WILLNEED)
+	int fd = open(pPath, O_RDONLY);
+	
+	if (fd < 0)
+		return VK_FALSE;
+	
+	struct stat status;
+	
+	if (fstat(fd, &status) || !S_ISREG(status.st_mode))
+	{
+		close(fd);
+		return VK_FALSE;
+	}
+	
+	// Starts reading the whole file in the background, without mapping it or waiting for it
+	posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+	close(fd);
+	
+	size = (uint64_t) status.st_size;
+#else
+	FILE *file = fopen(pPath, "rb");
+	
+	if (!file)
+		return VK_FALSE;
+	
+	// Without a readahead hint, reading it through is what gets it into the cache
+	char *buffer = (char*) vkel_malloc(65536, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+	
+	if (buffer)
+	{
+		size_t count;
+		
+		while ((count = fread(buffer, 1, 65536, file)) > 0)
+			size += count;
+		
+		vkel_free(buffer);
 	}
-
-
-	free(layerProperties);
-
-
-	return layerNames;
+	
+	fclose(file);
+#endif
+	
+	vkelPlatformLockMutex(&vkelPrewarmMutex);
+	
+	vkelPrewarmStats.fileCount++;
+	vkelPrewarmStats.byteCount += size;
+	
+	vkelPlatformUnlockMutex(&vkelPrewarmMutex);
+	
+	
+	return VK_TRUE;
 }
 
-
-VkBool32 vkelIsInstanceLayerSupported(const char *pLayerName)
+static VkBool32 vkelPrewarmLibraryInDirectory(const char *pDirectory, void *pName)
 {
-	uint32_t layerNameCount = 0;
-	char **layerNames = vkelGetInstanceLayerNames(&layerNameCount);
+	char path[VKEL_MAX_PATH];
 	
-	uint32_t layerNameIndex = 0;
-	for (layerNameIndex = 0; layerNameIndex < layerNameCount; layerNameIndex++)
-	{
-		if (vkel_strcmp(layerNames[layerNameIndex], pLayerName))
-		{
-			vkelDeleteInstanceLayerNames(layerNameCount, layerNames);
+	if (snprintf(path, VKEL_MAX_PATH, "%s/%s", pDirectory, (const char*) pName) >= VKEL_MAX_PATH)
+		return VK_FALSE;
+	
+	return vkelPrewarmFile(path);
+}
 
+// Searched like the OS would when loading it
+static VkBool32 vkelPrewarmLibrary(const char *pName)
+{
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+	char path[VKEL_MAX_PATH];
+	
+	DWORD length = SearchPathA(NULL, pName, NULL, VKEL_MAX_PATH, path, NULL);
+	
+	if (!length || (length >= VKEL_MAX_PATH))
+		return VK_FALSE;
+	
+	return vkelPrewarmFile(path);
+#else
+	// The dynamic linker's cache (ld.so.cache) isn't read, the usual directories are searched instead
+	static const char* const directories[] = {
+#	if defined(__linux__) && defined(__x86_64__)
+		"/usr/lib/x86_64-linux-gnu",
+#	elif defined(__linux__) && defined(__aarch64__)
+		"/usr/lib/aarch64-linux-gnu",
+#	endif
+		"/usr/local/lib",
+		"/usr/lib64",
+		"/usr/lib",
+		"/lib64",
+		"/lib",
+	};
+	
+	if (strchr(pName, '/'))
+		return vkelPrewarmFile(pName);
+	
+	const char *libraryPaths = getenv("LD_LIBRARY_PATH");
+	
+	if (libraryPaths && vkelVisitPathList(libraryPaths, vkelPrewarmLibraryInDirectory, (void*) pName))
+		return VK_TRUE;
+	
+	uint32_t i;
+	
+	for (i = 0; i < (sizeof(directories) / sizeof(directories[0])); ++i)
+		if (vkelPrewarmLibraryInDirectory(directories[i], (void*) pName))
 			return VK_TRUE;
-		}
-	}
-
-	vkelDeleteInstanceLayerNames(layerNameCount, layerNames);
+	
+	return VK_FALSE;
+#endif
+}
 
+static VkBool32 vkelPrewarmIcd(const char *pManifestPath, void *pPrewarmed)
+{
+	char libraryPath[VKEL_MAX_PATH];
+	
+	if (vkelReadIcdLibraryPath(pManifestPath, libraryPath) && vkelPrewarmLibrary(libraryPath))
+		*(VkBool32*) pPrewarmed = VK_TRUE;
+	
+	// Every ICD is prewarmed, as it isn't known which one will be used
 	return VK_FALSE;
 }
 
-VkBool32 vkelIsInstanceExtensionSupported(const char *pLayerName, const char *pExtensionName)
+VkBool32 vkelPrewarm(void)
 {
-	uint32_t extensionNameCount = 0;
-	char **extensionNames = vkelGetInstanceExtensionNames(pLayerName, &extensionNameCount);
+	uint64_t start = vkelGetNanoseconds();
+	
+	VkBool32 prewarmed = vkelPrewarmLibrary(VKEL_PLATFORM_LIBRARY_NAME);
+	
+	const char *icdFilenames = getenv("VK_ICD_FILENAMES");
 	
-	uint32_t extensionNameIndex = 0;
-	for (extensionNameIndex = 0; extensionNameIndex < extensionNameCount; extensionNameIndex++)
+	if (icdFilenames)
+		vkelVisitPathList(icdFilenames, vkelPrewarmIcd, &prewarmed);
+	else
 	{
-		if (vkel_strcmp(extensionNames[extensionNameIndex], pExtensionName))
-		{
-			vkelDeleteInstanceExtensionNames(extensionNameCount, extensionNames);
-
-			return VK_TRUE;
-		}
+		vkelVisitIcdDirectory("/usr/share/vulkan/icd.d", vkelPrewarmIcd, &prewarmed);
+		vkelVisitIcdDirectory("/etc/vulkan/icd.d", vkelPrewarmIcd, &prewarmed);
 	}
+	
+	uint64_t elapsed = vkelGetNanoseconds() - start;
+	
+	vkelPlatformLockMutex(&vkelPrewarmMutex);
+	vkelPrewarmStats.nanoseconds += elapsed;
+	vkelPlatformUnlockMutex(&vkelPrewarmMutex);
+	
+	
+	return prewarmed;
+}
 
-	vkelDeleteInstanceExtensionNames(extensionNameCount, extensionNames);
+static VkBool32 vkelPrewarmTask(void *pUserData)
+{
+	(void) pUserData;
+	
+	return vkelPrewarm();
+}
 
-	return VK_FALSE;
+VkelTask vkelPrewarmAsync(void)
+{
+	return vkelStartTask(vkelPrewarmTask, NULL);
 }
 
+void vkelGetPrewarmStats(VkelPrewarmStats *pStats)
+{
+	assert(pStats);
+	
+	vkelPlatformLockMutex(&vkelPrewarmMutex);
+	*pStats = vkelPrewarmStats;
+	vkelPlatformUnlockMutex(&vkelPrewarmMutex);
+}
+	
 
-VkBool32 vkelIsDeviceLayerSupported(VkPhysicalDevice physicalDevice, const char *pLayerName)
+struct VkelContext_T
 {
-	uint32_t layerNameCount = 0;
-	char **layerNames = vkelGetDeviceLayerNames(physicalDevice, &layerNameCount);
+	void *libraryHandle;
+	PFN_vkGetInstanceProcAddr getInstanceProcAddr;
+	VkInstance instance;
 	
-	uint32_t layerNameIndex = 0;
-	for (layerNameIndex = 0; layerNameIndex < layerNameCount; layerNameIndex++)
-	{
-		if (vkel_strcmp(layerNames[layerNameIndex], pLayerName))
-		{
-			vkelDeleteDeviceLayerNames(layerNameCount, layerNames);
+	VkelTable table;
+	
+	VkelCapabilities instanceCapabilities;
+	VkelCapabilities deviceCapabilities;
+};
 
-			return VK_TRUE;
-		}
-	}
+static VkBool32 vkelHasSuffix(const char *pString, const char *pSuffix)
+{
+	size_t length = strlen(pString);
+	size_t suffixLength = strlen(pSuffix);
+	
+	return ((length >= suffixLength) && !strcmp(pString + length - suffixLength, pSuffix)) ? VK_TRUE : VK_FALSE;
+}
 
-	vkelDeleteDeviceLayerNames(layerNameCount, layerNames);
+static VkResult vkelEnumerateContextExtensions(VkelContext context, VkPhysicalDevice physicalDevice, uint32_t *pCount, VkExtensionProperties *pProperties)
+{
+	if (physicalDevice)
+		return context->table.EnumerateDeviceExtensionProperties ? context->table.EnumerateDeviceExtensionProperties(physicalDevice, NULL, pCount, pProperties) : VK_ERROR_INITIALIZATION_FAILED;
+	
+	return context->table.EnumerateInstanceExtensionProperties ? context->table.EnumerateInstanceExtensionProperties(NULL, pCount, pProperties) : VK_ERROR_INITIALIZATION_FAILED;
+}
 
-	return VK_FALSE;
+static VkResult vkelEnumerateContextLayers(VkelContext context, VkPhysicalDevice physicalDevice, uint32_t *pCount, VkLayerProperties *pProperties)
+{
+	if (physicalDevice)
+		return context->table.EnumerateDeviceLayerProperties ? context->table.EnumerateDeviceLayerProperties(physicalDevice, pCount, pProperties) : VK_ERROR_INITIALIZATION_FAILED;
+	
+	return context->table.EnumerateInstanceLayerProperties ? context->table.EnumerateInstanceLayerProperties(pCount, pProperties) : VK_ERROR_INITIALIZATION_FAILED;
 }
 
-VkBool32 vkelIsDeviceExtensionSupported(VkPhysicalDevice physicalDevice, const char *pLayerName, const char *pExtensionName)
+// The instance support for VK_NULL_HANDLE. Not cached, as the enumeration cache belongs to vkelTable.
+static void vkelGetContextSupport(VkelContext context, VkPhysicalDevice physicalDevice, VkelCapabilities *pCapabilities)
 {
-	uint32_t extensionNameCount = 0;
-	char **extensionNames = vkelGetDeviceExtensionNames(physicalDevice, pLayerName, &extensionNameCount);
+	memset(pCapabilities, 0, sizeof(VkelCapabilities));
+	
 	
-	uint32_t extensionNameIndex = 0;
-	for (extensionNameIndex = 0; extensionNameIndex < extensionNameCount; extensionNameIndex++)
+	uint32_t extPropertyCount = 0;
+	
+	if (vkelEnumerateContextExtensions(context, physicalDevice, &extPropertyCount, NULL) == VK_SUCCESS)
 	{
-		if (vkel_strcmp(extensionNames[extensionNameIndex], pExtensionName))
-		{
-			vkelDeleteDeviceExtensionNames(extensionNameCount, extensionNames);
-
-			return VK_TRUE;
-		}
+		VkExtensionProperties *extProperties = (VkExtensionProperties*) vkel_calloc(extPropertyCount + 1, sizeof(VkExtensionProperties), VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+		
+		if (extProperties && (vkelEnumerateContextExtensions(context, physicalDevice, &extPropertyCount, extProperties) >= VK_SUCCESS))
+			vkelMapExtensions(pCapabilities, extPropertyCount, extProperties);
+		
+		vkel_free(extProperties);
+	}
+	
+	
+	uint32_t layerPropertyCount = 0;
+	
+	if (vkelEnumerateContextLayers(context, physicalDevice, &layerPropertyCount, NULL) == VK_SUCCESS)
+	{
+		VkLayerProperties *layerProperties = (VkLayerProperties*) vkel_calloc(layerPropertyCount + 1, sizeof(VkLayerProperties), VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+		
+		if (layerProperties && (vkelEnumerateContextLayers(context, physicalDevice, &layerPropertyCount, layerProperties) >= VK_SUCCESS))
+			vkelMapLayers(pCapabilities, layerPropertyCount, layerProperties);
+		
+		vkel_free(layerProperties);
 	}
-
-	vkelDeleteDeviceExtensionNames(extensionNameCount, extensionNames);
-
-	return VK_FALSE;
 }
 
-
-VkBool32 vkelInit(void)
+static void vkelUpdateContextTable(VkelContext context)
 {
-	vkelUninit();
+	VkelTable *pTable = &context->table;
 	
-#ifdef VK_USE_PLATFORM_WIN32_KHR
-	const char *name = "vulkan-1.dll";
-#else
-	const char *name = "libvulkan.so.1";
-#endif
+	pTable->version = VKEL_TABLE_VERSION;
+	pTable->size = sizeof(VkelTable);
 	
-	vkelVkLibHandle = vkelPlatformOpenLibrary(name);
+	pTable->extensionIdCount = VKEL_EXT_ID_COUNT;
+	pTable->layerIdCount = VKEL_LAYER_ID_COUNT;
 	
-	if (!vkelVkLibHandle)
-		return VK_FALSE;
+	pTable->pInstanceExtensions = context->instanceCapabilities.extensions;
+	pTable->pInstanceLayers = context->instanceCapabilities.layers;
+	pTable->pDeviceExtensions = context->deviceCapabilities.extensions;
+	pTable->pDeviceLayers = context->deviceCapabilities.layers;
+}
+
+static PFN_vkVoidFunction vkelGetContextDeviceProcAddr(VkelContext context, VkDevice device, const char *pName)
+{
+	PFN_vkVoidFunction proc = context->table.GetDeviceProcAddr ? (PFN_vkVoidFunction) context->table.GetDeviceProcAddr(device, pName) : NULL;
 	
+	if (!proc)
+		proc = context->getInstanceProcAddr(context->instance, pName);
+	
+	return proc;
+}
+
+// Load every function the implementation has for the instance, or the global ones for VK_NULL_HANDLE
+static void vkelLoadContextTable(VkelContext context)
+{
+	VkelTable *pTable = &context->table;
 	
-	__vkAcquireNextImageKHR = (PFN_vkAcquireNextImageKHR) vkelGetProcAddr("vkAcquireNextImageKHR");
-	__vkAllocateCommandBuffers = (PFN_vkAllocateCommandBuffers) vkelGetProcAddr("vkAllocateCommandBuffers");
-	__vkAllocateDescriptorSets = (PFN_vkAllocateDescriptorSets) vkelGetProcAddr("vkAllocateDescriptorSets");
-	__vkAllocateMemory = (PFN_vkAllocateMemory) vkelGetProcAddr("vkAllocateMemory");
-	__vkAllocationFunction = (PFN_vkAllocationFunction) vkelGetProcAddr("vkAllocationFunction");
-	__vkBeginCommandBuffer = (PFN_vkBeginCommandBuffer) vkelGetProcAddr("vkBeginCommandBuffer");
-	__vkBindBufferMemory = (PFN_vkBindBufferMemory) vkelGetProcAddr("vkBindBufferMemory");
-	__vkBindImageMemory = (PFN_vkBindImageMemory) vkelGetProcAddr("vkBindImageMemory");
-	__vkCmdBeginQuery = (PFN_vkCmdBeginQuery) vkelGetProcAddr("vkCmdBeginQuery");
-	__vkCmdBeginRenderPass = (PFN_vkCmdBeginRenderPass) vkelGetProcAddr("vkCmdBeginRenderPass");
-	__vkCmdBindDescriptorSets = (PFN_vkCmdBindDescriptorSets) vkelGetProcAddr("vkCmdBindDescriptorSets");
-	__vkCmdBindIndexBuffer = (PFN_vkCmdBindIndexBuffer) vkelGetProcAddr("vkCmdBindIndexBuffer");
-	__vkCmdBindPipeline = (PFN_vkCmdBindPipeline) vkelGetProcAddr("vkCmdBindPipeline");
-	__vkCmdBindVertexBuffers = (PFN_vkCmdBindVertexBuffers) vkelGetProcAddr("vkCmdBindVertexBuffers");
-	__vkCmdBlitImage = (PFN_vkCmdBlitImage) vkelGetProcAddr("vkCmdBlitImage");
-	__vkCmdClearAttachments = (PFN_vkCmdClearAttachments) vkelGetProcAddr("vkCmdClearAttachments");
-	__vkCmdClearColorImage = (PFN_vkCmdClearColorImage) vkelGetProcAddr("vkCmdClearColorImage");
-	__vkCmdClearDepthStencilImage = (PFN_vkCmdClearDepthStencilImage) vkelGetProcAddr("vkCmdClearDepthStencilImage");
-	__vkCmdCopyBuffer = (PFN_vkCmdCopyBuffer) vkelGetProcAddr("vkCmdCopyBuffer");
-	__vkCmdCopyBufferToImage = (PFN_vkCmdCopyBufferToImage) vkelGetProcAddr("vkCmdCopyBufferToImage");
-	__vkCmdCopyImage = (PFN_vkCmdCopyImage) vkelGetProcAddr("vkCmdCopyImage");
-	__vkCmdCopyImageToBuffer = (PFN_vkCmdCopyImageToBuffer) vkelGetProcAddr("vkCmdCopyImageToBuffer");
-	__vkCmdCopyQueryPoolResults = (PFN_vkCmdCopyQueryPoolResults) vkelGetProcAddr("vkCmdCopyQueryPoolResults");
-	__vkCmdDebugMarkerBeginEXT = (PFN_vkCmdDebugMarkerBeginEXT) vkelGetProcAddr("vkCmdDebugMarkerBeginEXT");
-	__vkCmdDebugMarkerEndEXT = (PFN_vkCmdDebugMarkerEndEXT) vkelGetProcAddr("vkCmdDebugMarkerEndEXT");
-	__vkCmdDebugMarkerInsertEXT = (PFN_vkCmdDebugMarkerInsertEXT) vkelGetProcAddr("vkCmdDebugMarkerInsertEXT");
-	__vkCmdDispatch = (PFN_vkCmdDispatch) vkelGetProcAddr("vkCmdDispatch");
-	__vkCmdDispatchIndirect = (PFN_vkCmdDispatchIndirect) vkelGetProcAddr("vkCmdDispatchIndirect");
-	__vkCmdDraw = (PFN_vkCmdDraw) vkelGetProcAddr("vkCmdDraw");
-	__vkCmdDrawIndexed = (PFN_vkCmdDrawIndexed) vkelGetProcAddr("vkCmdDrawIndexed");
-	__vkCmdDrawIndexedIndirect = (PFN_vkCmdDrawIndexedIndirect) vkelGetProcAddr("vkCmdDrawIndexedIndirect");
-	__vkCmdDrawIndirect = (PFN_vkCmdDrawIndirect) vkelGetProcAddr("vkCmdDrawIndirect");
-	__vkCmdEndQuery = (PFN_vkCmdEndQuery) vkelGetProcAddr("vkCmdEndQuery");
-	__vkCmdEndRenderPass = (PFN_vkCmdEndRenderPass) vkelGetProcAddr("vkCmdEndRenderPass");
-	__vkCmdExecuteCommands = (PFN_vkCmdExecuteCommands) vkelGetProcAddr("vkCmdExecuteCommands");
-	__vkCmdFillBuffer = (PFN_vkCmdFillBuffer) vkelGetProcAddr("vkCmdFillBuffer");
-	__vkCmdNextSubpass = (PFN_vkCmdNextSubpass) vkelGetProcAddr("vkCmdNextSubpass");
-	__vkCmdPipelineBarrier = (PFN_vkCmdPipelineBarrier) vkelGetProcAddr("vkCmdPipelineBarrier");
-	__vkCmdPushConstants = (PFN_vkCmdPushConstants) vkelGetProcAddr("vkCmdPushConstants");
-	__vkCmdResetEvent = (PFN_vkCmdResetEvent) vkelGetProcAddr("vkCmdResetEvent");
-	__vkCmdResetQueryPool = (PFN_vkCmdResetQueryPool) vkelGetProcAddr("vkCmdResetQueryPool");
-	__vkCmdResolveImage = (PFN_vkCmdResolveImage) vkelGetProcAddr("vkCmdResolveImage");
-	__vkCmdSetBlendConstants = (PFN_vkCmdSetBlendConstants) vkelGetProcAddr("vkCmdSetBlendConstants");
-	__vkCmdSetDepthBias = (PFN_vkCmdSetDepthBias) vkelGetProcAddr("vkCmdSetDepthBias");
-	__vkCmdSetDepthBounds = (PFN_vkCmdSetDepthBounds) vkelGetProcAddr("vkCmdSetDepthBounds");
-	__vkCmdSetEvent = (PFN_vkCmdSetEvent) vkelGetProcAddr("vkCmdSetEvent");
-	__vkCmdSetLineWidth = (PFN_vkCmdSetLineWidth) vkelGetProcAddr("vkCmdSetLineWidth");
-	__vkCmdSetScissor = (PFN_vkCmdSetScissor) vkelGetProcAddr("vkCmdSetScissor");
-	__vkCmdSetStencilCompareMask = (PFN_vkCmdSetStencilCompareMask) vkelGetProcAddr("vkCmdSetStencilCompareMask");
-	__vkCmdSetStencilReference = (PFN_vkCmdSetStencilReference) vkelGetProcAddr("vkCmdSetStencilReference");
-	__vkCmdSetStencilWriteMask = (PFN_vkCmdSetStencilWriteMask) vkelGetProcAddr("vkCmdSetStencilWriteMask");
-	__vkCmdSetViewport = (PFN_vkCmdSetViewport) vkelGetProcAddr("vkCmdSetViewport");
-	__vkCmdUpdateBuffer = (PFN_vkCmdUpdateBuffer) vkelGetProcAddr("vkCmdUpdateBuffer");
-	__vkCmdWaitEvents = (PFN_vkCmdWaitEvents) vkelGetProcAddr("vkCmdWaitEvents");
-	__vkCmdWriteTimestamp = (PFN_vkCmdWriteTimestamp) vkelGetProcAddr("vkCmdWriteTimestamp");
-	__vkCreateBuffer = (PFN_vkCreateBuffer) vkelGetProcAddr("vkCreateBuffer");
-	__vkCreateBufferView = (PFN_vkCreateBufferView) vkelGetProcAddr("vkCreateBufferView");
-	__vkCreateCommandPool = (PFN_vkCreateCommandPool) vkelGetProcAddr("vkCreateCommandPool");
-	__vkCreateComputePipelines = (PFN_vkCreateComputePipelines) vkelGetProcAddr("vkCreateComputePipelines");
-	__vkCreateDebugReportCallbackEXT = (PFN_vkCreateDebugReportCallbackEXT) vkelGetProcAddr("vkCreateDebugReportCallbackEXT");
-	__vkCreateDescriptorPool = (PFN_vkCreateDescriptorPool) vkelGetProcAddr("vkCreateDescriptorPool");
-	__vkCreateDescriptorSetLayout = (PFN_vkCreateDescriptorSetLayout) vkelGetProcAddr("vkCreateDescriptorSetLayout");
-	__vkCreateDevice = (PFN_vkCreateDevice) vkelGetProcAddr("vkCreateDevice");
-	__vkCreateDisplayModeKHR = (PFN_vkCreateDisplayModeKHR) vkelGetProcAddr("vkCreateDisplayModeKHR");
-	__vkCreateDisplayPlaneSurfaceKHR = (PFN_vkCreateDisplayPlaneSurfaceKHR) vkelGetProcAddr("vkCreateDisplayPlaneSurfaceKHR");
-	__vkCreateEvent = (PFN_vkCreateEvent) vkelGetProcAddr("vkCreateEvent");
-	__vkCreateFence = (PFN_vkCreateFence) vkelGetProcAddr("vkCreateFence");
-	__vkCreateFramebuffer = (PFN_vkCreateFramebuffer) vkelGetProcAddr("vkCreateFramebuffer");
-	__vkCreateGraphicsPipelines = (PFN_vkCreateGraphicsPipelines) vkelGetProcAddr("vkCreateGraphicsPipelines");
-	__vkCreateImage = (PFN_vkCreateImage) vkelGetProcAddr("vkCreateImage");
-	__vkCreateImageView = (PFN_vkCreateImageView) vkelGetProcAddr("vkCreateImageView");
-	__vkCreateInstance = (PFN_vkCreateInstance) vkelGetProcAddr("vkCreateInstance");
-	__vkCreatePipelineCache = (PFN_vkCreatePipelineCache) vkelGetProcAddr("vkCreatePipelineCache");
-	__vkCreatePipelineLayout = (PFN_vkCreatePipelineLayout) vkelGetProcAddr("vkCreatePipelineLayout");
-	__vkCreateQueryPool = (PFN_vkCreateQueryPool) vkelGetProcAddr("vkCreateQueryPool");
-	__vkCreateRenderPass = (PFN_vkCreateRenderPass) vkelGetProcAddr("vkCreateRenderPass");
-	__vkCreateSampler = (PFN_vkCreateSampler) vkelGetProcAddr("vkCreateSampler");
-	__vkCreateSemaphore = (PFN_vkCreateSemaphore) vkelGetProcAddr("vkCreateSemaphore");
-	__vkCreateShaderModule = (PFN_vkCreateShaderModule) vkelGetProcAddr("vkCreateShaderModule");
-	__vkCreateSharedSwapchainsKHR = (PFN_vkCreateSharedSwapchainsKHR) vkelGetProcAddr("vkCreateSharedSwapchainsKHR");
-	__vkCreateSwapchainKHR = (PFN_vkCreateSwapchainKHR) vkelGetProcAddr("vkCreateSwapchainKHR");
-	__vkDebugMarkerSetObjectNameEXT = (PFN_vkDebugMarkerSetObjectNameEXT) vkelGetProcAddr("vkDebugMarkerSetObjectNameEXT");
-	__vkDebugMarkerSetObjectTagEXT = (PFN_vkDebugMarkerSetObjectTagEXT) vkelGetProcAddr("vkDebugMarkerSetObjectTagEXT");
-	__vkDebugReportCallbackEXT = (PFN_vkDebugReportCallbackEXT) vkelGetProcAddr("vkDebugReportCallbackEXT");
-	__vkDebugReportMessageEXT = (PFN_vkDebugReportMessageEXT) vkelGetProcAddr("vkDebugReportMessageEXT");
-	__vkDestroyBuffer = (PFN_vkDestroyBuffer) vkelGetProcAddr("vkDestroyBuffer");
-	__vkDestroyBufferView = (PFN_vkDestroyBufferView) vkelGetProcAddr("vkDestroyBufferView");
-	__vkDestroyCommandPool = (PFN_vkDestroyCommandPool) vkelGetProcAddr("vkDestroyCommandPool");
-	__vkDestroyDebugReportCallbackEXT = (PFN_vkDestroyDebugReportCallbackEXT) vkelGetProcAddr("vkDestroyDebugReportCallbackEXT");
-	__vkDestroyDescriptorPool = (PFN_vkDestroyDescriptorPool) vkelGetProcAddr("vkDestroyDescriptorPool");
-	__vkDestroyDescriptorSetLayout = (PFN_vkDestroyDescriptorSetLayout) vkelGetProcAddr("vkDestroyDescriptorSetLayout");
-	__vkDestroyDevice = (PFN_vkDestroyDevice) vkelGetProcAddr("vkDestroyDevice");
-	__vkDestroyEvent = (PFN_vkDestroyEvent) vkelGetProcAddr("vkDestroyEvent");
-	__vkDestroyFence = (PFN_vkDestroyFence) vkelGetProcAddr("vkDestroyFence");
-	__vkDestroyFramebuffer = (PFN_vkDestroyFramebuffer) vkelGetProcAddr("vkDestroyFramebuffer");
-	__vkDestroyImage = (PFN_vkDestroyImage) vkelGetProcAddr("vkDestroyImage");
-	__vkDestroyImageView = (PFN_vkDestroyImageView) vkelGetProcAddr("vkDestroyImageView");
-	__vkDestroyInstance = (PFN_vkDestroyInstance) vkelGetProcAddr("vkDestroyInstance");
-	__vkDestroyPipeline = (PFN_vkDestroyPipeline) vkelGetProcAddr("vkDestroyPipeline");
-	__vkDestroyPipelineCache = (PFN_vkDestroyPipelineCache) vkelGetProcAddr("vkDestroyPipelineCache");
-	__vkDestroyPipelineLayout = (PFN_vkDestroyPipelineLayout) vkelGetProcAddr("vkDestroyPipelineLayout");
-	__vkDestroyQueryPool = (PFN_vkDestroyQueryPool) vkelGetProcAddr("vkDestroyQueryPool");
-	__vkDestroyRenderPass = (PFN_vkDestroyRenderPass) vkelGetProcAddr("vkDestroyRenderPass");
-	__vkDestroySampler = (PFN_vkDestroySampler) vkelGetProcAddr("vkDestroySampler");
-	__vkDestroySemaphore = (PFN_vkDestroySemaphore) vkelGetProcAddr("vkDestroySemaphore");
-	__vkDestroyShaderModule = (PFN_vkDestroyShaderModule) vkelGetProcAddr("vkDestroyShaderModule");
-	__vkDestroySurfaceKHR = (PFN_vkDestroySurfaceKHR) vkelGetProcAddr("vkDestroySurfaceKHR");
-	__vkDestroySwapchainKHR = (PFN_vkDestroySwapchainKHR) vkelGetProcAddr("vkDestroySwapchainKHR");
-	__vkDeviceWaitIdle = (PFN_vkDeviceWaitIdle) vkelGetProcAddr("vkDeviceWaitIdle");
-	__vkEndCommandBuffer = (PFN_vkEndCommandBuffer) vkelGetProcAddr("vkEndCommandBuffer");
-	__vkEnumerateDeviceExtensionProperties = (PFN_vkEnumerateDeviceExtensionProperties) vkelGetProcAddr("vkEnumerateDeviceExtensionProperties");
-	__vkEnumerateDeviceLayerProperties = (PFN_vkEnumerateDeviceLayerProperties) vkelGetProcAddr("vkEnumerateDeviceLayerProperties");
-	__vkEnumerateInstanceExtensionProperties = (PFN_vkEnumerateInstanceExtensionProperties) vkelGetProcAddr("vkEnumerateInstanceExtensionProperties");
-	__vkEnumerateInstanceLayerProperties = (PFN_vkEnumerateInstanceLayerProperties) vkelGetProcAddr("vkEnumerateInstanceLayerProperties");
-	__vkEnumeratePhysicalDevices = (PFN_vkEnumeratePhysicalDevices) vkelGetProcAddr("vkEnumeratePhysicalDevices");
-	__vkFlushMappedMemoryRanges = (PFN_vkFlushMappedMemoryRanges) vkelGetProcAddr("vkFlushMappedMemoryRanges");
-	__vkFreeCommandBuffers = (PFN_vkFreeCommandBuffers) vkelGetProcAddr("vkFreeCommandBuffers");
-	__vkFreeDescriptorSets = (PFN_vkFreeDescriptorSets) vkelGetProcAddr("vkFreeDescriptorSets");
-	__vkFreeFunction = (PFN_vkFreeFunction) vkelGetProcAddr("vkFreeFunction");
-	__vkFreeMemory = (PFN_vkFreeMemory) vkelGetProcAddr("vkFreeMemory");
-	__vkGetBufferMemoryRequirements = (PFN_vkGetBufferMemoryRequirements) vkelGetProcAddr("vkGetBufferMemoryRequirements");
-	__vkGetDeviceMemoryCommitment = (PFN_vkGetDeviceMemoryCommitment) vkelGetProcAddr("vkGetDeviceMemoryCommitment");
-	__vkGetDeviceProcAddr = (PFN_vkGetDeviceProcAddr) vkelGetProcAddr("vkGetDeviceProcAddr");
-	__vkGetDeviceQueue = (PFN_vkGetDeviceQueue) vkelGetProcAddr("vkGetDeviceQueue");
-	__vkGetDisplayModePropertiesKHR = (PFN_vkGetDisplayModePropertiesKHR) vkelGetProcAddr("vkGetDisplayModePropertiesKHR");
-	__vkGetDisplayPlaneCapabilitiesKHR = (PFN_vkGetDisplayPlaneCapabilitiesKHR) vkelGetProcAddr("vkGetDisplayPlaneCapabilitiesKHR");
-	__vkGetDisplayPlaneSupportedDisplaysKHR = (PFN_vkGetDisplayPlaneSupportedDisplaysKHR) vkelGetProcAddr("vkGetDisplayPlaneSupportedDisplaysKHR");
-	__vkGetEventStatus = (PFN_vkGetEventStatus) vkelGetProcAddr("vkGetEventStatus");
-	__vkGetFenceStatus = (PFN_vkGetFenceStatus) vkelGetProcAddr("vkGetFenceStatus");
-	__vkGetImageMemoryRequirements = (PFN_vkGetImageMemoryRequirements) vkelGetProcAddr("vkGetImageMemoryRequirements");
-	__vkGetImageSparseMemoryRequirements = (PFN_vkGetImageSparseMemoryRequirements) vkelGetProcAddr("vkGetImageSparseMemoryRequirements");
-	__vkGetImageSubresourceLayout = (PFN_vkGetImageSubresourceLayout) vkelGetProcAddr("vkGetImageSubresourceLayout");
-	__vkGetInstanceProcAddr = (PFN_vkGetInstanceProcAddr) vkelGetProcAddr("vkGetInstanceProcAddr");
-	__vkGetPhysicalDeviceDisplayPlanePropertiesKHR = (PFN_vkGetPhysicalDeviceDisplayPlanePropertiesKHR) vkelGetProcAddr("vkGetPhysicalDeviceDisplayPlanePropertiesKHR");
-	__vkGetPhysicalDeviceDisplayPropertiesKHR = (PFN_vkGetPhysicalDeviceDisplayPropertiesKHR) vkelGetProcAddr("vkGetPhysicalDeviceDisplayPropertiesKHR");
-	__vkGetPhysicalDeviceFeatures = (PFN_vkGetPhysicalDeviceFeatures) vkelGetProcAddr("vkGetPhysicalDeviceFeatures");
-	__vkGetPhysicalDeviceFormatProperties = (PFN_vkGetPhysicalDeviceFormatProperties) vkelGetProcAddr("vkGetPhysicalDeviceFormatProperties");
-	__vkGetPhysicalDeviceImageFormatProperties = (PFN_vkGetPhysicalDeviceImageFormatProperties) vkelGetProcAddr("vkGetPhysicalDeviceImageFormatProperties");
-	__vkGetPhysicalDeviceMemoryProperties = (PFN_vkGetPhysicalDeviceMemoryProperties) vkelGetProcAddr("vkGetPhysicalDeviceMemoryProperties");
-	__vkGetPhysicalDeviceProperties = (PFN_vkGetPhysicalDeviceProperties) vkelGetProcAddr("vkGetPhysicalDeviceProperties");
-	__vkGetPhysicalDeviceQueueFamilyProperties = (PFN_vkGetPhysicalDeviceQueueFamilyProperties) vkelGetProcAddr("vkGetPhysicalDeviceQueueFamilyProperties");
-	__vkGetPhysicalDeviceSparseImageFormatProperties = (PFN_vkGetPhysicalDeviceSparseImageFormatProperties) vkelGetProcAddr("vkGetPhysicalDeviceSparseImageFormatProperties");
-	__vkGetPhysicalDeviceSurfaceCapabilitiesKHR = (PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR) vkelGetProcAddr("vkGetPhysicalDeviceSurfaceCapabilitiesKHR");
-	__vkGetPhysicalDeviceSurfaceFormatsKHR = (PFN_vkGetPhysicalDeviceSurfaceFormatsKHR) vkelGetProcAddr("vkGetPhysicalDeviceSurfaceFormatsKHR");
-	__vkGetPhysicalDeviceSurfacePresentModesKHR = (PFN_vkGetPhysicalDeviceSurfacePresentModesKHR) vkelGetProcAddr("vkGetPhysicalDeviceSurfacePresentModesKHR");
-	__vkGetPhysicalDeviceSurfaceSupportKHR = (PFN_vkGetPhysicalDeviceSurfaceSupportKHR) vkelGetProcAddr("vkGetPhysicalDeviceSurfaceSupportKHR");
-	__vkGetPipelineCacheData = (PFN_vkGetPipelineCacheData) vkelGetProcAddr("vkGetPipelineCacheData");
-	__vkGetQueryPoolResults = (PFN_vkGetQueryPoolResults) vkelGetProcAddr("vkGetQueryPoolResults");
-	__vkGetRenderAreaGranularity = (PFN_vkGetRenderAreaGranularity) vkelGetProcAddr("vkGetRenderAreaGranularity");
-	__vkGetSwapchainImagesKHR = (PFN_vkGetSwapchainImagesKHR) vkelGetProcAddr("vkGetSwapchainImagesKHR");
-	__vkInternalAllocationNotification = (PFN_vkInternalAllocationNotification) vkelGetProcAddr("vkInternalAllocationNotification");
-	__vkInternalFreeNotification = (PFN_vkInternalFreeNotification) vkelGetProcAddr("vkInternalFreeNotification");
-	__vkInvalidateMappedMemoryRanges = (PFN_vkInvalidateMappedMemoryRanges) vkelGetProcAddr("vkInvalidateMappedMemoryRanges");
-	__vkMapMemory = (PFN_vkMapMemory) vkelGetProcAddr("vkMapMemory");
-	__vkMergePipelineCaches = (PFN_vkMergePipelineCaches) vkelGetProcAddr("vkMergePipelineCaches");
-	__vkQueueBindSparse = (PFN_vkQueueBindSparse) vkelGetProcAddr("vkQueueBindSparse");
-	__vkQueuePresentKHR = (PFN_vkQueuePresentKHR) vkelGetProcAddr("vkQueuePresentKHR");
-	__vkQueueSubmit = (PFN_vkQueueSubmit) vkelGetProcAddr("vkQueueSubmit");
-	__vkQueueWaitIdle = (PFN_vkQueueWaitIdle) vkelGetProcAddr("vkQueueWaitIdle");
-	__vkReallocationFunction = (PFN_vkReallocationFunction) vkelGetProcAddr("vkReallocationFunction");
-	__vkResetCommandBuffer = (PFN_vkResetCommandBuffer) vkelGetProcAddr("vkResetCommandBuffer");
-	__vkResetCommandPool = (PFN_vkResetCommandPool) vkelGetProcAddr("vkResetCommandPool");
-	__vkResetDescriptorPool = (PFN_vkResetDescriptorPool) vkelGetProcAddr("vkResetDescriptorPool");
-	__vkResetEvent = (PFN_vkResetEvent) vkelGetProcAddr("vkResetEvent");
-	__vkResetFences = (PFN_vkResetFences) vkelGetProcAddr("vkResetFences");
-	__vkSetEvent = (PFN_vkSetEvent) vkelGetProcAddr("vkSetEvent");
-	__vkUnmapMemory = (PFN_vkUnmapMemory) vkelGetProcAddr("vkUnmapMemory");
-	__vkUpdateDescriptorSets = (PFN_vkUpdateDescriptorSets) vkelGetProcAddr("vkUpdateDescriptorSets");
-	__vkVoidFunction = (PFN_vkVoidFunction) vkelGetProcAddr("vkVoidFunction");
-	__vkWaitForFences = (PFN_vkWaitForFences) vkelGetProcAddr("vkWaitForFences");
+	pTable->AcquireNextImageKHR = (PFN_vkAcquireNextImageKHR) context->getInstanceProcAddr(context->instance, "vkAcquireNextImageKHR");
+	pTable->AllocateCommandBuffers = (PFN_vkAllocateCommandBuffers) context->getInstanceProcAddr(context->instance, "vkAllocateCommandBuffers");
+	pTable->AllocateDescriptorSets = (PFN_vkAllocateDescriptorSets) context->getInstanceProcAddr(context->instance, "vkAllocateDescriptorSets");
+	pTable->AllocateMemory = (PFN_vkAllocateMemory) context->getInstanceProcAddr(context->instance, "vkAllocateMemory");
+	pTable->BeginCommandBuffer = (PFN_vkBeginCommandBuffer) context->getInstanceProcAddr(context->instance, "vkBeginCommandBuffer");
+	pTable->BindBufferMemory = (PFN_vkBindBufferMemory) context->getInstanceProcAddr(context->instance, "vkBindBufferMemory");
+	pTable->BindImageMemory = (PFN_vkBindImageMemory) context->getInstanceProcAddr(context->instance, "vkBindImageMemory");
+	pTable->CmdBeginQuery = (PFN_vkCmdBeginQuery) context->getInstanceProcAddr(context->instance, "vkCmdBeginQuery");
+	pTable->CmdBeginRenderPass = (PFN_vkCmdBeginRenderPass) context->getInstanceProcAddr(context->instance, "vkCmdBeginRenderPass");
+	pTable->CmdBindDescriptorSets = (PFN_vkCmdBindDescriptorSets) context->getInstanceProcAddr(context->instance, "vkCmdBindDescriptorSets");
+	pTable->CmdBindIndexBuffer = (PFN_vkCmdBindIndexBuffer) context->getInstanceProcAddr(context->instance, "vkCmdBindIndexBuffer");
+	pTable->CmdBindPipeline = (PFN_vkCmdBindPipeline) context->getInstanceProcAddr(context->instance, "vkCmdBindPipeline");
+	pTable->CmdBindVertexBuffers = (PFN_vkCmdBindVertexBuffers) context->getInstanceProcAddr(context->instance, "vkCmdBindVertexBuffers");
+	pTable->CmdBlitImage = (PFN_vkCmdBlitImage) context->getInstanceProcAddr(context->instance, "vkCmdBlitImage");
+	pTable->CmdClearAttachments = (PFN_vkCmdClearAttachments) context->getInstanceProcAddr(context->instance, "vkCmdClearAttachments");
+	pTable->CmdClearColorImage = (PFN_vkCmdClearColorImage) context->getInstanceProcAddr(context->instance, "vkCmdClearColorImage");
+	pTable->CmdClearDepthStencilImage = (PFN_vkCmdClearDepthStencilImage) context->getInstanceProcAddr(context->instance, "vkCmdClearDepthStencilImage");
+	pTable->CmdCopyBuffer = (PFN_vkCmdCopyBuffer) context->getInstanceProcAddr(context->instance, "vkCmdCopyBuffer");
+	pTable->CmdCopyBufferToImage = (PFN_vkCmdCopyBufferToImage) context->getInstanceProcAddr(context->instance, "vkCmdCopyBufferToImage");
+	pTable->CmdCopyImage = (PFN_vkCmdCopyImage) context->getInstanceProcAddr(context->instance, "vkCmdCopyImage");
+	pTable->CmdCopyImageToBuffer = (PFN_vkCmdCopyImageToBuffer) context->getInstanceProcAddr(context->instance, "vkCmdCopyImageToBuffer");
+	pTable->CmdCopyQueryPoolResults = (PFN_vkCmdCopyQueryPoolResults) context->getInstanceProcAddr(context->instance, "vkCmdCopyQueryPoolResults");
+	pTable->CmdDebugMarkerBeginEXT = (PFN_vkCmdDebugMarkerBeginEXT) context->getInstanceProcAddr(context->instance, "vkCmdDebugMarkerBeginEXT");
+	pTable->CmdDebugMarkerEndEXT = (PFN_vkCmdDebugMarkerEndEXT) context->getInstanceProcAddr(context->instance, "vkCmdDebugMarkerEndEXT");
+	pTable->CmdDebugMarkerInsertEXT = (PFN_vkCmdDebugMarkerInsertEXT) context->getInstanceProcAddr(context->instance, "vkCmdDebugMarkerInsertEXT");
+	pTable->CmdDispatch = (PFN_vkCmdDispatch) context->getInstanceProcAddr(context->instance, "vkCmdDispatch");
+	pTable->CmdDispatchIndirect = (PFN_vkCmdDispatchIndirect) context->getInstanceProcAddr(context->instance, "vkCmdDispatchIndirect");
+	pTable->CmdDraw = (PFN_vkCmdDraw) context->getInstanceProcAddr(context->instance, "vkCmdDraw");
+	pTable->CmdDrawIndexed = (PFN_vkCmdDrawIndexed) context->getInstanceProcAddr(context->instance, "vkCmdDrawIndexed");
+	pTable->CmdDrawIndexedIndirect = (PFN_vkCmdDrawIndexedIndirect) context->getInstanceProcAddr(context->instance, "vkCmdDrawIndexedIndirect");
+	pTable->CmdDrawIndirect = (PFN_vkCmdDrawIndirect) context->getInstanceProcAddr(context->instance, "vkCmdDrawIndirect");
+	pTable->CmdEndQuery = (PFN_vkCmdEndQuery) context->getInstanceProcAddr(context->instance, "vkCmdEndQuery");
+	pTable->CmdEndRenderPass = (PFN_vkCmdEndRenderPass) context->getInstanceProcAddr(context->instance, "vkCmdEndRenderPass");
+	pTable->CmdExecuteCommands = (PFN_vkCmdExecuteCommands) context->getInstanceProcAddr(context->instance, "vkCmdExecuteCommands");
+	pTable->CmdFillBuffer = (PFN_vkCmdFillBuffer) context->getInstanceProcAddr(context->instance, "vkCmdFillBuffer");
+	pTable->CmdNextSubpass = (PFN_vkCmdNextSubpass) context->getInstanceProcAddr(context->instance, "vkCmdNextSubpass");
+	pTable->CmdPipelineBarrier = (PFN_vkCmdPipelineBarrier) context->getInstanceProcAddr(context->instance, "vkCmdPipelineBarrier");
+	pTable->CmdPushConstants = (PFN_vkCmdPushConstants) context->getInstanceProcAddr(context->instance, "vkCmdPushConstants");
+	pTable->CmdResetEvent = (PFN_vkCmdResetEvent) context->getInstanceProcAddr(context->instance, "vkCmdResetEvent");
+	pTable->CmdResetQueryPool = (PFN_vkCmdResetQueryPool) context->getInstanceProcAddr(context->instance, "vkCmdResetQueryPool");
+	pTable->CmdResolveImage = (PFN_vkCmdResolveImage) context->getInstanceProcAddr(context->instance, "vkCmdResolveImage");
+	pTable->CmdSetBlendConstants = (PFN_vkCmdSetBlendConstants) context->getInstanceProcAddr(context->instance, "vkCmdSetBlendConstants");
+	pTable->CmdSetDepthBias = (PFN_vkCmdSetDepthBias) context->getInstanceProcAddr(context->instance, "vkCmdSetDepthBias");
+	pTable->CmdSetDepthBounds = (PFN_vkCmdSetDepthBounds) context->getInstanceProcAddr(context->instance, "vkCmdSetDepthBounds");
+	pTable->CmdSetEvent = (PFN_vkCmdSetEvent) context->getInstanceProcAddr(context->instance, "vkCmdSetEvent");
+	pTable->CmdSetLineWidth = (PFN_vkCmdSetLineWidth) context->getInstanceProcAddr(context->instance, "vkCmdSetLineWidth");
+	pTable->CmdSetScissor = (PFN_vkCmdSetScissor) context->getInstanceProcAddr(context->instance, "vkCmdSetScissor");
+	pTable->CmdSetStencilCompareMask = (PFN_vkCmdSetStencilCompareMask) context->getInstanceProcAddr(context->instance, "vkCmdSetStencilCompareMask");
+	pTable->CmdSetStencilReference = (PFN_vkCmdSetStencilReference) context->getInstanceProcAddr(context->instance, "vkCmdSetStencilReference");
+	pTable->CmdSetStencilWriteMask = (PFN_vkCmdSetStencilWriteMask) context->getInstanceProcAddr(context->instance, "vkCmdSetStencilWriteMask");
+	pTable->CmdSetViewport = (PFN_vkCmdSetViewport) context->getInstanceProcAddr(context->instance, "vkCmdSetViewport");
+	pTable->CmdUpdateBuffer = (PFN_vkCmdUpdateBuffer) context->getInstanceProcAddr(context->instance, "vkCmdUpdateBuffer");
+	pTable->CmdWaitEvents = (PFN_vkCmdWaitEvents) context->getInstanceProcAddr(context->instance, "vkCmdWaitEvents");
+	pTable->CmdWriteTimestamp = (PFN_vkCmdWriteTimestamp) context->getInstanceProcAddr(context->instance, "vkCmdWriteTimestamp");
+	pTable->CreateBuffer = (PFN_vkCreateBuffer) context->getInstanceProcAddr(context->instance, "vkCreateBuffer");
+	pTable->CreateBufferView = (PFN_vkCreateBufferView) context->getInstanceProcAddr(context->instance, "vkCreateBufferView");
+	pTable->CreateCommandPool = (PFN_vkCreateCommandPool) context->getInstanceProcAddr(context->instance, "vkCreateCommandPool");
+	pTable->CreateComputePipelines = (PFN_vkCreateComputePipelines) context->getInstanceProcAddr(context->instance, "vkCreateComputePipelines");
+	pTable->CreateDebugReportCallbackEXT = (PFN_vkCreateDebugReportCallbackEXT) context->getInstanceProcAddr(context->instance, "vkCreateDebugReportCallbackEXT");
+	pTable->CreateDescriptorPool = (PFN_vkCreateDescriptorPool) context->getInstanceProcAddr(context->instance, "vkCreateDescriptorPool");
+	pTable->CreateDescriptorSetLayout = (PFN_vkCreateDescriptorSetLayout) context->getInstanceProcAddr(context->instance, "vkCreateDescriptorSetLayout");
+	pTable->CreateDevice = (PFN_vkCreateDevice) context->getInstanceProcAddr(context->instance, "vkCreateDevice");
+	pTable->CreateDisplayModeKHR = (PFN_vkCreateDisplayModeKHR) context->getInstanceProcAddr(context->instance, "vkCreateDisplayModeKHR");
+	pTable->CreateDisplayPlaneSurfaceKHR = (PFN_vkCreateDisplayPlaneSurfaceKHR) context->getInstanceProcAddr(context->instance, "vkCreateDisplayPlaneSurfaceKHR");
+	pTable->CreateEvent = (PFN_vkCreateEvent) context->getInstanceProcAddr(context->instance, "vkCreateEvent");
+	pTable->CreateFence = (PFN_vkCreateFence) context->getInstanceProcAddr(context->instance, "vkCreateFence");
+	pTable->CreateFramebuffer = (PFN_vkCreateFramebuffer) context->getInstanceProcAddr(context->instance, "vkCreateFramebuffer");
+	pTable->CreateGraphicsPipelines = (PFN_vkCreateGraphicsPipelines) context->getInstanceProcAddr(context->instance, "vkCreateGraphicsPipelines");
+	pTable->CreateImage = (PFN_vkCreateImage) context->getInstanceProcAddr(context->instance, "vkCreateImage");
+	pTable->CreateImageView = (PFN_vkCreateImageView) context->getInstanceProcAddr(context->instance, "vkCreateImageView");
+	pTable->CreateInstance = (PFN_vkCreateInstance) context->getInstanceProcAddr(context->instance, "vkCreateInstance");
+	pTable->CreatePipelineCache = (PFN_vkCreatePipelineCache) context->getInstanceProcAddr(context->instance, "vkCreatePipelineCache");
+	pTable->CreatePipelineLayout = (PFN_vkCreatePipelineLayout) context->getInstanceProcAddr(context->instance, "vkCreatePipelineLayout");
+	pTable->CreateQueryPool = (PFN_vkCreateQueryPool) context->getInstanceProcAddr(context->instance, "vkCreateQueryPool");
+	pTable->CreateRenderPass = (PFN_vkCreateRenderPass) context->getInstanceProcAddr(context->instance, "vkCreateRenderPass");
+	pTable->CreateSampler = (PFN_vkCreateSampler) context->getInstanceProcAddr(context->instance, "vkCreateSampler");
+	pTable->CreateSemaphore = (PFN_vkCreateSemaphore) context->getInstanceProcAddr(context->instance, "vkCreateSemaphore");
+	pTable->CreateShaderModule = (PFN_vkCreateShaderModule) context->getInstanceProcAddr(context->instance, "vkCreateShaderModule");
+	pTable->CreateSharedSwapchainsKHR = (PFN_vkCreateSharedSwapchainsKHR) context->getInstanceProcAddr(context->instance, "vkCreateSharedSwapchainsKHR");
+	pTable->CreateSwapchainKHR = (PFN_vkCreateSwapchainKHR) context->getInstanceProcAddr(context->instance, "vkCreateSwapchainKHR");
+	pTable->DebugMarkerSetObjectNameEXT = (PFN_vkDebugMarkerSetObjectNameEXT) context->getInstanceProcAddr(context->instance, "vkDebugMarkerSetObjectNameEXT");
+	pTable->DebugMarkerSetObjectTagEXT = (PFN_vkDebugMarkerSetObjectTagEXT) context->getInstanceProcAddr(context->instance, "vkDebugMarkerSetObjectTagEXT");
+	pTable->DebugReportMessageEXT = (PFN_vkDebugReportMessageEXT) context->getInstanceProcAddr(context->instance, "vkDebugReportMessageEXT");
+	pTable->DestroyBuffer = (PFN_vkDestroyBuffer) context->getInstanceProcAddr(context->instance, "vkDestroyBuffer");
+	pTable->DestroyBufferView = (PFN_vkDestroyBufferView) context->getInstanceProcAddr(context->instance, "vkDestroyBufferView");
+	pTable->DestroyCommandPool = (PFN_vkDestroyCommandPool) context->getInstanceProcAddr(context->instance, "vkDestroyCommandPool");
+	pTable->DestroyDebugReportCallbackEXT = (PFN_vkDestroyDebugReportCallbackEXT) context->getInstanceProcAddr(context->instance, "vkDestroyDebugReportCallbackEXT");
+	pTable->DestroyDescriptorPool = (PFN_vkDestroyDescriptorPool) context->getInstanceProcAddr(context->instance, "vkDestroyDescriptorPool");
+	pTable->DestroyDescriptorSetLayout = (PFN_vkDestroyDescriptorSetLayout) context->getInstanceProcAddr(context->instance, "vkDestroyDescriptorSetLayout");
+	pTable->DestroyDevice = (PFN_vkDestroyDevice) context->getInstanceProcAddr(context->instance, "vkDestroyDevice");
+	pTable->DestroyEvent = (PFN_vkDestroyEvent) context->getInstanceProcAddr(context->instance, "vkDestroyEvent");
+	pTable->DestroyFence = (PFN_vkDestroyFence) context->getInstanceProcAddr(context->instance, "vkDestroyFence");
+	pTable->DestroyFramebuffer = (PFN_vkDestroyFramebuffer) context->getInstanceProcAddr(context->instance, "vkDestroyFramebuffer");
+	pTable->DestroyImage = (PFN_vkDestroyImage) context->getInstanceProcAddr(context->instance, "vkDestroyImage");
+	pTable->DestroyImageView = (PFN_vkDestroyImageView) context->getInstanceProcAddr(context->instance, "vkDestroyImageView");
+	pTable->DestroyInstance = (PFN_vkDestroyInstance) context->getInstanceProcAddr(context->instance, "vkDestroyInstance");
+	pTable->DestroyPipeline = (PFN_vkDestroyPipeline) context->getInstanceProcAddr(context->instance, "vkDestroyPipeline");
+	pTable->DestroyPipelineCache = (PFN_vkDestroyPipelineCache) context->getInstanceProcAddr(context->instance, "vkDestroyPipelineCache");
+	pTable->DestroyPipelineLayout = (PFN_vkDestroyPipelineLayout) context->getInstanceProcAddr(context->instance, "vkDestroyPipelineLayout");
+	pTable->DestroyQueryPool = (PFN_vkDestroyQueryPool) context->getInstanceProcAddr(context->instance, "vkDestroyQueryPool");
+	pTable->DestroyRenderPass = (PFN_vkDestroyRenderPass) context->getInstanceProcAddr(context->instance, "vkDestroyRenderPass");
+	pTable->DestroySampler = (PFN_vkDestroySampler) context->getInstanceProcAddr(context->instance, "vkDestroySampler");
+	pTable->DestroySemaphore = (PFN_vkDestroySemaphore) context->getInstanceProcAddr(context->instance, "vkDestroySemaphore");
+	pTable->DestroyShaderModule = (PFN_vkDestroyShaderModule) context->getInstanceProcAddr(context->instance, "vkDestroyShaderModule");
+	pTable->DestroySurfaceKHR = (PFN_vkDestroySurfaceKHR) context->getInstanceProcAddr(context->instance, "vkDestroySurfaceKHR");
+	pTable->DestroySwapchainKHR = (PFN_vkDestroySwapchainKHR) context->getInstanceProcAddr(context->instance, "vkDestroySwapchainKHR");
+	pTable->DeviceWaitIdle = (PFN_vkDeviceWaitIdle) context->getInstanceProcAddr(context->instance, "vkDeviceWaitIdle");
+	pTable->EndCommandBuffer = (PFN_vkEndCommandBuffer) context->getInstanceProcAddr(context->instance, "vkEndCommandBuffer");
+	pTable->EnumerateDeviceExtensionProperties = (PFN_vkEnumerateDeviceExtensionProperties) context->getInstanceProcAddr(context->instance, "vkEnumerateDeviceExtensionProperties");
+	pTable->EnumerateDeviceLayerProperties = (PFN_vkEnumerateDeviceLayerProperties) context->getInstanceProcAddr(context->instance, "vkEnumerateDeviceLayerProperties");
+	pTable->EnumerateInstanceExtensionProperties = (PFN_vkEnumerateInstanceExtensionProperties) context->getInstanceProcAddr(context->instance, "vkEnumerateInstanceExtensionProperties");
+	pTable->EnumerateInstanceLayerProperties = (PFN_vkEnumerateInstanceLayerProperties) context->getInstanceProcAddr(context->instance, "vkEnumerateInstanceLayerProperties");
+	pTable->EnumeratePhysicalDevices = (PFN_vkEnumeratePhysicalDevices) context->getInstanceProcAddr(context->instance, "vkEnumeratePhysicalDevices");
+	pTable->FlushMappedMemoryRanges = (PFN_vkFlushMappedMemoryRanges) context->getInstanceProcAddr(context->instance, "vkFlushMappedMemoryRanges");
+	pTable->FreeCommandBuffers = (PFN_vkFreeCommandBuffers) context->getInstanceProcAddr(context->instance, "vkFreeCommandBuffers");
+	pTable->FreeDescriptorSets = (PFN_vkFreeDescriptorSets) context->getInstanceProcAddr(context->instance, "vkFreeDescriptorSets");
+	pTable->FreeMemory = (PFN_vkFreeMemory) context->getInstanceProcAddr(context->instance, "vkFreeMemory");
+	pTable->GetBufferMemoryRequirements = (PFN_vkGetBufferMemoryRequirements) context->getInstanceProcAddr(context->instance, "vkGetBufferMemoryRequirements");
+	pTable->GetDeviceMemoryCommitment = (PFN_vkGetDeviceMemoryCommitment) context->getInstanceProcAddr(context->instance, "vkGetDeviceMemoryCommitment");
+	pTable->GetDeviceProcAddr = (PFN_vkGetDeviceProcAddr) context->getInstanceProcAddr(context->instance, "vkGetDeviceProcAddr");
+	pTable->GetDeviceQueue = (PFN_vkGetDeviceQueue) context->getInstanceProcAddr(context->instance, "vkGetDeviceQueue");
+	pTable->GetDisplayModePropertiesKHR = (PFN_vkGetDisplayModePropertiesKHR) context->getInstanceProcAddr(context->instance, "vkGetDisplayModePropertiesKHR");
+	pTable->GetDisplayPlaneCapabilitiesKHR = (PFN_vkGetDisplayPlaneCapabilitiesKHR) context->getInstanceProcAddr(context->instance, "vkGetDisplayPlaneCapabilitiesKHR");
+	pTable->GetDisplayPlaneSupportedDisplaysKHR = (PFN_vkGetDisplayPlaneSupportedDisplaysKHR) context->getInstanceProcAddr(context->instance, "vkGetDisplayPlaneSupportedDisplaysKHR");
+	pTable->GetEventStatus = (PFN_vkGetEventStatus) context->getInstanceProcAddr(context->instance, "vkGetEventStatus");
+	pTable->GetFenceStatus = (PFN_vkGetFenceStatus) context->getInstanceProcAddr(context->instance, "vkGetFenceStatus");
+	pTable->GetImageMemoryRequirements = (PFN_vkGetImageMemoryRequirements) context->getInstanceProcAddr(context->instance, "vkGetImageMemoryRequirements");
+	pTable->GetImageSparseMemoryRequirements = (PFN_vkGetImageSparseMemoryRequirements) context->getInstanceProcAddr(context->instance, "vkGetImageSparseMemoryRequirements");
+	pTable->GetImageSubresourceLayout = (PFN_vkGetImageSubresourceLayout) context->getInstanceProcAddr(context->instance, "vkGetImageSubresourceLayout");
+	pTable->GetInstanceProcAddr = (PFN_vkGetInstanceProcAddr) context->getInstanceProcAddr(context->instance, "vkGetInstanceProcAddr");
+	pTable->GetPhysicalDeviceDisplayPlanePropertiesKHR = (PFN_vkGetPhysicalDeviceDisplayPlanePropertiesKHR) context->getInstanceProcAddr(context->instance, "vkGetPhysicalDeviceDisplayPlanePropertiesKHR");
+	pTable->GetPhysicalDeviceDisplayPropertiesKHR = (PFN_vkGetPhysicalDeviceDisplayPropertiesKHR) context->getInstanceProcAddr(context->instance, "vkGetPhysicalDeviceDisplayPropertiesKHR");
+	pTable->GetPhysicalDeviceFeatures = (PFN_vkGetPhysicalDeviceFeatures) context->getInstanceProcAddr(context->instance, "vkGetPhysicalDeviceFeatures");
+	pTable->GetPhysicalDeviceFormatProperties = (PFN_vkGetPhysicalDeviceFormatProperties) context->getInstanceProcAddr(context->instance, "vkGetPhysicalDeviceFormatProperties");
+	pTable->GetPhysicalDeviceImageFormatProperties = (PFN_vkGetPhysicalDeviceImageFormatProperties) context->getInstanceProcAddr(context->instance, "vkGetPhysicalDeviceImageFormatProperties");
+	pTable->GetPhysicalDeviceMemoryProperties = (PFN_vkGetPhysicalDeviceMemoryProperties) context->getInstanceProcAddr(context->instance, "vkGetPhysicalDeviceMemoryProperties");
+	pTable->GetPhysicalDeviceProperties = (PFN_vkGetPhysicalDeviceProperties) context->getInstanceProcAddr(context->instance, "vkGetPhysicalDeviceProperties");
+	pTable->GetPhysicalDeviceQueueFamilyProperties = (PFN_vkGetPhysicalDeviceQueueFamilyProperties) context->getInstanceProcAddr(context->instance, "vkGetPhysicalDeviceQueueFamilyProperties");
+	pTable->GetPhysicalDeviceSparseImageFormatProperties = (PFN_vkGetPhysicalDeviceSparseImageFormatProperties) context->getInstanceProcAddr(context->instance, "vkGetPhysicalDeviceSparseImageFormatProperties");
+	pTable->GetPhysicalDeviceSurfaceCapabilitiesKHR = (PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR) context->getInstanceProcAddr(context->instance, "vkGetPhysicalDeviceSurfaceCapabilitiesKHR");
+	pTable->GetPhysicalDeviceSurfaceFormatsKHR = (PFN_vkGetPhysicalDeviceSurfaceFormatsKHR) context->getInstanceProcAddr(context->instance, "vkGetPhysicalDeviceSurfaceFormatsKHR");
+	pTable->GetPhysicalDeviceSurfacePresentModesKHR = (PFN_vkGetPhysicalDeviceSurfacePresentModesKHR) context->getInstanceProcAddr(context->instance, "vkGetPhysicalDeviceSurfacePresentModesKHR");
+	pTable->GetPhysicalDeviceSurfaceSupportKHR = (PFN_vkGetPhysicalDeviceSurfaceSupportKHR) context->getInstanceProcAddr(context->instance, "vkGetPhysicalDeviceSurfaceSupportKHR");
+	pTable->GetPipelineCacheData = (PFN_vkGetPipelineCacheData) context->getInstanceProcAddr(context->instance, "vkGetPipelineCacheData");
+	pTable->GetQueryPoolResults = (PFN_vkGetQueryPoolResults) context->getInstanceProcAddr(context->instance, "vkGetQueryPoolResults");
+	pTable->GetRenderAreaGranularity = (PFN_vkGetRenderAreaGranularity) context->getInstanceProcAddr(context->instance, "vkGetRenderAreaGranularity");
+	pTable->GetSwapchainImagesKHR = (PFN_vkGetSwapchainImagesKHR) context->getInstanceProcAddr(context->instance, "vkGetSwapchainImagesKHR");
+	pTable->InvalidateMappedMemoryRanges = (PFN_vkInvalidateMappedMemoryRanges) context->getInstanceProcAddr(context->instance, "vkInvalidateMappedMemoryRanges");
+	pTable->MapMemory = (PFN_vkMapMemory) context->getInstanceProcAddr(context->instance, "vkMapMemory");
+	pTable->MergePipelineCaches = (PFN_vkMergePipelineCaches) context->getInstanceProcAddr(context->instance, "vkMergePipelineCaches");
+	pTable->QueueBindSparse = (PFN_vkQueueBindSparse) context->getInstanceProcAddr(context->instance, "vkQueueBindSparse");
+	pTable->QueuePresentKHR = (PFN_vkQueuePresentKHR) context->getInstanceProcAddr(context->instance, "vkQueuePresentKHR");
+	pTable->QueueSubmit = (PFN_vkQueueSubmit) context->getInstanceProcAddr(context->instance, "vkQueueSubmit");
+	pTable->QueueWaitIdle = (PFN_vkQueueWaitIdle) context->getInstanceProcAddr(context->instance, "vkQueueWaitIdle");
+	pTable->ResetCommandBuffer = (PFN_vkResetCommandBuffer) context->getInstanceProcAddr(context->instance, "vkResetCommandBuffer");
+	pTable->ResetCommandPool = (PFN_vkResetCommandPool) context->getInstanceProcAddr(context->instance, "vkResetCommandPool");
+	pTable->ResetDescriptorPool = (PFN_vkResetDescriptorPool) context->getInstanceProcAddr(context->instance, "vkResetDescriptorPool");
+	pTable->ResetEvent = (PFN_vkResetEvent) context->getInstanceProcAddr(context->instance, "vkResetEvent");
+	pTable->ResetFences = (PFN_vkResetFences) context->getInstanceProcAddr(context->instance, "vkResetFences");
+	pTable->SetEvent = (PFN_vkSetEvent) context->getInstanceProcAddr(context->instance, "vkSetEvent");
+	pTable->UnmapMemory = (PFN_vkUnmapMemory) context->getInstanceProcAddr(context->instance, "vkUnmapMemory");
+	pTable->UpdateDescriptorSets = (PFN_vkUpdateDescriptorSets) context->getInstanceProcAddr(context->instance, "vkUpdateDescriptorSets");
+	pTable->WaitForFences = (PFN_vkWaitForFences) context->getInstanceProcAddr(context->instance, "vkWaitForFences");
 
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
-	__vkCreateAndroidSurfaceKHR = (PFN_vkCreateAndroidSurfaceKHR) vkelGetProcAddr("vkCreateAndroidSurfaceKHR");
+	pTable->CreateAndroidSurfaceKHR = (PFN_vkCreateAndroidSurfaceKHR) context->getInstanceProcAddr(context->instance, "vkCreateAndroidSurfaceKHR");
 #endif /* VK_USE_PLATFORM_ANDROID_KHR */
 
 #ifdef VK_USE_PLATFORM_MIR_KHR
-	__vkCreateMirSurfaceKHR = (PFN_vkCreateMirSurfaceKHR) vkelGetProcAddr("vkCreateMirSurfaceKHR");
-	__vkGetPhysicalDeviceMirPresentationSupportKHR = (PFN_vkGetPhysicalDeviceMirPresentationSupportKHR) vkelGetProcAddr("vkGetPhysicalDeviceMirPresentationSupportKHR");
+	pTable->CreateMirSurfaceKHR = (PFN_vkCreateMirSurfaceKHR) context->getInstanceProcAddr(context->instance, "vkCreateMirSurfaceKHR");
+	pTable->GetPhysicalDeviceMirPresentationSupportKHR = (PFN_vkGetPhysicalDeviceMirPresentationSupportKHR) context->getInstanceProcAddr(context->instance, "vkGetPhysicalDeviceMirPresentationSupportKHR");
 #endif /* VK_USE_PLATFORM_MIR_KHR */
 
 #ifdef VK_USE_PLATFORM_WAYLAND_KHR
-	__vkCreateWaylandSurfaceKHR = (PFN_vkCreateWaylandSurfaceKHR) vkelGetProcAddr("vkCreateWaylandSurfaceKHR");
-	__vkGetPhysicalDeviceWaylandPresentationSupportKHR = (PFN_vkGetPhysicalDeviceWaylandPresentationSupportKHR) vkelGetProcAddr("vkGetPhysicalDeviceWaylandPresentationSupportKHR");
+	pTable->CreateWaylandSurfaceKHR = (PFN_vkCreateWaylandSurfaceKHR) context->getInstanceProcAddr(context->instance, "vkCreateWaylandSurfaceKHR");
+	pTable->GetPhysicalDeviceWaylandPresentationSupportKHR = (PFN_vkGetPhysicalDeviceWaylandPresentationSupportKHR) context->getInstanceProcAddr(context->instance, "vkGetPhysicalDeviceWaylandPresentationSupportKHR");
 #endif /* VK_USE_PLATFORM_WAYLAND_KHR */
 
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-	__vkCreateWin32SurfaceKHR = (PFN_vkCreateWin32SurfaceKHR) vkelGetProcAddr("vkCreateWin32SurfaceKHR");
-	__vkGetPhysicalDeviceWin32PresentationSupportKHR = (PFN_vkGetPhysicalDeviceWin32PresentationSupportKHR) vkelGetProcAddr("vkGetPhysicalDeviceWin32PresentationSupportKHR");
+	pTable->CreateWin32SurfaceKHR = (PFN_vkCreateWin32SurfaceKHR) context->getInstanceProcAddr(context->instance, "vkCreateWin32SurfaceKHR");
+	pTable->GetPhysicalDeviceWin32PresentationSupportKHR = (PFN_vkGetPhysicalDeviceWin32PresentationSupportKHR) context->getInstanceProcAddr(context->instance, "vkGetPhysicalDeviceWin32PresentationSupportKHR");
 #endif /* VK_USE_PLATFORM_WIN32_KHR */
 
 #ifdef VK_USE_PLATFORM_XCB_KHR
-	__vkCreateXcbSurfaceKHR = (PFN_vkCreateXcbSurfaceKHR) vkelGetProcAddr("vkCreateXcbSurfaceKHR");
-	__vkGetPhysicalDeviceXcbPresentationSupportKHR = (PFN_vkGetPhysicalDeviceXcbPresentationSupportKHR) vkelGetProcAddr("vkGetPhysicalDeviceXcbPresentationSupportKHR");
+	pTable->CreateXcbSurfaceKHR = (PFN_vkCreateXcbSurfaceKHR) context->getInstanceProcAddr(context->instance, "vkCreateXcbSurfaceKHR");
+	pTable->GetPhysicalDeviceXcbPresentationSupportKHR = (PFN_vkGetPhysicalDeviceXcbPresentationSupportKHR) context->getInstanceProcAddr(context->instance, "vkGetPhysicalDeviceXcbPresentationSupportKHR");
 #endif /* VK_USE_PLATFORM_XCB_KHR */
 
 #ifdef VK_USE_PLATFORM_XLIB_KHR
-	__vkCreateXlibSurfaceKHR = (PFN_vkCreateXlibSurfaceKHR) vkelGetProcAddr("vkCreateXlibSurfaceKHR");
-	__vkGetPhysicalDeviceXlibPresentationSupportKHR = (PFN_vkGetPhysicalDeviceXlibPresentationSupportKHR) vkelGetProcAddr("vkGetPhysicalDeviceXlibPresentationSupportKHR");
+	pTable->CreateXlibSurfaceKHR = (PFN_vkCreateXlibSurfaceKHR) context->getInstanceProcAddr(context->instance, "vkCreateXlibSurfaceKHR");
+	pTable->GetPhysicalDeviceXlibPresentationSupportKHR = (PFN_vkGetPhysicalDeviceXlibPresentationSupportKHR) context->getInstanceProcAddr(context->instance, "vkGetPhysicalDeviceXlibPresentationSupportKHR");
 #endif /* VK_USE_PLATFORM_XLIB_KHR */
 
+	// ICDs don't necessarily hand out their own vkGetInstanceProcAddr
+	pTable->GetInstanceProcAddr = context->getInstanceProcAddr;
+}
 
-	// Instance and device extension names
-	VKEL_AMD_gcn_shader = vkelIsInstanceExtensionSupported(NULL, "VK_AMD_gcn_shader");
-	VKEL_AMD_rasterization_order = vkelIsInstanceExtensionSupported(NULL, "VK_AMD_rasterization_order");
-	VKEL_AMD_shader_explicit_vertex_parameter = vkelIsInstanceExtensionSupported(NULL, "VK_AMD_shader_explicit_vertex_parameter");
-	VKEL_AMD_shader_trinary_minmax = vkelIsInstanceExtensionSupported(NULL, "VK_AMD_shader_trinary_minmax");
-	VKEL_EXT_debug_marker = vkelIsInstanceExtensionSupported(NULL, "VK_EXT_debug_marker");
-	VKEL_EXT_debug_report = vkelIsInstanceExtensionSupported(NULL, "VK_EXT_debug_report");
-	VKEL_IMG_filter_cubic = vkelIsInstanceExtensionSupported(NULL, "VK_IMG_filter_cubic");
-	VKEL_IMG_format_pvrtc = vkelIsInstanceExtensionSupported(NULL, "VK_IMG_format_pvrtc");
-	VKEL_KHR_android_surface = vkelIsInstanceExtensionSupported(NULL, "VK_KHR_android_surface");
-	VKEL_KHR_display = vkelIsInstanceExtensionSupported(NULL, "VK_KHR_display");
-	VKEL_KHR_display_swapchain = vkelIsInstanceExtensionSupported(NULL, "VK_KHR_display_swapchain");
-	VKEL_KHR_mir_surface = vkelIsInstanceExtensionSupported(NULL, "VK_KHR_mir_surface");
-	VKEL_KHR_sampler_mirror_clamp_to_edge = vkelIsInstanceExtensionSupported(NULL, "VK_KHR_sampler_mirror_clamp_to_edge");
-	VKEL_KHR_surface = vkelIsInstanceExtensionSupported(NULL, "VK_KHR_surface");
-	VKEL_KHR_swapchain = vkelIsInstanceExtensionSupported(NULL, "VK_KHR_swapchain");
-	VKEL_KHR_wayland_surface = vkelIsInstanceExtensionSupported(NULL, "VK_KHR_wayland_surface");
-	VKEL_KHR_win32_surface = vkelIsInstanceExtensionSupported(NULL, "VK_KHR_win32_surface");
-	VKEL_KHR_xcb_surface = vkelIsInstanceExtensionSupported(NULL, "VK_KHR_xcb_surface");
-	VKEL_KHR_xlib_surface = vkelIsInstanceExtensionSupported(NULL, "VK_KHR_xlib_surface");
-	VKEL_NV_dedicated_allocation = vkelIsInstanceExtensionSupported(NULL, "VK_NV_dedicated_allocation");
-	VKEL_NV_glsl_shader = vkelIsInstanceExtensionSupported(NULL, "VK_NV_glsl_shader");
-
-	// Instance and device layer names
-	VKEL_LAYER_GOOGLE_unique_objects = vkelIsInstanceLayerSupported("VK_LAYER_GOOGLE_unique_objects");
-	VKEL_LAYER_LUNARG_api_dump = vkelIsInstanceLayerSupported("VK_LAYER_LUNARG_api_dump");
-	VKEL_LAYER_LUNARG_device_limits = vkelIsInstanceLayerSupported("VK_LAYER_LUNARG_device_limits");
-	VKEL_LAYER_LUNARG_draw_state = vkelIsInstanceLayerSupported("VK_LAYER_LUNARG_draw_state");
-	VKEL_LAYER_LUNARG_image = vkelIsInstanceLayerSupported("VK_LAYER_LUNARG_image");
-	VKEL_LAYER_LUNARG_mem_tracker = vkelIsInstanceLayerSupported("VK_LAYER_LUNARG_mem_tracker");
-	VKEL_LAYER_LUNARG_object_tracker = vkelIsInstanceLayerSupported("VK_LAYER_LUNARG_object_tracker");
-	VKEL_LAYER_LUNARG_param_checker = vkelIsInstanceLayerSupported("VK_LAYER_LUNARG_param_checker");
-	VKEL_LAYER_LUNARG_screenshot = vkelIsInstanceLayerSupported("VK_LAYER_LUNARG_screenshot");
-	VKEL_LAYER_LUNARG_swapchain = vkelIsInstanceLayerSupported("VK_LAYER_LUNARG_swapchain");
-	VKEL_LAYER_LUNARG_threading = vkelIsInstanceLayerSupported("VK_LAYER_LUNARG_threading");
-	VKEL_LAYER_LUNARG_vktrace = vkelIsInstanceLayerSupported("VK_LAYER_LUNARG_vktrace");
-
+static void vkelLoadContextDeviceTable(VkelContext context, VkDevice device)
+{
+	VkelTable *pTable = &context->table;
 	
-	return VK_TRUE;
+	pTable->AcquireNextImageKHR = (PFN_vkAcquireNextImageKHR) vkelGetContextDeviceProcAddr(context, device, "vkAcquireNextImageKHR");
+	pTable->AllocateCommandBuffers = (PFN_vkAllocateCommandBuffers) vkelGetContextDeviceProcAddr(context, device, "vkAllocateCommandBuffers");
+	pTable->AllocateDescriptorSets = (PFN_vkAllocateDescriptorSets) vkelGetContextDeviceProcAddr(context, device, "vkAllocateDescriptorSets");
+	pTable->AllocateMemory = (PFN_vkAllocateMemory) vkelGetContextDeviceProcAddr(context, device, "vkAllocateMemory");
+	pTable->BeginCommandBuffer = (PFN_vkBeginCommandBuffer) vkelGetContextDeviceProcAddr(context, device, "vkBeginCommandBuffer");
+	pTable->BindBufferMemory = (PFN_vkBindBufferMemory) vkelGetContextDeviceProcAddr(context, device, "vkBindBufferMemory");
+	pTable->BindImageMemory = (PFN_vkBindImageMemory) vkelGetContextDeviceProcAddr(context, device, "vkBindImageMemory");
+	pTable->CmdBeginQuery = (PFN_vkCmdBeginQuery) vkelGetContextDeviceProcAddr(context, device, "vkCmdBeginQuery");
+	pTable->CmdBeginRenderPass = (PFN_vkCmdBeginRenderPass) vkelGetContextDeviceProcAddr(context, device, "vkCmdBeginRenderPass");
+	pTable->CmdBindDescriptorSets = (PFN_vkCmdBindDescriptorSets) vkelGetContextDeviceProcAddr(context, device, "vkCmdBindDescriptorSets");
+	pTable->CmdBindIndexBuffer = (PFN_vkCmdBindIndexBuffer) vkelGetContextDeviceProcAddr(context, device, "vkCmdBindIndexBuffer");
+	pTable->CmdBindPipeline = (PFN_vkCmdBindPipeline) vkelGetContextDeviceProcAddr(context, device, "vkCmdBindPipeline");
+	pTable->CmdBindVertexBuffers = (PFN_vkCmdBindVertexBuffers) vkelGetContextDeviceProcAddr(context, device, "vkCmdBindVertexBuffers");
+	pTable->CmdBlitImage = (PFN_vkCmdBlitImage) vkelGetContextDeviceProcAddr(context, device, "vkCmdBlitImage");
+	pTable->CmdClearAttachments = (PFN_vkCmdClearAttachments) vkelGetContextDeviceProcAddr(context, device, "vkCmdClearAttachments");
+	pTable->CmdClearColorImage = (PFN_vkCmdClearColorImage) vkelGetContextDeviceProcAddr(context, device, "vkCmdClearColorImage");
+	pTable->CmdClearDepthStencilImage = (PFN_vkCmdClearDepthStencilImage) vkelGetContextDeviceProcAddr(context, device, "vkCmdClearDepthStencilImage");
+	pTable->CmdCopyBuffer = (PFN_vkCmdCopyBuffer) vkelGetContextDeviceProcAddr(context, device, "vkCmdCopyBuffer");
+	pTable->CmdCopyBufferToImage = (PFN_vkCmdCopyBufferToImage) vkelGetContextDeviceProcAddr(context, device, "vkCmdCopyBufferToImage");
+	pTable->CmdCopyImage = (PFN_vkCmdCopyImage) vkelGetContextDeviceProcAddr(context, device, "vkCmdCopyImage");
+	pTable->CmdCopyImageToBuffer = (PFN_vkCmdCopyImageToBuffer) vkelGetContextDeviceProcAddr(context, device, "vkCmdCopyImageToBuffer");
+	pTable->CmdCopyQueryPoolResults = (PFN_vkCmdCopyQueryPoolResults) vkelGetContextDeviceProcAddr(context, device, "vkCmdCopyQueryPoolResults");
+	pTable->CmdDebugMarkerBeginEXT = (PFN_vkCmdDebugMarkerBeginEXT) vkelGetContextDeviceProcAddr(context, device, "vkCmdDebugMarkerBeginEXT");
+	pTable->CmdDebugMarkerEndEXT = (PFN_vkCmdDebugMarkerEndEXT) vkelGetContextDeviceProcAddr(context, device, "vkCmdDebugMarkerEndEXT");
+	pTable->CmdDebugMarkerInsertEXT = (PFN_vkCmdDebugMarkerInsertEXT) vkelGetContextDeviceProcAddr(context, device, "vkCmdDebugMarkerInsertEXT");
+	pTable->CmdDispatch = (PFN_vkCmdDispatch) vkelGetContextDeviceProcAddr(context, device, "vkCmdDispatch");
+	pTable->CmdDispatchIndirect = (PFN_vkCmdDispatchIndirect) vkelGetContextDeviceProcAddr(context, device, "vkCmdDispatchIndirect");
+	pTable->CmdDraw = (PFN_vkCmdDraw) vkelGetContextDeviceProcAddr(context, device, "vkCmdDraw");
+	pTable->CmdDrawIndexed = (PFN_vkCmdDrawIndexed) vkelGetContextDeviceProcAddr(context, device, "vkCmdDrawIndexed");
+	pTable->CmdDrawIndexedIndirect = (PFN_vkCmdDrawIndexedIndirect) vkelGetContextDeviceProcAddr(context, device, "vkCmdDrawIndexedIndirect");
+	pTable->CmdDrawIndirect = (PFN_vkCmdDrawIndirect) vkelGetContextDeviceProcAddr(context, device, "vkCmdDrawIndirect");
+	pTable->CmdEndQuery = (PFN_vkCmdEndQuery) vkelGetContextDeviceProcAddr(context, device, "vkCmdEndQuery");
+	pTable->CmdEndRenderPass = (PFN_vkCmdEndRenderPass) vkelGetContextDeviceProcAddr(context, device, "vkCmdEndRenderPass");
+	pTable->CmdExecuteCommands = (PFN_vkCmdExecuteCommands) vkelGetContextDeviceProcAddr(context, device, "vkCmdExecuteCommands");
+	pTable->CmdFillBuffer = (PFN_vkCmdFillBuffer) vkelGetContextDeviceProcAddr(context, device, "vkCmdFillBuffer");
+	pTable->CmdNextSubpass = (PFN_vkCmdNextSubpass) vkelGetContextDeviceProcAddr(context, device, "vkCmdNextSubpass");
+	pTable->CmdPipelineBarrier = (PFN_vkCmdPipelineBarrier) vkelGetContextDeviceProcAddr(context, device, "vkCmdPipelineBarrier");
+	pTable->CmdPushConstants = (PFN_vkCmdPushConstants) vkelGetContextDeviceProcAddr(context, device, "vkCmdPushConstants");
+	pTable->CmdResetEvent = (PFN_vkCmdResetEvent) vkelGetContextDeviceProcAddr(context, device, "vkCmdResetEvent");
+	pTable->CmdResetQueryPool = (PFN_vkCmdResetQueryPool) vkelGetContextDeviceProcAddr(context, device, "vkCmdResetQueryPool");
+	pTable->CmdResolveImage = (PFN_vkCmdResolveImage) vkelGetContextDeviceProcAddr(context, device, "vkCmdResolveImage");
+	pTable->CmdSetBlendConstants = (PFN_vkCmdSetBlendConstants) vkelGetContextDeviceProcAddr(context, device, "vkCmdSetBlendConstants");
+	pTable->CmdSetDepthBias = (PFN_vkCmdSetDepthBias) vkelGetContextDeviceProcAddr(context, device, "vkCmdSetDepthBias");
+	pTable->CmdSetDepthBounds = (PFN_vkCmdSetDepthBounds) vkelGetContextDeviceProcAddr(context, device, "vkCmdSetDepthBounds");
+	pTable->CmdSetEvent = (PFN_vkCmdSetEvent) vkelGetContextDeviceProcAddr(context, device, "vkCmdSetEvent");
+	pTable->CmdSetLineWidth = (PFN_vkCmdSetLineWidth) vkelGetContextDeviceProcAddr(context, device, "vkCmdSetLineWidth");
+	pTable->CmdSetScissor = (PFN_vkCmdSetScissor) vkelGetContextDeviceProcAddr(context, device, "vkCmdSetScissor");
+	pTable->CmdSetStencilCompareMask = (PFN_vkCmdSetStencilCompareMask) vkelGetContextDeviceProcAddr(context, device, "vkCmdSetStencilCompareMask");
+	pTable->CmdSetStencilReference = (PFN_vkCmdSetStencilReference) vkelGetContextDeviceProcAddr(context, device, "vkCmdSetStencilReference");
+	pTable->CmdSetStencilWriteMask = (PFN_vkCmdSetStencilWriteMask) vkelGetContextDeviceProcAddr(context, device, "vkCmdSetStencilWriteMask");
+	pTable->CmdSetViewport = (PFN_vkCmdSetViewport) vkelGetContextDeviceProcAddr(context, device, "vkCmdSetViewport");
+	pTable->CmdUpdateBuffer = (PFN_vkCmdUpdateBuffer) vkelGetContextDeviceProcAddr(context, device, "vkCmdUpdateBuffer");
+	pTable->CmdWaitEvents = (PFN_vkCmdWaitEvents) vkelGetContextDeviceProcAddr(context, device, "vkCmdWaitEvents");
+	pTable->CmdWriteTimestamp = (PFN_vkCmdWriteTimestamp) vkelGetContextDeviceProcAddr(context, device, "vkCmdWriteTimestamp");
+	pTable->CreateBuffer = (PFN_vkCreateBuffer) vkelGetContextDeviceProcAddr(context, device, "vkCreateBuffer");
+	pTable->CreateBufferView = (PFN_vkCreateBufferView) vkelGetContextDeviceProcAddr(context, device, "vkCreateBufferView");
+	pTable->CreateCommandPool = (PFN_vkCreateCommandPool) vkelGetContextDeviceProcAddr(context, device, "vkCreateCommandPool");
+	pTable->CreateComputePipelines = (PFN_vkCreateComputePipelines) vkelGetContextDeviceProcAddr(context, device, "vkCreateComputePipelines");
+	pTable->CreateDescriptorPool = (PFN_vkCreateDescriptorPool) vkelGetContextDeviceProcAddr(context, device, "vkCreateDescriptorPool");
+	pTable->CreateDescriptorSetLayout = (PFN_vkCreateDescriptorSetLayout) vkelGetContextDeviceProcAddr(context, device, "vkCreateDescriptorSetLayout");
+	pTable->CreateEvent = (PFN_vkCreateEvent) vkelGetContextDeviceProcAddr(context, device, "vkCreateEvent");
+	pTable->CreateFence = (PFN_vkCreateFence) vkelGetContextDeviceProcAddr(context, device, "vkCreateFence");
+	pTable->CreateFramebuffer = (PFN_vkCreateFramebuffer) vkelGetContextDeviceProcAddr(context, device, "vkCreateFramebuffer");
+	pTable->CreateGraphicsPipelines = (PFN_vkCreateGraphicsPipelines) vkelGetContextDeviceProcAddr(context, device, "vkCreateGraphicsPipelines");
+	pTable->CreateImage = (PFN_vkCreateImage) vkelGetContextDeviceProcAddr(context, device, "vkCreateImage");
+	pTable->CreateImageView = (PFN_vkCreateImageView) vkelGetContextDeviceProcAddr(context, device, "vkCreateImageView");
+	pTable->CreatePipelineCache = (PFN_vkCreatePipelineCache) vkelGetContextDeviceProcAddr(context, device, "vkCreatePipelineCache");
+	pTable->CreatePipelineLayout = (PFN_vkCreatePipelineLayout) vkelGetContextDeviceProcAddr(context, device, "vkCreatePipelineLayout");
+	pTable->CreateQueryPool = (PFN_vkCreateQueryPool) vkelGetContextDeviceProcAddr(context, device, "vkCreateQueryPool");
+	pTable->CreateRenderPass = (PFN_vkCreateRenderPass) vkelGetContextDeviceProcAddr(context, device, "vkCreateRenderPass");
+	pTable->CreateSampler = (PFN_vkCreateSampler) vkelGetContextDeviceProcAddr(context, device, "vkCreateSampler");
+	pTable->CreateSemaphore = (PFN_vkCreateSemaphore) vkelGetContextDeviceProcAddr(context, device, "vkCreateSemaphore");
+	pTable->CreateShaderModule = (PFN_vkCreateShaderModule) vkelGetContextDeviceProcAddr(context, device, "vkCreateShaderModule");
+	pTable->CreateSharedSwapchainsKHR = (PFN_vkCreateSharedSwapchainsKHR) vkelGetContextDeviceProcAddr(context, device, "vkCreateSharedSwapchainsKHR");
+	pTable->CreateSwapchainKHR = (PFN_vkCreateSwapchainKHR) vkelGetContextDeviceProcAddr(context, device, "vkCreateSwapchainKHR");
+	pTable->DebugMarkerSetObjectNameEXT = (PFN_vkDebugMarkerSetObjectNameEXT) vkelGetContextDeviceProcAddr(context, device, "vkDebugMarkerSetObjectNameEXT");
+	pTable->DebugMarkerSetObjectTagEXT = (PFN_vkDebugMarkerSetObjectTagEXT) vkelGetContextDeviceProcAddr(context, device, "vkDebugMarkerSetObjectTagEXT");
+	pTable->DestroyBuffer = (PFN_vkDestroyBuffer) vkelGetContextDeviceProcAddr(context, device, "vkDestroyBuffer");
+	pTable->DestroyBufferView = (PFN_vkDestroyBufferView) vkelGetContextDeviceProcAddr(context, device, "vkDestroyBufferView");
+	pTable->DestroyCommandPool = (PFN_vkDestroyCommandPool) vkelGetContextDeviceProcAddr(context, device, "vkDestroyCommandPool");
+	pTable->DestroyDescriptorPool = (PFN_vkDestroyDescriptorPool) vkelGetContextDeviceProcAddr(context, device, "vkDestroyDescriptorPool");
+	pTable->DestroyDescriptorSetLayout = (PFN_vkDestroyDescriptorSetLayout) vkelGetContextDeviceProcAddr(context, device, "vkDestroyDescriptorSetLayout");
+	pTable->DestroyDevice = (PFN_vkDestroyDevice) vkelGetContextDeviceProcAddr(context, device, "vkDestroyDevice");
+	pTable->DestroyEvent = (PFN_vkDestroyEvent) vkelGetContextDeviceProcAddr(context, device, "vkDestroyEvent");
+	pTable->DestroyFence = (PFN_vkDestroyFence) vkelGetContextDeviceProcAddr(context, device, "vkDestroyFence");
+	pTable->DestroyFramebuffer = (PFN_vkDestroyFramebuffer) vkelGetContextDeviceProcAddr(context, device, "vkDestroyFramebuffer");
+	pTable->DestroyImage = (PFN_vkDestroyImage) vkelGetContextDeviceProcAddr(context, device, "vkDestroyImage");
+	pTable->DestroyImageView = (PFN_vkDestroyImageView) vkelGetContextDeviceProcAddr(context, device, "vkDestroyImageView");
+	pTable->DestroyPipeline = (PFN_vkDestroyPipeline) vkelGetContextDeviceProcAddr(context, device, "vkDestroyPipeline");
+	pTable->DestroyPipelineCache = (PFN_vkDestroyPipelineCache) vkelGetContextDeviceProcAddr(context, device, "vkDestroyPipelineCache");
+	pTable->DestroyPipelineLayout = (PFN_vkDestroyPipelineLayout) vkelGetContextDeviceProcAddr(context, device, "vkDestroyPipelineLayout");
+	pTable->DestroyQueryPool = (PFN_vkDestroyQueryPool) vkelGetContextDeviceProcAddr(context, device, "vkDestroyQueryPool");
+	pTable->DestroyRenderPass = (PFN_vkDestroyRenderPass) vkelGetContextDeviceProcAddr(context, device, "vkDestroyRenderPass");
+	pTable->DestroySampler = (PFN_vkDestroySampler) vkelGetContextDeviceProcAddr(context, device, "vkDestroySampler");
+	pTable->DestroySemaphore = (PFN_vkDestroySemaphore) vkelGetContextDeviceProcAddr(context, device, "vkDestroySemaphore");
+	pTable->DestroyShaderModule = (PFN_vkDestroyShaderModule) vkelGetContextDeviceProcAddr(context, device, "vkDestroyShaderModule");
+	pTable->DestroySwapchainKHR = (PFN_vkDestroySwapchainKHR) vkelGetContextDeviceProcAddr(context, device, "vkDestroySwapchainKHR");
+	pTable->DeviceWaitIdle = (PFN_vkDeviceWaitIdle) vkelGetContextDeviceProcAddr(context, device, "vkDeviceWaitIdle");
+	pTable->EndCommandBuffer = (PFN_vkEndCommandBuffer) vkelGetContextDeviceProcAddr(context, device, "vkEndCommandBuffer");
+	pTable->FlushMappedMemoryRanges = (PFN_vkFlushMappedMemoryRanges) vkelGetContextDeviceProcAddr(context, device, "vkFlushMappedMemoryRanges");
+	pTable->FreeCommandBuffers = (PFN_vkFreeCommandBuffers) vkelGetContextDeviceProcAddr(context, device, "vkFreeCommandBuffers");
+	pTable->FreeDescriptorSets = (PFN_vkFreeDescriptorSets) vkelGetContextDeviceProcAddr(context, device, "vkFreeDescriptorSets");
+	pTable->FreeMemory = (PFN_vkFreeMemory) vkelGetContextDeviceProcAddr(context, device, "vkFreeMemory");
+	pTable->GetBufferMemoryRequirements = (PFN_vkGetBufferMemoryRequirements) vkelGetContextDeviceProcAddr(context, device, "vkGetBufferMemoryRequirements");
+	pTable->GetDeviceMemoryCommitment = (PFN_vkGetDeviceMemoryCommitment) vkelGetContextDeviceProcAddr(context, device, "vkGetDeviceMemoryCommitment");
+	pTable->GetDeviceQueue = (PFN_vkGetDeviceQueue) vkelGetContextDeviceProcAddr(context, device, "vkGetDeviceQueue");
+	pTable->GetEventStatus = (PFN_vkGetEventStatus) vkelGetContextDeviceProcAddr(context, device, "vkGetEventStatus");
+	pTable->GetFenceStatus = (PFN_vkGetFenceStatus) vkelGetContextDeviceProcAddr(context, device, "vkGetFenceStatus");
+	pTable->GetImageMemoryRequirements = (PFN_vkGetImageMemoryRequirements) vkelGetContextDeviceProcAddr(context, device, "vkGetImageMemoryRequirements");
+	pTable->GetImageSparseMemoryRequirements = (PFN_vkGetImageSparseMemoryRequirements) vkelGetContextDeviceProcAddr(context, device, "vkGetImageSparseMemoryRequirements");
+	pTable->GetImageSubresourceLayout = (PFN_vkGetImageSubresourceLayout) vkelGetContextDeviceProcAddr(context, device, "vkGetImageSubresourceLayout");
+	pTable->GetPipelineCacheData = (PFN_vkGetPipelineCacheData) vkelGetContextDeviceProcAddr(context, device, "vkGetPipelineCacheData");
+	pTable->GetQueryPoolResults = (PFN_vkGetQueryPoolResults) vkelGetContextDeviceProcAddr(context, device, "vkGetQueryPoolResults");
+	pTable->GetRenderAreaGranularity = (PFN_vkGetRenderAreaGranularity) vkelGetContextDeviceProcAddr(context, device, "vkGetRenderAreaGranularity");
+	pTable->GetSwapchainImagesKHR = (PFN_vkGetSwapchainImagesKHR) vkelGetContextDeviceProcAddr(context, device, "vkGetSwapchainImagesKHR");
+	pTable->InvalidateMappedMemoryRanges = (PFN_vkInvalidateMappedMemoryRanges) vkelGetContextDeviceProcAddr(context, device, "vkInvalidateMappedMemoryRanges");
+	pTable->MapMemory = (PFN_vkMapMemory) vkelGetContextDeviceProcAddr(context, device, "vkMapMemory");
+	pTable->MergePipelineCaches = (PFN_vkMergePipelineCaches) vkelGetContextDeviceProcAddr(context, device, "vkMergePipelineCaches");
+	pTable->QueueBindSparse = (PFN_vkQueueBindSparse) vkelGetContextDeviceProcAddr(context, device, "vkQueueBindSparse");
+	pTable->QueuePresentKHR = (PFN_vkQueuePresentKHR) vkelGetContextDeviceProcAddr(context, device, "vkQueuePresentKHR");
+	pTable->QueueSubmit = (PFN_vkQueueSubmit) vkelGetContextDeviceProcAddr(context, device, "vkQueueSubmit");
+	pTable->QueueWaitIdle = (PFN_vkQueueWaitIdle) vkelGetContextDeviceProcAddr(context, device, "vkQueueWaitIdle");
+	pTable->ResetCommandBuffer = (PFN_vkResetCommandBuffer) vkelGetContextDeviceProcAddr(context, device, "vkResetCommandBuffer");
+	pTable->ResetCommandPool = (PFN_vkResetCommandPool) vkelGetContextDeviceProcAddr(context, device, "vkResetCommandPool");
+	pTable->ResetDescriptorPool = (PFN_vkResetDescriptorPool) vkelGetContextDeviceProcAddr(context, device, "vkResetDescriptorPool");
+	pTable->ResetEvent = (PFN_vkResetEvent) vkelGetContextDeviceProcAddr(context, device, "vkResetEvent");
+	pTable->ResetFences = (PFN_vkResetFences) vkelGetContextDeviceProcAddr(context, device, "vkResetFences");
+	pTable->SetEvent = (PFN_vkSetEvent) vkelGetContextDeviceProcAddr(context, device, "vkSetEvent");
+	pTable->UnmapMemory = (PFN_vkUnmapMemory) vkelGetContextDeviceProcAddr(context, device, "vkUnmapMemory");
+	pTable->UpdateDescriptorSets = (PFN_vkUpdateDescriptorSets) vkelGetContextDeviceProcAddr(context, device, "vkUpdateDescriptorSets");
+	pTable->WaitForFences = (PFN_vkWaitForFences) vkelGetContextDeviceProcAddr(context, device, "vkWaitForFences");
+
 }
-	
-VkBool32 vkelInstanceInit(VkInstance instance)
+
+VkelContext vkelCreateContext(const char *pPath)
 {
-	if (!vkelVkLibHandle && !vkelInit())
-		return VK_FALSE;
+	assert(pPath);
 	
+	VkelContext context = (VkelContext) vkel_calloc(1, sizeof(struct VkelContext_T), VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
 	
-	__vkAcquireNextImageKHR = (PFN_vkAcquireNextImageKHR) vkelGetInstanceProcAddr(instance, "vkAcquireNextImageKHR");
-	__vkAllocateCommandBuffers = (PFN_vkAllocateCommandBuffers) vkelGetInstanceProcAddr(instance, "vkAllocateCommandBuffers");
-	__vkAllocateDescriptorSets = (PFN_vkAllocateDescriptorSets) vkelGetInstanceProcAddr(instance, "vkAllocateDescriptorSets");
-	__vkAllocateMemory = (PFN_vkAllocateMemory) vkelGetInstanceProcAddr(instance, "vkAllocateMemory");
-	__vkAllocationFunction = (PFN_vkAllocationFunction) vkelGetInstanceProcAddr(instance, "vkAllocationFunction");
-	__vkBeginCommandBuffer = (PFN_vkBeginCommandBuffer) vkelGetInstanceProcAddr(instance, "vkBeginCommandBuffer");
-	__vkBindBufferMemory = (PFN_vkBindBufferMemory) vkelGetInstanceProcAddr(instance, "vkBindBufferMemory");
-	__vkBindImageMemory = (PFN_vkBindImageMemory) vkelGetInstanceProcAddr(instance, "vkBindImageMemory");
-	__vkCmdBeginQuery = (PFN_vkCmdBeginQuery) vkelGetInstanceProcAddr(instance, "vkCmdBeginQuery");
-	__vkCmdBeginRenderPass = (PFN_vkCmdBeginRenderPass) vkelGetInstanceProcAddr(instance, "vkCmdBeginRenderPass");
-	__vkCmdBindDescriptorSets = (PFN_vkCmdBindDescriptorSets) vkelGetInstanceProcAddr(instance, "vkCmdBindDescriptorSets");
-	__vkCmdBindIndexBuffer = (PFN_vkCmdBindIndexBuffer) vkelGetInstanceProcAddr(instance, "vkCmdBindIndexBuffer");
-	__vkCmdBindPipeline = (PFN_vkCmdBindPipeline) vkelGetInstanceProcAddr(instance, "vkCmdBindPipeline");
-	__vkCmdBindVertexBuffers = (PFN_vkCmdBindVertexBuffers) vkelGetInstanceProcAddr(instance, "vkCmdBindVertexBuffers");
-	__vkCmdBlitImage = (PFN_vkCmdBlitImage) vkelGetInstanceProcAddr(instance, "vkCmdBlitImage");
-	__vkCmdClearAttachments = (PFN_vkCmdClearAttachments) vkelGetInstanceProcAddr(instance, "vkCmdClearAttachments");
-	__vkCmdClearColorImage = (PFN_vkCmdClearColorImage) vkelGetInstanceProcAddr(instance, "vkCmdClearColorImage");
-	__vkCmdClearDepthStencilImage = (PFN_vkCmdClearDepthStencilImage) vkelGetInstanceProcAddr(instance, "vkCmdClearDepthStencilImage");
-	__vkCmdCopyBuffer = (PFN_vkCmdCopyBuffer) vkelGetInstanceProcAddr(instance, "vkCmdCopyBuffer");
-	__vkCmdCopyBufferToImage = (PFN_vkCmdCopyBufferToImage) vkelGetInstanceProcAddr(instance, "vkCmdCopyBufferToImage");
-	__vkCmdCopyImage = (PFN_vkCmdCopyImage) vkelGetInstanceProcAddr(instance, "vkCmdCopyImage");
-	__vkCmdCopyImageToBuffer = (PFN_vkCmdCopyImageToBuffer) vkelGetInstanceProcAddr(instance, "vkCmdCopyImageToBuffer");
-	__vkCmdCopyQueryPoolResults = (PFN_vkCmdCopyQueryPoolResults) vkelGetInstanceProcAddr(instance, "vkCmdCopyQueryPoolResults");
-	__vkCmdDebugMarkerBeginEXT = (PFN_vkCmdDebugMarkerBeginEXT) vkelGetInstanceProcAddr(instance, "vkCmdDebugMarkerBeginEXT");
-	__vkCmdDebugMarkerEndEXT = (PFN_vkCmdDebugMarkerEndEXT) vkelGetInstanceProcAddr(instance, "vkCmdDebugMarkerEndEXT");
-	__vkCmdDebugMarkerInsertEXT = (PFN_vkCmdDebugMarkerInsertEXT) vkelGetInstanceProcAddr(instance, "vkCmdDebugMarkerInsertEXT");
-	__vkCmdDispatch = (PFN_vkCmdDispatch) vkelGetInstanceProcAddr(instance, "vkCmdDispatch");
-	__vkCmdDispatchIndirect = (PFN_vkCmdDispatchIndirect) vkelGetInstanceProcAddr(instance, "vkCmdDispatchIndirect");
-	__vkCmdDraw = (PFN_vkCmdDraw) vkelGetInstanceProcAddr(instance, "vkCmdDraw");
-	__vkCmdDrawIndexed = (PFN_vkCmdDrawIndexed) vkelGetInstanceProcAddr(instance, "vkCmdDrawIndexed");
-	__vkCmdDrawIndexedIndirect = (PFN_vkCmdDrawIndexedIndirect) vkelGetInstanceProcAddr(instance, "vkCmdDrawIndexedIndirect");
-	__vkCmdDrawIndirect = (PFN_vkCmdDrawIndirect) vkelGetInstanceProcAddr(instance, "vkCmdDrawIndirect");
-	__vkCmdEndQuery = (PFN_vkCmdEndQuery) vkelGetInstanceProcAddr(instance, "vkCmdEndQuery");
-	__vkCmdEndRenderPass = (PFN_vkCmdEndRenderPass) vkelGetInstanceProcAddr(instance, "vkCmdEndRenderPass");
-	__vkCmdExecuteCommands = (PFN_vkCmdExecuteCommands) vkelGetInstanceProcAddr(instance, "vkCmdExecuteCommands");
-	__vkCmdFillBuffer = (PFN_vkCmdFillBuffer) vkelGetInstanceProcAddr(instance, "vkCmdFillBuffer");
-	__vkCmdNextSubpass = (PFN_vkCmdNextSubpass) vkelGetInstanceProcAddr(instance, "vkCmdNextSubpass");
-	__vkCmdPipelineBarrier = (PFN_vkCmdPipelineBarrier) vkelGetInstanceProcAddr(instance, "vkCmdPipelineBarrier");
-	__vkCmdPushConstants = (PFN_vkCmdPushConstants) vkelGetInstanceProcAddr(instance, "vkCmdPushConstants");
-	__vkCmdResetEvent = (PFN_vkCmdResetEvent) vkelGetInstanceProcAddr(instance, "vkCmdResetEvent");
-	__vkCmdResetQueryPool = (PFN_vkCmdResetQueryPool) vkelGetInstanceProcAddr(instance, "vkCmdResetQueryPool");
-	__vkCmdResolveImage = (PFN_vkCmdResolveImage) vkelGetInstanceProcAddr(instance, "vkCmdResolveImage");
-	__vkCmdSetBlendConstants = (PFN_vkCmdSetBlendConstants) vkelGetInstanceProcAddr(instance, "vkCmdSetBlendConstants");
-	__vkCmdSetDepthBias = (PFN_vkCmdSetDepthBias) vkelGetInstanceProcAddr(instance, "vkCmdSetDepthBias");
-	__vkCmdSetDepthBounds = (PFN_vkCmdSetDepthBounds) vkelGetInstanceProcAddr(instance, "vkCmdSetDepthBounds");
-	__vkCmdSetEvent = (PFN_vkCmdSetEvent) vkelGetInstanceProcAddr(instance, "vkCmdSetEvent");
-	__vkCmdSetLineWidth = (PFN_vkCmdSetLineWidth) vkelGetInstanceProcAddr(instance, "vkCmdSetLineWidth");
-	__vkCmdSetScissor = (PFN_vkCmdSetScissor) vkelGetInstanceProcAddr(instance, "vkCmdSetScissor");
-	__vkCmdSetStencilCompareMask = (PFN_vkCmdSetStencilCompareMask) vkelGetInstanceProcAddr(instance, "vkCmdSetStencilCompareMask");
-	__vkCmdSetStencilReference = (PFN_vkCmdSetStencilReference) vkelGetInstanceProcAddr(instance, "vkCmdSetStencilReference");
-	__vkCmdSetStencilWriteMask = (PFN_vkCmdSetStencilWriteMask) vkelGetInstanceProcAddr(instance, "vkCmdSetStencilWriteMask");
-	__vkCmdSetViewport = (PFN_vkCmdSetViewport) vkelGetInstanceProcAddr(instance, "vkCmdSetViewport");
-	__vkCmdUpdateBuffer = (PFN_vkCmdUpdateBuffer) vkelGetInstanceProcAddr(instance, "vkCmdUpdateBuffer");
-	__vkCmdWaitEvents = (PFN_vkCmdWaitEvents) vkelGetInstanceProcAddr(instance, "vkCmdWaitEvents");
-	__vkCmdWriteTimestamp = (PFN_vkCmdWriteTimestamp) vkelGetInstanceProcAddr(instance, "vkCmdWriteTimestamp");
-	__vkCreateBuffer = (PFN_vkCreateBuffer) vkelGetInstanceProcAddr(instance, "vkCreateBuffer");
-	__vkCreateBufferView = (PFN_vkCreateBufferView) vkelGetInstanceProcAddr(instance, "vkCreateBufferView");
-	__vkCreateCommandPool = (PFN_vkCreateCommandPool) vkelGetInstanceProcAddr(instance, "vkCreateCommandPool");
-	__vkCreateComputePipelines = (PFN_vkCreateComputePipelines) vkelGetInstanceProcAddr(instance, "vkCreateComputePipelines");
-	__vkCreateDebugReportCallbackEXT = (PFN_vkCreateDebugReportCallbackEXT) vkelGetInstanceProcAddr(instance, "vkCreateDebugReportCallbackEXT");
-	__vkCreateDescriptorPool = (PFN_vkCreateDescriptorPool) vkelGetInstanceProcAddr(instance, "vkCreateDescriptorPool");
-	__vkCreateDescriptorSetLayout = (PFN_vkCreateDescriptorSetLayout) vkelGetInstanceProcAddr(instance, "vkCreateDescriptorSetLayout");
-	__vkCreateDevice = (PFN_vkCreateDevice) vkelGetInstanceProcAddr(instance, "vkCreateDevice");
-	__vkCreateDisplayModeKHR = (PFN_vkCreateDisplayModeKHR) vkelGetInstanceProcAddr(instance, "vkCreateDisplayModeKHR");
-	__vkCreateDisplayPlaneSurfaceKHR = (PFN_vkCreateDisplayPlaneSurfaceKHR) vkelGetInstanceProcAddr(instance, "vkCreateDisplayPlaneSurfaceKHR");
-	__vkCreateEvent = (PFN_vkCreateEvent) vkelGetInstanceProcAddr(instance, "vkCreateEvent");
-	__vkCreateFence = (PFN_vkCreateFence) vkelGetInstanceProcAddr(instance, "vkCreateFence");
-	__vkCreateFramebuffer = (PFN_vkCreateFramebuffer) vkelGetInstanceProcAddr(instance, "vkCreateFramebuffer");
-	__vkCreateGraphicsPipelines = (PFN_vkCreateGraphicsPipelines) vkelGetInstanceProcAddr(instance, "vkCreateGraphicsPipelines");
-	__vkCreateImage = (PFN_vkCreateImage) vkelGetInstanceProcAddr(instance, "vkCreateImage");
-	__vkCreateImageView = (PFN_vkCreateImageView) vkelGetInstanceProcAddr(instance, "vkCreateImageView");
-	__vkCreateInstance = (PFN_vkCreateInstance) vkelGetInstanceProcAddr(instance, "vkCreateInstance");
-	__vkCreatePipelineCache = (PFN_vkCreatePipelineCache) vkelGetInstanceProcAddr(instance, "vkCreatePipelineCache");
-	__vkCreatePipelineLayout = (PFN_vkCreatePipelineLayout) vkelGetInstanceProcAddr(instance, "vkCreatePipelineLayout");
-	__vkCreateQueryPool = (PFN_vkCreateQueryPool) vkelGetInstanceProcAddr(instance, "vkCreateQueryPool");
-	__vkCreateRenderPass = (PFN_vkCreateRenderPass) vkelGetInstanceProcAddr(instance, "vkCreateRenderPass");
-	__vkCreateSampler = (PFN_vkCreateSampler) vkelGetInstanceProcAddr(instance, "vkCreateSampler");
-	__vkCreateSemaphore = (PFN_vkCreateSemaphore) vkelGetInstanceProcAddr(instance, "vkCreateSemaphore");
-	__vkCreateShaderModule = (PFN_vkCreateShaderModule) vkelGetInstanceProcAddr(instance, "vkCreateShaderModule");
-	__vkCreateSharedSwapchainsKHR = (PFN_vkCreateSharedSwapchainsKHR) vkelGetInstanceProcAddr(instance, "vkCreateSharedSwapchainsKHR");
-	__vkCreateSwapchainKHR = (PFN_vkCreateSwapchainKHR) vkelGetInstanceProcAddr(instance, "vkCreateSwapchainKHR");
-	__vkDebugMarkerSetObjectNameEXT = (PFN_vkDebugMarkerSetObjectNameEXT) vkelGetInstanceProcAddr(instance, "vkDebugMarkerSetObjectNameEXT");
-	__vkDebugMarkerSetObjectTagEXT = (PFN_vkDebugMarkerSetObjectTagEXT) vkelGetInstanceProcAddr(instance, "vkDebugMarkerSetObjectTagEXT");
-	__vkDebugReportCallbackEXT = (PFN_vkDebugReportCallbackEXT) vkelGetInstanceProcAddr(instance, "vkDebugReportCallbackEXT");
-	__vkDebugReportMessageEXT = (PFN_vkDebugReportMessageEXT) vkelGetInstanceProcAddr(instance, "vkDebugReportMessageEXT");
-	__vkDestroyBuffer = (PFN_vkDestroyBuffer) vkelGetInstanceProcAddr(instance, "vkDestroyBuffer");
-	__vkDestroyBufferView = (PFN_vkDestroyBufferView) vkelGetInstanceProcAddr(instance, "vkDestroyBufferView");
-	__vkDestroyCommandPool = (PFN_vkDestroyCommandPool) vkelGetInstanceProcAddr(instance, "vkDestroyCommandPool");
-	__vkDestroyDebugReportCallbackEXT = (PFN_vkDestroyDebugReportCallbackEXT) vkelGetInstanceProcAddr(instance, "vkDestroyDebugReportCallbackEXT");
-	__vkDestroyDescriptorPool = (PFN_vkDestroyDescriptorPool) vkelGetInstanceProcAddr(instance, "vkDestroyDescriptorPool");
-	__vkDestroyDescriptorSetLayout = (PFN_vkDestroyDescriptorSetLayout) vkelGetInstanceProcAddr(instance, "vkDestroyDescriptorSetLayout");
-	__vkDestroyDevice = (PFN_vkDestroyDevice) vkelGetInstanceProcAddr(instance, "vkDestroyDevice");
-	__vkDestroyEvent = (PFN_vkDestroyEvent) vkelGetInstanceProcAddr(instance, "vkDestroyEvent");
-	__vkDestroyFence = (PFN_vkDestroyFence) vkelGetInstanceProcAddr(instance, "vkDestroyFence");
-	__vkDestroyFramebuffer = (PFN_vkDestroyFramebuffer) vkelGetInstanceProcAddr(instance, "vkDestroyFramebuffer");
-	__vkDestroyImage = (PFN_vkDestroyImage) vkelGetInstanceProcAddr(instance, "vkDestroyImage");
-	__vkDestroyImageView = (PFN_vkDestroyImageView) vkelGetInstanceProcAddr(instance, "vkDestroyImageView");
-	__vkDestroyInstance = (PFN_vkDestroyInstance) vkelGetInstanceProcAddr(instance, "vkDestroyInstance");
-	__vkDestroyPipeline = (PFN_vkDestroyPipeline) vkelGetInstanceProcAddr(instance, "vkDestroyPipeline");
-	__vkDestroyPipelineCache = (PFN_vkDestroyPipelineCache) vkelGetInstanceProcAddr(instance, "vkDestroyPipelineCache");
-	__vkDestroyPipelineLayout = (PFN_vkDestroyPipelineLayout) vkelGetInstanceProcAddr(instance, "vkDestroyPipelineLayout");
-	__vkDestroyQueryPool = (PFN_vkDestroyQueryPool) vkelGetInstanceProcAddr(instance, "vkDestroyQueryPool");
-	__vkDestroyRenderPass = (PFN_vkDestroyRenderPass) vkelGetInstanceProcAddr(instance, "vkDestroyRenderPass");
-	__vkDestroySampler = (PFN_vkDestroySampler) vkelGetInstanceProcAddr(instance, "vkDestroySampler");
-	__vkDestroySemaphore = (PFN_vkDestroySemaphore) vkelGetInstanceProcAddr(instance, "vkDestroySemaphore");
-	__vkDestroyShaderModule = (PFN_vkDestroyShaderModule) vkelGetInstanceProcAddr(instance, "vkDestroyShaderModule");
-	__vkDestroySurfaceKHR = (PFN_vkDestroySurfaceKHR) vkelGetInstanceProcAddr(instance, "vkDestroySurfaceKHR");
-	__vkDestroySwapchainKHR = (PFN_vkDestroySwapchainKHR) vkelGetInstanceProcAddr(instance, "vkDestroySwapchainKHR");
-	__vkDeviceWaitIdle = (PFN_vkDeviceWaitIdle) vkelGetInstanceProcAddr(instance, "vkDeviceWaitIdle");
-	__vkEndCommandBuffer = (PFN_vkEndCommandBuffer) vkelGetInstanceProcAddr(instance, "vkEndCommandBuffer");
-	__vkEnumerateDeviceExtensionProperties = (PFN_vkEnumerateDeviceExtensionProperties) vkelGetInstanceProcAddr(instance, "vkEnumerateDeviceExtensionProperties");
-	__vkEnumerateDeviceLayerProperties = (PFN_vkEnumerateDeviceLayerProperties) vkelGetInstanceProcAddr(instance, "vkEnumerateDeviceLayerProperties");
-	__vkEnumerateInstanceExtensionProperties = (PFN_vkEnumerateInstanceExtensionProperties) vkelGetInstanceProcAddr(instance, "vkEnumerateInstanceExtensionProperties");
-	__vkEnumerateInstanceLayerProperties = (PFN_vkEnumerateInstanceLayerProperties) vkelGetInstanceProcAddr(instance, "vkEnumerateInstanceLayerProperties");
-	__vkEnumeratePhysicalDevices = (PFN_vkEnumeratePhysicalDevices) vkelGetInstanceProcAddr(instance, "vkEnumeratePhysicalDevices");
-	__vkFlushMappedMemoryRanges = (PFN_vkFlushMappedMemoryRanges) vkelGetInstanceProcAddr(instance, "vkFlushMappedMemoryRanges");
-	__vkFreeCommandBuffers = (PFN_vkFreeCommandBuffers) vkelGetInstanceProcAddr(instance, "vkFreeCommandBuffers");
-	__vkFreeDescriptorSets = (PFN_vkFreeDescriptorSets) vkelGetInstanceProcAddr(instance, "vkFreeDescriptorSets");
-	__vkFreeFunction = (PFN_vkFreeFunction) vkelGetInstanceProcAddr(instance, "vkFreeFunction");
-	__vkFreeMemory = (PFN_vkFreeMemory) vkelGetInstanceProcAddr(instance, "vkFreeMemory");
-	__vkGetBufferMemoryRequirements = (PFN_vkGetBufferMemoryRequirements) vkelGetInstanceProcAddr(instance, "vkGetBufferMemoryRequirements");
-	__vkGetDeviceMemoryCommitment = (PFN_vkGetDeviceMemoryCommitment) vkelGetInstanceProcAddr(instance, "vkGetDeviceMemoryCommitment");
-	__vkGetDeviceProcAddr = (PFN_vkGetDeviceProcAddr) vkelGetInstanceProcAddr(instance, "vkGetDeviceProcAddr");
-	__vkGetDeviceQueue = (PFN_vkGetDeviceQueue) vkelGetInstanceProcAddr(instance, "vkGetDeviceQueue");
-	__vkGetDisplayModePropertiesKHR = (PFN_vkGetDisplayModePropertiesKHR) vkelGetInstanceProcAddr(instance, "vkGetDisplayModePropertiesKHR");
-	__vkGetDisplayPlaneCapabilitiesKHR = (PFN_vkGetDisplayPlaneCapabilitiesKHR) vkelGetInstanceProcAddr(instance, "vkGetDisplayPlaneCapabilitiesKHR");
-	__vkGetDisplayPlaneSupportedDisplaysKHR = (PFN_vkGetDisplayPlaneSupportedDisplaysKHR) vkelGetInstanceProcAddr(instance, "vkGetDisplayPlaneSupportedDisplaysKHR");
-	__vkGetEventStatus = (PFN_vkGetEventStatus) vkelGetInstanceProcAddr(instance, "vkGetEventStatus");
-	__vkGetFenceStatus = (PFN_vkGetFenceStatus) vkelGetInstanceProcAddr(instance, "vkGetFenceStatus");
-	__vkGetImageMemoryRequirements = (PFN_vkGetImageMemoryRequirements) vkelGetInstanceProcAddr(instance, "vkGetImageMemoryRequirements");
-	__vkGetImageSparseMemoryRequirements = (PFN_vkGetImageSparseMemoryRequirements) vkelGetInstanceProcAddr(instance, "vkGetImageSparseMemoryRequirements");
-	__vkGetImageSubresourceLayout = (PFN_vkGetImageSubresourceLayout) vkelGetInstanceProcAddr(instance, "vkGetImageSubresourceLayout");
-	__vkGetInstanceProcAddr = (PFN_vkGetInstanceProcAddr) vkelGetInstanceProcAddr(instance, "vkGetInstanceProcAddr");
-	__vkGetPhysicalDeviceDisplayPlanePropertiesKHR = (PFN_vkGetPhysicalDeviceDisplayPlanePropertiesKHR) vkelGetInstanceProcAddr(instance, "vkGetPhysicalDeviceDisplayPlanePropertiesKHR");
-	__vkGetPhysicalDeviceDisplayPropertiesKHR = (PFN_vkGetPhysicalDeviceDisplayPropertiesKHR) vkelGetInstanceProcAddr(instance, "vkGetPhysicalDeviceDisplayPropertiesKHR");
-	__vkGetPhysicalDeviceFeatures = (PFN_vkGetPhysicalDeviceFeatures) vkelGetInstanceProcAddr(instance, "vkGetPhysicalDeviceFeatures");
-	__vkGetPhysicalDeviceFormatProperties = (PFN_vkGetPhysicalDeviceFormatProperties) vkelGetInstanceProcAddr(instance, "vkGetPhysicalDeviceFormatProperties");
-	__vkGetPhysicalDeviceImageFormatProperties = (PFN_vkGetPhysicalDeviceImageFormatProperties) vkelGetInstanceProcAddr(instance, "vkGetPhysicalDeviceImageFormatProperties");
-	__vkGetPhysicalDeviceMemoryProperties = (PFN_vkGetPhysicalDeviceMemoryProperties) vkelGetInstanceProcAddr(instance, "vkGetPhysicalDeviceMemoryProperties");
-	__vkGetPhysicalDeviceProperties = (PFN_vkGetPhysicalDeviceProperties) vkelGetInstanceProcAddr(instance, "vkGetPhysicalDeviceProperties");
-	__vkGetPhysicalDeviceQueueFamilyProperties = (PFN_vkGetPhysicalDeviceQueueFamilyProperties) vkelGetInstanceProcAddr(instance, "vkGetPhysicalDeviceQueueFamilyProperties");
-	__vkGetPhysicalDeviceSparseImageFormatProperties = (PFN_vkGetPhysicalDeviceSparseImageFormatProperties) vkelGetInstanceProcAddr(instance, "vkGetPhysicalDeviceSparseImageFormatProperties");
-	__vkGetPhysicalDeviceSurfaceCapabilitiesKHR = (PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR) vkelGetInstanceProcAddr(instance, "vkGetPhysicalDeviceSurfaceCapabilitiesKHR");
-	__vkGetPhysicalDeviceSurfaceFormatsKHR = (PFN_vkGetPhysicalDeviceSurfaceFormatsKHR) vkelGetInstanceProcAddr(instance, "vkGetPhysicalDeviceSurfaceFormatsKHR");
-	__vkGetPhysicalDeviceSurfacePresentModesKHR = (PFN_vkGetPhysicalDeviceSurfacePresentModesKHR) vkelGetInstanceProcAddr(instance, "vkGetPhysicalDeviceSurfacePresentModesKHR");
-	__vkGetPhysicalDeviceSurfaceSupportKHR = (PFN_vkGetPhysicalDeviceSurfaceSupportKHR) vkelGetInstanceProcAddr(instance, "vkGetPhysicalDeviceSurfaceSupportKHR");
-	__vkGetPipelineCacheData = (PFN_vkGetPipelineCacheData) vkelGetInstanceProcAddr(instance, "vkGetPipelineCacheData");
-	__vkGetQueryPoolResults = (PFN_vkGetQueryPoolResults) vkelGetInstanceProcAddr(instance, "vkGetQueryPoolResults");
-	__vkGetRenderAreaGranularity = (PFN_vkGetRenderAreaGranularity) vkelGetInstanceProcAddr(instance, "vkGetRenderAreaGranularity");
-	__vkGetSwapchainImagesKHR = (PFN_vkGetSwapchainImagesKHR) vkelGetInstanceProcAddr(instance, "vkGetSwapchainImagesKHR");
-	__vkInternalAllocationNotification = (PFN_vkInternalAllocationNotification) vkelGetInstanceProcAddr(instance, "vkInternalAllocationNotification");
-	__vkInternalFreeNotification = (PFN_vkInternalFreeNotification) vkelGetInstanceProcAddr(instance, "vkInternalFreeNotification");
-	__vkInvalidateMappedMemoryRanges = (PFN_vkInvalidateMappedMemoryRanges) vkelGetInstanceProcAddr(instance, "vkInvalidateMappedMemoryRanges");
-	__vkMapMemory = (PFN_vkMapMemory) vkelGetInstanceProcAddr(instance, "vkMapMemory");
-	__vkMergePipelineCaches = (PFN_vkMergePipelineCaches) vkelGetInstanceProcAddr(instance, "vkMergePipelineCaches");
-	__vkQueueBindSparse = (PFN_vkQueueBindSparse) vkelGetInstanceProcAddr(instance, "vkQueueBindSparse");
-	__vkQueuePresentKHR = (PFN_vkQueuePresentKHR) vkelGetInstanceProcAddr(instance, "vkQueuePresentKHR");
-	__vkQueueSubmit = (PFN_vkQueueSubmit) vkelGetInstanceProcAddr(instance, "vkQueueSubmit");
-	__vkQueueWaitIdle = (PFN_vkQueueWaitIdle) vkelGetInstanceProcAddr(instance, "vkQueueWaitIdle");
-	__vkReallocationFunction = (PFN_vkReallocationFunction) vkelGetInstanceProcAddr(instance, "vkReallocationFunction");
-	__vkResetCommandBuffer = (PFN_vkResetCommandBuffer) vkelGetInstanceProcAddr(instance, "vkResetCommandBuffer");
-	__vkResetCommandPool = (PFN_vkResetCommandPool) vkelGetInstanceProcAddr(instance, "vkResetCommandPool");
-	__vkResetDescriptorPool = (PFN_vkResetDescriptorPool) vkelGetInstanceProcAddr(instance, "vkResetDescriptorPool");
-	__vkResetEvent = (PFN_vkResetEvent) vkelGetInstanceProcAddr(instance, "vkResetEvent");
-	__vkResetFences = (PFN_vkResetFences) vkelGetInstanceProcAddr(instance, "vkResetFences");
-	__vkSetEvent = (PFN_vkSetEvent) vkelGetInstanceProcAddr(instance, "vkSetEvent");
-	__vkUnmapMemory = (PFN_vkUnmapMemory) vkelGetInstanceProcAddr(instance, "vkUnmapMemory");
-	__vkUpdateDescriptorSets = (PFN_vkUpdateDescriptorSets) vkelGetInstanceProcAddr(instance, "vkUpdateDescriptorSets");
-	__vkVoidFunction = (PFN_vkVoidFunction) vkelGetInstanceProcAddr(instance, "vkVoidFunction");
-	__vkWaitForFences = (PFN_vkWaitForFences) vkelGetInstanceProcAddr(instance, "vkWaitForFences");
-
-#ifdef VK_USE_PLATFORM_ANDROID_KHR
-	__vkCreateAndroidSurfaceKHR = (PFN_vkCreateAndroidSurfaceKHR) vkelGetInstanceProcAddr(instance, "vkCreateAndroidSurfaceKHR");
-#endif /* VK_USE_PLATFORM_ANDROID_KHR */
-
-#ifdef VK_USE_PLATFORM_MIR_KHR
-	__vkCreateMirSurfaceKHR = (PFN_vkCreateMirSurfaceKHR) vkelGetInstanceProcAddr(instance, "vkCreateMirSurfaceKHR");
-	__vkGetPhysicalDeviceMirPresentationSupportKHR = (PFN_vkGetPhysicalDeviceMirPresentationSupportKHR) vkelGetInstanceProcAddr(instance, "vkGetPhysicalDeviceMirPresentationSupportKHR");
-#endif /* VK_USE_PLATFORM_MIR_KHR */
-
-#ifdef VK_USE_PLATFORM_WAYLAND_KHR
-	__vkCreateWaylandSurfaceKHR = (PFN_vkCreateWaylandSurfaceKHR) vkelGetInstanceProcAddr(instance, "vkCreateWaylandSurfaceKHR");
-	__vkGetPhysicalDeviceWaylandPresentationSupportKHR = (PFN_vkGetPhysicalDeviceWaylandPresentationSupportKHR) vkelGetInstanceProcAddr(instance, "vkGetPhysicalDeviceWaylandPresentationSupportKHR");
-#endif /* VK_USE_PLATFORM_WAYLAND_KHR */
-
-#ifdef VK_USE_PLATFORM_WIN32_KHR
-	__vkCreateWin32SurfaceKHR = (PFN_vkCreateWin32SurfaceKHR) vkelGetInstanceProcAddr(instance, "vkCreateWin32SurfaceKHR");
-	__vkGetPhysicalDeviceWin32PresentationSupportKHR = (PFN_vkGetPhysicalDeviceWin32PresentationSupportKHR) vkelGetInstanceProcAddr(instance, "vkGetPhysicalDeviceWin32PresentationSupportKHR");
-#endif /* VK_USE_PLATFORM_WIN32_KHR */
-
-#ifdef VK_USE_PLATFORM_XCB_KHR
-	__vkCreateXcbSurfaceKHR = (PFN_vkCreateXcbSurfaceKHR) vkelGetInstanceProcAddr(instance, "vkCreateXcbSurfaceKHR");
-	__vkGetPhysicalDeviceXcbPresentationSupportKHR = (PFN_vkGetPhysicalDeviceXcbPresentationSupportKHR) vkelGetInstanceProcAddr(instance, "vkGetPhysicalDeviceXcbPresentationSupportKHR");
-#endif /* VK_USE_PLATFORM_XCB_KHR */
-
-#ifdef VK_USE_PLATFORM_XLIB_KHR
-	__vkCreateXlibSurfaceKHR = (PFN_vkCreateXlibSurfaceKHR) vkelGetInstanceProcAddr(instance, "vkCreateXlibSurfaceKHR");
-	__vkGetPhysicalDeviceXlibPresentationSupportKHR = (PFN_vkGetPhysicalDeviceXlibPresentationSupportKHR) vkelGetInstanceProcAddr(instance, "vkGetPhysicalDeviceXlibPresentationSupportKHR");
-#endif /* VK_USE_PLATFORM_XLIB_KHR */
-
-
-	// Instance and device extension names
-	VKEL_AMD_gcn_shader = vkelIsInstanceExtensionSupported(NULL, "VK_AMD_gcn_shader");
-	VKEL_AMD_rasterization_order = vkelIsInstanceExtensionSupported(NULL, "VK_AMD_rasterization_order");
-	VKEL_AMD_shader_explicit_vertex_parameter = vkelIsInstanceExtensionSupported(NULL, "VK_AMD_shader_explicit_vertex_parameter");
-	VKEL_AMD_shader_trinary_minmax = vkelIsInstanceExtensionSupported(NULL, "VK_AMD_shader_trinary_minmax");
-	VKEL_EXT_debug_marker = vkelIsInstanceExtensionSupported(NULL, "VK_EXT_debug_marker");
-	VKEL_EXT_debug_report = vkelIsInstanceExtensionSupported(NULL, "VK_EXT_debug_report");
-	VKEL_IMG_filter_cubic = vkelIsInstanceExtensionSupported(NULL, "VK_IMG_filter_cubic");
-	VKEL_IMG_format_pvrtc = vkelIsInstanceExtensionSupported(NULL, "VK_IMG_format_pvrtc");
-	VKEL_KHR_android_surface = vkelIsInstanceExtensionSupported(NULL, "VK_KHR_android_surface");
-	VKEL_KHR_display = vkelIsInstanceExtensionSupported(NULL, "VK_KHR_display");
-	VKEL_KHR_display_swapchain = vkelIsInstanceExtensionSupported(NULL, "VK_KHR_display_swapchain");
-	VKEL_KHR_mir_surface = vkelIsInstanceExtensionSupported(NULL, "VK_KHR_mir_surface");
-	VKEL_KHR_sampler_mirror_clamp_to_edge = vkelIsInstanceExtensionSupported(NULL, "VK_KHR_sampler_mirror_clamp_to_edge");
-	VKEL_KHR_surface = vkelIsInstanceExtensionSupported(NULL, "VK_KHR_surface");
-	VKEL_KHR_swapchain = vkelIsInstanceExtensionSupported(NULL, "VK_KHR_swapchain");
-	VKEL_KHR_wayland_surface = vkelIsInstanceExtensionSupported(NULL, "VK_KHR_wayland_surface");
-	VKEL_KHR_win32_surface = vkelIsInstanceExtensionSupported(NULL, "VK_KHR_win32_surface");
-	VKEL_KHR_xcb_surface = vkelIsInstanceExtensionSupported(NULL, "VK_KHR_xcb_surface");
-	VKEL_KHR_xlib_surface = vkelIsInstanceExtensionSupported(NULL, "VK_KHR_xlib_surface");
-	VKEL_NV_dedicated_allocation = vkelIsInstanceExtensionSupported(NULL, "VK_NV_dedicated_allocation");
-	VKEL_NV_glsl_shader = vkelIsInstanceExtensionSupported(NULL, "VK_NV_glsl_shader");
-
-	// Instance and device layer names
-	VKEL_LAYER_GOOGLE_unique_objects = vkelIsInstanceLayerSupported("VK_LAYER_GOOGLE_unique_objects");
-	VKEL_LAYER_LUNARG_api_dump = vkelIsInstanceLayerSupported("VK_LAYER_LUNARG_api_dump");
-	VKEL_LAYER_LUNARG_device_limits = vkelIsInstanceLayerSupported("VK_LAYER_LUNARG_device_limits");
-	VKEL_LAYER_LUNARG_draw_state = vkelIsInstanceLayerSupported("VK_LAYER_LUNARG_draw_state");
-	VKEL_LAYER_LUNARG_image = vkelIsInstanceLayerSupported("VK_LAYER_LUNARG_image");
-	VKEL_LAYER_LUNARG_mem_tracker = vkelIsInstanceLayerSupported("VK_LAYER_LUNARG_mem_tracker");
-	VKEL_LAYER_LUNARG_object_tracker = vkelIsInstanceLayerSupported("VK_LAYER_LUNARG_object_tracker");
-	VKEL_LAYER_LUNARG_param_checker = vkelIsInstanceLayerSupported("VK_LAYER_LUNARG_param_checker");
-	VKEL_LAYER_LUNARG_screenshot = vkelIsInstanceLayerSupported("VK_LAYER_LUNARG_screenshot");
-	VKEL_LAYER_LUNARG_swapchain = vkelIsInstanceLayerSupported("VK_LAYER_LUNARG_swapchain");
-	VKEL_LAYER_LUNARG_threading = vkelIsInstanceLayerSupported("VK_LAYER_LUNARG_threading");
-	VKEL_LAYER_LUNARG_vktrace = vkelIsInstanceLayerSupported("VK_LAYER_LUNARG_vktrace");
+	if (!context)
+		return NULL;
+	
+	char libraryPath[VKEL_MAX_PATH];
+	
+	if (vkelHasSuffix(pPath, ".json"))
+	{
+		if (vkelReadIcdLibraryPath(pPath, libraryPath))
+			context->libraryHandle = vkelOpenIcdLibrary(libraryPath, &context->getInstanceProcAddr);
+	}
+	else
+	{
+		// Either an ICD, or a loader which exports vkGetInstanceProcAddr like any other function
+		context->libraryHandle = vkelOpenIcdLibrary(pPath, &context->getInstanceProcAddr);
+		
+		if (!context->libraryHandle)
+		{
+			context->libraryHandle = vkelPlatformOpenLibrary(pPath);
+			
+			if (context->libraryHandle)
+				context->getInstanceProcAddr = (PFN_vkGetInstanceProcAddr) vkelPlatformGetProcAddr(context->libraryHandle, "vkGetInstanceProcAddr");
+		}
+	}
+	
+	if (!context->libraryHandle || !context->getInstanceProcAddr)
+	{
+		if (context->libraryHandle)
+			vkelPlatformCloseLibrary(context->libraryHandle);
+		
+		vkel_free(context);
+		
+		return NULL;
+	}
+	
+	
+	vkelLoadContextTable(context);
+	
+	vkelGetContextSupport(context, VK_NULL_HANDLE, &context->instanceCapabilities);
+	vkelUpdateContextTable(context);
+	
+	
+	return context;
+}
 
+VkBool32 vkelContextInstanceInit(VkelContext context, VkInstance instance)
+{
+	assert(context);
+	
+	context->instance = instance;
+	
+	vkelLoadContextTable(context);
+	
+	// The supported instance extensions and layers don't depend on the instance
+	memset(&context->deviceCapabilities, 0, sizeof(VkelCapabilities));
+	
 	
 	return VK_TRUE;
 }
-	
-VkBool32 vkelDeviceInit(VkPhysicalDevice physicalDevice, VkDevice device)
+
+VkBool32 vkelContextDeviceInit(VkelContext context, VkPhysicalDevice physicalDevice, VkDevice device)
 {
-	if (!vkelVkLibHandle && !vkelInit())
+	assert(context);
+	
+	if (!context->instance)
 		return VK_FALSE;
 	
+	vkelLoadContextDeviceTable(context, device);
 	
-	__vkAcquireNextImageKHR = (PFN_vkAcquireNextImageKHR) vkelGetDeviceProcAddr(device, "vkAcquireNextImageKHR");
-	__vkAllocateCommandBuffers = (PFN_vkAllocateCommandBuffers) vkelGetDeviceProcAddr(device, "vkAllocateCommandBuffers");
-	__vkAllocateDescriptorSets = (PFN_vkAllocateDescriptorSets) vkelGetDeviceProcAddr(device, "vkAllocateDescriptorSets");
-	__vkAllocateMemory = (PFN_vkAllocateMemory) vkelGetDeviceProcAddr(device, "vkAllocateMemory");
-	__vkAllocationFunction = (PFN_vkAllocationFunction) vkelGetDeviceProcAddr(device, "vkAllocationFunction");
-	__vkBeginCommandBuffer = (PFN_vkBeginCommandBuffer) vkelGetDeviceProcAddr(device, "vkBeginCommandBuffer");
-	__vkBindBufferMemory = (PFN_vkBindBufferMemory) vkelGetDeviceProcAddr(device, "vkBindBufferMemory");
-	__vkBindImageMemory = (PFN_vkBindImageMemory) vkelGetDeviceProcAddr(device, "vkBindImageMemory");
-	__vkCmdBeginQuery = (PFN_vkCmdBeginQuery) vkelGetDeviceProcAddr(device, "vkCmdBeginQuery");
-	__vkCmdBeginRenderPass = (PFN_vkCmdBeginRenderPass) vkelGetDeviceProcAddr(device, "vkCmdBeginRenderPass");
-	__vkCmdBindDescriptorSets = (PFN_vkCmdBindDescriptorSets) vkelGetDeviceProcAddr(device, "vkCmdBindDescriptorSets");
-	__vkCmdBindIndexBuffer = (PFN_vkCmdBindIndexBuffer) vkelGetDeviceProcAddr(device, "vkCmdBindIndexBuffer");
-	__vkCmdBindPipeline = (PFN_vkCmdBindPipeline) vkelGetDeviceProcAddr(device, "vkCmdBindPipeline");
-	__vkCmdBindVertexBuffers = (PFN_vkCmdBindVertexBuffers) vkelGetDeviceProcAddr(device, "vkCmdBindVertexBuffers");
-	__vkCmdBlitImage = (PFN_vkCmdBlitImage) vkelGetDeviceProcAddr(device, "vkCmdBlitImage");
-	__vkCmdClearAttachments = (PFN_vkCmdClearAttachments) vkelGetDeviceProcAddr(device, "vkCmdClearAttachments");
-	__vkCmdClearColorImage = (PFN_vkCmdClearColorImage) vkelGetDeviceProcAddr(device, "vkCmdClearColorImage");
-	__vkCmdClearDepthStencilImage = (PFN_vkCmdClearDepthStencilImage) vkelGetDeviceProcAddr(device, "vkCmdClearDepthStencilImage");
-	__vkCmdCopyBuffer = (PFN_vkCmdCopyBuffer) vkelGetDeviceProcAddr(device, "vkCmdCopyBuffer");
-	__vkCmdCopyBufferToImage = (PFN_vkCmdCopyBufferToImage) vkelGetDeviceProcAddr(device, "vkCmdCopyBufferToImage");
-	__vkCmdCopyImage = (PFN_vkCmdCopyImage) vkelGetDeviceProcAddr(device, "vkCmdCopyImage");
-	__vkCmdCopyImageToBuffer = (PFN_vkCmdCopyImageToBuffer) vkelGetDeviceProcAddr(device, "vkCmdCopyImageToBuffer");
-	__vkCmdCopyQueryPoolResults = (PFN_vkCmdCopyQueryPoolResults) vkelGetDeviceProcAddr(device, "vkCmdCopyQueryPoolResults");
-	__vkCmdDebugMarkerBeginEXT = (PFN_vkCmdDebugMarkerBeginEXT) vkelGetDeviceProcAddr(device, "vkCmdDebugMarkerBeginEXT");
-	__vkCmdDebugMarkerEndEXT = (PFN_vkCmdDebugMarkerEndEXT) vkelGetDeviceProcAddr(device, "vkCmdDebugMarkerEndEXT");
-	__vkCmdDebugMarkerInsertEXT = (PFN_vkCmdDebugMarkerInsertEXT) vkelGetDeviceProcAddr(device, "vkCmdDebugMarkerInsertEXT");
-	__vkCmdDispatch = (PFN_vkCmdDispatch) vkelGetDeviceProcAddr(device, "vkCmdDispatch");
-	__vkCmdDispatchIndirect = (PFN_vkCmdDispatchIndirect) vkelGetDeviceProcAddr(device, "vkCmdDispatchIndirect");
-	__vkCmdDraw = (PFN_vkCmdDraw) vkelGetDeviceProcAddr(device, "vkCmdDraw");
-	__vkCmdDrawIndexed = (PFN_vkCmdDrawIndexed) vkelGetDeviceProcAddr(device, "vkCmdDrawIndexed");
-	__vkCmdDrawIndexedIndirect = (PFN_vkCmdDrawIndexedIndirect) vkelGetDeviceProcAddr(device, "vkCmdDrawIndexedIndirect");
-	__vkCmdDrawIndirect = (PFN_vkCmdDrawIndirect) vkelGetDeviceProcAddr(device, "vkCmdDrawIndirect");
-	__vkCmdEndQuery = (PFN_vkCmdEndQuery) vkelGetDeviceProcAddr(device, "vkCmdEndQuery");
-	__vkCmdEndRenderPass = (PFN_vkCmdEndRenderPass) vkelGetDeviceProcAddr(device, "vkCmdEndRenderPass");
-	__vkCmdExecuteCommands = (PFN_vkCmdExecuteCommands) vkelGetDeviceProcAddr(device, "vkCmdExecuteCommands");
-	__vkCmdFillBuffer = (PFN_vkCmdFillBuffer) vkelGetDeviceProcAddr(device, "vkCmdFillBuffer");
-	__vkCmdNextSubpass = (PFN_vkCmdNextSubpass) vkelGetDeviceProcAddr(device, "vkCmdNextSubpass");
-	__vkCmdPipelineBarrier = (PFN_vkCmdPipelineBarrier) vkelGetDeviceProcAddr(device, "vkCmdPipelineBarrier");
-	__vkCmdPushConstants = (PFN_vkCmdPushConstants) vkelGetDeviceProcAddr(device, "vkCmdPushConstants");
-	__vkCmdResetEvent = (PFN_vkCmdResetEvent) vkelGetDeviceProcAddr(device, "vkCmdResetEvent");
-	__vkCmdResetQueryPool = (PFN_vkCmdResetQueryPool) vkelGetDeviceProcAddr(device, "vkCmdResetQueryPool");
-	__vkCmdResolveImage = (PFN_vkCmdResolveImage) vkelGetDeviceProcAddr(device, "vkCmdResolveImage");
-	__vkCmdSetBlendConstants = (PFN_vkCmdSetBlendConstants) vkelGetDeviceProcAddr(device, "vkCmdSetBlendConstants");
-	__vkCmdSetDepthBias = (PFN_vkCmdSetDepthBias) vkelGetDeviceProcAddr(device, "vkCmdSetDepthBias");
-	__vkCmdSetDepthBounds = (PFN_vkCmdSetDepthBounds) vkelGetDeviceProcAddr(device, "vkCmdSetDepthBounds");
-	__vkCmdSetEvent = (PFN_vkCmdSetEvent) vkelGetDeviceProcAddr(device, "vkCmdSetEvent");
-	__vkCmdSetLineWidth = (PFN_vkCmdSetLineWidth) vkelGetDeviceProcAddr(device, "vkCmdSetLineWidth");
-	__vkCmdSetScissor = (PFN_vkCmdSetScissor) vkelGetDeviceProcAddr(device, "vkCmdSetScissor");
-	__vkCmdSetStencilCompareMask = (PFN_vkCmdSetStencilCompareMask) vkelGetDeviceProcAddr(device, "vkCmdSetStencilCompareMask");
-	__vkCmdSetStencilReference = (PFN_vkCmdSetStencilReference) vkelGetDeviceProcAddr(device, "vkCmdSetStencilReference");
-	__vkCmdSetStencilWriteMask = (PFN_vkCmdSetStencilWriteMask) vkelGetDeviceProcAddr(device, "vkCmdSetStencilWriteMask");
-	__vkCmdSetViewport = (PFN_vkCmdSetViewport) vkelGetDeviceProcAddr(device, "vkCmdSetViewport");
-	__vkCmdUpdateBuffer = (PFN_vkCmdUpdateBuffer) vkelGetDeviceProcAddr(device, "vkCmdUpdateBuffer");
-	__vkCmdWaitEvents = (PFN_vkCmdWaitEvents) vkelGetDeviceProcAddr(device, "vkCmdWaitEvents");
-	__vkCmdWriteTimestamp = (PFN_vkCmdWriteTimestamp) vkelGetDeviceProcAddr(device, "vkCmdWriteTimestamp");
-	__vkCreateBuffer = (PFN_vkCreateBuffer) vkelGetDeviceProcAddr(device, "vkCreateBuffer");
-	__vkCreateBufferView = (PFN_vkCreateBufferView) vkelGetDeviceProcAddr(device, "vkCreateBufferView");
-	__vkCreateCommandPool = (PFN_vkCreateCommandPool) vkelGetDeviceProcAddr(device, "vkCreateCommandPool");
-	__vkCreateComputePipelines = (PFN_vkCreateComputePipelines) vkelGetDeviceProcAddr(device, "vkCreateComputePipelines");
-	__vkCreateDebugReportCallbackEXT = (PFN_vkCreateDebugReportCallbackEXT) vkelGetDeviceProcAddr(device, "vkCreateDebugReportCallbackEXT");
-	__vkCreateDescriptorPool = (PFN_vkCreateDescriptorPool) vkelGetDeviceProcAddr(device, "vkCreateDescriptorPool");
-	__vkCreateDescriptorSetLayout = (PFN_vkCreateDescriptorSetLayout) vkelGetDeviceProcAddr(device, "vkCreateDescriptorSetLayout");
-	__vkCreateDevice = (PFN_vkCreateDevice) vkelGetDeviceProcAddr(device, "vkCreateDevice");
-	__vkCreateDisplayModeKHR = (PFN_vkCreateDisplayModeKHR) vkelGetDeviceProcAddr(device, "vkCreateDisplayModeKHR");
-	__vkCreateDisplayPlaneSurfaceKHR = (PFN_vkCreateDisplayPlaneSurfaceKHR) vkelGetDeviceProcAddr(device, "vkCreateDisplayPlaneSurfaceKHR");
-	__vkCreateEvent = (PFN_vkCreateEvent) vkelGetDeviceProcAddr(device, "vkCreateEvent");
-	__vkCreateFence = (PFN_vkCreateFence) vkelGetDeviceProcAddr(device, "vkCreateFence");
-	__vkCreateFramebuffer = (PFN_vkCreateFramebuffer) vkelGetDeviceProcAddr(device, "vkCreateFramebuffer");
-	__vkCreateGraphicsPipelines = (PFN_vkCreateGraphicsPipelines) vkelGetDeviceProcAddr(device, "vkCreateGraphicsPipelines");
-	__vkCreateImage = (PFN_vkCreateImage) vkelGetDeviceProcAddr(device, "vkCreateImage");
-	__vkCreateImageView = (PFN_vkCreateImageView) vkelGetDeviceProcAddr(device, "vkCreateImageView");
-	__vkCreateInstance = (PFN_vkCreateInstance) vkelGetDeviceProcAddr(device, "vkCreateInstance");
-	__vkCreatePipelineCache = (PFN_vkCreatePipelineCache) vkelGetDeviceProcAddr(device, "vkCreatePipelineCache");
-	__vkCreatePipelineLayout = (PFN_vkCreatePipelineLayout) vkelGetDeviceProcAddr(device, "vkCreatePipelineLayout");
-	__vkCreateQueryPool = (PFN_vkCreateQueryPool) vkelGetDeviceProcAddr(device, "vkCreateQueryPool");
-	__vkCreateRenderPass = (PFN_vkCreateRenderPass) vkelGetDeviceProcAddr(device, "vkCreateRenderPass");
-	__vkCreateSampler = (PFN_vkCreateSampler) vkelGetDeviceProcAddr(device, "vkCreateSampler");
-	__vkCreateSemaphore = (PFN_vkCreateSemaphore) vkelGetDeviceProcAddr(device, "vkCreateSemaphore");
-	__vkCreateShaderModule = (PFN_vkCreateShaderModule) vkelGetDeviceProcAddr(device, "vkCreateShaderModule");
-	__vkCreateSharedSwapchainsKHR = (PFN_vkCreateSharedSwapchainsKHR) vkelGetDeviceProcAddr(device, "vkCreateSharedSwapchainsKHR");
-	__vkCreateSwapchainKHR = (PFN_vkCreateSwapchainKHR) vkelGetDeviceProcAddr(device, "vkCreateSwapchainKHR");
-	__vkDebugMarkerSetObjectNameEXT = (PFN_vkDebugMarkerSetObjectNameEXT) vkelGetDeviceProcAddr(device, "vkDebugMarkerSetObjectNameEXT");
-	__vkDebugMarkerSetObjectTagEXT = (PFN_vkDebugMarkerSetObjectTagEXT) vkelGetDeviceProcAddr(device, "vkDebugMarkerSetObjectTagEXT");
-	__vkDebugReportCallbackEXT = (PFN_vkDebugReportCallbackEXT) vkelGetDeviceProcAddr(device, "vkDebugReportCallbackEXT");
-	__vkDebugReportMessageEXT = (PFN_vkDebugReportMessageEXT) vkelGetDeviceProcAddr(device, "vkDebugReportMessageEXT");
-	__vkDestroyBuffer = (PFN_vkDestroyBuffer) vkelGetDeviceProcAddr(device, "vkDestroyBuffer");
-	__vkDestroyBufferView = (PFN_vkDestroyBufferView) vkelGetDeviceProcAddr(device, "vkDestroyBufferView");
-	__vkDestroyCommandPool = (PFN_vkDestroyCommandPool) vkelGetDeviceProcAddr(device, "vkDestroyCommandPool");
-	__vkDestroyDebugReportCallbackEXT = (PFN_vkDestroyDebugReportCallbackEXT) vkelGetDeviceProcAddr(device, "vkDestroyDebugReportCallbackEXT");
-	__vkDestroyDescriptorPool = (PFN_vkDestroyDescriptorPool) vkelGetDeviceProcAddr(device, "vkDestroyDescriptorPool");
-	__vkDestroyDescriptorSetLayout = (PFN_vkDestroyDescriptorSetLayout) vkelGetDeviceProcAddr(device, "vkDestroyDescriptorSetLayout");
-	__vkDestroyDevice = (PFN_vkDestroyDevice) vkelGetDeviceProcAddr(device, "vkDestroyDevice");
-	__vkDestroyEvent = (PFN_vkDestroyEvent) vkelGetDeviceProcAddr(device, "vkDestroyEvent");
-	__vkDestroyFence = (PFN_vkDestroyFence) vkelGetDeviceProcAddr(device, "vkDestroyFence");
-	__vkDestroyFramebuffer = (PFN_vkDestroyFramebuffer) vkelGetDeviceProcAddr(device, "vkDestroyFramebuffer");
-	__vkDestroyImage = (PFN_vkDestroyImage) vkelGetDeviceProcAddr(device, "vkDestroyImage");
-	__vkDestroyImageView = (PFN_vkDestroyImageView) vkelGetDeviceProcAddr(device, "vkDestroyImageView");
-	__vkDestroyInstance = (PFN_vkDestroyInstance) vkelGetDeviceProcAddr(device, "vkDestroyInstance");
-	__vkDestroyPipeline = (PFN_vkDestroyPipeline) vkelGetDeviceProcAddr(device, "vkDestroyPipeline");
-	__vkDestroyPipelineCache = (PFN_vkDestroyPipelineCache) vkelGetDeviceProcAddr(device, "vkDestroyPipelineCache");
-	__vkDestroyPipelineLayout = (PFN_vkDestroyPipelineLayout) vkelGetDeviceProcAddr(device, "vkDestroyPipelineLayout");
-	__vkDestroyQueryPool = (PFN_vkDestroyQueryPool) vkelGetDeviceProcAddr(device, "vkDestroyQueryPool");
-	__vkDestroyRenderPass = (PFN_vkDestroyRenderPass) vkelGetDeviceProcAddr(device, "vkDestroyRenderPass");
-	__vkDestroySampler = (PFN_vkDestroySampler) vkelGetDeviceProcAddr(device, "vkDestroySampler");
-	__vkDestroySemaphore = (PFN_vkDestroySemaphore) vkelGetDeviceProcAddr(device, "vkDestroySemaphore");
-	__vkDestroyShaderModule = (PFN_vkDestroyShaderModule) vkelGetDeviceProcAddr(device, "vkDestroyShaderModule");
-	__vkDestroySurfaceKHR = (PFN_vkDestroySurfaceKHR) vkelGetDeviceProcAddr(device, "vkDestroySurfaceKHR");
-	__vkDestroySwapchainKHR = (PFN_vkDestroySwapchainKHR) vkelGetDeviceProcAddr(device, "vkDestroySwapchainKHR");
-	__vkDeviceWaitIdle = (PFN_vkDeviceWaitIdle) vkelGetDeviceProcAddr(device, "vkDeviceWaitIdle");
-	__vkEndCommandBuffer = (PFN_vkEndCommandBuffer) vkelGetDeviceProcAddr(device, "vkEndCommandBuffer");
-	__vkEnumerateDeviceExtensionProperties = (PFN_vkEnumerateDeviceExtensionProperties) vkelGetDeviceProcAddr(device, "vkEnumerateDeviceExtensionProperties");
-	__vkEnumerateDeviceLayerProperties = (PFN_vkEnumerateDeviceLayerProperties) vkelGetDeviceProcAddr(device, "vkEnumerateDeviceLayerProperties");
-	__vkEnumerateInstanceExtensionProperties = (PFN_vkEnumerateInstanceExtensionProperties) vkelGetDeviceProcAddr(device, "vkEnumerateInstanceExtensionProperties");
-	__vkEnumerateInstanceLayerProperties = (PFN_vkEnumerateInstanceLayerProperties) vkelGetDeviceProcAddr(device, "vkEnumerateInstanceLayerProperties");
-	__vkEnumeratePhysicalDevices = (PFN_vkEnumeratePhysicalDevices) vkelGetDeviceProcAddr(device, "vkEnumeratePhysicalDevices");
-	__vkFlushMappedMemoryRanges = (PFN_vkFlushMappedMemoryRanges) vkelGetDeviceProcAddr(device, "vkFlushMappedMemoryRanges");
-	__vkFreeCommandBuffers = (PFN_vkFreeCommandBuffers) vkelGetDeviceProcAddr(device, "vkFreeCommandBuffers");
-	__vkFreeDescriptorSets = (PFN_vkFreeDescriptorSets) vkelGetDeviceProcAddr(device, "vkFreeDescriptorSets");
-	__vkFreeFunction = (PFN_vkFreeFunction) vkelGetDeviceProcAddr(device, "vkFreeFunction");
-	__vkFreeMemory = (PFN_vkFreeMemory) vkelGetDeviceProcAddr(device, "vkFreeMemory");
-	__vkGetBufferMemoryRequirements = (PFN_vkGetBufferMemoryRequirements) vkelGetDeviceProcAddr(device, "vkGetBufferMemoryRequirements");
-	__vkGetDeviceMemoryCommitment = (PFN_vkGetDeviceMemoryCommitment) vkelGetDeviceProcAddr(device, "vkGetDeviceMemoryCommitment");
-	__vkGetDeviceProcAddr = (PFN_vkGetDeviceProcAddr) vkelGetDeviceProcAddr(device, "vkGetDeviceProcAddr");
-	__vkGetDeviceQueue = (PFN_vkGetDeviceQueue) vkelGetDeviceProcAddr(device, "vkGetDeviceQueue");
-	__vkGetDisplayModePropertiesKHR = (PFN_vkGetDisplayModePropertiesKHR) vkelGetDeviceProcAddr(device, "vkGetDisplayModePropertiesKHR");
-	__vkGetDisplayPlaneCapabilitiesKHR = (PFN_vkGetDisplayPlaneCapabilitiesKHR) vkelGetDeviceProcAddr(device, "vkGetDisplayPlaneCapabilitiesKHR");
-	__vkGetDisplayPlaneSupportedDisplaysKHR = (PFN_vkGetDisplayPlaneSupportedDisplaysKHR) vkelGetDeviceProcAddr(device, "vkGetDisplayPlaneSupportedDisplaysKHR");
-	__vkGetEventStatus = (PFN_vkGetEventStatus) vkelGetDeviceProcAddr(device, "vkGetEventStatus");
-	__vkGetFenceStatus = (PFN_vkGetFenceStatus) vkelGetDeviceProcAddr(device, "vkGetFenceStatus");
-	__vkGetImageMemoryRequirements = (PFN_vkGetImageMemoryRequirements) vkelGetDeviceProcAddr(device, "vkGetImageMemoryRequirements");
-	__vkGetImageSparseMemoryRequirements = (PFN_vkGetImageSparseMemoryRequirements) vkelGetDeviceProcAddr(device, "vkGetImageSparseMemoryRequirements");
-	__vkGetImageSubresourceLayout = (PFN_vkGetImageSubresourceLayout) vkelGetDeviceProcAddr(device, "vkGetImageSubresourceLayout");
-	__vkGetInstanceProcAddr = (PFN_vkGetInstanceProcAddr) vkelGetDeviceProcAddr(device, "vkGetInstanceProcAddr");
-	__vkGetPhysicalDeviceDisplayPlanePropertiesKHR = (PFN_vkGetPhysicalDeviceDisplayPlanePropertiesKHR) vkelGetDeviceProcAddr(device, "vkGetPhysicalDeviceDisplayPlanePropertiesKHR");
-	__vkGetPhysicalDeviceDisplayPropertiesKHR = (PFN_vkGetPhysicalDeviceDisplayPropertiesKHR) vkelGetDeviceProcAddr(device, "vkGetPhysicalDeviceDisplayPropertiesKHR");
-	__vkGetPhysicalDeviceFeatures = (PFN_vkGetPhysicalDeviceFeatures) vkelGetDeviceProcAddr(device, "vkGetPhysicalDeviceFeatures");
-	__vkGetPhysicalDeviceFormatProperties = (PFN_vkGetPhysicalDeviceFormatProperties) vkelGetDeviceProcAddr(device, "vkGetPhysicalDeviceFormatProperties");
-	__vkGetPhysicalDeviceImageFormatProperties = (PFN_vkGetPhysicalDeviceImageFormatProperties) vkelGetDeviceProcAddr(device, "vkGetPhysicalDeviceImageFormatProperties");
-	__vkGetPhysicalDeviceMemoryProperties = (PFN_vkGetPhysicalDeviceMemoryProperties) vkelGetDeviceProcAddr(device, "vkGetPhysicalDeviceMemoryProperties");
-	__vkGetPhysicalDeviceProperties = (PFN_vkGetPhysicalDeviceProperties) vkelGetDeviceProcAddr(device, "vkGetPhysicalDeviceProperties");
-	__vkGetPhysicalDeviceQueueFamilyProperties = (PFN_vkGetPhysicalDeviceQueueFamilyProperties) vkelGetDeviceProcAddr(device, "vkGetPhysicalDeviceQueueFamilyProperties");
-	__vkGetPhysicalDeviceSparseImageFormatProperties = (PFN_vkGetPhysicalDeviceSparseImageFormatProperties) vkelGetDeviceProcAddr(device, "vkGetPhysicalDeviceSparseImageFormatProperties");
-	__vkGetPhysicalDeviceSurfaceCapabilitiesKHR = (PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR) vkelGetDeviceProcAddr(device, "vkGetPhysicalDeviceSurfaceCapabilitiesKHR");
-	__vkGetPhysicalDeviceSurfaceFormatsKHR = (PFN_vkGetPhysicalDeviceSurfaceFormatsKHR) vkelGetDeviceProcAddr(device, "vkGetPhysicalDeviceSurfaceFormatsKHR");
-	__vkGetPhysicalDeviceSurfacePresentModesKHR = (PFN_vkGetPhysicalDeviceSurfacePresentModesKHR) vkelGetDeviceProcAddr(device, "vkGetPhysicalDeviceSurfacePresentModesKHR");
-	__vkGetPhysicalDeviceSurfaceSupportKHR = (PFN_vkGetPhysicalDeviceSurfaceSupportKHR) vkelGetDeviceProcAddr(device, "vkGetPhysicalDeviceSurfaceSupportKHR");
-	__vkGetPipelineCacheData = (PFN_vkGetPipelineCacheData) vkelGetDeviceProcAddr(device, "vkGetPipelineCacheData");
-	__vkGetQueryPoolResults = (PFN_vkGetQueryPoolResults) vkelGetDeviceProcAddr(device, "vkGetQueryPoolResults");
-	__vkGetRenderAreaGranularity = (PFN_vkGetRenderAreaGranularity) vkelGetDeviceProcAddr(device, "vkGetRenderAreaGranularity");
-	__vkGetSwapchainImagesKHR = (PFN_vkGetSwapchainImagesKHR) vkelGetDeviceProcAddr(device, "vkGetSwapchainImagesKHR");
-	__vkInternalAllocationNotification = (PFN_vkInternalAllocationNotification) vkelGetDeviceProcAddr(device, "vkInternalAllocationNotification");
-	__vkInternalFreeNotification = (PFN_vkInternalFreeNotification) vkelGetDeviceProcAddr(device, "vkInternalFreeNotification");
-	__vkInvalidateMappedMemoryRanges = (PFN_vkInvalidateMappedMemoryRanges) vkelGetDeviceProcAddr(device, "vkInvalidateMappedMemoryRanges");
-	__vkMapMemory = (PFN_vkMapMemory) vkelGetDeviceProcAddr(device, "vkMapMemory");
-	__vkMergePipelineCaches = (PFN_vkMergePipelineCaches) vkelGetDeviceProcAddr(device, "vkMergePipelineCaches");
-	__vkQueueBindSparse = (PFN_vkQueueBindSparse) vkelGetDeviceProcAddr(device, "vkQueueBindSparse");
-	__vkQueuePresentKHR = (PFN_vkQueuePresentKHR) vkelGetDeviceProcAddr(device, "vkQueuePresentKHR");
-	__vkQueueSubmit = (PFN_vkQueueSubmit) vkelGetDeviceProcAddr(device, "vkQueueSubmit");
-	__vkQueueWaitIdle = (PFN_vkQueueWaitIdle) vkelGetDeviceProcAddr(device, "vkQueueWaitIdle");
-	__vkReallocationFunction = (PFN_vkReallocationFunction) vkelGetDeviceProcAddr(device, "vkReallocationFunction");
-	__vkResetCommandBuffer = (PFN_vkResetCommandBuffer) vkelGetDeviceProcAddr(device, "vkResetCommandBuffer");
-	__vkResetCommandPool = (PFN_vkResetCommandPool) vkelGetDeviceProcAddr(device, "vkResetCommandPool");
-	__vkResetDescriptorPool = (PFN_vkResetDescriptorPool) vkelGetDeviceProcAddr(device, "vkResetDescriptorPool");
-	__vkResetEvent = (PFN_vkResetEvent) vkelGetDeviceProcAddr(device, "vkResetEvent");
-	__vkResetFences = (PFN_vkResetFences) vkelGetDeviceProcAddr(device, "vkResetFences");
-	__vkSetEvent = (PFN_vkSetEvent) vkelGetDeviceProcAddr(device, "vkSetEvent");
-	__vkUnmapMemory = (PFN_vkUnmapMemory) vkelGetDeviceProcAddr(device, "vkUnmapMemory");
-	__vkUpdateDescriptorSets = (PFN_vkUpdateDescriptorSets) vkelGetDeviceProcAddr(device, "vkUpdateDescriptorSets");
-	__vkVoidFunction = (PFN_vkVoidFunction) vkelGetDeviceProcAddr(device, "vkVoidFunction");
-	__vkWaitForFences = (PFN_vkWaitForFences) vkelGetDeviceProcAddr(device, "vkWaitForFences");
-
-#ifdef VK_USE_PLATFORM_ANDROID_KHR
-	__vkCreateAndroidSurfaceKHR = (PFN_vkCreateAndroidSurfaceKHR) vkelGetDeviceProcAddr(device, "vkCreateAndroidSurfaceKHR");
-#endif /* VK_USE_PLATFORM_ANDROID_KHR */
-
-#ifdef VK_USE_PLATFORM_MIR_KHR
-	__vkCreateMirSurfaceKHR = (PFN_vkCreateMirSurfaceKHR) vkelGetDeviceProcAddr(device, "vkCreateMirSurfaceKHR");
-	__vkGetPhysicalDeviceMirPresentationSupportKHR = (PFN_vkGetPhysicalDeviceMirPresentationSupportKHR) vkelGetDeviceProcAddr(device, "vkGetPhysicalDeviceMirPresentationSupportKHR");
-#endif /* VK_USE_PLATFORM_MIR_KHR */
-
-#ifdef VK_USE_PLATFORM_WAYLAND_KHR
-	__vkCreateWaylandSurfaceKHR = (PFN_vkCreateWaylandSurfaceKHR) vkelGetDeviceProcAddr(device, "vkCreateWaylandSurfaceKHR");
-	__vkGetPhysicalDeviceWaylandPresentationSupportKHR = (PFN_vkGetPhysicalDeviceWaylandPresentationSupportKHR) vkelGetDeviceProcAddr(device, "vkGetPhysicalDeviceWaylandPresentationSupportKHR");
-#endif /* VK_USE_PLATFORM_WAYLAND_KHR */
+	vkelGetContextSupport(context, physicalDevice, &context->deviceCapabilities);
+	
+	
+	return VK_TRUE;
+}
 
-#ifdef VK_USE_PLATFORM_WIN32_KHR
-	__vkCreateWin32SurfaceKHR = (PFN_vkCreateWin32SurfaceKHR) vkelGetDeviceProcAddr(device, "vkCreateWin32SurfaceKHR");
-	__vkGetPhysicalDeviceWin32PresentationSupportKHR = (PFN_vkGetPhysicalDeviceWin32PresentationSupportKHR) vkelGetDeviceProcAddr(device, "vkGetPhysicalDeviceWin32PresentationSupportKHR");
-#endif /* VK_USE_PLATFORM_WIN32_KHR */
+void vkelDestroyContext(VkelContext context)
+{
+	if (!context)
+		return;
+	
+	vkelPlatformCloseLibrary(context->libraryHandle);
+	
+	vkel_free(context);
+}
 
-#ifdef VK_USE_PLATFORM_XCB_KHR
-	__vkCreateXcbSurfaceKHR = (PFN_vkCreateXcbSurfaceKHR) vkelGetDeviceProcAddr(device, "vkCreateXcbSurfaceKHR");
-	__vkGetPhysicalDeviceXcbPresentationSupportKHR = (PFN_vkGetPhysicalDeviceXcbPresentationSupportKHR) vkelGetDeviceProcAddr(device, "vkGetPhysicalDeviceXcbPresentationSupportKHR");
-#endif /* VK_USE_PLATFORM_XCB_KHR */
+const VkelTable* vkelGetContextTable(VkelContext context)
+{
+	assert(context);
+	
+	return &context->table;
+}
 
-#ifdef VK_USE_PLATFORM_XLIB_KHR
-	__vkCreateXlibSurfaceKHR = (PFN_vkCreateXlibSurfaceKHR) vkelGetDeviceProcAddr(device, "vkCreateXlibSurfaceKHR");
-	__vkGetPhysicalDeviceXlibPresentationSupportKHR = (PFN_vkGetPhysicalDeviceXlibPresentationSupportKHR) vkelGetDeviceProcAddr(device, "vkGetPhysicalDeviceXlibPresentationSupportKHR");
-#endif /* VK_USE_PLATFORM_XLIB_KHR */
+const VkelCapabilities* vkelGetContextInstanceCapabilities(VkelContext context)
+{
+	assert(context);
+	
+	return &context->instanceCapabilities;
+}
 
+const VkelCapabilities* vkelGetContextDeviceCapabilities(VkelContext context)
+{
+	assert(context);
+	
+	return &context->deviceCapabilities;
+}
 
-	// Instance and device extension names
-	VKEL_AMD_gcn_shader = vkelIsDeviceExtensionSupported(physicalDevice, NULL, "VK_AMD_gcn_shader");
-	VKEL_AMD_rasterization_order = vkelIsDeviceExtensionSupported(physicalDevice, NULL, "VK_AMD_rasterization_order");
-	VKEL_AMD_shader_explicit_vertex_parameter = vkelIsDeviceExtensionSupported(physicalDevice, NULL, "VK_AMD_shader_explicit_vertex_parameter");
-	VKEL_AMD_shader_trinary_minmax = vkelIsDeviceExtensionSupported(physicalDevice, NULL, "VK_AMD_shader_trinary_minmax");
-	VKEL_EXT_debug_marker = vkelIsDeviceExtensionSupported(physicalDevice, NULL, "VK_EXT_debug_marker");
-	VKEL_EXT_debug_report = vkelIsDeviceExtensionSupported(physicalDevice, NULL, "VK_EXT_debug_report");
-	VKEL_IMG_filter_cubic = vkelIsDeviceExtensionSupported(physicalDevice, NULL, "VK_IMG_filter_cubic");
-	VKEL_IMG_format_pvrtc = vkelIsDeviceExtensionSupported(physicalDevice, NULL, "VK_IMG_format_pvrtc");
-	VKEL_KHR_android_surface = vkelIsDeviceExtensionSupported(physicalDevice, NULL, "VK_KHR_android_surface");
-	VKEL_KHR_display = vkelIsDeviceExtensionSupported(physicalDevice, NULL, "VK_KHR_display");
-	VKEL_KHR_display_swapchain = vkelIsDeviceExtensionSupported(physicalDevice, NULL, "VK_KHR_display_swapchain");
-	VKEL_KHR_mir_surface = vkelIsDeviceExtensionSupported(physicalDevice, NULL, "VK_KHR_mir_surface");
-	VKEL_KHR_sampler_mirror_clamp_to_edge = vkelIsDeviceExtensionSupported(physicalDevice, NULL, "VK_KHR_sampler_mirror_clamp_to_edge");
-	VKEL_KHR_surface = vkelIsDeviceExtensionSupported(physicalDevice, NULL, "VK_KHR_surface");
-	VKEL_KHR_swapchain = vkelIsDeviceExtensionSupported(physicalDevice, NULL, "VK_KHR_swapchain");
-	VKEL_KHR_wayland_surface = vkelIsDeviceExtensionSupported(physicalDevice, NULL, "VK_KHR_wayland_surface");
-	VKEL_KHR_win32_surface = vkelIsDeviceExtensionSupported(physicalDevice, NULL, "VK_KHR_win32_surface");
-	VKEL_KHR_xcb_surface = vkelIsDeviceExtensionSupported(physicalDevice, NULL, "VK_KHR_xcb_surface");
-	VKEL_KHR_xlib_surface = vkelIsDeviceExtensionSupported(physicalDevice, NULL, "VK_KHR_xlib_surface");
-	VKEL_NV_dedicated_allocation = vkelIsDeviceExtensionSupported(physicalDevice, NULL, "VK_NV_dedicated_allocation");
-	VKEL_NV_glsl_shader = vkelIsDeviceExtensionSupported(physicalDevice, NULL, "VK_NV_glsl_shader");
-
-	// Instance and device layer names
-	VKEL_LAYER_GOOGLE_unique_objects = vkelIsDeviceLayerSupported(physicalDevice, "VK_LAYER_GOOGLE_unique_objects");
-	VKEL_LAYER_LUNARG_api_dump = vkelIsDeviceLayerSupported(physicalDevice, "VK_LAYER_LUNARG_api_dump");
-	VKEL_LAYER_LUNARG_device_limits = vkelIsDeviceLayerSupported(physicalDevice, "VK_LAYER_LUNARG_device_limits");
-	VKEL_LAYER_LUNARG_draw_state = vkelIsDeviceLayerSupported(physicalDevice, "VK_LAYER_LUNARG_draw_state");
-	VKEL_LAYER_LUNARG_image = vkelIsDeviceLayerSupported(physicalDevice, "VK_LAYER_LUNARG_image");
-	VKEL_LAYER_LUNARG_mem_tracker = vkelIsDeviceLayerSupported(physicalDevice, "VK_LAYER_LUNARG_mem_tracker");
-	VKEL_LAYER_LUNARG_object_tracker = vkelIsDeviceLayerSupported(physicalDevice, "VK_LAYER_LUNARG_object_tracker");
-	VKEL_LAYER_LUNARG_param_checker = vkelIsDeviceLayerSupported(physicalDevice, "VK_LAYER_LUNARG_param_checker");
-	VKEL_LAYER_LUNARG_screenshot = vkelIsDeviceLayerSupported(physicalDevice, "VK_LAYER_LUNARG_screenshot");
-	VKEL_LAYER_LUNARG_swapchain = vkelIsDeviceLayerSupported(physicalDevice, "VK_LAYER_LUNARG_swapchain");
-	VKEL_LAYER_LUNARG_threading = vkelIsDeviceLayerSupported(physicalDevice, "VK_LAYER_LUNARG_threading");
-	VKEL_LAYER_LUNARG_vktrace = vkelIsDeviceLayerSupported(physicalDevice, "VK_LAYER_LUNARG_vktrace");
 
+typedef struct VkelProbeJob
+{
+	uint32_t physicalDeviceCount;
+	const VkPhysicalDevice *pPhysicalDevices;
+	VkelPhysicalDeviceProbe *pProbes;
+	
+	// The next physical device to probe, shared by the threads
+	volatile uint64_t nextIndex;
+	
+	// Every function the probing threads call, taken from vkelTable on the calling thread.
+	// vkelInstanceInit() can be loading vkelTable meanwhile, so the threads never read it.
+	VkelEnumerateProcs enumerateProcs;
+	PFN_vkGetPhysicalDeviceProperties getPhysicalDeviceProperties;
+	PFN_vkGetPhysicalDeviceMemoryProperties getPhysicalDeviceMemoryProperties;
+	PFN_vkGetPhysicalDeviceQueueFamilyProperties getPhysicalDeviceQueueFamilyProperties;
+} VkelProbeJob;
+
+static VkBool32 vkelProbeWorker(void *pJob)
+{
+	VkelProbeJob *job = (VkelProbeJob*) pJob;
+	
+	for (;;)
+	{
+		uint64_t index = vkelAtomicIncrement64(&job->nextIndex) - 1;
+		
+		if (index >= job->physicalDeviceCount)
+			break;
+		
+		VkPhysicalDevice physicalDevice = job->pPhysicalDevices[index];
+		VkelPhysicalDeviceProbe *pProbe = &job->pProbes[index];
+		
+		memset(pProbe, 0, sizeof(VkelPhysicalDeviceProbe));
+		pProbe->physicalDevice = physicalDevice;
+		
+		// The enumeration cache doesn't hold its lock while enumerating
+		vkelMapPhysicalDeviceCapabilities(physicalDevice, &pProbe->capabilities, &job->enumerateProcs);
+		
+		job->getPhysicalDeviceProperties(physicalDevice, &pProbe->properties);
+		job->getPhysicalDeviceMemoryProperties(physicalDevice, &pProbe->memoryProperties);
+		
+		// VkQueueFamilyProperties is plain data, so asking for fewer than there are is fine
+		pProbe->queueFamilyCount = VKEL_MAX_QUEUE_FAMILIES;
+		job->getPhysicalDeviceQueueFamilyProperties(physicalDevice, &pProbe->queueFamilyCount, pProbe->queueFamilies);
+	}
 	
 	return VK_TRUE;
 }
-	
-void vkelUninit(void)
+
+// Releases the job
+static VkBool32 vkelProbeTask(void *pJob)
 {
-	if (vkelVkLibHandle)
+	VkelProbeJob *job = (VkelProbeJob*) pJob;
+	VkelTask workers[VKEL_PROBE_THREAD_COUNT];
+	uint32_t workerCount = 0;
+	
+	// The calling thread is one of them, and if a thread can't be created the others take over its share
+	while (((workerCount + 1) < VKEL_PROBE_THREAD_COUNT) && ((workerCount + 1) < job->physicalDeviceCount))
 	{
-		vkelPlatformCloseLibrary(vkelVkLibHandle);
-		vkelVkLibHandle = NULL;
+		workers[workerCount] = vkelStartTask(vkelProbeWorker, job);
+		
+		if (!workers[workerCount])
+			break;
+		
+		workerCount++;
 	}
+	
+	vkelProbeWorker(job);
+	
+	uint32_t workerIndex = 0;
+	for (workerIndex = 0; workerIndex < workerCount; workerIndex++)
+		vkelWaitTask(workers[workerIndex]);
+	
+	vkel_free(job);
+	
+	
+	return VK_TRUE;
+}
+
+static VkelProbeJob* vkelCreateProbeJob(uint32_t physicalDeviceCount, const VkPhysicalDevice *pPhysicalDevices, VkelPhysicalDeviceProbe *pProbes)
+{
+	assert(!physicalDeviceCount || (pPhysicalDevices && pProbes));
+	
+	if (!vkEnumerateDeviceExtensionProperties || !vkEnumerateDeviceLayerProperties)
+		return NULL;
+	
+	if (!vkGetPhysicalDeviceProperties || !vkGetPhysicalDeviceMemoryProperties || !vkGetPhysicalDeviceQueueFamilyProperties)
+		return NULL;
+	
+	VkelProbeJob *job = (VkelProbeJob*) vkel_calloc(1, sizeof(VkelProbeJob), VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+	
+	if (!job)
+		return NULL;
+	
+	job->physicalDeviceCount = physicalDeviceCount;
+	job->pPhysicalDevices = pPhysicalDevices;
+	job->pProbes = pProbes;
+	
+	job->enumerateProcs.enumerateDeviceExtensionProperties = vkEnumerateDeviceExtensionProperties;
+	job->enumerateProcs.enumerateDeviceLayerProperties = vkEnumerateDeviceLayerProperties;
+	
+	job->getPhysicalDeviceProperties = vkGetPhysicalDeviceProperties;
+	job->getPhysicalDeviceMemoryProperties = vkGetPhysicalDeviceMemoryProperties;
+	job->getPhysicalDeviceQueueFamilyProperties = vkGetPhysicalDeviceQueueFamilyProperties;
+	
+	return job;
+}
+
+VkBool32 vkelProbePhysicalDevices(uint32_t physicalDeviceCount, const VkPhysicalDevice *pPhysicalDevices, VkelPhysicalDeviceProbe *pProbes)
+{
+	VkelProbeJob *job = vkelCreateProbeJob(physicalDeviceCount, pPhysicalDevices, pProbes);
+	
+	if (!job)
+		return VK_FALSE;
+	
+	return vkelProbeTask(job);
+}
+
+VkelTask vkelProbePhysicalDevicesAsync(uint32_t physicalDeviceCount, const VkPhysicalDevice *pPhysicalDevices, VkelPhysicalDeviceProbe *pProbes)
+{
+	VkelProbeJob *job = vkelCreateProbeJob(physicalDeviceCount, pPhysicalDevices, pProbes);
+	
+	if (!job)
+		return NULL;
+	
+	VkelTask task = vkelStartTask(vkelProbeTask, job);
+	
+	if (!task)
+		vkel_free(job);
+	
+	return task;
 }
 	
 
@@ -13,6 +13,9 @@
 //     Vulkan (library)
 //     Windows (header) - needed for library loading on Windows
 //     dlfcn (header) - needed for library loading on non-Windows OS'
+//     dirent (header) - needed for vkelInitDirectICD() on non-Windows OS'
+//     pthread (header) - needed for vkelInitAsync() on non-Windows OS'
+//     fcntl, unistd (headers) - needed for vkelPrewarm() on non-Windows OS'
 //     Standard C Libraries (stdio, stdlib, string, assert) - needed for NULL, malloc()
 //                                                 calloc(), free(), memset(), assert()
 //
@@ -126,6 +129,23 @@ extern "C" {
 #endif
 
 
+// When building vkel as a shared library, define VKEL_SHARED (and VKEL_BUILD when building it)
+// and build with -fvisibility=hidden, then only the vkel* functions and vkelTable are exported
+#ifndef VKEL_API
+#	if defined(VKEL_SHARED) && defined(_WIN32)
+#		ifdef VKEL_BUILD
+#			define VKEL_API __declspec(dllexport)
+#		else
+#			define VKEL_API __declspec(dllimport)
+#		endif
+#	elif defined(VKEL_SHARED) && (defined(__GNUC__) || defined(__clang__))
+#		define VKEL_API __attribute__((visibility("default")))
+#	else
+#		define VKEL_API
+#	endif
+#endif
+
+
 #ifdef __vulkan_h_
 
 #if _MSC_VER
@@ -3084,452 +3104,1581 @@ typedef struct VkDedicatedAllocationMemoryAllocateInfoNV {
 #endif
 
 
-extern PFN_vkVoidFunction vkelGetProcAddr(const char *pName);
+extern VKEL_API PFN_vkVoidFunction vkelGetProcAddr(const char *pName);
 
-extern PFN_vkVoidFunction vkelGetInstanceProcAddr(VkInstance instance, const char *pName);
-extern PFN_vkVoidFunction vkelGetDeviceProcAddr(VkDevice device, const char *pName);
+extern VKEL_API PFN_vkVoidFunction vkelGetInstanceProcAddr(VkInstance instance, const char *pName);
+extern VKEL_API PFN_vkVoidFunction vkelGetDeviceProcAddr(VkDevice device, const char *pName);
 
 
-extern void vkelDeleteNames(uint32_t nameCount, char **names);
+// Passing NULL restores the default (malloc(), calloc() and free())
+extern VKEL_API void vkelSetAllocator(const VkAllocationCallbacks *pAllocator);
+extern VKEL_API const VkAllocationCallbacks* vkelGetAllocator(void);
 
 
-extern char** vkelGetInstanceExtensionNames(const char *pLayerName, uint32_t *extensionNameCount);
+extern VKEL_API void vkelDeleteNames(uint32_t nameCount, char **names);
+
+
+extern VKEL_API char** vkelGetInstanceExtensionNames(const char *pLayerName, uint32_t *extensionNameCount);
 #define vkelDeleteInstanceExtensionNames vkelDeleteNames
 
-extern char** vkelGetInstanceLayerNames(uint32_t *layerNameCount);
+extern VKEL_API char** vkelGetInstanceLayerNames(uint32_t *layerNameCount);
 #define vkelDeleteInstanceLayerNames vkelDeleteNames
 
 
-extern char** vkelGetDeviceExtensionNames(VkPhysicalDevice physicalDevice, const char *pLayerName, uint32_t *extensionNameCount);
+extern VKEL_API char** vkelGetDeviceExtensionNames(VkPhysicalDevice physicalDevice, const char *pLayerName, uint32_t *extensionNameCount);
 #define vkelDeleteDeviceExtensionNames vkelDeleteNames
 
-extern char** vkelGetDeviceLayerNames(VkPhysicalDevice physicalDevice, uint32_t *layerNameCount);
+extern VKEL_API char** vkelGetDeviceLayerNames(VkPhysicalDevice physicalDevice, uint32_t *layerNameCount);
 #define vkelDeleteDeviceLayerNames vkelDeleteNames
 
 
-extern VkBool32 vkelIsInstanceLayerSupported(const char *pLayerName);
-extern VkBool32 vkelIsInstanceExtensionSupported(const char *pLayerName, const char *pExtensionName);
-
-extern VkBool32 vkelIsDeviceLayerSupported(VkPhysicalDevice physicalDevice, const char *pLayerName);
-extern VkBool32 vkelIsDeviceExtensionSupported(VkPhysicalDevice physicalDevice, const char *pLayerName, const char *pExtensionName);
-
-
-extern VkBool32 vkelInit(void);
-extern VkBool32 vkelInstanceInit(VkInstance instance);
-extern VkBool32 vkelDeviceInit(VkPhysicalDevice physicalDevice, VkDevice device);
-
-extern void vkelUninit(void);
-
-
-// Instance and device extension names
-extern VkBool32 VKEL_AMD_gcn_shader;
-extern VkBool32 VKEL_AMD_rasterization_order;
-extern VkBool32 VKEL_AMD_shader_explicit_vertex_parameter;
-extern VkBool32 VKEL_AMD_shader_trinary_minmax;
-extern VkBool32 VKEL_EXT_debug_marker;
-extern VkBool32 VKEL_EXT_debug_report;
-extern VkBool32 VKEL_IMG_filter_cubic;
-extern VkBool32 VKEL_IMG_format_pvrtc;
-extern VkBool32 VKEL_KHR_android_surface;
-extern VkBool32 VKEL_KHR_display;
-extern VkBool32 VKEL_KHR_display_swapchain;
-extern VkBool32 VKEL_KHR_mir_surface;
-extern VkBool32 VKEL_KHR_sampler_mirror_clamp_to_edge;
-extern VkBool32 VKEL_KHR_surface;
-extern VkBool32 VKEL_KHR_swapchain;
-extern VkBool32 VKEL_KHR_wayland_surface;
-extern VkBool32 VKEL_KHR_win32_surface;
-extern VkBool32 VKEL_KHR_xcb_surface;
-extern VkBool32 VKEL_KHR_xlib_surface;
-extern VkBool32 VKEL_NV_dedicated_allocation;
-extern VkBool32 VKEL_NV_glsl_shader;
-
-// Instance and device layer names
-extern VkBool32 VKEL_LAYER_GOOGLE_unique_objects;
-extern VkBool32 VKEL_LAYER_LUNARG_api_dump;
-extern VkBool32 VKEL_LAYER_LUNARG_device_limits;
-extern VkBool32 VKEL_LAYER_LUNARG_draw_state;
-extern VkBool32 VKEL_LAYER_LUNARG_image;
-extern VkBool32 VKEL_LAYER_LUNARG_mem_tracker;
-extern VkBool32 VKEL_LAYER_LUNARG_object_tracker;
-extern VkBool32 VKEL_LAYER_LUNARG_param_checker;
-extern VkBool32 VKEL_LAYER_LUNARG_screenshot;
-extern VkBool32 VKEL_LAYER_LUNARG_swapchain;
-extern VkBool32 VKEL_LAYER_LUNARG_threading;
-extern VkBool32 VKEL_LAYER_LUNARG_vktrace;
+// Check several names with a single enumeration, pSupported (optional) receives
+// a VkBool32 per name. Returns the number of supported names.
+extern VKEL_API uint32_t vkelQueryInstanceLayers(uint32_t layerNameCount, const char* const *pLayerNames, VkBool32 *pSupported);
+extern VKEL_API uint32_t vkelQueryInstanceExtensions(const char *pLayerName, uint32_t extensionNameCount, const char* const *pExtensionNames, VkBool32 *pSupported);
+
+extern VKEL_API uint32_t vkelQueryDeviceLayers(VkPhysicalDevice physicalDevice, uint32_t layerNameCount, const char* const *pLayerNames, VkBool32 *pSupported);
+extern VKEL_API uint32_t vkelQueryDeviceExtensions(VkPhysicalDevice physicalDevice, const char *pLayerName, uint32_t extensionNameCount, const char* const *pExtensionNames, VkBool32 *pSupported);
+
+
+extern VKEL_API VkBool32 vkelIsInstanceLayerSupported(const char *pLayerName);
+extern VKEL_API VkBool32 vkelIsInstanceExtensionSupported(const char *pLayerName, const char *pExtensionName);
+
+extern VKEL_API VkBool32 vkelIsDeviceLayerSupported(VkPhysicalDevice physicalDevice, const char *pLayerName);
+extern VKEL_API VkBool32 vkelIsDeviceExtensionSupported(VkPhysicalDevice physicalDevice, const char *pLayerName, const char *pExtensionName);
+
+
+// Enumerated extensions and layers are remembered per physical device (VK_NULL_HANDLE for
+// the instance) and layer name, so each is only enumerated once. Invalidate them when the
+// results can change, e.g. when layers are installed or a physical device handle is reused
+// by a new instance. Safe while other threads are querying, which keep reading the results
+// they already found.
+extern VKEL_API void vkelInvalidateEnumerations(VkPhysicalDevice physicalDevice);
+extern VKEL_API void vkelInvalidateAllEnumerations(void);
+
+
+extern VKEL_API VkBool32 vkelInit(void);
+// Load an ICD directly instead of the Vulkan loader, if pManifestPath is NULL then
+// VK_ICD_FILENAMES, /usr/share/vulkan/icd.d and /etc/vulkan/icd.d are searched
+extern VKEL_API VkBool32 vkelInitDirectICD(const char *pManifestPath);
+extern VKEL_API VkBool32 vkelInstanceInit(VkInstance instance);
+extern VKEL_API VkBool32 vkelDeviceInit(VkPhysicalDevice physicalDevice, VkDevice device);
+
+extern VKEL_API void vkelUninit(void);
+
+
+// Background tasks, vkelWaitTask() must be called exactly once per task,
+// it returns the result of the task and releases the handle
+VK_DEFINE_HANDLE(VkelTask)
+
+extern VKEL_API VkelTask vkelInitAsync(void);
+
+extern VKEL_API VkBool32 vkelIsTaskComplete(VkelTask task);
+extern VKEL_API VkBool32 vkelWaitTask(VkelTask task);
+
+
+// Get the Vulkan library and the ICDs (the ones vkelInitDirectICD() would search) into the
+// page cache, so loading them doesn't page fault on cold storage (like after a reboot). It's
+// only a hint to the OS, so the earlier it's started (before vkelInit()) the better. Returns
+// VK_FALSE if no library was found.
+typedef struct VkelPrewarmStats {
+	uint32_t fileCount;
+	uint64_t byteCount;
+	// Time spent in vkelPrewarm(), not including reads still in flight
+	uint64_t nanoseconds;
+} VkelPrewarmStats;
+
+extern VKEL_API VkBool32 vkelPrewarm(void);
+extern VKEL_API VkelTask vkelPrewarmAsync(void);
+
+// Totals of all calls to vkelPrewarm() so far
+extern VKEL_API void vkelGetPrewarmStats(VkelPrewarmStats *pStats);
+
+
+#ifdef VKEL_RECORD_USAGE
+// Write the functions called through the vk* macros, and the extensions and layers checked
+// with vkelHasExtension() and vkelHasLayer(), one name per line. The file can be passed to
+// "vkel_gen.py -p <profile>" to generate a vkel.h and vkel.c with only those. The profile is
+// also written on exit when the VKEL_USAGE_PROFILE environment variable is set.
+extern VKEL_API VkBool32 vkelWriteUsageProfile(const char *pPath);
+#endif /* VKEL_RECORD_USAGE */
+
+
+// Instance and device extension names, kept for compatibility (see vkelHasExtension())
+#define VKEL_AMD_gcn_shader vkelHasExtension(VKEL_EXT_ID_AMD_gcn_shader)
+#define VKEL_AMD_rasterization_order vkelHasExtension(VKEL_EXT_ID_AMD_rasterization_order)
+#define VKEL_AMD_shader_explicit_vertex_parameter vkelHasExtension(VKEL_EXT_ID_AMD_shader_explicit_vertex_parameter)
+#define VKEL_AMD_shader_trinary_minmax vkelHasExtension(VKEL_EXT_ID_AMD_shader_trinary_minmax)
+#define VKEL_EXT_debug_marker vkelHasExtension(VKEL_EXT_ID_EXT_debug_marker)
+#define VKEL_EXT_debug_report vkelHasExtension(VKEL_EXT_ID_EXT_debug_report)
+#define VKEL_IMG_filter_cubic vkelHasExtension(VKEL_EXT_ID_IMG_filter_cubic)
+#define VKEL_IMG_format_pvrtc vkelHasExtension(VKEL_EXT_ID_IMG_format_pvrtc)
+#define VKEL_KHR_android_surface vkelHasExtension(VKEL_EXT_ID_KHR_android_surface)
+#define VKEL_KHR_display vkelHasExtension(VKEL_EXT_ID_KHR_display)
+#define VKEL_KHR_display_swapchain vkelHasExtension(VKEL_EXT_ID_KHR_display_swapchain)
+#define VKEL_KHR_mir_surface vkelHasExtension(VKEL_EXT_ID_KHR_mir_surface)
+#define VKEL_KHR_sampler_mirror_clamp_to_edge vkelHasExtension(VKEL_EXT_ID_KHR_sampler_mirror_clamp_to_edge)
+#define VKEL_KHR_surface vkelHasExtension(VKEL_EXT_ID_KHR_surface)
+#define VKEL_KHR_swapchain vkelHasExtension(VKEL_EXT_ID_KHR_swapchain)
+#define VKEL_KHR_wayland_surface vkelHasExtension(VKEL_EXT_ID_KHR_wayland_surface)
+#define VKEL_KHR_win32_surface vkelHasExtension(VKEL_EXT_ID_KHR_win32_surface)
+#define VKEL_KHR_xcb_surface vkelHasExtension(VKEL_EXT_ID_KHR_xcb_surface)
+#define VKEL_KHR_xlib_surface vkelHasExtension(VKEL_EXT_ID_KHR_xlib_surface)
+#define VKEL_NV_dedicated_allocation vkelHasExtension(VKEL_EXT_ID_NV_dedicated_allocation)
+#define VKEL_NV_glsl_shader vkelHasExtension(VKEL_EXT_ID_NV_glsl_shader)
+
+// Instance and device layer names, kept for compatibility (see vkelHasLayer())
+#define VKEL_LAYER_GOOGLE_unique_objects vkelHasLayer(VKEL_LAYER_ID_GOOGLE_unique_objects)
+#define VKEL_LAYER_LUNARG_api_dump vkelHasLayer(VKEL_LAYER_ID_LUNARG_api_dump)
+#define VKEL_LAYER_LUNARG_device_limits vkelHasLayer(VKEL_LAYER_ID_LUNARG_device_limits)
+#define VKEL_LAYER_LUNARG_draw_state vkelHasLayer(VKEL_LAYER_ID_LUNARG_draw_state)
+#define VKEL_LAYER_LUNARG_image vkelHasLayer(VKEL_LAYER_ID_LUNARG_image)
+#define VKEL_LAYER_LUNARG_mem_tracker vkelHasLayer(VKEL_LAYER_ID_LUNARG_mem_tracker)
+#define VKEL_LAYER_LUNARG_object_tracker vkelHasLayer(VKEL_LAYER_ID_LUNARG_object_tracker)
+#define VKEL_LAYER_LUNARG_param_checker vkelHasLayer(VKEL_LAYER_ID_LUNARG_param_checker)
+#define VKEL_LAYER_LUNARG_screenshot vkelHasLayer(VKEL_LAYER_ID_LUNARG_screenshot)
+#define VKEL_LAYER_LUNARG_swapchain vkelHasLayer(VKEL_LAYER_ID_LUNARG_swapchain)
+#define VKEL_LAYER_LUNARG_threading vkelHasLayer(VKEL_LAYER_ID_LUNARG_threading)
+#define VKEL_LAYER_LUNARG_vktrace vkelHasLayer(VKEL_LAYER_ID_LUNARG_vktrace)
+
+
+// Instance and device extension IDs
+typedef enum VkelExtensionId {
+	VKEL_EXT_ID_KHR_surface = 0,
+	VKEL_EXT_ID_KHR_swapchain = 1,
+	VKEL_EXT_ID_KHR_display = 2,
+	VKEL_EXT_ID_KHR_display_swapchain = 3,
+	VKEL_EXT_ID_KHR_xlib_surface = 4,
+	VKEL_EXT_ID_KHR_xcb_surface = 5,
+	VKEL_EXT_ID_KHR_wayland_surface = 6,
+	VKEL_EXT_ID_KHR_mir_surface = 7,
+	VKEL_EXT_ID_KHR_android_surface = 8,
+	VKEL_EXT_ID_KHR_win32_surface = 9,
+	VKEL_EXT_ID_KHR_sampler_mirror_clamp_to_edge = 10,
+	VKEL_EXT_ID_EXT_debug_report = 11,
+	VKEL_EXT_ID_NV_glsl_shader = 12,
+	VKEL_EXT_ID_IMG_filter_cubic = 13,
+	VKEL_EXT_ID_AMD_rasterization_order = 14,
+	VKEL_EXT_ID_AMD_shader_trinary_minmax = 15,
+	VKEL_EXT_ID_AMD_shader_explicit_vertex_parameter = 16,
+	VKEL_EXT_ID_EXT_debug_marker = 17,
+	VKEL_EXT_ID_AMD_gcn_shader = 18,
+	VKEL_EXT_ID_NV_dedicated_allocation = 19,
+	VKEL_EXT_ID_IMG_format_pvrtc = 20,
+	VKEL_EXT_ID_COUNT = 21
+} VkelExtensionId;
+
+// Instance and device layer IDs
+typedef enum VkelLayerId {
+	VKEL_LAYER_ID_LUNARG_api_dump = 0,
+	VKEL_LAYER_ID_LUNARG_device_limits = 1,
+	VKEL_LAYER_ID_LUNARG_draw_state = 2,
+	VKEL_LAYER_ID_LUNARG_image = 3,
+	VKEL_LAYER_ID_LUNARG_mem_tracker = 4,
+	VKEL_LAYER_ID_LUNARG_object_tracker = 5,
+	VKEL_LAYER_ID_LUNARG_param_checker = 6,
+	VKEL_LAYER_ID_LUNARG_screenshot = 7,
+	VKEL_LAYER_ID_LUNARG_swapchain = 8,
+	VKEL_LAYER_ID_LUNARG_threading = 9,
+	VKEL_LAYER_ID_GOOGLE_unique_objects = 10,
+	VKEL_LAYER_ID_LUNARG_vktrace = 11,
+	VKEL_LAYER_ID_COUNT = 12
+} VkelLayerId;
+
+
+#define VKEL_EXT_WORD_COUNT 1
+#define VKEL_LAYER_WORD_COUNT 1
+
+// The returned names are interned, the same ID always gives the same pointer
+extern VKEL_API const char* vkelGetExtensionName(VkelExtensionId extensionId);
+extern VKEL_API const char* vkelGetLayerName(VkelLayerId layerId);
+
+// Returns VKEL_EXT_ID_COUNT or VKEL_LAYER_ID_COUNT for unknown names
+extern VKEL_API VkelExtensionId vkelFindExtensionId(const char *pExtensionName);
+extern VKEL_API VkelLayerId vkelFindLayerId(const char *pLayerName);
+
+// Bitset of supported extensions and layers, indexed by their IDs
+typedef struct VkelCapabilities {
+	uint32_t extensions[VKEL_EXT_WORD_COUNT];
+	uint32_t layers[VKEL_LAYER_WORD_COUNT];
+} VkelCapabilities;
+
+#define vkelCapabilitiesHasExtension(pCapabilities, extensionId) ((((pCapabilities)->extensions[(uint32_t) (extensionId) / 32]) >> ((uint32_t) (extensionId) % 32)) & 1)
+#define vkelCapabilitiesHasLayer(pCapabilities, layerId) ((((pCapabilities)->layers[(uint32_t) (layerId) / 32]) >> ((uint32_t) (layerId) % 32)) & 1)
+
+// Updated by vkelInit() and vkelInstanceInit()
+extern VKEL_API const VkelCapabilities* vkelGetInstanceCapabilities(void);
+// Those of the device of the last vkelDeviceInit(), retired along with it (see vkelQuiescent())
+extern VKEL_API const VkelCapabilities* vkelGetDeviceCapabilities(void);
+
+extern VKEL_API void vkelGetPhysicalDeviceCapabilities(VkPhysicalDevice physicalDevice, VkelCapabilities *pCapabilities);
+
+// pCapabilities &= pOther, pCapabilities |= pOther and pCapabilities == pOther
+extern VKEL_API void vkelIntersectCapabilities(VkelCapabilities *pCapabilities, const VkelCapabilities *pOther);
+extern VKEL_API void vkelUniteCapabilities(VkelCapabilities *pCapabilities, const VkelCapabilities *pOther);
+extern VKEL_API VkBool32 vkelCompareCapabilities(const VkelCapabilities *pCapabilities, const VkelCapabilities *pOther);
+
+// Check the instance and (if vkelDeviceInit() was called) the device capabilities
+extern VKEL_API VkBool32 vkelHasExtension(VkelExtensionId extensionId);
+extern VKEL_API VkBool32 vkelHasLayer(VkelLayerId layerId);
+
+
+#define vkelCapabilitiesAddExtension(pCapabilities, extensionId) ((pCapabilities)->extensions[(uint32_t) (extensionId) / 32] |= 1u << ((uint32_t) (extensionId) % 32))
+#define vkelCapabilitiesAddLayer(pCapabilities, layerId) ((pCapabilities)->layers[(uint32_t) (layerId) / 32] |= 1u << ((uint32_t) (layerId) % 32))
+
+// What vkelRankPhysicalDevices() looks for, zero it to accept any device
+typedef struct VkelDeviceRequirements {
+	VkelCapabilities required;
+	// Each one that's supported raises the score
+	VkelCapabilities optional;
+	// At least one queue family must support all of them
+	VkQueueFlags queueFlags;
+} VkelDeviceRequirements;
+
+typedef struct VkelRankedDevice {
+	VkPhysicalDevice physicalDevice;
+	VkPhysicalDeviceType deviceType;
+	// Sum of the device local heaps
+	VkDeviceSize deviceLocalMemorySize;
+	// The first queue family supporting all of the required queue flags
+	uint32_t queueFamilyIndex;
+	uint32_t optionalCount;
+	uint64_t score;
+} VkelRankedDevice;
+
+// Rank the physical devices meeting the requirements (NULL for none), best first. The score
+// orders them by device type (discrete, integrated, virtual, CPU), then by the number of optional
+// extensions and layers, then by device local memory, and last by having dedicated compute and
+// transfer queue families. Extensions come from the enumeration cache. Works like
+// vkEnumeratePhysicalDevices(), if pRankedDevices is too small it gets the best ones and
+// VK_INCOMPLETE is returned.
+extern VKEL_API VkResult vkelRankPhysicalDevices(VkInstance instance, const VkelDeviceRequirements *pRequirements, uint32_t *pRankedDeviceCount, VkelRankedDevice *pRankedDevices);
+
+// The best ranked physical device, or VK_NULL_HANDLE if none meets the requirements
+extern VKEL_API VkPhysicalDevice vkelSelectPhysicalDevice(VkInstance instance, const VkelDeviceRequirements *pRequirements);
+
+
+// Queue families beyond this are left out of a VkelPhysicalDeviceProbe
+#ifndef VKEL_MAX_QUEUE_FAMILIES
+#	define VKEL_MAX_QUEUE_FAMILIES 16
+#endif
 
+// Physical devices probed by each vkelProbePhysicalDevices() at the same time
+#ifndef VKEL_PROBE_THREAD_COUNT
+#	define VKEL_PROBE_THREAD_COUNT 4
+#endif
 
-// Functions
-extern PFN_vkAcquireNextImageKHR __vkAcquireNextImageKHR;
-extern PFN_vkAllocateCommandBuffers __vkAllocateCommandBuffers;
-extern PFN_vkAllocateDescriptorSets __vkAllocateDescriptorSets;
-extern PFN_vkAllocateMemory __vkAllocateMemory;
-extern PFN_vkAllocationFunction __vkAllocationFunction;
-extern PFN_vkBeginCommandBuffer __vkBeginCommandBuffer;
-extern PFN_vkBindBufferMemory __vkBindBufferMemory;
-extern PFN_vkBindImageMemory __vkBindImageMemory;
-extern PFN_vkCmdBeginQuery __vkCmdBeginQuery;
-extern PFN_vkCmdBeginRenderPass __vkCmdBeginRenderPass;
-extern PFN_vkCmdBindDescriptorSets __vkCmdBindDescriptorSets;
-extern PFN_vkCmdBindIndexBuffer __vkCmdBindIndexBuffer;
-extern PFN_vkCmdBindPipeline __vkCmdBindPipeline;
-extern PFN_vkCmdBindVertexBuffers __vkCmdBindVertexBuffers;
-extern PFN_vkCmdBlitImage __vkCmdBlitImage;
-extern PFN_vkCmdClearAttachments __vkCmdClearAttachments;
-extern PFN_vkCmdClearColorImage __vkCmdClearColorImage;
-extern PFN_vkCmdClearDepthStencilImage __vkCmdClearDepthStencilImage;
-extern PFN_vkCmdCopyBuffer __vkCmdCopyBuffer;
-extern PFN_vkCmdCopyBufferToImage __vkCmdCopyBufferToImage;
-extern PFN_vkCmdCopyImage __vkCmdCopyImage;
-extern PFN_vkCmdCopyImageToBuffer __vkCmdCopyImageToBuffer;
-extern PFN_vkCmdCopyQueryPoolResults __vkCmdCopyQueryPoolResults;
-extern PFN_vkCmdDebugMarkerBeginEXT __vkCmdDebugMarkerBeginEXT;
-extern PFN_vkCmdDebugMarkerEndEXT __vkCmdDebugMarkerEndEXT;
-extern PFN_vkCmdDebugMarkerInsertEXT __vkCmdDebugMarkerInsertEXT;
-extern PFN_vkCmdDispatch __vkCmdDispatch;
-extern PFN_vkCmdDispatchIndirect __vkCmdDispatchIndirect;
-extern PFN_vkCmdDraw __vkCmdDraw;
-extern PFN_vkCmdDrawIndexed __vkCmdDrawIndexed;
-extern PFN_vkCmdDrawIndexedIndirect __vkCmdDrawIndexedIndirect;
-extern PFN_vkCmdDrawIndirect __vkCmdDrawIndirect;
-extern PFN_vkCmdEndQuery __vkCmdEndQuery;
-extern PFN_vkCmdEndRenderPass __vkCmdEndRenderPass;
-extern PFN_vkCmdExecuteCommands __vkCmdExecuteCommands;
-extern PFN_vkCmdFillBuffer __vkCmdFillBuffer;
-extern PFN_vkCmdNextSubpass __vkCmdNextSubpass;
-extern PFN_vkCmdPipelineBarrier __vkCmdPipelineBarrier;
-extern PFN_vkCmdPushConstants __vkCmdPushConstants;
-extern PFN_vkCmdResetEvent __vkCmdResetEvent;
-extern PFN_vkCmdResetQueryPool __vkCmdResetQueryPool;
-extern PFN_vkCmdResolveImage __vkCmdResolveImage;
-extern PFN_vkCmdSetBlendConstants __vkCmdSetBlendConstants;
-extern PFN_vkCmdSetDepthBias __vkCmdSetDepthBias;
-extern PFN_vkCmdSetDepthBounds __vkCmdSetDepthBounds;
-extern PFN_vkCmdSetEvent __vkCmdSetEvent;
-extern PFN_vkCmdSetLineWidth __vkCmdSetLineWidth;
-extern PFN_vkCmdSetScissor __vkCmdSetScissor;
-extern PFN_vkCmdSetStencilCompareMask __vkCmdSetStencilCompareMask;
-extern PFN_vkCmdSetStencilReference __vkCmdSetStencilReference;
-extern PFN_vkCmdSetStencilWriteMask __vkCmdSetStencilWriteMask;
-extern PFN_vkCmdSetViewport __vkCmdSetViewport;
-extern PFN_vkCmdUpdateBuffer __vkCmdUpdateBuffer;
-extern PFN_vkCmdWaitEvents __vkCmdWaitEvents;
-extern PFN_vkCmdWriteTimestamp __vkCmdWriteTimestamp;
-extern PFN_vkCreateBuffer __vkCreateBuffer;
-extern PFN_vkCreateBufferView __vkCreateBufferView;
-extern PFN_vkCreateCommandPool __vkCreateCommandPool;
-extern PFN_vkCreateComputePipelines __vkCreateComputePipelines;
-extern PFN_vkCreateDebugReportCallbackEXT __vkCreateDebugReportCallbackEXT;
-extern PFN_vkCreateDescriptorPool __vkCreateDescriptorPool;
-extern PFN_vkCreateDescriptorSetLayout __vkCreateDescriptorSetLayout;
-extern PFN_vkCreateDevice __vkCreateDevice;
-extern PFN_vkCreateDisplayModeKHR __vkCreateDisplayModeKHR;
-extern PFN_vkCreateDisplayPlaneSurfaceKHR __vkCreateDisplayPlaneSurfaceKHR;
-extern PFN_vkCreateEvent __vkCreateEvent;
-extern PFN_vkCreateFence __vkCreateFence;
-extern PFN_vkCreateFramebuffer __vkCreateFramebuffer;
-extern PFN_vkCreateGraphicsPipelines __vkCreateGraphicsPipelines;
-extern PFN_vkCreateImage __vkCreateImage;
-extern PFN_vkCreateImageView __vkCreateImageView;
-extern PFN_vkCreateInstance __vkCreateInstance;
-extern PFN_vkCreatePipelineCache __vkCreatePipelineCache;
-extern PFN_vkCreatePipelineLayout __vkCreatePipelineLayout;
-extern PFN_vkCreateQueryPool __vkCreateQueryPool;
-extern PFN_vkCreateRenderPass __vkCreateRenderPass;
-extern PFN_vkCreateSampler __vkCreateSampler;
-extern PFN_vkCreateSemaphore __vkCreateSemaphore;
-extern PFN_vkCreateShaderModule __vkCreateShaderModule;
-extern PFN_vkCreateSharedSwapchainsKHR __vkCreateSharedSwapchainsKHR;
-extern PFN_vkCreateSwapchainKHR __vkCreateSwapchainKHR;
-extern PFN_vkDebugMarkerSetObjectNameEXT __vkDebugMarkerSetObjectNameEXT;
-extern PFN_vkDebugMarkerSetObjectTagEXT __vkDebugMarkerSetObjectTagEXT;
-extern PFN_vkDebugReportCallbackEXT __vkDebugReportCallbackEXT;
-extern PFN_vkDebugReportMessageEXT __vkDebugReportMessageEXT;
-extern PFN_vkDestroyBuffer __vkDestroyBuffer;
-extern PFN_vkDestroyBufferView __vkDestroyBufferView;
-extern PFN_vkDestroyCommandPool __vkDestroyCommandPool;
-extern PFN_vkDestroyDebugReportCallbackEXT __vkDestroyDebugReportCallbackEXT;
-extern PFN_vkDestroyDescriptorPool __vkDestroyDescriptorPool;
-extern PFN_vkDestroyDescriptorSetLayout __vkDestroyDescriptorSetLayout;
-extern PFN_vkDestroyDevice __vkDestroyDevice;
-extern PFN_vkDestroyEvent __vkDestroyEvent;
-extern PFN_vkDestroyFence __vkDestroyFence;
-extern PFN_vkDestroyFramebuffer __vkDestroyFramebuffer;
-extern PFN_vkDestroyImage __vkDestroyImage;
-extern PFN_vkDestroyImageView __vkDestroyImageView;
-extern PFN_vkDestroyInstance __vkDestroyInstance;
-extern PFN_vkDestroyPipeline __vkDestroyPipeline;
-extern PFN_vkDestroyPipelineCache __vkDestroyPipelineCache;
-extern PFN_vkDestroyPipelineLayout __vkDestroyPipelineLayout;
-extern PFN_vkDestroyQueryPool __vkDestroyQueryPool;
-extern PFN_vkDestroyRenderPass __vkDestroyRenderPass;
-extern PFN_vkDestroySampler __vkDestroySampler;
-extern PFN_vkDestroySemaphore __vkDestroySemaphore;
-extern PFN_vkDestroyShaderModule __vkDestroyShaderModule;
-extern PFN_vkDestroySurfaceKHR __vkDestroySurfaceKHR;
-extern PFN_vkDestroySwapchainKHR __vkDestroySwapchainKHR;
-extern PFN_vkDeviceWaitIdle __vkDeviceWaitIdle;
-extern PFN_vkEndCommandBuffer __vkEndCommandBuffer;
-extern PFN_vkEnumerateDeviceExtensionProperties __vkEnumerateDeviceExtensionProperties;
-extern PFN_vkEnumerateDeviceLayerProperties __vkEnumerateDeviceLayerProperties;
-extern PFN_vkEnumerateInstanceExtensionProperties __vkEnumerateInstanceExtensionProperties;
-extern PFN_vkEnumerateInstanceLayerProperties __vkEnumerateInstanceLayerProperties;
-extern PFN_vkEnumeratePhysicalDevices __vkEnumeratePhysicalDevices;
-extern PFN_vkFlushMappedMemoryRanges __vkFlushMappedMemoryRanges;
-extern PFN_vkFreeCommandBuffers __vkFreeCommandBuffers;
-extern PFN_vkFreeDescriptorSets __vkFreeDescriptorSets;
-extern PFN_vkFreeFunction __vkFreeFunction;
-extern PFN_vkFreeMemory __vkFreeMemory;
-extern PFN_vkGetBufferMemoryRequirements __vkGetBufferMemoryRequirements;
-extern PFN_vkGetDeviceMemoryCommitment __vkGetDeviceMemoryCommitment;
-extern PFN_vkGetDeviceProcAddr __vkGetDeviceProcAddr;
-extern PFN_vkGetDeviceQueue __vkGetDeviceQueue;
-extern PFN_vkGetDisplayModePropertiesKHR __vkGetDisplayModePropertiesKHR;
-extern PFN_vkGetDisplayPlaneCapabilitiesKHR __vkGetDisplayPlaneCapabilitiesKHR;
-extern PFN_vkGetDisplayPlaneSupportedDisplaysKHR __vkGetDisplayPlaneSupportedDisplaysKHR;
-extern PFN_vkGetEventStatus __vkGetEventStatus;
-extern PFN_vkGetFenceStatus __vkGetFenceStatus;
-extern PFN_vkGetImageMemoryRequirements __vkGetImageMemoryRequirements;
-extern PFN_vkGetImageSparseMemoryRequirements __vkGetImageSparseMemoryRequirements;
-extern PFN_vkGetImageSubresourceLayout __vkGetImageSubresourceLayout;
-extern PFN_vkGetInstanceProcAddr __vkGetInstanceProcAddr;
-extern PFN_vkGetPhysicalDeviceDisplayPlanePropertiesKHR __vkGetPhysicalDeviceDisplayPlanePropertiesKHR;
-extern PFN_vkGetPhysicalDeviceDisplayPropertiesKHR __vkGetPhysicalDeviceDisplayPropertiesKHR;
-extern PFN_vkGetPhysicalDeviceFeatures __vkGetPhysicalDeviceFeatures;
-extern PFN_vkGetPhysicalDeviceFormatProperties __vkGetPhysicalDeviceFormatProperties;
-extern PFN_vkGetPhysicalDeviceImageFormatProperties __vkGetPhysicalDeviceImageFormatProperties;
-extern PFN_vkGetPhysicalDeviceMemoryProperties __vkGetPhysicalDeviceMemoryProperties;
-extern PFN_vkGetPhysicalDeviceProperties __vkGetPhysicalDeviceProperties;
-extern PFN_vkGetPhysicalDeviceQueueFamilyProperties __vkGetPhysicalDeviceQueueFamilyProperties;
-extern PFN_vkGetPhysicalDeviceSparseImageFormatProperties __vkGetPhysicalDeviceSparseImageFormatProperties;
-extern PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR __vkGetPhysicalDeviceSurfaceCapabilitiesKHR;
-extern PFN_vkGetPhysicalDeviceSurfaceFormatsKHR __vkGetPhysicalDeviceSurfaceFormatsKHR;
-extern PFN_vkGetPhysicalDeviceSurfacePresentModesKHR __vkGetPhysicalDeviceSurfacePresentModesKHR;
-extern PFN_vkGetPhysicalDeviceSurfaceSupportKHR __vkGetPhysicalDeviceSurfaceSupportKHR;
-extern PFN_vkGetPipelineCacheData __vkGetPipelineCacheData;
-extern PFN_vkGetQueryPoolResults __vkGetQueryPoolResults;
-extern PFN_vkGetRenderAreaGranularity __vkGetRenderAreaGranularity;
-extern PFN_vkGetSwapchainImagesKHR __vkGetSwapchainImagesKHR;
-extern PFN_vkInternalAllocationNotification __vkInternalAllocationNotification;
-extern PFN_vkInternalFreeNotification __vkInternalFreeNotification;
-extern PFN_vkInvalidateMappedMemoryRanges __vkInvalidateMappedMemoryRanges;
-extern PFN_vkMapMemory __vkMapMemory;
-extern PFN_vkMergePipelineCaches __vkMergePipelineCaches;
-extern PFN_vkQueueBindSparse __vkQueueBindSparse;
-extern PFN_vkQueuePresentKHR __vkQueuePresentKHR;
-extern PFN_vkQueueSubmit __vkQueueSubmit;
-extern PFN_vkQueueWaitIdle __vkQueueWaitIdle;
-extern PFN_vkReallocationFunction __vkReallocationFunction;
-extern PFN_vkResetCommandBuffer __vkResetCommandBuffer;
-extern PFN_vkResetCommandPool __vkResetCommandPool;
-extern PFN_vkResetDescriptorPool __vkResetDescriptorPool;
-extern PFN_vkResetEvent __vkResetEvent;
-extern PFN_vkResetFences __vkResetFences;
-extern PFN_vkSetEvent __vkSetEvent;
-extern PFN_vkUnmapMemory __vkUnmapMemory;
-extern PFN_vkUpdateDescriptorSets __vkUpdateDescriptorSets;
-extern PFN_vkVoidFunction __vkVoidFunction;
-extern PFN_vkWaitForFences __vkWaitForFences;
+typedef struct VkelPhysicalDeviceProbe {
+	VkPhysicalDevice physicalDevice;
+	VkelCapabilities capabilities;
+	VkPhysicalDeviceProperties properties;
+	VkPhysicalDeviceMemoryProperties memoryProperties;
+	uint32_t queueFamilyCount;
+	VkQueueFamilyProperties queueFamilies[VKEL_MAX_QUEUE_FAMILIES];
+} VkelPhysicalDeviceProbe;
+
+// Probe the capabilities (which also fills the enumeration cache), properties, memory
+// properties and queue families of each physical device into pProbes, on a few threads
+// at once. Must be called after vkelInstanceInit(), while e.g. vkelInstanceInit(),
+// vkelDeviceInit() and vkelRegisterDevice() can be called during vkelProbePhysicalDevicesAsync()
+// (but not vkelInit()). Both arrays must stay valid until the task has completed. Returns
+// VK_FALSE if out of memory.
+extern VKEL_API VkBool32 vkelProbePhysicalDevices(uint32_t physicalDeviceCount, const VkPhysicalDevice *pPhysicalDevices, VkelPhysicalDeviceProbe *pProbes);
+extern VKEL_API VkelTask vkelProbePhysicalDevicesAsync(uint32_t physicalDeviceCount, const VkPhysicalDevice *pPhysicalDevices, VkelPhysicalDeviceProbe *pProbes);
+
+
+// Device level functions, loaded from a specific VkDevice
+typedef struct VkelDeviceTable {
+	PFN_vkDestroyDevice DestroyDevice;
+	PFN_vkGetDeviceQueue GetDeviceQueue;
+	PFN_vkQueueSubmit QueueSubmit;
+	PFN_vkQueueWaitIdle QueueWaitIdle;
+	PFN_vkDeviceWaitIdle DeviceWaitIdle;
+	PFN_vkAllocateMemory AllocateMemory;
+	PFN_vkFreeMemory FreeMemory;
+	PFN_vkMapMemory MapMemory;
+	PFN_vkUnmapMemory UnmapMemory;
+	PFN_vkFlushMappedMemoryRanges FlushMappedMemoryRanges;
+	PFN_vkInvalidateMappedMemoryRanges InvalidateMappedMemoryRanges;
+	PFN_vkGetDeviceMemoryCommitment GetDeviceMemoryCommitment;
+	PFN_vkBindBufferMemory BindBufferMemory;
+	PFN_vkBindImageMemory BindImageMemory;
+	PFN_vkGetBufferMemoryRequirements GetBufferMemoryRequirements;
+	PFN_vkGetImageMemoryRequirements GetImageMemoryRequirements;
+	PFN_vkGetImageSparseMemoryRequirements GetImageSparseMemoryRequirements;
+	PFN_vkQueueBindSparse QueueBindSparse;
+	PFN_vkCreateFence CreateFence;
+	PFN_vkDestroyFence DestroyFence;
+	PFN_vkResetFences ResetFences;
+	PFN_vkGetFenceStatus GetFenceStatus;
+	PFN_vkWaitForFences WaitForFences;
+	PFN_vkCreateSemaphore CreateSemaphore;
+	PFN_vkDestroySemaphore DestroySemaphore;
+	PFN_vkCreateEvent CreateEvent;
+	PFN_vkDestroyEvent DestroyEvent;
+	PFN_vkGetEventStatus GetEventStatus;
+	PFN_vkSetEvent SetEvent;
+	PFN_vkResetEvent ResetEvent;
+	PFN_vkCreateQueryPool CreateQueryPool;
+	PFN_vkDestroyQueryPool DestroyQueryPool;
+	PFN_vkGetQueryPoolResults GetQueryPoolResults;
+	PFN_vkCreateBuffer CreateBuffer;
+	PFN_vkDestroyBuffer DestroyBuffer;
+	PFN_vkCreateBufferView CreateBufferView;
+	PFN_vkDestroyBufferView DestroyBufferView;
+	PFN_vkCreateImage CreateImage;
+	PFN_vkDestroyImage DestroyImage;
+	PFN_vkGetImageSubresourceLayout GetImageSubresourceLayout;
+	PFN_vkCreateImageView CreateImageView;
+	PFN_vkDestroyImageView DestroyImageView;
+	PFN_vkCreateShaderModule CreateShaderModule;
+	PFN_vkDestroyShaderModule DestroyShaderModule;
+	PFN_vkCreatePipelineCache CreatePipelineCache;
+	PFN_vkDestroyPipelineCache DestroyPipelineCache;
+	PFN_vkGetPipelineCacheData GetPipelineCacheData;
+	PFN_vkMergePipelineCaches MergePipelineCaches;
+	PFN_vkCreateGraphicsPipelines CreateGraphicsPipelines;
+	PFN_vkCreateComputePipelines CreateComputePipelines;
+	PFN_vkDestroyPipeline DestroyPipeline;
+	PFN_vkCreatePipelineLayout CreatePipelineLayout;
+	PFN_vkDestroyPipelineLayout DestroyPipelineLayout;
+	PFN_vkCreateSampler CreateSampler;
+	PFN_vkDestroySampler DestroySampler;
+	PFN_vkCreateDescriptorSetLayout CreateDescriptorSetLayout;
+	PFN_vkDestroyDescriptorSetLayout DestroyDescriptorSetLayout;
+	PFN_vkCreateDescriptorPool CreateDescriptorPool;
+	PFN_vkDestroyDescriptorPool DestroyDescriptorPool;
+	PFN_vkResetDescriptorPool ResetDescriptorPool;
+	PFN_vkAllocateDescriptorSets AllocateDescriptorSets;
+	PFN_vkFreeDescriptorSets FreeDescriptorSets;
+	PFN_vkUpdateDescriptorSets UpdateDescriptorSets;
+	PFN_vkCreateFramebuffer CreateFramebuffer;
+	PFN_vkDestroyFramebuffer DestroyFramebuffer;
+	PFN_vkCreateRenderPass CreateRenderPass;
+	PFN_vkDestroyRenderPass DestroyRenderPass;
+	PFN_vkGetRenderAreaGranularity GetRenderAreaGranularity;
+	PFN_vkCreateCommandPool CreateCommandPool;
+	PFN_vkDestroyCommandPool DestroyCommandPool;
+	PFN_vkResetCommandPool ResetCommandPool;
+	PFN_vkAllocateCommandBuffers AllocateCommandBuffers;
+	PFN_vkFreeCommandBuffers FreeCommandBuffers;
+	PFN_vkBeginCommandBuffer BeginCommandBuffer;
+	PFN_vkEndCommandBuffer EndCommandBuffer;
+	PFN_vkResetCommandBuffer ResetCommandBuffer;
+	PFN_vkCmdBindPipeline CmdBindPipeline;
+	PFN_vkCmdSetViewport CmdSetViewport;
+	PFN_vkCmdSetScissor CmdSetScissor;
+	PFN_vkCmdSetLineWidth CmdSetLineWidth;
+	PFN_vkCmdSetDepthBias CmdSetDepthBias;
+	PFN_vkCmdSetBlendConstants CmdSetBlendConstants;
+	PFN_vkCmdSetDepthBounds CmdSetDepthBounds;
+	PFN_vkCmdSetStencilCompareMask CmdSetStencilCompareMask;
+	PFN_vkCmdSetStencilWriteMask CmdSetStencilWriteMask;
+	PFN_vkCmdSetStencilReference CmdSetStencilReference;
+	PFN_vkCmdBindDescriptorSets CmdBindDescriptorSets;
+	PFN_vkCmdBindIndexBuffer CmdBindIndexBuffer;
+	PFN_vkCmdBindVertexBuffers CmdBindVertexBuffers;
+	PFN_vkCmdDraw CmdDraw;
+	PFN_vkCmdDrawIndexed CmdDrawIndexed;
+	PFN_vkCmdDrawIndirect CmdDrawIndirect;
+	PFN_vkCmdDrawIndexedIndirect CmdDrawIndexedIndirect;
+	PFN_vkCmdDispatch CmdDispatch;
+	PFN_vkCmdDispatchIndirect CmdDispatchIndirect;
+	PFN_vkCmdCopyBuffer CmdCopyBuffer;
+	PFN_vkCmdCopyImage CmdCopyImage;
+	PFN_vkCmdBlitImage CmdBlitImage;
+	PFN_vkCmdCopyBufferToImage CmdCopyBufferToImage;
+	PFN_vkCmdCopyImageToBuffer CmdCopyImageToBuffer;
+	PFN_vkCmdUpdateBuffer CmdUpdateBuffer;
+	PFN_vkCmdFillBuffer CmdFillBuffer;
+	PFN_vkCmdClearColorImage CmdClearColorImage;
+	PFN_vkCmdClearDepthStencilImage CmdClearDepthStencilImage;
+	PFN_vkCmdClearAttachments CmdClearAttachments;
+	PFN_vkCmdResolveImage CmdResolveImage;
+	PFN_vkCmdSetEvent CmdSetEvent;
+	PFN_vkCmdResetEvent CmdResetEvent;
+	PFN_vkCmdWaitEvents CmdWaitEvents;
+	PFN_vkCmdPipelineBarrier CmdPipelineBarrier;
+	PFN_vkCmdBeginQuery CmdBeginQuery;
+	PFN_vkCmdEndQuery CmdEndQuery;
+	PFN_vkCmdResetQueryPool CmdResetQueryPool;
+	PFN_vkCmdWriteTimestamp CmdWriteTimestamp;
+	PFN_vkCmdCopyQueryPoolResults CmdCopyQueryPoolResults;
+	PFN_vkCmdPushConstants CmdPushConstants;
+	PFN_vkCmdBeginRenderPass CmdBeginRenderPass;
+	PFN_vkCmdNextSubpass CmdNextSubpass;
+	PFN_vkCmdEndRenderPass CmdEndRenderPass;
+	PFN_vkCmdExecuteCommands CmdExecuteCommands;
+	PFN_vkCreateSwapchainKHR CreateSwapchainKHR;
+	PFN_vkDestroySwapchainKHR DestroySwapchainKHR;
+	PFN_vkGetSwapchainImagesKHR GetSwapchainImagesKHR;
+	PFN_vkAcquireNextImageKHR AcquireNextImageKHR;
+	PFN_vkQueuePresentKHR QueuePresentKHR;
+	PFN_vkCreateSharedSwapchainsKHR CreateSharedSwapchainsKHR;
+	PFN_vkDebugMarkerSetObjectTagEXT DebugMarkerSetObjectTagEXT;
+	PFN_vkDebugMarkerSetObjectNameEXT DebugMarkerSetObjectNameEXT;
+	PFN_vkCmdDebugMarkerBeginEXT CmdDebugMarkerBeginEXT;
+	PFN_vkCmdDebugMarkerEndEXT CmdDebugMarkerEndEXT;
+	PFN_vkCmdDebugMarkerInsertEXT CmdDebugMarkerInsertEXT;
+} VkelDeviceTable;
+
+#ifndef VKEL_MAX_DEVICES
+#	define VKEL_MAX_DEVICES 64
+#endif
 
-#ifdef VK_USE_PLATFORM_ANDROID_KHR
-extern PFN_vkCreateAndroidSurfaceKHR __vkCreateAndroidSurfaceKHR;
-#endif /* VK_USE_PLATFORM_ANDROID_KHR */
+typedef struct VkelDevice {
+	VkPhysicalDevice physicalDevice;
+	VkDevice device;
+	
+	VkelCapabilities capabilities;
+	VkelDeviceTable table;
+} VkelDevice;
+
+// Register any number (up to VKEL_MAX_DEVICES) of devices, each with their own
+// table and capabilities. Registering the same device again returns the existing
+// entry. Returns NULL if the registry is full or out of memory.
+extern VKEL_API const VkelDevice* vkelRegisterDevice(VkPhysicalDevice physicalDevice, VkDevice device);
+// Must be called before vkDestroyDevice(), when the device is no longer being used
+extern VKEL_API void vkelUnregisterDevice(VkDevice device);
+
+// The device of the last vkelDeviceInit(). Its table is built off to the side and published
+// with a single atomic store (as vkelTable.pDeviceTable), so a thread gets either the whole old
+// or the whole new table. NULL before vkelDeviceInit().
+extern VKEL_API const VkelDevice* vkelGetCurrentDevice(void);
+
+// Devices replaced by the inits or removed by vkelUnregisterDevice() are retired, and only freed
+// once every online thread has passed a quiescent point. Threads that call the device level vk*
+// macros while another thread calls vkelDeviceInit(), or that keep VkelDevice or table pointers
+// across calls, come online by calling vkelQuiescent() where they hold none (e.g. once per frame),
+// and go offline with vkelThreadOffline() before exiting. Neither ever waits.
+// vkelQuiescent() returns VK_FALSE when VKEL_MAX_THREADS threads are already online. Until a
+// thread has come online, and once one couldn't, retired ones are kept until vkelUninit().
+#ifndef VKEL_MAX_THREADS
+#	define VKEL_MAX_THREADS 64
+#endif
 
-#ifdef VK_USE_PLATFORM_MIR_KHR
-extern PFN_vkCreateMirSurfaceKHR __vkCreateMirSurfaceKHR;
-extern PFN_vkGetPhysicalDeviceMirPresentationSupportKHR __vkGetPhysicalDeviceMirPresentationSupportKHR;
-#endif /* VK_USE_PLATFORM_MIR_KHR */
+extern VKEL_API VkBool32 vkelQuiescent(void);
+extern VKEL_API void vkelThreadOffline(void);
+
+// Dispatchable handles (VkDevice, VkQueue and VkCommandBuffer) start with the
+// loader's dispatch pointer, which is shared by a device and all its queues and
+// command buffers. Devices are registered by that key, so any of the handles
+// can be used to find the device.
+#define vkelGetDispatchKey(dispatchableHandle) (*(void* const*) (dispatchableHandle))
+
+// Lock-free, returns NULL if the device isn't registered
+extern VKEL_API const VkelDevice* vkelGetDevice(VkDevice device);
+extern VKEL_API const VkelDevice* vkelGetDispatchableDevice(const void *dispatchableHandle);
+
+
+#ifndef VKEL_INLINE
+#	if defined(_MSC_VER) && !defined(__cplusplus)
+#		define VKEL_INLINE static __inline
+#	else
+#		define VKEL_INLINE static inline
+#	endif
+#endif
+
+#ifndef VKEL_THREAD_LOCAL
+#	if defined(_MSC_VER)
+#		define VKEL_THREAD_LOCAL __declspec(thread)
+#	else
+#		define VKEL_THREAD_LOCAL __thread
+#	endif
+#endif
+
+
+// The registry is an open addressing hash table, visible so the lookups below can find a
+// device in the slot its key hashes to (where it is, unless another key took it first)
+// without a call
+#define VKEL_DEVICE_SLOT_COUNT (VKEL_MAX_DEVICES * 2)
+
+typedef struct VkelDeviceSlot {
+	// NULL when the slot was never used, or a key marking it removed
+	void* volatile key;
+	void* volatile entry;
+} VkelDeviceSlot;
+
+extern VKEL_API VkelDeviceSlot vkelDeviceSlots[VKEL_DEVICE_SLOT_COUNT];
+
+VKEL_INLINE uint32_t vkelHashDeviceKey(const void *key)
+{
+	uint64_t hash = (uint64_t) (uintptr_t) key;
+	
+	hash ^= hash >> 33;
+	hash *= 0xFF51AFD7ED558CCDull;
+	hash ^= hash >> 33;
+	
+	return (uint32_t) hash & (VKEL_DEVICE_SLOT_COUNT - 1);
+}
 
+// Same as vkelGetDispatchableDevice(), which it only calls when the device isn't in its slot
+VKEL_INLINE const VkelDevice* vkelFindDispatchableDevice(const void *dispatchableHandle)
+{
+	void *key = vkelGetDispatchKey(dispatchableHandle);
+	const VkelDeviceSlot *slot = &vkelDeviceSlots[vkelHashDeviceKey(key)];
+	const VkelDevice *entry = NULL;
+	
+	// The entry is published before the key, and cleared after it
+#if defined(__GNUC__) || defined(__clang__)
+	if (__atomic_load_n(&slot->key, __ATOMIC_ACQUIRE) == key)
+		entry = (const VkelDevice*) __atomic_load_n(&slot->entry, __ATOMIC_ACQUIRE);
+#else
+	if (slot->key == key)
+		entry = (const VkelDevice*) slot->entry;
+#endif
+	
+	return entry ? entry : vkelGetDispatchableDevice(dispatchableHandle);
+}
+
+
+// A table of all the functions, which can be shared with plugins (or other shared objects)
+// embedding vkel, so the process only initializes once. The version only changes when
+// existing members change, new members are appended and found using the size.
+#define VKEL_TABLE_VERSION 1
+
+typedef struct VkelTable {
+	uint32_t version;
+	uint32_t size;
+	
+	// The capabilities are shared as bits indexed by the IDs, as the number of IDs can differ
+	uint32_t extensionIdCount;
+	uint32_t layerIdCount;
+	
+	const uint32_t *pInstanceExtensions;
+	const uint32_t *pInstanceLayers;
+	const uint32_t *pDeviceExtensions;
+	const uint32_t *pDeviceLayers;
+	
+	PFN_vkCreateInstance CreateInstance;
+	PFN_vkDestroyInstance DestroyInstance;
+	PFN_vkEnumeratePhysicalDevices EnumeratePhysicalDevices;
+	PFN_vkGetPhysicalDeviceFeatures GetPhysicalDeviceFeatures;
+	PFN_vkGetPhysicalDeviceFormatProperties GetPhysicalDeviceFormatProperties;
+	PFN_vkGetPhysicalDeviceImageFormatProperties GetPhysicalDeviceImageFormatProperties;
+	PFN_vkGetPhysicalDeviceProperties GetPhysicalDeviceProperties;
+	PFN_vkGetPhysicalDeviceQueueFamilyProperties GetPhysicalDeviceQueueFamilyProperties;
+	PFN_vkGetPhysicalDeviceMemoryProperties GetPhysicalDeviceMemoryProperties;
+	PFN_vkGetInstanceProcAddr GetInstanceProcAddr;
+	PFN_vkGetDeviceProcAddr GetDeviceProcAddr;
+	PFN_vkCreateDevice CreateDevice;
+	PFN_vkDestroyDevice DestroyDevice;
+	PFN_vkEnumerateInstanceExtensionProperties EnumerateInstanceExtensionProperties;
+	PFN_vkEnumerateDeviceExtensionProperties EnumerateDeviceExtensionProperties;
+	PFN_vkEnumerateInstanceLayerProperties EnumerateInstanceLayerProperties;
+	PFN_vkEnumerateDeviceLayerProperties EnumerateDeviceLayerProperties;
+	PFN_vkGetDeviceQueue GetDeviceQueue;
+	PFN_vkQueueSubmit QueueSubmit;
+	PFN_vkQueueWaitIdle QueueWaitIdle;
+	PFN_vkDeviceWaitIdle DeviceWaitIdle;
+	PFN_vkAllocateMemory AllocateMemory;
+	PFN_vkFreeMemory FreeMemory;
+	PFN_vkMapMemory MapMemory;
+	PFN_vkUnmapMemory UnmapMemory;
+	PFN_vkFlushMappedMemoryRanges FlushMappedMemoryRanges;
+	PFN_vkInvalidateMappedMemoryRanges InvalidateMappedMemoryRanges;
+	PFN_vkGetDeviceMemoryCommitment GetDeviceMemoryCommitment;
+	PFN_vkBindBufferMemory BindBufferMemory;
+	PFN_vkBindImageMemory BindImageMemory;
+	PFN_vkGetBufferMemoryRequirements GetBufferMemoryRequirements;
+	PFN_vkGetImageMemoryRequirements GetImageMemoryRequirements;
+	PFN_vkGetImageSparseMemoryRequirements GetImageSparseMemoryRequirements;
+	PFN_vkGetPhysicalDeviceSparseImageFormatProperties GetPhysicalDeviceSparseImageFormatProperties;
+	PFN_vkQueueBindSparse QueueBindSparse;
+	PFN_vkCreateFence CreateFence;
+	PFN_vkDestroyFence DestroyFence;
+	PFN_vkResetFences ResetFences;
+	PFN_vkGetFenceStatus GetFenceStatus;
+	PFN_vkWaitForFences WaitForFences;
+	PFN_vkCreateSemaphore CreateSemaphore;
+	PFN_vkDestroySemaphore DestroySemaphore;
+	PFN_vkCreateEvent CreateEvent;
+	PFN_vkDestroyEvent DestroyEvent;
+	PFN_vkGetEventStatus GetEventStatus;
+	PFN_vkSetEvent SetEvent;
+	PFN_vkResetEvent ResetEvent;
+	PFN_vkCreateQueryPool CreateQueryPool;
+	PFN_vkDestroyQueryPool DestroyQueryPool;
+	PFN_vkGetQueryPoolResults GetQueryPoolResults;
+	PFN_vkCreateBuffer CreateBuffer;
+	PFN_vkDestroyBuffer DestroyBuffer;
+	PFN_vkCreateBufferView CreateBufferView;
+	PFN_vkDestroyBufferView DestroyBufferView;
+	PFN_vkCreateImage CreateImage;
+	PFN_vkDestroyImage DestroyImage;
+	PFN_vkGetImageSubresourceLayout GetImageSubresourceLayout;
+	PFN_vkCreateImageView CreateImageView;
+	PFN_vkDestroyImageView DestroyImageView;
+	PFN_vkCreateShaderModule CreateShaderModule;
+	PFN_vkDestroyShaderModule DestroyShaderModule;
+	PFN_vkCreatePipelineCache CreatePipelineCache;
+	PFN_vkDestroyPipelineCache DestroyPipelineCache;
+	PFN_vkGetPipelineCacheData GetPipelineCacheData;
+	PFN_vkMergePipelineCaches MergePipelineCaches;
+	PFN_vkCreateGraphicsPipelines CreateGraphicsPipelines;
+	PFN_vkCreateComputePipelines CreateComputePipelines;
+	PFN_vkDestroyPipeline DestroyPipeline;
+	PFN_vkCreatePipelineLayout CreatePipelineLayout;
+	PFN_vkDestroyPipelineLayout DestroyPipelineLayout;
+	PFN_vkCreateSampler CreateSampler;
+	PFN_vkDestroySampler DestroySampler;
+	PFN_vkCreateDescriptorSetLayout CreateDescriptorSetLayout;
+	PFN_vkDestroyDescriptorSetLayout DestroyDescriptorSetLayout;
+	PFN_vkCreateDescriptorPool CreateDescriptorPool;
+	PFN_vkDestroyDescriptorPool DestroyDescriptorPool;
+	PFN_vkResetDescriptorPool ResetDescriptorPool;
+	PFN_vkAllocateDescriptorSets AllocateDescriptorSets;
+	PFN_vkFreeDescriptorSets FreeDescriptorSets;
+	PFN_vkUpdateDescriptorSets UpdateDescriptorSets;
+	PFN_vkCreateFramebuffer CreateFramebuffer;
+	PFN_vkDestroyFramebuffer DestroyFramebuffer;
+	PFN_vkCreateRenderPass CreateRenderPass;
+	PFN_vkDestroyRenderPass DestroyRenderPass;
+	PFN_vkGetRenderAreaGranularity GetRenderAreaGranularity;
+	PFN_vkCreateCommandPool CreateCommandPool;
+	PFN_vkDestroyCommandPool DestroyCommandPool;
+	PFN_vkResetCommandPool ResetCommandPool;
+	PFN_vkAllocateCommandBuffers AllocateCommandBuffers;
+	PFN_vkFreeCommandBuffers FreeCommandBuffers;
+	PFN_vkBeginCommandBuffer BeginCommandBuffer;
+	PFN_vkEndCommandBuffer EndCommandBuffer;
+	PFN_vkResetCommandBuffer ResetCommandBuffer;
+	PFN_vkCmdBindPipeline CmdBindPipeline;
+	PFN_vkCmdSetViewport CmdSetViewport;
+	PFN_vkCmdSetScissor CmdSetScissor;
+	PFN_vkCmdSetLineWidth CmdSetLineWidth;
+	PFN_vkCmdSetDepthBias CmdSetDepthBias;
+	PFN_vkCmdSetBlendConstants CmdSetBlendConstants;
+	PFN_vkCmdSetDepthBounds CmdSetDepthBounds;
+	PFN_vkCmdSetStencilCompareMask CmdSetStencilCompareMask;
+	PFN_vkCmdSetStencilWriteMask CmdSetStencilWriteMask;
+	PFN_vkCmdSetStencilReference CmdSetStencilReference;
+	PFN_vkCmdBindDescriptorSets CmdBindDescriptorSets;
+	PFN_vkCmdBindIndexBuffer CmdBindIndexBuffer;
+	PFN_vkCmdBindVertexBuffers CmdBindVertexBuffers;
+	PFN_vkCmdDraw CmdDraw;
+	PFN_vkCmdDrawIndexed CmdDrawIndexed;
+	PFN_vkCmdDrawIndirect CmdDrawIndirect;
+	PFN_vkCmdDrawIndexedIndirect CmdDrawIndexedIndirect;
+	PFN_vkCmdDispatch CmdDispatch;
+	PFN_vkCmdDispatchIndirect CmdDispatchIndirect;
+	PFN_vkCmdCopyBuffer CmdCopyBuffer;
+	PFN_vkCmdCopyImage CmdCopyImage;
+	PFN_vkCmdBlitImage CmdBlitImage;
+	PFN_vkCmdCopyBufferToImage CmdCopyBufferToImage;
+	PFN_vkCmdCopyImageToBuffer CmdCopyImageToBuffer;
+	PFN_vkCmdUpdateBuffer CmdUpdateBuffer;
+	PFN_vkCmdFillBuffer CmdFillBuffer;
+	PFN_vkCmdClearColorImage CmdClearColorImage;
+	PFN_vkCmdClearDepthStencilImage CmdClearDepthStencilImage;
+	PFN_vkCmdClearAttachments CmdClearAttachments;
+	PFN_vkCmdResolveImage CmdResolveImage;
+	PFN_vkCmdSetEvent CmdSetEvent;
+	PFN_vkCmdResetEvent CmdResetEvent;
+	PFN_vkCmdWaitEvents CmdWaitEvents;
+	PFN_vkCmdPipelineBarrier CmdPipelineBarrier;
+	PFN_vkCmdBeginQuery CmdBeginQuery;
+	PFN_vkCmdEndQuery CmdEndQuery;
+	PFN_vkCmdResetQueryPool CmdResetQueryPool;
+	PFN_vkCmdWriteTimestamp CmdWriteTimestamp;
+	PFN_vkCmdCopyQueryPoolResults CmdCopyQueryPoolResults;
+	PFN_vkCmdPushConstants CmdPushConstants;
+	PFN_vkCmdBeginRenderPass CmdBeginRenderPass;
+	PFN_vkCmdNextSubpass CmdNextSubpass;
+	PFN_vkCmdEndRenderPass CmdEndRenderPass;
+	PFN_vkCmdExecuteCommands CmdExecuteCommands;
+	PFN_vkDestroySurfaceKHR DestroySurfaceKHR;
+	PFN_vkGetPhysicalDeviceSurfaceSupportKHR GetPhysicalDeviceSurfaceSupportKHR;
+	PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR GetPhysicalDeviceSurfaceCapabilitiesKHR;
+	PFN_vkGetPhysicalDeviceSurfaceFormatsKHR GetPhysicalDeviceSurfaceFormatsKHR;
+	PFN_vkGetPhysicalDeviceSurfacePresentModesKHR GetPhysicalDeviceSurfacePresentModesKHR;
+	PFN_vkCreateSwapchainKHR CreateSwapchainKHR;
+	PFN_vkDestroySwapchainKHR DestroySwapchainKHR;
+	PFN_vkGetSwapchainImagesKHR GetSwapchainImagesKHR;
+	PFN_vkAcquireNextImageKHR AcquireNextImageKHR;
+	PFN_vkQueuePresentKHR QueuePresentKHR;
+	PFN_vkGetPhysicalDeviceDisplayPropertiesKHR GetPhysicalDeviceDisplayPropertiesKHR;
+	PFN_vkGetPhysicalDeviceDisplayPlanePropertiesKHR GetPhysicalDeviceDisplayPlanePropertiesKHR;
+	PFN_vkGetDisplayPlaneSupportedDisplaysKHR GetDisplayPlaneSupportedDisplaysKHR;
+	PFN_vkGetDisplayModePropertiesKHR GetDisplayModePropertiesKHR;
+	PFN_vkCreateDisplayModeKHR CreateDisplayModeKHR;
+	PFN_vkGetDisplayPlaneCapabilitiesKHR GetDisplayPlaneCapabilitiesKHR;
+	PFN_vkCreateDisplayPlaneSurfaceKHR CreateDisplayPlaneSurfaceKHR;
+	PFN_vkCreateSharedSwapchainsKHR CreateSharedSwapchainsKHR;
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+	PFN_vkCreateXlibSurfaceKHR CreateXlibSurfaceKHR;
+#else
+	PFN_vkVoidFunction CreateXlibSurfaceKHR;
+#endif /* VK_USE_PLATFORM_XLIB_KHR */
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+	PFN_vkGetPhysicalDeviceXlibPresentationSupportKHR GetPhysicalDeviceXlibPresentationSupportKHR;
+#else
+	PFN_vkVoidFunction GetPhysicalDeviceXlibPresentationSupportKHR;
+#endif /* VK_USE_PLATFORM_XLIB_KHR */
+#ifdef VK_USE_PLATFORM_XCB_KHR
+	PFN_vkCreateXcbSurfaceKHR CreateXcbSurfaceKHR;
+#else
+	PFN_vkVoidFunction CreateXcbSurfaceKHR;
+#endif /* VK_USE_PLATFORM_XCB_KHR */
+#ifdef VK_USE_PLATFORM_XCB_KHR
+	PFN_vkGetPhysicalDeviceXcbPresentationSupportKHR GetPhysicalDeviceXcbPresentationSupportKHR;
+#else
+	PFN_vkVoidFunction GetPhysicalDeviceXcbPresentationSupportKHR;
+#endif /* VK_USE_PLATFORM_XCB_KHR */
 #ifdef VK_USE_PLATFORM_WAYLAND_KHR
-extern PFN_vkCreateWaylandSurfaceKHR __vkCreateWaylandSurfaceKHR;
-extern PFN_vkGetPhysicalDeviceWaylandPresentationSupportKHR __vkGetPhysicalDeviceWaylandPresentationSupportKHR;
+	PFN_vkCreateWaylandSurfaceKHR CreateWaylandSurfaceKHR;
+#else
+	PFN_vkVoidFunction CreateWaylandSurfaceKHR;
 #endif /* VK_USE_PLATFORM_WAYLAND_KHR */
-
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+	PFN_vkGetPhysicalDeviceWaylandPresentationSupportKHR GetPhysicalDeviceWaylandPresentationSupportKHR;
+#else
+	PFN_vkVoidFunction GetPhysicalDeviceWaylandPresentationSupportKHR;
+#endif /* VK_USE_PLATFORM_WAYLAND_KHR */
+#ifdef VK_USE_PLATFORM_MIR_KHR
+	PFN_vkCreateMirSurfaceKHR CreateMirSurfaceKHR;
+#else
+	PFN_vkVoidFunction CreateMirSurfaceKHR;
+#endif /* VK_USE_PLATFORM_MIR_KHR */
+#ifdef VK_USE_PLATFORM_MIR_KHR
+	PFN_vkGetPhysicalDeviceMirPresentationSupportKHR GetPhysicalDeviceMirPresentationSupportKHR;
+#else
+	PFN_vkVoidFunction GetPhysicalDeviceMirPresentationSupportKHR;
+#endif /* VK_USE_PLATFORM_MIR_KHR */
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+	PFN_vkCreateAndroidSurfaceKHR CreateAndroidSurfaceKHR;
+#else
+	PFN_vkVoidFunction CreateAndroidSurfaceKHR;
+#endif /* VK_USE_PLATFORM_ANDROID_KHR */
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+	PFN_vkCreateWin32SurfaceKHR CreateWin32SurfaceKHR;
+#else
+	PFN_vkVoidFunction CreateWin32SurfaceKHR;
+#endif /* VK_USE_PLATFORM_WIN32_KHR */
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-extern PFN_vkCreateWin32SurfaceKHR __vkCreateWin32SurfaceKHR;
-extern PFN_vkGetPhysicalDeviceWin32PresentationSupportKHR __vkGetPhysicalDeviceWin32PresentationSupportKHR;
+	PFN_vkGetPhysicalDeviceWin32PresentationSupportKHR GetPhysicalDeviceWin32PresentationSupportKHR;
+#else
+	PFN_vkVoidFunction GetPhysicalDeviceWin32PresentationSupportKHR;
 #endif /* VK_USE_PLATFORM_WIN32_KHR */
+	PFN_vkCreateDebugReportCallbackEXT CreateDebugReportCallbackEXT;
+	PFN_vkDestroyDebugReportCallbackEXT DestroyDebugReportCallbackEXT;
+	PFN_vkDebugReportMessageEXT DebugReportMessageEXT;
+	PFN_vkDebugMarkerSetObjectTagEXT DebugMarkerSetObjectTagEXT;
+	PFN_vkDebugMarkerSetObjectNameEXT DebugMarkerSetObjectNameEXT;
+	PFN_vkCmdDebugMarkerBeginEXT CmdDebugMarkerBeginEXT;
+	PFN_vkCmdDebugMarkerEndEXT CmdDebugMarkerEndEXT;
+	PFN_vkCmdDebugMarkerInsertEXT CmdDebugMarkerInsertEXT;
+	
+	// The device level functions the vk* macros call through, which the inits only ever replace
+	// as a whole. The device level members above keep what vkelInit()/vkelInstanceInit() loaded.
+	const VkelDeviceTable *pDeviceTable;
+} VkelTable;
+
+// All the functions are stored in a single table, so a shared vkel only exports a single
+// symbol (and needs a single relocation) for all of them, instead of one per function
+extern VKEL_API VkelTable vkelTable;
+
+// Read once per call, so a thread that called a function of a new table (like after
+// vkelDeviceInit() recreated a lost device) never calls one of the old table again
+VKEL_INLINE const VkelDeviceTable* vkelGetDeviceTable(void)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return __atomic_load_n(&vkelTable.pDeviceTable, __ATOMIC_ACQUIRE);
+#else
+	return *(const VkelDeviceTable* const volatile*) &vkelTable.pDeviceTable;
+#endif
+}
 
-#ifdef VK_USE_PLATFORM_XCB_KHR
-extern PFN_vkCreateXcbSurfaceKHR __vkCreateXcbSurfaceKHR;
-extern PFN_vkGetPhysicalDeviceXcbPresentationSupportKHR __vkGetPhysicalDeviceXcbPresentationSupportKHR;
-#endif /* VK_USE_PLATFORM_XCB_KHR */
 
-#ifdef VK_USE_PLATFORM_XLIB_KHR
-extern PFN_vkCreateXlibSurfaceKHR __vkCreateXlibSurfaceKHR;
-extern PFN_vkGetPhysicalDeviceXlibPresentationSupportKHR __vkGetPhysicalDeviceXlibPresentationSupportKHR;
-#endif /* VK_USE_PLATFORM_XLIB_KHR */
+// The table of the registered device the handle belongs to, or the one vkelDeviceInit()
+// loaded when the device isn't registered
+VKEL_INLINE const VkelDeviceTable* vkelGetDispatchableTable(const void *dispatchableHandle)
+{
+	const VkelDevice *entry = vkelFindDispatchableDevice(dispatchableHandle);
+	
+	return entry ? &entry->table : vkelGetDeviceTable();
+}
+
+// Device level functions, dispatched to the table of the registered device the
+// handle belongs to, e.g. vkelCmdDraw(commandBuffer, 3, 1, 0, 0)
+VKEL_INLINE void vkelDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator)
+{
+	PFN_vkDestroyDevice destroyDevice;
+	
+	if (!device)
+		return;
+	
+	destroyDevice = vkelGetDispatchableTable(device)->DestroyDevice;
+	
+	vkelUnregisterDevice(device);
+	destroyDevice(device, pAllocator);
+}
+VKEL_INLINE void vkelGetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue* pQueue)
+{
+	vkelGetDispatchableTable(device)->GetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
+}
+VKEL_INLINE VkResult vkelQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence)
+{
+	return vkelGetDispatchableTable(queue)->QueueSubmit(queue, submitCount, pSubmits, fence);
+}
+VKEL_INLINE VkResult vkelQueueWaitIdle(VkQueue queue)
+{
+	return vkelGetDispatchableTable(queue)->QueueWaitIdle(queue);
+}
+VKEL_INLINE VkResult vkelDeviceWaitIdle(VkDevice device)
+{
+	return vkelGetDispatchableTable(device)->DeviceWaitIdle(device);
+}
+VKEL_INLINE VkResult vkelAllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo, const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory)
+{
+	return vkelGetDispatchableTable(device)->AllocateMemory(device, pAllocateInfo, pAllocator, pMemory);
+}
+VKEL_INLINE void vkelFreeMemory(VkDevice device, VkDeviceMemory memory, const VkAllocationCallbacks* pAllocator)
+{
+	vkelGetDispatchableTable(device)->FreeMemory(device, memory, pAllocator);
+}
+VKEL_INLINE VkResult vkelMapMemory(VkDevice device, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size, VkMemoryMapFlags flags, void** ppData)
+{
+	return vkelGetDispatchableTable(device)->MapMemory(device, memory, offset, size, flags, ppData);
+}
+VKEL_INLINE void vkelUnmapMemory(VkDevice device, VkDeviceMemory memory)
+{
+	vkelGetDispatchableTable(device)->UnmapMemory(device, memory);
+}
+VKEL_INLINE VkResult vkelFlushMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount, const VkMappedMemoryRange* pMemoryRanges)
+{
+	return vkelGetDispatchableTable(device)->FlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
+}
+VKEL_INLINE VkResult vkelInvalidateMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount, const VkMappedMemoryRange* pMemoryRanges)
+{
+	return vkelGetDispatchableTable(device)->InvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
+}
+VKEL_INLINE void vkelGetDeviceMemoryCommitment(VkDevice device, VkDeviceMemory memory, VkDeviceSize* pCommittedMemoryInBytes)
+{
+	vkelGetDispatchableTable(device)->GetDeviceMemoryCommitment(device, memory, pCommittedMemoryInBytes);
+}
+VKEL_INLINE VkResult vkelBindBufferMemory(VkDevice device, VkBuffer buffer, VkDeviceMemory memory, VkDeviceSize memoryOffset)
+{
+	return vkelGetDispatchableTable(device)->BindBufferMemory(device, buffer, memory, memoryOffset);
+}
+VKEL_INLINE VkResult vkelBindImageMemory(VkDevice device, VkImage image, VkDeviceMemory memory, VkDeviceSize memoryOffset)
+{
+	return vkelGetDispatchableTable(device)->BindImageMemory(device, image, memory, memoryOffset);
+}
+VKEL_INLINE void vkelGetBufferMemoryRequirements(VkDevice device, VkBuffer buffer, VkMemoryRequirements* pMemoryRequirements)
+{
+	vkelGetDispatchableTable(device)->GetBufferMemoryRequirements(device, buffer, pMemoryRequirements);
+}
+VKEL_INLINE void vkelGetImageMemoryRequirements(VkDevice device, VkImage image, VkMemoryRequirements* pMemoryRequirements)
+{
+	vkelGetDispatchableTable(device)->GetImageMemoryRequirements(device, image, pMemoryRequirements);
+}
+VKEL_INLINE void vkelGetImageSparseMemoryRequirements(VkDevice device, VkImage image, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements* pSparseMemoryRequirements)
+{
+	vkelGetDispatchableTable(device)->GetImageSparseMemoryRequirements(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+}
+VKEL_INLINE VkResult vkelQueueBindSparse(VkQueue queue, uint32_t bindInfoCount, const VkBindSparseInfo* pBindInfo, VkFence fence)
+{
+	return vkelGetDispatchableTable(queue)->QueueBindSparse(queue, bindInfoCount, pBindInfo, fence);
+}
+VKEL_INLINE VkResult vkelCreateFence(VkDevice device, const VkFenceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkFence* pFence)
+{
+	return vkelGetDispatchableTable(device)->CreateFence(device, pCreateInfo, pAllocator, pFence);
+}
+VKEL_INLINE void vkelDestroyFence(VkDevice device, VkFence fence, const VkAllocationCallbacks* pAllocator)
+{
+	vkelGetDispatchableTable(device)->DestroyFence(device, fence, pAllocator);
+}
+VKEL_INLINE VkResult vkelResetFences(VkDevice device, uint32_t fenceCount, const VkFence* pFences)
+{
+	return vkelGetDispatchableTable(device)->ResetFences(device, fenceCount, pFences);
+}
+VKEL_INLINE VkResult vkelGetFenceStatus(VkDevice device, VkFence fence)
+{
+	return vkelGetDispatchableTable(device)->GetFenceStatus(device, fence);
+}
+VKEL_INLINE VkResult vkelWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence* pFences, VkBool32 waitAll, uint64_t timeout)
+{
+	return vkelGetDispatchableTable(device)->WaitForFences(device, fenceCount, pFences, waitAll, timeout);
+}
+VKEL_INLINE VkResult vkelCreateSemaphore(VkDevice device, const VkSemaphoreCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSemaphore* pSemaphore)
+{
+	return vkelGetDispatchableTable(device)->CreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore);
+}
+VKEL_INLINE void vkelDestroySemaphore(VkDevice device, VkSemaphore semaphore, const VkAllocationCallbacks* pAllocator)
+{
+	vkelGetDispatchableTable(device)->DestroySemaphore(device, semaphore, pAllocator);
+}
+VKEL_INLINE VkResult vkelCreateEvent(VkDevice device, const VkEventCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkEvent* pEvent)
+{
+	return vkelGetDispatchableTable(device)->CreateEvent(device, pCreateInfo, pAllocator, pEvent);
+}
+VKEL_INLINE void vkelDestroyEvent(VkDevice device, VkEvent event, const VkAllocationCallbacks* pAllocator)
+{
+	vkelGetDispatchableTable(device)->DestroyEvent(device, event, pAllocator);
+}
+VKEL_INLINE VkResult vkelGetEventStatus(VkDevice device, VkEvent event)
+{
+	return vkelGetDispatchableTable(device)->GetEventStatus(device, event);
+}
+VKEL_INLINE VkResult vkelSetEvent(VkDevice device, VkEvent event)
+{
+	return vkelGetDispatchableTable(device)->SetEvent(device, event);
+}
+VKEL_INLINE VkResult vkelResetEvent(VkDevice device, VkEvent event)
+{
+	return vkelGetDispatchableTable(device)->ResetEvent(device, event);
+}
+VKEL_INLINE VkResult vkelCreateQueryPool(VkDevice device, const VkQueryPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkQueryPool* pQueryPool)
+{
+	return vkelGetDispatchableTable(device)->CreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool);
+}
+VKEL_INLINE void vkelDestroyQueryPool(VkDevice device, VkQueryPool queryPool, const VkAllocationCallbacks* pAllocator)
+{
+	vkelGetDispatchableTable(device)->DestroyQueryPool(device, queryPool, pAllocator);
+}
+VKEL_INLINE VkResult vkelGetQueryPoolResults(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, size_t dataSize, void* pData, VkDeviceSize stride, VkQueryResultFlags flags)
+{
+	return vkelGetDispatchableTable(device)->GetQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
+}
+VKEL_INLINE VkResult vkelCreateBuffer(VkDevice device, const VkBufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBuffer* pBuffer)
+{
+	return vkelGetDispatchableTable(device)->CreateBuffer(device, pCreateInfo, pAllocator, pBuffer);
+}
+VKEL_INLINE void vkelDestroyBuffer(VkDevice device, VkBuffer buffer, const VkAllocationCallbacks* pAllocator)
+{
+	vkelGetDispatchableTable(device)->DestroyBuffer(device, buffer, pAllocator);
+}
+VKEL_INLINE VkResult vkelCreateBufferView(VkDevice device, const VkBufferViewCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBufferView* pView)
+{
+	return vkelGetDispatchableTable(device)->CreateBufferView(device, pCreateInfo, pAllocator, pView);
+}
+VKEL_INLINE void vkelDestroyBufferView(VkDevice device, VkBufferView bufferView, const VkAllocationCallbacks* pAllocator)
+{
+	vkelGetDispatchableTable(device)->DestroyBufferView(device, bufferView, pAllocator);
+}
+VKEL_INLINE VkResult vkelCreateImage(VkDevice device, const VkImageCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkImage* pImage)
+{
+	return vkelGetDispatchableTable(device)->CreateImage(device, pCreateInfo, pAllocator, pImage);
+}
+VKEL_INLINE void vkelDestroyImage(VkDevice device, VkImage image, const VkAllocationCallbacks* pAllocator)
+{
+	vkelGetDispatchableTable(device)->DestroyImage(device, image, pAllocator);
+}
+VKEL_INLINE void vkelGetImageSubresourceLayout(VkDevice device, VkImage image, const VkImageSubresource* pSubresource, VkSubresourceLayout* pLayout)
+{
+	vkelGetDispatchableTable(device)->GetImageSubresourceLayout(device, image, pSubresource, pLayout);
+}
+VKEL_INLINE VkResult vkelCreateImageView(VkDevice device, const VkImageViewCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkImageView* pView)
+{
+	return vkelGetDispatchableTable(device)->CreateImageView(device, pCreateInfo, pAllocator, pView);
+}
+VKEL_INLINE void vkelDestroyImageView(VkDevice device, VkImageView imageView, const VkAllocationCallbacks* pAllocator)
+{
+	vkelGetDispatchableTable(device)->DestroyImageView(device, imageView, pAllocator);
+}
+VKEL_INLINE VkResult vkelCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule)
+{
+	return vkelGetDispatchableTable(device)->CreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule);
+}
+VKEL_INLINE void vkelDestroyShaderModule(VkDevice device, VkShaderModule shaderModule, const VkAllocationCallbacks* pAllocator)
+{
+	vkelGetDispatchableTable(device)->DestroyShaderModule(device, shaderModule, pAllocator);
+}
+VKEL_INLINE VkResult vkelCreatePipelineCache(VkDevice device, const VkPipelineCacheCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineCache* pPipelineCache)
+{
+	return vkelGetDispatchableTable(device)->CreatePipelineCache(device, pCreateInfo, pAllocator, pPipelineCache);
+}
+VKEL_INLINE void vkelDestroyPipelineCache(VkDevice device, VkPipelineCache pipelineCache, const VkAllocationCallbacks* pAllocator)
+{
+	vkelGetDispatchableTable(device)->DestroyPipelineCache(device, pipelineCache, pAllocator);
+}
+VKEL_INLINE VkResult vkelGetPipelineCacheData(VkDevice device, VkPipelineCache pipelineCache, size_t* pDataSize, void* pData)
+{
+	return vkelGetDispatchableTable(device)->GetPipelineCacheData(device, pipelineCache, pDataSize, pData);
+}
+VKEL_INLINE VkResult vkelMergePipelineCaches(VkDevice device, VkPipelineCache dstCache, uint32_t srcCacheCount, const VkPipelineCache* pSrcCaches)
+{
+	return vkelGetDispatchableTable(device)->MergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches);
+}
+VKEL_INLINE VkResult vkelCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkGraphicsPipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines)
+{
+	return vkelGetDispatchableTable(device)->CreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+}
+VKEL_INLINE VkResult vkelCreateComputePipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkComputePipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines)
+{
+	return vkelGetDispatchableTable(device)->CreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+}
+VKEL_INLINE void vkelDestroyPipeline(VkDevice device, VkPipeline pipeline, const VkAllocationCallbacks* pAllocator)
+{
+	vkelGetDispatchableTable(device)->DestroyPipeline(device, pipeline, pAllocator);
+}
+VKEL_INLINE VkResult vkelCreatePipelineLayout(VkDevice device, const VkPipelineLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineLayout* pPipelineLayout)
+{
+	return vkelGetDispatchableTable(device)->CreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout);
+}
+VKEL_INLINE void vkelDestroyPipelineLayout(VkDevice device, VkPipelineLayout pipelineLayout, const VkAllocationCallbacks* pAllocator)
+{
+	vkelGetDispatchableTable(device)->DestroyPipelineLayout(device, pipelineLayout, pAllocator);
+}
+VKEL_INLINE VkResult vkelCreateSampler(VkDevice device, const VkSamplerCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSampler* pSampler)
+{
+	return vkelGetDispatchableTable(device)->CreateSampler(device, pCreateInfo, pAllocator, pSampler);
+}
+VKEL_INLINE void vkelDestroySampler(VkDevice device, VkSampler sampler, const VkAllocationCallbacks* pAllocator)
+{
+	vkelGetDispatchableTable(device)->DestroySampler(device, sampler, pAllocator);
+}
+VKEL_INLINE VkResult vkelCreateDescriptorSetLayout(VkDevice device, const VkDescriptorSetLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorSetLayout* pSetLayout)
+{
+	return vkelGetDispatchableTable(device)->CreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout);
+}
+VKEL_INLINE void vkelDestroyDescriptorSetLayout(VkDevice device, VkDescriptorSetLayout descriptorSetLayout, const VkAllocationCallbacks* pAllocator)
+{
+	vkelGetDispatchableTable(device)->DestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
+}
+VKEL_INLINE VkResult vkelCreateDescriptorPool(VkDevice device, const VkDescriptorPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorPool* pDescriptorPool)
+{
+	return vkelGetDispatchableTable(device)->CreateDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool);
+}
+VKEL_INLINE void vkelDestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool, const VkAllocationCallbacks* pAllocator)
+{
+	vkelGetDispatchableTable(device)->DestroyDescriptorPool(device, descriptorPool, pAllocator);
+}
+VKEL_INLINE VkResult vkelResetDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool, VkDescriptorPoolResetFlags flags)
+{
+	return vkelGetDispatchableTable(device)->ResetDescriptorPool(device, descriptorPool, flags);
+}
+VKEL_INLINE VkResult vkelAllocateDescriptorSets(VkDevice device, const VkDescriptorSetAllocateInfo* pAllocateInfo, VkDescriptorSet* pDescriptorSets)
+{
+	return vkelGetDispatchableTable(device)->AllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
+}
+VKEL_INLINE VkResult vkelFreeDescriptorSets(VkDevice device, VkDescriptorPool descriptorPool, uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets)
+{
+	return vkelGetDispatchableTable(device)->FreeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets);
+}
+VKEL_INLINE void vkelUpdateDescriptorSets(VkDevice device, uint32_t descriptorWriteCount, const VkWriteDescriptorSet* pDescriptorWrites, uint32_t descriptorCopyCount, const VkCopyDescriptorSet* pDescriptorCopies)
+{
+	vkelGetDispatchableTable(device)->UpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
+}
+VKEL_INLINE VkResult vkelCreateFramebuffer(VkDevice device, const VkFramebufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkFramebuffer* pFramebuffer)
+{
+	return vkelGetDispatchableTable(device)->CreateFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer);
+}
+VKEL_INLINE void vkelDestroyFramebuffer(VkDevice device, VkFramebuffer framebuffer, const VkAllocationCallbacks* pAllocator)
+{
+	vkelGetDispatchableTable(device)->DestroyFramebuffer(device, framebuffer, pAllocator);
+}
+VKEL_INLINE VkResult vkelCreateRenderPass(VkDevice device, const VkRenderPassCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass)
+{
+	return vkelGetDispatchableTable(device)->CreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass);
+}
+VKEL_INLINE void vkelDestroyRenderPass(VkDevice device, VkRenderPass renderPass, const VkAllocationCallbacks* pAllocator)
+{
+	vkelGetDispatchableTable(device)->DestroyRenderPass(device, renderPass, pAllocator);
+}
+VKEL_INLINE void vkelGetRenderAreaGranularity(VkDevice device, VkRenderPass renderPass, VkExtent2D* pGranularity)
+{
+	vkelGetDispatchableTable(device)->GetRenderAreaGranularity(device, renderPass, pGranularity);
+}
+VKEL_INLINE VkResult vkelCreateCommandPool(VkDevice device, const VkCommandPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkCommandPool* pCommandPool)
+{
+	return vkelGetDispatchableTable(device)->CreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool);
+}
+VKEL_INLINE void vkelDestroyCommandPool(VkDevice device, VkCommandPool commandPool, const VkAllocationCallbacks* pAllocator)
+{
+	vkelGetDispatchableTable(device)->DestroyCommandPool(device, commandPool, pAllocator);
+}
+VKEL_INLINE VkResult vkelResetCommandPool(VkDevice device, VkCommandPool commandPool, VkCommandPoolResetFlags flags)
+{
+	return vkelGetDispatchableTable(device)->ResetCommandPool(device, commandPool, flags);
+}
+VKEL_INLINE VkResult vkelAllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo* pAllocateInfo, VkCommandBuffer* pCommandBuffers)
+{
+	return vkelGetDispatchableTable(device)->AllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers);
+}
+VKEL_INLINE void vkelFreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount, const VkCommandBuffer* pCommandBuffers)
+{
+	vkelGetDispatchableTable(device)->FreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
+}
+VKEL_INLINE VkResult vkelBeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo* pBeginInfo)
+{
+	return vkelGetDispatchableTable(commandBuffer)->BeginCommandBuffer(commandBuffer, pBeginInfo);
+}
+VKEL_INLINE VkResult vkelEndCommandBuffer(VkCommandBuffer commandBuffer)
+{
+	return vkelGetDispatchableTable(commandBuffer)->EndCommandBuffer(commandBuffer);
+}
+VKEL_INLINE VkResult vkelResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags)
+{
+	return vkelGetDispatchableTable(commandBuffer)->ResetCommandBuffer(commandBuffer, flags);
+}
+VKEL_INLINE void vkelCmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
+}
+VKEL_INLINE void vkelCmdSetViewport(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkViewport* pViewports)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
+}
+VKEL_INLINE void vkelCmdSetScissor(VkCommandBuffer commandBuffer, uint32_t firstScissor, uint32_t scissorCount, const VkRect2D* pScissors)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
+}
+VKEL_INLINE void vkelCmdSetLineWidth(VkCommandBuffer commandBuffer, float lineWidth)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdSetLineWidth(commandBuffer, lineWidth);
+}
+VKEL_INLINE void vkelCmdSetDepthBias(VkCommandBuffer commandBuffer, float depthBiasConstantFactor, float depthBiasClamp, float depthBiasSlopeFactor)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
+}
+VKEL_INLINE void vkelCmdSetBlendConstants(VkCommandBuffer commandBuffer, const float blendConstants[4])
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdSetBlendConstants(commandBuffer, blendConstants);
+}
+VKEL_INLINE void vkelCmdSetDepthBounds(VkCommandBuffer commandBuffer, float minDepthBounds, float maxDepthBounds)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
+}
+VKEL_INLINE void vkelCmdSetStencilCompareMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t compareMask)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
+}
+VKEL_INLINE void vkelCmdSetStencilWriteMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t writeMask)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
+}
+VKEL_INLINE void vkelCmdSetStencilReference(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t reference)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdSetStencilReference(commandBuffer, faceMask, reference);
+}
+VKEL_INLINE void vkelCmdBindDescriptorSets(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t firstSet, uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets, uint32_t dynamicOffsetCount, const uint32_t* pDynamicOffsets)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
+}
+VKEL_INLINE void vkelCmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkIndexType indexType)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
+}
+VKEL_INLINE void vkelCmdBindVertexBuffers(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, const VkBuffer* pBuffers, const VkDeviceSize* pOffsets)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
+}
+VKEL_INLINE void vkelCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
+}
+VKEL_INLINE void vkelCmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
+}
+VKEL_INLINE void vkelCmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
+}
+VKEL_INLINE void vkelCmdDrawIndexedIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
+}
+VKEL_INLINE void vkelCmdDispatch(VkCommandBuffer commandBuffer, uint32_t x, uint32_t y, uint32_t z)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdDispatch(commandBuffer, x, y, z);
+}
+VKEL_INLINE void vkelCmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdDispatchIndirect(commandBuffer, buffer, offset);
+}
+VKEL_INLINE void vkelCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, uint32_t regionCount, const VkBufferCopy* pRegions)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
+}
+VKEL_INLINE void vkelCmdCopyImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageCopy* pRegions)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+}
+VKEL_INLINE void vkelCmdBlitImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageBlit* pRegions, VkFilter filter)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
+}
+VKEL_INLINE void vkelCmdCopyBufferToImage(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkBufferImageCopy* pRegions)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
+}
+VKEL_INLINE void vkelCmdCopyImageToBuffer(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkBuffer dstBuffer, uint32_t regionCount, const VkBufferImageCopy* pRegions)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
+}
+VKEL_INLINE void vkelCmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize dataSize, const void* pData)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
+}
+VKEL_INLINE void vkelCmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize size, uint32_t data)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
+}
+VKEL_INLINE void vkelCmdClearColorImage(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const VkClearColorValue* pColor, uint32_t rangeCount, const VkImageSubresourceRange* pRanges)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
+}
+VKEL_INLINE void vkelCmdClearDepthStencilImage(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const VkClearDepthStencilValue* pDepthStencil, uint32_t rangeCount, const VkImageSubresourceRange* pRanges)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
+}
+VKEL_INLINE void vkelCmdClearAttachments(VkCommandBuffer commandBuffer, uint32_t attachmentCount, const VkClearAttachment* pAttachments, uint32_t rectCount, const VkClearRect* pRects)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
+}
+VKEL_INLINE void vkelCmdResolveImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageResolve* pRegions)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+}
+VKEL_INLINE void vkelCmdSetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdSetEvent(commandBuffer, event, stageMask);
+}
+VKEL_INLINE void vkelCmdResetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdResetEvent(commandBuffer, event, stageMask);
+}
+VKEL_INLINE void vkelCmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers, uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+}
+VKEL_INLINE void vkelCmdPipelineBarrier(VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, VkDependencyFlags dependencyFlags, uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers, uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+}
+VKEL_INLINE void vkelCmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query, VkQueryControlFlags flags)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdBeginQuery(commandBuffer, queryPool, query, flags);
+}
+VKEL_INLINE void vkelCmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdEndQuery(commandBuffer, queryPool, query);
+}
+VKEL_INLINE void vkelCmdResetQueryPool(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
+}
+VKEL_INLINE void vkelCmdWriteTimestamp(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage, VkQueryPool queryPool, uint32_t query)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
+}
+VKEL_INLINE void vkelCmdCopyQueryPoolResults(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize stride, VkQueryResultFlags flags)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
+}
+VKEL_INLINE void vkelCmdPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout layout, VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size, const void* pValues)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
+}
+VKEL_INLINE void vkelCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin, VkSubpassContents contents)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
+}
+VKEL_INLINE void vkelCmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpassContents contents)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdNextSubpass(commandBuffer, contents);
+}
+VKEL_INLINE void vkelCmdEndRenderPass(VkCommandBuffer commandBuffer)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdEndRenderPass(commandBuffer);
+}
+VKEL_INLINE void vkelCmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount, const VkCommandBuffer* pCommandBuffers)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
+}
+VKEL_INLINE VkResult vkelCreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchain)
+{
+	return vkelGetDispatchableTable(device)->CreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain);
+}
+VKEL_INLINE void vkelDestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain, const VkAllocationCallbacks* pAllocator)
+{
+	vkelGetDispatchableTable(device)->DestroySwapchainKHR(device, swapchain, pAllocator);
+}
+VKEL_INLINE VkResult vkelGetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchain, uint32_t* pSwapchainImageCount, VkImage* pSwapchainImages)
+{
+	return vkelGetDispatchableTable(device)->GetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages);
+}
+VKEL_INLINE VkResult vkelAcquireNextImageKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout, VkSemaphore semaphore, VkFence fence, uint32_t* pImageIndex)
+{
+	return vkelGetDispatchableTable(device)->AcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex);
+}
+VKEL_INLINE VkResult vkelQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR* pPresentInfo)
+{
+	return vkelGetDispatchableTable(queue)->QueuePresentKHR(queue, pPresentInfo);
+}
+VKEL_INLINE VkResult vkelCreateSharedSwapchainsKHR(VkDevice device, uint32_t swapchainCount, const VkSwapchainCreateInfoKHR* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchains)
+{
+	return vkelGetDispatchableTable(device)->CreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
+}
+VKEL_INLINE VkResult vkelDebugMarkerSetObjectTagEXT(VkDevice device, VkDebugMarkerObjectTagInfoEXT* pTagInfo)
+{
+	return vkelGetDispatchableTable(device)->DebugMarkerSetObjectTagEXT(device, pTagInfo);
+}
+VKEL_INLINE VkResult vkelDebugMarkerSetObjectNameEXT(VkDevice device, VkDebugMarkerObjectNameInfoEXT* pNameInfo)
+{
+	return vkelGetDispatchableTable(device)->DebugMarkerSetObjectNameEXT(device, pNameInfo);
+}
+VKEL_INLINE void vkelCmdDebugMarkerBeginEXT(VkCommandBuffer commandBuffer, VkDebugMarkerMarkerInfoEXT* pMarkerInfo)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo);
+}
+VKEL_INLINE void vkelCmdDebugMarkerEndEXT(VkCommandBuffer commandBuffer)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdDebugMarkerEndEXT(commandBuffer);
+}
+VKEL_INLINE void vkelCmdDebugMarkerInsertEXT(VkCommandBuffer commandBuffer, VkDebugMarkerMarkerInfoEXT* pMarkerInfo)
+{
+	vkelGetDispatchableTable(commandBuffer)->CmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo);
+}
+
+typedef const VkelTable* (*PFN_vkelGetSharedTable)(void);
+
+// Returns NULL until vkel has been initialized
+extern VKEL_API const VkelTable* vkelGetTable(void);
+
+// Building vkel.c with VKEL_FALLBACK_STUBS fills the functions that couldn't be loaded with
+// stubs instead of NULL, so optional commands can be called without checking them first. The
+// void ones do nothing, while the rest return VK_ERROR_EXTENSION_NOT_PRESENT (or 0). Use
+// vkelHasFunction(CmdDebugMarkerBeginEXT) to check whether a function was actually loaded.
+extern VKEL_API VkBool32 vkelIsFunctionLoaded(size_t tableOffset);
+#define vkelHasFunction(name) vkelIsFunctionLoaded(offsetof(VkelTable, name))
+
+// Use the functions and capabilities of a table from another copy of vkel, instead of
+// loading the library. The table is used as is, so the other copy must stay initialized.
+extern VKEL_API VkBool32 vkelInitFromTable(const VkelTable *pTable);
+
+// Use the table exported by the application (see VKEL_EXPORT_TABLE) if there is one,
+// otherwise it's the same as vkelInit()
+extern VKEL_API VkBool32 vkelInitShared(void);
+
+
+// Additional Vulkan implementations loaded side by side with the one behind the vk* macros,
+// like a CPU implementation (e.g. lavapipe or SwiftShader) next to the hardware driver. Each
+// context has its own library, table and capabilities, and never touches vkelTable.
+VK_DEFINE_HANDLE(VkelContext)
+
+// pPath is an ICD manifest (.json), an ICD library or a Vulkan loader library. The table
+// only has the global functions (like vkCreateInstance) until vkelContextInstanceInit().
+// Returns NULL if the library couldn't be loaded.
+extern VKEL_API VkelContext vkelCreateContext(const char *pPath);
+// Only the context's own instances and devices must be used with it
+extern VKEL_API VkBool32 vkelContextInstanceInit(VkelContext context, VkInstance instance);
+extern VKEL_API VkBool32 vkelContextDeviceInit(VkelContext context, VkPhysicalDevice physicalDevice, VkDevice device);
+// Must be called after everything created with the context is destroyed
+extern VKEL_API void vkelDestroyContext(VkelContext context);
+
+// Valid until the context is destroyed, and updated in place by the inits
+extern VKEL_API const VkelTable* vkelGetContextTable(VkelContext context);
+extern VKEL_API const VkelCapabilities* vkelGetContextInstanceCapabilities(VkelContext context);
+extern VKEL_API const VkelCapabilities* vkelGetContextDeviceCapabilities(VkelContext context);
+
+// Defining VKEL_EXPORT_TABLE when building the application's vkel.c exports vkelGetSharedTable(),
+// which is what vkelInitShared() looks for. On Linux the application must be linked using -rdynamic.
+#ifdef VKEL_EXPORT_TABLE
+#	if defined(_WIN32)
+#		define VKEL_EXPORT __declspec(dllexport)
+#	else
+#		define VKEL_EXPORT __attribute__((visibility("default")))
+#	endif
+
+extern VKEL_EXPORT const VkelTable* vkelGetSharedTable(void);
+#endif /* VKEL_EXPORT_TABLE */
+
+
+// Defining VKEL_THREAD_DEVICE (when building vkel.c and everywhere vkel.h is included) makes
+// the vk* macros of device level functions call through a table bound to the calling thread,
+// instead of vkelTable.pDeviceTable. See vkelBindDevice().
+#ifdef VKEL_THREAD_DEVICE
+#	if defined(_WIN32) && defined(VKEL_SHARED)
+#		error VKEL_THREAD_DEVICE needs vkel to be built into the application on Windows, as thread-local variables cannot be imported
+#	endif
+
+// NULL for threads that haven't bound a device, which use vkelTable.pDeviceTable
+extern VKEL_THREAD_LOCAL VKEL_API const VkelDeviceTable *vkelThreadDeviceTable;
+
+// Bind the table of a registered device (see vkelRegisterDevice()) to the calling thread,
+// so the vk* macros of device level functions call that device's driver directly. Binding
+// VK_NULL_HANDLE goes back to the functions loaded by vkelDeviceInit(). Bound threads should
+// be online (see vkelQuiescent()), as a device that was unregistered goes back to those at the
+// next quiescent point. Returns VK_FALSE (and keeps the binding) if the device isn't registered.
+extern VKEL_API VkBool32 vkelBindDevice(VkDevice device);
+
+#	define VKEL_DEVICE_FUNCTION(name) ((vkelThreadDeviceTable ? vkelThreadDeviceTable : vkelGetDeviceTable())->name)
+#else
+#	define VKEL_DEVICE_FUNCTION(name) (vkelGetDeviceTable()->name)
+#endif /* VKEL_THREAD_DEVICE */
+
+
+// Functions
 
-#define vkAcquireNextImageKHR __vkAcquireNextImageKHR
-#define vkAllocateCommandBuffers __vkAllocateCommandBuffers
-#define vkAllocateDescriptorSets __vkAllocateDescriptorSets
-#define vkAllocateMemory __vkAllocateMemory
-#define vkAllocationFunction __vkAllocationFunction
-#define vkBeginCommandBuffer __vkBeginCommandBuffer
-#define vkBindBufferMemory __vkBindBufferMemory
-#define vkBindImageMemory __vkBindImageMemory
-#define vkCmdBeginQuery __vkCmdBeginQuery
-#define vkCmdBeginRenderPass __vkCmdBeginRenderPass
-#define vkCmdBindDescriptorSets __vkCmdBindDescriptorSets
-#define vkCmdBindIndexBuffer __vkCmdBindIndexBuffer
-#define vkCmdBindPipeline __vkCmdBindPipeline
-#define vkCmdBindVertexBuffers __vkCmdBindVertexBuffers
-#define vkCmdBlitImage __vkCmdBlitImage
-#define vkCmdClearAttachments __vkCmdClearAttachments
-#define vkCmdClearColorImage __vkCmdClearColorImage
-#define vkCmdClearDepthStencilImage __vkCmdClearDepthStencilImage
-#define vkCmdCopyBuffer __vkCmdCopyBuffer
-#define vkCmdCopyBufferToImage __vkCmdCopyBufferToImage
-#define vkCmdCopyImage __vkCmdCopyImage
-#define vkCmdCopyImageToBuffer __vkCmdCopyImageToBuffer
-#define vkCmdCopyQueryPoolResults __vkCmdCopyQueryPoolResults
-#define vkCmdDebugMarkerBeginEXT __vkCmdDebugMarkerBeginEXT
-#define vkCmdDebugMarkerEndEXT __vkCmdDebugMarkerEndEXT
-#define vkCmdDebugMarkerInsertEXT __vkCmdDebugMarkerInsertEXT
-#define vkCmdDispatch __vkCmdDispatch
-#define vkCmdDispatchIndirect __vkCmdDispatchIndirect
-#define vkCmdDraw __vkCmdDraw
-#define vkCmdDrawIndexed __vkCmdDrawIndexed
-#define vkCmdDrawIndexedIndirect __vkCmdDrawIndexedIndirect
-#define vkCmdDrawIndirect __vkCmdDrawIndirect
-#define vkCmdEndQuery __vkCmdEndQuery
-#define vkCmdEndRenderPass __vkCmdEndRenderPass
-#define vkCmdExecuteCommands __vkCmdExecuteCommands
-#define vkCmdFillBuffer __vkCmdFillBuffer
-#define vkCmdNextSubpass __vkCmdNextSubpass
-#define vkCmdPipelineBarrier __vkCmdPipelineBarrier
-#define vkCmdPushConstants __vkCmdPushConstants
-#define vkCmdResetEvent __vkCmdResetEvent
-#define vkCmdResetQueryPool __vkCmdResetQueryPool
-#define vkCmdResolveImage __vkCmdResolveImage
-#define vkCmdSetBlendConstants __vkCmdSetBlendConstants
-#define vkCmdSetDepthBias __vkCmdSetDepthBias
-#define vkCmdSetDepthBounds __vkCmdSetDepthBounds
-#define vkCmdSetEvent __vkCmdSetEvent
-#define vkCmdSetLineWidth __vkCmdSetLineWidth
-#define vkCmdSetScissor __vkCmdSetScissor
-#define vkCmdSetStencilCompareMask __vkCmdSetStencilCompareMask
-#define vkCmdSetStencilReference __vkCmdSetStencilReference
-#define vkCmdSetStencilWriteMask __vkCmdSetStencilWriteMask
-#define vkCmdSetViewport __vkCmdSetViewport
-#define vkCmdUpdateBuffer __vkCmdUpdateBuffer
-#define vkCmdWaitEvents __vkCmdWaitEvents
-#define vkCmdWriteTimestamp __vkCmdWriteTimestamp
-#define vkCreateBuffer __vkCreateBuffer
-#define vkCreateBufferView __vkCreateBufferView
-#define vkCreateCommandPool __vkCreateCommandPool
-#define vkCreateComputePipelines __vkCreateComputePipelines
-#define vkCreateDebugReportCallbackEXT __vkCreateDebugReportCallbackEXT
-#define vkCreateDescriptorPool __vkCreateDescriptorPool
-#define vkCreateDescriptorSetLayout __vkCreateDescriptorSetLayout
-#define vkCreateDevice __vkCreateDevice
-#define vkCreateDisplayModeKHR __vkCreateDisplayModeKHR
-#define vkCreateDisplayPlaneSurfaceKHR __vkCreateDisplayPlaneSurfaceKHR
-#define vkCreateEvent __vkCreateEvent
-#define vkCreateFence __vkCreateFence
-#define vkCreateFramebuffer __vkCreateFramebuffer
-#define vkCreateGraphicsPipelines __vkCreateGraphicsPipelines
-#define vkCreateImage __vkCreateImage
-#define vkCreateImageView __vkCreateImageView
-#define vkCreateInstance __vkCreateInstance
-#define vkCreatePipelineCache __vkCreatePipelineCache
-#define vkCreatePipelineLayout __vkCreatePipelineLayout
-#define vkCreateQueryPool __vkCreateQueryPool
-#define vkCreateRenderPass __vkCreateRenderPass
-#define vkCreateSampler __vkCreateSampler
-#define vkCreateSemaphore __vkCreateSemaphore
-#define vkCreateShaderModule __vkCreateShaderModule
-#define vkCreateSharedSwapchainsKHR __vkCreateSharedSwapchainsKHR
-#define vkCreateSwapchainKHR __vkCreateSwapchainKHR
-#define vkDebugMarkerSetObjectNameEXT __vkDebugMarkerSetObjectNameEXT
-#define vkDebugMarkerSetObjectTagEXT __vkDebugMarkerSetObjectTagEXT
-#define vkDebugReportCallbackEXT __vkDebugReportCallbackEXT
-#define vkDebugReportMessageEXT __vkDebugReportMessageEXT
-#define vkDestroyBuffer __vkDestroyBuffer
-#define vkDestroyBufferView __vkDestroyBufferView
-#define vkDestroyCommandPool __vkDestroyCommandPool
-#define vkDestroyDebugReportCallbackEXT __vkDestroyDebugReportCallbackEXT
-#define vkDestroyDescriptorPool __vkDestroyDescriptorPool
-#define vkDestroyDescriptorSetLayout __vkDestroyDescriptorSetLayout
-#define vkDestroyDevice __vkDestroyDevice
-#define vkDestroyEvent __vkDestroyEvent
-#define vkDestroyFence __vkDestroyFence
-#define vkDestroyFramebuffer __vkDestroyFramebuffer
-#define vkDestroyImage __vkDestroyImage
-#define vkDestroyImageView __vkDestroyImageView
-#define vkDestroyInstance __vkDestroyInstance
-#define vkDestroyPipeline __vkDestroyPipeline
-#define vkDestroyPipelineCache __vkDestroyPipelineCache
-#define vkDestroyPipelineLayout __vkDestroyPipelineLayout
-#define vkDestroyQueryPool __vkDestroyQueryPool
-#define vkDestroyRenderPass __vkDestroyRenderPass
-#define vkDestroySampler __vkDestroySampler
-#define vkDestroySemaphore __vkDestroySemaphore
-#define vkDestroyShaderModule __vkDestroyShaderModule
-#define vkDestroySurfaceKHR __vkDestroySurfaceKHR
-#define vkDestroySwapchainKHR __vkDestroySwapchainKHR
-#define vkDeviceWaitIdle __vkDeviceWaitIdle
-#define vkEndCommandBuffer __vkEndCommandBuffer
-#define vkEnumerateDeviceExtensionProperties __vkEnumerateDeviceExtensionProperties
-#define vkEnumerateDeviceLayerProperties __vkEnumerateDeviceLayerProperties
-#define vkEnumerateInstanceExtensionProperties __vkEnumerateInstanceExtensionProperties
-#define vkEnumerateInstanceLayerProperties __vkEnumerateInstanceLayerProperties
-#define vkEnumeratePhysicalDevices __vkEnumeratePhysicalDevices
-#define vkFlushMappedMemoryRanges __vkFlushMappedMemoryRanges
-#define vkFreeCommandBuffers __vkFreeCommandBuffers
-#define vkFreeDescriptorSets __vkFreeDescriptorSets
-#define vkFreeFunction __vkFreeFunction
-#define vkFreeMemory __vkFreeMemory
-#define vkGetBufferMemoryRequirements __vkGetBufferMemoryRequirements
-#define vkGetDeviceMemoryCommitment __vkGetDeviceMemoryCommitment
-#define vkGetDeviceProcAddr __vkGetDeviceProcAddr
-#define vkGetDeviceQueue __vkGetDeviceQueue
-#define vkGetDisplayModePropertiesKHR __vkGetDisplayModePropertiesKHR
-#define vkGetDisplayPlaneCapabilitiesKHR __vkGetDisplayPlaneCapabilitiesKHR
-#define vkGetDisplayPlaneSupportedDisplaysKHR __vkGetDisplayPlaneSupportedDisplaysKHR
-#define vkGetEventStatus __vkGetEventStatus
-#define vkGetFenceStatus __vkGetFenceStatus
-#define vkGetImageMemoryRequirements __vkGetImageMemoryRequirements
-#define vkGetImageSparseMemoryRequirements __vkGetImageSparseMemoryRequirements
-#define vkGetImageSubresourceLayout __vkGetImageSubresourceLayout
-#define vkGetInstanceProcAddr __vkGetInstanceProcAddr
-#define vkGetPhysicalDeviceDisplayPlanePropertiesKHR __vkGetPhysicalDeviceDisplayPlanePropertiesKHR
-#define vkGetPhysicalDeviceDisplayPropertiesKHR __vkGetPhysicalDeviceDisplayPropertiesKHR
-#define vkGetPhysicalDeviceFeatures __vkGetPhysicalDeviceFeatures
-#define vkGetPhysicalDeviceFormatProperties __vkGetPhysicalDeviceFormatProperties
-#define vkGetPhysicalDeviceImageFormatProperties __vkGetPhysicalDeviceImageFormatProperties
-#define vkGetPhysicalDeviceMemoryProperties __vkGetPhysicalDeviceMemoryProperties
-#define vkGetPhysicalDeviceProperties __vkGetPhysicalDeviceProperties
-#define vkGetPhysicalDeviceQueueFamilyProperties __vkGetPhysicalDeviceQueueFamilyProperties
-#define vkGetPhysicalDeviceSparseImageFormatProperties __vkGetPhysicalDeviceSparseImageFormatProperties
-#define vkGetPhysicalDeviceSurfaceCapabilitiesKHR __vkGetPhysicalDeviceSurfaceCapabilitiesKHR
-#define vkGetPhysicalDeviceSurfaceFormatsKHR __vkGetPhysicalDeviceSurfaceFormatsKHR
-#define vkGetPhysicalDeviceSurfacePresentModesKHR __vkGetPhysicalDeviceSurfacePresentModesKHR
-#define vkGetPhysicalDeviceSurfaceSupportKHR __vkGetPhysicalDeviceSurfaceSupportKHR
-#define vkGetPipelineCacheData __vkGetPipelineCacheData
-#define vkGetQueryPoolResults __vkGetQueryPoolResults
-#define vkGetRenderAreaGranularity __vkGetRenderAreaGranularity
-#define vkGetSwapchainImagesKHR __vkGetSwapchainImagesKHR
-#define vkInternalAllocationNotification __vkInternalAllocationNotification
-#define vkInternalFreeNotification __vkInternalFreeNotification
-#define vkInvalidateMappedMemoryRanges __vkInvalidateMappedMemoryRanges
-#define vkMapMemory __vkMapMemory
-#define vkMergePipelineCaches __vkMergePipelineCaches
-#define vkQueueBindSparse __vkQueueBindSparse
-#define vkQueuePresentKHR __vkQueuePresentKHR
-#define vkQueueSubmit __vkQueueSubmit
-#define vkQueueWaitIdle __vkQueueWaitIdle
-#define vkReallocationFunction __vkReallocationFunction
-#define vkResetCommandBuffer __vkResetCommandBuffer
-#define vkResetCommandPool __vkResetCommandPool
-#define vkResetDescriptorPool __vkResetDescriptorPool
-#define vkResetEvent __vkResetEvent
-#define vkResetFences __vkResetFences
-#define vkSetEvent __vkSetEvent
-#define vkUnmapMemory __vkUnmapMemory
-#define vkUpdateDescriptorSets __vkUpdateDescriptorSets
-#define vkVoidFunction __vkVoidFunction
-#define vkWaitForFences __vkWaitForFences
+#ifndef VKEL_NO_FUNCTION_MACROS
+
+#define vkAcquireNextImageKHR VKEL_DEVICE_FUNCTION(AcquireNextImageKHR)
+#define vkAllocateCommandBuffers VKEL_DEVICE_FUNCTION(AllocateCommandBuffers)
+#define vkAllocateDescriptorSets VKEL_DEVICE_FUNCTION(AllocateDescriptorSets)
+#define vkAllocateMemory VKEL_DEVICE_FUNCTION(AllocateMemory)
+#define vkBeginCommandBuffer VKEL_DEVICE_FUNCTION(BeginCommandBuffer)
+#define vkBindBufferMemory VKEL_DEVICE_FUNCTION(BindBufferMemory)
+#define vkBindImageMemory VKEL_DEVICE_FUNCTION(BindImageMemory)
+#define vkCmdBeginQuery VKEL_DEVICE_FUNCTION(CmdBeginQuery)
+#define vkCmdBeginRenderPass VKEL_DEVICE_FUNCTION(CmdBeginRenderPass)
+#define vkCmdBindDescriptorSets VKEL_DEVICE_FUNCTION(CmdBindDescriptorSets)
+#define vkCmdBindIndexBuffer VKEL_DEVICE_FUNCTION(CmdBindIndexBuffer)
+#define vkCmdBindPipeline VKEL_DEVICE_FUNCTION(CmdBindPipeline)
+#define vkCmdBindVertexBuffers VKEL_DEVICE_FUNCTION(CmdBindVertexBuffers)
+#define vkCmdBlitImage VKEL_DEVICE_FUNCTION(CmdBlitImage)
+#define vkCmdClearAttachments VKEL_DEVICE_FUNCTION(CmdClearAttachments)
+#define vkCmdClearColorImage VKEL_DEVICE_FUNCTION(CmdClearColorImage)
+#define vkCmdClearDepthStencilImage VKEL_DEVICE_FUNCTION(CmdClearDepthStencilImage)
+#define vkCmdCopyBuffer VKEL_DEVICE_FUNCTION(CmdCopyBuffer)
+#define vkCmdCopyBufferToImage VKEL_DEVICE_FUNCTION(CmdCopyBufferToImage)
+#define vkCmdCopyImage VKEL_DEVICE_FUNCTION(CmdCopyImage)
+#define vkCmdCopyImageToBuffer VKEL_DEVICE_FUNCTION(CmdCopyImageToBuffer)
+#define vkCmdCopyQueryPoolResults VKEL_DEVICE_FUNCTION(CmdCopyQueryPoolResults)
+#define vkCmdDebugMarkerBeginEXT VKEL_DEVICE_FUNCTION(CmdDebugMarkerBeginEXT)
+#define vkCmdDebugMarkerEndEXT VKEL_DEVICE_FUNCTION(CmdDebugMarkerEndEXT)
+#define vkCmdDebugMarkerInsertEXT VKEL_DEVICE_FUNCTION(CmdDebugMarkerInsertEXT)
+#define vkCmdDispatch VKEL_DEVICE_FUNCTION(CmdDispatch)
+#define vkCmdDispatchIndirect VKEL_DEVICE_FUNCTION(CmdDispatchIndirect)
+#define vkCmdDraw VKEL_DEVICE_FUNCTION(CmdDraw)
+#define vkCmdDrawIndexed VKEL_DEVICE_FUNCTION(CmdDrawIndexed)
+#define vkCmdDrawIndexedIndirect VKEL_DEVICE_FUNCTION(CmdDrawIndexedIndirect)
+#define vkCmdDrawIndirect VKEL_DEVICE_FUNCTION(CmdDrawIndirect)
+#define vkCmdEndQuery VKEL_DEVICE_FUNCTION(CmdEndQuery)
+#define vkCmdEndRenderPass VKEL_DEVICE_FUNCTION(CmdEndRenderPass)
+#define vkCmdExecuteCommands VKEL_DEVICE_FUNCTION(CmdExecuteCommands)
+#define vkCmdFillBuffer VKEL_DEVICE_FUNCTION(CmdFillBuffer)
+#define vkCmdNextSubpass VKEL_DEVICE_FUNCTION(CmdNextSubpass)
+#define vkCmdPipelineBarrier VKEL_DEVICE_FUNCTION(CmdPipelineBarrier)
+#define vkCmdPushConstants VKEL_DEVICE_FUNCTION(CmdPushConstants)
+#define vkCmdResetEvent VKEL_DEVICE_FUNCTION(CmdResetEvent)
+#define vkCmdResetQueryPool VKEL_DEVICE_FUNCTION(CmdResetQueryPool)
+#define vkCmdResolveImage VKEL_DEVICE_FUNCTION(CmdResolveImage)
+#define vkCmdSetBlendConstants VKEL_DEVICE_FUNCTION(CmdSetBlendConstants)
+#define vkCmdSetDepthBias VKEL_DEVICE_FUNCTION(CmdSetDepthBias)
+#define vkCmdSetDepthBounds VKEL_DEVICE_FUNCTION(CmdSetDepthBounds)
+#define vkCmdSetEvent VKEL_DEVICE_FUNCTION(CmdSetEvent)
+#define vkCmdSetLineWidth VKEL_DEVICE_FUNCTION(CmdSetLineWidth)
+#define vkCmdSetScissor VKEL_DEVICE_FUNCTION(CmdSetScissor)
+#define vkCmdSetStencilCompareMask VKEL_DEVICE_FUNCTION(CmdSetStencilCompareMask)
+#define vkCmdSetStencilReference VKEL_DEVICE_FUNCTION(CmdSetStencilReference)
+#define vkCmdSetStencilWriteMask VKEL_DEVICE_FUNCTION(CmdSetStencilWriteMask)
+#define vkCmdSetViewport VKEL_DEVICE_FUNCTION(CmdSetViewport)
+#define vkCmdUpdateBuffer VKEL_DEVICE_FUNCTION(CmdUpdateBuffer)
+#define vkCmdWaitEvents VKEL_DEVICE_FUNCTION(CmdWaitEvents)
+#define vkCmdWriteTimestamp VKEL_DEVICE_FUNCTION(CmdWriteTimestamp)
+#define vkCreateBuffer VKEL_DEVICE_FUNCTION(CreateBuffer)
+#define vkCreateBufferView VKEL_DEVICE_FUNCTION(CreateBufferView)
+#define vkCreateCommandPool VKEL_DEVICE_FUNCTION(CreateCommandPool)
+#define vkCreateComputePipelines VKEL_DEVICE_FUNCTION(CreateComputePipelines)
+#define vkCreateDebugReportCallbackEXT (vkelTable.CreateDebugReportCallbackEXT)
+#define vkCreateDescriptorPool VKEL_DEVICE_FUNCTION(CreateDescriptorPool)
+#define vkCreateDescriptorSetLayout VKEL_DEVICE_FUNCTION(CreateDescriptorSetLayout)
+#define vkCreateDevice (vkelTable.CreateDevice)
+#define vkCreateDisplayModeKHR (vkelTable.CreateDisplayModeKHR)
+#define vkCreateDisplayPlaneSurfaceKHR (vkelTable.CreateDisplayPlaneSurfaceKHR)
+#define vkCreateEvent VKEL_DEVICE_FUNCTION(CreateEvent)
+#define vkCreateFence VKEL_DEVICE_FUNCTION(CreateFence)
+#define vkCreateFramebuffer VKEL_DEVICE_FUNCTION(CreateFramebuffer)
+#define vkCreateGraphicsPipelines VKEL_DEVICE_FUNCTION(CreateGraphicsPipelines)
+#define vkCreateImage VKEL_DEVICE_FUNCTION(CreateImage)
+#define vkCreateImageView VKEL_DEVICE_FUNCTION(CreateImageView)
+#define vkCreateInstance (vkelTable.CreateInstance)
+#define vkCreatePipelineCache VKEL_DEVICE_FUNCTION(CreatePipelineCache)
+#define vkCreatePipelineLayout VKEL_DEVICE_FUNCTION(CreatePipelineLayout)
+#define vkCreateQueryPool VKEL_DEVICE_FUNCTION(CreateQueryPool)
+#define vkCreateRenderPass VKEL_DEVICE_FUNCTION(CreateRenderPass)
+#define vkCreateSampler VKEL_DEVICE_FUNCTION(CreateSampler)
+#define vkCreateSemaphore VKEL_DEVICE_FUNCTION(CreateSemaphore)
+#define vkCreateShaderModule VKEL_DEVICE_FUNCTION(CreateShaderModule)
+#define vkCreateSharedSwapchainsKHR VKEL_DEVICE_FUNCTION(CreateSharedSwapchainsKHR)
+#define vkCreateSwapchainKHR VKEL_DEVICE_FUNCTION(CreateSwapchainKHR)
+#define vkDebugMarkerSetObjectNameEXT VKEL_DEVICE_FUNCTION(DebugMarkerSetObjectNameEXT)
+#define vkDebugMarkerSetObjectTagEXT VKEL_DEVICE_FUNCTION(DebugMarkerSetObjectTagEXT)
+#define vkDebugReportMessageEXT (vkelTable.DebugReportMessageEXT)
+#define vkDestroyBuffer VKEL_DEVICE_FUNCTION(DestroyBuffer)
+#define vkDestroyBufferView VKEL_DEVICE_FUNCTION(DestroyBufferView)
+#define vkDestroyCommandPool VKEL_DEVICE_FUNCTION(DestroyCommandPool)
+#define vkDestroyDebugReportCallbackEXT (vkelTable.DestroyDebugReportCallbackEXT)
+#define vkDestroyDescriptorPool VKEL_DEVICE_FUNCTION(DestroyDescriptorPool)
+#define vkDestroyDescriptorSetLayout VKEL_DEVICE_FUNCTION(DestroyDescriptorSetLayout)
+#define vkDestroyDevice VKEL_DEVICE_FUNCTION(DestroyDevice)
+#define vkDestroyEvent VKEL_DEVICE_FUNCTION(DestroyEvent)
+#define vkDestroyFence VKEL_DEVICE_FUNCTION(DestroyFence)
+#define vkDestroyFramebuffer VKEL_DEVICE_FUNCTION(DestroyFramebuffer)
+#define vkDestroyImage VKEL_DEVICE_FUNCTION(DestroyImage)
+#define vkDestroyImageView VKEL_DEVICE_FUNCTION(DestroyImageView)
+#define vkDestroyInstance (vkelTable.DestroyInstance)
+#define vkDestroyPipeline VKEL_DEVICE_FUNCTION(DestroyPipeline)
+#define vkDestroyPipelineCache VKEL_DEVICE_FUNCTION(DestroyPipelineCache)
+#define vkDestroyPipelineLayout VKEL_DEVICE_FUNCTION(DestroyPipelineLayout)
+#define vkDestroyQueryPool VKEL_DEVICE_FUNCTION(DestroyQueryPool)
+#define vkDestroyRenderPass VKEL_DEVICE_FUNCTION(DestroyRenderPass)
+#define vkDestroySampler VKEL_DEVICE_FUNCTION(DestroySampler)
+#define vkDestroySemaphore VKEL_DEVICE_FUNCTION(DestroySemaphore)
+#define vkDestroyShaderModule VKEL_DEVICE_FUNCTION(DestroyShaderModule)
+#define vkDestroySurfaceKHR (vkelTable.DestroySurfaceKHR)
+#define vkDestroySwapchainKHR VKEL_DEVICE_FUNCTION(DestroySwapchainKHR)
+#define vkDeviceWaitIdle VKEL_DEVICE_FUNCTION(DeviceWaitIdle)
+#define vkEndCommandBuffer VKEL_DEVICE_FUNCTION(EndCommandBuffer)
+#define vkEnumerateDeviceExtensionProperties (vkelTable.EnumerateDeviceExtensionProperties)
+#define vkEnumerateDeviceLayerProperties (vkelTable.EnumerateDeviceLayerProperties)
+#define vkEnumerateInstanceExtensionProperties (vkelTable.EnumerateInstanceExtensionProperties)
+#define vkEnumerateInstanceLayerProperties (vkelTable.EnumerateInstanceLayerProperties)
+#define vkEnumeratePhysicalDevices (vkelTable.EnumeratePhysicalDevices)
+#define vkFlushMappedMemoryRanges VKEL_DEVICE_FUNCTION(FlushMappedMemoryRanges)
+#define vkFreeCommandBuffers VKEL_DEVICE_FUNCTION(FreeCommandBuffers)
+#define vkFreeDescriptorSets VKEL_DEVICE_FUNCTION(FreeDescriptorSets)
+#define vkFreeMemory VKEL_DEVICE_FUNCTION(FreeMemory)
+#define vkGetBufferMemoryRequirements VKEL_DEVICE_FUNCTION(GetBufferMemoryRequirements)
+#define vkGetDeviceMemoryCommitment VKEL_DEVICE_FUNCTION(GetDeviceMemoryCommitment)
+#define vkGetDeviceProcAddr (vkelTable.GetDeviceProcAddr)
+#define vkGetDeviceQueue VKEL_DEVICE_FUNCTION(GetDeviceQueue)
+#define vkGetDisplayModePropertiesKHR (vkelTable.GetDisplayModePropertiesKHR)
+#define vkGetDisplayPlaneCapabilitiesKHR (vkelTable.GetDisplayPlaneCapabilitiesKHR)
+#define vkGetDisplayPlaneSupportedDisplaysKHR (vkelTable.GetDisplayPlaneSupportedDisplaysKHR)
+#define vkGetEventStatus VKEL_DEVICE_FUNCTION(GetEventStatus)
+#define vkGetFenceStatus VKEL_DEVICE_FUNCTION(GetFenceStatus)
+#define vkGetImageMemoryRequirements VKEL_DEVICE_FUNCTION(GetImageMemoryRequirements)
+#define vkGetImageSparseMemoryRequirements VKEL_DEVICE_FUNCTION(GetImageSparseMemoryRequirements)
+#define vkGetImageSubresourceLayout VKEL_DEVICE_FUNCTION(GetImageSubresourceLayout)
+#define vkGetInstanceProcAddr (vkelTable.GetInstanceProcAddr)
+#define vkGetPhysicalDeviceDisplayPlanePropertiesKHR (vkelTable.GetPhysicalDeviceDisplayPlanePropertiesKHR)
+#define vkGetPhysicalDeviceDisplayPropertiesKHR (vkelTable.GetPhysicalDeviceDisplayPropertiesKHR)
+#define vkGetPhysicalDeviceFeatures (vkelTable.GetPhysicalDeviceFeatures)
+#define vkGetPhysicalDeviceFormatProperties (vkelTable.GetPhysicalDeviceFormatProperties)
+#define vkGetPhysicalDeviceImageFormatProperties (vkelTable.GetPhysicalDeviceImageFormatProperties)
+#define vkGetPhysicalDeviceMemoryProperties (vkelTable.GetPhysicalDeviceMemoryProperties)
+#define vkGetPhysicalDeviceProperties (vkelTable.GetPhysicalDeviceProperties)
+#define vkGetPhysicalDeviceQueueFamilyProperties (vkelTable.GetPhysicalDeviceQueueFamilyProperties)
+#define vkGetPhysicalDeviceSparseImageFormatProperties (vkelTable.GetPhysicalDeviceSparseImageFormatProperties)
+#define vkGetPhysicalDeviceSurfaceCapabilitiesKHR (vkelTable.GetPhysicalDeviceSurfaceCapabilitiesKHR)
+#define vkGetPhysicalDeviceSurfaceFormatsKHR (vkelTable.GetPhysicalDeviceSurfaceFormatsKHR)
+#define vkGetPhysicalDeviceSurfacePresentModesKHR (vkelTable.GetPhysicalDeviceSurfacePresentModesKHR)
+#define vkGetPhysicalDeviceSurfaceSupportKHR (vkelTable.GetPhysicalDeviceSurfaceSupportKHR)
+#define vkGetPipelineCacheData VKEL_DEVICE_FUNCTION(GetPipelineCacheData)
+#define vkGetQueryPoolResults VKEL_DEVICE_FUNCTION(GetQueryPoolResults)
+#define vkGetRenderAreaGranularity VKEL_DEVICE_FUNCTION(GetRenderAreaGranularity)
+#define vkGetSwapchainImagesKHR VKEL_DEVICE_FUNCTION(GetSwapchainImagesKHR)
+#define vkInvalidateMappedMemoryRanges VKEL_DEVICE_FUNCTION(InvalidateMappedMemoryRanges)
+#define vkMapMemory VKEL_DEVICE_FUNCTION(MapMemory)
+#define vkMergePipelineCaches VKEL_DEVICE_FUNCTION(MergePipelineCaches)
+#define vkQueueBindSparse VKEL_DEVICE_FUNCTION(QueueBindSparse)
+#define vkQueuePresentKHR VKEL_DEVICE_FUNCTION(QueuePresentKHR)
+#define vkQueueSubmit VKEL_DEVICE_FUNCTION(QueueSubmit)
+#define vkQueueWaitIdle VKEL_DEVICE_FUNCTION(QueueWaitIdle)
+#define vkResetCommandBuffer VKEL_DEVICE_FUNCTION(ResetCommandBuffer)
+#define vkResetCommandPool VKEL_DEVICE_FUNCTION(ResetCommandPool)
+#define vkResetDescriptorPool VKEL_DEVICE_FUNCTION(ResetDescriptorPool)
+#define vkResetEvent VKEL_DEVICE_FUNCTION(ResetEvent)
+#define vkResetFences VKEL_DEVICE_FUNCTION(ResetFences)
+#define vkSetEvent VKEL_DEVICE_FUNCTION(SetEvent)
+#define vkUnmapMemory VKEL_DEVICE_FUNCTION(UnmapMemory)
+#define vkUpdateDescriptorSets VKEL_DEVICE_FUNCTION(UpdateDescriptorSets)
+#define vkWaitForFences VKEL_DEVICE_FUNCTION(WaitForFences)
 // VK_USE_PLATFORM_ANDROID_KHR
 #define vkCreateAndroidSurfaceKHR NULL
 
@@ -3555,44 +4704,45 @@ extern PFN_vkGetPhysicalDeviceXlibPresentationSupportKHR __vkGetPhysicalDeviceXl
 
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
 #undef vkCreateAndroidSurfaceKHR
-#define vkCreateAndroidSurfaceKHR __vkCreateAndroidSurfaceKHR
+#define vkCreateAndroidSurfaceKHR (vkelTable.CreateAndroidSurfaceKHR)
 #endif /* VK_USE_PLATFORM_ANDROID_KHR */
 
 #ifdef VK_USE_PLATFORM_MIR_KHR
 #undef vkCreateMirSurfaceKHR
 #undef vkGetPhysicalDeviceMirPresentationSupportKHR
-#define vkCreateMirSurfaceKHR __vkCreateMirSurfaceKHR
-#define vkGetPhysicalDeviceMirPresentationSupportKHR __vkGetPhysicalDeviceMirPresentationSupportKHR
+#define vkCreateMirSurfaceKHR (vkelTable.CreateMirSurfaceKHR)
+#define vkGetPhysicalDeviceMirPresentationSupportKHR (vkelTable.GetPhysicalDeviceMirPresentationSupportKHR)
 #endif /* VK_USE_PLATFORM_MIR_KHR */
 
 #ifdef VK_USE_PLATFORM_WAYLAND_KHR
 #undef vkCreateWaylandSurfaceKHR
 #undef vkGetPhysicalDeviceWaylandPresentationSupportKHR
-#define vkCreateWaylandSurfaceKHR __vkCreateWaylandSurfaceKHR
-#define vkGetPhysicalDeviceWaylandPresentationSupportKHR __vkGetPhysicalDeviceWaylandPresentationSupportKHR
+#define vkCreateWaylandSurfaceKHR (vkelTable.CreateWaylandSurfaceKHR)
+#define vkGetPhysicalDeviceWaylandPresentationSupportKHR (vkelTable.GetPhysicalDeviceWaylandPresentationSupportKHR)
 #endif /* VK_USE_PLATFORM_WAYLAND_KHR */
 
 #ifdef VK_USE_PLATFORM_WIN32_KHR
 #undef vkCreateWin32SurfaceKHR
 #undef vkGetPhysicalDeviceWin32PresentationSupportKHR
-#define vkCreateWin32SurfaceKHR __vkCreateWin32SurfaceKHR
-#define vkGetPhysicalDeviceWin32PresentationSupportKHR __vkGetPhysicalDeviceWin32PresentationSupportKHR
+#define vkCreateWin32SurfaceKHR (vkelTable.CreateWin32SurfaceKHR)
+#define vkGetPhysicalDeviceWin32PresentationSupportKHR (vkelTable.GetPhysicalDeviceWin32PresentationSupportKHR)
 #endif /* VK_USE_PLATFORM_WIN32_KHR */
 
 #ifdef VK_USE_PLATFORM_XCB_KHR
 #undef vkCreateXcbSurfaceKHR
 #undef vkGetPhysicalDeviceXcbPresentationSupportKHR
-#define vkCreateXcbSurfaceKHR __vkCreateXcbSurfaceKHR
-#define vkGetPhysicalDeviceXcbPresentationSupportKHR __vkGetPhysicalDeviceXcbPresentationSupportKHR
+#define vkCreateXcbSurfaceKHR (vkelTable.CreateXcbSurfaceKHR)
+#define vkGetPhysicalDeviceXcbPresentationSupportKHR (vkelTable.GetPhysicalDeviceXcbPresentationSupportKHR)
 #endif /* VK_USE_PLATFORM_XCB_KHR */
 
 #ifdef VK_USE_PLATFORM_XLIB_KHR
 #undef vkCreateXlibSurfaceKHR
 #undef vkGetPhysicalDeviceXlibPresentationSupportKHR
-#define vkCreateXlibSurfaceKHR __vkCreateXlibSurfaceKHR
-#define vkGetPhysicalDeviceXlibPresentationSupportKHR __vkGetPhysicalDeviceXlibPresentationSupportKHR
+#define vkCreateXlibSurfaceKHR (vkelTable.CreateXlibSurfaceKHR)
+#define vkGetPhysicalDeviceXlibPresentationSupportKHR (vkelTable.GetPhysicalDeviceXlibPresentationSupportKHR)
 #endif /* VK_USE_PLATFORM_XLIB_KHR */
 
+#endif /* VKEL_NO_FUNCTION_MACROS */
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,1173 @@
+//========================================================================
+// Name
+//     Vulkan (Cross-Platform) Extension Loader
+//
+// Repository
+//     https://github.com/MrVallentin/vkel
+//
+// Overview
+//     This is a simple, dynamic and tiny cross-platform Vulkan
+//     extension loader.
+//
+// Dependencies
+//     Vulkan (library)
+//     Windows (header) - needed for library loading on Windows
+//     dlfcn (header) - needed for library loading on non-Windows OS'
+//     dirent (header) - needed for vkelInitDirectICD() on non-Windows OS'
+//     pthread (header) - needed for vkelInitAsync() on non-Windows OS'
+//     fcntl, unistd (headers) - needed for vkelPrewarm() on non-Windows OS'
+//     Standard C Libraries (stdio, stdlib, string, assert) - needed for NULL, malloc()
+//                                                 calloc(), free(), memset(), assert()
+//
+// Notice
+//     Copyright (c) 2016 Christian Vallentin <mail@vallentinsource.com>
+//
+// Developers & Contributors
+//     Christian Vallentin <mail@vallentinsource.com>
+//
+// Version History
+//     Last Modified Date: May 16, 2016
+//     Revision: 14
+//     Version: 2.0.11
+//
+// Revision History
+//     Revision 12, 2016/05/02
+//       - Fixed "for loop initial declarations are only
+//         allowed in C99 mode".
+//
+//     Revision 3, 2016/02/26
+//       - Rewrote vkel_gen.py, now it parses and directly
+//         adds vulkan.h and vk_platform.h into vkel.h,
+//         along with moving the appropriate copyrights
+//         to the top of vkel.h.
+//       - Fixed/added better differentiation for instance
+//         and device related calls.
+//       - Removed the need for having the vukan.h and
+//         vk_platform.h headers.
+//
+//     Revision 2, 2016/02/24
+//       - Created a Python script for automatically generating
+//         all the extensions and their functions. (Tested with
+//         Python 3.5.1)
+//       - Added cross-platform support, for loading libraries
+//         and getting the function addresses.
+//       - Fixed so platform specific functions defaults to NULL
+//       - Added missing include for dlfcn (used on non-Window OS')
+//
+//     Revision 1, 2016/02/23
+//       - Implemented the basic version supporting a few (manually
+//         written) dynamically loaded functions.
+//
+//------------------------------------------------------------------------
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+// OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//========================================================================
+
+/*
+** Copyright (c) 2015-2016 The Khronos Group Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+#ifndef _VKEL_HPP_
+#define _VKEL_HPP_ 1
+
+#include "vkel.h"
+
+
+namespace vkel
+{
+	
+	// Move-only owner of a device level handle, which is destroyed along with the wrapper.
+	// It's exactly the size of the handle and the device, the destroy function is a
+	// template argument (and not a member) so no function pointer is stored.
+	//
+	// The destroy function is taken from the table of the registered device (see
+	// vkelRegisterDevice()) and otherwise the one loaded by vkelDeviceInit().
+	// Handles created with custom allocation callbacks must be released and destroyed manually.
+	template<typename Handle, void (*Destroy)(VkDevice, Handle)>
+	class UniqueHandle
+	{
+	public:
+		UniqueHandle() noexcept : m_handle(VK_NULL_HANDLE), m_device(VK_NULL_HANDLE) {}
+		UniqueHandle(VkDevice device, Handle handle) noexcept : m_handle(handle), m_device(device) {}
+		
+		~UniqueHandle()
+		{
+			static_assert(sizeof(UniqueHandle) == sizeof(RawHandle), "UniqueHandle must be the size of the handle and the device");
+			
+			reset();
+		}
+		
+		UniqueHandle(const UniqueHandle&) = delete;
+		UniqueHandle& operator=(const UniqueHandle&) = delete;
+		
+		UniqueHandle(UniqueHandle &&other) noexcept : m_handle(other.m_handle), m_device(other.m_device)
+		{
+			other.m_handle = VK_NULL_HANDLE;
+		}
+		
+		UniqueHandle& operator=(UniqueHandle &&other) noexcept
+		{
+			if (this != &other)
+			{
+				reset(other.m_device, other.m_handle);
+				
+				other.m_handle = VK_NULL_HANDLE;
+			}
+			
+			return *this;
+		}
+		
+		
+		Handle get() const noexcept { return m_handle; }
+		VkDevice getDevice() const noexcept { return m_device; }
+		
+		explicit operator bool() const noexcept { return m_handle != VK_NULL_HANDLE; }
+		
+		
+		// Give up ownership without destroying the handle
+		Handle release() noexcept
+		{
+			Handle handle = m_handle;
+			
+			m_handle = VK_NULL_HANDLE;
+			
+			return handle;
+		}
+		
+		void reset(VkDevice device = VK_NULL_HANDLE, Handle handle = VK_NULL_HANDLE) noexcept
+		{
+			if (m_handle != VK_NULL_HANDLE)
+				Destroy(m_device, m_handle);
+			
+			m_handle = handle;
+			m_device = device;
+		}
+		
+	private:
+		struct RawHandle
+		{
+			Handle handle;
+			VkDevice device;
+		};
+		
+		Handle m_handle;
+		VkDevice m_device;
+	};
+	
+	
+	namespace detail
+	{
+		
+		inline void FreeMemory(VkDevice device, VkDeviceMemory handle)
+		{
+			const VkelDevice *registered = vkelGetDevice(device);
+			
+			(registered ? registered->table.FreeMemory : VKEL_DEVICE_FUNCTION(FreeMemory))(device, handle, nullptr);
+		}
+		
+		inline void DestroyFence(VkDevice device, VkFence handle)
+		{
+			const VkelDevice *registered = vkelGetDevice(device);
+			
+			(registered ? registered->table.DestroyFence : VKEL_DEVICE_FUNCTION(DestroyFence))(device, handle, nullptr);
+		}
+		
+		inline void DestroySemaphore(VkDevice device, VkSemaphore handle)
+		{
+			const VkelDevice *registered = vkelGetDevice(device);
+			
+			(registered ? registered->table.DestroySemaphore : VKEL_DEVICE_FUNCTION(DestroySemaphore))(device, handle, nullptr);
+		}
+		
+		inline void DestroyEvent(VkDevice device, VkEvent handle)
+		{
+			const VkelDevice *registered = vkelGetDevice(device);
+			
+			(registered ? registered->table.DestroyEvent : VKEL_DEVICE_FUNCTION(DestroyEvent))(device, handle, nullptr);
+		}
+		
+		inline void DestroyQueryPool(VkDevice device, VkQueryPool handle)
+		{
+			const VkelDevice *registered = vkelGetDevice(device);
+			
+			(registered ? registered->table.DestroyQueryPool : VKEL_DEVICE_FUNCTION(DestroyQueryPool))(device, handle, nullptr);
+		}
+		
+		inline void DestroyBuffer(VkDevice device, VkBuffer handle)
+		{
+			const VkelDevice *registered = vkelGetDevice(device);
+			
+			(registered ? registered->table.DestroyBuffer : VKEL_DEVICE_FUNCTION(DestroyBuffer))(device, handle, nullptr);
+		}
+		
+		inline void DestroyBufferView(VkDevice device, VkBufferView handle)
+		{
+			const VkelDevice *registered = vkelGetDevice(device);
+			
+			(registered ? registered->table.DestroyBufferView : VKEL_DEVICE_FUNCTION(DestroyBufferView))(device, handle, nullptr);
+		}
+		
+		inline void DestroyImage(VkDevice device, VkImage handle)
+		{
+			const VkelDevice *registered = vkelGetDevice(device);
+			
+			(registered ? registered->table.DestroyImage : VKEL_DEVICE_FUNCTION(DestroyImage))(device, handle, nullptr);
+		}
+		
+		inline void DestroyImageView(VkDevice device, VkImageView handle)
+		{
+			const VkelDevice *registered = vkelGetDevice(device);
+			
+			(registered ? registered->table.DestroyImageView : VKEL_DEVICE_FUNCTION(DestroyImageView))(device, handle, nullptr);
+		}
+		
+		inline void DestroyShaderModule(VkDevice device, VkShaderModule handle)
+		{
+			const VkelDevice *registered = vkelGetDevice(device);
+			
+			(registered ? registered->table.DestroyShaderModule : VKEL_DEVICE_FUNCTION(DestroyShaderModule))(device, handle, nullptr);
+		}
+		
+		inline void DestroyPipelineCache(VkDevice device, VkPipelineCache handle)
+		{
+			const VkelDevice *registered = vkelGetDevice(device);
+			
+			(registered ? registered->table.DestroyPipelineCache : VKEL_DEVICE_FUNCTION(DestroyPipelineCache))(device, handle, nullptr);
+		}
+		
+		inline void DestroyPipeline(VkDevice device, VkPipeline handle)
+		{
+			const VkelDevice *registered = vkelGetDevice(device);
+			
+			(registered ? registered->table.DestroyPipeline : VKEL_DEVICE_FUNCTION(DestroyPipeline))(device, handle, nullptr);
+		}
+		
+		inline void DestroyPipelineLayout(VkDevice device, VkPipelineLayout handle)
+		{
+			const VkelDevice *registered = vkelGetDevice(device);
+			
+			(registered ? registered->table.DestroyPipelineLayout : VKEL_DEVICE_FUNCTION(DestroyPipelineLayout))(device, handle, nullptr);
+		}
+		
+		inline void DestroySampler(VkDevice device, VkSampler handle)
+		{
+			const VkelDevice *registered = vkelGetDevice(device);
+			
+			(registered ? registered->table.DestroySampler : VKEL_DEVICE_FUNCTION(DestroySampler))(device, handle, nullptr);
+		}
+		
+		inline void DestroyDescriptorSetLayout(VkDevice device, VkDescriptorSetLayout handle)
+		{
+			const VkelDevice *registered = vkelGetDevice(device);
+			
+			(registered ? registered->table.DestroyDescriptorSetLayout : VKEL_DEVICE_FUNCTION(DestroyDescriptorSetLayout))(device, handle, nullptr);
+		}
+		
+		inline void DestroyDescriptorPool(VkDevice device, VkDescriptorPool handle)
+		{
+			const VkelDevice *registered = vkelGetDevice(device);
+			
+			(registered ? registered->table.DestroyDescriptorPool : VKEL_DEVICE_FUNCTION(DestroyDescriptorPool))(device, handle, nullptr);
+		}
+		
+		inline void DestroyFramebuffer(VkDevice device, VkFramebuffer handle)
+		{
+			const VkelDevice *registered = vkelGetDevice(device);
+			
+			(registered ? registered->table.DestroyFramebuffer : VKEL_DEVICE_FUNCTION(DestroyFramebuffer))(device, handle, nullptr);
+		}
+		
+		inline void DestroyRenderPass(VkDevice device, VkRenderPass handle)
+		{
+			const VkelDevice *registered = vkelGetDevice(device);
+			
+			(registered ? registered->table.DestroyRenderPass : VKEL_DEVICE_FUNCTION(DestroyRenderPass))(device, handle, nullptr);
+		}
+		
+		inline void DestroyCommandPool(VkDevice device, VkCommandPool handle)
+		{
+			const VkelDevice *registered = vkelGetDevice(device);
+			
+			(registered ? registered->table.DestroyCommandPool : VKEL_DEVICE_FUNCTION(DestroyCommandPool))(device, handle, nullptr);
+		}
+		
+		inline void DestroySwapchainKHR(VkDevice device, VkSwapchainKHR handle)
+		{
+			const VkelDevice *registered = vkelGetDevice(device);
+			
+			(registered ? registered->table.DestroySwapchainKHR : VKEL_DEVICE_FUNCTION(DestroySwapchainKHR))(device, handle, nullptr);
+		}
+		
+	}
+	
+	
+	using DeviceMemory = UniqueHandle<VkDeviceMemory, &detail::FreeMemory>;
+	using Fence = UniqueHandle<VkFence, &detail::DestroyFence>;
+	using Semaphore = UniqueHandle<VkSemaphore, &detail::DestroySemaphore>;
+	using Event = UniqueHandle<VkEvent, &detail::DestroyEvent>;
+	using QueryPool = UniqueHandle<VkQueryPool, &detail::DestroyQueryPool>;
+	using Buffer = UniqueHandle<VkBuffer, &detail::DestroyBuffer>;
+	using BufferView = UniqueHandle<VkBufferView, &detail::DestroyBufferView>;
+	using Image = UniqueHandle<VkImage, &detail::DestroyImage>;
+	using ImageView = UniqueHandle<VkImageView, &detail::DestroyImageView>;
+	using ShaderModule = UniqueHandle<VkShaderModule, &detail::DestroyShaderModule>;
+	using PipelineCache = UniqueHandle<VkPipelineCache, &detail::DestroyPipelineCache>;
+	using Pipeline = UniqueHandle<VkPipeline, &detail::DestroyPipeline>;
+	using PipelineLayout = UniqueHandle<VkPipelineLayout, &detail::DestroyPipelineLayout>;
+	using Sampler = UniqueHandle<VkSampler, &detail::DestroySampler>;
+	using DescriptorSetLayout = UniqueHandle<VkDescriptorSetLayout, &detail::DestroyDescriptorSetLayout>;
+	using DescriptorPool = UniqueHandle<VkDescriptorPool, &detail::DestroyDescriptorPool>;
+	using Framebuffer = UniqueHandle<VkFramebuffer, &detail::DestroyFramebuffer>;
+	using RenderPass = UniqueHandle<VkRenderPass, &detail::DestroyRenderPass>;
+	using CommandPool = UniqueHandle<VkCommandPool, &detail::DestroyCommandPool>;
+	using SwapchainKHR = UniqueHandle<VkSwapchainKHR, &detail::DestroySwapchainKHR>;
+	
+	
+	namespace detail
+	{
+		
+		inline PFN_vkVoidFunction getInstanceProcAddr(VkInstance instance, const char *pName)
+		{
+			return vkGetInstanceProcAddr(instance, pName);
+		}
+		
+		// Device level functions are loaded from the instance when no device is given
+		inline PFN_vkVoidFunction getDeviceProcAddr(VkInstance instance, VkDevice device, const char *pName)
+		{
+			return device ? vkGetDeviceProcAddr(device, pName) : vkGetInstanceProcAddr(instance, pName);
+		}
+		
+		
+		template<typename... Extensions>
+		struct CommandCount;
+		
+		template<>
+		struct CommandCount<>
+		{
+			static constexpr uint32_t value = 0;
+		};
+		
+		template<typename Extension, typename... Extensions>
+		struct CommandCount<Extension, Extensions...>
+		{
+			static constexpr uint32_t value = Extension::commandCount + CommandCount<Extensions...>::value;
+		};
+		
+	}
+	
+	
+	// Extension tags for vkel::Loader, each with a table of only the functions of that extension
+	struct VERSION_1_0
+	{
+		static constexpr uint32_t commandCount = 137;
+		
+		static VkBool32 isSupported() { return VK_TRUE; }
+		
+		struct Table
+		{
+			PFN_vkCreateInstance CreateInstance;
+			PFN_vkDestroyInstance DestroyInstance;
+			PFN_vkEnumeratePhysicalDevices EnumeratePhysicalDevices;
+			PFN_vkGetPhysicalDeviceFeatures GetPhysicalDeviceFeatures;
+			PFN_vkGetPhysicalDeviceFormatProperties GetPhysicalDeviceFormatProperties;
+			PFN_vkGetPhysicalDeviceImageFormatProperties GetPhysicalDeviceImageFormatProperties;
+			PFN_vkGetPhysicalDeviceProperties GetPhysicalDeviceProperties;
+			PFN_vkGetPhysicalDeviceQueueFamilyProperties GetPhysicalDeviceQueueFamilyProperties;
+			PFN_vkGetPhysicalDeviceMemoryProperties GetPhysicalDeviceMemoryProperties;
+			PFN_vkGetInstanceProcAddr GetInstanceProcAddr;
+			PFN_vkGetDeviceProcAddr GetDeviceProcAddr;
+			PFN_vkCreateDevice CreateDevice;
+			PFN_vkDestroyDevice DestroyDevice;
+			PFN_vkEnumerateInstanceExtensionProperties EnumerateInstanceExtensionProperties;
+			PFN_vkEnumerateDeviceExtensionProperties EnumerateDeviceExtensionProperties;
+			PFN_vkEnumerateInstanceLayerProperties EnumerateInstanceLayerProperties;
+			PFN_vkEnumerateDeviceLayerProperties EnumerateDeviceLayerProperties;
+			PFN_vkGetDeviceQueue GetDeviceQueue;
+			PFN_vkQueueSubmit QueueSubmit;
+			PFN_vkQueueWaitIdle QueueWaitIdle;
+			PFN_vkDeviceWaitIdle DeviceWaitIdle;
+			PFN_vkAllocateMemory AllocateMemory;
+			PFN_vkFreeMemory FreeMemory;
+			PFN_vkMapMemory MapMemory;
+			PFN_vkUnmapMemory UnmapMemory;
+			PFN_vkFlushMappedMemoryRanges FlushMappedMemoryRanges;
+			PFN_vkInvalidateMappedMemoryRanges InvalidateMappedMemoryRanges;
+			PFN_vkGetDeviceMemoryCommitment GetDeviceMemoryCommitment;
+			PFN_vkBindBufferMemory BindBufferMemory;
+			PFN_vkBindImageMemory BindImageMemory;
+			PFN_vkGetBufferMemoryRequirements GetBufferMemoryRequirements;
+			PFN_vkGetImageMemoryRequirements GetImageMemoryRequirements;
+			PFN_vkGetImageSparseMemoryRequirements GetImageSparseMemoryRequirements;
+			PFN_vkGetPhysicalDeviceSparseImageFormatProperties GetPhysicalDeviceSparseImageFormatProperties;
+			PFN_vkQueueBindSparse QueueBindSparse;
+			PFN_vkCreateFence CreateFence;
+			PFN_vkDestroyFence DestroyFence;
+			PFN_vkResetFences ResetFences;
+			PFN_vkGetFenceStatus GetFenceStatus;
+			PFN_vkWaitForFences WaitForFences;
+			PFN_vkCreateSemaphore CreateSemaphore;
+			PFN_vkDestroySemaphore DestroySemaphore;
+			PFN_vkCreateEvent CreateEvent;
+			PFN_vkDestroyEvent DestroyEvent;
+			PFN_vkGetEventStatus GetEventStatus;
+			PFN_vkSetEvent SetEvent;
+			PFN_vkResetEvent ResetEvent;
+			PFN_vkCreateQueryPool CreateQueryPool;
+			PFN_vkDestroyQueryPool DestroyQueryPool;
+			PFN_vkGetQueryPoolResults GetQueryPoolResults;
+			PFN_vkCreateBuffer CreateBuffer;
+			PFN_vkDestroyBuffer DestroyBuffer;
+			PFN_vkCreateBufferView CreateBufferView;
+			PFN_vkDestroyBufferView DestroyBufferView;
+			PFN_vkCreateImage CreateImage;
+			PFN_vkDestroyImage DestroyImage;
+			PFN_vkGetImageSubresourceLayout GetImageSubresourceLayout;
+			PFN_vkCreateImageView CreateImageView;
+			PFN_vkDestroyImageView DestroyImageView;
+			PFN_vkCreateShaderModule CreateShaderModule;
+			PFN_vkDestroyShaderModule DestroyShaderModule;
+			PFN_vkCreatePipelineCache CreatePipelineCache;
+			PFN_vkDestroyPipelineCache DestroyPipelineCache;
+			PFN_vkGetPipelineCacheData GetPipelineCacheData;
+			PFN_vkMergePipelineCaches MergePipelineCaches;
+			PFN_vkCreateGraphicsPipelines CreateGraphicsPipelines;
+			PFN_vkCreateComputePipelines CreateComputePipelines;
+			PFN_vkDestroyPipeline DestroyPipeline;
+			PFN_vkCreatePipelineLayout CreatePipelineLayout;
+			PFN_vkDestroyPipelineLayout DestroyPipelineLayout;
+			PFN_vkCreateSampler CreateSampler;
+			PFN_vkDestroySampler DestroySampler;
+			PFN_vkCreateDescriptorSetLayout CreateDescriptorSetLayout;
+			PFN_vkDestroyDescriptorSetLayout DestroyDescriptorSetLayout;
+			PFN_vkCreateDescriptorPool CreateDescriptorPool;
+			PFN_vkDestroyDescriptorPool DestroyDescriptorPool;
+			PFN_vkResetDescriptorPool ResetDescriptorPool;
+			PFN_vkAllocateDescriptorSets AllocateDescriptorSets;
+			PFN_vkFreeDescriptorSets FreeDescriptorSets;
+			PFN_vkUpdateDescriptorSets UpdateDescriptorSets;
+			PFN_vkCreateFramebuffer CreateFramebuffer;
+			PFN_vkDestroyFramebuffer DestroyFramebuffer;
+			PFN_vkCreateRenderPass CreateRenderPass;
+			PFN_vkDestroyRenderPass DestroyRenderPass;
+			PFN_vkGetRenderAreaGranularity GetRenderAreaGranularity;
+			PFN_vkCreateCommandPool CreateCommandPool;
+			PFN_vkDestroyCommandPool DestroyCommandPool;
+			PFN_vkResetCommandPool ResetCommandPool;
+			PFN_vkAllocateCommandBuffers AllocateCommandBuffers;
+			PFN_vkFreeCommandBuffers FreeCommandBuffers;
+			PFN_vkBeginCommandBuffer BeginCommandBuffer;
+			PFN_vkEndCommandBuffer EndCommandBuffer;
+			PFN_vkResetCommandBuffer ResetCommandBuffer;
+			PFN_vkCmdBindPipeline CmdBindPipeline;
+			PFN_vkCmdSetViewport CmdSetViewport;
+			PFN_vkCmdSetScissor CmdSetScissor;
+			PFN_vkCmdSetLineWidth CmdSetLineWidth;
+			PFN_vkCmdSetDepthBias CmdSetDepthBias;
+			PFN_vkCmdSetBlendConstants CmdSetBlendConstants;
+			PFN_vkCmdSetDepthBounds CmdSetDepthBounds;
+			PFN_vkCmdSetStencilCompareMask CmdSetStencilCompareMask;
+			PFN_vkCmdSetStencilWriteMask CmdSetStencilWriteMask;
+			PFN_vkCmdSetStencilReference CmdSetStencilReference;
+			PFN_vkCmdBindDescriptorSets CmdBindDescriptorSets;
+			PFN_vkCmdBindIndexBuffer CmdBindIndexBuffer;
+			PFN_vkCmdBindVertexBuffers CmdBindVertexBuffers;
+			PFN_vkCmdDraw CmdDraw;
+			PFN_vkCmdDrawIndexed CmdDrawIndexed;
+			PFN_vkCmdDrawIndirect CmdDrawIndirect;
+			PFN_vkCmdDrawIndexedIndirect CmdDrawIndexedIndirect;
+			PFN_vkCmdDispatch CmdDispatch;
+			PFN_vkCmdDispatchIndirect CmdDispatchIndirect;
+			PFN_vkCmdCopyBuffer CmdCopyBuffer;
+			PFN_vkCmdCopyImage CmdCopyImage;
+			PFN_vkCmdBlitImage CmdBlitImage;
+			PFN_vkCmdCopyBufferToImage CmdCopyBufferToImage;
+			PFN_vkCmdCopyImageToBuffer CmdCopyImageToBuffer;
+			PFN_vkCmdUpdateBuffer CmdUpdateBuffer;
+			PFN_vkCmdFillBuffer CmdFillBuffer;
+			PFN_vkCmdClearColorImage CmdClearColorImage;
+			PFN_vkCmdClearDepthStencilImage CmdClearDepthStencilImage;
+			PFN_vkCmdClearAttachments CmdClearAttachments;
+			PFN_vkCmdResolveImage CmdResolveImage;
+			PFN_vkCmdSetEvent CmdSetEvent;
+			PFN_vkCmdResetEvent CmdResetEvent;
+			PFN_vkCmdWaitEvents CmdWaitEvents;
+			PFN_vkCmdPipelineBarrier CmdPipelineBarrier;
+			PFN_vkCmdBeginQuery CmdBeginQuery;
+			PFN_vkCmdEndQuery CmdEndQuery;
+			PFN_vkCmdResetQueryPool CmdResetQueryPool;
+			PFN_vkCmdWriteTimestamp CmdWriteTimestamp;
+			PFN_vkCmdCopyQueryPoolResults CmdCopyQueryPoolResults;
+			PFN_vkCmdPushConstants CmdPushConstants;
+			PFN_vkCmdBeginRenderPass CmdBeginRenderPass;
+			PFN_vkCmdNextSubpass CmdNextSubpass;
+			PFN_vkCmdEndRenderPass CmdEndRenderPass;
+			PFN_vkCmdExecuteCommands CmdExecuteCommands;
+			
+			void load(VkInstance instance, VkDevice device)
+			{
+				(void) instance;
+				(void) device;
+				
+				CreateInstance = (PFN_vkCreateInstance) detail::getInstanceProcAddr(instance, "vkCreateInstance");
+				DestroyInstance = (PFN_vkDestroyInstance) detail::getInstanceProcAddr(instance, "vkDestroyInstance");
+				EnumeratePhysicalDevices = (PFN_vkEnumeratePhysicalDevices) detail::getInstanceProcAddr(instance, "vkEnumeratePhysicalDevices");
+				GetPhysicalDeviceFeatures = (PFN_vkGetPhysicalDeviceFeatures) detail::getInstanceProcAddr(instance, "vkGetPhysicalDeviceFeatures");
+				GetPhysicalDeviceFormatProperties = (PFN_vkGetPhysicalDeviceFormatProperties) detail::getInstanceProcAddr(instance, "vkGetPhysicalDeviceFormatProperties");
+				GetPhysicalDeviceImageFormatProperties = (PFN_vkGetPhysicalDeviceImageFormatProperties) detail::getInstanceProcAddr(instance, "vkGetPhysicalDeviceImageFormatProperties");
+				GetPhysicalDeviceProperties = (PFN_vkGetPhysicalDeviceProperties) detail::getInstanceProcAddr(instance, "vkGetPhysicalDeviceProperties");
+				GetPhysicalDeviceQueueFamilyProperties = (PFN_vkGetPhysicalDeviceQueueFamilyProperties) detail::getInstanceProcAddr(instance, "vkGetPhysicalDeviceQueueFamilyProperties");
+				GetPhysicalDeviceMemoryProperties = (PFN_vkGetPhysicalDeviceMemoryProperties) detail::getInstanceProcAddr(instance, "vkGetPhysicalDeviceMemoryProperties");
+				GetInstanceProcAddr = (PFN_vkGetInstanceProcAddr) detail::getInstanceProcAddr(instance, "vkGetInstanceProcAddr");
+				GetDeviceProcAddr = (PFN_vkGetDeviceProcAddr) detail::getInstanceProcAddr(instance, "vkGetDeviceProcAddr");
+				CreateDevice = (PFN_vkCreateDevice) detail::getInstanceProcAddr(instance, "vkCreateDevice");
+				DestroyDevice = (PFN_vkDestroyDevice) detail::getDeviceProcAddr(instance, device, "vkDestroyDevice");
+				EnumerateInstanceExtensionProperties = (PFN_vkEnumerateInstanceExtensionProperties) detail::getInstanceProcAddr(instance, "vkEnumerateInstanceExtensionProperties");
+				EnumerateDeviceExtensionProperties = (PFN_vkEnumerateDeviceExtensionProperties) detail::getInstanceProcAddr(instance, "vkEnumerateDeviceExtensionProperties");
+				EnumerateInstanceLayerProperties = (PFN_vkEnumerateInstanceLayerProperties) detail::getInstanceProcAddr(instance, "vkEnumerateInstanceLayerProperties");
+				EnumerateDeviceLayerProperties = (PFN_vkEnumerateDeviceLayerProperties) detail::getInstanceProcAddr(instance, "vkEnumerateDeviceLayerProperties");
+				GetDeviceQueue = (PFN_vkGetDeviceQueue) detail::getDeviceProcAddr(instance, device, "vkGetDeviceQueue");
+				QueueSubmit = (PFN_vkQueueSubmit) detail::getDeviceProcAddr(instance, device, "vkQueueSubmit");
+				QueueWaitIdle = (PFN_vkQueueWaitIdle) detail::getDeviceProcAddr(instance, device, "vkQueueWaitIdle");
+				DeviceWaitIdle = (PFN_vkDeviceWaitIdle) detail::getDeviceProcAddr(instance, device, "vkDeviceWaitIdle");
+				AllocateMemory = (PFN_vkAllocateMemory) detail::getDeviceProcAddr(instance, device, "vkAllocateMemory");
+				FreeMemory = (PFN_vkFreeMemory) detail::getDeviceProcAddr(instance, device, "vkFreeMemory");
+				MapMemory = (PFN_vkMapMemory) detail::getDeviceProcAddr(instance, device, "vkMapMemory");
+				UnmapMemory = (PFN_vkUnmapMemory) detail::getDeviceProcAddr(instance, device, "vkUnmapMemory");
+				FlushMappedMemoryRanges = (PFN_vkFlushMappedMemoryRanges) detail::getDeviceProcAddr(instance, device, "vkFlushMappedMemoryRanges");
+				InvalidateMappedMemoryRanges = (PFN_vkInvalidateMappedMemoryRanges) detail::getDeviceProcAddr(instance, device, "vkInvalidateMappedMemoryRanges");
+				GetDeviceMemoryCommitment = (PFN_vkGetDeviceMemoryCommitment) detail::getDeviceProcAddr(instance, device, "vkGetDeviceMemoryCommitment");
+				BindBufferMemory = (PFN_vkBindBufferMemory) detail::getDeviceProcAddr(instance, device, "vkBindBufferMemory");
+				BindImageMemory = (PFN_vkBindImageMemory) detail::getDeviceProcAddr(instance, device, "vkBindImageMemory");
+				GetBufferMemoryRequirements = (PFN_vkGetBufferMemoryRequirements) detail::getDeviceProcAddr(instance, device, "vkGetBufferMemoryRequirements");
+				GetImageMemoryRequirements = (PFN_vkGetImageMemoryRequirements) detail::getDeviceProcAddr(instance, device, "vkGetImageMemoryRequirements");
+				GetImageSparseMemoryRequirements = (PFN_vkGetImageSparseMemoryRequirements) detail::getDeviceProcAddr(instance, device, "vkGetImageSparseMemoryRequirements");
+				GetPhysicalDeviceSparseImageFormatProperties = (PFN_vkGetPhysicalDeviceSparseImageFormatProperties) detail::getInstanceProcAddr(instance, "vkGetPhysicalDeviceSparseImageFormatProperties");
+				QueueBindSparse = (PFN_vkQueueBindSparse) detail::getDeviceProcAddr(instance, device, "vkQueueBindSparse");
+				CreateFence = (PFN_vkCreateFence) detail::getDeviceProcAddr(instance, device, "vkCreateFence");
+				DestroyFence = (PFN_vkDestroyFence) detail::getDeviceProcAddr(instance, device, "vkDestroyFence");
+				ResetFences = (PFN_vkResetFences) detail::getDeviceProcAddr(instance, device, "vkResetFences");
+				GetFenceStatus = (PFN_vkGetFenceStatus) detail::getDeviceProcAddr(instance, device, "vkGetFenceStatus");
+				WaitForFences = (PFN_vkWaitForFences) detail::getDeviceProcAddr(instance, device, "vkWaitForFences");
+				CreateSemaphore = (PFN_vkCreateSemaphore) detail::getDeviceProcAddr(instance, device, "vkCreateSemaphore");
+				DestroySemaphore = (PFN_vkDestroySemaphore) detail::getDeviceProcAddr(instance, device, "vkDestroySemaphore");
+				CreateEvent = (PFN_vkCreateEvent) detail::getDeviceProcAddr(instance, device, "vkCreateEvent");
+				DestroyEvent = (PFN_vkDestroyEvent) detail::getDeviceProcAddr(instance, device, "vkDestroyEvent");
+				GetEventStatus = (PFN_vkGetEventStatus) detail::getDeviceProcAddr(instance, device, "vkGetEventStatus");
+				SetEvent = (PFN_vkSetEvent) detail::getDeviceProcAddr(instance, device, "vkSetEvent");
+				ResetEvent = (PFN_vkResetEvent) detail::getDeviceProcAddr(instance, device, "vkResetEvent");
+				CreateQueryPool = (PFN_vkCreateQueryPool) detail::getDeviceProcAddr(instance, device, "vkCreateQueryPool");
+				DestroyQueryPool = (PFN_vkDestroyQueryPool) detail::getDeviceProcAddr(instance, device, "vkDestroyQueryPool");
+				GetQueryPoolResults = (PFN_vkGetQueryPoolResults) detail::getDeviceProcAddr(instance, device, "vkGetQueryPoolResults");
+				CreateBuffer = (PFN_vkCreateBuffer) detail::getDeviceProcAddr(instance, device, "vkCreateBuffer");
+				DestroyBuffer = (PFN_vkDestroyBuffer) detail::getDeviceProcAddr(instance, device, "vkDestroyBuffer");
+				CreateBufferView = (PFN_vkCreateBufferView) detail::getDeviceProcAddr(instance, device, "vkCreateBufferView");
+				DestroyBufferView = (PFN_vkDestroyBufferView) detail::getDeviceProcAddr(instance, device, "vkDestroyBufferView");
+				CreateImage = (PFN_vkCreateImage) detail::getDeviceProcAddr(instance, device, "vkCreateImage");
+				DestroyImage = (PFN_vkDestroyImage) detail::getDeviceProcAddr(instance, device, "vkDestroyImage");
+				GetImageSubresourceLayout = (PFN_vkGetImageSubresourceLayout) detail::getDeviceProcAddr(instance, device, "vkGetImageSubresourceLayout");
+				CreateImageView = (PFN_vkCreateImageView) detail::getDeviceProcAddr(instance, device, "vkCreateImageView");
+				DestroyImageView = (PFN_vkDestroyImageView) detail::getDeviceProcAddr(instance, device, "vkDestroyImageView");
+				CreateShaderModule = (PFN_vkCreateShaderModule) detail::getDeviceProcAddr(instance, device, "vkCreateShaderModule");
+				DestroyShaderModule = (PFN_vkDestroyShaderModule) detail::getDeviceProcAddr(instance, device, "vkDestroyShaderModule");
+				CreatePipelineCache = (PFN_vkCreatePipelineCache) detail::getDeviceProcAddr(instance, device, "vkCreatePipelineCache");
+				DestroyPipelineCache = (PFN_vkDestroyPipelineCache) detail::getDeviceProcAddr(instance, device, "vkDestroyPipelineCache");
+				GetPipelineCacheData = (PFN_vkGetPipelineCacheData) detail::getDeviceProcAddr(instance, device, "vkGetPipelineCacheData");
+				MergePipelineCaches = (PFN_vkMergePipelineCaches) detail::getDeviceProcAddr(instance, device, "vkMergePipelineCaches");
+				CreateGraphicsPipelines = (PFN_vkCreateGraphicsPipelines) detail::getDeviceProcAddr(instance, device, "vkCreateGraphicsPipelines");
+				CreateComputePipelines = (PFN_vkCreateComputePipelines) detail::getDeviceProcAddr(instance, device, "vkCreateComputePipelines");
+				DestroyPipeline = (PFN_vkDestroyPipeline) detail::getDeviceProcAddr(instance, device, "vkDestroyPipeline");
+				CreatePipelineLayout = (PFN_vkCreatePipelineLayout) detail::getDeviceProcAddr(instance, device, "vkCreatePipelineLayout");
+				DestroyPipelineLayout = (PFN_vkDestroyPipelineLayout) detail::getDeviceProcAddr(instance, device, "vkDestroyPipelineLayout");
+				CreateSampler = (PFN_vkCreateSampler) detail::getDeviceProcAddr(instance, device, "vkCreateSampler");
+				DestroySampler = (PFN_vkDestroySampler) detail::getDeviceProcAddr(instance, device, "vkDestroySampler");
+				CreateDescriptorSetLayout = (PFN_vkCreateDescriptorSetLayout) detail::getDeviceProcAddr(instance, device, "vkCreateDescriptorSetLayout");
+				DestroyDescriptorSetLayout = (PFN_vkDestroyDescriptorSetLayout) detail::getDeviceProcAddr(instance, device, "vkDestroyDescriptorSetLayout");
+				CreateDescriptorPool = (PFN_vkCreateDescriptorPool) detail::getDeviceProcAddr(instance, device, "vkCreateDescriptorPool");
+				DestroyDescriptorPool = (PFN_vkDestroyDescriptorPool) detail::getDeviceProcAddr(instance, device, "vkDestroyDescriptorPool");
+				ResetDescriptorPool = (PFN_vkResetDescriptorPool) detail::getDeviceProcAddr(instance, device, "vkResetDescriptorPool");
+				AllocateDescriptorSets = (PFN_vkAllocateDescriptorSets) detail::getDeviceProcAddr(instance, device, "vkAllocateDescriptorSets");
+				FreeDescriptorSets = (PFN_vkFreeDescriptorSets) detail::getDeviceProcAddr(instance, device, "vkFreeDescriptorSets");
+				UpdateDescriptorSets = (PFN_vkUpdateDescriptorSets) detail::getDeviceProcAddr(instance, device, "vkUpdateDescriptorSets");
+				CreateFramebuffer = (PFN_vkCreateFramebuffer) detail::getDeviceProcAddr(instance, device, "vkCreateFramebuffer");
+				DestroyFramebuffer = (PFN_vkDestroyFramebuffer) detail::getDeviceProcAddr(instance, device, "vkDestroyFramebuffer");
+				CreateRenderPass = (PFN_vkCreateRenderPass) detail::getDeviceProcAddr(instance, device, "vkCreateRenderPass");
+				DestroyRenderPass = (PFN_vkDestroyRenderPass) detail::getDeviceProcAddr(instance, device, "vkDestroyRenderPass");
+				GetRenderAreaGranularity = (PFN_vkGetRenderAreaGranularity) detail::getDeviceProcAddr(instance, device, "vkGetRenderAreaGranularity");
+				CreateCommandPool = (PFN_vkCreateCommandPool) detail::getDeviceProcAddr(instance, device, "vkCreateCommandPool");
+				DestroyCommandPool = (PFN_vkDestroyCommandPool) detail::getDeviceProcAddr(instance, device, "vkDestroyCommandPool");
+				ResetCommandPool = (PFN_vkResetCommandPool) detail::getDeviceProcAddr(instance, device, "vkResetCommandPool");
+				AllocateCommandBuffers = (PFN_vkAllocateCommandBuffers) detail::getDeviceProcAddr(instance, device, "vkAllocateCommandBuffers");
+				FreeCommandBuffers = (PFN_vkFreeCommandBuffers) detail::getDeviceProcAddr(instance, device, "vkFreeCommandBuffers");
+				BeginCommandBuffer = (PFN_vkBeginCommandBuffer) detail::getDeviceProcAddr(instance, device, "vkBeginCommandBuffer");
+				EndCommandBuffer = (PFN_vkEndCommandBuffer) detail::getDeviceProcAddr(instance, device, "vkEndCommandBuffer");
+				ResetCommandBuffer = (PFN_vkResetCommandBuffer) detail::getDeviceProcAddr(instance, device, "vkResetCommandBuffer");
+				CmdBindPipeline = (PFN_vkCmdBindPipeline) detail::getDeviceProcAddr(instance, device, "vkCmdBindPipeline");
+				CmdSetViewport = (PFN_vkCmdSetViewport) detail::getDeviceProcAddr(instance, device, "vkCmdSetViewport");
+				CmdSetScissor = (PFN_vkCmdSetScissor) detail::getDeviceProcAddr(instance, device, "vkCmdSetScissor");
+				CmdSetLineWidth = (PFN_vkCmdSetLineWidth) detail::getDeviceProcAddr(instance, device, "vkCmdSetLineWidth");
+				CmdSetDepthBias = (PFN_vkCmdSetDepthBias) detail::getDeviceProcAddr(instance, device, "vkCmdSetDepthBias");
+				CmdSetBlendConstants = (PFN_vkCmdSetBlendConstants) detail::getDeviceProcAddr(instance, device, "vkCmdSetBlendConstants");
+				CmdSetDepthBounds = (PFN_vkCmdSetDepthBounds) detail::getDeviceProcAddr(instance, device, "vkCmdSetDepthBounds");
+				CmdSetStencilCompareMask = (PFN_vkCmdSetStencilCompareMask) detail::getDeviceProcAddr(instance, device, "vkCmdSetStencilCompareMask");
+				CmdSetStencilWriteMask = (PFN_vkCmdSetStencilWriteMask) detail::getDeviceProcAddr(instance, device, "vkCmdSetStencilWriteMask");
+				CmdSetStencilReference = (PFN_vkCmdSetStencilReference) detail::getDeviceProcAddr(instance, device, "vkCmdSetStencilReference");
+				CmdBindDescriptorSets = (PFN_vkCmdBindDescriptorSets) detail::getDeviceProcAddr(instance, device, "vkCmdBindDescriptorSets");
+				CmdBindIndexBuffer = (PFN_vkCmdBindIndexBuffer) detail::getDeviceProcAddr(instance, device, "vkCmdBindIndexBuffer");
+				CmdBindVertexBuffers = (PFN_vkCmdBindVertexBuffers) detail::getDeviceProcAddr(instance, device, "vkCmdBindVertexBuffers");
+				CmdDraw = (PFN_vkCmdDraw) detail::getDeviceProcAddr(instance, device, "vkCmdDraw");
+				CmdDrawIndexed = (PFN_vkCmdDrawIndexed) detail::getDeviceProcAddr(instance, device, "vkCmdDrawIndexed");
+				CmdDrawIndirect = (PFN_vkCmdDrawIndirect) detail::getDeviceProcAddr(instance, device, "vkCmdDrawIndirect");
+				CmdDrawIndexedIndirect = (PFN_vkCmdDrawIndexedIndirect) detail::getDeviceProcAddr(instance, device, "vkCmdDrawIndexedIndirect");
+				CmdDispatch = (PFN_vkCmdDispatch) detail::getDeviceProcAddr(instance, device, "vkCmdDispatch");
+				CmdDispatchIndirect = (PFN_vkCmdDispatchIndirect) detail::getDeviceProcAddr(instance, device, "vkCmdDispatchIndirect");
+				CmdCopyBuffer = (PFN_vkCmdCopyBuffer) detail::getDeviceProcAddr(instance, device, "vkCmdCopyBuffer");
+				CmdCopyImage = (PFN_vkCmdCopyImage) detail::getDeviceProcAddr(instance, device, "vkCmdCopyImage");
+				CmdBlitImage = (PFN_vkCmdBlitImage) detail::getDeviceProcAddr(instance, device, "vkCmdBlitImage");
+				CmdCopyBufferToImage = (PFN_vkCmdCopyBufferToImage) detail::getDeviceProcAddr(instance, device, "vkCmdCopyBufferToImage");
+				CmdCopyImageToBuffer = (PFN_vkCmdCopyImageToBuffer) detail::getDeviceProcAddr(instance, device, "vkCmdCopyImageToBuffer");
+				CmdUpdateBuffer = (PFN_vkCmdUpdateBuffer) detail::getDeviceProcAddr(instance, device, "vkCmdUpdateBuffer");
+				CmdFillBuffer = (PFN_vkCmdFillBuffer) detail::getDeviceProcAddr(instance, device, "vkCmdFillBuffer");
+				CmdClearColorImage = (PFN_vkCmdClearColorImage) detail::getDeviceProcAddr(instance, device, "vkCmdClearColorImage");
+				CmdClearDepthStencilImage = (PFN_vkCmdClearDepthStencilImage) detail::getDeviceProcAddr(instance, device, "vkCmdClearDepthStencilImage");
+				CmdClearAttachments = (PFN_vkCmdClearAttachments) detail::getDeviceProcAddr(instance, device, "vkCmdClearAttachments");
+				CmdResolveImage = (PFN_vkCmdResolveImage) detail::getDeviceProcAddr(instance, device, "vkCmdResolveImage");
+				CmdSetEvent = (PFN_vkCmdSetEvent) detail::getDeviceProcAddr(instance, device, "vkCmdSetEvent");
+				CmdResetEvent = (PFN_vkCmdResetEvent) detail::getDeviceProcAddr(instance, device, "vkCmdResetEvent");
+				CmdWaitEvents = (PFN_vkCmdWaitEvents) detail::getDeviceProcAddr(instance, device, "vkCmdWaitEvents");
+				CmdPipelineBarrier = (PFN_vkCmdPipelineBarrier) detail::getDeviceProcAddr(instance, device, "vkCmdPipelineBarrier");
+				CmdBeginQuery = (PFN_vkCmdBeginQuery) detail::getDeviceProcAddr(instance, device, "vkCmdBeginQuery");
+				CmdEndQuery = (PFN_vkCmdEndQuery) detail::getDeviceProcAddr(instance, device, "vkCmdEndQuery");
+				CmdResetQueryPool = (PFN_vkCmdResetQueryPool) detail::getDeviceProcAddr(instance, device, "vkCmdResetQueryPool");
+				CmdWriteTimestamp = (PFN_vkCmdWriteTimestamp) detail::getDeviceProcAddr(instance, device, "vkCmdWriteTimestamp");
+				CmdCopyQueryPoolResults = (PFN_vkCmdCopyQueryPoolResults) detail::getDeviceProcAddr(instance, device, "vkCmdCopyQueryPoolResults");
+				CmdPushConstants = (PFN_vkCmdPushConstants) detail::getDeviceProcAddr(instance, device, "vkCmdPushConstants");
+				CmdBeginRenderPass = (PFN_vkCmdBeginRenderPass) detail::getDeviceProcAddr(instance, device, "vkCmdBeginRenderPass");
+				CmdNextSubpass = (PFN_vkCmdNextSubpass) detail::getDeviceProcAddr(instance, device, "vkCmdNextSubpass");
+				CmdEndRenderPass = (PFN_vkCmdEndRenderPass) detail::getDeviceProcAddr(instance, device, "vkCmdEndRenderPass");
+				CmdExecuteCommands = (PFN_vkCmdExecuteCommands) detail::getDeviceProcAddr(instance, device, "vkCmdExecuteCommands");
+			}
+		};
+	};
+	
+	namespace ext
+	{
+		
+		struct KHR_surface
+		{
+			static constexpr uint32_t commandCount = 5;
+			
+			static VkBool32 isSupported() { return vkelHasExtension(VKEL_EXT_ID_KHR_surface); }
+			
+			struct Table
+			{
+				PFN_vkDestroySurfaceKHR DestroySurfaceKHR;
+				PFN_vkGetPhysicalDeviceSurfaceSupportKHR GetPhysicalDeviceSurfaceSupportKHR;
+				PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR GetPhysicalDeviceSurfaceCapabilitiesKHR;
+				PFN_vkGetPhysicalDeviceSurfaceFormatsKHR GetPhysicalDeviceSurfaceFormatsKHR;
+				PFN_vkGetPhysicalDeviceSurfacePresentModesKHR GetPhysicalDeviceSurfacePresentModesKHR;
+				
+				void load(VkInstance instance, VkDevice device)
+				{
+					(void) instance;
+					(void) device;
+					
+					DestroySurfaceKHR = (PFN_vkDestroySurfaceKHR) detail::getInstanceProcAddr(instance, "vkDestroySurfaceKHR");
+					GetPhysicalDeviceSurfaceSupportKHR = (PFN_vkGetPhysicalDeviceSurfaceSupportKHR) detail::getInstanceProcAddr(instance, "vkGetPhysicalDeviceSurfaceSupportKHR");
+					GetPhysicalDeviceSurfaceCapabilitiesKHR = (PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR) detail::getInstanceProcAddr(instance, "vkGetPhysicalDeviceSurfaceCapabilitiesKHR");
+					GetPhysicalDeviceSurfaceFormatsKHR = (PFN_vkGetPhysicalDeviceSurfaceFormatsKHR) detail::getInstanceProcAddr(instance, "vkGetPhysicalDeviceSurfaceFormatsKHR");
+					GetPhysicalDeviceSurfacePresentModesKHR = (PFN_vkGetPhysicalDeviceSurfacePresentModesKHR) detail::getInstanceProcAddr(instance, "vkGetPhysicalDeviceSurfacePresentModesKHR");
+				}
+			};
+		};
+		
+		struct KHR_swapchain
+		{
+			static constexpr uint32_t commandCount = 5;
+			
+			static VkBool32 isSupported() { return vkelHasExtension(VKEL_EXT_ID_KHR_swapchain); }
+			
+			struct Table
+			{
+				PFN_vkCreateSwapchainKHR CreateSwapchainKHR;
+				PFN_vkDestroySwapchainKHR DestroySwapchainKHR;
+				PFN_vkGetSwapchainImagesKHR GetSwapchainImagesKHR;
+				PFN_vkAcquireNextImageKHR AcquireNextImageKHR;
+				PFN_vkQueuePresentKHR QueuePresentKHR;
+				
+				void load(VkInstance instance, VkDevice device)
+				{
+					(void) instance;
+					(void) device;
+					
+					CreateSwapchainKHR = (PFN_vkCreateSwapchainKHR) detail::getDeviceProcAddr(instance, device, "vkCreateSwapchainKHR");
+					DestroySwapchainKHR = (PFN_vkDestroySwapchainKHR) detail::getDeviceProcAddr(instance, device, "vkDestroySwapchainKHR");
+					GetSwapchainImagesKHR = (PFN_vkGetSwapchainImagesKHR) detail::getDeviceProcAddr(instance, device, "vkGetSwapchainImagesKHR");
+					AcquireNextImageKHR = (PFN_vkAcquireNextImageKHR) detail::getDeviceProcAddr(instance, device, "vkAcquireNextImageKHR");
+					QueuePresentKHR = (PFN_vkQueuePresentKHR) detail::getDeviceProcAddr(instance, device, "vkQueuePresentKHR");
+				}
+			};
+		};
+		
+		struct KHR_display
+		{
+			static constexpr uint32_t commandCount = 7;
+			
+			static VkBool32 isSupported() { return vkelHasExtension(VKEL_EXT_ID_KHR_display); }
+			
+			struct Table
+			{
+				PFN_vkGetPhysicalDeviceDisplayPropertiesKHR GetPhysicalDeviceDisplayPropertiesKHR;
+				PFN_vkGetPhysicalDeviceDisplayPlanePropertiesKHR GetPhysicalDeviceDisplayPlanePropertiesKHR;
+				PFN_vkGetDisplayPlaneSupportedDisplaysKHR GetDisplayPlaneSupportedDisplaysKHR;
+				PFN_vkGetDisplayModePropertiesKHR GetDisplayModePropertiesKHR;
+				PFN_vkCreateDisplayModeKHR CreateDisplayModeKHR;
+				PFN_vkGetDisplayPlaneCapabilitiesKHR GetDisplayPlaneCapabilitiesKHR;
+				PFN_vkCreateDisplayPlaneSurfaceKHR CreateDisplayPlaneSurfaceKHR;
+				
+				void load(VkInstance instance, VkDevice device)
+				{
+					(void) instance;
+					(void) device;
+					
+					GetPhysicalDeviceDisplayPropertiesKHR = (PFN_vkGetPhysicalDeviceDisplayPropertiesKHR) detail::getInstanceProcAddr(instance, "vkGetPhysicalDeviceDisplayPropertiesKHR");
+					GetPhysicalDeviceDisplayPlanePropertiesKHR = (PFN_vkGetPhysicalDeviceDisplayPlanePropertiesKHR) detail::getInstanceProcAddr(instance, "vkGetPhysicalDeviceDisplayPlanePropertiesKHR");
+					GetDisplayPlaneSupportedDisplaysKHR = (PFN_vkGetDisplayPlaneSupportedDisplaysKHR) detail::getInstanceProcAddr(instance, "vkGetDisplayPlaneSupportedDisplaysKHR");
+					GetDisplayModePropertiesKHR = (PFN_vkGetDisplayModePropertiesKHR) detail::getInstanceProcAddr(instance, "vkGetDisplayModePropertiesKHR");
+					CreateDisplayModeKHR = (PFN_vkCreateDisplayModeKHR) detail::getInstanceProcAddr(instance, "vkCreateDisplayModeKHR");
+					GetDisplayPlaneCapabilitiesKHR = (PFN_vkGetDisplayPlaneCapabilitiesKHR) detail::getInstanceProcAddr(instance, "vkGetDisplayPlaneCapabilitiesKHR");
+					CreateDisplayPlaneSurfaceKHR = (PFN_vkCreateDisplayPlaneSurfaceKHR) detail::getInstanceProcAddr(instance, "vkCreateDisplayPlaneSurfaceKHR");
+				}
+			};
+		};
+		
+		struct KHR_display_swapchain
+		{
+			static constexpr uint32_t commandCount = 1;
+			
+			static VkBool32 isSupported() { return vkelHasExtension(VKEL_EXT_ID_KHR_display_swapchain); }
+			
+			struct Table
+			{
+				PFN_vkCreateSharedSwapchainsKHR CreateSharedSwapchainsKHR;
+				
+				void load(VkInstance instance, VkDevice device)
+				{
+					(void) instance;
+					(void) device;
+					
+					CreateSharedSwapchainsKHR = (PFN_vkCreateSharedSwapchainsKHR) detail::getDeviceProcAddr(instance, device, "vkCreateSharedSwapchainsKHR");
+				}
+			};
+		};
+		
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+		struct KHR_xlib_surface
+		{
+			static constexpr uint32_t commandCount = 2;
+			
+			static VkBool32 isSupported() { return vkelHasExtension(VKEL_EXT_ID_KHR_xlib_surface); }
+			
+			struct Table
+			{
+				PFN_vkCreateXlibSurfaceKHR CreateXlibSurfaceKHR;
+				PFN_vkGetPhysicalDeviceXlibPresentationSupportKHR GetPhysicalDeviceXlibPresentationSupportKHR;
+				
+				void load(VkInstance instance, VkDevice device)
+				{
+					(void) instance;
+					(void) device;
+					
+					CreateXlibSurfaceKHR = (PFN_vkCreateXlibSurfaceKHR) detail::getInstanceProcAddr(instance, "vkCreateXlibSurfaceKHR");
+					GetPhysicalDeviceXlibPresentationSupportKHR = (PFN_vkGetPhysicalDeviceXlibPresentationSupportKHR) detail::getInstanceProcAddr(instance, "vkGetPhysicalDeviceXlibPresentationSupportKHR");
+				}
+			};
+		};
+#endif /* VK_USE_PLATFORM_XLIB_KHR */
+		
+#ifdef VK_USE_PLATFORM_XCB_KHR
+		struct KHR_xcb_surface
+		{
+			static constexpr uint32_t commandCount = 2;
+			
+			static VkBool32 isSupported() { return vkelHasExtension(VKEL_EXT_ID_KHR_xcb_surface); }
+			
+			struct Table
+			{
+				PFN_vkCreateXcbSurfaceKHR CreateXcbSurfaceKHR;
+				PFN_vkGetPhysicalDeviceXcbPresentationSupportKHR GetPhysicalDeviceXcbPresentationSupportKHR;
+				
+				void load(VkInstance instance, VkDevice device)
+				{
+					(void) instance;
+					(void) device;
+					
+					CreateXcbSurfaceKHR = (PFN_vkCreateXcbSurfaceKHR) detail::getInstanceProcAddr(instance, "vkCreateXcbSurfaceKHR");
+					GetPhysicalDeviceXcbPresentationSupportKHR = (PFN_vkGetPhysicalDeviceXcbPresentationSupportKHR) detail::getInstanceProcAddr(instance, "vkGetPhysicalDeviceXcbPresentationSupportKHR");
+				}
+			};
+		};
+#endif /* VK_USE_PLATFORM_XCB_KHR */
+		
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+		struct KHR_wayland_surface
+		{
+			static constexpr uint32_t commandCount = 2;
+			
+			static VkBool32 isSupported() { return vkelHasExtension(VKEL_EXT_ID_KHR_wayland_surface); }
+			
+			struct Table
+			{
+				PFN_vkCreateWaylandSurfaceKHR CreateWaylandSurfaceKHR;
+				PFN_vkGetPhysicalDeviceWaylandPresentationSupportKHR GetPhysicalDeviceWaylandPresentationSupportKHR;
+				
+				void load(VkInstance instance, VkDevice device)
+				{
+					(void) instance;
+					(void) device;
+					
+					CreateWaylandSurfaceKHR = (PFN_vkCreateWaylandSurfaceKHR) detail::getInstanceProcAddr(instance, "vkCreateWaylandSurfaceKHR");
+					GetPhysicalDeviceWaylandPresentationSupportKHR = (PFN_vkGetPhysicalDeviceWaylandPresentationSupportKHR) detail::getInstanceProcAddr(instance, "vkGetPhysicalDeviceWaylandPresentationSupportKHR");
+				}
+			};
+		};
+#endif /* VK_USE_PLATFORM_WAYLAND_KHR */
+		
+#ifdef VK_USE_PLATFORM_MIR_KHR
+		struct KHR_mir_surface
+		{
+			static constexpr uint32_t commandCount = 2;
+			
+			static VkBool32 isSupported() { return vkelHasExtension(VKEL_EXT_ID_KHR_mir_surface); }
+			
+			struct Table
+			{
+				PFN_vkCreateMirSurfaceKHR CreateMirSurfaceKHR;
+				PFN_vkGetPhysicalDeviceMirPresentationSupportKHR GetPhysicalDeviceMirPresentationSupportKHR;
+				
+				void load(VkInstance instance, VkDevice device)
+				{
+					(void) instance;
+					(void) device;
+					
+					CreateMirSurfaceKHR = (PFN_vkCreateMirSurfaceKHR) detail::getInstanceProcAddr(instance, "vkCreateMirSurfaceKHR");
+					GetPhysicalDeviceMirPresentationSupportKHR = (PFN_vkGetPhysicalDeviceMirPresentationSupportKHR) detail::getInstanceProcAddr(instance, "vkGetPhysicalDeviceMirPresentationSupportKHR");
+				}
+			};
+		};
+#endif /* VK_USE_PLATFORM_MIR_KHR */
+		
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+		struct KHR_android_surface
+		{
+			static constexpr uint32_t commandCount = 1;
+			
+			static VkBool32 isSupported() { return vkelHasExtension(VKEL_EXT_ID_KHR_android_surface); }
+			
+			struct Table
+			{
+				PFN_vkCreateAndroidSurfaceKHR CreateAndroidSurfaceKHR;
+				
+				void load(VkInstance instance, VkDevice device)
+				{
+					(void) instance;
+					(void) device;
+					
+					CreateAndroidSurfaceKHR = (PFN_vkCreateAndroidSurfaceKHR) detail::getInstanceProcAddr(instance, "vkCreateAndroidSurfaceKHR");
+				}
+			};
+		};
+#endif /* VK_USE_PLATFORM_ANDROID_KHR */
+		
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+		struct KHR_win32_surface
+		{
+			static constexpr uint32_t commandCount = 2;
+			
+			static VkBool32 isSupported() { return vkelHasExtension(VKEL_EXT_ID_KHR_win32_surface); }
+			
+			struct Table
+			{
+				PFN_vkCreateWin32SurfaceKHR CreateWin32SurfaceKHR;
+				PFN_vkGetPhysicalDeviceWin32PresentationSupportKHR GetPhysicalDeviceWin32PresentationSupportKHR;
+				
+				void load(VkInstance instance, VkDevice device)
+				{
+					(void) instance;
+					(void) device;
+					
+					CreateWin32SurfaceKHR = (PFN_vkCreateWin32SurfaceKHR) detail::getInstanceProcAddr(instance, "vkCreateWin32SurfaceKHR");
+					GetPhysicalDeviceWin32PresentationSupportKHR = (PFN_vkGetPhysicalDeviceWin32PresentationSupportKHR) detail::getInstanceProcAddr(instance, "vkGetPhysicalDeviceWin32PresentationSupportKHR");
+				}
+			};
+		};
+#endif /* VK_USE_PLATFORM_WIN32_KHR */
+		
+		struct KHR_sampler_mirror_clamp_to_edge
+		{
+			static constexpr uint32_t commandCount = 0;
+			
+			static VkBool32 isSupported() { return vkelHasExtension(VKEL_EXT_ID_KHR_sampler_mirror_clamp_to_edge); }
+			
+			struct Table
+			{
+				void load(VkInstance instance, VkDevice device)
+				{
+					(void) instance;
+					(void) device;
+				}
+			};
+		};
+		
+		struct EXT_debug_report
+		{
+			static constexpr uint32_t commandCount = 3;
+			
+			static VkBool32 isSupported() { return vkelHasExtension(VKEL_EXT_ID_EXT_debug_report); }
+			
+			struct Table
+			{
+				PFN_vkCreateDebugReportCallbackEXT CreateDebugReportCallbackEXT;
+				PFN_vkDestroyDebugReportCallbackEXT DestroyDebugReportCallbackEXT;
+				PFN_vkDebugReportMessageEXT DebugReportMessageEXT;
+				
+				void load(VkInstance instance, VkDevice device)
+				{
+					(void) instance;
+					(void) device;
+					
+					CreateDebugReportCallbackEXT = (PFN_vkCreateDebugReportCallbackEXT) detail::getInstanceProcAddr(instance, "vkCreateDebugReportCallbackEXT");
+					DestroyDebugReportCallbackEXT = (PFN_vkDestroyDebugReportCallbackEXT) detail::getInstanceProcAddr(instance, "vkDestroyDebugReportCallbackEXT");
+					DebugReportMessageEXT = (PFN_vkDebugReportMessageEXT) detail::getInstanceProcAddr(instance, "vkDebugReportMessageEXT");
+				}
+			};
+		};
+		
+		struct NV_glsl_shader
+		{
+			static constexpr uint32_t commandCount = 0;
+			
+			static VkBool32 isSupported() { return vkelHasExtension(VKEL_EXT_ID_NV_glsl_shader); }
+			
+			struct Table
+			{
+				void load(VkInstance instance, VkDevice device)
+				{
+					(void) instance;
+					(void) device;
+				}
+			};
+		};
+		
+		struct IMG_filter_cubic
+		{
+			static constexpr uint32_t commandCount = 0;
+			
+			static VkBool32 isSupported() { return vkelHasExtension(VKEL_EXT_ID_IMG_filter_cubic); }
+			
+			struct Table
+			{
+				void load(VkInstance instance, VkDevice device)
+				{
+					(void) instance;
+					(void) device;
+				}
+			};
+		};
+		
+		struct AMD_rasterization_order
+		{
+			static constexpr uint32_t commandCount = 0;
+			
+			static VkBool32 isSupported() { return vkelHasExtension(VKEL_EXT_ID_AMD_rasterization_order); }
+			
+			struct Table
+			{
+				void load(VkInstance instance, VkDevice device)
+				{
+					(void) instance;
+					(void) device;
+				}
+			};
+		};
+		
+		struct AMD_shader_trinary_minmax
+		{
+			static constexpr uint32_t commandCount = 0;
+			
+			static VkBool32 isSupported() { return vkelHasExtension(VKEL_EXT_ID_AMD_shader_trinary_minmax); }
+			
+			struct Table
+			{
+				void load(VkInstance instance, VkDevice device)
+				{
+					(void) instance;
+					(void) device;
+				}
+			};
+		};
+		
+		struct AMD_shader_explicit_vertex_parameter
+		{
+			static constexpr uint32_t commandCount = 0;
+			
+			static VkBool32 isSupported() { return vkelHasExtension(VKEL_EXT_ID_AMD_shader_explicit_vertex_parameter); }
+			
+			struct Table
+			{
+				void load(VkInstance instance, VkDevice device)
+				{
+					(void) instance;
+					(void) device;
+				}
+			};
+		};
+		
+		struct EXT_debug_marker
+		{
+			static constexpr uint32_t commandCount = 5;
+			
+			static VkBool32 isSupported() { return vkelHasExtension(VKEL_EXT_ID_EXT_debug_marker); }
+			
+			struct Table
+			{
+				PFN_vkDebugMarkerSetObjectTagEXT DebugMarkerSetObjectTagEXT;
+				PFN_vkDebugMarkerSetObjectNameEXT DebugMarkerSetObjectNameEXT;
+				PFN_vkCmdDebugMarkerBeginEXT CmdDebugMarkerBeginEXT;
+				PFN_vkCmdDebugMarkerEndEXT CmdDebugMarkerEndEXT;
+				PFN_vkCmdDebugMarkerInsertEXT CmdDebugMarkerInsertEXT;
+				
+				void load(VkInstance instance, VkDevice device)
+				{
+					(void) instance;
+					(void) device;
+					
+					DebugMarkerSetObjectTagEXT = (PFN_vkDebugMarkerSetObjectTagEXT) detail::getDeviceProcAddr(instance, device, "vkDebugMarkerSetObjectTagEXT");
+					DebugMarkerSetObjectNameEXT = (PFN_vkDebugMarkerSetObjectNameEXT) detail::getDeviceProcAddr(instance, device, "vkDebugMarkerSetObjectNameEXT");
+					CmdDebugMarkerBeginEXT = (PFN_vkCmdDebugMarkerBeginEXT) detail::getDeviceProcAddr(instance, device, "vkCmdDebugMarkerBeginEXT");
+					CmdDebugMarkerEndEXT = (PFN_vkCmdDebugMarkerEndEXT) detail::getDeviceProcAddr(instance, device, "vkCmdDebugMarkerEndEXT");
+					CmdDebugMarkerInsertEXT = (PFN_vkCmdDebugMarkerInsertEXT) detail::getDeviceProcAddr(instance, device, "vkCmdDebugMarkerInsertEXT");
+				}
+			};
+		};
+		
+		struct AMD_gcn_shader
+		{
+			static constexpr uint32_t commandCount = 0;
+			
+			static VkBool32 isSupported() { return vkelHasExtension(VKEL_EXT_ID_AMD_gcn_shader); }
+			
+			struct Table
+			{
+				void load(VkInstance instance, VkDevice device)
+				{
+					(void) instance;
+					(void) device;
+				}
+			};
+		};
+		
+		struct NV_dedicated_allocation
+		{
+			static constexpr uint32_t commandCount = 0;
+			
+			static VkBool32 isSupported() { return vkelHasExtension(VKEL_EXT_ID_NV_dedicated_allocation); }
+			
+			struct Table
+			{
+				void load(VkInstance instance, VkDevice device)
+				{
+					(void) instance;
+					(void) device;
+				}
+			};
+		};
+		
+		struct IMG_format_pvrtc
+		{
+			static constexpr uint32_t commandCount = 0;
+			
+			static VkBool32 isSupported() { return vkelHasExtension(VKEL_EXT_ID_IMG_format_pvrtc); }
+			
+			struct Table
+			{
+				void load(VkInstance instance, VkDevice device)
+				{
+					(void) instance;
+					(void) device;
+				}
+			};
+		};
+		
+	}
+	
+	
+	// A table of exactly the functions of the listed extensions (and vkel::VERSION_1_0
+	// for the core functions) e.g. vkel::Loader<vkel::ext::KHR_swapchain>. Calling a
+	// function of an extension which isn't listed fails to compile.
+	//
+	// Functions are loaded using vkGetInstanceProcAddr(), so vkelInit() must be called first.
+	template<typename... Extensions>
+	class Loader : public Extensions::Table...
+	{
+	public:
+		// The number of functions that are resolved
+		static constexpr uint32_t commandCount = detail::CommandCount<Extensions...>::value;
+		
+		
+		// Device level functions are loaded using vkGetDeviceProcAddr() when a device is given,
+		// which skips the loader's dispatch for that device
+		void load(VkInstance instance, VkDevice device = VK_NULL_HANDLE)
+		{
+			int expand[] = { 0, (Extensions::Table::load(instance, device), 0)... };
+			(void) expand;
+		}
+		
+		// Whether all the listed extensions are supported, see vkelHasExtension()
+		static VkBool32 isSupported()
+		{
+			VkBool32 supported[] = { VK_TRUE, Extensions::isSupported()... };
+			
+			for (VkBool32 extensionSupported : supported)
+				if (!extensionSupported)
+					return VK_FALSE;
+			
+			return VK_TRUE;
+		}
+	};
+	
+}
+
+
+#endif /* _VKEL_HPP_ */
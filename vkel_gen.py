@@ -18,6 +18,9 @@ COPYRIGHT = br'''//=============================================================
 //     Vulkan (library)
 //     Windows (header) - needed for library loading on Windows
 //     dlfcn (header) - needed for library loading on non-Windows OS'
+//     dirent (header) - needed for vkelInitDirectICD() on non-Windows OS'
+//     pthread (header) - needed for vkelInitAsync() on non-Windows OS'
+//     fcntl, unistd (headers) - needed for vkelPrewarm() on non-Windows OS'
 //     Standard C Libraries (stdio, stdlib, string, assert) - needed for NULL, malloc()
 //                                                 calloc(), free(), memset(), assert()
 //
@@ -115,6 +118,19 @@ if '-f' in argv:
 if '-k' in argv:
 	keep = True
 
+# -p <profile>: only generate the functions, extensions and layers listed in a
+# usage profile, written by vkelWriteUsageProfile() (see VKEL_RECORD_USAGE)
+profile_path = None
+
+if '-p' in argv:
+	profile_index = argv.index('-p') + 1
+	
+	if profile_index >= argc:
+		print("Expected a usage profile after -p")
+		sys.exit(1)
+	
+	profile_path = argv[profile_index]
+
 
 vulkan_h = ""
 vk_platform_h = ""
@@ -201,6 +217,19 @@ layer_names = [
 ]
 
 
+# Extensions and layers get IDs in the order they are listed. New extensions
+# are appended to vulkan.h, so the existing IDs stay the same.
+extension_ids = [extension_name for extension_name in extension_names if extension_name]
+layer_ids = [layer_name for layer_name in layer_names if layer_name]
+
+
+def get_layer_id_name(layer_name):
+	if layer_name.startswith("LAYER_"):
+		return layer_name[len("LAYER_"):]
+	
+	return layer_name
+
+
 # all the functions no matter which platform
 all_funcs = []
 
@@ -251,6 +280,141 @@ for line in vulkan_h.splitlines():
 				platform_funcs[platform].append(func)
 
 
+# Commands (as opposed to callbacks like PFN_vkAllocationFunction) along with
+# their return type and parameters, parsed from their single-line PFN_* typedefs
+command_info = {}
+
+regex_command = re.compile(r"typedef\s+(.+?)\s*\(VKAPI_PTR\s+\*PFN_(\w+)\)\((.*)\);")
+regex_param = re.compile(r"^(.*?)(\w+)\s*(\[\w*\])?$")
+
+for line in vulkan_h.splitlines():
+	match_command = regex_command.search(line)
+	
+	if match_command and match_command.group(3).strip() != "void":
+		params = []
+		
+		for param in match_command.group(3).split(","):
+			match_param = regex_param.match(param.strip())
+			
+			# (type, name, array suffix)
+			params.append((match_param.group(1).strip(), match_param.group(2), match_param.group(3) or ""))
+		
+		command_info[match_command.group(2)] = (match_command.group(1).strip(), params)
+
+
+# The commands of each extension, core commands are listed under "VERSION_1_0"
+extension_funcs = {"VERSION_1_0": []}
+
+current_extension = None
+regex_extension = re.compile(r"^#define\s+VK_(\w+)\s+1\s*$")
+
+for line in vulkan_h.splitlines():
+	match_extension = regex_extension.match(line)
+	
+	if match_extension and (match_extension.group(1) == "VERSION_1_0" or match_extension.group(1) in extension_names):
+		current_extension = match_extension.group(1)
+		extension_funcs.setdefault(current_extension, [])
+		continue
+	
+	match_command = regex_command.search(line)
+	
+	if current_extension and match_command and match_command.group(2) in command_info:
+		extension_funcs[current_extension].append(match_command.group(2))
+
+
+# The regex above also matches callbacks (like PFN_vkAllocationFunction), which
+# aren't functions that can be loaded, so only keep the actual commands
+all_funcs = [func for func in all_funcs if func in command_info]
+
+for platform in platform_funcs:
+	platform_funcs[platform] = [func for func in platform_funcs[platform] if func in command_info]
+
+
+func_platforms = {}
+
+for platform in platform_funcs:
+	for func in platform_funcs[platform]:
+		func_platforms[func] = platform
+
+
+def get_dispatch_type(func):
+	if func not in command_info:
+		return None
+	
+	params = command_info[func][1]
+	
+	if params and params[0][0] in ("VkInstance", "VkPhysicalDevice", "VkDevice", "VkQueue", "VkCommandBuffer"):
+		return params[0][0]
+	
+	return None
+
+
+# Every command in the order they are declared, which is the layout of VkelTable. New
+# commands are appended to vulkan.h, so existing members never move. This is taken
+# before trimming, so trimmed and complete builds can share tables.
+table_funcs = [func for func in all_funcs if func in command_info]
+
+
+if profile_path:
+	print("Trimming using " + profile_path)
+	
+	with open(profile_path, "r") as f:
+		profile = set(line.strip() for line in f.read().splitlines() if line.strip())
+	
+	# Used by vkel itself
+	profile.update([
+		"vkGetInstanceProcAddr",
+		"vkGetDeviceProcAddr",
+		"vkEnumerateInstanceExtensionProperties",
+		"vkEnumerateInstanceLayerProperties",
+		"vkEnumerateDeviceExtensionProperties",
+		"vkEnumerateDeviceLayerProperties",
+		"vkEnumeratePhysicalDevices",
+		"vkGetPhysicalDeviceProperties",
+		"vkGetPhysicalDeviceQueueFamilyProperties",
+		"vkGetPhysicalDeviceMemoryProperties",
+		# By vkel_layer.c
+		"vkDestroyInstance",
+		"vkDestroyDevice",
+	])
+	
+	all_funcs = [func for func in all_funcs if func in profile]
+	
+	for platform in platform_funcs:
+		platform_funcs[platform] = [func for func in platform_funcs[platform] if func in profile]
+	
+	# Extensions are kept when checked or any of their functions are used
+	def is_extension_used(extension_name):
+		return ("VK_" + extension_name in profile) or any(func in profile for func in extension_funcs.get(extension_name, []))
+	
+	extension_names = [extension_name for extension_name in extension_names if is_extension_used(extension_name)]
+	extension_ids = [extension_name for extension_name in extension_ids if is_extension_used(extension_name)]
+	
+	layer_names = [layer_name for layer_name in layer_names if not layer_name or ("VK_" + layer_name in profile)]
+	layer_ids = [layer_name for layer_name in layer_ids if "VK_" + layer_name in profile]
+
+
+# Commands dispatched through a VkDevice, VkQueue or VkCommandBuffer, in the order they are
+# declared. vkGetDeviceProcAddr is left out, as that is what's used to load them.
+device_funcs = [func for func in all_funcs if get_dispatch_type(func) in ("VkDevice", "VkQueue", "VkCommandBuffer") and func != "vkGetDeviceProcAddr"]
+
+
+# Table members are named without the "vk" prefix, platform specific members are
+# always there (as PFN_vkVoidFunction when disabled) so the layout never changes
+def add_table_members(lines, funcs):
+	for func in funcs:
+		platform = func_platforms[func]
+		
+		if platform:
+			lines.append("#ifdef " + platform)
+			lines.append("\tPFN_{0} {1};".format(func, func[2:]))
+			lines.append("#else")
+			lines.append("\tPFN_vkVoidFunction {0};".format(func[2:]))
+			lines.append("#endif /* " + platform + " */")
+		else:
+			lines.append("\tPFN_{0} {1};".format(func, func[2:]))
+
+
 print("Processing vulkan.h and vk_platform.h")
 
 
@@ -370,6 +534,23 @@ extern "C" {
 // #	error You need to open vkel.h and add a #define VK_USE_PLATFORM_*_KHR. Please also report your OS on https://github.com/MrVallentin/vkel
 #endif
 
+
+// When building vkel as a shared library, define VKEL_SHARED (and VKEL_BUILD when building it)
+// and build with -fvisibility=hidden, then only the vkel* functions and vkelTable are exported
+#ifndef VKEL_API
+#	if defined(VKEL_SHARED) && defined(_WIN32)
+#		ifdef VKEL_BUILD
+#			define VKEL_API __declspec(dllexport)
+#		else
+#			define VKEL_API __declspec(dllimport)
+#		endif
+#	elif defined(VKEL_SHARED) && (defined(__GNUC__) || defined(__clang__))
+#		define VKEL_API __attribute__((visibility("default")))
+#	else
+#		define VKEL_API
+#	endif
+#endif
+
 ''')
 	
 	
@@ -393,87 +574,585 @@ extern "C" {
 	
 	
 	f.write(br'''
-extern PFN_vkVoidFunction vkelGetProcAddr(const char *pName);
+extern VKEL_API PFN_vkVoidFunction vkelGetProcAddr(const char *pName);
+
+extern VKEL_API PFN_vkVoidFunction vkelGetInstanceProcAddr(VkInstance instance, const char *pName);
+extern VKEL_API PFN_vkVoidFunction vkelGetDeviceProcAddr(VkDevice device, const char *pName);
+
 
-extern PFN_vkVoidFunction vkelGetInstanceProcAddr(VkInstance instance, const char *pName);
-extern PFN_vkVoidFunction vkelGetDeviceProcAddr(VkDevice device, const char *pName);
+// Passing NULL restores the default (malloc(), calloc() and free())
+extern VKEL_API void vkelSetAllocator(const VkAllocationCallbacks *pAllocator);
+extern VKEL_API const VkAllocationCallbacks* vkelGetAllocator(void);
 
 
-extern void vkelDeleteNames(uint32_t nameCount, char **names);
+extern VKEL_API void vkelDeleteNames(uint32_t nameCount, char **names);
 
 
-extern char** vkelGetInstanceExtensionNames(const char *pLayerName, uint32_t *extensionNameCount);
+extern VKEL_API char** vkelGetInstanceExtensionNames(const char *pLayerName, uint32_t *extensionNameCount);
 #define vkelDeleteInstanceExtensionNames vkelDeleteNames
 
-extern char** vkelGetInstanceLayerNames(uint32_t *layerNameCount);
+extern VKEL_API char** vkelGetInstanceLayerNames(uint32_t *layerNameCount);
 #define vkelDeleteInstanceLayerNames vkelDeleteNames
 
 
-extern char** vkelGetDeviceExtensionNames(VkPhysicalDevice physicalDevice, const char *pLayerName, uint32_t *extensionNameCount);
+extern VKEL_API char** vkelGetDeviceExtensionNames(VkPhysicalDevice physicalDevice, const char *pLayerName, uint32_t *extensionNameCount);
 #define vkelDeleteDeviceExtensionNames vkelDeleteNames
 
-extern char** vkelGetDeviceLayerNames(VkPhysicalDevice physicalDevice, uint32_t *layerNameCount);
+extern VKEL_API char** vkelGetDeviceLayerNames(VkPhysicalDevice physicalDevice, uint32_t *layerNameCount);
 #define vkelDeleteDeviceLayerNames vkelDeleteNames
 
 
-extern VkBool32 vkelIsInstanceLayerSupported(const char *pLayerName);
-extern VkBool32 vkelIsInstanceExtensionSupported(const char *pLayerName, const char *pExtensionName);
+// Check several names with a single enumeration, pSupported (optional) receives
+// a VkBool32 per name. Returns the number of supported names.
+extern VKEL_API uint32_t vkelQueryInstanceLayers(uint32_t layerNameCount, const char* const *pLayerNames, VkBool32 *pSupported);
+extern VKEL_API uint32_t vkelQueryInstanceExtensions(const char *pLayerName, uint32_t extensionNameCount, const char* const *pExtensionNames, VkBool32 *pSupported);
 
-extern VkBool32 vkelIsDeviceLayerSupported(VkPhysicalDevice physicalDevice, const char *pLayerName);
-extern VkBool32 vkelIsDeviceExtensionSupported(VkPhysicalDevice physicalDevice, const char *pLayerName, const char *pExtensionName);
+extern VKEL_API uint32_t vkelQueryDeviceLayers(VkPhysicalDevice physicalDevice, uint32_t layerNameCount, const char* const *pLayerNames, VkBool32 *pSupported);
+extern VKEL_API uint32_t vkelQueryDeviceExtensions(VkPhysicalDevice physicalDevice, const char *pLayerName, uint32_t extensionNameCount, const char* const *pExtensionNames, VkBool32 *pSupported);
 
 
-extern VkBool32 vkelInit(void);
-extern VkBool32 vkelInstanceInit(VkInstance instance);
-extern VkBool32 vkelDeviceInit(VkPhysicalDevice physicalDevice, VkDevice device);
+extern VKEL_API VkBool32 vkelIsInstanceLayerSupported(const char *pLayerName);
+extern VKEL_API VkBool32 vkelIsInstanceExtensionSupported(const char *pLayerName, const char *pExtensionName);
 
-extern void vkelUninit(void);
+extern VKEL_API VkBool32 vkelIsDeviceLayerSupported(VkPhysicalDevice physicalDevice, const char *pLayerName);
+extern VKEL_API VkBool32 vkelIsDeviceExtensionSupported(VkPhysicalDevice physicalDevice, const char *pLayerName, const char *pExtensionName);
+
+
+// Enumerated extensions and layers are remembered per physical device (VK_NULL_HANDLE for
+// the instance) and layer name, so each is only enumerated once. Invalidate them when the
+// results can change, e.g. when layers are installed or a physical device handle is reused
+// by a new instance. Safe while other threads are querying, which keep reading the results
+// they already found.
+extern VKEL_API void vkelInvalidateEnumerations(VkPhysicalDevice physicalDevice);
+extern VKEL_API void vkelInvalidateAllEnumerations(void);
+
+
+extern VKEL_API VkBool32 vkelInit(void);
+// Load an ICD directly instead of the Vulkan loader, if pManifestPath is NULL then
+// VK_ICD_FILENAMES, /usr/share/vulkan/icd.d and /etc/vulkan/icd.d are searched
+extern VKEL_API VkBool32 vkelInitDirectICD(const char *pManifestPath);
+extern VKEL_API VkBool32 vkelInstanceInit(VkInstance instance);
+extern VKEL_API VkBool32 vkelDeviceInit(VkPhysicalDevice physicalDevice, VkDevice device);
+
+extern VKEL_API void vkelUninit(void);
+
+
+// Background tasks, vkelWaitTask() must be called exactly once per task,
+// it returns the result of the task and releases the handle
+VK_DEFINE_HANDLE(VkelTask)
+
+extern VKEL_API VkelTask vkelInitAsync(void);
+
+extern VKEL_API VkBool32 vkelIsTaskComplete(VkelTask task);
+extern VKEL_API VkBool32 vkelWaitTask(VkelTask task);
+
+
+// Get the Vulkan library and the ICDs (the ones vkelInitDirectICD() would search) into the
+// page cache, so loading them doesn't page fault on cold storage (like after a reboot). It's
+// only a hint to the OS, so the earlier it's started (before vkelInit()) the better. Returns
+// VK_FALSE if no library was found.
+typedef struct VkelPrewarmStats {
+	uint32_t fileCount;
+	uint64_t byteCount;
+	// Time spent in vkelPrewarm(), not including reads still in flight
+	uint64_t nanoseconds;
+} VkelPrewarmStats;
+
+extern VKEL_API VkBool32 vkelPrewarm(void);
+extern VKEL_API VkelTask vkelPrewarmAsync(void);
+
+// Totals of all calls to vkelPrewarm() so far
+extern VKEL_API void vkelGetPrewarmStats(VkelPrewarmStats *pStats);
+
+
+#ifdef VKEL_RECORD_USAGE
+// Write the functions called through the vk* macros, and the extensions and layers checked
+// with vkelHasExtension() and vkelHasLayer(), one name per line. The file can be passed to
+// "vkel_gen.py -p <profile>" to generate a vkel.h and vkel.c with only those. The profile is
+// also written on exit when the VKEL_USAGE_PROFILE environment variable is set.
+extern VKEL_API VkBool32 vkelWriteUsageProfile(const char *pPath);
+#endif /* VKEL_RECORD_USAGE */
 
 
 ''')
 	
 	
-	f.write(b"// Instance and device extension names\n")
+	f.write(b"// Instance and device extension names, kept for compatibility (see vkelHasExtension())\n")
 	
 	# Are there any (instance or device) extensions? (is array empty)
 	if extension_names:
 		for extension_name in sorted(extension_names):
 			if extension_name:
-				f.write("extern VkBool32 VKEL_{0};\n".format(extension_name).encode("utf-8"))
+				f.write("#define VKEL_{0} vkelHasExtension(VKEL_EXT_ID_{0})\n".format(extension_name).encode("utf-8"))
 	
 	f.write(b"\n")
 	
 	
-	f.write(b"// Instance and device layer names\n")
+	f.write(b"// Instance and device layer names, kept for compatibility (see vkelHasLayer())\n")
 	
 	# Are there any (instance or device) layers? (is array empty)
 	if layer_names:
 		for layer_name in sorted(layer_names):
 			if layer_name:
-				f.write("extern VkBool32 VKEL_{0};\n".format(layer_name).encode("utf-8"))
+				f.write("#define VKEL_{0} vkelHasLayer(VKEL_LAYER_ID_{1})\n".format(layer_name, get_layer_id_name(layer_name)).encode("utf-8"))
 	
 	f.write(b"\n\n")
 	
 	
 	lines = []
 	
-	lines.append("// Functions")
+	lines.append("// Instance and device extension IDs")
+	lines.append("typedef enum VkelExtensionId {")
 	
-	# Generate all function pointers
-	for platform in sorted(platform_funcs):
+	for extension_id, extension_name in enumerate(extension_ids):
+		lines.append("\tVKEL_EXT_ID_{0} = {1},".format(extension_name, extension_id))
+	
+	lines.append("\tVKEL_EXT_ID_COUNT = {0}".format(len(extension_ids)))
+	lines.append("} VkelExtensionId;")
+	lines.append("")
+	
+	lines.append("// Instance and device layer IDs")
+	lines.append("typedef enum VkelLayerId {")
+	
+	for layer_id, layer_name in enumerate(layer_ids):
+		lines.append("\tVKEL_LAYER_ID_{0} = {1},".format(get_layer_id_name(layer_name), layer_id))
+	
+	lines.append("\tVKEL_LAYER_ID_COUNT = {0}".format(len(layer_ids)))
+	lines.append("} VkelLayerId;")
+	lines.append("")
+	lines.append("")
+	
+	# Always at least 1 word, as C doesn't allow zero-length arrays
+	lines.append("#define VKEL_EXT_WORD_COUNT {0}".format(max(1, (len(extension_ids) + 31) // 32)))
+	lines.append("#define VKEL_LAYER_WORD_COUNT {0}".format(max(1, (len(layer_ids) + 31) // 32)))
+	lines.append("")
+	lines.append("")
+	
+	f.write("\n".join(lines).encode("utf-8"))
+	
+	
+	f.write(br'''// The returned names are interned, the same ID always gives the same pointer
+extern VKEL_API const char* vkelGetExtensionName(VkelExtensionId extensionId);
+extern VKEL_API const char* vkelGetLayerName(VkelLayerId layerId);
+
+// Returns VKEL_EXT_ID_COUNT or VKEL_LAYER_ID_COUNT for unknown names
+extern VKEL_API VkelExtensionId vkelFindExtensionId(const char *pExtensionName);
+extern VKEL_API VkelLayerId vkelFindLayerId(const char *pLayerName);
+
+// Bitset of supported extensions and layers, indexed by their IDs
+typedef struct VkelCapabilities {
+	uint32_t extensions[VKEL_EXT_WORD_COUNT];
+	uint32_t layers[VKEL_LAYER_WORD_COUNT];
+} VkelCapabilities;
+
+#define vkelCapabilitiesHasExtension(pCapabilities, extensionId) ((((pCapabilities)->extensions[(uint32_t) (extensionId) / 32]) >> ((uint32_t) (extensionId) % 32)) & 1)
+#define vkelCapabilitiesHasLayer(pCapabilities, layerId) ((((pCapabilities)->layers[(uint32_t) (layerId) / 32]) >> ((uint32_t) (layerId) % 32)) & 1)
+
+// Updated by vkelInit() and vkelInstanceInit()
+extern VKEL_API const VkelCapabilities* vkelGetInstanceCapabilities(void);
+// Those of the device of the last vkelDeviceInit(), retired along with it (see vkelQuiescent())
+extern VKEL_API const VkelCapabilities* vkelGetDeviceCapabilities(void);
+
+extern VKEL_API void vkelGetPhysicalDeviceCapabilities(VkPhysicalDevice physicalDevice, VkelCapabilities *pCapabilities);
+
+// pCapabilities &= pOther, pCapabilities |= pOther and pCapabilities == pOther
+extern VKEL_API void vkelIntersectCapabilities(VkelCapabilities *pCapabilities, const VkelCapabilities *pOther);
+extern VKEL_API void vkelUniteCapabilities(VkelCapabilities *pCapabilities, const VkelCapabilities *pOther);
+extern VKEL_API VkBool32 vkelCompareCapabilities(const VkelCapabilities *pCapabilities, const VkelCapabilities *pOther);
+
+// Check the instance and (if vkelDeviceInit() was called) the device capabilities
+extern VKEL_API VkBool32 vkelHasExtension(VkelExtensionId extensionId);
+extern VKEL_API VkBool32 vkelHasLayer(VkelLayerId layerId);
+
+
+#define vkelCapabilitiesAddExtension(pCapabilities, extensionId) ((pCapabilities)->extensions[(uint32_t) (extensionId) / 32] |= 1u << ((uint32_t) (extensionId) % 32))
+#define vkelCapabilitiesAddLayer(pCapabilities, layerId) ((pCapabilities)->layers[(uint32_t) (layerId) / 32] |= 1u << ((uint32_t) (layerId) % 32))
+
+// What vkelRankPhysicalDevices() looks for, zero it to accept any device
+typedef struct VkelDeviceRequirements {
+	VkelCapabilities required;
+	// Each one that's supported raises the score
+	VkelCapabilities optional;
+	// At least one queue family must support all of them
+	VkQueueFlags queueFlags;
+} VkelDeviceRequirements;
+
+typedef struct VkelRankedDevice {
+	VkPhysicalDevice physicalDevice;
+	VkPhysicalDeviceType deviceType;
+	// Sum of the device local heaps
+	VkDeviceSize deviceLocalMemorySize;
+	// The first queue family supporting all of the required queue flags
+	uint32_t queueFamilyIndex;
+	uint32_t optionalCount;
+	uint64_t score;
+} VkelRankedDevice;
+
+// Rank the physical devices meeting the requirements (NULL for none), best first. The score
+// orders them by device type (discrete, integrated, virtual, CPU), then by the number of optional
+// extensions and layers, then by device local memory, and last by having dedicated compute and
+// transfer queue families. Extensions come from the enumeration cache. Works like
+// vkEnumeratePhysicalDevices(), if pRankedDevices is too small it gets the best ones and
+// VK_INCOMPLETE is returned.
+extern VKEL_API VkResult vkelRankPhysicalDevices(VkInstance instance, const VkelDeviceRequirements *pRequirements, uint32_t *pRankedDeviceCount, VkelRankedDevice *pRankedDevices);
+
+// The best ranked physical device, or VK_NULL_HANDLE if none meets the requirements
+extern VKEL_API VkPhysicalDevice vkelSelectPhysicalDevice(VkInstance instance, const VkelDeviceRequirements *pRequirements);
+
+
+// Queue families beyond this are left out of a VkelPhysicalDeviceProbe
+#ifndef VKEL_MAX_QUEUE_FAMILIES
+#	define VKEL_MAX_QUEUE_FAMILIES 16
+#endif
+
+// Physical devices probed by each vkelProbePhysicalDevices() at the same time
+#ifndef VKEL_PROBE_THREAD_COUNT
+#	define VKEL_PROBE_THREAD_COUNT 4
+#endif
+
+typedef struct VkelPhysicalDeviceProbe {
+	VkPhysicalDevice physicalDevice;
+	VkelCapabilities capabilities;
+	VkPhysicalDeviceProperties properties;
+	VkPhysicalDeviceMemoryProperties memoryProperties;
+	uint32_t queueFamilyCount;
+	VkQueueFamilyProperties queueFamilies[VKEL_MAX_QUEUE_FAMILIES];
+} VkelPhysicalDeviceProbe;
+
+// Probe the capabilities (which also fills the enumeration cache), properties, memory
+// properties and queue families of each physical device into pProbes, on a few threads
+// at once. Must be called after vkelInstanceInit(), while e.g. vkelInstanceInit(),
+// vkelDeviceInit() and vkelRegisterDevice() can be called during vkelProbePhysicalDevicesAsync()
+// (but not vkelInit()). Both arrays must stay valid until the task has completed. Returns
+// VK_FALSE if out of memory.
+extern VKEL_API VkBool32 vkelProbePhysicalDevices(uint32_t physicalDeviceCount, const VkPhysicalDevice *pPhysicalDevices, VkelPhysicalDeviceProbe *pProbes);
+extern VKEL_API VkelTask vkelProbePhysicalDevicesAsync(uint32_t physicalDeviceCount, const VkPhysicalDevice *pPhysicalDevices, VkelPhysicalDeviceProbe *pProbes);
+
+
+''')
+	
+	
+	lines = []
+	
+	lines.append("// Device level functions, loaded from a specific VkDevice")
+	lines.append("typedef struct VkelDeviceTable {")
+	
+	add_table_members(lines, device_funcs)
+	
+	lines.append("} VkelDeviceTable;")
+	lines.append("")
+	lines.append("")
+	
+	f.write("\n".join(lines).encode("utf-8"))
+	
+	
+	f.write(br'''#ifndef VKEL_MAX_DEVICES
+#	define VKEL_MAX_DEVICES 64
+#endif
+
+typedef struct VkelDevice {
+	VkPhysicalDevice physicalDevice;
+	VkDevice device;
+	
+	VkelCapabilities capabilities;
+	VkelDeviceTable table;
+} VkelDevice;
+
+// Register any number (up to VKEL_MAX_DEVICES) of devices, each with their own
+// table and capabilities. Registering the same device again returns the existing
+// entry. Returns NULL if the registry is full or out of memory.
+extern VKEL_API const VkelDevice* vkelRegisterDevice(VkPhysicalDevice physicalDevice, VkDevice device);
+// Must be called before vkDestroyDevice(), when the device is no longer being used
+extern VKEL_API void vkelUnregisterDevice(VkDevice device);
+
+// The device of the last vkelDeviceInit(). Its table is built off to the side and published
+// with a single atomic store (as vkelTable.pDeviceTable), so a thread gets either the whole old
+// or the whole new table. NULL before vkelDeviceInit().
+extern VKEL_API const VkelDevice* vkelGetCurrentDevice(void);
+
+// Devices replaced by the inits or removed by vkelUnregisterDevice() are retired, and only freed
+// once every online thread has passed a quiescent point. Threads that call the device level vk*
+// macros while another thread calls vkelDeviceInit(), or that keep VkelDevice or table pointers
+// across calls, come online by calling vkelQuiescent() where they hold none (e.g. once per frame),
+// and go offline with vkelThreadOffline() before exiting. Neither ever waits.
+// vkelQuiescent() returns VK_FALSE when VKEL_MAX_THREADS threads are already online. Until a
+// thread has come online, and once one couldn't, retired ones are kept until vkelUninit().
+#ifndef VKEL_MAX_THREADS
+#	define VKEL_MAX_THREADS 64
+#endif
+
+extern VKEL_API VkBool32 vkelQuiescent(void);
+extern VKEL_API void vkelThreadOffline(void);
+
+// Dispatchable handles (VkDevice, VkQueue and VkCommandBuffer) start with the
+// loader's dispatch pointer, which is shared by a device and all its queues and
+// command buffers. Devices are registered by that key, so any of the handles
+// can be used to find the device.
+#define vkelGetDispatchKey(dispatchableHandle) (*(void* const*) (dispatchableHandle))
+
+// Lock-free, returns NULL if the device isn't registered
+extern VKEL_API const VkelDevice* vkelGetDevice(VkDevice device);
+extern VKEL_API const VkelDevice* vkelGetDispatchableDevice(const void *dispatchableHandle);
+
+
+#ifndef VKEL_INLINE
+#	if defined(_MSC_VER) && !defined(__cplusplus)
+#		define VKEL_INLINE static __inline
+#	else
+#		define VKEL_INLINE static inline
+#	endif
+#endif
+
+#ifndef VKEL_THREAD_LOCAL
+#	if defined(_MSC_VER)
+#		define VKEL_THREAD_LOCAL __declspec(thread)
+#	else
+#		define VKEL_THREAD_LOCAL __thread
+#	endif
+#endif
+
+
+// The registry is an open addressing hash table, visible so the lookups below can find a
+// device in the slot its key hashes to (where it is, unless another key took it first)
+// without a call
+#define VKEL_DEVICE_SLOT_COUNT (VKEL_MAX_DEVICES * 2)
+
+typedef struct VkelDeviceSlot {
+	// NULL when the slot was never used, or a key marking it removed
+	void* volatile key;
+	void* volatile entry;
+} VkelDeviceSlot;
+
+extern VKEL_API VkelDeviceSlot vkelDeviceSlots[VKEL_DEVICE_SLOT_COUNT];
+
+VKEL_INLINE uint32_t vkelHashDeviceKey(const void *key)
+{
+	uint64_t hash = (uint64_t) (uintptr_t) key;
+	
+	hash ^= hash >> 33;
+	hash *= 0xFF51AFD7ED558CCDull;
+	hash ^= hash >> 33;
+	
+	return (uint32_t) hash & (VKEL_DEVICE_SLOT_COUNT - 1);
+}
+
+// Same as vkelGetDispatchableDevice(), which it only calls when the device isn't in its slot
+VKEL_INLINE const VkelDevice* vkelFindDispatchableDevice(const void *dispatchableHandle)
+{
+	void *key = vkelGetDispatchKey(dispatchableHandle);
+	const VkelDeviceSlot *slot = &vkelDeviceSlots[vkelHashDeviceKey(key)];
+	const VkelDevice *entry = NULL;
+	
+	// The entry is published before the key, and cleared after it
+#if defined(__GNUC__) || defined(__clang__)
+	if (__atomic_load_n(&slot->key, __ATOMIC_ACQUIRE) == key)
+		entry = (const VkelDevice*) __atomic_load_n(&slot->entry, __ATOMIC_ACQUIRE);
+#else
+	if (slot->key == key)
+		entry = (const VkelDevice*) slot->entry;
+#endif
+	
+	return entry ? entry : vkelGetDispatchableDevice(dispatchableHandle);
+}
+
+
+''')
+	
+	
+	f.write(br'''// A table of all the functions, which can be shared with plugins (or other shared objects)
+// embedding vkel, so the process only initializes once. The version only changes when
+// existing members change, new members are appended and found using the size.
+#define VKEL_TABLE_VERSION 1
+
+''')
+	
+	
+	lines = []
+	
+	lines.append("typedef struct VkelTable {")
+	lines.append("\tuint32_t version;")
+	lines.append("\tuint32_t size;")
+	lines.append("\t")
+	lines.append("\t// The capabilities are shared as bits indexed by the IDs, as the number of IDs can differ")
+	lines.append("\tuint32_t extensionIdCount;")
+	lines.append("\tuint32_t layerIdCount;")
+	lines.append("\t")
+	lines.append("\tconst uint32_t *pInstanceExtensions;")
+	lines.append("\tconst uint32_t *pInstanceLayers;")
+	lines.append("\tconst uint32_t *pDeviceExtensions;")
+	lines.append("\tconst uint32_t *pDeviceLayers;")
+	lines.append("\t")
+	
+	add_table_members(lines, table_funcs)
+	
+	lines.append("\t")
+	lines.append("\t// The device level functions the vk* macros call through, which the inits only ever replace")
+	lines.append("\t// as a whole. The device level members above keep what vkelInit()/vkelInstanceInit() loaded.")
+	lines.append("\tconst VkelDeviceTable *pDeviceTable;")
+	lines.append("} VkelTable;")
+	lines.append("")
+	lines.append("// All the functions are stored in a single table, so a shared vkel only exports a single")
+	lines.append("// symbol (and needs a single relocation) for all of them, instead of one per function")
+	lines.append("extern VKEL_API VkelTable vkelTable;")
+	lines.append("")
+	lines.append("// Read once per call, so a thread that called a function of a new table (like after")
+	lines.append("// vkelDeviceInit() recreated a lost device) never calls one of the old table again")
+	lines.append("VKEL_INLINE const VkelDeviceTable* vkelGetDeviceTable(void)")
+	lines.append("{")
+	lines.append("#if defined(__GNUC__) || defined(__clang__)")
+	lines.append("\treturn __atomic_load_n(&vkelTable.pDeviceTable, __ATOMIC_ACQUIRE);")
+	lines.append("#else")
+	lines.append("\treturn *(const VkelDeviceTable* const volatile*) &vkelTable.pDeviceTable;")
+	lines.append("#endif")
+	lines.append("}")
+	lines.append("")
+	lines.append("")
+	lines.append("// The table of the registered device the handle belongs to, or the one vkelDeviceInit()")
+	lines.append("// loaded when the device isn't registered")
+	lines.append("VKEL_INLINE const VkelDeviceTable* vkelGetDispatchableTable(const void *dispatchableHandle)")
+	lines.append("{")
+	lines.append("\tconst VkelDevice *entry = vkelFindDispatchableDevice(dispatchableHandle);")
+	lines.append("\t")
+	lines.append("\treturn entry ? &entry->table : vkelGetDeviceTable();")
+	lines.append("}")
+	lines.append("")
+	lines.append("// Device level functions, dispatched to the table of the registered device the")
+	lines.append("// handle belongs to, e.g. vkelCmdDraw(commandBuffer, 3, 1, 0, 0)")
+	
+	for func in device_funcs:
+		platform = func_platforms[func]
+		return_type, params = command_info[func]
+		
 		if platform:
 			lines.append("#ifdef " + platform)
 		
-		for func in sorted(platform_funcs[platform]):
-			# lines.append("PFN_{0} {0};".format(func))
-			# lines.append("PFN_{0} __{0};".format(func))
-			lines.append("extern PFN_{0} __{0};".format(func))
+		lines.append("VKEL_INLINE {0} vkel{1}({2})".format(return_type, func[2:], ", ".join("{0} {1}{2}".format(*param) for param in params)))
+		lines.append("{")
+		
+		if func == "vkDestroyDevice":
+			# The device goes away along with its key, so it's unregistered (and retired) first
+			lines.append("\tPFN_vkDestroyDevice destroyDevice;")
+			lines.append("\t")
+			lines.append("\tif (!device)")
+			lines.append("\t\treturn;")
+			lines.append("\t")
+			lines.append("\tdestroyDevice = vkelGetDispatchableTable(device)->DestroyDevice;")
+			lines.append("\t")
+			lines.append("\tvkelUnregisterDevice(device);")
+			lines.append("\tdestroyDevice(device, pAllocator);")
+		else:
+			lines.append("\t{0}vkelGetDispatchableTable({1})->{2}({3});".format("" if return_type == "void" else "return ", params[0][1], func[2:], ", ".join(param[1] for param in params)))
 		
+		lines.append("}")
 		
 		if platform:
 			lines.append("#endif /* " + platform + " */")
+	
+	lines.append("")
+	lines.append("")
+	
+	f.write("\n".join(lines).encode("utf-8"))
+	
+	
+	f.write(br'''typedef const VkelTable* (*PFN_vkelGetSharedTable)(void);
+
+// Returns NULL until vkel has been initialized
+extern VKEL_API const VkelTable* vkelGetTable(void);
+
+// Building vkel.c with VKEL_FALLBACK_STUBS fills the functions that couldn't be loaded with
+// stubs instead of NULL, so optional commands can be called without checking them first. The
+// void ones do nothing, while the rest return VK_ERROR_EXTENSION_NOT_PRESENT (or 0). Use
+// vkelHasFunction(CmdDebugMarkerBeginEXT) to check whether a function was actually loaded.
+extern VKEL_API VkBool32 vkelIsFunctionLoaded(size_t tableOffset);
+#define vkelHasFunction(name) vkelIsFunctionLoaded(offsetof(VkelTable, name))
+
+// Use the functions and capabilities of a table from another copy of vkel, instead of
+// loading the library. The table is used as is, so the other copy must stay initialized.
+extern VKEL_API VkBool32 vkelInitFromTable(const VkelTable *pTable);
+
+// Use the table exported by the application (see VKEL_EXPORT_TABLE) if there is one,
+// otherwise it's the same as vkelInit()
+extern VKEL_API VkBool32 vkelInitShared(void);
+
+
+// Additional Vulkan implementations loaded side by side with the one behind the vk* macros,
+// like a CPU implementation (e.g. lavapipe or SwiftShader) next to the hardware driver. Each
+// context has its own library, table and capabilities, and never touches vkelTable.
+VK_DEFINE_HANDLE(VkelContext)
+
+// pPath is an ICD manifest (.json), an ICD library or a Vulkan loader library. The table
+// only has the global functions (like vkCreateInstance) until vkelContextInstanceInit().
+// Returns NULL if the library couldn't be loaded.
+extern VKEL_API VkelContext vkelCreateContext(const char *pPath);
+// Only the context's own instances and devices must be used with it
+extern VKEL_API VkBool32 vkelContextInstanceInit(VkelContext context, VkInstance instance);
+extern VKEL_API VkBool32 vkelContextDeviceInit(VkelContext context, VkPhysicalDevice physicalDevice, VkDevice device);
+// Must be called after everything created with the context is destroyed
+extern VKEL_API void vkelDestroyContext(VkelContext context);
+
+// Valid until the context is destroyed, and updated in place by the inits
+extern VKEL_API const VkelTable* vkelGetContextTable(VkelContext context);
+extern VKEL_API const VkelCapabilities* vkelGetContextInstanceCapabilities(VkelContext context);
+extern VKEL_API const VkelCapabilities* vkelGetContextDeviceCapabilities(VkelContext context);
+
+// Defining VKEL_EXPORT_TABLE when building the application's vkel.c exports vkelGetSharedTable(),
+// which is what vkelInitShared() looks for. On Linux the application must be linked using -rdynamic.
+#ifdef VKEL_EXPORT_TABLE
+#	if defined(_WIN32)
+#		define VKEL_EXPORT __declspec(dllexport)
+#	else
+#		define VKEL_EXPORT __attribute__((visibility("default")))
+#	endif
+
+extern VKEL_EXPORT const VkelTable* vkelGetSharedTable(void);
+#endif /* VKEL_EXPORT_TABLE */
+
+
+''')
+	
+	
+	lines = []
+	
+	f.write(br'''// Defining VKEL_THREAD_DEVICE (when building vkel.c and everywhere vkel.h is included) makes
+// the vk* macros of device level functions call through a table bound to the calling thread,
+// instead of vkelTable.pDeviceTable. See vkelBindDevice().
+#ifdef VKEL_THREAD_DEVICE
+#	if defined(_WIN32) && defined(VKEL_SHARED)
+#		error VKEL_THREAD_DEVICE needs vkel to be built into the application on Windows, as thread-local variables cannot be imported
+#	endif
+
+// NULL for threads that haven't bound a device, which use vkelTable.pDeviceTable
+extern VKEL_THREAD_LOCAL VKEL_API const VkelDeviceTable *vkelThreadDeviceTable;
+
+// Bind the table of a registered device (see vkelRegisterDevice()) to the calling thread,
+// so the vk* macros of device level functions call that device's driver directly. Binding
+// VK_NULL_HANDLE goes back to the functions loaded by vkelDeviceInit(). Bound threads should
+// be online (see vkelQuiescent()), as a device that was unregistered goes back to those at the
+// next quiescent point. Returns VK_FALSE (and keeps the binding) if the device isn't registered.
+extern VKEL_API VkBool32 vkelBindDevice(VkDevice device);
+
+#	define VKEL_DEVICE_FUNCTION(name) ((vkelThreadDeviceTable ? vkelThreadDeviceTable : vkelGetDeviceTable())->name)
+#else
+#	define VKEL_DEVICE_FUNCTION(name) (vkelGetDeviceTable()->name)
+#endif /* VKEL_THREAD_DEVICE */
+
+
+''')
+	
+	
+	def get_function_macro(func):
+		if func in device_funcs:
+			return "#define {0} VKEL_DEVICE_FUNCTION({1})".format(func, func[2:])
 		
-		lines.append("")
+		return "#define {0} (vkelTable.{1})".format(func, func[2:])
+	
+	
+	# The macros are left out when defining VKEL_NO_FUNCTION_MACROS, for code that defines
+	# its own vk* symbols (like vkel_layer.c)
+	lines.append("// Functions")
+	lines.append("")
+	lines.append("#ifndef VKEL_NO_FUNCTION_MACROS")
+	lines.append("")
 	
 	# Generate NULL pointers for platform specific functions
 	for platform in sorted(platform_funcs):
@@ -486,7 +1165,7 @@ extern void vkelUninit(void);
 			lines.append("")
 		else:
 			for func in sorted(platform_funcs[platform]):
-				lines.append("#define {0} __{0}".format(func))
+				lines.append(get_function_macro(func))
 	
 	# Generate platform specific functions
 	for platform in sorted(platform_funcs):
@@ -497,11 +1176,12 @@ extern void vkelUninit(void);
 				lines.append("#undef {0}".format(func))
 			
 			for func in sorted(platform_funcs[platform]):
-				lines.append("#define {0} __{0}".format(func))
+				lines.append(get_function_macro(func))
 			
 			lines.append("#endif /* " + platform + " */")
 			lines.append("")
 	
+	lines.append("#endif /* VKEL_NO_FUNCTION_MACROS */")
 	lines.append("")
 	
 	f.write("\n".join(lines).encode("utf-8"))
@@ -522,7 +1202,12 @@ with open("vkel.c", "wb") as f:
 	add_copyright(f)
 	
 	
-	f.write(br'''#include "vkel.h"
+	f.write(br'''// For clock_gettime() and posix_fadvise()
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#	define _POSIX_C_SOURCE 200112L
+#endif
+
+#include "vkel.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -532,6 +1217,8 @@ extern "C" {
 #include <stdio.h> /* NULL, printf() */
 #include <stdlib.h> /* malloc(), calloc(), free() */
 #include <string.h> /* memset() */
+#include <stddef.h> /* offsetof() */
+#include <stdint.h> /* SIZE_MAX */
 #include <assert.h> /* assert() */
 
 
@@ -554,6 +1241,13 @@ extern "C" {
 #else
 
 #include <dlfcn.h>
+#include <dirent.h>
+#include <pthread.h>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
 
 #endif
 
@@ -562,626 +1256,5337 @@ extern "C" {
 #	define vkelPlatformOpenLibrary(name) LoadLibraryA(name)
 #	define vkelPlatformCloseLibrary(handle) FreeLibrary((HMODULE) handle)
 #	define vkelPlatformGetProcAddr(handle, name) GetProcAddress((HMODULE) handle, name)
+#	define VKEL_PLATFORM_LIBRARY_NAME "vulkan-1.dll"
 // #elif defined(__APPLE__) || defined(__linux__) || defined(__ANDROID__) || defined(__unix__ )
 #else
 #define vkelPlatformOpenLibrary(name) dlopen(name, RTLD_LAZY | RTLD_LOCAL)
 #define vkelPlatformCloseLibrary(handle) dlclose(handle)
 #define vkelPlatformGetProcAddr(handle, name) dlsym(handle, name)
+#define VKEL_PLATFORM_LIBRARY_NAME "libvulkan.so.1"
 // #else
 // #	error VKEL Unsupported Platform
 #endif
 
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+#	define VkelPlatformMutex SRWLOCK
+#	define VKEL_PLATFORM_MUTEX_INITIALIZER SRWLOCK_INIT
+#	define vkelPlatformLockMutex(mutex) AcquireSRWLockExclusive(mutex)
+#	define vkelPlatformTryLockMutex(mutex) TryAcquireSRWLockExclusive(mutex)
+#	define vkelPlatformUnlockMutex(mutex) ReleaseSRWLockExclusive(mutex)
+#else
+#	define VkelPlatformMutex pthread_mutex_t
+#	define VKEL_PLATFORM_MUTEX_INITIALIZER PTHREAD_MUTEX_INITIALIZER
+#	define vkelPlatformLockMutex(mutex) pthread_mutex_lock(mutex)
+#	define vkelPlatformTryLockMutex(mutex) (pthread_mutex_trylock(mutex) == 0)
+#	define vkelPlatformUnlockMutex(mutex) pthread_mutex_unlock(mutex)
+#endif
+
+
+static void* vkelAtomicLoadPointer(void* volatile *pPointer)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return __atomic_load_n(pPointer, __ATOMIC_ACQUIRE);
+#elif defined(_MSC_VER)
+	void *pointer = *pPointer;
+	MemoryBarrier();
+	return pointer;
+#else
+#	error vkel needs atomic loads and stores for this compiler
+#endif
+}
+
+static void vkelAtomicStorePointer(void* volatile *pPointer, void *pointer)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	__atomic_store_n(pPointer, pointer, __ATOMIC_RELEASE);
+#elif defined(_MSC_VER)
+	MemoryBarrier();
+	*pPointer = pointer;
+#else
+#	error vkel needs atomic loads and stores for this compiler
+#endif
+}
+
+// Functions of vkelTable that other threads may be calling are replaced with a store
+// per function, so a concurrent call gets either the old or the new function, but never
+// a torn pointer. The device level functions are instead swapped as a whole.
+#if defined(__GNUC__) || defined(__clang__)
+#	define vkelAtomicStoreProc(proc, value) __atomic_store_n(&(proc), (value), __ATOMIC_RELAXED)
+#else
+#	define vkelAtomicStoreProc(proc, value) ((proc) = (value))
+#endif
+
 static void *vkelVkLibHandle;
 
+// Set when vkelInitDirectICD() loaded an ICD instead of the Vulkan loader
+static PFN_vkGetInstanceProcAddr vkelIcdGetInstanceProcAddr;
+
+static VkAllocationCallbacks vkelAllocationCallbacks;
+static const VkAllocationCallbacks *vkelAllocator;
+
 
 ''')
 	
 	
-	f.write(b"// Instance and device extension names\n")
-	
-	# Are there any (instance or device) extensions? (is array empty)
-	if extension_names:
-		for extension_name in sorted(extension_names):
-			if extension_name:
-				f.write("VkBool32 VKEL_{0};\n".format(extension_name).encode("utf-8"))
+	lines = []
 	
-	f.write(b"\n")
+	# Name tables are indexed by ID, and the sorted tables
+	# are used for binary searching a name's ID
+	lines.append("static const char* const vkelExtensionNames[] = {")
 	
+	for extension_name in extension_ids:
+		lines.append("\t\"VK_{0}\",".format(extension_name))
 	
-	f.write(b"// Instance and device layer names\n")
+	lines.append("\tNULL")
+	lines.append("};")
+	lines.append("")
 	
-	# Are there any (instance or device) layers? (is array empty)
-	if layer_names:
-		for layer_name in sorted(layer_names):
-			if layer_name:
-				f.write("VkBool32 VKEL_{0};\n".format(layer_name).encode("utf-8"))
+	lines.append("static const uint32_t vkelExtensionIdsByName[] = {")
 	
-	f.write(b"\n\n")
+	for extension_name in sorted(extension_ids):
+		lines.append("\tVKEL_EXT_ID_{0},".format(extension_name))
 	
+	lines.append("\tVKEL_EXT_ID_COUNT")
+	lines.append("};")
+	lines.append("")
 	
-	lines = []
+	lines.append("")
 	
-	lines.append("// Functions")
+	lines.append("static const char* const vkelLayerNames[] = {")
 	
-	# Generate all function pointers
-	for platform in sorted(platform_funcs):
-		if platform:
-			lines.append("#ifdef " + platform)
-		
-		for func in sorted(platform_funcs[platform]):
-			# lines.append("PFN_{0} {0};".format(func))
-			lines.append("PFN_{0} __{0};".format(func))
-		
-		
-		if platform:
-			lines.append("#endif /* " + platform + " */")
-		
-		lines.append("")
+	for layer_name in layer_ids:
+		lines.append("\t\"VK_{0}\",".format(layer_name))
 	
+	lines.append("\tNULL")
+	lines.append("};")
 	lines.append("")
 	
-	f.write("\n".join(lines).encode("utf-8"))
+	lines.append("static const uint32_t vkelLayerIdsByName[] = {")
 	
+	for layer_name in sorted(layer_ids):
+		lines.append("\tVKEL_LAYER_ID_{0},".format(get_layer_id_name(layer_name)))
 	
+	lines.append("\tVKEL_LAYER_ID_COUNT")
+	lines.append("};")
+	lines.append("")
 	
-	f.write(br'''
-PFN_vkVoidFunction vkelGetProcAddr(const char *name)
-{
-	return (PFN_vkVoidFunction) vkelPlatformGetProcAddr(vkelVkLibHandle, name);
-}
-
-PFN_vkVoidFunction vkelGetInstanceProcAddr(VkInstance instance, const char *pName)
+	lines.append("")
+	
+	lines.append("static VkelCapabilities vkelInstanceCapabilities;")
+	lines.append("")
+	lines.append("")
+	lines.append("// What the device level vk* macros call until initialized")
+	lines.append("static VkelDeviceTable vkelNullDeviceTable;")
+	lines.append("")
+	lines.append("// Functions, along with what's needed to share them (see vkelGetTable())")
+	lines.append("VkelTable vkelTable = {")
+	lines.append("\t0, 0, 0, 0,")
+	lines.append("\tNULL, NULL, NULL, NULL,")
+	lines.append("\t")
+	
+	for func_index in range(0, len(table_funcs), 16):
+		lines.append("\t" + " ".join(["NULL,"] * len(table_funcs[func_index:func_index + 16])))
+	
+	lines.append("\t")
+	lines.append("\t&vkelNullDeviceTable")
+	lines.append("};")
+	lines.append("")
+	lines.append("// The entry vkelTable.pDeviceTable belongs to, whose device is VK_NULL_HANDLE")
+	lines.append("// when the functions are the ones loaded by vkelInit()/vkelInstanceInit()")
+	lines.append("static void* volatile vkelCurrentDevice;")
+	lines.append("")
+	lines.append("")
+	
+	f.write("\n".join(lines).encode("utf-8"))
+	
+	
+	# Fallback stubs
+	
+	f.write(br'''
+#ifdef VKEL_FALLBACK_STUBS
+
+typedef struct VkelStub
+{
+	size_t offset;
+	PFN_vkVoidFunction stub;
+} VkelStub;
+
+''')
+	
+	
+	lines = []
+	
+	# Same signature as the command, so they're also safe with callee cleanup (like stdcall)
+	for func in table_funcs:
+		platform = func_platforms[func]
+		return_type, params = command_info[func]
+		
+		if platform:
+			lines.append("#ifdef " + platform)
+		
+		lines.append("static VKAPI_ATTR {0} VKAPI_CALL vkelStub{1}({2})".format(return_type, func[2:], ", ".join("{0} {1}{2}".format(*param) for param in params)))
+		lines.append("{")
+		
+		if params:
+			lines.append("	" + " ".join("(void) {0};".format(param[1]) for param in params))
+		
+		if return_type == "VkResult":
+			lines.append("	return VK_ERROR_EXTENSION_NOT_PRESENT;")
+		elif return_type != "void":
+			lines.append("	return ({0}) 0;".format(return_type))
+		
+		lines.append("}")
+		
+		if platform:
+			lines.append("#endif /* " + platform + " */")
+		
+		lines.append("")
+	
+	lines.append("")
+	
+	for table_type, stub_funcs, array_name in (("VkelTable", table_funcs, "vkelStubs"), ("VkelDeviceTable", [func for func in table_funcs if func in device_funcs], "vkelDeviceStubs")):
+		lines.append("// Sorted by offset")
+		lines.append("static const VkelStub {0}[] = {{".format(array_name))
+		
+		for func in stub_funcs:
+			platform = func_platforms[func]
+			
+			if platform:
+				lines.append("#ifdef " + platform)
+			
+			lines.append("	{{ offsetof({0}, {1}), (PFN_vkVoidFunction) vkelStub{1} }},".format(table_type, func[2:]))
+			
+			if platform:
+				lines.append("#endif /* " + platform + " */")
+		
+		lines.append("};")
+		lines.append("")
+	
+	lines.append("")
+	
+	f.write("\n".join(lines).encode("utf-8"))
+	
+	
+	f.write(br'''static PFN_vkVoidFunction* vkelGetTableSlot(void *pTable, size_t offset)
+{
+	return (PFN_vkVoidFunction*) ((char*) pTable + offset);
+}
+
+static void vkelFillStubs(void *pTable, const VkelStub *pStubs, size_t stubCount)
+{
+	size_t i;
+	
+	// Only ever replaces NULL, which no other thread can be calling
+	for (i = 0; i < stubCount; ++i)
+		if (!*vkelGetTableSlot(pTable, pStubs[i].offset))
+			vkelAtomicStoreProc(*vkelGetTableSlot(pTable, pStubs[i].offset), pStubs[i].stub);
+}
+
+static const VkelStub* vkelFindStub(size_t offset)
+{
+	size_t first = 0;
+	size_t last = sizeof(vkelStubs) / sizeof(vkelStubs[0]);
+	
+	while (first < last)
+	{
+		size_t middle = first + (last - first) / 2;
+		
+		if (vkelStubs[middle].offset < offset)
+			first = middle + 1;
+		else
+			last = middle;
+	}
+	
+	return ((first < (sizeof(vkelStubs) / sizeof(vkelStubs[0]))) && (vkelStubs[first].offset == offset)) ? &vkelStubs[first] : NULL;
+}
+
+#	define vkelIsStub(pTable, name) ((pTable)->name == vkelStub##name)
+#else
+#	define vkelIsStub(pTable, name) 0
+#endif /* VKEL_FALLBACK_STUBS */
+
+''')
+	
+	
+	lines = []
+	
+	lines.append("typedef struct VkelDeviceMember")
+	lines.append("{")
+	lines.append("\tsize_t tableOffset;")
+	lines.append("\tsize_t deviceTableOffset;")
+	lines.append("} VkelDeviceMember;")
+	lines.append("")
+	lines.append("// Sorted by the offset in VkelTable")
+	lines.append("static const VkelDeviceMember vkelDeviceMembers[] = {")
+	
+	for func in table_funcs:
+		if func in device_funcs:
+			lines.append("\t{{ offsetof(VkelTable, {0}), offsetof(VkelDeviceTable, {0}) }},".format(func[2:]))
+	
+	lines.append("};")
+	lines.append("")
+	
+	f.write("\n".join(lines).encode("utf-8"))
+	
+	
+	f.write(br'''
+static const VkelDeviceMember* vkelFindDeviceMember(size_t tableOffset)
+{
+	size_t first = 0;
+	size_t last = sizeof(vkelDeviceMembers) / sizeof(vkelDeviceMembers[0]);
+	
+	while (first < last)
+	{
+		size_t middle = first + (last - first) / 2;
+		
+		if (vkelDeviceMembers[middle].tableOffset < tableOffset)
+			first = middle + 1;
+		else
+			last = middle;
+	}
+	
+	return ((first < (sizeof(vkelDeviceMembers) / sizeof(vkelDeviceMembers[0]))) && (vkelDeviceMembers[first].tableOffset == tableOffset)) ? &vkelDeviceMembers[first] : NULL;
+}
+
+
+VkBool32 vkelIsFunctionLoaded(size_t tableOffset)
+{
+	assert(tableOffset < sizeof(VkelTable));
+	
+	// The device level functions are the ones the vk* macros call
+	const VkelDeviceMember *pMember = vkelFindDeviceMember(tableOffset);
+	
+	const void *pFunction = pMember ? ((const char*) vkelGetDeviceTable() + pMember->deviceTableOffset) : ((const char*) &vkelTable + tableOffset);
+	
+	PFN_vkVoidFunction function = (PFN_vkVoidFunction) vkelAtomicLoadPointer((void* volatile*) pFunction);
+	
+#ifdef VKEL_FALLBACK_STUBS
+	const VkelStub *pStub = vkelFindStub(tableOffset);
+	
+	if (pStub && (function == pStub->stub))
+		return VK_FALSE;
+#endif
+	
+	return function ? VK_TRUE : VK_FALSE;
+}
+
+''')
+	
+	
+	# Usage recording
+	
+	recorded_funcs = [func for func in all_funcs if func in command_info]
+	
+	f.write(br'''
+#ifdef VKEL_RECORD_USAGE
+
+static volatile uint8_t vkelCommandUsage[VKEL_COMMAND_COUNT];
+static volatile uint8_t vkelExtensionUsage[VKEL_EXT_ID_COUNT + 1];
+static volatile uint8_t vkelLayerUsage[VKEL_LAYER_ID_COUNT + 1];
+
+
+static void vkelRecordUsage(volatile uint8_t *pUsage)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	// Only written once, so hot functions don't keep bouncing the cache line between threads
+	if (!__atomic_load_n(pUsage, __ATOMIC_RELAXED))
+		__atomic_store_n(pUsage, 1, __ATOMIC_RELAXED);
+#else
+	if (!*pUsage)
+		*pUsage = 1;
+#endif
+}
+
+'''.replace(b"VKEL_COMMAND_COUNT", str(len(recorded_funcs)).encode("utf-8")))
+	
+	
+	lines = []
+	
+	lines.append("static const char* const vkelCommandNames[] = {")
+	
+	for func in recorded_funcs:
+		lines.append("\t\"{0}\",".format(func))
+	
+	lines.append("};")
+	lines.append("")
+	lines.append("// The entry whose recording functions the device level vk* macros call, the one bound to")
+	lines.append("// the thread (see vkelBindDevice()) or else the published one")
+	lines.append("static const VkelDevice* vkelGetRecordedDevice(void)")
+	lines.append("{")
+	lines.append("#ifdef VKEL_THREAD_DEVICE")
+	lines.append("\t// Which is followed by the table of recording functions, see vkelCreateDeviceEntry()")
+	lines.append("\tif (vkelThreadDeviceTable)")
+	lines.append("\t\treturn (const VkelDevice*) (const void*) vkelThreadDeviceTable - 1;")
+	lines.append("#endif")
+	lines.append("\t")
+	lines.append("\treturn (const VkelDevice*) vkelAtomicLoadPointer(&vkelCurrentDevice);")
+	lines.append("}")
+	lines.append("")
+	lines.append("")
+	
+	# Each function pointer is swapped with one that records the call before calling the original. The
+	# device level ones are in a table kept along with the original one, so they call through that.
+	for command_index, func in enumerate(recorded_funcs):
+		platform = func_platforms[func]
+		return_type, params = command_info[func]
+		
+		if platform:
+			lines.append("#ifdef " + platform)
+		
+		if func in device_funcs:
+			original = "vkelGetRecordedDevice()->table." + func[2:]
+		else:
+			lines.append("static PFN_{0} vkelRecorded{1};".format(func, func[2:]))
+			original = "vkelRecorded" + func[2:]
+		
+		lines.append("static VKAPI_ATTR {0} VKAPI_CALL vkelRecord{1}({2})".format(return_type, func[2:], ", ".join("{0} {1}{2}".format(*param) for param in params)))
+		lines.append("{")
+		lines.append("\tvkelRecordUsage(&vkelCommandUsage[{0}]);".format(command_index))
+		lines.append("\t{0}{1}({2});".format("" if return_type == "void" else "return ", original, ", ".join(param[1] for param in params)))
+		lines.append("}")
+		
+		if platform:
+			lines.append("#endif /* " + platform + " */")
+		
+		lines.append("")
+	
+	lines.append("")
+	
+	f.write("\n".join(lines).encode("utf-8"))
+	
+	
+	f.write(br'''
+VkBool32 vkelWriteUsageProfile(const char *pPath)
+{
+	FILE *file = fopen(pPath, "w");
+	
+	if (!file)
+		return VK_FALSE;
+	
+	
+	uint32_t commandIndex = 0;
+	for (commandIndex = 0; commandIndex < (sizeof(vkelCommandNames) / sizeof(vkelCommandNames[0])); commandIndex++)
+		if (vkelCommandUsage[commandIndex])
+			fprintf(file, "%s\n", vkelCommandNames[commandIndex]);
+	
+	uint32_t extensionId = 0;
+	for (extensionId = 0; extensionId < VKEL_EXT_ID_COUNT; extensionId++)
+		if (vkelExtensionUsage[extensionId])
+			fprintf(file, "%s\n", vkelExtensionNames[extensionId]);
+	
+	uint32_t layerId = 0;
+	for (layerId = 0; layerId < VKEL_LAYER_ID_COUNT; layerId++)
+		if (vkelLayerUsage[layerId])
+			fprintf(file, "%s\n", vkelLayerNames[layerId]);
+	
+	
+	return (fclose(file) == 0) ? VK_TRUE : VK_FALSE;
+}
+
+
+static void vkelWriteUsageProfileAtExit(void)
+{
+	const char *pPath = getenv("VKEL_USAGE_PROFILE");
+	
+	if (pPath && *pPath)
+		vkelWriteUsageProfile(pPath);
+}
+
+''')
+	
+	
+	lines = []
+	
+	lines.append("static void vkelRecordUsageProcs(void)")
+	lines.append("{")
+	lines.append("\tstatic VkBool32 registeredAtExit = VK_FALSE;")
+	lines.append("\t")
+	lines.append("\tif (!registeredAtExit && getenv(\"VKEL_USAGE_PROFILE\"))")
+	lines.append("\t\tregisteredAtExit = (atexit(vkelWriteUsageProfileAtExit) == 0) ? VK_TRUE : VK_FALSE;")
+	lines.append("\t")
+	lines.append("\t")
+	
+	for func in recorded_funcs:
+		if func in device_funcs:
+			continue
+		
+		platform = func_platforms[func]
+		
+		if platform:
+			lines.append("#ifdef " + platform)
+		
+		lines.append("\tif (vkelTable.{1} && (vkelTable.{1} != vkelRecord{1}) && !vkelIsStub(&vkelTable, {1}))".format(func, func[2:]))
+		lines.append("\t{")
+		lines.append("\t\tvkelRecorded{1} = vkelTable.{1};".format(func, func[2:]))
+		lines.append("\t\tvkelTable.{1} = vkelRecord{1};".format(func, func[2:]))
+		lines.append("\t}")
+		
+		if platform:
+			lines.append("#endif /* " + platform + " */")
+	
+	lines.append("}")
+	lines.append("")
+	lines.append("// Fills the table the device level vk* macros call through, kept along with pTable")
+	lines.append("static void vkelRecordDeviceUsageProcs(const VkelDeviceTable *pTable, VkelDeviceTable *pRecordTable)")
+	lines.append("{")
+	lines.append("\t*pRecordTable = *pTable;")
+	lines.append("\t")
+	
+	for func in recorded_funcs:
+		if func not in device_funcs:
+			continue
+		
+		platform = func_platforms[func]
+		
+		if platform:
+			lines.append("#ifdef " + platform)
+		
+		lines.append("\tif (pTable->{0} && !vkelIsStub(pTable, {0}))".format(func[2:]))
+		lines.append("\t\tpRecordTable->{0} = vkelRecord{0};".format(func[2:]))
+		
+		if platform:
+			lines.append("#endif /* " + platform + " */")
+	
+	lines.append("}")
+	lines.append("")
+	lines.append("#endif /* VKEL_RECORD_USAGE */")
+	lines.append("")
+	lines.append("")
+	
+	f.write("\n".join(lines).encode("utf-8"))
+	
+	
+	
+	f.write(br'''
+static int vkel_strcmp(const char *str1, const char *str2)
+{
+	while (*str1 && (*str1 == *str2))
+	{
+		str1++, str2++;
+	}
+
+	return *(const unsigned char*) str1 - *(const unsigned char*) str2;
+}
+
+static void vkel_strpy(char *dest, const char *src)
+{
+	while (*dest++ = *src++);
+}
+
+
+PFN_vkVoidFunction vkelGetProcAddr(const char *name)
+{
+	// An ICD only exports vk_icdGetInstanceProcAddr, everything
+	// else (before vkelInstanceInit()) has to go through it
+	if (vkelIcdGetInstanceProcAddr)
+	{
+		if (!vkel_strcmp(name, "vkGetInstanceProcAddr"))
+			return (PFN_vkVoidFunction) vkelIcdGetInstanceProcAddr;
+		
+		return vkelIcdGetInstanceProcAddr(NULL, name);
+	}
+	
+	return (PFN_vkVoidFunction) vkelPlatformGetProcAddr(vkelVkLibHandle, name);
+}
+
+PFN_vkVoidFunction vkelGetInstanceProcAddr(VkInstance instance, const char *pName)
 {
 	PFN_vkVoidFunction proc = (PFN_vkVoidFunction) vkGetInstanceProcAddr(instance, pName);
 	
-	if (!proc)
-		proc = (PFN_vkVoidFunction) vkelGetProcAddr(pName);
+	if (!proc)
+		proc = (PFN_vkVoidFunction) vkelGetProcAddr(pName);
+	
+	return proc;
+}
+
+PFN_vkVoidFunction vkelGetDeviceProcAddr(VkDevice device, const char *pName)
+{
+	PFN_vkVoidFunction proc = (PFN_vkVoidFunction) vkGetDeviceProcAddr(device, pName);
+	
+	if (!proc)
+		proc = (PFN_vkVoidFunction) vkelGetInstanceProcAddr(NULL, pName);
+	
+	return proc;
+}
+
+
+
+#define VKEL_ALLOCATION_ALIGNMENT 16
+
+static void* vkel_malloc(size_t size, VkSystemAllocationScope allocationScope)
+{
+	if (vkelAllocator)
+		return vkelAllocator->pfnAllocation(vkelAllocator->pUserData, size, VKEL_ALLOCATION_ALIGNMENT, allocationScope);
+	
+	return malloc(size);
+}
+
+static void* vkel_calloc(size_t count, size_t size, VkSystemAllocationScope allocationScope)
+{
+	if (!vkelAllocator)
+		return calloc(count, size);
+	
+	// Like calloc(), fail rather than allocate a wrapped around size
+	if (size && count > SIZE_MAX / size)
+		return NULL;
+	
+	void *memory = vkel_malloc(count * size, allocationScope);
+	
+	if (memory)
+		memset(memory, 0, count * size);
+	
+	return memory;
+}
+
+static void vkel_free(void *memory)
+{
+	if (vkelAllocator)
+		vkelAllocator->pfnFree(vkelAllocator->pUserData, memory);
+	else
+		free(memory);
+}
+
+
+void vkelSetAllocator(const VkAllocationCallbacks *pAllocator)
+{
+	if (!pAllocator)
+	{
+		vkelAllocator = NULL;
+		return;
+	}
+	
+	assert(pAllocator->pfnAllocation);
+	assert(pAllocator->pfnFree);
+	
+	// Copy the callbacks, so the caller doesn't have to keep them alive
+	vkelAllocationCallbacks = *pAllocator;
+	vkelAllocator = &vkelAllocationCallbacks;
+}
+
+const VkAllocationCallbacks* vkelGetAllocator(void)
+{
+	return vkelAllocator;
+}
+
+
+void vkelDeleteNames(uint32_t nameCount, char **names)
+{
+	// assert(names);
+	if (!names)
+		return;
+	
+	uint32_t nameIndex = 0;
+	for (nameIndex = 0; nameIndex < nameCount; nameIndex++)
+	{
+		// assert(names[nameIndex]);
+		if (!names[nameIndex])
+			continue;
+
+		vkel_free(names[nameIndex]);
+	}
+
+	vkel_free(names);
+}
+
+
+typedef struct VkelEnumeration
+{
+	struct VkelEnumeration *pNext;
+	
+	// VK_NULL_HANDLE for instance extensions and layers
+	VkPhysicalDevice physicalDevice;
+	// VkLayerProperties instead of VkExtensionProperties
+	VkBool32 layers;
+	// Empty when not enumerating the extensions of a specific layer
+	char layerName[VK_MAX_EXTENSION_NAME_SIZE];
+	
+	uint32_t propertyCount;
+	void *pProperties;
+	
+	// One for being in vkelEnumerations, and one per caller still reading the properties
+	uint32_t referenceCount;
+} VkelEnumeration;
+
+static VkelEnumeration *vkelEnumerations;
+
+// Changed by every invalidation, so results enumerated meanwhile aren't kept
+static uint32_t vkelEnumerationGeneration;
+
+static VkelPlatformMutex vkelEnumerationMutex = VKEL_PLATFORM_MUTEX_INITIALIZER;
+
+
+// The functions enumerating physical devices, for threads that can't read vkelTable
+// while another thread may be loading it (see vkelProbePhysicalDevicesAsync())
+typedef struct VkelEnumerateProcs
+{
+	PFN_vkEnumerateDeviceExtensionProperties enumerateDeviceExtensionProperties;
+	PFN_vkEnumerateDeviceLayerProperties enumerateDeviceLayerProperties;
+} VkelEnumerateProcs;
+
+// Calls through vkelTable when pProcs is NULL
+static VkResult vkelEnumerateProperties(VkPhysicalDevice physicalDevice, VkBool32 layers, const char *pLayerName, uint32_t *pPropertyCount, void *pProperties, const VkelEnumerateProcs *pProcs)
+{
+	if (physicalDevice && pProcs)
+	{
+		if (layers)
+			return pProcs->enumerateDeviceLayerProperties(physicalDevice, pPropertyCount, (VkLayerProperties*) pProperties);
+		
+		return pProcs->enumerateDeviceExtensionProperties(physicalDevice, pLayerName, pPropertyCount, (VkExtensionProperties*) pProperties);
+	}
+	
+	if (physicalDevice)
+	{
+		if (layers)
+			return vkEnumerateDeviceLayerProperties(physicalDevice, pPropertyCount, (VkLayerProperties*) pProperties);
+		
+		return vkEnumerateDeviceExtensionProperties(physicalDevice, pLayerName, pPropertyCount, (VkExtensionProperties*) pProperties);
+	}
+	
+	if (layers)
+		return vkEnumerateInstanceLayerProperties(pPropertyCount, (VkLayerProperties*) pProperties);
+	
+	return vkEnumerateInstanceExtensionProperties(pLayerName, pPropertyCount, (VkExtensionProperties*) pProperties);
+}
+
+static VkelEnumeration* vkelFindEnumeration(VkPhysicalDevice physicalDevice, VkBool32 layers, const char *pLayerName)
+{
+	VkelEnumeration *enumeration = vkelEnumerations;
+	
+	for (; enumeration; enumeration = enumeration->pNext)
+		if ((enumeration->physicalDevice == physicalDevice) && (enumeration->layers == layers) && !vkel_strcmp(enumeration->layerName, pLayerName))
+			return enumeration;
+	
+	return NULL;
+}
+
+// Called with vkelEnumerationMutex held
+static void vkelUnreferenceEnumeration(VkelEnumeration *enumeration)
+{
+	if (!--enumeration->referenceCount)
+		vkel_free(enumeration);
+}
+
+static void vkelReleaseEnumeration(VkelEnumeration *enumeration)
+{
+	if (!enumeration)
+		return;
+	
+	vkelPlatformLockMutex(&vkelEnumerationMutex);
+	
+	vkelUnreferenceEnumeration(enumeration);
+	
+	vkelPlatformUnlockMutex(&vkelEnumerationMutex);
+}
+
+// The results are kept until invalidated, while the returned properties stay valid (even
+// when invalidated by another thread) until *pEnumeration is passed to vkelReleaseEnumeration()
+static const void* vkelEnumerate(VkPhysicalDevice physicalDevice, VkBool32 layers, const char *pLayerName, uint32_t *propertyCount, VkelEnumeration **pEnumeration, const VkelEnumerateProcs *pProcs)
+{
+	(*pEnumeration) = NULL;
+	
+	if (!pLayerName)
+		pLayerName = "";
+	
+	// Can't be the name of a layer
+	if (strlen(pLayerName) >= VK_MAX_EXTENSION_NAME_SIZE)
+	{
+		(*propertyCount) = 0;
+		
+		return NULL;
+	}
+	
+	
+	vkelPlatformLockMutex(&vkelEnumerationMutex);
+	
+	VkelEnumeration *enumeration = vkelFindEnumeration(physicalDevice, layers, pLayerName);
+	
+	if (enumeration)
+		enumeration->referenceCount++;
+	
+	uint32_t generation = vkelEnumerationGeneration;
+	
+	vkelPlatformUnlockMutex(&vkelEnumerationMutex);
+	
+	if (enumeration)
+	{
+		(*pEnumeration) = enumeration;
+		(*propertyCount) = enumeration->propertyCount;
+		
+		return enumeration->pProperties;
+	}
+	
+	
+	// Enumerating happens without holding the lock, so different
+	// physical devices can be enumerated at the same time
+	const char *pEnumeratedLayerName = (*pLayerName) ? pLayerName : NULL;
+	const size_t propertySize = layers ? sizeof(VkLayerProperties) : sizeof(VkExtensionProperties);
+	
+	VkResult err;
+	
+	uint32_t count = 0;
+	
+	// Properties can be added between the two calls, in which case
+	// VK_INCOMPLETE is returned and the count is queried again
+	do
+	{
+		err = vkelEnumerateProperties(physicalDevice, layers, pEnumeratedLayerName, &count, NULL, pProcs);
+		
+		if (err < 0)
+		{
+			(*propertyCount) = 0;
+			
+			return NULL;
+		}
+		
+		enumeration = (VkelEnumeration*) vkel_calloc(1, sizeof(VkelEnumeration) + count * propertySize, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+		
+		if (!enumeration)
+		{
+			(*propertyCount) = 0;
+			
+			return NULL;
+		}
+		
+		enumeration->pProperties = count ? (void*) (enumeration + 1) : NULL;
+		
+		err = vkelEnumerateProperties(physicalDevice, layers, pEnumeratedLayerName, &count, enumeration->pProperties, pProcs);
+		
+		// Neither failures nor truncated lists are kept
+		if ((err < 0) || (err == VK_INCOMPLETE))
+		{
+			vkel_free(enumeration);
+			
+			if (err < 0)
+			{
+				(*propertyCount) = 0;
+				
+				return NULL;
+			}
+		}
+	}
+	while (err == VK_INCOMPLETE);
+	
+	enumeration->physicalDevice = physicalDevice;
+	enumeration->layers = layers;
+	vkel_strpy(enumeration->layerName, pLayerName);
+	
+	enumeration->propertyCount = count;
+	
+	
+	vkelPlatformLockMutex(&vkelEnumerationMutex);
+	
+	VkelEnumeration *existing = vkelFindEnumeration(physicalDevice, layers, pLayerName);
+	
+	// Enumerated by another thread in the meantime
+	if (existing)
+	{
+		vkel_free(enumeration);
+		enumeration = existing;
+		enumeration->referenceCount++;
+	}
+	// Or invalidated, when it may have been enumerated from before (like of a handle
+	// vkelInstanceInit() let go of), so it's only handed to the caller
+	else if (generation != vkelEnumerationGeneration)
+		enumeration->referenceCount = 1;
+	else
+	{
+		enumeration->pNext = vkelEnumerations;
+		enumeration->referenceCount = 2;
+		vkelEnumerations = enumeration;
+	}
+	
+	vkelPlatformUnlockMutex(&vkelEnumerationMutex);
+	
+	
+	(*pEnumeration) = enumeration;
+	(*propertyCount) = enumeration->propertyCount;
+	
+	return enumeration->pProperties;
+}
+
+
+void vkelInvalidateEnumerations(VkPhysicalDevice physicalDevice)
+{
+	vkelPlatformLockMutex(&vkelEnumerationMutex);
+	
+	vkelEnumerationGeneration++;
+	
+	VkelEnumeration **pEnumeration = &vkelEnumerations;
+	
+	while (*pEnumeration)
+	{
+		VkelEnumeration *enumeration = *pEnumeration;
+		
+		if (enumeration->physicalDevice == physicalDevice)
+		{
+			*pEnumeration = enumeration->pNext;
+			vkelUnreferenceEnumeration(enumeration);
+		}
+		else
+			pEnumeration = &enumeration->pNext;
+	}
+	
+	vkelPlatformUnlockMutex(&vkelEnumerationMutex);
+}
+
+// A new instance can hand out the handles of an earlier instance's physical
+// devices, so their results are dropped while the instance level ones are kept
+static void vkelInvalidatePhysicalDeviceEnumerations(void)
+{
+	vkelPlatformLockMutex(&vkelEnumerationMutex);
+	
+	vkelEnumerationGeneration++;
+	
+	VkelEnumeration **pEnumeration = &vkelEnumerations;
+	
+	while (*pEnumeration)
+	{
+		VkelEnumeration *enumeration = *pEnumeration;
+		
+		if (enumeration->physicalDevice != VK_NULL_HANDLE)
+		{
+			*pEnumeration = enumeration->pNext;
+			vkelUnreferenceEnumeration(enumeration);
+		}
+		else
+			pEnumeration = &enumeration->pNext;
+	}
+	
+	vkelPlatformUnlockMutex(&vkelEnumerationMutex);
+}
+
+void vkelInvalidateAllEnumerations(void)
+{
+	vkelPlatformLockMutex(&vkelEnumerationMutex);
+	
+	vkelEnumerationGeneration++;
+	
+	while (vkelEnumerations)
+	{
+		VkelEnumeration *enumeration = vkelEnumerations;
+		
+		vkelEnumerations = enumeration->pNext;
+		vkelUnreferenceEnumeration(enumeration);
+	}
+	
+	vkelPlatformUnlockMutex(&vkelEnumerationMutex);
+}
+
+
+static const VkExtensionProperties* vkelEnumerateInstanceExtensions(const char *pLayerName, uint32_t *extPropertyCount, VkelEnumeration **pEnumeration)
+{
+	return (const VkExtensionProperties*) vkelEnumerate(VK_NULL_HANDLE, VK_FALSE, pLayerName, extPropertyCount, pEnumeration, NULL);
+}
+
+static const VkLayerProperties* vkelEnumerateInstanceLayers(uint32_t *layerPropertyCount, VkelEnumeration **pEnumeration)
+{
+	return (const VkLayerProperties*) vkelEnumerate(VK_NULL_HANDLE, VK_TRUE, NULL, layerPropertyCount, pEnumeration, NULL);
+}
+
+
+static const VkExtensionProperties* vkelEnumerateDeviceExtensions(VkPhysicalDevice physicalDevice, const char *pLayerName, uint32_t *extPropertyCount, VkelEnumeration **pEnumeration)
+{
+	assert(physicalDevice);
+	
+	return (const VkExtensionProperties*) vkelEnumerate(physicalDevice, VK_FALSE, pLayerName, extPropertyCount, pEnumeration, NULL);
+}
+
+static const VkLayerProperties* vkelEnumerateDeviceLayers(VkPhysicalDevice physicalDevice, uint32_t *layerPropertyCount, VkelEnumeration **pEnumeration)
+{
+	assert(physicalDevice);
+	
+	return (const VkLayerProperties*) vkelEnumerate(physicalDevice, VK_TRUE, NULL, layerPropertyCount, pEnumeration, NULL);
+}
+
+
+// Both VkExtensionProperties and VkLayerProperties start with their name,
+// so the names are simply read every propertyStride bytes
+static char** vkelCopyNames(uint32_t nameCount, const char *pFirstName, size_t propertyStride)
+{
+	if (nameCount < 1)
+		return NULL;
+	
+	
+	char **names = (char**) vkel_calloc(nameCount, sizeof(char*), VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+	
+	// The allocator can fail (see vkelSetAllocator())
+	if (!names)
+		return NULL;
+	
+	uint32_t nameIndex = 0;
+	for (nameIndex = 0; nameIndex < nameCount; nameIndex++)
+	{
+		names[nameIndex] = (char*) vkel_calloc(VK_MAX_EXTENSION_NAME_SIZE, sizeof(char), VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+		
+		if (!names[nameIndex])
+		{
+			vkelDeleteNames(nameIndex, names);
+			return NULL;
+		}
+		
+		vkel_strpy(names[nameIndex], (char*) (pFirstName + nameIndex * propertyStride));
+	}
+	
+	
+	return names;
+}
+
+static uint32_t vkelMatchNames(uint32_t nameCount, const char* const *pNames, VkBool32 *pSupported, uint32_t propertyCount, const char *pFirstName, size_t propertyStride)
+{
+	uint32_t supportedCount = 0;
+	
+	uint32_t nameIndex = 0;
+	for (nameIndex = 0; nameIndex < nameCount; nameIndex++)
+	{
+		VkBool32 supported = VK_FALSE;
+		
+		uint32_t propertyIndex = 0;
+		for (propertyIndex = 0; propertyIndex < propertyCount; propertyIndex++)
+		{
+			if (!vkel_strcmp(pFirstName + propertyIndex * propertyStride, pNames[nameIndex]))
+			{
+				supported = VK_TRUE;
+				break;
+			}
+		}
+		
+		if (supported)
+			supportedCount++;
+		
+		if (pSupported)
+			pSupported[nameIndex] = supported;
+	}
+	
+	return supportedCount;
+}
+
+
+char** vkelGetInstanceExtensionNames(const char *pLayerName, uint32_t *extensionNameCount)
+{
+	assert(extensionNameCount);
+	
+	
+	VkelEnumeration *enumeration;
+	const VkExtensionProperties *extProperties = vkelEnumerateInstanceExtensions(pLayerName, extensionNameCount, &enumeration);
+	
+	char **extensionNames = extProperties ? vkelCopyNames((*extensionNameCount), extProperties->extensionName, sizeof(VkExtensionProperties)) : NULL;
+	
+	vkelReleaseEnumeration(enumeration);
+	
+	if (!extensionNames)
+		(*extensionNameCount) = 0;
+	
+	
+	return extensionNames;
+}
+
+char** vkelGetInstanceLayerNames(uint32_t *layerNameCount)
+{
+	assert(layerNameCount);
+	
+	
+	VkelEnumeration *enumeration;
+	const VkLayerProperties *layerProperties = vkelEnumerateInstanceLayers(layerNameCount, &enumeration);
+	
+	char **layerNames = layerProperties ? vkelCopyNames((*layerNameCount), layerProperties->layerName, sizeof(VkLayerProperties)) : NULL;
+	
+	vkelReleaseEnumeration(enumeration);
+	
+	if (!layerNames)
+		(*layerNameCount) = 0;
+	
+	
+	return layerNames;
+}
+
+
+char** vkelGetDeviceExtensionNames(VkPhysicalDevice physicalDevice, const char *pLayerName, uint32_t *extensionNameCount)
+{
+	assert(extensionNameCount);
+	
+	
+	VkelEnumeration *enumeration;
+	const VkExtensionProperties *extProperties = vkelEnumerateDeviceExtensions(physicalDevice, pLayerName, extensionNameCount, &enumeration);
+	
+	char **extensionNames = extProperties ? vkelCopyNames((*extensionNameCount), extProperties->extensionName, sizeof(VkExtensionProperties)) : NULL;
+	
+	vkelReleaseEnumeration(enumeration);
+	
+	if (!extensionNames)
+		(*extensionNameCount) = 0;
+	
+	
+	return extensionNames;
+}
+
+char** vkelGetDeviceLayerNames(VkPhysicalDevice physicalDevice, uint32_t *layerNameCount)
+{
+	assert(layerNameCount);
+	
+	
+	VkelEnumeration *enumeration;
+	const VkLayerProperties *layerProperties = vkelEnumerateDeviceLayers(physicalDevice, layerNameCount, &enumeration);
+	
+	char **layerNames = layerProperties ? vkelCopyNames((*layerNameCount), layerProperties->layerName, sizeof(VkLayerProperties)) : NULL;
+	
+	vkelReleaseEnumeration(enumeration);
+	
+	if (!layerNames)
+		(*layerNameCount) = 0;
+	
+	
+	return layerNames;
+}
+
+
+uint32_t vkelQueryInstanceLayers(uint32_t layerNameCount, const char* const *pLayerNames, VkBool32 *pSupported)
+{
+	uint32_t layerPropertyCount = 0;
+	VkelEnumeration *enumeration;
+	const VkLayerProperties *layerProperties = vkelEnumerateInstanceLayers(&layerPropertyCount, &enumeration);
+	
+	uint32_t supportedCount = vkelMatchNames(layerNameCount, pLayerNames, pSupported, layerPropertyCount, layerProperties ? layerProperties->layerName : NULL, sizeof(VkLayerProperties));
+	
+	vkelReleaseEnumeration(enumeration);
+	
+	return supportedCount;
+}
+
+uint32_t vkelQueryInstanceExtensions(const char *pLayerName, uint32_t extensionNameCount, const char* const *pExtensionNames, VkBool32 *pSupported)
+{
+	uint32_t extPropertyCount = 0;
+	VkelEnumeration *enumeration;
+	const VkExtensionProperties *extProperties = vkelEnumerateInstanceExtensions(pLayerName, &extPropertyCount, &enumeration);
+	
+	uint32_t supportedCount = vkelMatchNames(extensionNameCount, pExtensionNames, pSupported, extPropertyCount, extProperties ? extProperties->extensionName : NULL, sizeof(VkExtensionProperties));
+	
+	vkelReleaseEnumeration(enumeration);
+	
+	return supportedCount;
+}
+
+
+uint32_t vkelQueryDeviceLayers(VkPhysicalDevice physicalDevice, uint32_t layerNameCount, const char* const *pLayerNames, VkBool32 *pSupported)
+{
+	uint32_t layerPropertyCount = 0;
+	VkelEnumeration *enumeration;
+	const VkLayerProperties *layerProperties = vkelEnumerateDeviceLayers(physicalDevice, &layerPropertyCount, &enumeration);
+	
+	uint32_t supportedCount = vkelMatchNames(layerNameCount, pLayerNames, pSupported, layerPropertyCount, layerProperties ? layerProperties->layerName : NULL, sizeof(VkLayerProperties));
+	
+	vkelReleaseEnumeration(enumeration);
+	
+	return supportedCount;
+}
+
+uint32_t vkelQueryDeviceExtensions(VkPhysicalDevice physicalDevice, const char *pLayerName, uint32_t extensionNameCount, const char* const *pExtensionNames, VkBool32 *pSupported)
+{
+	uint32_t extPropertyCount = 0;
+	VkelEnumeration *enumeration;
+	const VkExtensionProperties *extProperties = vkelEnumerateDeviceExtensions(physicalDevice, pLayerName, &extPropertyCount, &enumeration);
+	
+	uint32_t supportedCount = vkelMatchNames(extensionNameCount, pExtensionNames, pSupported, extPropertyCount, extProperties ? extProperties->extensionName : NULL, sizeof(VkExtensionProperties));
+	
+	vkelReleaseEnumeration(enumeration);
+	
+	return supportedCount;
+}
+
+
+static uint32_t vkelFindId(const char *pName, const char* const *pNames, const uint32_t *pIdsByName, uint32_t idCount)
+{
+	if (!pName)
+		return idCount;
+	
+	uint32_t first = 0;
+	uint32_t last = idCount;
+	
+	while (first < last)
+	{
+		uint32_t middle = first + (last - first) / 2;
+		
+		int order = vkel_strcmp(pNames[pIdsByName[middle]], pName);
+		
+		if (order == 0)
+			return pIdsByName[middle];
+		
+		if (order < 0)
+			first = middle + 1;
+		else
+			last = middle;
+	}
+	
+	return idCount;
+}
+
+
+const char* vkelGetExtensionName(VkelExtensionId extensionId)
+{
+	return ((uint32_t) extensionId < VKEL_EXT_ID_COUNT) ? vkelExtensionNames[extensionId] : NULL;
+}
+
+const char* vkelGetLayerName(VkelLayerId layerId)
+{
+	return ((uint32_t) layerId < VKEL_LAYER_ID_COUNT) ? vkelLayerNames[layerId] : NULL;
+}
+
+
+VkelExtensionId vkelFindExtensionId(const char *pExtensionName)
+{
+	return (VkelExtensionId) vkelFindId(pExtensionName, vkelExtensionNames, vkelExtensionIdsByName, VKEL_EXT_ID_COUNT);
+}
+
+VkelLayerId vkelFindLayerId(const char *pLayerName)
+{
+	return (VkelLayerId) vkelFindId(pLayerName, vkelLayerNames, vkelLayerIdsByName, VKEL_LAYER_ID_COUNT);
+}
+
+
+// Map enumerated names to their IDs (once), so checking them
+// later doesn't involve any string comparisons
+static void vkelMapExtensions(VkelCapabilities *pCapabilities, uint32_t extPropertyCount, const VkExtensionProperties *extProperties)
+{
+	memset(pCapabilities->extensions, 0, sizeof(pCapabilities->extensions));
+	
+	uint32_t extPropertyIndex = 0;
+	for (extPropertyIndex = 0; extPropertyIndex < extPropertyCount; extPropertyIndex++)
+	{
+		uint32_t extensionId = (uint32_t) vkelFindExtensionId(extProperties[extPropertyIndex].extensionName);
+		
+		if (extensionId < VKEL_EXT_ID_COUNT)
+			pCapabilities->extensions[extensionId / 32] |= 1u << (extensionId % 32);
+	}
+}
+
+static void vkelMapLayers(VkelCapabilities *pCapabilities, uint32_t layerPropertyCount, const VkLayerProperties *layerProperties)
+{
+	memset(pCapabilities->layers, 0, sizeof(pCapabilities->layers));
+	
+	uint32_t layerPropertyIndex = 0;
+	for (layerPropertyIndex = 0; layerPropertyIndex < layerPropertyCount; layerPropertyIndex++)
+	{
+		uint32_t layerId = (uint32_t) vkelFindLayerId(layerProperties[layerPropertyIndex].layerName);
+		
+		if (layerId < VKEL_LAYER_ID_COUNT)
+			pCapabilities->layers[layerId / 32] |= 1u << (layerId % 32);
+	}
+}
+
+
+static void vkelGetInstanceSupport(VkelCapabilities *pCapabilities)
+{
+	VkelEnumeration *enumeration;
+	
+	uint32_t extPropertyCount = 0;
+	const VkExtensionProperties *extProperties = vkelEnumerateInstanceExtensions(NULL, &extPropertyCount, &enumeration);
+	
+	vkelMapExtensions(pCapabilities, extPropertyCount, extProperties);
+	vkelReleaseEnumeration(enumeration);
+	
+	
+	uint32_t layerPropertyCount = 0;
+	const VkLayerProperties *layerProperties = vkelEnumerateInstanceLayers(&layerPropertyCount, &enumeration);
+	
+	vkelMapLayers(pCapabilities, layerPropertyCount, layerProperties);
+	vkelReleaseEnumeration(enumeration);
+}
+
+static void vkelMapPhysicalDeviceCapabilities(VkPhysicalDevice physicalDevice, VkelCapabilities *pCapabilities, const VkelEnumerateProcs *pProcs)
+{
+	assert(physicalDevice);
+	
+	
+	VkelEnumeration *enumeration;
+	
+	uint32_t extPropertyCount = 0;
+	const VkExtensionProperties *extProperties = (const VkExtensionProperties*) vkelEnumerate(physicalDevice, VK_FALSE, NULL, &extPropertyCount, &enumeration, pProcs);
+	
+	vkelMapExtensions(pCapabilities, extPropertyCount, extProperties);
+	vkelReleaseEnumeration(enumeration);
+	
+	
+	uint32_t layerPropertyCount = 0;
+	const VkLayerProperties *layerProperties = (const VkLayerProperties*) vkelEnumerate(physicalDevice, VK_TRUE, NULL, &layerPropertyCount, &enumeration, pProcs);
+	
+	vkelMapLayers(pCapabilities, layerPropertyCount, layerProperties);
+	vkelReleaseEnumeration(enumeration);
+}
+
+void vkelGetPhysicalDeviceCapabilities(VkPhysicalDevice physicalDevice, VkelCapabilities *pCapabilities)
+{
+	assert(pCapabilities);
+	
+	vkelMapPhysicalDeviceCapabilities(physicalDevice, pCapabilities, NULL);
+}
+
+
+const VkelCapabilities* vkelGetInstanceCapabilities(void)
+{
+	return &vkelInstanceCapabilities;
+}
+
+const VkelCapabilities* vkelGetDeviceCapabilities(void)
+{
+	static VkelCapabilities noCapabilities;
+	
+	const VkelDevice *entry = (const VkelDevice*) vkelAtomicLoadPointer(&vkelCurrentDevice);
+	
+	return entry ? &entry->capabilities : &noCapabilities;
+}
+
+
+void vkelIntersectCapabilities(VkelCapabilities *pCapabilities, const VkelCapabilities *pOther)
+{
+	uint32_t wordIndex = 0;
+	for (wordIndex = 0; wordIndex < VKEL_EXT_WORD_COUNT; wordIndex++)
+		pCapabilities->extensions[wordIndex] &= pOther->extensions[wordIndex];
+	
+	for (wordIndex = 0; wordIndex < VKEL_LAYER_WORD_COUNT; wordIndex++)
+		pCapabilities->layers[wordIndex] &= pOther->layers[wordIndex];
+}
+
+void vkelUniteCapabilities(VkelCapabilities *pCapabilities, const VkelCapabilities *pOther)
+{
+	uint32_t wordIndex = 0;
+	for (wordIndex = 0; wordIndex < VKEL_EXT_WORD_COUNT; wordIndex++)
+		pCapabilities->extensions[wordIndex] |= pOther->extensions[wordIndex];
+	
+	for (wordIndex = 0; wordIndex < VKEL_LAYER_WORD_COUNT; wordIndex++)
+		pCapabilities->layers[wordIndex] |= pOther->layers[wordIndex];
+}
+
+VkBool32 vkelCompareCapabilities(const VkelCapabilities *pCapabilities, const VkelCapabilities *pOther)
+{
+	return memcmp(pCapabilities, pOther, sizeof(VkelCapabilities)) ? VK_FALSE : VK_TRUE;
+}
+
+
+VkBool32 vkelHasExtension(VkelExtensionId extensionId)
+{
+	if ((uint32_t) extensionId >= VKEL_EXT_ID_COUNT)
+		return VK_FALSE;
+	
+#ifdef VKEL_RECORD_USAGE
+	vkelRecordUsage(&vkelExtensionUsage[extensionId]);
+#endif
+	
+	return (vkelCapabilitiesHasExtension(&vkelInstanceCapabilities, extensionId) | vkelCapabilitiesHasExtension(vkelGetDeviceCapabilities(), extensionId)) ? VK_TRUE : VK_FALSE;
+}
+
+VkBool32 vkelHasLayer(VkelLayerId layerId)
+{
+	if ((uint32_t) layerId >= VKEL_LAYER_ID_COUNT)
+		return VK_FALSE;
+	
+#ifdef VKEL_RECORD_USAGE
+	vkelRecordUsage(&vkelLayerUsage[layerId]);
+#endif
+	
+	return (vkelCapabilitiesHasLayer(&vkelInstanceCapabilities, layerId) | vkelCapabilitiesHasLayer(vkelGetDeviceCapabilities(), layerId)) ? VK_TRUE : VK_FALSE;
+}
+
+
+static uint32_t vkelCountBits(uint32_t value)
+{
+	uint32_t count = 0;
+	
+	for (; value; value &= value - 1)
+		count++;
+	
+	return count;
+}
+
+// Returns VK_FALSE if the physical device doesn't meet the requirements
+static VkBool32 vkelRankPhysicalDevice(VkPhysicalDevice physicalDevice, const VkelDeviceRequirements *pRequirements, VkelRankedDevice *pRankedDevice)
+{
+	VkelCapabilities capabilities;
+	vkelGetPhysicalDeviceCapabilities(physicalDevice, &capabilities);
+	
+	uint32_t optionalCount = 0;
+	
+	uint32_t wordIndex = 0;
+	for (wordIndex = 0; wordIndex < VKEL_EXT_WORD_COUNT; wordIndex++)
+	{
+		if ((capabilities.extensions[wordIndex] & pRequirements->required.extensions[wordIndex]) != pRequirements->required.extensions[wordIndex])
+			return VK_FALSE;
+		
+		optionalCount += vkelCountBits(capabilities.extensions[wordIndex] & pRequirements->optional.extensions[wordIndex]);
+	}
+	
+	for (wordIndex = 0; wordIndex < VKEL_LAYER_WORD_COUNT; wordIndex++)
+	{
+		if ((capabilities.layers[wordIndex] & pRequirements->required.layers[wordIndex]) != pRequirements->required.layers[wordIndex])
+			return VK_FALSE;
+		
+		optionalCount += vkelCountBits(capabilities.layers[wordIndex] & pRequirements->optional.layers[wordIndex]);
+	}
+	
+	
+	uint32_t queueFamilyCount = 0;
+	vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueFamilyCount, NULL);
+	
+	VkQueueFamilyProperties *queueFamilies = (VkQueueFamilyProperties*) vkel_calloc(queueFamilyCount + 1, sizeof(VkQueueFamilyProperties), VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+	
+	if (!queueFamilies)
+		return VK_FALSE;
+	
+	vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueFamilyCount, queueFamilies);
+	
+	uint32_t queueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	uint32_t queueScore = 0;
+	
+	uint32_t familyIndex = 0;
+	for (familyIndex = 0; familyIndex < queueFamilyCount; familyIndex++)
+	{
+		VkQueueFlags flags = queueFamilies[familyIndex].queueFlags;
+		
+		if (!queueFamilies[familyIndex].queueCount)
+			continue;
+		
+		if ((queueFamilyIndex == VK_QUEUE_FAMILY_IGNORED) && ((flags & pRequirements->queueFlags) == pRequirements->queueFlags))
+			queueFamilyIndex = familyIndex;
+		
+		// Async compute, and transfers which don't compete with rendering
+		if ((flags & VK_QUEUE_COMPUTE_BIT) && !(flags & VK_QUEUE_GRAPHICS_BIT))
+			queueScore |= 2;
+		else if ((flags & VK_QUEUE_TRANSFER_BIT) && !(flags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT)))
+			queueScore |= 1;
+	}
+	
+	vkel_free(queueFamilies);
+	
+	if (queueFamilyIndex == VK_QUEUE_FAMILY_IGNORED)
+		return VK_FALSE;
+	
+	
+	VkPhysicalDeviceProperties properties;
+	vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+	
+	VkPhysicalDeviceMemoryProperties memoryProperties;
+	vkGetPhysicalDeviceMemoryProperties(physicalDevice, &memoryProperties);
+	
+	VkDeviceSize deviceLocalMemorySize = 0;
+	
+	uint32_t heapIndex = 0;
+	for (heapIndex = 0; heapIndex < memoryProperties.memoryHeapCount; heapIndex++)
+		if (memoryProperties.memoryHeaps[heapIndex].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT)
+			deviceLocalMemorySize += memoryProperties.memoryHeaps[heapIndex].size;
+	
+	uint64_t typeScore = 0;
+	
+	switch (properties.deviceType)
+	{
+	case VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU: typeScore = 4; break;
+	case VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU: typeScore = 3; break;
+	case VK_PHYSICAL_DEVICE_TYPE_VIRTUAL_GPU: typeScore = 2; break;
+	case VK_PHYSICAL_DEVICE_TYPE_CPU: typeScore = 1; break;
+	default: typeScore = 0; break;
+	}
+	
+	// In MiB, 40 bits is plenty
+	uint64_t memoryScore = deviceLocalMemorySize >> 20;
+	
+	if (memoryScore > 0xFFFFFFFFFFull)
+		memoryScore = 0xFFFFFFFFFFull;
+	
+	pRankedDevice->physicalDevice = physicalDevice;
+	pRankedDevice->deviceType = properties.deviceType;
+	pRankedDevice->deviceLocalMemorySize = deviceLocalMemorySize;
+	pRankedDevice->queueFamilyIndex = queueFamilyIndex;
+	pRankedDevice->optionalCount = optionalCount;
+	pRankedDevice->score = (typeScore << 56) | ((uint64_t) ((optionalCount < 0xFF) ? optionalCount : 0xFF) << 48) | (memoryScore << 8) | queueScore;
+	
+	return VK_TRUE;
+}
+
+VkResult vkelRankPhysicalDevices(VkInstance instance, const VkelDeviceRequirements *pRequirements, uint32_t *pRankedDeviceCount, VkelRankedDevice *pRankedDevices)
+{
+	assert(pRankedDeviceCount);
+	
+	VkelDeviceRequirements noRequirements;
+	
+	if (!pRequirements)
+	{
+		memset(&noRequirements, 0, sizeof(noRequirements));
+		pRequirements = &noRequirements;
+	}
+	
+	
+	uint32_t physicalDeviceCount = 0;
+	VkResult result = vkEnumeratePhysicalDevices(instance, &physicalDeviceCount, NULL);
+	
+	if (result != VK_SUCCESS)
+		return result;
+	
+	VkPhysicalDevice *physicalDevices = (VkPhysicalDevice*) vkel_calloc(physicalDeviceCount + 1, sizeof(VkPhysicalDevice), VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+	VkelRankedDevice *rankedDevices = (VkelRankedDevice*) vkel_calloc(physicalDeviceCount + 1, sizeof(VkelRankedDevice), VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+	
+	if (!physicalDevices || !rankedDevices)
+	{
+		vkel_free(physicalDevices);
+		vkel_free(rankedDevices);
+		
+		return VK_ERROR_OUT_OF_HOST_MEMORY;
+	}
+	
+	result = vkEnumeratePhysicalDevices(instance, &physicalDeviceCount, physicalDevices);
+	
+	if (result < VK_SUCCESS)
+	{
+		vkel_free(physicalDevices);
+		vkel_free(rankedDevices);
+		
+		return result;
+	}
+	
+	
+	uint32_t rankedDeviceCount = 0;
+	
+	uint32_t physicalDeviceIndex = 0;
+	for (physicalDeviceIndex = 0; physicalDeviceIndex < physicalDeviceCount; physicalDeviceIndex++)
+	{
+		VkelRankedDevice rankedDevice;
+		
+		if (!vkelRankPhysicalDevice(physicalDevices[physicalDeviceIndex], pRequirements, &rankedDevice))
+			continue;
+		
+		// Insertion sort, as there are only a few and equal scores keep the enumeration order
+		uint32_t rankIndex = rankedDeviceCount++;
+		
+		for (; (rankIndex > 0) && (rankedDevices[rankIndex - 1].score < rankedDevice.score); rankIndex--)
+			rankedDevices[rankIndex] = rankedDevices[rankIndex - 1];
+		
+		rankedDevices[rankIndex] = rankedDevice;
+	}
+	
+	
+	result = VK_SUCCESS;
+	
+	if (pRankedDevices)
+	{
+		if (*pRankedDeviceCount < rankedDeviceCount)
+			result = VK_INCOMPLETE;
+		else
+			*pRankedDeviceCount = rankedDeviceCount;
+		
+		memcpy(pRankedDevices, rankedDevices, *pRankedDeviceCount * sizeof(VkelRankedDevice));
+	}
+	else
+		*pRankedDeviceCount = rankedDeviceCount;
+	
+	vkel_free(physicalDevices);
+	vkel_free(rankedDevices);
+	
+	
+	return result;
+}
+
+VkPhysicalDevice vkelSelectPhysicalDevice(VkInstance instance, const VkelDeviceRequirements *pRequirements)
+{
+	VkelRankedDevice rankedDevice;
+	uint32_t rankedDeviceCount = 1;
+	
+	VkResult result = vkelRankPhysicalDevices(instance, pRequirements, &rankedDeviceCount, &rankedDevice);
+	
+	if ((result < VK_SUCCESS) || !rankedDeviceCount)
+		return VK_NULL_HANDLE;
+	
+	return rankedDevice.physicalDevice;
+}
+
+
+VkBool32 vkelIsInstanceLayerSupported(const char *pLayerName)
+{
+	return (vkelQueryInstanceLayers(1, &pLayerName, NULL) == 1) ? VK_TRUE : VK_FALSE;
+}
+
+VkBool32 vkelIsInstanceExtensionSupported(const char *pLayerName, const char *pExtensionName)
+{
+	return (vkelQueryInstanceExtensions(pLayerName, 1, &pExtensionName, NULL) == 1) ? VK_TRUE : VK_FALSE;
+}
+
+
+VkBool32 vkelIsDeviceLayerSupported(VkPhysicalDevice physicalDevice, const char *pLayerName)
+{
+	return (vkelQueryDeviceLayers(physicalDevice, 1, &pLayerName, NULL) == 1) ? VK_TRUE : VK_FALSE;
+}
+
+VkBool32 vkelIsDeviceExtensionSupported(VkPhysicalDevice physicalDevice, const char *pLayerName, const char *pExtensionName)
+{
+	return (vkelQueryDeviceExtensions(physicalDevice, pLayerName, 1, &pExtensionName, NULL) == 1) ? VK_TRUE : VK_FALSE;
+}
+
+''')
+	
+	
+	# Thread device
+	
+	lines = []
+	
+	lines.append("")
+	lines.append("#ifdef VKEL_THREAD_DEVICE")
+	lines.append("")
+	lines.append("VKEL_THREAD_LOCAL const VkelDeviceTable *vkelThreadDeviceTable;")
+	lines.append("")
+	lines.append("static VKEL_THREAD_LOCAL VkDevice vkelThreadDevice;")
+	lines.append("")
+	lines.append("")
+	lines.append("// The table the vk* macros call through for the entry")
+	lines.append("static const VkelDeviceTable* vkelGetBoundDeviceTable(const VkelDevice *entry)")
+	lines.append("{")
+	lines.append("#ifdef VKEL_RECORD_USAGE")
+	lines.append("\t// The recording functions, see vkelRegisterDevice()")
+	lines.append("\treturn (const VkelDeviceTable*) (entry + 1);")
+	lines.append("#else")
+	lines.append("\treturn &entry->table;")
+	lines.append("#endif")
+	lines.append("}")
+	lines.append("")
+	lines.append("VkBool32 vkelBindDevice(VkDevice device)")
+	lines.append("{")
+	lines.append("\tconst VkelDevice *entry;")
+	lines.append("\t")
+	lines.append("\tif (!device)")
+	lines.append("\t{")
+	lines.append("\t\tvkelThreadDevice = VK_NULL_HANDLE;")
+	lines.append("\t\tvkelThreadDeviceTable = NULL;")
+	lines.append("\t\treturn VK_TRUE;")
+	lines.append("\t}")
+	lines.append("\t")
+	lines.append("\tentry = vkelGetDevice(device);")
+	lines.append("\t")
+	lines.append("\tif (!entry)")
+	lines.append("\t\treturn VK_FALSE;")
+	lines.append("\t")
+	lines.append("\tvkelThreadDevice = device;")
+	lines.append("\tvkelThreadDeviceTable = vkelGetBoundDeviceTable(entry);")
+	lines.append("\t")
+	lines.append("\treturn VK_TRUE;")
+	lines.append("}")
+	lines.append("")
+	lines.append("// Called at quiescent points, a bound device which was unregistered goes back to vkelTable.pDeviceTable")
+	lines.append("static void vkelRefreshThreadDevice(void)")
+	lines.append("{")
+	lines.append("\tconst VkelDevice *entry = vkelThreadDevice ? vkelGetDevice(vkelThreadDevice) : NULL;")
+	lines.append("\t")
+	lines.append("\tif (!entry)")
+	lines.append("\t\tvkelThreadDevice = VK_NULL_HANDLE;")
+	lines.append("\t")
+	lines.append("\tvkelThreadDeviceTable = entry ? vkelGetBoundDeviceTable(entry) : NULL;")
+	lines.append("}")
+	lines.append("")
+	lines.append("#endif /* VKEL_THREAD_DEVICE */")
+	lines.append("")
+	
+	f.write("\n".join(lines).encode("utf-8"))
+	
+	
+	# Read-copy-update
+	
+	f.write(br'''
+
+typedef struct VkelRetired
+{
+	struct VkelRetired *next;
+	void *pointer;
+	uint64_t epoch;
+} VkelRetired;
+
+// Only taken by writers, readers never lock
+static VkelPlatformMutex vkelRetireMutex = VKEL_PLATFORM_MUTEX_INITIALIZER;
+static VkelRetired *vkelRetiredList;
+
+// Advanced whenever something is retired
+static volatile uint64_t vkelEpoch = 1;
+
+// The epoch each online thread saw at its last quiescent point, 0 for unused slots
+static volatile uint64_t vkelThreadEpochs[VKEL_MAX_THREADS];
+static VKEL_THREAD_LOCAL int vkelThreadSlot = -1;
+
+// Until a thread has come online, or once one couldn't (and reads without a slot), the readers
+// of retired pointers are unknown, and they are parked until vkelUninit()
+static volatile uint64_t vkelThreadsOnline;
+static volatile uint64_t vkelThreadsUntracked;
+
+
+static uint64_t vkelAtomicLoad64(volatile uint64_t *pValue)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return __atomic_load_n(pValue, __ATOMIC_SEQ_CST);
+#elif defined(_MSC_VER)
+	return (uint64_t) InterlockedCompareExchange64((volatile LONG64*) pValue, 0, 0);
+#else
+#	error vkel needs 64-bit atomics for this compiler
+#endif
+}
+
+static void vkelAtomicStore64(volatile uint64_t *pValue, uint64_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	__atomic_store_n(pValue, value, __ATOMIC_SEQ_CST);
+#elif defined(_MSC_VER)
+	InterlockedExchange64((volatile LONG64*) pValue, (LONG64) value);
+#else
+#	error vkel needs 64-bit atomics for this compiler
+#endif
+}
+
+static uint64_t vkelAtomicIncrement64(volatile uint64_t *pValue)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return __atomic_add_fetch(pValue, 1, __ATOMIC_SEQ_CST);
+#elif defined(_MSC_VER)
+	return (uint64_t) InterlockedIncrement64((volatile LONG64*) pValue);
+#else
+#	error vkel needs 64-bit atomics for this compiler
+#endif
+}
+
+static VkBool32 vkelAtomicClaim64(volatile uint64_t *pValue, uint64_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	uint64_t expected = 0;
+	
+	return __atomic_compare_exchange_n(pValue, &expected, value, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST) ? VK_TRUE : VK_FALSE;
+#elif defined(_MSC_VER)
+	return (InterlockedCompareExchange64((volatile LONG64*) pValue, (LONG64) value, 0) == 0) ? VK_TRUE : VK_FALSE;
+#else
+#	error vkel needs 64-bit atomics for this compiler
+#endif
+}
+
+
+// Frees everything retired before the oldest quiescent point of the online threads.
+// Skipped when another thread is already reclaiming, so it never waits.
+static void vkelReclaim(void)
+{
+	uint64_t oldestEpoch = ~(uint64_t) 0;
+	VkelRetired **link = &vkelRetiredList;
+	uint32_t i;
+	
+	if (!vkelAtomicLoad64(&vkelThreadsOnline) || vkelAtomicLoad64(&vkelThreadsUntracked))
+		return;
+	
+	if (!vkelPlatformTryLockMutex(&vkelRetireMutex))
+		return;
+	
+	for (i = 0; i < VKEL_MAX_THREADS; ++i)
+	{
+		uint64_t epoch = vkelAtomicLoad64(&vkelThreadEpochs[i]);
+		
+		if (epoch && (epoch < oldestEpoch))
+			oldestEpoch = epoch;
+	}
+	
+	while (*link)
+	{
+		VkelRetired *retired = *link;
+		
+		if (retired->epoch <= oldestEpoch)
+		{
+			*link = retired->next;
+			
+			vkel_free(retired->pointer);
+			vkel_free(retired);
+		}
+		else
+			link = &retired->next;
+	}
+	
+	vkelPlatformUnlockMutex(&vkelRetireMutex);
+}
+
+// Must be called after the pointer was unpublished
+static void vkelRetire(void *pointer)
+{
+	if (!pointer)
+		return;
+	
+	VkelRetired *retired = (VkelRetired*) vkel_malloc(sizeof(VkelRetired), VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+	
+	// Leaked rather than freed while it might still be in use
+	if (!retired)
+		return;
+	
+	retired->pointer = pointer;
+	
+	vkelPlatformLockMutex(&vkelRetireMutex);
+	
+	retired->epoch = vkelAtomicIncrement64(&vkelEpoch);
+	retired->next = vkelRetiredList;
+	vkelRetiredList = retired;
+	
+	vkelPlatformUnlockMutex(&vkelRetireMutex);
+	
+	
+	vkelReclaim();
+}
+
+// Called by vkelUninit(), when no other thread may be using vkel anymore
+static void vkelReclaimAll(void)
+{
+	vkelPlatformLockMutex(&vkelRetireMutex);
+	
+	while (vkelRetiredList)
+	{
+		VkelRetired *retired = vkelRetiredList;
+		
+		vkelRetiredList = retired->next;
+		
+		vkel_free(retired->pointer);
+		vkel_free(retired);
+	}
+	
+	vkelPlatformUnlockMutex(&vkelRetireMutex);
+}
+
+
+VkBool32 vkelQuiescent(void)
+{
+	uint64_t epoch = vkelAtomicLoad64(&vkelEpoch);
+	
+	if (vkelThreadSlot < 0)
+	{
+		int i;
+		
+		for (i = 0; (i < VKEL_MAX_THREADS) && (vkelThreadSlot < 0); ++i)
+			if (vkelAtomicClaim64(&vkelThreadEpochs[i], epoch))
+				vkelThreadSlot = i;
+		
+		if (vkelThreadSlot < 0)
+		{
+			vkelAtomicStore64(&vkelThreadsUntracked, 1);
+			return VK_FALSE;
+		}
+		
+		vkelAtomicStore64(&vkelThreadsOnline, 1);
+	}
+	else
+		vkelAtomicStore64(&vkelThreadEpochs[vkelThreadSlot], epoch);
+	
+#ifdef VKEL_THREAD_DEVICE
+	vkelRefreshThreadDevice();
+#endif
+	
+	vkelReclaim();
+	
+	
+	return VK_TRUE;
+}
+
+void vkelThreadOffline(void)
+{
+	if (vkelThreadSlot < 0)
+		return;
+	
+	vkelAtomicStore64(&vkelThreadEpochs[vkelThreadSlot], 0);
+	vkelThreadSlot = -1;
+}
+
+
+const VkelDevice* vkelGetCurrentDevice(void)
+{
+	const VkelDevice *entry = (const VkelDevice*) vkelAtomicLoadPointer(&vkelCurrentDevice);
+	
+	// Not a device, but the functions loaded by vkelInit()/vkelInstanceInit()
+	return (entry && entry->device) ? entry : NULL;
+}
+
+
+static VkelDevice* vkelCreateDeviceEntry(void)
+{
+#ifdef VKEL_RECORD_USAGE
+	// Followed by the table of recording functions the vk* macros call through
+	return (VkelDevice*) vkel_calloc(1, sizeof(VkelDevice) + sizeof(VkelDeviceTable), VK_SYSTEM_ALLOCATION_SCOPE_DEVICE);
+#else
+	return (VkelDevice*) vkel_calloc(1, sizeof(VkelDevice), VK_SYSTEM_ALLOCATION_SCOPE_DEVICE);
+#endif
+}
+
+// Makes the entry the one the device level vk* macros and the device capabilities come
+// from (NULL for none), while the previous one is freed once no thread can be using it
+static void vkelPublishDevice(VkelDevice *entry)
+{
+	const VkelDeviceTable *pTable = entry ? &entry->table : &vkelNullDeviceTable;
+	
+	if (entry)
+	{
+#ifdef VKEL_FALLBACK_STUBS
+		vkelFillStubs(&entry->table, vkelDeviceStubs, sizeof(vkelDeviceStubs) / sizeof(vkelDeviceStubs[0]));
+#endif
+		
+#ifdef VKEL_RECORD_USAGE
+		vkelRecordDeviceUsageProcs(&entry->table, (VkelDeviceTable*) (entry + 1));
+		pTable = (const VkelDeviceTable*) (entry + 1);
+#endif
+	}
+	
+	
+	vkelPlatformLockMutex(&vkelRetireMutex);
+	
+	VkelDevice *previous = (VkelDevice*) vkelCurrentDevice;
+	
+	// The recording functions call through the entry, so it goes first
+	vkelAtomicStorePointer(&vkelCurrentDevice, entry);
+	vkelAtomicStorePointer((void* volatile*) &vkelTable.pDeviceTable, (void*) pTable);
+	
+	vkelTable.pDeviceExtensions = vkelGetDeviceCapabilities()->extensions;
+	vkelTable.pDeviceLayers = vkelGetDeviceCapabilities()->layers;
+	
+	vkelPlatformUnlockMutex(&vkelRetireMutex);
+	
+	
+	vkelRetire(previous);
+}
+''')
+	
+	
+	lines = []
+	
+	lines.append("")
+	lines.append("// Until vkelDeviceInit(), the device level functions are the ones vkelTable was loaded with")
+	lines.append("static VkBool32 vkelPublishInstanceDevice(const VkelCapabilities *pDeviceCapabilities)")
+	lines.append("{")
+	lines.append("\tVkelDevice *entry = vkelCreateDeviceEntry();")
+	lines.append("\t")
+	lines.append("\tif (!entry)")
+	lines.append("\t\treturn VK_FALSE;")
+	lines.append("\t")
+	
+	for func in device_funcs:
+		platform = func_platforms[func]
+		
+		if platform:
+			lines.append("#ifdef " + platform)
+		
+		lines.append("\tentry->table.{0} = vkelTable.{0};".format(func[2:]))
+		
+		if platform:
+			lines.append("#endif /* " + platform + " */")
+	
+	lines.append("\t")
+	lines.append("\tif (pDeviceCapabilities)")
+	lines.append("\t\tentry->capabilities = *pDeviceCapabilities;")
+	lines.append("\t")
+	lines.append("\tvkelPublishDevice(entry);")
+	lines.append("\t")
+	lines.append("\treturn VK_TRUE;")
+	lines.append("}")
+	lines.append("")
+	
+	f.write("\n".join(lines).encode("utf-8"))
+	
+	
+	
+	
+	# Shared table
+	
+	lines = []
+	
+	lines.append("")
+	lines.append("// Set when using the table of another copy of vkel")
+	lines.append("static const VkelTable *vkelSourceTable;")
+	lines.append("")
+	lines.append("")
+	lines.append("static void vkelUpdateTable(void)")
+	lines.append("{")
+	lines.append("\tvkelTable.version = VKEL_TABLE_VERSION;")
+	lines.append("\tvkelTable.size = sizeof(VkelTable);")
+	lines.append("\t")
+	lines.append("\tvkelTable.extensionIdCount = VKEL_EXT_ID_COUNT;")
+	lines.append("\tvkelTable.layerIdCount = VKEL_LAYER_ID_COUNT;")
+	lines.append("\t")
+	lines.append("\tvkelTable.pInstanceExtensions = vkelInstanceCapabilities.extensions;")
+	lines.append("\tvkelTable.pInstanceLayers = vkelInstanceCapabilities.layers;")
+	lines.append("\t")
+	lines.append("#ifdef VKEL_FALLBACK_STUBS")
+	lines.append("\tvkelFillStubs(&vkelTable, vkelStubs, sizeof(vkelStubs) / sizeof(vkelStubs[0]));")
+	lines.append("#endif")
+	lines.append("}")
+	lines.append("")
+	lines.append("")
+	lines.append("// Members beyond the size are from a newer version of vkel")
+	lines.append("#define VKEL_TABLE_MEMBER(pTable, member) ((offsetof(VkelTable, member) < (pTable)->size) ? (pTable)->member : NULL)")
+	lines.append("")
+	lines.append("static void vkelCopyTableProcs(const VkelTable *pTable)")
+	lines.append("{")
+	
+	for func in table_funcs:
+		if func not in all_funcs:
+			continue
+		
+		platform = func_platforms[func]
+		
+		if platform:
+			lines.append("#ifdef " + platform)
+		
+		lines.append("\tvkelTable.{1} = VKEL_TABLE_MEMBER(pTable, {1});".format(func, func[2:]))
+		
+		if platform:
+			lines.append("#endif /* " + platform + " */")
+	
+	lines.append("}")
+	lines.append("")
+	
+	f.write("\n".join(lines).encode("utf-8"))
+	
+	
+	f.write(br'''
+
+static void vkelCopyCapabilityBits(uint32_t *pBits, uint32_t idCount, const uint32_t *pOtherBits, uint32_t otherIdCount)
+{
+	memset(pBits, 0, ((idCount + 31) / 32) * sizeof(uint32_t));
+	
+	if (!pOtherBits)
+		return;
+	
+	uint32_t id = 0;
+	for (id = 0; (id < idCount) && (id < otherIdCount); id++)
+		if (pOtherBits[id / 32] & (1u << (id % 32)))
+			pBits[id / 32] |= 1u << (id % 32);
+}
+
+
+const VkelTable* vkelGetTable(void)
+{
+	return (vkelTable.version == VKEL_TABLE_VERSION) ? &vkelTable : NULL;
+}
+
+VkBool32 vkelInitFromTable(const VkelTable *pTable)
+{
+	if (!pTable || (pTable->version != VKEL_TABLE_VERSION) || (pTable->size < offsetof(VkelTable, pDeviceLayers) + sizeof(pTable->pDeviceLayers)))
+		return VK_FALSE;
+	
+	// Sharing the table with itself
+	if (pTable == &vkelTable)
+		return VK_TRUE;
+	
+	
+	vkelUninit();
+	
+	vkelCopyTableProcs(pTable);
+	
+	vkelCopyCapabilityBits(vkelInstanceCapabilities.extensions, VKEL_EXT_ID_COUNT, pTable->pInstanceExtensions, pTable->extensionIdCount);
+	vkelCopyCapabilityBits(vkelInstanceCapabilities.layers, VKEL_LAYER_ID_COUNT, pTable->pInstanceLayers, pTable->layerIdCount);
+	VkelCapabilities deviceCapabilities;
+	
+	vkelCopyCapabilityBits(deviceCapabilities.extensions, VKEL_EXT_ID_COUNT, pTable->pDeviceExtensions, pTable->extensionIdCount);
+	vkelCopyCapabilityBits(deviceCapabilities.layers, VKEL_LAYER_ID_COUNT, pTable->pDeviceLayers, pTable->layerIdCount);
+	
+	// The device level functions shared are those of the other copy's vkelTable,
+	// as its device table is freed whenever it calls vkelDeviceInit()
+	if (!vkelPublishInstanceDevice(&deviceCapabilities))
+		return VK_FALSE;
+	
+	vkelSourceTable = pTable;
+	
+	vkelUpdateTable();
+	
+	
+	return VK_TRUE;
+}
+
+VkBool32 vkelInitShared(void)
+{
+	PFN_vkelGetSharedTable pfnGetSharedTable = NULL;
+	
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+	pfnGetSharedTable = (PFN_vkelGetSharedTable) GetProcAddress(GetModuleHandleA(NULL), "vkelGetSharedTable");
+#else
+	// The application and everything loaded with RTLD_GLOBAL
+	void *globalHandle = dlopen(NULL, RTLD_LAZY);
+	
+	if (globalHandle)
+	{
+		*(void**) (&pfnGetSharedTable) = dlsym(globalHandle, "vkelGetSharedTable");
+		dlclose(globalHandle);
+	}
+#endif
+	
+	if (pfnGetSharedTable && vkelInitFromTable(pfnGetSharedTable()))
+		return VK_TRUE;
+	
+	return vkelInit();
+}
+
+
+#ifdef VKEL_EXPORT_TABLE
+VKEL_EXPORT const VkelTable* vkelGetSharedTable(void)
+{
+	return vkelGetTable();
+}
+#endif /* VKEL_EXPORT_TABLE */
+
+''')
+	
+	
+	# vkelInitProcs()
+		
+	f.write(br'''
+static VkBool32 vkelInitProcs(void)
+{
+''')
+	
+	
+	lines = []
+	
+	for platform in sorted(platform_funcs):
+		if platform:
+			lines.append("#ifdef " + platform)
+		
+		for func in sorted(platform_funcs[platform]):
+			lines.append("\tvkelTable.{1} = (PFN_{0}) vkelGetProcAddr(\"{0}\");".format(func, func[2:]))
+		
+		if platform:
+			lines.append("#endif /* " + platform + " */")
+		
+		lines.append("")
+	
+	lines.append("")
+	
+	
+	lines.append("\tvkelGetInstanceSupport(&vkelInstanceCapabilities);")
+	lines.append("")
+	lines.append("\tif (!vkelPublishInstanceDevice(NULL))")
+	lines.append("\t\treturn VK_FALSE;")
+	lines.append("")
+	lines.append("#ifdef VKEL_RECORD_USAGE")
+	lines.append("\tvkelRecordUsageProcs();")
+	lines.append("#endif")
+	lines.append("")
+	lines.append("\tvkelUpdateTable();")
+	lines.append("")
+	
+	
+	f.write("\n".join(lines).encode("utf-8"))
+	
+	
+	f.write(br'''
+	
+	return VK_TRUE;
+}
+	''')
+	
+	
+	# vkelInit() and vkelInitDirectICD()
+	
+	f.write(br'''
+VkBool32 vkelInit(void)
+{
+	// Already loaded from the Vulkan library, the functions
+	// and instance level results are all still valid
+	if (vkelVkLibHandle && !vkelIcdGetInstanceProcAddr)
+		return VK_TRUE;
+	
+	vkelUninit();
+	
+	vkelVkLibHandle = vkelPlatformOpenLibrary(VKEL_PLATFORM_LIBRARY_NAME);
+	
+	if (!vkelVkLibHandle)
+		return VK_FALSE;
+	
+	return vkelInitProcs();
+}
+
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+#	define VKEL_PATH_LIST_SEPARATOR ';'
+#else
+#	define VKEL_PATH_LIST_SEPARATOR ':'
+#endif
+
+#define VKEL_MAX_PATH 4096
+
+// Highest loader/ICD interface version vkel knows about, 3 and
+// above means that the ICD creates its own VkSurfaceKHR objects
+#define VKEL_ICD_INTERFACE_VERSION 5
+
+typedef VkResult (VKAPI_PTR *PFN_vkelNegotiateLoaderICDInterfaceVersion)(uint32_t *pVersion);
+
+
+static VkBool32 vkelIsAbsolutePath(const char *path)
+{
+	if ((path[0] == '/') || (path[0] == '\\'))
+		return VK_TRUE;
+	
+	// Windows drive letter, e.g. "C:"
+	if (path[0] && (path[1] == ':'))
+		return VK_TRUE;
+	
+	return VK_FALSE;
+}
+
+// Read "library_path" from an ICD manifest, a relative path is resolved relative
+// to the manifest, while a plain file name is left for the OS to search for
+static VkBool32 vkelReadIcdLibraryPath(const char *pManifestPath, char *pLibraryPath)
+{
+	FILE *file = fopen(pManifestPath, "rb");
+	
+	if (!file)
+		return VK_FALSE;
+	
+	fseek(file, 0, SEEK_END);
+	long size = ftell(file);
+	fseek(file, 0, SEEK_SET);
+	
+	if (size < 1)
+	{
+		fclose(file);
+		return VK_FALSE;
+	}
+	
+	char *manifest = (char*) vkel_malloc((size_t) size + 1, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+	
+	if (!manifest)
+	{
+		fclose(file);
+		return VK_FALSE;
+	}
+	
+	size = (long) fread(manifest, 1, (size_t) size, file);
+	manifest[size] = '\0';
+	
+	fclose(file);
+	
+	
+	VkBool32 found = VK_FALSE;
+	
+	const char *value = strstr(manifest, "\"library_path\"");
+	
+	if (value)
+	{
+		value += sizeof("\"library_path\"") - 1;
+		
+		while ((*value == ' ') || (*value == '\t') || (*value == '\r') || (*value == '\n') || (*value == ':'))
+			value++;
+		
+		if (*value == '"')
+		{
+			value++;
+			
+			size_t length = 0;
+			
+			const char *separator = strrchr(pManifestPath, '/');
+			
+			if (!separator)
+				separator = strrchr(pManifestPath, '\\');
+			
+			const char *slash = value;
+			
+			while (*slash && (*slash != '"') && (*slash != '/') && (*slash != '\\'))
+				slash++;
+			
+			// Relative to the directory containing the manifest
+			if (separator && ((*slash == '/') || (*slash == '\\')) && !vkelIsAbsolutePath(value))
+			{
+				length = (size_t) (separator - pManifestPath) + 1;
+				
+				// A directory that doesn't fit can't be cut short either
+				if (length >= VKEL_MAX_PATH)
+				{
+					vkel_free(manifest);
+					return VK_FALSE;
+				}
+				
+				memcpy(pLibraryPath, pManifestPath, length);
+			}
+			
+			while (*value && (*value != '"') && (length < (VKEL_MAX_PATH - 1)))
+			{
+				// JSON escapes, e.g. "C:\\Windows\\..." and "\/usr\/lib\/..."
+				if ((*value == '\\') && value[1])
+					value++;
+				
+				pLibraryPath[length++] = *value++;
+			}
+			
+			pLibraryPath[length] = '\0';
+			
+			// Stopping anywhere but the closing quote means the path didn't fit
+			found = (*value == '"') && (length > 0);
+		}
+	}
+	
+	vkel_free(manifest);
+	
+	return found;
+}
+
+// Open an ICD library and negotiate the interface version with it
+static void* vkelOpenIcdLibrary(const char *pLibraryPath, PFN_vkGetInstanceProcAddr *pIcdGetInstanceProcAddr)
+{
+	void *handle = vkelPlatformOpenLibrary(pLibraryPath);
+	
+	if (!handle)
+		return NULL;
+	
+	PFN_vkGetInstanceProcAddr icdGetInstanceProcAddr = (PFN_vkGetInstanceProcAddr) vkelPlatformGetProcAddr(handle, "vk_icdGetInstanceProcAddr");
+	
+	if (!icdGetInstanceProcAddr)
+	{
+		vkelPlatformCloseLibrary(handle);
+		return NULL;
+	}
+	
+	PFN_vkelNegotiateLoaderICDInterfaceVersion icdNegotiateLoaderICDInterfaceVersion = (PFN_vkelNegotiateLoaderICDInterfaceVersion) vkelPlatformGetProcAddr(handle, "vk_icdNegotiateLoaderICDInterfaceVersion");
+	
+	if (icdNegotiateLoaderICDInterfaceVersion)
+	{
+		uint32_t version = VKEL_ICD_INTERFACE_VERSION;
+		
+		if (icdNegotiateLoaderICDInterfaceVersion(&version) != VK_SUCCESS)
+		{
+			vkelPlatformCloseLibrary(handle);
+			return NULL;
+		}
+	}
+	
+	*pIcdGetInstanceProcAddr = icdGetInstanceProcAddr;
+	
+	return handle;
+}
+
+static VkBool32 vkelOpenIcd(const char *pManifestPath)
+{
+	char libraryPath[VKEL_MAX_PATH];
+	
+	if (!vkelReadIcdLibraryPath(pManifestPath, libraryPath))
+		return VK_FALSE;
+	
+	PFN_vkGetInstanceProcAddr icdGetInstanceProcAddr = NULL;
+	
+	void *handle = vkelOpenIcdLibrary(libraryPath, &icdGetInstanceProcAddr);
+	
+	if (!handle)
+		return VK_FALSE;
+	
+	vkelVkLibHandle = handle;
+	vkelIcdGetInstanceProcAddr = icdGetInstanceProcAddr;
+	
+	return VK_TRUE;
+}
+
+typedef VkBool32 (*PFN_vkelVisitPath)(const char *pPath, void *pUserData);
+
+// Visit each path of a VKEL_PATH_LIST_SEPARATOR separated list, until pfnVisit returns VK_TRUE
+static VkBool32 vkelVisitPathList(const char *pPaths, PFN_vkelVisitPath pfnVisit, void *pUserData)
+{
+	char path[VKEL_MAX_PATH];
+	
+	while (*pPaths)
+	{
+		size_t length = 0;
+		VkBool32 truncated = VK_FALSE;
+		
+		while (*pPaths && (*pPaths != VKEL_PATH_LIST_SEPARATOR))
+		{
+			if (length < (VKEL_MAX_PATH - 1))
+				path[length++] = *pPaths;
+			else
+				truncated = VK_TRUE;
+			
+			pPaths++;
+		}
+		
+		path[length] = '\0';
+		
+		if (*pPaths)
+			pPaths++;
+		
+		// Paths that don't fit are skipped, rather than visiting some other path they were cut to
+		if ((length > 0) && !truncated && pfnVisit(path, pUserData))
+			return VK_TRUE;
+	}
+	
+	return VK_FALSE;
+}
+
+// Visit each ICD manifest in a directory, until pfnVisit returns VK_TRUE
+static VkBool32 vkelVisitIcdDirectory(const char *pDirectory, PFN_vkelVisitPath pfnVisit, void *pUserData)
+{
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+	// ICDs are registered in the registry on Windows, use VK_ICD_FILENAMES
+	(void) pDirectory;
+	(void) pfnVisit;
+	(void) pUserData;
+	
+	return VK_FALSE;
+#else
+	DIR *directory = opendir(pDirectory);
+	
+	if (!directory)
+		return VK_FALSE;
+	
+	VkBool32 done = VK_FALSE;
+	
+	char manifestPath[VKEL_MAX_PATH];
+	
+	struct dirent *entry;
+	while (!done && (entry = readdir(directory)))
+	{
+		size_t length = strlen(entry->d_name);
+		
+		if ((length < 5) || strcmp(entry->d_name + length - 5, ".json"))
+			continue;
+		
+		if (snprintf(manifestPath, VKEL_MAX_PATH, "%s/%s", pDirectory, entry->d_name) >= VKEL_MAX_PATH)
+			continue;
+		
+		done = pfnVisit(manifestPath, pUserData);
+	}
+	
+	closedir(directory);
+	
+	return done;
+#endif
+}
+
+static VkBool32 vkelVisitOpenIcd(const char *pManifestPath, void *pUserData)
+{
+	(void) pUserData;
+	
+	return vkelOpenIcd(pManifestPath);
+}
+
+
+VkBool32 vkelInitDirectICD(const char *pManifestPath)
+{
+	vkelUninit();
+	
+	VkBool32 opened = VK_FALSE;
+	
+	if (pManifestPath)
+		opened = vkelOpenIcd(pManifestPath);
+	else
+	{
+		// Same as the Vulkan loader, VK_ICD_FILENAMES replaces the search
+		const char *icdFilenames = getenv("VK_ICD_FILENAMES");
+		
+		if (icdFilenames)
+			opened = vkelVisitPathList(icdFilenames, vkelVisitOpenIcd, NULL);
+		else
+			opened = vkelVisitIcdDirectory("/usr/share/vulkan/icd.d", vkelVisitOpenIcd, NULL) || vkelVisitIcdDirectory("/etc/vulkan/icd.d", vkelVisitOpenIcd, NULL);
+	}
+	
+	if (!opened)
+		return VK_FALSE;
+	
+	return vkelInitProcs();
+}
+	''')
+	
+	
+	# vkelInstanceInit()
+		
+	f.write(br'''
+VkBool32 vkelInstanceInit(VkInstance instance)
+{
+	if (!vkelVkLibHandle && !vkelSourceTable && !vkelInit())
+		return VK_FALSE;
+	
+	
+''')
+	
+	
+	lines = []
+	
+	for platform in sorted(platform_funcs):
+		if platform:
+			lines.append("#ifdef " + platform)
+		
+		for func in sorted(platform_funcs[platform]):
+			lines.append("\tvkelTable.{1} = (PFN_{0}) vkelGetInstanceProcAddr(instance, \"{0}\");".format(func, func[2:]))
+		
+		if platform:
+			lines.append("#endif /* " + platform + " */")
+		
+		lines.append("")
+	
+	lines.append("")
+	
+	
+	# The supported instance extensions and layers don't depend on the instance,
+	# so the ones enumerated by vkelInit() are kept
+	lines.append("\tvkelInvalidatePhysicalDeviceEnumerations();")
+	lines.append("")
+	lines.append("\t// Goes back to the device level functions just loaded, which work with any device")
+	lines.append("\tif (!vkelPublishInstanceDevice(NULL))")
+	lines.append("\t\treturn VK_FALSE;")
+	lines.append("")
+	lines.append("#ifdef VKEL_RECORD_USAGE")
+	lines.append("\tvkelRecordUsageProcs();")
+	lines.append("#endif")
+	lines.append("")
+	lines.append("\tvkelUpdateTable();")
+	lines.append("")
+	
+	
+	f.write("\n".join(lines).encode("utf-8"))
+	
+	
+	f.write(br'''
+	
+	return VK_TRUE;
+}
+	''')
+	
+	
+	# vkelDeviceInit()
+	
+	f.write(br'''
+VkBool32 vkelDeviceInit(VkPhysicalDevice physicalDevice, VkDevice device)
+{
+	if (!vkelVkLibHandle && !vkelSourceTable && !vkelInit())
+		return VK_FALSE;
+	
+	
+	// The new table is built off to the side, so threads still calling through the
+	// current one (like after VK_ERROR_DEVICE_LOST) never see it partially loaded
+	VkelDevice *entry = vkelCreateDeviceEntry();
+	
+	if (!entry)
+		return VK_FALSE;
+	
+	entry->physicalDevice = physicalDevice;
+	entry->device = device;
+	
+	
+''')
+	
+	
+	lines = []
+	
+	lines.append("\t// Instance level functions are kept, so recreating a device only reloads the device level functions")
+	
+	for platform in sorted(platform_funcs):
+		platform_device_funcs = [func for func in sorted(platform_funcs[platform]) if func in device_funcs]
+		
+		if not platform_device_funcs:
+			continue
+		
+		if platform:
+			lines.append("#ifdef " + platform)
+		
+		for func in platform_device_funcs:
+			lines.append("\tentry->table.{1} = (PFN_{0}) vkelGetDeviceProcAddr(device, \"{0}\");".format(func, func[2:]))
+		
+		if platform:
+			lines.append("#endif /* " + platform + " */")
+		
+		lines.append("")
+	
+	lines.append("")
+	
+	
+	lines.append("\t// Enumerated only once per physical device, so recreating a device")
+	lines.append("\t// (like after VK_ERROR_DEVICE_LOST) doesn't enumerate again")
+	lines.append("\tvkelGetPhysicalDeviceCapabilities(physicalDevice, &entry->capabilities);")
+	lines.append("\t")
+	lines.append("\t// Instead of updating vkelTable, whose device level members keep the functions loaded")
+	lines.append("\t// by vkelInit()/vkelInstanceInit(), the vk* macros go to the new table all at once")
+	lines.append("\tvkelPublishDevice(entry);")
+	lines.append("")
+	
+	
+	f.write("\n".join(lines).encode("utf-8"))
+	
+	
+	f.write(br'''
+	
+	return VK_TRUE;
+}
+	''')
+	
+	
+	# Device registry
+	
+	lines = []
+	
+	lines.append("")
+	lines.append("")
+	lines.append("static void vkelLoadDeviceTable(VkelDeviceTable *pTable, VkDevice device)")
+	lines.append("{")
+	
+	for func in device_funcs:
+		platform = func_platforms[func]
+		
+		if platform:
+			lines.append("#ifdef " + platform)
+		
+		lines.append("\tpTable->{1} = (PFN_{0}) vkGetDeviceProcAddr(device, \"{0}\");".format(func, func[2:]))
+		
+		if platform:
+			lines.append("#endif /* " + platform + " */")
+	
+	lines.append("")
+	lines.append("#ifdef VKEL_FALLBACK_STUBS")
+	lines.append("\tvkelFillStubs(pTable, vkelDeviceStubs, sizeof(vkelDeviceStubs) / sizeof(vkelDeviceStubs[0]));")
+	lines.append("#endif")
+	lines.append("}")
+	
+	f.write("\n".join(lines).encode("utf-8"))
+	
+	
+	f.write(br'''
+
+#if (VKEL_MAX_DEVICES & (VKEL_MAX_DEVICES - 1)) != 0
+#	error VKEL_MAX_DEVICES must be a power of two
+#endif
+
+// Kept at most half full. Readers never lock, while registering
+// and unregistering is serialized by vkelDeviceRegistryMutex.
+VkelDeviceSlot vkelDeviceSlots[VKEL_DEVICE_SLOT_COUNT];
+static uint32_t vkelDeviceCount;
+
+static VkelPlatformMutex vkelDeviceRegistryMutex = VKEL_PLATFORM_MUTEX_INITIALIZER;
+
+static char vkelRemovedDeviceKey;
+
+static VkelDeviceSlot* vkelFindDeviceSlot(const void *key)
+{
+	uint32_t slotIndex = vkelHashDeviceKey(key);
+	
+	uint32_t probeCount = 0;
+	for (probeCount = 0; probeCount < VKEL_DEVICE_SLOT_COUNT; probeCount++)
+	{
+		VkelDeviceSlot *slot = &vkelDeviceSlots[slotIndex];
+		
+		void *slotKey = vkelAtomicLoadPointer(&slot->key);
+		
+		if (slotKey == key)
+			return slot;
+		
+		if (!slotKey)
+			break;
+		
+		slotIndex = (slotIndex + 1) & (VKEL_DEVICE_SLOT_COUNT - 1);
+	}
+	
+	return NULL;
+}
+
+
+// Removed slots would otherwise pile up until every miss probes the whole table. One
+// that no registered device is probed past can be made unused again, without readers
+// noticing. Called with vkelDeviceRegistryMutex held, with the index of a removed slot.
+static void vkelClearRemovedDeviceSlots(uint32_t slotIndex)
+{
+	const uint32_t slotMask = VKEL_DEVICE_SLOT_COUNT - 1;
+	
+	// Go to the last used slot of the run this slot is in
+	uint32_t probeCount = 0;
+	while (vkelDeviceSlots[(slotIndex + 1) & slotMask].key && (++probeCount < VKEL_DEVICE_SLOT_COUNT))
+		slotIndex = (slotIndex + 1) & slotMask;
+	
+	// Then check the removed slots of the run back to front, as clearing
+	// one ends the run for the removed slots in front of it
+	for (probeCount = 0; vkelDeviceSlots[slotIndex].key && (probeCount < VKEL_DEVICE_SLOT_COUNT); probeCount++)
+	{
+		if (vkelDeviceSlots[slotIndex].key == &vkelRemovedDeviceKey)
+		{
+			VkBool32 probedPast = VK_FALSE;
+			
+			uint32_t nextIndex = (slotIndex + 1) & slotMask;
+			
+			for (; vkelDeviceSlots[nextIndex].key && (nextIndex != slotIndex); nextIndex = (nextIndex + 1) & slotMask)
+			{
+				void *key = vkelDeviceSlots[nextIndex].key;
+				
+				// Found by probing from its hash, so it's probed past
+				// this slot when its hash comes at or before it
+				if ((key != &vkelRemovedDeviceKey) && (((nextIndex - vkelHashDeviceKey(key)) & slotMask) >= ((nextIndex - slotIndex) & slotMask)))
+				{
+					probedPast = VK_TRUE;
+					break;
+				}
+			}
+			
+			if (!probedPast)
+				vkelAtomicStorePointer(&vkelDeviceSlots[slotIndex].key, NULL);
+		}
+		
+		slotIndex = (slotIndex - 1) & slotMask;
+	}
+}
+
+
+const VkelDevice* vkelGetDispatchableDevice(const void *dispatchableHandle)
+{
+	if (!dispatchableHandle)
+		return NULL;
+	
+	VkelDeviceSlot *slot = vkelFindDeviceSlot(vkelGetDispatchKey(dispatchableHandle));
+	
+	if (!slot)
+		return NULL;
+	
+	return (const VkelDevice*) vkelAtomicLoadPointer(&slot->entry);
+}
+
+const VkelDevice* vkelGetDevice(VkDevice device)
+{
+	return vkelGetDispatchableDevice(device);
+}
+
+
+const VkelDevice* vkelRegisterDevice(VkPhysicalDevice physicalDevice, VkDevice device)
+{
+	assert(device);
+	
+	
+	const VkelDevice *existing = vkelGetDevice(device);
+	
+	// Without the loader (vkelInitDirectICD()) the key is the ICD's
+	// magic value, so only a single device can be registered
+	if (existing)
+		return (existing->device == device) ? existing : NULL;
+	
+	
+	void *key = vkelGetDispatchKey(device);
+	
+	
+	// Everything slow happens before taking the lock, so other
+	// registrations only wait for the slot to be published
+	VkelDevice *entry = vkelCreateDeviceEntry();
+	
+	if (!entry)
+		return NULL;
+	
+	entry->physicalDevice = physicalDevice;
+	entry->device = device;
+	
+	vkelGetPhysicalDeviceCapabilities(physicalDevice, &entry->capabilities);
+	vkelLoadDeviceTable(&entry->table, device);
+	
+#ifdef VKEL_RECORD_USAGE
+	// For threads binding the device (see vkelBindDevice())
+	vkelRecordDeviceUsageProcs(&entry->table, (VkelDeviceTable*) (entry + 1));
+#endif
+	
+	
+	vkelPlatformLockMutex(&vkelDeviceRegistryMutex);
+	
+	VkelDeviceSlot *slot = vkelFindDeviceSlot(key);
+	
+	if (slot)
+	{
+		// Registered by another thread in the meantime
+		vkelPlatformUnlockMutex(&vkelDeviceRegistryMutex);
+		
+		vkel_free(entry);
+		
+		existing = (const VkelDevice*) vkelAtomicLoadPointer(&slot->entry);
+		
+		return (existing->device == device) ? existing : NULL;
+	}
+	
+	if (vkelDeviceCount >= VKEL_MAX_DEVICES)
+	{
+		vkelPlatformUnlockMutex(&vkelDeviceRegistryMutex);
+		
+		vkel_free(entry);
+		
+		return NULL;
+	}
+	
+	uint32_t slotIndex = vkelHashDeviceKey(key);
+	
+	while (vkelDeviceSlots[slotIndex].key && (vkelDeviceSlots[slotIndex].key != &vkelRemovedDeviceKey))
+		slotIndex = (slotIndex + 1) & (VKEL_DEVICE_SLOT_COUNT - 1);
+	
+	slot = &vkelDeviceSlots[slotIndex];
+	
+	// The entry is published before the key, so a reader
+	// finding the key always finds a complete entry
+	vkelAtomicStorePointer(&slot->entry, entry);
+	vkelAtomicStorePointer(&slot->key, key);
+	
+	vkelDeviceCount++;
+	
+	vkelPlatformUnlockMutex(&vkelDeviceRegistryMutex);
+	
+	
+	return entry;
+}
+
+void vkelUnregisterDevice(VkDevice device)
+{
+	if (!device)
+		return;
+	
+	
+	vkelPlatformLockMutex(&vkelDeviceRegistryMutex);
+	
+	VkelDeviceSlot *slot = vkelFindDeviceSlot(vkelGetDispatchKey(device));
+	
+	VkelDevice *entry = NULL;
+	
+	if (slot)
+	{
+		entry = (VkelDevice*) slot->entry;
+		
+		// Removed keys keep probing going for other devices
+		vkelAtomicStorePointer(&slot->key, &vkelRemovedDeviceKey);
+		vkelAtomicStorePointer(&slot->entry, NULL);
+		
+		vkelDeviceCount--;
+		
+		vkelClearRemovedDeviceSlots((uint32_t) (slot - vkelDeviceSlots));
+	}
+	
+	vkelPlatformUnlockMutex(&vkelDeviceRegistryMutex);
+	
+	
+	// Other threads may still be calling through it
+	vkelRetire(entry);
+}
+	''')
+	
+	
+	f.write(br'''
+void vkelUninit(void)
+{
+	if (vkelVkLibHandle)
+	{
+		vkelPlatformCloseLibrary(vkelVkLibHandle);
+		vkelVkLibHandle = NULL;
+	}
+	
+	vkelIcdGetInstanceProcAddr = NULL;
+	
+	vkelSourceTable = NULL;
+	
+	vkelTable.version = 0;
+	
+	vkelPublishDevice(NULL);
+	vkelReclaimAll();
+	
+	vkelInvalidateAllEnumerations();
+}
+
+
+struct VkelTask_T
+{
+	VkBool32 (*pfnTask)(void *pUserData);
+	void *pUserData;
+	
+	VkBool32 result;
+	
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+	HANDLE thread;
+#else
+	pthread_t thread;
+	pthread_mutex_t mutex;
+	VkBool32 complete;
+#endif
+};
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+static DWORD WINAPI vkelTaskMain(LPVOID pTask)
+#else
+static void* vkelTaskMain(void *pTask)
+#endif
+{
+	VkelTask task = (VkelTask) pTask;
+	
+	VkBool32 result = task->pfnTask(task->pUserData);
+	
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+	task->result = result;
+	
+	return 0;
+#else
+	pthread_mutex_lock(&task->mutex);
+	task->result = result;
+	task->complete = VK_TRUE;
+	pthread_mutex_unlock(&task->mutex);
+	
+	return NULL;
+#endif
+}
+
+static VkelTask vkelStartTask(VkBool32 (*pfnTask)(void *pUserData), void *pUserData)
+{
+	VkelTask task = (VkelTask) vkel_calloc(1, sizeof(struct VkelTask_T), VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+	
+	if (!task)
+		return NULL;
+	
+	task->pfnTask = pfnTask;
+	task->pUserData = pUserData;
+	
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+	task->thread = CreateThread(NULL, 0, vkelTaskMain, task, 0, NULL);
+	
+	if (!task->thread)
+	{
+		vkel_free(task);
+		return NULL;
+	}
+#else
+	pthread_mutex_init(&task->mutex, NULL);
+	
+	if (pthread_create(&task->thread, NULL, vkelTaskMain, task))
+	{
+		pthread_mutex_destroy(&task->mutex);
+		vkel_free(task);
+		return NULL;
+	}
+#endif
+	
+	return task;
+}
+
+
+VkBool32 vkelIsTaskComplete(VkelTask task)
+{
+	assert(task);
+	
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+	return (WaitForSingleObject(task->thread, 0) == WAIT_OBJECT_0) ? VK_TRUE : VK_FALSE;
+#else
+	pthread_mutex_lock(&task->mutex);
+	VkBool32 complete = task->complete;
+	pthread_mutex_unlock(&task->mutex);
+	
+	return complete;
+#endif
+}
+
+VkBool32 vkelWaitTask(VkelTask task)
+{
+	if (!task)
+		return VK_FALSE;
+	
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+	WaitForSingleObject(task->thread, INFINITE);
+	CloseHandle(task->thread);
+#else
+	pthread_join(task->thread, NULL);
+	pthread_mutex_destroy(&task->mutex);
+#endif
+	
+	VkBool32 result = task->result;
+	
+	vkel_free(task);
+	
+	return result;
+}
+
+
+static VkBool32 vkelInitTask(void *pUserData)
+{
+	(void) pUserData;
+	
+	return vkelInit();
+}
+
+VkelTask vkelInitAsync(void)
+{
+	return vkelStartTask(vkelInitTask, NULL);
+}
+
+
+static VkelPlatformMutex vkelPrewarmMutex = VKEL_PLATFORM_MUTEX_INITIALIZER;
+static VkelPrewarmStats vkelPrewarmStats;
+
+static uint64_t vkelGetNanoseconds(void)
+{
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+	LARGE_INTEGER frequency, counter;
+	
+	QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&counter);
+	
+	return (uint64_t) ((double) counter.QuadPart * (1000000000.0 / (double) frequency.QuadPart));
+#else
+	struct timespec now;
+	
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	
+	return (uint64_t) now.tv_sec * 1000000000u + (uint64_t) now.tv_nsec;
+#endif
+}
+
+static VkBool32 vkelPrewarmFile(const char *pPath)
+{
+	uint64_t size = 0;
+	
+#if !defined(VK_USE_PLATFORM_WIN32_KHR) && defined(POSIX_FADV_WILLNEED)
+	int fd = open(pPath, O_RDONLY);
+	
+	if (fd < 0)
+		return VK_FALSE;
+	
+	struct stat status;
+	
+	if (fstat(fd, &status) || !S_ISREG(status.st_mode))
+	{
+		close(fd);
+		return VK_FALSE;
+	}
+	
+	// Starts reading the whole file in the background, without mapping it or waiting for it
+	posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+	close(fd);
+	
+	size = (uint64_t) status.st_size;
+#else
+	FILE *file = fopen(pPath, "rb");
+	
+	if (!file)
+		return VK_FALSE;
+	
+	// Without a readahead hint, reading it through is what gets it into the cache
+	char *buffer = (char*) vkel_malloc(65536, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+	
+	if (buffer)
+	{
+		size_t count;
+		
+		while ((count = fread(buffer, 1, 65536, file)) > 0)
+			size += count;
+		
+		vkel_free(buffer);
+	}
+	
+	fclose(file);
+#endif
+	
+	vkelPlatformLockMutex(&vkelPrewarmMutex);
+	
+	vkelPrewarmStats.fileCount++;
+	vkelPrewarmStats.byteCount += size;
+	
+	vkelPlatformUnlockMutex(&vkelPrewarmMutex);
+	
+	
+	return VK_TRUE;
+}
+
+static VkBool32 vkelPrewarmLibraryInDirectory(const char *pDirectory, void *pName)
+{
+	char path[VKEL_MAX_PATH];
+	
+	if (snprintf(path, VKEL_MAX_PATH, "%s/%s", pDirectory, (const char*) pName) >= VKEL_MAX_PATH)
+		return VK_FALSE;
+	
+	return vkelPrewarmFile(path);
+}
+
+// Searched like the OS would when loading it
+static VkBool32 vkelPrewarmLibrary(const char *pName)
+{
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+	char path[VKEL_MAX_PATH];
+	
+	DWORD length = SearchPathA(NULL, pName, NULL, VKEL_MAX_PATH, path, NULL);
+	
+	if (!length || (length >= VKEL_MAX_PATH))
+		return VK_FALSE;
+	
+	return vkelPrewarmFile(path);
+#else
+	// The dynamic linker's cache (ld.so.cache) isn't read, the usual directories are searched instead
+	static const char* const directories[] = {
+#	if defined(__linux__) && defined(__x86_64__)
+		"/usr/lib/x86_64-linux-gnu",
+#	elif defined(__linux__) && defined(__aarch64__)
+		"/usr/lib/aarch64-linux-gnu",
+#	endif
+		"/usr/local/lib",
+		"/usr/lib64",
+		"/usr/lib",
+		"/lib64",
+		"/lib",
+	};
+	
+	if (strchr(pName, '/'))
+		return vkelPrewarmFile(pName);
+	
+	const char *libraryPaths = getenv("LD_LIBRARY_PATH");
+	
+	if (libraryPaths && vkelVisitPathList(libraryPaths, vkelPrewarmLibraryInDirectory, (void*) pName))
+		return VK_TRUE;
+	
+	uint32_t i;
+	
+	for (i = 0; i < (sizeof(directories) / sizeof(directories[0])); ++i)
+		if (vkelPrewarmLibraryInDirectory(directories[i], (void*) pName))
+			return VK_TRUE;
+	
+	return VK_FALSE;
+#endif
+}
+
+static VkBool32 vkelPrewarmIcd(const char *pManifestPath, void *pPrewarmed)
+{
+	char libraryPath[VKEL_MAX_PATH];
+	
+	if (vkelReadIcdLibraryPath(pManifestPath, libraryPath) && vkelPrewarmLibrary(libraryPath))
+		*(VkBool32*) pPrewarmed = VK_TRUE;
+	
+	// Every ICD is prewarmed, as it isn't known which one will be used
+	return VK_FALSE;
+}
+
+VkBool32 vkelPrewarm(void)
+{
+	uint64_t start = vkelGetNanoseconds();
+	
+	VkBool32 prewarmed = vkelPrewarmLibrary(VKEL_PLATFORM_LIBRARY_NAME);
+	
+	const char *icdFilenames = getenv("VK_ICD_FILENAMES");
+	
+	if (icdFilenames)
+		vkelVisitPathList(icdFilenames, vkelPrewarmIcd, &prewarmed);
+	else
+	{
+		vkelVisitIcdDirectory("/usr/share/vulkan/icd.d", vkelPrewarmIcd, &prewarmed);
+		vkelVisitIcdDirectory("/etc/vulkan/icd.d", vkelPrewarmIcd, &prewarmed);
+	}
+	
+	uint64_t elapsed = vkelGetNanoseconds() - start;
+	
+	vkelPlatformLockMutex(&vkelPrewarmMutex);
+	vkelPrewarmStats.nanoseconds += elapsed;
+	vkelPlatformUnlockMutex(&vkelPrewarmMutex);
+	
+	
+	return prewarmed;
+}
+
+static VkBool32 vkelPrewarmTask(void *pUserData)
+{
+	(void) pUserData;
+	
+	return vkelPrewarm();
+}
+
+VkelTask vkelPrewarmAsync(void)
+{
+	return vkelStartTask(vkelPrewarmTask, NULL);
+}
+
+void vkelGetPrewarmStats(VkelPrewarmStats *pStats)
+{
+	assert(pStats);
+	
+	vkelPlatformLockMutex(&vkelPrewarmMutex);
+	*pStats = vkelPrewarmStats;
+	vkelPlatformUnlockMutex(&vkelPrewarmMutex);
+}
+	''')
+	
+	
+	# Contexts
+	
+	f.write(br'''
+
+struct VkelContext_T
+{
+	void *libraryHandle;
+	PFN_vkGetInstanceProcAddr getInstanceProcAddr;
+	VkInstance instance;
+	
+	VkelTable table;
+	
+	VkelCapabilities instanceCapabilities;
+	VkelCapabilities deviceCapabilities;
+};
+
+static VkBool32 vkelHasSuffix(const char *pString, const char *pSuffix)
+{
+	size_t length = strlen(pString);
+	size_t suffixLength = strlen(pSuffix);
+	
+	return ((length >= suffixLength) && !strcmp(pString + length - suffixLength, pSuffix)) ? VK_TRUE : VK_FALSE;
+}
+
+static VkResult vkelEnumerateContextExtensions(VkelContext context, VkPhysicalDevice physicalDevice, uint32_t *pCount, VkExtensionProperties *pProperties)
+{
+	if (physicalDevice)
+		return context->table.EnumerateDeviceExtensionProperties ? context->table.EnumerateDeviceExtensionProperties(physicalDevice, NULL, pCount, pProperties) : VK_ERROR_INITIALIZATION_FAILED;
+	
+	return context->table.EnumerateInstanceExtensionProperties ? context->table.EnumerateInstanceExtensionProperties(NULL, pCount, pProperties) : VK_ERROR_INITIALIZATION_FAILED;
+}
+
+static VkResult vkelEnumerateContextLayers(VkelContext context, VkPhysicalDevice physicalDevice, uint32_t *pCount, VkLayerProperties *pProperties)
+{
+	if (physicalDevice)
+		return context->table.EnumerateDeviceLayerProperties ? context->table.EnumerateDeviceLayerProperties(physicalDevice, pCount, pProperties) : VK_ERROR_INITIALIZATION_FAILED;
+	
+	return context->table.EnumerateInstanceLayerProperties ? context->table.EnumerateInstanceLayerProperties(pCount, pProperties) : VK_ERROR_INITIALIZATION_FAILED;
+}
+
+// The instance support for VK_NULL_HANDLE. Not cached, as the enumeration cache belongs to vkelTable.
+static void vkelGetContextSupport(VkelContext context, VkPhysicalDevice physicalDevice, VkelCapabilities *pCapabilities)
+{
+	memset(pCapabilities, 0, sizeof(VkelCapabilities));
+	
+	
+	uint32_t extPropertyCount = 0;
+	
+	if (vkelEnumerateContextExtensions(context, physicalDevice, &extPropertyCount, NULL) == VK_SUCCESS)
+	{
+		VkExtensionProperties *extProperties = (VkExtensionProperties*) vkel_calloc(extPropertyCount + 1, sizeof(VkExtensionProperties), VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+		
+		if (extProperties && (vkelEnumerateContextExtensions(context, physicalDevice, &extPropertyCount, extProperties) >= VK_SUCCESS))
+			vkelMapExtensions(pCapabilities, extPropertyCount, extProperties);
+		
+		vkel_free(extProperties);
+	}
+	
+	
+	uint32_t layerPropertyCount = 0;
+	
+	if (vkelEnumerateContextLayers(context, physicalDevice, &layerPropertyCount, NULL) == VK_SUCCESS)
+	{
+		VkLayerProperties *layerProperties = (VkLayerProperties*) vkel_calloc(layerPropertyCount + 1, sizeof(VkLayerProperties), VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+		
+		if (layerProperties && (vkelEnumerateContextLayers(context, physicalDevice, &layerPropertyCount, layerProperties) >= VK_SUCCESS))
+			vkelMapLayers(pCapabilities, layerPropertyCount, layerProperties);
+		
+		vkel_free(layerProperties);
+	}
+}
+
+static void vkelUpdateContextTable(VkelContext context)
+{
+	VkelTable *pTable = &context->table;
+	
+	pTable->version = VKEL_TABLE_VERSION;
+	pTable->size = sizeof(VkelTable);
+	
+	pTable->extensionIdCount = VKEL_EXT_ID_COUNT;
+	pTable->layerIdCount = VKEL_LAYER_ID_COUNT;
+	
+	pTable->pInstanceExtensions = context->instanceCapabilities.extensions;
+	pTable->pInstanceLayers = context->instanceCapabilities.layers;
+	pTable->pDeviceExtensions = context->deviceCapabilities.extensions;
+	pTable->pDeviceLayers = context->deviceCapabilities.layers;
+}
+
+static PFN_vkVoidFunction vkelGetContextDeviceProcAddr(VkelContext context, VkDevice device, const char *pName)
+{
+	PFN_vkVoidFunction proc = context->table.GetDeviceProcAddr ? (PFN_vkVoidFunction) context->table.GetDeviceProcAddr(device, pName) : NULL;
+	
+	if (!proc)
+		proc = context->getInstanceProcAddr(context->instance, pName);
+	
+	return proc;
+}
+
+''')
+	
+	
+	lines = []
+	
+	lines.append("// Load every function the implementation has for the instance, or the global ones for VK_NULL_HANDLE")
+	lines.append("static void vkelLoadContextTable(VkelContext context)")
+	lines.append("{")
+	lines.append("\tVkelTable *pTable = &context->table;")
+	lines.append("\t")
+	
+	for platform in sorted(platform_funcs):
+		if platform:
+			lines.append("#ifdef " + platform)
+		
+		for func in sorted(platform_funcs[platform]):
+			lines.append("\tpTable->{1} = (PFN_{0}) context->getInstanceProcAddr(context->instance, \"{0}\");".format(func, func[2:]))
+		
+		if platform:
+			lines.append("#endif /* " + platform + " */")
+		
+		lines.append("")
+	
+	lines.append("\t// ICDs don't necessarily hand out their own vkGetInstanceProcAddr")
+	lines.append("\tpTable->GetInstanceProcAddr = context->getInstanceProcAddr;")
+	lines.append("}")
+	lines.append("")
+	lines.append("static void vkelLoadContextDeviceTable(VkelContext context, VkDevice device)")
+	lines.append("{")
+	lines.append("\tVkelTable *pTable = &context->table;")
+	lines.append("\t")
+	
+	for platform in sorted(platform_funcs):
+		platform_device_funcs = [func for func in sorted(platform_funcs[platform]) if func in device_funcs]
+		
+		if not platform_device_funcs:
+			continue
+		
+		if platform:
+			lines.append("#ifdef " + platform)
+		
+		for func in platform_device_funcs:
+			lines.append("\tpTable->{1} = (PFN_{0}) vkelGetContextDeviceProcAddr(context, device, \"{0}\");".format(func, func[2:]))
+		
+		if platform:
+			lines.append("#endif /* " + platform + " */")
+		
+		lines.append("")
+	
+	lines.append("}")
+	lines.append("")
+	lines.append("")
+	
+	f.write("\n".join(lines).encode("utf-8"))
+	
+	
+	f.write(br'''VkelContext vkelCreateContext(const char *pPath)
+{
+	assert(pPath);
+	
+	VkelContext context = (VkelContext) vkel_calloc(1, sizeof(struct VkelContext_T), VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+	
+	if (!context)
+		return NULL;
+	
+	char libraryPath[VKEL_MAX_PATH];
+	
+	if (vkelHasSuffix(pPath, ".json"))
+	{
+		if (vkelReadIcdLibraryPath(pPath, libraryPath))
+			context->libraryHandle = vkelOpenIcdLibrary(libraryPath, &context->getInstanceProcAddr);
+	}
+	else
+	{
+		// Either an ICD, or a loader which exports vkGetInstanceProcAddr like any other function
+		context->libraryHandle = vkelOpenIcdLibrary(pPath, &context->getInstanceProcAddr);
+		
+		if (!context->libraryHandle)
+		{
+			context->libraryHandle = vkelPlatformOpenLibrary(pPath);
+			
+			if (context->libraryHandle)
+				context->getInstanceProcAddr = (PFN_vkGetInstanceProcAddr) vkelPlatformGetProcAddr(context->libraryHandle, "vkGetInstanceProcAddr");
+		}
+	}
+	
+	if (!context->libraryHandle || !context->getInstanceProcAddr)
+	{
+		if (context->libraryHandle)
+			vkelPlatformCloseLibrary(context->libraryHandle);
+		
+		vkel_free(context);
+		
+		return NULL;
+	}
+	
+	
+	vkelLoadContextTable(context);
+	
+	vkelGetContextSupport(context, VK_NULL_HANDLE, &context->instanceCapabilities);
+	vkelUpdateContextTable(context);
+	
+	
+	return context;
+}
+
+VkBool32 vkelContextInstanceInit(VkelContext context, VkInstance instance)
+{
+	assert(context);
+	
+	context->instance = instance;
+	
+	vkelLoadContextTable(context);
+	
+	// The supported instance extensions and layers don't depend on the instance
+	memset(&context->deviceCapabilities, 0, sizeof(VkelCapabilities));
+	
+	
+	return VK_TRUE;
+}
+
+VkBool32 vkelContextDeviceInit(VkelContext context, VkPhysicalDevice physicalDevice, VkDevice device)
+{
+	assert(context);
+	
+	if (!context->instance)
+		return VK_FALSE;
+	
+	vkelLoadContextDeviceTable(context, device);
+	
+	vkelGetContextSupport(context, physicalDevice, &context->deviceCapabilities);
+	
+	
+	return VK_TRUE;
+}
+
+void vkelDestroyContext(VkelContext context)
+{
+	if (!context)
+		return;
+	
+	vkelPlatformCloseLibrary(context->libraryHandle);
+	
+	vkel_free(context);
+}
+
+const VkelTable* vkelGetContextTable(VkelContext context)
+{
+	assert(context);
+	
+	return &context->table;
+}
+
+const VkelCapabilities* vkelGetContextInstanceCapabilities(VkelContext context)
+{
+	assert(context);
+	
+	return &context->instanceCapabilities;
+}
+
+const VkelCapabilities* vkelGetContextDeviceCapabilities(VkelContext context)
+{
+	assert(context);
+	
+	return &context->deviceCapabilities;
+}
+
+
+typedef struct VkelProbeJob
+{
+	uint32_t physicalDeviceCount;
+	const VkPhysicalDevice *pPhysicalDevices;
+	VkelPhysicalDeviceProbe *pProbes;
+	
+	// The next physical device to probe, shared by the threads
+	volatile uint64_t nextIndex;
+	
+	// Every function the probing threads call, taken from vkelTable on the calling thread.
+	// vkelInstanceInit() can be loading vkelTable meanwhile, so the threads never read it.
+	VkelEnumerateProcs enumerateProcs;
+	PFN_vkGetPhysicalDeviceProperties getPhysicalDeviceProperties;
+	PFN_vkGetPhysicalDeviceMemoryProperties getPhysicalDeviceMemoryProperties;
+	PFN_vkGetPhysicalDeviceQueueFamilyProperties getPhysicalDeviceQueueFamilyProperties;
+} VkelProbeJob;
+
+static VkBool32 vkelProbeWorker(void *pJob)
+{
+	VkelProbeJob *job = (VkelProbeJob*) pJob;
+	
+	for (;;)
+	{
+		uint64_t index = vkelAtomicIncrement64(&job->nextIndex) - 1;
+		
+		if (index >= job->physicalDeviceCount)
+			break;
+		
+		VkPhysicalDevice physicalDevice = job->pPhysicalDevices[index];
+		VkelPhysicalDeviceProbe *pProbe = &job->pProbes[index];
+		
+		memset(pProbe, 0, sizeof(VkelPhysicalDeviceProbe));
+		pProbe->physicalDevice = physicalDevice;
+		
+		// The enumeration cache doesn't hold its lock while enumerating
+		vkelMapPhysicalDeviceCapabilities(physicalDevice, &pProbe->capabilities, &job->enumerateProcs);
+		
+		job->getPhysicalDeviceProperties(physicalDevice, &pProbe->properties);
+		job->getPhysicalDeviceMemoryProperties(physicalDevice, &pProbe->memoryProperties);
+		
+		// VkQueueFamilyProperties is plain data, so asking for fewer than there are is fine
+		pProbe->queueFamilyCount = VKEL_MAX_QUEUE_FAMILIES;
+		job->getPhysicalDeviceQueueFamilyProperties(physicalDevice, &pProbe->queueFamilyCount, pProbe->queueFamilies);
+	}
+	
+	return VK_TRUE;
+}
+
+// Releases the job
+static VkBool32 vkelProbeTask(void *pJob)
+{
+	VkelProbeJob *job = (VkelProbeJob*) pJob;
+	VkelTask workers[VKEL_PROBE_THREAD_COUNT];
+	uint32_t workerCount = 0;
+	
+	// The calling thread is one of them, and if a thread can't be created the others take over its share
+	while (((workerCount + 1) < VKEL_PROBE_THREAD_COUNT) && ((workerCount + 1) < job->physicalDeviceCount))
+	{
+		workers[workerCount] = vkelStartTask(vkelProbeWorker, job);
+		
+		if (!workers[workerCount])
+			break;
+		
+		workerCount++;
+	}
+	
+	vkelProbeWorker(job);
+	
+	uint32_t workerIndex = 0;
+	for (workerIndex = 0; workerIndex < workerCount; workerIndex++)
+		vkelWaitTask(workers[workerIndex]);
+	
+	vkel_free(job);
+	
+	
+	return VK_TRUE;
+}
+
+static VkelProbeJob* vkelCreateProbeJob(uint32_t physicalDeviceCount, const VkPhysicalDevice *pPhysicalDevices, VkelPhysicalDeviceProbe *pProbes)
+{
+	assert(!physicalDeviceCount || (pPhysicalDevices && pProbes));
+	
+	if (!vkEnumerateDeviceExtensionProperties || !vkEnumerateDeviceLayerProperties)
+		return NULL;
+	
+	if (!vkGetPhysicalDeviceProperties || !vkGetPhysicalDeviceMemoryProperties || !vkGetPhysicalDeviceQueueFamilyProperties)
+		return NULL;
+	
+	VkelProbeJob *job = (VkelProbeJob*) vkel_calloc(1, sizeof(VkelProbeJob), VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+	
+	if (!job)
+		return NULL;
+	
+	job->physicalDeviceCount = physicalDeviceCount;
+	job->pPhysicalDevices = pPhysicalDevices;
+	job->pProbes = pProbes;
+	
+	job->enumerateProcs.enumerateDeviceExtensionProperties = vkEnumerateDeviceExtensionProperties;
+	job->enumerateProcs.enumerateDeviceLayerProperties = vkEnumerateDeviceLayerProperties;
+	
+	job->getPhysicalDeviceProperties = vkGetPhysicalDeviceProperties;
+	job->getPhysicalDeviceMemoryProperties = vkGetPhysicalDeviceMemoryProperties;
+	job->getPhysicalDeviceQueueFamilyProperties = vkGetPhysicalDeviceQueueFamilyProperties;
+	
+	return job;
+}
+
+VkBool32 vkelProbePhysicalDevices(uint32_t physicalDeviceCount, const VkPhysicalDevice *pPhysicalDevices, VkelPhysicalDeviceProbe *pProbes)
+{
+	VkelProbeJob *job = vkelCreateProbeJob(physicalDeviceCount, pPhysicalDevices, pProbes);
+	
+	if (!job)
+		return VK_FALSE;
+	
+	return vkelProbeTask(job);
+}
+
+VkelTask vkelProbePhysicalDevicesAsync(uint32_t physicalDeviceCount, const VkPhysicalDevice *pPhysicalDevices, VkelPhysicalDeviceProbe *pProbes)
+{
+	VkelProbeJob *job = vkelCreateProbeJob(physicalDeviceCount, pPhysicalDevices, pProbes);
+	
+	if (!job)
+		return NULL;
+	
+	VkelTask task = vkelStartTask(vkelProbeTask, job);
+	
+	if (!task)
+		vkel_free(job);
+	
+	return task;
+}
+	''')
+	
+	f.write(b"\n")
+	
+	
+	f.write(br'''
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */''')
+
+
+print("Generating vkel.hpp")
+
+
+# Handles owned by a VkDevice and destroyed with vkDestroy*(device, handle, pAllocator)
+# or vkFreeMemory(), as (handle type, destroy function)
+unique_handles = []
+
+for func in device_funcs:
+	params = command_info[func][1]
+	
+	if (func.startswith("vkDestroy") or func.startswith("vkFree")) and len(params) == 3 and params[0][0] == "VkDevice" and params[2][0] == "const VkAllocationCallbacks*":
+		unique_handles.append((params[1][0], func))
+
+
+with open("vkel.hpp", "wb") as f:
+	add_copyright(f)
+	
+	
+	f.write(br"""#ifndef _VKEL_HPP_
+#define _VKEL_HPP_ 1
+
+#include "vkel.h"
+
+
+namespace vkel
+{
+	
+	// Move-only owner of a device level handle, which is destroyed along with the wrapper.
+	// It's exactly the size of the handle and the device, the destroy function is a
+	// template argument (and not a member) so no function pointer is stored.
+	//
+	// The destroy function is taken from the table of the registered device (see
+	// vkelRegisterDevice()) and otherwise the one loaded by vkelDeviceInit().
+	// Handles created with custom allocation callbacks must be released and destroyed manually.
+	template<typename Handle, void (*Destroy)(VkDevice, Handle)>
+	class UniqueHandle
+	{
+	public:
+		UniqueHandle() noexcept : m_handle(VK_NULL_HANDLE), m_device(VK_NULL_HANDLE) {}
+		UniqueHandle(VkDevice device, Handle handle) noexcept : m_handle(handle), m_device(device) {}
+		
+		~UniqueHandle()
+		{
+			static_assert(sizeof(UniqueHandle) == sizeof(RawHandle), "UniqueHandle must be the size of the handle and the device");
+			
+			reset();
+		}
+		
+		UniqueHandle(const UniqueHandle&) = delete;
+		UniqueHandle& operator=(const UniqueHandle&) = delete;
+		
+		UniqueHandle(UniqueHandle &&other) noexcept : m_handle(other.m_handle), m_device(other.m_device)
+		{
+			other.m_handle = VK_NULL_HANDLE;
+		}
+		
+		UniqueHandle& operator=(UniqueHandle &&other) noexcept
+		{
+			if (this != &other)
+			{
+				reset(other.m_device, other.m_handle);
+				
+				other.m_handle = VK_NULL_HANDLE;
+			}
+			
+			return *this;
+		}
+		
+		
+		Handle get() const noexcept { return m_handle; }
+		VkDevice getDevice() const noexcept { return m_device; }
+		
+		explicit operator bool() const noexcept { return m_handle != VK_NULL_HANDLE; }
+		
+		
+		// Give up ownership without destroying the handle
+		Handle release() noexcept
+		{
+			Handle handle = m_handle;
+			
+			m_handle = VK_NULL_HANDLE;
+			
+			return handle;
+		}
+		
+		void reset(VkDevice device = VK_NULL_HANDLE, Handle handle = VK_NULL_HANDLE) noexcept
+		{
+			if (m_handle != VK_NULL_HANDLE)
+				Destroy(m_device, m_handle);
+			
+			m_handle = handle;
+			m_device = device;
+		}
+		
+	private:
+		struct RawHandle
+		{
+			Handle handle;
+			VkDevice device;
+		};
+		
+		Handle m_handle;
+		VkDevice m_device;
+	};
+	
+	
+	namespace detail
+	{
+		
+""")
+	
+	
+	lines = []
+	
+	for handle, func in unique_handles:
+		platform = func_platforms[func]
+		
+		if platform:
+			lines.append("#ifdef " + platform)
+		
+		lines.append("\t\tinline void {0}(VkDevice device, {1} handle)".format(func[2:], handle))
+		lines.append("\t\t{")
+		lines.append("\t\t\tconst VkelDevice *registered = vkelGetDevice(device);")
+		lines.append("\t\t\t")
+		lines.append("\t\t\t(registered ? registered->table.{0} : VKEL_DEVICE_FUNCTION({0}))(device, handle, nullptr);".format(func[2:]))
+		lines.append("\t\t}")
+		
+		if platform:
+			lines.append("#endif /* " + platform + " */")
+		
+		lines.append("\t\t")
+	
+	lines.append("\t}")
+	lines.append("\t")
+	lines.append("\t")
+	
+	for handle, func in unique_handles:
+		platform = func_platforms[func]
+		
+		if platform:
+			lines.append("#ifdef " + platform)
+		
+		lines.append("\tusing {0} = UniqueHandle<{1}, &detail::{2}>;".format(handle[2:], handle, func[2:]))
+		
+		if platform:
+			lines.append("#endif /* " + platform + " */")
+	
+	lines.append("\t")
+	lines.append("\t")
+	lines.append("")
+	
+	f.write("\n".join(lines).encode("utf-8"))
+	
+	
+	f.write(br"""	namespace detail
+	{
+		
+		inline PFN_vkVoidFunction getInstanceProcAddr(VkInstance instance, const char *pName)
+		{
+			return vkGetInstanceProcAddr(instance, pName);
+		}
+		
+		// Device level functions are loaded from the instance when no device is given
+		inline PFN_vkVoidFunction getDeviceProcAddr(VkInstance instance, VkDevice device, const char *pName)
+		{
+			return device ? vkGetDeviceProcAddr(device, pName) : vkGetInstanceProcAddr(instance, pName);
+		}
+		
+		
+		template<typename... Extensions>
+		struct CommandCount;
+		
+		template<>
+		struct CommandCount<>
+		{
+			static constexpr uint32_t value = 0;
+		};
+		
+		template<typename Extension, typename... Extensions>
+		struct CommandCount<Extension, Extensions...>
+		{
+			static constexpr uint32_t value = Extension::commandCount + CommandCount<Extensions...>::value;
+		};
+		
+	}
+	
+	
+""")
+	
+	
+	lines = []
+	
+	def add_extension_tag(lines, indent, extension_name, extension_id):
+		funcs = extension_funcs.get(extension_name, [])
+		platform = func_platforms[funcs[0]] if funcs else None
+		
+		if platform:
+			lines.append("#ifdef " + platform)
+		
+		lines.append(indent + "struct " + extension_name)
+		lines.append(indent + "{")
+		lines.append(indent + "\tstatic constexpr uint32_t commandCount = {0};".format(len(funcs)))
+		lines.append(indent + "\t")
+		
+		if extension_id:
+			lines.append(indent + "\tstatic VkBool32 isSupported() { return vkelHasExtension(" + extension_id + "); }")
+		else:
+			lines.append(indent + "\tstatic VkBool32 isSupported() { return VK_TRUE; }")
+		
+		lines.append(indent + "\t")
+		lines.append(indent + "\tstruct Table")
+		lines.append(indent + "\t{")
+		
+		for func in funcs:
+			lines.append(indent + "\t\tPFN_{0} {1};".format(func, func[2:]))
+		
+		if funcs:
+			lines.append(indent + "\t\t")
+		
+		lines.append(indent + "\t\tvoid load(VkInstance instance, VkDevice device)")
+		lines.append(indent + "\t\t{")
+		lines.append(indent + "\t\t\t(void) instance;")
+		lines.append(indent + "\t\t\t(void) device;")
+		
+		if funcs:
+			lines.append(indent + "\t\t\t")
+		
+		for func in funcs:
+			if func in device_funcs:
+				lines.append(indent + "\t\t\t{1} = (PFN_{0}) detail::getDeviceProcAddr(instance, device, \"{0}\");".format(func, func[2:]))
+			else:
+				lines.append(indent + "\t\t\t{1} = (PFN_{0}) detail::getInstanceProcAddr(instance, \"{0}\");".format(func, func[2:]))
+		
+		lines.append(indent + "\t\t}")
+		lines.append(indent + "\t};")
+		lines.append(indent + "};")
+		
+		if platform:
+			lines.append("#endif /* " + platform + " */")
+		
+		lines.append(indent)
+	
+	
+	lines.append("\t// Extension tags for vkel::Loader, each with a table of only the functions of that extension")
+	
+	add_extension_tag(lines, "\t", "VERSION_1_0", None)
+	
+	lines.append("\tnamespace ext")
+	lines.append("\t{")
+	lines.append("\t\t")
+	
+	for extension_name in extension_ids:
+		add_extension_tag(lines, "\t\t", extension_name, "VKEL_EXT_ID_" + extension_name)
+	
+	lines.append("\t}")
+	lines.append("\t")
+	lines.append("\t")
+	lines.append("")
+	
+	f.write("\n".join(lines).encode("utf-8"))
+	
+	
+	f.write(br"""	// A table of exactly the functions of the listed extensions (and vkel::VERSION_1_0
+	// for the core functions) e.g. vkel::Loader<vkel::ext::KHR_swapchain>. Calling a
+	// function of an extension which isn't listed fails to compile.
+	//
+	// Functions are loaded using vkGetInstanceProcAddr(), so vkelInit() must be called first.
+	template<typename... Extensions>
+	class Loader : public Extensions::Table...
+	{
+	public:
+		// The number of functions that are resolved
+		static constexpr uint32_t commandCount = detail::CommandCount<Extensions...>::value;
+		
+		
+		// Device level functions are loaded using vkGetDeviceProcAddr() when a device is given,
+		// which skips the loader's dispatch for that device
+		void load(VkInstance instance, VkDevice device = VK_NULL_HANDLE)
+		{
+			int expand[] = { 0, (Extensions::Table::load(instance, device), 0)... };
+			(void) expand;
+		}
+		
+		// Whether all the listed extensions are supported, see vkelHasExtension()
+		static VkBool32 isSupported()
+		{
+			VkBool32 supported[] = { VK_TRUE, Extensions::isSupported()... };
+			
+			for (VkBool32 extensionSupported : supported)
+				if (!extensionSupported)
+					return VK_FALSE;
+			
+			return VK_TRUE;
+		}
+	};
+	
+}
+
+
+#endif /* _VKEL_HPP_ */
+""")
+
+
+print("Generating vkel_layer.c")
+
+
+# Commands the layer always handles itself, as they're needed to build and tear down the chain
+layer_intercepted_funcs = [
+	"vkGetInstanceProcAddr",
+	"vkGetDeviceProcAddr",
+	"vkCreateInstance",
+	"vkDestroyInstance",
+	"vkCreateDevice",
+	"vkDestroyDevice",
+]
+
+# Commands dispatched through a VkInstance or VkPhysicalDevice, which are found using the instance
+instance_funcs = [func for func in all_funcs if get_dispatch_type(func) in ("VkInstance", "VkPhysicalDevice")]
+
+# Commands that are wrapped when instrumenting, in the order they are declared
+layer_funcs = [func for func in all_funcs if (func in instance_funcs or func in device_funcs) and func not in layer_intercepted_funcs]
+
+
+with open("vkel_layer.c", "wb") as f:
+	add_copyright(f)
+	
+	
+	f.write(br'''// vkel as an implicit Vulkan layer, which counts and times every command of
+// applications without modifying them. See VkLayer_vkel.json.
+//
+// Instrumenting is enabled by setting VKEL_LAYER_INSTRUMENT=1. Otherwise the layer
+// hands out the functions of the next layer as is, so it isn't part of any call.
+
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#	define _POSIX_C_SOURCE 200112L
+#endif
+
+#define VKEL_NO_FUNCTION_MACROS
+#include "vkel.h"
+
+#include <stdio.h> /* fopen(), fprintf() */
+#include <stdlib.h> /* calloc(), free(), getenv() */
+#include <string.h> /* strcmp() */
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+#include <Windows.h>
+#else
+#include <pthread.h>
+#include <time.h>
+#endif
+
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+#	define VKEL_LAYER_EXPORT __declspec(dllexport)
+#else
+#	define VKEL_LAYER_EXPORT __attribute__((visibility("default")))
+#endif
+
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+#	define VkelPlatformMutex SRWLOCK
+#	define VKEL_PLATFORM_MUTEX_INITIALIZER SRWLOCK_INIT
+#	define vkelPlatformLockMutex(mutex) AcquireSRWLockExclusive(mutex)
+#	define vkelPlatformUnlockMutex(mutex) ReleaseSRWLockExclusive(mutex)
+#else
+#	define VkelPlatformMutex pthread_mutex_t
+#	define VKEL_PLATFORM_MUTEX_INITIALIZER PTHREAD_MUTEX_INITIALIZER
+#	define vkelPlatformLockMutex(mutex) pthread_mutex_lock(mutex)
+#	define vkelPlatformUnlockMutex(mutex) pthread_mutex_unlock(mutex)
+#endif
+
+
+static void* vkelAtomicLoadPointer(void* volatile *pPointer)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return __atomic_load_n(pPointer, __ATOMIC_ACQUIRE);
+#elif defined(_MSC_VER)
+	void *pointer = *pPointer;
+	MemoryBarrier();
+	return pointer;
+#else
+#	error vkel needs atomic loads and stores for this compiler
+#endif
+}
+
+static void vkelAtomicStorePointer(void* volatile *pPointer, void *pointer)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	__atomic_store_n(pPointer, pointer, __ATOMIC_RELEASE);
+#elif defined(_MSC_VER)
+	MemoryBarrier();
+	*pPointer = pointer;
+#else
+#	error vkel needs atomic loads and stores for this compiler
+#endif
+}
+
+
+#define VKEL_LAYER_NAME "VK_LAYER_VKEL_instrumentation"
+#define VKEL_LAYER_DESCRIPTION "vkel per command call counts and timings"
+
+#ifndef VKEL_LAYER_MAX_HANDLES
+#	define VKEL_LAYER_MAX_HANDLES 64
+#endif
+
+
+// The loader's side of the layer interface (version 2), as declared by vk_layer.h
+
+typedef enum VkelLayerFunction {
+	VKEL_LAYER_LINK_INFO = 0,
+	VKEL_LOADER_DATA_CALLBACK = 1,
+} VkelLayerFunction;
+
+typedef struct VkelLayerInstanceLink {
+	struct VkelLayerInstanceLink *pNext;
+	PFN_vkGetInstanceProcAddr pfnNextGetInstanceProcAddr;
+	PFN_vkVoidFunction pfnNextGetPhysicalDeviceProcAddr;
+} VkelLayerInstanceLink;
+
+typedef struct VkelLayerInstanceCreateInfo {
+	VkStructureType sType;
+	const void *pNext;
+	VkelLayerFunction function;
+	union {
+		VkelLayerInstanceLink *pLayerInfo;
+		PFN_vkVoidFunction pfnSetInstanceLoaderData;
+	} u;
+} VkelLayerInstanceCreateInfo;
+
+typedef struct VkelLayerDeviceLink {
+	struct VkelLayerDeviceLink *pNext;
+	PFN_vkGetInstanceProcAddr pfnNextGetInstanceProcAddr;
+	PFN_vkGetDeviceProcAddr pfnNextGetDeviceProcAddr;
+} VkelLayerDeviceLink;
+
+typedef struct VkelLayerDeviceCreateInfo {
+	VkStructureType sType;
+	const void *pNext;
+	VkelLayerFunction function;
+	union {
+		VkelLayerDeviceLink *pLayerInfo;
+		PFN_vkVoidFunction pfnSetDeviceLoaderData;
+	} u;
+} VkelLayerDeviceCreateInfo;
+
+typedef enum VkelNegotiateLayerStructType {
+	VKEL_LAYER_NEGOTIATE_UNINTIALIZED = 0,
+	VKEL_LAYER_NEGOTIATE_INTERFACE_STRUCT = 1,
+} VkelNegotiateLayerStructType;
+
+typedef struct VkelNegotiateLayerInterface {
+	VkelNegotiateLayerStructType sType;
+	void *pNext;
+	uint32_t loaderLayerInterfaceVersion;
+	PFN_vkGetInstanceProcAddr pfnGetInstanceProcAddr;
+	PFN_vkGetDeviceProcAddr pfnGetDeviceProcAddr;
+	PFN_vkVoidFunction pfnGetPhysicalDeviceProcAddr;
+} VkelNegotiateLayerInterface;
+
+
+''')
+	
+	
+	lines = []
+	
+	lines.append("typedef struct VkelLayerInstanceTable {")
+	
+	add_table_members(lines, instance_funcs)
+	
+	lines.append("} VkelLayerInstanceTable;")
+	lines.append("")
+	lines.append("")
+	
+	f.write("\n".join(lines).encode("utf-8"))
+	
+	
+	f.write(br'''typedef struct VkelLayerInstance {
+	VkInstance instance;
+	PFN_vkGetInstanceProcAddr nextGetInstanceProcAddr;
+	VkelLayerInstanceTable table;
+} VkelLayerInstance;
+
+typedef struct VkelLayerDevice {
+	VkDevice device;
+	PFN_vkGetDeviceProcAddr nextGetDeviceProcAddr;
+	VkelDeviceTable table;
+} VkelLayerDevice;
+
+
+// Instances and devices are found using the loader's dispatch pointer (see vkelGetDispatchKey()),
+// so a VkPhysicalDevice finds its VkInstance and a VkQueue or VkCommandBuffer finds its VkDevice.
+// Lookups don't lock, the entry is published before the key and removed after it.
+typedef struct VkelLayerSlot {
+	void* volatile key;
+	void* volatile entry;
+} VkelLayerSlot;
+
+static VkelPlatformMutex vkelLayerMutex = VKEL_PLATFORM_MUTEX_INITIALIZER;
+
+static VkelLayerSlot vkelLayerInstances[VKEL_LAYER_MAX_HANDLES];
+static VkelLayerSlot vkelLayerDevices[VKEL_LAYER_MAX_HANDLES];
+
+
+static void* vkelLayerFind(VkelLayerSlot *pSlots, const void *dispatchableHandle)
+{
+	void *key = vkelGetDispatchKey(dispatchableHandle);
+	uint32_t i;
+	
+	for (i = 0; i < VKEL_LAYER_MAX_HANDLES; ++i)
+		if (vkelAtomicLoadPointer(&pSlots[i].key) == key)
+			return vkelAtomicLoadPointer(&pSlots[i].entry);
+	
+	return NULL;
+}
+
+static VkBool32 vkelLayerAdd(VkelLayerSlot *pSlots, const void *dispatchableHandle, void *entry)
+{
+	VkBool32 added = VK_FALSE;
+	uint32_t i;
+	
+	vkelPlatformLockMutex(&vkelLayerMutex);
+	
+	for (i = 0; i < VKEL_LAYER_MAX_HANDLES; ++i)
+	{
+		if (!pSlots[i].key)
+		{
+			vkelAtomicStorePointer(&pSlots[i].entry, entry);
+			vkelAtomicStorePointer(&pSlots[i].key, vkelGetDispatchKey(dispatchableHandle));
+			
+			added = VK_TRUE;
+			break;
+		}
+	}
+	
+	vkelPlatformUnlockMutex(&vkelLayerMutex);
+	
+	return added;
+}
+
+static void* vkelLayerRemove(VkelLayerSlot *pSlots, const void *dispatchableHandle)
+{
+	void *key = vkelGetDispatchKey(dispatchableHandle);
+	void *entry = NULL;
+	uint32_t i;
+	
+	vkelPlatformLockMutex(&vkelLayerMutex);
+	
+	for (i = 0; i < VKEL_LAYER_MAX_HANDLES; ++i)
+	{
+		if (pSlots[i].key == key)
+		{
+			entry = pSlots[i].entry;
+			
+			vkelAtomicStorePointer(&pSlots[i].key, NULL);
+			vkelAtomicStorePointer(&pSlots[i].entry, NULL);
+			break;
+		}
+	}
+	
+	vkelPlatformUnlockMutex(&vkelLayerMutex);
+	
+	return entry;
+}
+
+
+''')
+	
+	
+	def add_load_table(lines, name, table_type, get_proc_addr_type, handle_type, handle_name, funcs):
+		lines.append("static void {0}({1} *pTable, {2} getProcAddr, {3} {4})".format(name, table_type, get_proc_addr_type, handle_type, handle_name))
+		lines.append("{")
+		
+		for func in funcs:
+			platform = func_platforms[func]
+			
+			if platform:
+				lines.append("#ifdef " + platform)
+			
+			lines.append("\tpTable->{1} = (PFN_{0}) getProcAddr({2}, \"{0}\");".format(func, func[2:], handle_name))
+			
+			if platform:
+				lines.append("#endif /* " + platform + " */")
+		
+		lines.append("}")
+		lines.append("")
+	
+	
+	lines = []
+	
+	add_load_table(lines, "vkelLayerLoadInstanceTable", "VkelLayerInstanceTable", "PFN_vkGetInstanceProcAddr", "VkInstance", "instance", instance_funcs)
+	add_load_table(lines, "vkelLayerLoadDeviceTable", "VkelDeviceTable", "PFN_vkGetDeviceProcAddr", "VkDevice", "device", device_funcs)
+	
+	lines.append("")
+	
+	f.write("\n".join(lines).encode("utf-8"))
+	
+	
+	f.write(br'''// Instrumenting
+
+typedef struct VkelLayerCommandStats {
+	volatile uint64_t callCount;
+	volatile uint64_t totalNanoseconds;
+} VkelLayerCommandStats;
+
+
+// Read from VKEL_LAYER_INSTRUMENT when the first instance is created
+static VkBool32 vkelLayerInstrument;
+static VkBool32 vkelLayerSettingsRead;
+
+''')
+	
+	
+	lines = []
+	
+	lines.append("static VkelLayerCommandStats vkelLayerStats[{0}];".format(len(layer_funcs)))
+	lines.append("")
+	lines.append("static const char* const vkelLayerCommandNames[{0}] = {{".format(len(layer_funcs)))
+	
+	for func in layer_funcs:
+		lines.append("\t\"{0}\",".format(func))
+	
+	lines.append("};")
+	lines.append("")
+	lines.append("")
+	
+	f.write("\n".join(lines).encode("utf-8"))
+	
+	
+	f.write(br'''static void vkelLayerReadSettings(void)
+{
+	const char *pInstrument;
+	
+	if (vkelLayerSettingsRead)
+		return;
+	
+	pInstrument = getenv("VKEL_LAYER_INSTRUMENT");
+	
+	vkelLayerInstrument = (pInstrument && pInstrument[0] && strcmp(pInstrument, "0")) ? VK_TRUE : VK_FALSE;
+	vkelLayerSettingsRead = VK_TRUE;
+}
+
+static uint64_t vkelLayerGetNanoseconds(void)
+{
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+	static LARGE_INTEGER frequency;
+	LARGE_INTEGER counter;
+	
+	if (!frequency.QuadPart)
+		QueryPerformanceFrequency(&frequency);
+	
+	QueryPerformanceCounter(&counter);
+	
+	return (uint64_t) ((double) counter.QuadPart * 1000000000.0 / (double) frequency.QuadPart);
+#else
+	struct timespec now;
+	
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	
+	return (uint64_t) now.tv_sec * 1000000000u + (uint64_t) now.tv_nsec;
+#endif
+}
+
+static void vkelLayerEndCall(VkelLayerCommandStats *pStats, uint64_t start)
+{
+	uint64_t elapsed = vkelLayerGetNanoseconds() - start;
+
+#if defined(__GNUC__) || defined(__clang__)
+	__atomic_fetch_add(&pStats->callCount, 1, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&pStats->totalNanoseconds, elapsed, __ATOMIC_RELAXED);
+#elif defined(_MSC_VER)
+	InterlockedIncrement64((volatile LONG64*) &pStats->callCount);
+	InterlockedExchangeAdd64((volatile LONG64*) &pStats->totalNanoseconds, (LONG64) elapsed);
+#else
+#	error vkel needs atomic additions for this compiler
+#endif
+}
+
+
+// Written to VKEL_LAYER_OUTPUT (or stderr) when the layer is unloaded
+static void vkelLayerWriteReport(void)
+{
+	const char *pPath = getenv("VKEL_LAYER_OUTPUT");
+	FILE *file;
+	uint32_t i;
+	
+	if (!vkelLayerInstrument)
+		return;
+	
+	file = pPath ? fopen(pPath, "w") : stderr;
+	
+	if (!file)
+		return;
+	
+	fprintf(file, "%-48s %12s %14s %10s\n", "command", "calls", "total (us)", "avg (ns)");
+	
+	for (i = 0; i < sizeof(vkelLayerStats) / sizeof(vkelLayerStats[0]); ++i)
+	{
+		unsigned long long callCount = (unsigned long long) vkelLayerStats[i].callCount;
+		unsigned long long totalNanoseconds = (unsigned long long) vkelLayerStats[i].totalNanoseconds;
+		
+		if (callCount)
+			fprintf(file, "%-48s %12llu %14.1f %10llu\n", vkelLayerCommandNames[i], callCount, (double) totalNanoseconds / 1000.0, totalNanoseconds / callCount);
+	}
+	
+	if (file != stderr)
+		fclose(file);
+}
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+BOOL WINAPI DllMain(HINSTANCE hinstDLL, DWORD fdwReason, LPVOID lpvReserved)
+{
+	(void) hinstDLL;
+	(void) lpvReserved;
+	
+	if (fdwReason == DLL_PROCESS_DETACH)
+		vkelLayerWriteReport();
+	
+	return TRUE;
+}
+#else
+// The loader unloads layers when the last instance is destroyed, so atexit() can't be used
+__attribute__((destructor)) static void vkelLayerUnload(void)
+{
+	vkelLayerWriteReport();
+}
+#endif
+
+
+''')
+	
+	
+	lines = []
+	
+	for index, func in enumerate(layer_funcs):
+		platform = func_platforms[func]
+		return_type, params = command_info[func]
+		
+		if func in device_funcs:
+			entry_type, slots = "VkelLayerDevice", "vkelLayerDevices"
+		else:
+			entry_type, slots = "VkelLayerInstance", "vkelLayerInstances"
+		
+		call = "pEntry->table.{0}({1})".format(func[2:], ", ".join(param[1] for param in params))
+		
+		if platform:
+			lines.append("#ifdef " + platform)
+		
+		lines.append("static VKAPI_ATTR {0} VKAPI_CALL vkelLayer{1}({2})".format(return_type, func[2:], ", ".join("{0} {1}{2}".format(*param) for param in params)))
+		lines.append("{")
+		lines.append("\tconst {0} *pEntry = (const {0}*) vkelLayerFind({1}, {2});".format(entry_type, slots, params[0][1]))
+		lines.append("\tuint64_t start = vkelLayerGetNanoseconds();")
+		
+		if return_type == "void":
+			lines.append("\t{0};".format(call))
+			lines.append("\tvkelLayerEndCall(&vkelLayerStats[{0}], start);".format(index))
+		else:
+			lines.append("\t{0} result = {1};".format(return_type, call))
+			lines.append("\tvkelLayerEndCall(&vkelLayerStats[{0}], start);".format(index))
+			lines.append("\treturn result;")
+		
+		lines.append("}")
+		
+		if platform:
+			lines.append("#endif /* " + platform + " */")
+	
+	lines.append("")
+	lines.append("")
+	
+	lines.append("typedef struct VkelLayerCommand {")
+	lines.append("\tconst char *pName;")
+	lines.append("\tPFN_vkVoidFunction function;")
+	lines.append("} VkelLayerCommand;")
+	lines.append("")
+	lines.append("// Sorted by name for bsearch()")
+	lines.append("static const VkelLayerCommand vkelLayerCommands[] = {")
+	
+	for func in sorted(layer_funcs):
+		platform = func_platforms[func]
+		
+		if platform:
+			lines.append("#ifdef " + platform)
+		
+		lines.append("\t{{ \"{0}\", (PFN_vkVoidFunction) vkelLayer{1} }},".format(func, func[2:]))
+		
+		if platform:
+			lines.append("#endif /* " + platform + " */")
+	
+	lines.append("};")
+	lines.append("")
+	lines.append("")
+	
+	f.write("\n".join(lines).encode("utf-8"))
+	
 	
-	return proc;
+	f.write(br'''static int vkelLayerCompareCommand(const void *pName, const void *pCommand)
+{
+	return strcmp((const char*) pName, ((const VkelLayerCommand*) pCommand)->pName);
 }
 
-PFN_vkVoidFunction vkelGetDeviceProcAddr(VkDevice device, const char *pName)
+// Returns the wrapper if instrumenting, otherwise the next layer's function
+static PFN_vkVoidFunction vkelLayerGetInstrumentedProcAddr(const char *pName, PFN_vkVoidFunction next)
 {
-	PFN_vkVoidFunction proc = (PFN_vkVoidFunction) vkGetDeviceProcAddr(device, pName);
+	const VkelLayerCommand *pCommand;
 	
-	if (!proc)
-		proc = (PFN_vkVoidFunction) vkelGetInstanceProcAddr(NULL, pName);
+	if (!next || !vkelLayerInstrument)
+		return next;
 	
-	return proc;
+	pCommand = (const VkelLayerCommand*) bsearch(pName, vkelLayerCommands, sizeof(vkelLayerCommands) / sizeof(vkelLayerCommands[0]), sizeof(vkelLayerCommands[0]), vkelLayerCompareCommand);
+	
+	return pCommand ? pCommand->function : next;
 }
 
 
-static int vkel_strcmp(const char *str1, const char *str2)
+// Chain
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerCreateInstance(const VkInstanceCreateInfo *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkInstance *pInstance)
 {
-	while (*str1 && (*str1 == *str2))
+	VkelLayerInstanceCreateInfo *pChainInfo = (VkelLayerInstanceCreateInfo*) pCreateInfo->pNext;
+	PFN_vkGetInstanceProcAddr nextGetInstanceProcAddr;
+	PFN_vkCreateInstance nextCreateInstance;
+	VkelLayerInstance *pEntry;
+	VkResult result;
+	
+	while (pChainInfo && !(pChainInfo->sType == VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO && pChainInfo->function == VKEL_LAYER_LINK_INFO))
+		pChainInfo = (VkelLayerInstanceCreateInfo*) pChainInfo->pNext;
+	
+	if (!pChainInfo || !pChainInfo->u.pLayerInfo)
+		return VK_ERROR_INITIALIZATION_FAILED;
+	
+	nextGetInstanceProcAddr = pChainInfo->u.pLayerInfo->pfnNextGetInstanceProcAddr;
+	nextCreateInstance = (PFN_vkCreateInstance) nextGetInstanceProcAddr(VK_NULL_HANDLE, "vkCreateInstance");
+	
+	if (!nextCreateInstance)
+		return VK_ERROR_INITIALIZATION_FAILED;
+	
+	vkelLayerReadSettings();
+	
+	// The next layer takes the following link
+	pChainInfo->u.pLayerInfo = pChainInfo->u.pLayerInfo->pNext;
+	
+	result = nextCreateInstance(pCreateInfo, pAllocator, pInstance);
+	
+	if (result != VK_SUCCESS)
+		return result;
+	
+	pEntry = (VkelLayerInstance*) calloc(1, sizeof(VkelLayerInstance));
+	
+	if (pEntry)
 	{
-		str1++, str2++;
+		pEntry->instance = *pInstance;
+		pEntry->nextGetInstanceProcAddr = nextGetInstanceProcAddr;
+		
+		vkelLayerLoadInstanceTable(&pEntry->table, nextGetInstanceProcAddr, *pInstance);
+		
+		if (vkelLayerAdd(vkelLayerInstances, *pInstance, pEntry))
+			return VK_SUCCESS;
+		
+		pEntry->table.DestroyInstance(*pInstance, pAllocator);
+		free(pEntry);
+		
+		return VK_ERROR_TOO_MANY_OBJECTS;
 	}
-
-	return *(const unsigned char*) str1 - *(const unsigned char*) str2;
+	
+	((PFN_vkDestroyInstance) nextGetInstanceProcAddr(*pInstance, "vkDestroyInstance"))(*pInstance, pAllocator);
+	
+	return VK_ERROR_OUT_OF_HOST_MEMORY;
 }
 
-static void vkel_strpy(char *dest, char *src)
+static VKAPI_ATTR void VKAPI_CALL vkelLayerDestroyInstance(VkInstance instance, const VkAllocationCallbacks *pAllocator)
 {
-	while (*dest++ = *src++);
+	VkelLayerInstance *pEntry;
+	
+	if (!instance)
+		return;
+	
+	pEntry = (VkelLayerInstance*) vkelLayerRemove(vkelLayerInstances, instance);
+	
+	if (!pEntry)
+		return;
+	
+	pEntry->table.DestroyInstance(instance, pAllocator);
+	
+	free(pEntry);
 }
 
-
-void vkelDeleteNames(uint32_t nameCount, char **names)
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerCreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkDevice *pDevice)
 {
-	// assert(names);
-	if (!names)
-		return;
+	VkelLayerDeviceCreateInfo *pChainInfo = (VkelLayerDeviceCreateInfo*) pCreateInfo->pNext;
+	const VkelLayerInstance *pInstance = (const VkelLayerInstance*) vkelLayerFind(vkelLayerInstances, physicalDevice);
+	PFN_vkGetDeviceProcAddr nextGetDeviceProcAddr;
+	PFN_vkCreateDevice nextCreateDevice;
+	VkelLayerDevice *pEntry;
+	VkResult result;
 	
-	uint32_t nameIndex = 0;
-	for (nameIndex = 0; nameIndex < nameCount; nameIndex++)
+	while (pChainInfo && !(pChainInfo->sType == VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO && pChainInfo->function == VKEL_LAYER_LINK_INFO))
+		pChainInfo = (VkelLayerDeviceCreateInfo*) pChainInfo->pNext;
+	
+	if (!pChainInfo || !pChainInfo->u.pLayerInfo || !pInstance)
+		return VK_ERROR_INITIALIZATION_FAILED;
+	
+	nextGetDeviceProcAddr = pChainInfo->u.pLayerInfo->pfnNextGetDeviceProcAddr;
+	nextCreateDevice = (PFN_vkCreateDevice) pChainInfo->u.pLayerInfo->pfnNextGetInstanceProcAddr(pInstance->instance, "vkCreateDevice");
+	
+	if (!nextCreateDevice)
+		return VK_ERROR_INITIALIZATION_FAILED;
+	
+	// The next layer takes the following link
+	pChainInfo->u.pLayerInfo = pChainInfo->u.pLayerInfo->pNext;
+	
+	result = nextCreateDevice(physicalDevice, pCreateInfo, pAllocator, pDevice);
+	
+	if (result != VK_SUCCESS)
+		return result;
+	
+	pEntry = (VkelLayerDevice*) calloc(1, sizeof(VkelLayerDevice));
+	
+	if (pEntry)
 	{
-		// assert(names[nameIndex]);
-		if (!names[nameIndex])
-			continue;
-
-		free(names[nameIndex]);
+		pEntry->device = *pDevice;
+		pEntry->nextGetDeviceProcAddr = nextGetDeviceProcAddr;
+		
+		vkelLayerLoadDeviceTable(&pEntry->table, nextGetDeviceProcAddr, *pDevice);
+		
+		if (vkelLayerAdd(vkelLayerDevices, *pDevice, pEntry))
+			return VK_SUCCESS;
+		
+		pEntry->table.DestroyDevice(*pDevice, pAllocator);
+		free(pEntry);
+		
+		return VK_ERROR_TOO_MANY_OBJECTS;
 	}
-
-	free(names);
+	
+	((PFN_vkDestroyDevice) nextGetDeviceProcAddr(*pDevice, "vkDestroyDevice"))(*pDevice, pAllocator);
+	
+	return VK_ERROR_OUT_OF_HOST_MEMORY;
 }
 
-
-char** vkelGetInstanceExtensionNames(const char *pLayerName, uint32_t *extensionNameCount)
+static VKAPI_ATTR void VKAPI_CALL vkelLayerDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator)
 {
-	assert(extensionNameCount);
-
-
-	VkResult err;
+	VkelLayerDevice *pEntry;
+	
+	if (!device)
+		return;
+	
+	pEntry = (VkelLayerDevice*) vkelLayerRemove(vkelLayerDevices, device);
+	
+	if (!pEntry)
+		return;
+	
+	pEntry->table.DestroyDevice(device, pAllocator);
+	
+	free(pEntry);
+}
 
 
-	uint32_t extPropertyCount;
-	err = vkEnumerateInstanceExtensionProperties(pLayerName, &extPropertyCount, NULL);
-	assert(!err);
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkelLayerGetInstanceProcAddr(VkInstance instance, const char *pName);
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkelLayerGetDeviceProcAddr(VkDevice device, const char *pName);
 
-	(*extensionNameCount) = extPropertyCount;
+static PFN_vkVoidFunction vkelLayerGetInterceptedProcAddr(const char *pName)
+{
+	if (!strcmp(pName, "vkGetInstanceProcAddr"))
+		return (PFN_vkVoidFunction) vkelLayerGetInstanceProcAddr;
+	
+	if (!strcmp(pName, "vkGetDeviceProcAddr"))
+		return (PFN_vkVoidFunction) vkelLayerGetDeviceProcAddr;
+	
+	if (!strcmp(pName, "vkCreateInstance"))
+		return (PFN_vkVoidFunction) vkelLayerCreateInstance;
+	
+	if (!strcmp(pName, "vkDestroyInstance"))
+		return (PFN_vkVoidFunction) vkelLayerDestroyInstance;
+	
+	if (!strcmp(pName, "vkCreateDevice"))
+		return (PFN_vkVoidFunction) vkelLayerCreateDevice;
+	
+	if (!strcmp(pName, "vkDestroyDevice"))
+		return (PFN_vkVoidFunction) vkelLayerDestroyDevice;
+	
+	return NULL;
+}
 
-	if (extPropertyCount < 1)
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkelLayerGetInstanceProcAddr(VkInstance instance, const char *pName)
+{
+	PFN_vkVoidFunction function = vkelLayerGetInterceptedProcAddr(pName);
+	const VkelLayerInstance *pInstance;
+	
+	if (function || !instance)
+		return function;
+	
+	pInstance = (const VkelLayerInstance*) vkelLayerFind(vkelLayerInstances, instance);
+	
+	if (!pInstance)
 		return NULL;
-
-
-	char **extensionNames = (char**) calloc(extPropertyCount, sizeof(char*));
 	
-	uint32_t extensionNameIndex = 0;
-	for (extensionNameIndex = 0; extensionNameIndex < extPropertyCount; extensionNameIndex++)
-	{
-		extensionNames[extensionNameIndex] = (char*)calloc(VK_MAX_EXTENSION_NAME_SIZE, sizeof(char));
-	}
-
-
-	VkExtensionProperties *extProperties = (VkExtensionProperties*) calloc(extPropertyCount, sizeof(VkExtensionProperties));
-	assert(extProperties);
-
+	return vkelLayerGetInstrumentedProcAddr(pName, pInstance->nextGetInstanceProcAddr(instance, pName));
+}
 
-	err = vkEnumerateInstanceExtensionProperties(pLayerName, &extPropertyCount, extProperties);
-	assert(!err);
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkelLayerGetDeviceProcAddr(VkDevice device, const char *pName)
+{
+	const VkelLayerDevice *pDevice;
 	
-	uint32_t extPropertyIndex = 0;
-	for (extPropertyIndex = 0; extPropertyIndex < extPropertyCount; extPropertyIndex++)
-	{
-		VkExtensionProperties extProperty = extProperties[extPropertyIndex];
-
-		vkel_strpy(extensionNames[extPropertyIndex], extProperty.extensionName);
-	}
-
+	if (!strcmp(pName, "vkGetDeviceProcAddr"))
+		return (PFN_vkVoidFunction) vkelLayerGetDeviceProcAddr;
+	
+	if (!strcmp(pName, "vkDestroyDevice"))
+		return (PFN_vkVoidFunction) vkelLayerDestroyDevice;
+	
+	pDevice = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	
+	if (!pDevice)
+		return NULL;
+	
+	return vkelLayerGetInstrumentedProcAddr(pName, pDevice->nextGetDeviceProcAddr(device, pName));
+}
 
-	free(extProperties);
 
+// Exports
 
-	return extensionNames;
+VKEL_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVersion(VkelNegotiateLayerInterface *pVersionStruct)
+{
+	if (!pVersionStruct || pVersionStruct->sType != VKEL_LAYER_NEGOTIATE_INTERFACE_STRUCT)
+		return VK_ERROR_INITIALIZATION_FAILED;
+	
+	// Version 2 is the first that's negotiated, and the only one the layer implements
+	if (pVersionStruct->loaderLayerInterfaceVersion < 2)
+		return VK_ERROR_INITIALIZATION_FAILED;
+	
+	pVersionStruct->loaderLayerInterfaceVersion = 2;
+	pVersionStruct->pfnGetInstanceProcAddr = vkelLayerGetInstanceProcAddr;
+	pVersionStruct->pfnGetDeviceProcAddr = vkelLayerGetDeviceProcAddr;
+	pVersionStruct->pfnGetPhysicalDeviceProcAddr = NULL;
+	
+	return VK_SUCCESS;
 }
 
-char** vkelGetInstanceLayerNames(uint32_t *layerNameCount)
+// Loaders that don't negotiate look these up by name
+VKEL_LAYER_EXPORT VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetInstanceProcAddr(VkInstance instance, const char *pName)
 {
-	assert(layerNameCount);
-
-
-	VkResult err;
-
-
-	uint32_t layerPropertyCount;
-	err = vkEnumerateInstanceLayerProperties(&layerPropertyCount, NULL);
-	assert(!err);
-
-	(*layerNameCount) = layerPropertyCount;
+	return vkelLayerGetInstanceProcAddr(instance, pName);
+}
 
-	if (layerPropertyCount < 1)
-		return NULL;
+VKEL_LAYER_EXPORT VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetDeviceProcAddr(VkDevice device, const char *pName)
+{
+	return vkelLayerGetDeviceProcAddr(device, pName);
+}
 
 
-	char **layerNames = (char**) calloc(layerPropertyCount, sizeof(char*));
-	
-	uint32_t layerNameIndex = 0;
-	for (layerNameIndex = 0; layerNameIndex < layerPropertyCount; layerNameIndex++)
+VKEL_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateInstanceLayerProperties(uint32_t *pPropertyCount, VkLayerProperties *pProperties)
+{
+	if (!pProperties)
 	{
-		layerNames[layerNameIndex] = (char*) calloc(VK_MAX_EXTENSION_NAME_SIZE, sizeof(char));
+		*pPropertyCount = 1;
+		return VK_SUCCESS;
 	}
+	
+	if (*pPropertyCount < 1)
+		return VK_INCOMPLETE;
+	
+	memset(pProperties, 0, sizeof(VkLayerProperties));
+	
+	strcpy(pProperties->layerName, VKEL_LAYER_NAME);
+	strcpy(pProperties->description, VKEL_LAYER_DESCRIPTION);
+	
+	pProperties->specVersion = VK_MAKE_VERSION(1, 0, VK_HEADER_VERSION);
+	pProperties->implementationVersion = 1;
+	
+	*pPropertyCount = 1;
+	
+	return VK_SUCCESS;
+}
 
+VKEL_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateInstanceExtensionProperties(const char *pLayerName, uint32_t *pPropertyCount, VkExtensionProperties *pProperties)
+{
+	(void) pProperties;
+	
+	if (!pLayerName || strcmp(pLayerName, VKEL_LAYER_NAME))
+		return VK_ERROR_LAYER_NOT_PRESENT;
+	
+	*pPropertyCount = 0;
+	
+	return VK_SUCCESS;
+}
 
-	VkLayerProperties *layerProperties = (VkLayerProperties*) calloc(layerPropertyCount, sizeof(VkLayerProperties));
-	assert(layerProperties);
+VKEL_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateDeviceLayerProperties(VkPhysicalDevice physicalDevice, uint32_t *pPropertyCount, VkLayerProperties *pProperties)
+{
+	(void) physicalDevice;
+	
+	return vkEnumerateInstanceLayerProperties(pPropertyCount, pProperties);
+}
 
-	err = vkEnumerateInstanceLayerProperties(&layerPropertyCount, layerProperties);
-	assert(!err);
+VKEL_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateDeviceExtensionProperties(VkPhysicalDevice physicalDevice, const char *pLayerName, uint32_t *pPropertyCount, VkExtensionProperties *pProperties)
+{
+	const VkelLayerInstance *pInstance;
 	
-	uint32_t layerPropertyIndex = 0;
-	for (layerPropertyIndex = 0; layerPropertyIndex < layerPropertyCount; layerPropertyIndex++)
+	if (pLayerName && !strcmp(pLayerName, VKEL_LAYER_NAME))
 	{
-		VkLayerProperties layerProperty = layerProperties[layerPropertyIndex];
-
-		vkel_strpy(layerNames[layerPropertyIndex], layerProperty.layerName);
+		*pPropertyCount = 0;
+		return VK_SUCCESS;
 	}
+	
+	pInstance = physicalDevice ? (const VkelLayerInstance*) vkelLayerFind(vkelLayerInstances, physicalDevice) : NULL;
+	
+	if (!pInstance)
+		return VK_ERROR_LAYER_NOT_PRESENT;
+	
+	return pInstance->table.EnumerateDeviceExtensionProperties(physicalDevice, pLayerName, pPropertyCount, pProperties);
+}
+''')
 
 
-	free(layerProperties);
+print("Generating VkLayer_vkel.json")
 
 
-	return layerNames;
+header_version = re.search(r"#define\s+VK_HEADER_VERSION\s+(\d+)", vulkan_h)
+header_version = header_version.group(1) if header_version else "0"
+
+# The manifest that makes the loader pick up the layer, library_path is relative to
+# the manifest (on Windows it's .\\VkLayer_vkel.dll)
+with open("VkLayer_vkel.json", "wb") as f:
+	f.write(("""{
+	"file_format_version": "1.0.0",
+	"layer": {
+		"name": "VK_LAYER_VKEL_instrumentation",
+		"type": "GLOBAL",
+		"library_path": "./libVkLayer_vkel.so",
+		"api_version": "1.0.""" + header_version + """",
+		"implementation_version": "1",
+		"description": "vkel per command call counts and timings",
+		"disable_environment": {
+			"VKEL_LAYER_DISABLE": "1"
+		}
+	}
 }
+""").encode("utf-8"))
 
 
-char** vkelGetDeviceExtensionNames(VkPhysicalDevice physicalDevice, const char *pLayerName, uint32_t *extensionNameCount)
-{
-	assert(extensionNameCount);
+print("Generating vkel_interpose.c")
 
 
-	VkResult err;
+func_extensions = {}
 
+for extension_name in extension_funcs:
+	for func in extension_funcs[extension_name]:
+		func_extensions[func] = extension_name
 
-	uint32_t extPropertyCount;
-	err = vkEnumerateDeviceExtensionProperties(physicalDevice, pLayerName, &extPropertyCount, NULL);
-	assert(!err);
+# The commands exported by the Vulkan loader itself (the core and KHR ones), which are the
+# ones applications link against, in the order they are declared
+interpose_funcs = [func for func in all_funcs if func_extensions.get(func) == "VERSION_1_0" or func_extensions.get(func, "").startswith("KHR_")]
 
-	(*extensionNameCount) = extPropertyCount;
+# Handled by hand, as they have to hand out the wrappers
+interpose_intercepted_funcs = ["vkGetInstanceProcAddr", "vkGetDeviceProcAddr"]
 
-	if (extPropertyCount < 1)
-		return NULL;
+# Handed out by vkGetDeviceProcAddr() as wrappers of the driver's own functions
+interpose_device_funcs = [func for func in interpose_funcs if func in device_funcs]
 
 
-	char **extensionNames = (char**) calloc(extPropertyCount, sizeof(char*));
+with open("vkel_interpose.c", "wb") as f:
+	add_copyright(f)
 	
-	uint32_t extensionNameIndex = 0;
-	for (extensionNameIndex = 0; extensionNameIndex < extPropertyCount; extensionNameIndex++)
-	{
-		extensionNames[extensionNameIndex] = (char*) calloc(VK_MAX_EXTENSION_NAME_SIZE, sizeof(char));
-	}
-
-
-	VkExtensionProperties *extProperties = (VkExtensionProperties*) calloc(extPropertyCount, sizeof(VkExtensionProperties));
-	assert(extProperties);
-
-
-	err = vkEnumerateDeviceExtensionProperties(physicalDevice, pLayerName, &extPropertyCount, extProperties);
-	assert(!err);
 	
-	uint32_t extPropertyIndex = 0;
-	for (extPropertyIndex = 0; extPropertyIndex < extPropertyCount; extPropertyIndex++)
-	{
-		VkExtensionProperties extProperty = extProperties[extPropertyIndex];
-
-		vkel_strpy(extensionNames[extPropertyIndex], extProperty.extensionName);
-	}
+	f.write(br'''// vkel as an LD_PRELOAD interposer, which counts every Vulkan command of applications
+// linked against libvulkan, along with a histogram of how long they take. Nothing has
+// to be rebuilt or relinked:
+//
+//     gcc -O2 -fPIC -shared -fvisibility=hidden -o libvkel_interpose.so vkel_interpose.c -ldl
+//     LD_PRELOAD=./libvkel_interpose.so ./application
+//
+// Every command exported by libvulkan is exported again, and forwards to the next
+// definition found using dlsym(RTLD_NEXT). Functions handed out by vkGetInstanceProcAddr()
+// and vkGetDeviceProcAddr() are wrapped as well. The ones from vkGetDeviceProcAddr() time
+// the driver's own function rather than the trampoline of libvulkan, like the application
+// would have called. The statistics are written to VKEL_INTERPOSE_OUTPUT (or stderr) when
+// the process exits.
 
+#if defined(_WIN32)
+#	error vkel_interpose.c depends on LD_PRELOAD and dlsym(RTLD_NEXT), for Windows see vkel_layer.c
+#endif
 
-	free(extProperties);
+#if !defined(__GNUC__) && !defined(__clang__)
+#	error vkel_interpose.c needs GCC or Clang
+#endif
 
+#ifndef _GNU_SOURCE
+#	define _GNU_SOURCE
+#endif
 
-	return extensionNames;
-}
+#define VKEL_NO_FUNCTION_MACROS
+#include "vkel.h"
 
-char** vkelGetDeviceLayerNames(VkPhysicalDevice physicalDevice, uint32_t *layerNameCount)
-{
-	assert(layerNameCount);
+#include <stdio.h> /* fopen(), fprintf() */
+#include <stdlib.h> /* abort(), bsearch(), getenv() */
+#include <string.h> /* strcmp() */
 
+#include <dlfcn.h>
+#include <time.h>
 
-	VkResult err;
 
+#define VKEL_INTERPOSE_EXPORT __attribute__((visibility("default")))
 
-	uint32_t layerPropertyCount;
-	err = vkEnumerateDeviceLayerProperties(physicalDevice, &layerPropertyCount, NULL);
-	assert(!err);
 
-	(*layerNameCount) = layerPropertyCount;
+// Calls are put in a bucket per power of two nanoseconds, the last bucket takes everything above
+#ifndef VKEL_INTERPOSE_BUCKET_COUNT
+#	define VKEL_INTERPOSE_BUCKET_COUNT 32
+#endif
 
-	if (layerPropertyCount < 1)
-		return NULL;
+typedef struct VkelInterposeCommandStats {
+	uint64_t callCount;
+	uint64_t totalNanoseconds;
+	uint64_t buckets[VKEL_INTERPOSE_BUCKET_COUNT];
+} VkelInterposeCommandStats;
 
 
-	char **layerNames = (char**) calloc(layerPropertyCount, sizeof(char*));
+''')
 	
-	uint32_t layerNameIndex = 0;
-	for (layerNameIndex = 0; layerNameIndex < layerPropertyCount; layerNameIndex++)
-	{
-		layerNames[layerNameIndex] = (char*) calloc(VK_MAX_EXTENSION_NAME_SIZE, sizeof(char));
-	}
-
-
-	VkLayerProperties *layerProperties = (VkLayerProperties*) calloc(layerPropertyCount, sizeof(VkLayerProperties));
-	assert(layerProperties);
-
-	err = vkEnumerateDeviceLayerProperties(physicalDevice, &layerPropertyCount, layerProperties);
-	assert(!err);
 	
-	uint32_t layerPropertyIndex = 0;
-	for (layerPropertyIndex = 0; layerPropertyIndex < layerPropertyCount; layerPropertyIndex++)
+	lines = []
+	
+	lines.append("#define VKEL_INTERPOSE_COMMAND_COUNT {0}".format(len(interpose_funcs)))
+	lines.append("")
+	lines.append("static VkelInterposeCommandStats vkelInterposeStats[VKEL_INTERPOSE_COMMAND_COUNT];")
+	lines.append("")
+	lines.append("// Resolved on first use, so libvulkan may also be loaded after the interposer")
+	lines.append("static PFN_vkVoidFunction vkelInterposeNext[VKEL_INTERPOSE_COMMAND_COUNT];")
+	lines.append("")
+	lines.append("static const char* const vkelInterposeCommandNames[VKEL_INTERPOSE_COMMAND_COUNT] = {")
+	
+	for func in interpose_funcs:
+		lines.append("\t\"{0}\",".format(func))
+	
+	lines.append("};")
+	lines.append("")
+	lines.append("")
+	
+	f.write("\n".join(lines).encode("utf-8"))
+	
+	
+	f.write(br'''static PFN_vkVoidFunction vkelInterposeGetNext(uint32_t index)
+{
+	PFN_vkVoidFunction next = __atomic_load_n(&vkelInterposeNext[index], __ATOMIC_ACQUIRE);
+	void *symbol;
+	
+	if (next)
+		return next;
+	
+	symbol = dlsym(RTLD_NEXT, vkelInterposeCommandNames[index]);
+	
+	if (!symbol)
 	{
-		VkLayerProperties layerProperty = layerProperties[layerPropertyIndex];
-
-		vkel_strpy(layerNames[layerPropertyIndex], layerProperty.layerName);
+		fprintf(stderr, "vkel: %s isn't defined by any library after the interposer\n", vkelInterposeCommandNames[index]);
+		abort();
 	}
+	
+	// Converting from void* is undefined in ISO C, but it's what dlsym() is for
+	*(void**) &next = symbol;
+	
+	__atomic_store_n(&vkelInterposeNext[index], next, __ATOMIC_RELEASE);
+	
+	return next;
+}
 
+static uint64_t vkelInterposeGetNanoseconds(void)
+{
+	struct timespec now;
+	
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	
+	return (uint64_t) now.tv_sec * 1000000000u + (uint64_t) now.tv_nsec;
+}
 
-	free(layerProperties);
-
-
-	return layerNames;
+static void vkelInterposeEndCall(uint32_t index, uint64_t start)
+{
+	VkelInterposeCommandStats *pStats = &vkelInterposeStats[index];
+	uint64_t elapsed = vkelInterposeGetNanoseconds() - start;
+	uint32_t bucket = elapsed ? (uint32_t) (63 - __builtin_clzll(elapsed)) : 0;
+	
+	if (bucket >= VKEL_INTERPOSE_BUCKET_COUNT)
+		bucket = VKEL_INTERPOSE_BUCKET_COUNT - 1;
+	
+	__atomic_fetch_add(&pStats->callCount, 1, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&pStats->totalNanoseconds, elapsed, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&pStats->buckets[bucket], 1, __ATOMIC_RELAXED);
 }
 
 
-VkBool32 vkelIsInstanceLayerSupported(const char *pLayerName)
+// The upper bound (in nanoseconds) of the bucket the given fraction of calls fall within
+static unsigned long long vkelInterposeGetPercentile(const VkelInterposeCommandStats *pStats, uint64_t callCount, double fraction)
 {
-	uint32_t layerNameCount = 0;
-	char **layerNames = vkelGetInstanceLayerNames(&layerNameCount);
+	uint64_t target = (uint64_t) ((double) callCount * fraction);
+	uint64_t count = 0;
+	uint32_t i;
 	
-	uint32_t layerNameIndex = 0;
-	for (layerNameIndex = 0; layerNameIndex < layerNameCount; layerNameIndex++)
+	for (i = 0; i < VKEL_INTERPOSE_BUCKET_COUNT; ++i)
 	{
-		if (vkel_strcmp(layerNames[layerNameIndex], pLayerName))
-		{
-			vkelDeleteInstanceLayerNames(layerNameCount, layerNames);
-
-			return VK_TRUE;
-		}
+		count += pStats->buckets[i];
+		
+		if (count > target)
+			break;
 	}
-
-	vkelDeleteInstanceLayerNames(layerNameCount, layerNames);
-
-	return VK_FALSE;
+	
+	return (i + 1 >= 64) ? ~0ull : (1ull << (i + 1));
 }
 
-VkBool32 vkelIsInstanceExtensionSupported(const char *pLayerName, const char *pExtensionName)
+static void vkelInterposeWriteReport(void)
 {
-	uint32_t extensionNameCount = 0;
-	char **extensionNames = vkelGetInstanceExtensionNames(pLayerName, &extensionNameCount);
+	const char *pPath = getenv("VKEL_INTERPOSE_OUTPUT");
+	FILE *file = pPath ? fopen(pPath, "w") : stderr;
+	uint32_t i, j;
+	
+	if (!file)
+		return;
+	
+	fprintf(file, "%-48s %12s %14s %10s %10s %10s\n", "command", "calls", "total (us)", "avg (ns)", "p50 (ns)", "p99 (ns)");
 	
-	uint32_t extensionNameIndex = 0;
-	for (extensionNameIndex = 0; extensionNameIndex < extensionNameCount; extensionNameIndex++)
+	for (i = 0; i < VKEL_INTERPOSE_COMMAND_COUNT; ++i)
 	{
-		if (vkel_strcmp(extensionNames[extensionNameIndex], pExtensionName))
-		{
-			vkelDeleteInstanceExtensionNames(extensionNameCount, extensionNames);
-
-			return VK_TRUE;
-		}
+		const VkelInterposeCommandStats *pStats = &vkelInterposeStats[i];
+		unsigned long long callCount = (unsigned long long) __atomic_load_n(&pStats->callCount, __ATOMIC_RELAXED);
+		unsigned long long totalNanoseconds = (unsigned long long) __atomic_load_n(&pStats->totalNanoseconds, __ATOMIC_RELAXED);
+		
+		if (!callCount)
+			continue;
+		
+		fprintf(file, "%-48s %12llu %14.1f %10llu %10llu %10llu\n", vkelInterposeCommandNames[i], callCount, (double) totalNanoseconds / 1000.0, totalNanoseconds / callCount,
+			vkelInterposeGetPercentile(pStats, callCount, 0.5), vkelInterposeGetPercentile(pStats, callCount, 0.99));
+		
+		// Histogram, as the number of calls that took less than each power of two nanoseconds
+		fprintf(file, "   ");
+		
+		for (j = 0; j < VKEL_INTERPOSE_BUCKET_COUNT; ++j)
+			if (pStats->buckets[j])
+				fprintf(file, " <%llu:%llu", 1ull << (j + 1), (unsigned long long) pStats->buckets[j]);
+		
+		fprintf(file, "\n");
 	}
+	
+	if (file != stderr)
+		fclose(file);
+}
 
-	vkelDeleteInstanceExtensionNames(extensionNameCount, extensionNames);
-
-	return VK_FALSE;
+__attribute__((destructor)) static void vkelInterposeUnload(void)
+{
+	vkelInterposeWriteReport();
 }
 
 
-VkBool32 vkelIsDeviceLayerSupported(VkPhysicalDevice physicalDevice, const char *pLayerName)
-{
-	uint32_t layerNameCount = 0;
-	char **layerNames = vkelGetDeviceLayerNames(physicalDevice, &layerNameCount);
-	
-	uint32_t layerNameIndex = 0;
-	for (layerNameIndex = 0; layerNameIndex < layerNameCount; layerNameIndex++)
-	{
-		if (vkel_strcmp(layerNames[layerNameIndex], pLayerName))
-		{
-			vkelDeleteDeviceLayerNames(layerNameCount, layerNames);
+// Devices whose functions were handed out by vkGetDeviceProcAddr(), by dispatch key (the first
+// pointer of a device, and of its queues and command buffers). Functions of any more devices
+// are timed through the trampolines of libvulkan instead.
+#ifndef VKEL_INTERPOSE_MAX_DEVICES
+#	define VKEL_INTERPOSE_MAX_DEVICES 16
+#endif
 
-			return VK_TRUE;
-		}
-	}
+typedef struct VkelInterposeDevice {
+	const void *dispatchKey;
+	PFN_vkVoidFunction functions[VKEL_INTERPOSE_COMMAND_COUNT];
+} VkelInterposeDevice;
 
-	vkelDeleteDeviceLayerNames(layerNameCount, layerNames);
+static VkelInterposeDevice vkelInterposeDevices[VKEL_INTERPOSE_MAX_DEVICES];
 
-	return VK_FALSE;
+static const void* vkelInterposeGetDispatchKey(const void *handle)
+{
+	return *(const void* const*) handle;
 }
 
-VkBool32 vkelIsDeviceExtensionSupported(VkPhysicalDevice physicalDevice, const char *pLayerName, const char *pExtensionName)
+static VkelInterposeDevice* vkelInterposeFindDevice(const void *dispatchKey)
 {
-	uint32_t extensionNameCount = 0;
-	char **extensionNames = vkelGetDeviceExtensionNames(physicalDevice, pLayerName, &extensionNameCount);
+	uint32_t i;
 	
-	uint32_t extensionNameIndex = 0;
-	for (extensionNameIndex = 0; extensionNameIndex < extensionNameCount; extensionNameIndex++)
-	{
-		if (vkel_strcmp(extensionNames[extensionNameIndex], pExtensionName))
-		{
-			vkelDeleteDeviceExtensionNames(extensionNameCount, extensionNames);
-
-			return VK_TRUE;
-		}
-	}
-
-	vkelDeleteDeviceExtensionNames(extensionNameCount, extensionNames);
-
-	return VK_FALSE;
+	// Free slots have no key
+	if (!dispatchKey)
+		return NULL;
+	
+	for (i = 0; i < VKEL_INTERPOSE_MAX_DEVICES; ++i)
+		if (__atomic_load_n(&vkelInterposeDevices[i].dispatchKey, __ATOMIC_ACQUIRE) == dispatchKey)
+			return &vkelInterposeDevices[i];
+	
+	return NULL;
 }
 
-''')
+static VkelInterposeDevice* vkelInterposeAddDevice(const void *dispatchKey)
+{
+	VkelInterposeDevice *pDevice = vkelInterposeFindDevice(dispatchKey);
+	uint32_t i;
 	
+	if (pDevice || !dispatchKey)
+		return pDevice;
 	
-	# vkelInit()
+	for (i = 0; i < VKEL_INTERPOSE_MAX_DEVICES; ++i)
+	{
+		const void *expected = NULL;
 		
-	f.write(br'''
-VkBool32 vkelInit(void)
-{
-	vkelUninit();
+		if (__atomic_compare_exchange_n(&vkelInterposeDevices[i].dispatchKey, &expected, dispatchKey, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+			return &vkelInterposeDevices[i];
+	}
 	
-#ifdef VK_USE_PLATFORM_WIN32_KHR
-	const char *name = "vulkan-1.dll";
-#else
-	const char *name = "libvulkan.so.1";
-#endif
+	return NULL;
+}
+
+// Called once the device is destroyed, so the slot can be taken by another one
+static void vkelInterposeRemoveDevice(const void *dispatchKey)
+{
+	VkelInterposeDevice *pDevice = vkelInterposeFindDevice(dispatchKey);
+	uint32_t i;
 	
-	vkelVkLibHandle = vkelPlatformOpenLibrary(name);
+	if (!pDevice)
+		return;
 	
-	if (!vkelVkLibHandle)
-		return VK_FALSE;
+	for (i = 0; i < VKEL_INTERPOSE_COMMAND_COUNT; ++i)
+		__atomic_store_n(&pDevice->functions[i], NULL, __ATOMIC_RELAXED);
 	
+	__atomic_store_n(&pDevice->dispatchKey, NULL, __ATOMIC_RELEASE);
+}
+
+// The driver's function for the device the handle belongs to, or the trampoline when the
+// device is unknown
+static PFN_vkVoidFunction vkelInterposeGetDeviceFunction(const void *handle, uint32_t index)
+{
+	VkelInterposeDevice *pDevice = vkelInterposeFindDevice(vkelInterposeGetDispatchKey(handle));
+	PFN_vkVoidFunction function = pDevice ? __atomic_load_n(&pDevice->functions[index], __ATOMIC_ACQUIRE) : NULL;
 	
+	return function ? function : vkelInterposeGetNext(index);
+}
+
+
 ''')
 	
 	
 	lines = []
 	
-	for platform in sorted(platform_funcs):
+	for index, func in enumerate(interpose_funcs):
+		if func in interpose_intercepted_funcs:
+			continue
+		
+		platform = func_platforms[func]
+		return_type, params = command_info[func]
+		
+		call = "((PFN_{0}) vkelInterposeGetNext({1}))({2})".format(func, index, ", ".join(param[1] for param in params))
+		
 		if platform:
 			lines.append("#ifdef " + platform)
 		
-		for func in sorted(platform_funcs[platform]):
-			lines.append("\t__{0} = (PFN_{0}) vkelGetProcAddr(\"{0}\");".format(func))
+		lines.append("VKEL_INTERPOSE_EXPORT VKAPI_ATTR {0} VKAPI_CALL {1}({2})".format(return_type, func, ", ".join("{0} {1}{2}".format(*param) for param in params)))
+		lines.append("{")
+		lines.append("\tuint64_t start = vkelInterposeGetNanoseconds();")
+		
+		if func == "vkDestroyDevice":
+			lines.append("\tconst void *dispatchKey = device ? vkelInterposeGetDispatchKey(device) : NULL;")
+		
+		if return_type == "void":
+			lines.append("\t{0};".format(call))
+			lines.append("\tvkelInterposeEndCall({0}, start);".format(index))
+		else:
+			lines.append("\t{0} result = {1};".format(return_type, call))
+			lines.append("\tvkelInterposeEndCall({0}, start);".format(index))
+		
+		if func == "vkDestroyDevice":
+			lines.append("\tvkelInterposeRemoveDevice(dispatchKey);")
+		
+		if return_type != "void":
+			lines.append("\treturn result;")
+		
+		lines.append("}")
 		
 		if platform:
 			lines.append("#endif /* " + platform + " */")
-		
-		lines.append("")
 	
 	lines.append("")
+	lines.append("")
 	
-	
-	lines.append("\t// Instance and device extension names")
-	
-	# Are there any (instance or device) extensions? (is array empty)
-	if extension_names:
-		for extension_name in sorted(extension_names):
-			if extension_name:
-				lines.append("\tVKEL_" + extension_name + " = vkelIsInstanceExtensionSupported(NULL, \"VK_" + extension_name + "\");")
+	# The same, but calling the driver's function found by the dispatch key
+	for func in interpose_device_funcs:
+		index = interpose_funcs.index(func)
+		platform = func_platforms[func]
+		return_type, params = command_info[func]
+		
+		call = "function({0})".format(", ".join(param[1] for param in params))
+		
+		if platform:
+			lines.append("#ifdef " + platform)
+		
+		lines.append("static VKAPI_ATTR {0} VKAPI_CALL vkelInterposeDevice{1}({2})".format(return_type, func[2:], ", ".join("{0} {1}{2}".format(*param) for param in params)))
+		lines.append("{")
+		lines.append("\tPFN_{0} function = (PFN_{0}) vkelInterposeGetDeviceFunction({1}, {2});".format(func, params[0][1], index))
+		
+		if func == "vkDestroyDevice":
+			lines.append("\tconst void *dispatchKey = vkelInterposeGetDispatchKey(device);")
+		
+		lines.append("\tuint64_t start = vkelInterposeGetNanoseconds();")
+		
+		if return_type == "void":
+			lines.append("\t{0};".format(call))
+			lines.append("\tvkelInterposeEndCall({0}, start);".format(index))
+		else:
+			lines.append("\t{0} result = {1};".format(return_type, call))
+			lines.append("\tvkelInterposeEndCall({0}, start);".format(index))
+		
+		if func == "vkDestroyDevice":
+			lines.append("\tvkelInterposeRemoveDevice(dispatchKey);")
+		
+		if return_type != "void":
+			lines.append("\treturn result;")
+		
+		lines.append("}")
+		
+		if platform:
+			lines.append("#endif /* " + platform + " */")
 	
 	lines.append("")
+	lines.append("")
 	
+	lines.append("VKEL_INTERPOSE_EXPORT VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetInstanceProcAddr(VkInstance instance, const char* pName);")
+	lines.append("VKEL_INTERPOSE_EXPORT VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetDeviceProcAddr(VkDevice device, const char* pName);")
+	lines.append("")
+	lines.append("typedef struct VkelInterposeCommand {")
+	lines.append("\tconst char *pName;")
+	lines.append("\tPFN_vkVoidFunction function;")
+	lines.append("\tuint32_t index;")
+	lines.append("\tPFN_vkVoidFunction deviceFunction;")
+	lines.append("} VkelInterposeCommand;")
+	lines.append("")
+	lines.append("// Sorted by name for bsearch()")
+	lines.append("static const VkelInterposeCommand vkelInterposeCommands[] = {")
 	
-	lines.append("\t// Instance and device layer names")
-	
-	# Are there any (instance or device) layers? (is array empty)
-	if layer_names:
-		for layer_name in sorted(layer_names):
-			if layer_name:
-				lines.append("\tVKEL_" + layer_name + " = vkelIsInstanceLayerSupported(\"VK_" + layer_name + "\");")
+	for func in sorted(interpose_funcs):
+		platform = func_platforms[func]
+		
+		if platform:
+			lines.append("#ifdef " + platform)
+		
+		if func in interpose_device_funcs:
+			lines.append("\t{{ \"{0}\", (PFN_vkVoidFunction) {0}, {1}, (PFN_vkVoidFunction) vkelInterposeDevice{2} }},".format(func, interpose_funcs.index(func), func[2:]))
+		else:
+			lines.append("\t{{ \"{0}\", (PFN_vkVoidFunction) {0}, {1}, NULL }},".format(func, interpose_funcs.index(func)))
+		
+		if platform:
+			lines.append("#endif /* " + platform + " */")
 	
+	lines.append("};")
+	lines.append("")
 	lines.append("")
-	
 	
 	f.write("\n".join(lines).encode("utf-8"))
 	
 	
-	f.write(br'''
-	
-	return VK_TRUE;
+	f.write(br'''static int vkelInterposeCompareCommand(const void *pName, const void *pCommand)
+{
+	return strcmp((const char*) pName, ((const VkelInterposeCommand*) pCommand)->pName);
 }
-	''')
+
+static const VkelInterposeCommand* vkelInterposeFindCommand(const char *pName)
+{
+	return (const VkelInterposeCommand*) bsearch(pName, vkelInterposeCommands, sizeof(vkelInterposeCommands) / sizeof(vkelInterposeCommands[0]), sizeof(vkelInterposeCommands[0]), vkelInterposeCompareCommand);
+}
+
+// Hands out the interposed function instead, when the command exists. Other commands (like
+// EXT ones) aren't exported by libvulkan, so they are handed out as is and aren't counted.
+static PFN_vkVoidFunction vkelInterposeWrap(const char *pName, PFN_vkVoidFunction function)
+{
+	const VkelInterposeCommand *pCommand;
 	
+	if (!function)
+		return NULL;
 	
-	# vkelInstanceInit()
-		
-	f.write(br'''
-VkBool32 vkelInstanceInit(VkInstance instance)
+	pCommand = vkelInterposeFindCommand(pName);
+	
+	return pCommand ? pCommand->function : function;
+}
+
+// Device functions are the driver's own, which skip the trampolines of libvulkan. They are
+// kept for the device, and handed out as a wrapper which times them instead.
+static PFN_vkVoidFunction vkelInterposeWrapDevice(VkDevice device, const char *pName, PFN_vkVoidFunction function)
 {
-	if (!vkelVkLibHandle && !vkelInit())
-		return VK_FALSE;
+	const VkelInterposeCommand *pCommand;
+	VkelInterposeDevice *pDevice;
+	
+	if (!function)
+		return NULL;
+	
+	pCommand = vkelInterposeFindCommand(pName);
+	
+	// Or the next library handed out the interposed function already, which would count twice
+	if (!pCommand || function == pCommand->function)
+		return function;
 	
+	if (!pCommand->deviceFunction || !(pDevice = vkelInterposeAddDevice(vkelInterposeGetDispatchKey(device))))
+		return pCommand->function;
 	
+	__atomic_store_n(&pDevice->functions[pCommand->index], function, __ATOMIC_RELEASE);
+	
+	return pCommand->deviceFunction;
+}
+
 ''')
 	
 	
 	lines = []
 	
-	for platform in sorted(platform_funcs):
-		if platform:
-			lines.append("#ifdef " + platform)
-		
-		for func in sorted(platform_funcs[platform]):
-			lines.append("\t__{0} = (PFN_{0}) vkelGetInstanceProcAddr(instance, \"{0}\");".format(func))
-		
-		if platform:
-			lines.append("#endif /* " + platform + " */")
+	for func, handle_type, handle_name, wrap in (("vkGetInstanceProcAddr", "VkInstance", "instance", "vkelInterposeWrap(pName, "), ("vkGetDeviceProcAddr", "VkDevice", "device", "vkelInterposeWrapDevice(device, pName, ")):
+		index = interpose_funcs.index(func)
 		
+		lines.append("VKEL_INTERPOSE_EXPORT VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL {0}({1} {2}, const char* pName)".format(func, handle_type, handle_name))
+		lines.append("{")
+		lines.append("\tuint64_t start = vkelInterposeGetNanoseconds();")
+		lines.append("\tPFN_vkVoidFunction function = {3}((PFN_{0}) vkelInterposeGetNext({1}))({2}, pName));".format(func, index, handle_name, wrap))
+		lines.append("\tvkelInterposeEndCall({0}, start);".format(index))
+		lines.append("\treturn function;")
+		lines.append("}")
 		lines.append("")
 	
-	lines.append("")
-	
+	f.write("\n".join(lines).encode("utf-8"))
+
+
+print("Generating vkel_shim.c")
+
+
+# Same commands as the Vulkan loader exports
+shim_funcs = interpose_funcs
+
+# Written by hand, everything else is a thunk
+shim_intercepted_funcs = ["vkGetInstanceProcAddr", "vkCreateInstance"]
+
+
+with open("vkel_shim.c", "wb") as f:
+	add_copyright(f)
 	
-	lines.append("\t// Instance and device extension names")
 	
-	# Are there any (instance or device) extensions? (is array empty)
-	if extension_names:
-		for extension_name in sorted(extension_names):
-			if extension_name:
-				lines.append("\tVKEL_" + extension_name + " = vkelIsInstanceExtensionSupported(NULL, \"VK_" + extension_name + "\");")
+	f.write(br'''// vkel as a drop-in replacement for libvulkan.so.1, for binaries that can't be rebuilt.
+// It loads an ICD directly (like vkelInitDirectICD()) and every exported command is a thunk
+// which jumps straight into the ICD, through a table filled by vkCreateInstance(). That
+// skips the loader's trampolines, as well as its layers and support for multiple ICDs:
+//
+//     gcc -O2 -fPIC -shared -fvisibility=hidden -Wl,-soname,libvulkan.so.1 -o libvulkan.so.1 vkel_shim.c vkel.c -ldl -lpthread
+//     LD_LIBRARY_PATH=. ./application
+//
+// The ICD is read from the manifest in VKEL_SHIM_ICD, otherwise the first one found in
+// VK_ICD_FILENAMES, /usr/share/vulkan/icd.d or /etc/vulkan/icd.d is used. Only a single
+// instance is supported at a time.
+
+#define VKEL_NO_FUNCTION_MACROS
+#include "vkel.h"
+
+#include <stdio.h> /* fprintf() */
+#include <stdlib.h> /* abort(), getenv() */
+#include <string.h> /* strcmp() */
+
+
+#if !defined(__x86_64__) && !defined(__aarch64__)
+#	error vkel_shim.c has thunks for x86-64 and AArch64 only
+#endif
+
+#if !defined(__ELF__)
+#	error vkel_shim.c replaces libvulkan.so.1 and needs an ELF target
+#endif
+
+#define VKEL_SHIM_EXPORT __attribute__((visibility("default")))
+
+
+''')
 	
-	lines.append("")
 	
+	lines = []
 	
-	lines.append("\t// Instance and device layer names")
+	lines.append("#define VKEL_SHIM_COMMAND_COUNT {0}".format(len(shim_funcs)))
+	lines.append("")
+	lines.append("// Read by the thunks, so it must be neither static nor exported")
+	lines.append("__attribute__((visibility(\"hidden\"), used)) PFN_vkVoidFunction vkelShimTable[VKEL_SHIM_COMMAND_COUNT];")
+	lines.append("")
+	lines.append("static const char* const vkelShimCommandNames[VKEL_SHIM_COMMAND_COUNT] = {")
 	
-	# Are there any (instance or device) layers? (is array empty)
-	if layer_names:
-		for layer_name in sorted(layer_names):
-			if layer_name:
-				lines.append("\tVKEL_" + layer_name + " = vkelIsInstanceLayerSupported(\"VK_" + layer_name + "\");")
+	for func in shim_funcs:
+		lines.append("\t\"{0}\",".format(func))
 	
+	lines.append("};")
+	lines.append("")
 	lines.append("")
-	
 	
 	f.write("\n".join(lines).encode("utf-8"))
 	
 	
-	f.write(br'''
-	
-	return VK_TRUE;
+	f.write(br'''// A single indirect jump on x86-64, while AArch64 needs the address in a register first.
+// x16 is the intra-procedure-call scratch register, so it's free to use here.
+#if defined(__x86_64__)
+#	define VKEL_SHIM_JUMP(index) "\tjmp *vkelShimTable+8*" #index "(%rip)\n"
+#elif defined(__aarch64__)
+#	define VKEL_SHIM_JUMP(index) \
+		"\tadrp x16, vkelShimTable+8*" #index "\n" \
+		"\tldr x16, [x16, #:lo12:vkelShimTable+8*" #index "]\n" \
+		"\tbr x16\n"
+#endif
+
+#define VKEL_SHIM_THUNK(name, index) \
+	__asm__( \
+		"\t.pushsection .text\n" \
+		"\t.globl " #name "\n" \
+		"\t.type " #name ", %function\n" \
+		"\t.p2align 4\n" \
+		#name ":\n" \
+		VKEL_SHIM_JUMP(index) \
+		"\t.size " #name ", .-" #name "\n" \
+		"\t.popsection\n");
+
+
+// Where the commands the ICD doesn't have (or that are called before vkCreateInstance()) end up
+static void vkelShimUnavailable(void)
+{
+	fprintf(stderr, "vkel: called a Vulkan command which isn't available, or before vkCreateInstance()\n");
+	abort();
 }
-	''')
-	
-	
-	# vkelDeviceInit()
-	
-	f.write(br'''
-VkBool32 vkelDeviceInit(VkPhysicalDevice physicalDevice, VkDevice device)
+
+static void vkelShimFillTable(VkInstance instance)
 {
-	if (!vkelVkLibHandle && !vkelInit())
-		return VK_FALSE;
+	uint32_t i;
 	
+	for (i = 0; i < VKEL_SHIM_COMMAND_COUNT; ++i)
+	{
+		PFN_vkVoidFunction function = vkelGetInstanceProcAddr(instance, vkelShimCommandNames[i]);
+		
+		__atomic_store_n(&vkelShimTable[i], function ? function : (PFN_vkVoidFunction) vkelShimUnavailable, __ATOMIC_RELEASE);
+	}
+}
+
+__attribute__((constructor)) static void vkelShimLoad(void)
+{
+	uint32_t i;
 	
+	if (vkelInitDirectICD(getenv("VKEL_SHIM_ICD")))
+		vkelShimFillTable(VK_NULL_HANDLE);
+	else
+	{
+		fprintf(stderr, "vkel: no Vulkan ICD could be loaded\n");
+		
+		for (i = 0; i < VKEL_SHIM_COMMAND_COUNT; ++i)
+			vkelShimTable[i] = (PFN_vkVoidFunction) vkelShimUnavailable;
+	}
+}
+
+__attribute__((destructor)) static void vkelShimUnload(void)
+{
+	vkelUninit();
+}
+
+
 ''')
 	
 	
 	lines = []
 	
-	for platform in sorted(platform_funcs):
+	for index, func in enumerate(shim_funcs):
+		if func in shim_intercepted_funcs:
+			continue
+		
+		platform = func_platforms[func]
+		
 		if platform:
 			lines.append("#ifdef " + platform)
 		
-		for func in sorted(platform_funcs[platform]):
-			lines.append("\t__{0} = (PFN_{0}) vkelGetDeviceProcAddr(device, \"{0}\");".format(func))
+		lines.append("VKEL_SHIM_THUNK({0}, {1})".format(func, index))
 		
 		if platform:
 			lines.append("#endif /* " + platform + " */")
-		
-		lines.append("")
 	
 	lines.append("")
-	
-	
-	lines.append("\t// Instance and device extension names")
-	
-	# Are there any (instance or device) extensions? (is array empty)
-	if extension_names:
-		for extension_name in sorted(extension_names):
-			if extension_name:
-				lines.append("\tVKEL_" + extension_name + " = vkelIsDeviceExtensionSupported(physicalDevice, NULL, \"VK_" + extension_name + "\");")
-	
 	lines.append("")
 	
+	f.write("\n".join(lines).encode("utf-8"))
 	
-	lines.append("\t// Instance and device layer names")
-	
-	# Are there any (instance or device) layers? (is array empty)
-	if layer_names:
-		for layer_name in sorted(layer_names):
-			if layer_name:
-				lines.append("\tVKEL_" + layer_name + " = vkelIsDeviceLayerSupported(physicalDevice, \"VK_" + layer_name + "\");")
-	
-	lines.append("")
 	
+	f.write(br'''VKEL_SHIM_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateInstance(const VkInstanceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkInstance* pInstance);
+VKEL_SHIM_EXPORT VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetInstanceProcAddr(VkInstance instance, const char* pName);
+
+VKAPI_ATTR VkResult VKAPI_CALL vkCreateInstance(const VkInstanceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkInstance* pInstance)
+{
+	if (!vkelTable.CreateInstance)
+		return VK_ERROR_INITIALIZATION_FAILED;
 	
-	f.write("\n".join(lines).encode("utf-8"))
+	VkResult result = vkelTable.CreateInstance(pCreateInfo, pAllocator, pInstance);
 	
+	if (result != VK_SUCCESS)
+		return result;
 	
-	f.write(br'''
+	// The ICD's own functions, so calls through the thunks never touch vkel again
+	vkelInstanceInit(*pInstance);
+	vkelShimFillTable(*pInstance);
 	
-	return VK_TRUE;
+	return VK_SUCCESS;
 }
-	''')
-	
-	
-	f.write(br'''
-void vkelUninit(void)
+
+// Everything else is handed out as is, which is as direct as it gets
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetInstanceProcAddr(VkInstance instance, const char* pName)
 {
-	if (vkelVkLibHandle)
-	{
-		vkelPlatformCloseLibrary(vkelVkLibHandle);
-		vkelVkLibHandle = NULL;
-	}
-}
-	''')
-	
-	f.write(b"\n")
+	if (!strcmp(pName, "vkGetInstanceProcAddr"))
+		return (PFN_vkVoidFunction) vkGetInstanceProcAddr;
 	
+	if (!strcmp(pName, "vkCreateInstance"))
+		return (PFN_vkVoidFunction) vkCreateInstance;
 	
-	f.write(br'''
-#ifdef __cplusplus
+	return vkelGetInstanceProcAddr(instance, pName);
 }
-#endif /* __cplusplus */''')
+''')
 
 
 print("Done")
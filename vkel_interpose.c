@@ -0,0 +1,2810 @@
+//========================================================================
+// Name
+//     Vulkan (Cross-Platform) Extension Loader
+//
+// Repository
+//     https://github.com/MrVallentin/vkel
+//
+// Overview
+//     This is a simple, dynamic and tiny cross-platform Vulkan
+//     extension loader.
+//
+// Dependencies
+//     Vulkan (library)
+//     Windows (header) - needed for library loading on Windows
+//     dlfcn (header) - needed for library loading on non-Windows OS'
+//     dirent (header) - needed for vkelInitDirectICD() on non-Windows OS'
+//     pthread (header) - needed for vkelInitAsync() on non-Windows OS'
+//     fcntl, unistd (headers) - needed for vkelPrewarm() on non-Windows OS'
+//     Standard C Libraries (stdio, stdlib, string, assert) - needed for NULL, malloc()
+//                                                 calloc(), free(), memset(), assert()
+//
+// Notice
+//     Copyright (c) 2016 Christian Vallentin <mail@vallentinsource.com>
+//
+// Developers & Contributors
+//     Christian Vallentin <mail@vallentinsource.com>
+//
+// Version History
+//     Last Modified Date: May 16, 2016
+//     Revision: 14
+//     Version: 2.0.11
+//
+// Revision History
+//     Revision 12, 2016/05/02
+//       - Fixed "for loop initial declarations are only
+//         allowed in C99 mode".
+//
+//     Revision 3, 2016/02/26
+//       - Rewrote vkel_gen.py, now it parses and directly
+//         adds vulkan.h and vk_platform.h into vkel.h,
+//         along with moving the appropriate copyrights
+//         to the top of vkel.h.
+//       - Fixed/added better differentiation for instance
+//         and device related calls.
+//       - Removed the need for having the vukan.h and
+//         vk_platform.h headers.
+//
+//     Revision 2, 2016/02/24
+//       - Created a Python script for automatically generating
+//         all the extensions and their functions. (Tested with
+//         Python 3.5.1)
+//       - Added cross-platform support, for loading libraries
+//         and getting the function addresses.
+//       - Fixed so platform specific functions defaults to NULL
+//       - Added missing include for dlfcn (used on non-Window OS')
+//
+//     Revision 1, 2016/02/23
+//       - Implemented the basic version supporting a few (manually
+//         written) dynamically loaded functions.
+//
+//------------------------------------------------------------------------
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+// OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//========================================================================
+
+/*
+** Copyright (c) 2015-2016 The Khronos Group Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+// vkel as an LD_PRELOAD interposer, which counts every Vulkan command of applications
+// linked against libvulkan, along with a histogram of how long they take. Nothing has
+// to be rebuilt or relinked:
+//
+//     gcc -O2 -fPIC -shared -fvisibility=hidden -o libvkel_interpose.so vkel_interpose.c -ldl
+//     LD_PRELOAD=./libvkel_interpose.so ./application
+//
+// Every command exported by libvulkan is exported again, and forwards to the next
+// definition found using dlsym(RTLD_NEXT). Functions handed out by vkGetInstanceProcAddr()
+// and vkGetDeviceProcAddr() are wrapped as well. The ones from vkGetDeviceProcAddr() time
+// the driver's own function rather than the trampoline of libvulkan, like the application
+// would have called. The statistics are written to VKEL_INTERPOSE_OUTPUT (or stderr) when
+// the process exits.
+
+#if defined(_WIN32)
+#	error vkel_interpose.c depends on LD_PRELOAD and dlsym(RTLD_NEXT), for Windows see vkel_layer.c
+#endif
+
+#if !defined(__GNUC__) && !defined(__clang__)
+#	error vkel_interpose.c needs GCC or Clang
+#endif
+
+#ifndef _GNU_SOURCE
+#	define _GNU_SOURCE
+#endif
+
+#define VKEL_NO_FUNCTION_MACROS
+#include "vkel.h"
+
+#include <stdio.h> /* fopen(), fprintf() */
+#include <stdlib.h> /* abort(), bsearch(), getenv() */
+#include <string.h> /* strcmp() */
+
+#include <dlfcn.h>
+#include <time.h>
+
+
+#define VKEL_INTERPOSE_EXPORT __attribute__((visibility("default")))
+
+
+// Calls are put in a bucket per power of two nanoseconds, the last bucket takes everything above
+#ifndef VKEL_INTERPOSE_BUCKET_COUNT
+#	define VKEL_INTERPOSE_BUCKET_COUNT 32
+#endif
+
+typedef struct VkelInterposeCommandStats {
+	uint64_t callCount;
+	uint64_t totalNanoseconds;
+	uint64_t buckets[VKEL_INTERPOSE_BUCKET_COUNT];
+} VkelInterposeCommandStats;
+
+
+#define VKEL_INTERPOSE_COMMAND_COUNT 166
+
+static VkelInterposeCommandStats vkelInterposeStats[VKEL_INTERPOSE_COMMAND_COUNT];
+
+// Resolved on first use, so libvulkan may also be loaded after the interposer
+static PFN_vkVoidFunction vkelInterposeNext[VKEL_INTERPOSE_COMMAND_COUNT];
+
+static const char* const vkelInterposeCommandNames[VKEL_INTERPOSE_COMMAND_COUNT] = {
+	"vkCreateInstance",
+	"vkDestroyInstance",
+	"vkEnumeratePhysicalDevices",
+	"vkGetPhysicalDeviceFeatures",
+	"vkGetPhysicalDeviceFormatProperties",
+	"vkGetPhysicalDeviceImageFormatProperties",
+	"vkGetPhysicalDeviceProperties",
+	"vkGetPhysicalDeviceQueueFamilyProperties",
+	"vkGetPhysicalDeviceMemoryProperties",
+	"vkGetInstanceProcAddr",
+	"vkGetDeviceProcAddr",
+	"vkCreateDevice",
+	"vkDestroyDevice",
+	"vkEnumerateInstanceExtensionProperties",
+	"vkEnumerateDeviceExtensionProperties",
+	"vkEnumerateInstanceLayerProperties",
+	"vkEnumerateDeviceLayerProperties",
+	"vkGetDeviceQueue",
+	"vkQueueSubmit",
+	"vkQueueWaitIdle",
+	"vkDeviceWaitIdle",
+	"vkAllocateMemory",
+	"vkFreeMemory",
+	"vkMapMemory",
+	"vkUnmapMemory",
+	"vkFlushMappedMemoryRanges",
+	"vkInvalidateMappedMemoryRanges",
+	"vkGetDeviceMemoryCommitment",
+	"vkBindBufferMemory",
+	"vkBindImageMemory",
+	"vkGetBufferMemoryRequirements",
+	"vkGetImageMemoryRequirements",
+	"vkGetImageSparseMemoryRequirements",
+	"vkGetPhysicalDeviceSparseImageFormatProperties",
+	"vkQueueBindSparse",
+	"vkCreateFence",
+	"vkDestroyFence",
+	"vkResetFences",
+	"vkGetFenceStatus",
+	"vkWaitForFences",
+	"vkCreateSemaphore",
+	"vkDestroySemaphore",
+	"vkCreateEvent",
+	"vkDestroyEvent",
+	"vkGetEventStatus",
+	"vkSetEvent",
+	"vkResetEvent",
+	"vkCreateQueryPool",
+	"vkDestroyQueryPool",
+	"vkGetQueryPoolResults",
+	"vkCreateBuffer",
+	"vkDestroyBuffer",
+	"vkCreateBufferView",
+	"vkDestroyBufferView",
+	"vkCreateImage",
+	"vkDestroyImage",
+	"vkGetImageSubresourceLayout",
+	"vkCreateImageView",
+	"vkDestroyImageView",
+	"vkCreateShaderModule",
+	"vkDestroyShaderModule",
+	"vkCreatePipelineCache",
+	"vkDestroyPipelineCache",
+	"vkGetPipelineCacheData",
+	"vkMergePipelineCaches",
+	"vkCreateGraphicsPipelines",
+	"vkCreateComputePipelines",
+	"vkDestroyPipeline",
+	"vkCreatePipelineLayout",
+	"vkDestroyPipelineLayout",
+	"vkCreateSampler",
+	"vkDestroySampler",
+	"vkCreateDescriptorSetLayout",
+	"vkDestroyDescriptorSetLayout",
+	"vkCreateDescriptorPool",
+	"vkDestroyDescriptorPool",
+	"vkResetDescriptorPool",
+	"vkAllocateDescriptorSets",
+	"vkFreeDescriptorSets",
+	"vkUpdateDescriptorSets",
+	"vkCreateFramebuffer",
+	"vkDestroyFramebuffer",
+	"vkCreateRenderPass",
+	"vkDestroyRenderPass",
+	"vkGetRenderAreaGranularity",
+	"vkCreateCommandPool",
+	"vkDestroyCommandPool",
+	"vkResetCommandPool",
+	"vkAllocateCommandBuffers",
+	"vkFreeCommandBuffers",
+	"vkBeginCommandBuffer",
+	"vkEndCommandBuffer",
+	"vkResetCommandBuffer",
+	"vkCmdBindPipeline",
+	"vkCmdSetViewport",
+	"vkCmdSetScissor",
+	"vkCmdSetLineWidth",
+	"vkCmdSetDepthBias",
+	"vkCmdSetBlendConstants",
+	"vkCmdSetDepthBounds",
+	"vkCmdSetStencilCompareMask",
+	"vkCmdSetStencilWriteMask",
+	"vkCmdSetStencilReference",
+	"vkCmdBindDescriptorSets",
+	"vkCmdBindIndexBuffer",
+	"vkCmdBindVertexBuffers",
+	"vkCmdDraw",
+	"vkCmdDrawIndexed",
+	"vkCmdDrawIndirect",
+	"vkCmdDrawIndexedIndirect",
+	"vkCmdDispatch",
+	"vkCmdDispatchIndirect",
+	"vkCmdCopyBuffer",
+	"vkCmdCopyImage",
+	"vkCmdBlitImage",
+	"vkCmdCopyBufferToImage",
+	"vkCmdCopyImageToBuffer",
+	"vkCmdUpdateBuffer",
+	"vkCmdFillBuffer",
+	"vkCmdClearColorImage",
+	"vkCmdClearDepthStencilImage",
+	"vkCmdClearAttachments",
+	"vkCmdResolveImage",
+	"vkCmdSetEvent",
+	"vkCmdResetEvent",
+	"vkCmdWaitEvents",
+	"vkCmdPipelineBarrier",
+	"vkCmdBeginQuery",
+	"vkCmdEndQuery",
+	"vkCmdResetQueryPool",
+	"vkCmdWriteTimestamp",
+	"vkCmdCopyQueryPoolResults",
+	"vkCmdPushConstants",
+	"vkCmdBeginRenderPass",
+	"vkCmdNextSubpass",
+	"vkCmdEndRenderPass",
+	"vkCmdExecuteCommands",
+	"vkDestroySurfaceKHR",
+	"vkGetPhysicalDeviceSurfaceSupportKHR",
+	"vkGetPhysicalDeviceSurfaceCapabilitiesKHR",
+	"vkGetPhysicalDeviceSurfaceFormatsKHR",
+	"vkGetPhysicalDeviceSurfacePresentModesKHR",
+	"vkCreateSwapchainKHR",
+	"vkDestroySwapchainKHR",
+	"vkGetSwapchainImagesKHR",
+	"vkAcquireNextImageKHR",
+	"vkQueuePresentKHR",
+	"vkGetPhysicalDeviceDisplayPropertiesKHR",
+	"vkGetPhysicalDeviceDisplayPlanePropertiesKHR",
+	"vkGetDisplayPlaneSupportedDisplaysKHR",
+	"vkGetDisplayModePropertiesKHR",
+	"vkCreateDisplayModeKHR",
+	"vkGetDisplayPlaneCapabilitiesKHR",
+	"vkCreateDisplayPlaneSurfaceKHR",
+	"vkCreateSharedSwapchainsKHR",
+	"vkCreateXlibSurfaceKHR",
+	"vkGetPhysicalDeviceXlibPresentationSupportKHR",
+	"vkCreateXcbSurfaceKHR",
+	"vkGetPhysicalDeviceXcbPresentationSupportKHR",
+	"vkCreateWaylandSurfaceKHR",
+	"vkGetPhysicalDeviceWaylandPresentationSupportKHR",
+	"vkCreateMirSurfaceKHR",
+	"vkGetPhysicalDeviceMirPresentationSupportKHR",
+	"vkCreateAndroidSurfaceKHR",
+	"vkCreateWin32SurfaceKHR",
+	"vkGetPhysicalDeviceWin32PresentationSupportKHR",
+};
+
+static PFN_vkVoidFunction vkelInterposeGetNext(uint32_t index)
+{
+	PFN_vkVoidFunction next = __atomic_load_n(&vkelInterposeNext[index], __ATOMIC_ACQUIRE);
+	void *symbol;
+	
+	if (next)
+		return next;
+	
+	symbol = dlsym(RTLD_NEXT, vkelInterposeCommandNames[index]);
+	
+	if (!symbol)
+	{
+		fprintf(stderr, "vkel: %s isn't defined by any library after the interposer\n", vkelInterposeCommandNames[index]);
+		abort();
+	}
+	
+	// Converting from void* is undefined in ISO C, but it's what dlsym() is for
+	*(void**) &next = symbol;
+	
+	__atomic_store_n(&vkelInterposeNext[index], next, __ATOMIC_RELEASE);
+	
+	return next;
+}
+
+static uint64_t vkelInterposeGetNanoseconds(void)
+{
+	struct timespec now;
+	
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	
+	return (uint64_t) now.tv_sec * 1000000000u + (uint64_t) now.tv_nsec;
+}
+
+static void vkelInterposeEndCall(uint32_t index, uint64_t start)
+{
+	VkelInterposeCommandStats *pStats = &vkelInterposeStats[index];
+	uint64_t elapsed = vkelInterposeGetNanoseconds() - start;
+	uint32_t bucket = elapsed ? (uint32_t) (63 - __builtin_clzll(elapsed)) : 0;
+	
+	if (bucket >= VKEL_INTERPOSE_BUCKET_COUNT)
+		bucket = VKEL_INTERPOSE_BUCKET_COUNT - 1;
+	
+	__atomic_fetch_add(&pStats->callCount, 1, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&pStats->totalNanoseconds, elapsed, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&pStats->buckets[bucket], 1, __ATOMIC_RELAXED);
+}
+
+
+// The upper bound (in nanoseconds) of the bucket the given fraction of calls fall within
+static unsigned long long vkelInterposeGetPercentile(const VkelInterposeCommandStats *pStats, uint64_t callCount, double fraction)
+{
+	uint64_t target = (uint64_t) ((double) callCount * fraction);
+	uint64_t count = 0;
+	uint32_t i;
+	
+	for (i = 0; i < VKEL_INTERPOSE_BUCKET_COUNT; ++i)
+	{
+		count += pStats->buckets[i];
+		
+		if (count > target)
+			break;
+	}
+	
+	return (i + 1 >= 64) ? ~0ull : (1ull << (i + 1));
+}
+
+static void vkelInterposeWriteReport(void)
+{
+	const char *pPath = getenv("VKEL_INTERPOSE_OUTPUT");
+	FILE *file = pPath ? fopen(pPath, "w") : stderr;
+	uint32_t i, j;
+	
+	if (!file)
+		return;
+	
+	fprintf(file, "%-48s %12s %14s %10s %10s %10s\n", "command", "calls", "total (us)", "avg (ns)", "p50 (ns)", "p99 (ns)");
+	
+	for (i = 0; i < VKEL_INTERPOSE_COMMAND_COUNT; ++i)
+	{
+		const VkelInterposeCommandStats *pStats = &vkelInterposeStats[i];
+		unsigned long long callCount = (unsigned long long) __atomic_load_n(&pStats->callCount, __ATOMIC_RELAXED);
+		unsigned long long totalNanoseconds = (unsigned long long) __atomic_load_n(&pStats->totalNanoseconds, __ATOMIC_RELAXED);
+		
+		if (!callCount)
+			continue;
+		
+		fprintf(file, "%-48s %12llu %14.1f %10llu %10llu %10llu\n", vkelInterposeCommandNames[i], callCount, (double) totalNanoseconds / 1000.0, totalNanoseconds / callCount,
+			vkelInterposeGetPercentile(pStats, callCount, 0.5), vkelInterposeGetPercentile(pStats, callCount, 0.99));
+		
+		// Histogram, as the number of calls that took less than each power of two nanoseconds
+		fprintf(file, "   ");
+		
+		for (j = 0; j < VKEL_INTERPOSE_BUCKET_COUNT; ++j)
+			if (pStats->buckets[j])
+				fprintf(file, " <%llu:%llu", 1ull << (j + 1), (unsigned long long) pStats->buckets[j]);
+		
+		fprintf(file, "\n");
+	}
+	
+	if (file != stderr)
+		fclose(file);
+}
+
+__attribute__((destructor)) static void vkelInterposeUnload(void)
+{
+	vkelInterposeWriteReport();
+}
+
+
+// Devices whose functions were handed out by vkGetDeviceProcAddr(), by dispatch key (the first
+// pointer of a device, and of its queues and command buffers). Functions of any more devices
+// are timed through the trampolines of libvulkan instead.
+#ifndef VKEL_INTERPOSE_MAX_DEVICES
+#	define VKEL_INTERPOSE_MAX_DEVICES 16
+#endif
+
+typedef struct VkelInterposeDevice {
+	const void *dispatchKey;
+	PFN_vkVoidFunction functions[VKEL_INTERPOSE_COMMAND_COUNT];
+} VkelInterposeDevice;
+
+static VkelInterposeDevice vkelInterposeDevices[VKEL_INTERPOSE_MAX_DEVICES];
+
+static const void* vkelInterposeGetDispatchKey(const void *handle)
+{
+	return *(const void* const*) handle;
+}
+
+static VkelInterposeDevice* vkelInterposeFindDevice(const void *dispatchKey)
+{
+	uint32_t i;
+	
+	// Free slots have no key
+	if (!dispatchKey)
+		return NULL;
+	
+	for (i = 0; i < VKEL_INTERPOSE_MAX_DEVICES; ++i)
+		if (__atomic_load_n(&vkelInterposeDevices[i].dispatchKey, __ATOMIC_ACQUIRE) == dispatchKey)
+			return &vkelInterposeDevices[i];
+	
+	return NULL;
+}
+
+static VkelInterposeDevice* vkelInterposeAddDevice(const void *dispatchKey)
+{
+	VkelInterposeDevice *pDevice = vkelInterposeFindDevice(dispatchKey);
+	uint32_t i;
+	
+	if (pDevice || !dispatchKey)
+		return pDevice;
+	
+	for (i = 0; i < VKEL_INTERPOSE_MAX_DEVICES; ++i)
+	{
+		const void *expected = NULL;
+		
+		if (__atomic_compare_exchange_n(&vkelInterposeDevices[i].dispatchKey, &expected, dispatchKey, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+			return &vkelInterposeDevices[i];
+	}
+	
+	return NULL;
+}
+
+// Called once the device is destroyed, so the slot can be taken by another one
+static void vkelInterposeRemoveDevice(const void *dispatchKey)
+{
+	VkelInterposeDevice *pDevice = vkelInterposeFindDevice(dispatchKey);
+	uint32_t i;
+	
+	if (!pDevice)
+		return;
+	
+	for (i = 0; i < VKEL_INTERPOSE_COMMAND_COUNT; ++i)
+		__atomic_store_n(&pDevice->functions[i], NULL, __ATOMIC_RELAXED);
+	
+	__atomic_store_n(&pDevice->dispatchKey, NULL, __ATOMIC_RELEASE);
+}
+
+// The driver's function for the device the handle belongs to, or the trampoline when the
+// device is unknown
+static PFN_vkVoidFunction vkelInterposeGetDeviceFunction(const void *handle, uint32_t index)
+{
+	VkelInterposeDevice *pDevice = vkelInterposeFindDevice(vkelInterposeGetDispatchKey(handle));
+	PFN_vkVoidFunction function = pDevice ? __atomic_load_n(&pDevice->functions[index], __ATOMIC_ACQUIRE) : NULL;
+	
+	return function ? function : vkelInterposeGetNext(index);
+}
+
+
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateInstance(const VkInstanceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkInstance* pInstance)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkCreateInstance) vkelInterposeGetNext(0))(pCreateInfo, pAllocator, pInstance);
+	vkelInterposeEndCall(0, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkDestroyInstance(VkInstance instance, const VkAllocationCallbacks* pAllocator)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkDestroyInstance) vkelInterposeGetNext(1))(instance, pAllocator);
+	vkelInterposeEndCall(1, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumeratePhysicalDevices(VkInstance instance, uint32_t* pPhysicalDeviceCount, VkPhysicalDevice* pPhysicalDevices)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkEnumeratePhysicalDevices) vkelInterposeGetNext(2))(instance, pPhysicalDeviceCount, pPhysicalDevices);
+	vkelInterposeEndCall(2, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceFeatures(VkPhysicalDevice physicalDevice, VkPhysicalDeviceFeatures* pFeatures)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkGetPhysicalDeviceFeatures) vkelInterposeGetNext(3))(physicalDevice, pFeatures);
+	vkelInterposeEndCall(3, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceFormatProperties(VkPhysicalDevice physicalDevice, VkFormat format, VkFormatProperties* pFormatProperties)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkGetPhysicalDeviceFormatProperties) vkelInterposeGetNext(4))(physicalDevice, format, pFormatProperties);
+	vkelInterposeEndCall(4, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkGetPhysicalDeviceImageFormatProperties(VkPhysicalDevice physicalDevice, VkFormat format, VkImageType type, VkImageTiling tiling, VkImageUsageFlags usage, VkImageCreateFlags flags, VkImageFormatProperties* pImageFormatProperties)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkGetPhysicalDeviceImageFormatProperties) vkelInterposeGetNext(5))(physicalDevice, format, type, tiling, usage, flags, pImageFormatProperties);
+	vkelInterposeEndCall(5, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceProperties(VkPhysicalDevice physicalDevice, VkPhysicalDeviceProperties* pProperties)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkGetPhysicalDeviceProperties) vkelInterposeGetNext(6))(physicalDevice, pProperties);
+	vkelInterposeEndCall(6, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceQueueFamilyProperties(VkPhysicalDevice physicalDevice, uint32_t* pQueueFamilyPropertyCount, VkQueueFamilyProperties* pQueueFamilyProperties)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkGetPhysicalDeviceQueueFamilyProperties) vkelInterposeGetNext(7))(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
+	vkelInterposeEndCall(7, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceMemoryProperties(VkPhysicalDevice physicalDevice, VkPhysicalDeviceMemoryProperties* pMemoryProperties)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkGetPhysicalDeviceMemoryProperties) vkelInterposeGetNext(8))(physicalDevice, pMemoryProperties);
+	vkelInterposeEndCall(8, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDevice* pDevice)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkCreateDevice) vkelInterposeGetNext(11))(physicalDevice, pCreateInfo, pAllocator, pDevice);
+	vkelInterposeEndCall(11, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	const void *dispatchKey = device ? vkelInterposeGetDispatchKey(device) : NULL;
+	((PFN_vkDestroyDevice) vkelInterposeGetNext(12))(device, pAllocator);
+	vkelInterposeEndCall(12, start);
+	vkelInterposeRemoveDevice(dispatchKey);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateInstanceExtensionProperties(const char* pLayerName, uint32_t* pPropertyCount, VkExtensionProperties* pProperties)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkEnumerateInstanceExtensionProperties) vkelInterposeGetNext(13))(pLayerName, pPropertyCount, pProperties);
+	vkelInterposeEndCall(13, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateDeviceExtensionProperties(VkPhysicalDevice physicalDevice, const char* pLayerName, uint32_t* pPropertyCount, VkExtensionProperties* pProperties)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkEnumerateDeviceExtensionProperties) vkelInterposeGetNext(14))(physicalDevice, pLayerName, pPropertyCount, pProperties);
+	vkelInterposeEndCall(14, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateInstanceLayerProperties(uint32_t* pPropertyCount, VkLayerProperties* pProperties)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkEnumerateInstanceLayerProperties) vkelInterposeGetNext(15))(pPropertyCount, pProperties);
+	vkelInterposeEndCall(15, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateDeviceLayerProperties(VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkLayerProperties* pProperties)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkEnumerateDeviceLayerProperties) vkelInterposeGetNext(16))(physicalDevice, pPropertyCount, pProperties);
+	vkelInterposeEndCall(16, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkGetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue* pQueue)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkGetDeviceQueue) vkelInterposeGetNext(17))(device, queueFamilyIndex, queueIndex, pQueue);
+	vkelInterposeEndCall(17, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkQueueSubmit) vkelInterposeGetNext(18))(queue, submitCount, pSubmits, fence);
+	vkelInterposeEndCall(18, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkQueueWaitIdle(VkQueue queue)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkQueueWaitIdle) vkelInterposeGetNext(19))(queue);
+	vkelInterposeEndCall(19, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkDeviceWaitIdle(VkDevice device)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkDeviceWaitIdle) vkelInterposeGetNext(20))(device);
+	vkelInterposeEndCall(20, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkAllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo, const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkAllocateMemory) vkelInterposeGetNext(21))(device, pAllocateInfo, pAllocator, pMemory);
+	vkelInterposeEndCall(21, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkFreeMemory(VkDevice device, VkDeviceMemory memory, const VkAllocationCallbacks* pAllocator)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkFreeMemory) vkelInterposeGetNext(22))(device, memory, pAllocator);
+	vkelInterposeEndCall(22, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkMapMemory(VkDevice device, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size, VkMemoryMapFlags flags, void** ppData)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkMapMemory) vkelInterposeGetNext(23))(device, memory, offset, size, flags, ppData);
+	vkelInterposeEndCall(23, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkUnmapMemory(VkDevice device, VkDeviceMemory memory)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkUnmapMemory) vkelInterposeGetNext(24))(device, memory);
+	vkelInterposeEndCall(24, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkFlushMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount, const VkMappedMemoryRange* pMemoryRanges)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkFlushMappedMemoryRanges) vkelInterposeGetNext(25))(device, memoryRangeCount, pMemoryRanges);
+	vkelInterposeEndCall(25, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkInvalidateMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount, const VkMappedMemoryRange* pMemoryRanges)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkInvalidateMappedMemoryRanges) vkelInterposeGetNext(26))(device, memoryRangeCount, pMemoryRanges);
+	vkelInterposeEndCall(26, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkGetDeviceMemoryCommitment(VkDevice device, VkDeviceMemory memory, VkDeviceSize* pCommittedMemoryInBytes)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkGetDeviceMemoryCommitment) vkelInterposeGetNext(27))(device, memory, pCommittedMemoryInBytes);
+	vkelInterposeEndCall(27, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkBindBufferMemory(VkDevice device, VkBuffer buffer, VkDeviceMemory memory, VkDeviceSize memoryOffset)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkBindBufferMemory) vkelInterposeGetNext(28))(device, buffer, memory, memoryOffset);
+	vkelInterposeEndCall(28, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkBindImageMemory(VkDevice device, VkImage image, VkDeviceMemory memory, VkDeviceSize memoryOffset)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkBindImageMemory) vkelInterposeGetNext(29))(device, image, memory, memoryOffset);
+	vkelInterposeEndCall(29, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkGetBufferMemoryRequirements(VkDevice device, VkBuffer buffer, VkMemoryRequirements* pMemoryRequirements)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkGetBufferMemoryRequirements) vkelInterposeGetNext(30))(device, buffer, pMemoryRequirements);
+	vkelInterposeEndCall(30, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkGetImageMemoryRequirements(VkDevice device, VkImage image, VkMemoryRequirements* pMemoryRequirements)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkGetImageMemoryRequirements) vkelInterposeGetNext(31))(device, image, pMemoryRequirements);
+	vkelInterposeEndCall(31, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkGetImageSparseMemoryRequirements(VkDevice device, VkImage image, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements* pSparseMemoryRequirements)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkGetImageSparseMemoryRequirements) vkelInterposeGetNext(32))(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+	vkelInterposeEndCall(32, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceSparseImageFormatProperties(VkPhysicalDevice physicalDevice, VkFormat format, VkImageType type, VkSampleCountFlagBits samples, VkImageUsageFlags usage, VkImageTiling tiling, uint32_t* pPropertyCount, VkSparseImageFormatProperties* pProperties)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkGetPhysicalDeviceSparseImageFormatProperties) vkelInterposeGetNext(33))(physicalDevice, format, type, samples, usage, tiling, pPropertyCount, pProperties);
+	vkelInterposeEndCall(33, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkQueueBindSparse(VkQueue queue, uint32_t bindInfoCount, const VkBindSparseInfo* pBindInfo, VkFence fence)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkQueueBindSparse) vkelInterposeGetNext(34))(queue, bindInfoCount, pBindInfo, fence);
+	vkelInterposeEndCall(34, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateFence(VkDevice device, const VkFenceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkFence* pFence)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkCreateFence) vkelInterposeGetNext(35))(device, pCreateInfo, pAllocator, pFence);
+	vkelInterposeEndCall(35, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkDestroyFence(VkDevice device, VkFence fence, const VkAllocationCallbacks* pAllocator)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkDestroyFence) vkelInterposeGetNext(36))(device, fence, pAllocator);
+	vkelInterposeEndCall(36, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkResetFences(VkDevice device, uint32_t fenceCount, const VkFence* pFences)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkResetFences) vkelInterposeGetNext(37))(device, fenceCount, pFences);
+	vkelInterposeEndCall(37, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkGetFenceStatus(VkDevice device, VkFence fence)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkGetFenceStatus) vkelInterposeGetNext(38))(device, fence);
+	vkelInterposeEndCall(38, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence* pFences, VkBool32 waitAll, uint64_t timeout)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkWaitForFences) vkelInterposeGetNext(39))(device, fenceCount, pFences, waitAll, timeout);
+	vkelInterposeEndCall(39, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateSemaphore(VkDevice device, const VkSemaphoreCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSemaphore* pSemaphore)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkCreateSemaphore) vkelInterposeGetNext(40))(device, pCreateInfo, pAllocator, pSemaphore);
+	vkelInterposeEndCall(40, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkDestroySemaphore(VkDevice device, VkSemaphore semaphore, const VkAllocationCallbacks* pAllocator)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkDestroySemaphore) vkelInterposeGetNext(41))(device, semaphore, pAllocator);
+	vkelInterposeEndCall(41, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateEvent(VkDevice device, const VkEventCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkEvent* pEvent)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkCreateEvent) vkelInterposeGetNext(42))(device, pCreateInfo, pAllocator, pEvent);
+	vkelInterposeEndCall(42, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkDestroyEvent(VkDevice device, VkEvent event, const VkAllocationCallbacks* pAllocator)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkDestroyEvent) vkelInterposeGetNext(43))(device, event, pAllocator);
+	vkelInterposeEndCall(43, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkGetEventStatus(VkDevice device, VkEvent event)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkGetEventStatus) vkelInterposeGetNext(44))(device, event);
+	vkelInterposeEndCall(44, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkSetEvent(VkDevice device, VkEvent event)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkSetEvent) vkelInterposeGetNext(45))(device, event);
+	vkelInterposeEndCall(45, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkResetEvent(VkDevice device, VkEvent event)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkResetEvent) vkelInterposeGetNext(46))(device, event);
+	vkelInterposeEndCall(46, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateQueryPool(VkDevice device, const VkQueryPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkQueryPool* pQueryPool)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkCreateQueryPool) vkelInterposeGetNext(47))(device, pCreateInfo, pAllocator, pQueryPool);
+	vkelInterposeEndCall(47, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkDestroyQueryPool(VkDevice device, VkQueryPool queryPool, const VkAllocationCallbacks* pAllocator)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkDestroyQueryPool) vkelInterposeGetNext(48))(device, queryPool, pAllocator);
+	vkelInterposeEndCall(48, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkGetQueryPoolResults(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, size_t dataSize, void* pData, VkDeviceSize stride, VkQueryResultFlags flags)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkGetQueryPoolResults) vkelInterposeGetNext(49))(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
+	vkelInterposeEndCall(49, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateBuffer(VkDevice device, const VkBufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBuffer* pBuffer)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkCreateBuffer) vkelInterposeGetNext(50))(device, pCreateInfo, pAllocator, pBuffer);
+	vkelInterposeEndCall(50, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkDestroyBuffer(VkDevice device, VkBuffer buffer, const VkAllocationCallbacks* pAllocator)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkDestroyBuffer) vkelInterposeGetNext(51))(device, buffer, pAllocator);
+	vkelInterposeEndCall(51, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateBufferView(VkDevice device, const VkBufferViewCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBufferView* pView)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkCreateBufferView) vkelInterposeGetNext(52))(device, pCreateInfo, pAllocator, pView);
+	vkelInterposeEndCall(52, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkDestroyBufferView(VkDevice device, VkBufferView bufferView, const VkAllocationCallbacks* pAllocator)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkDestroyBufferView) vkelInterposeGetNext(53))(device, bufferView, pAllocator);
+	vkelInterposeEndCall(53, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateImage(VkDevice device, const VkImageCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkImage* pImage)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkCreateImage) vkelInterposeGetNext(54))(device, pCreateInfo, pAllocator, pImage);
+	vkelInterposeEndCall(54, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkDestroyImage(VkDevice device, VkImage image, const VkAllocationCallbacks* pAllocator)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkDestroyImage) vkelInterposeGetNext(55))(device, image, pAllocator);
+	vkelInterposeEndCall(55, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkGetImageSubresourceLayout(VkDevice device, VkImage image, const VkImageSubresource* pSubresource, VkSubresourceLayout* pLayout)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkGetImageSubresourceLayout) vkelInterposeGetNext(56))(device, image, pSubresource, pLayout);
+	vkelInterposeEndCall(56, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateImageView(VkDevice device, const VkImageViewCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkImageView* pView)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkCreateImageView) vkelInterposeGetNext(57))(device, pCreateInfo, pAllocator, pView);
+	vkelInterposeEndCall(57, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkDestroyImageView(VkDevice device, VkImageView imageView, const VkAllocationCallbacks* pAllocator)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkDestroyImageView) vkelInterposeGetNext(58))(device, imageView, pAllocator);
+	vkelInterposeEndCall(58, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkCreateShaderModule) vkelInterposeGetNext(59))(device, pCreateInfo, pAllocator, pShaderModule);
+	vkelInterposeEndCall(59, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkDestroyShaderModule(VkDevice device, VkShaderModule shaderModule, const VkAllocationCallbacks* pAllocator)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkDestroyShaderModule) vkelInterposeGetNext(60))(device, shaderModule, pAllocator);
+	vkelInterposeEndCall(60, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreatePipelineCache(VkDevice device, const VkPipelineCacheCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineCache* pPipelineCache)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkCreatePipelineCache) vkelInterposeGetNext(61))(device, pCreateInfo, pAllocator, pPipelineCache);
+	vkelInterposeEndCall(61, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkDestroyPipelineCache(VkDevice device, VkPipelineCache pipelineCache, const VkAllocationCallbacks* pAllocator)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkDestroyPipelineCache) vkelInterposeGetNext(62))(device, pipelineCache, pAllocator);
+	vkelInterposeEndCall(62, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkGetPipelineCacheData(VkDevice device, VkPipelineCache pipelineCache, size_t* pDataSize, void* pData)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkGetPipelineCacheData) vkelInterposeGetNext(63))(device, pipelineCache, pDataSize, pData);
+	vkelInterposeEndCall(63, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkMergePipelineCaches(VkDevice device, VkPipelineCache dstCache, uint32_t srcCacheCount, const VkPipelineCache* pSrcCaches)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkMergePipelineCaches) vkelInterposeGetNext(64))(device, dstCache, srcCacheCount, pSrcCaches);
+	vkelInterposeEndCall(64, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkGraphicsPipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkCreateGraphicsPipelines) vkelInterposeGetNext(65))(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+	vkelInterposeEndCall(65, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateComputePipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkComputePipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkCreateComputePipelines) vkelInterposeGetNext(66))(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+	vkelInterposeEndCall(66, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkDestroyPipeline(VkDevice device, VkPipeline pipeline, const VkAllocationCallbacks* pAllocator)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkDestroyPipeline) vkelInterposeGetNext(67))(device, pipeline, pAllocator);
+	vkelInterposeEndCall(67, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreatePipelineLayout(VkDevice device, const VkPipelineLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineLayout* pPipelineLayout)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkCreatePipelineLayout) vkelInterposeGetNext(68))(device, pCreateInfo, pAllocator, pPipelineLayout);
+	vkelInterposeEndCall(68, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkDestroyPipelineLayout(VkDevice device, VkPipelineLayout pipelineLayout, const VkAllocationCallbacks* pAllocator)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkDestroyPipelineLayout) vkelInterposeGetNext(69))(device, pipelineLayout, pAllocator);
+	vkelInterposeEndCall(69, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateSampler(VkDevice device, const VkSamplerCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSampler* pSampler)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkCreateSampler) vkelInterposeGetNext(70))(device, pCreateInfo, pAllocator, pSampler);
+	vkelInterposeEndCall(70, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkDestroySampler(VkDevice device, VkSampler sampler, const VkAllocationCallbacks* pAllocator)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkDestroySampler) vkelInterposeGetNext(71))(device, sampler, pAllocator);
+	vkelInterposeEndCall(71, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateDescriptorSetLayout(VkDevice device, const VkDescriptorSetLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorSetLayout* pSetLayout)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkCreateDescriptorSetLayout) vkelInterposeGetNext(72))(device, pCreateInfo, pAllocator, pSetLayout);
+	vkelInterposeEndCall(72, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkDestroyDescriptorSetLayout(VkDevice device, VkDescriptorSetLayout descriptorSetLayout, const VkAllocationCallbacks* pAllocator)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkDestroyDescriptorSetLayout) vkelInterposeGetNext(73))(device, descriptorSetLayout, pAllocator);
+	vkelInterposeEndCall(73, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateDescriptorPool(VkDevice device, const VkDescriptorPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorPool* pDescriptorPool)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkCreateDescriptorPool) vkelInterposeGetNext(74))(device, pCreateInfo, pAllocator, pDescriptorPool);
+	vkelInterposeEndCall(74, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkDestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool, const VkAllocationCallbacks* pAllocator)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkDestroyDescriptorPool) vkelInterposeGetNext(75))(device, descriptorPool, pAllocator);
+	vkelInterposeEndCall(75, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkResetDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool, VkDescriptorPoolResetFlags flags)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkResetDescriptorPool) vkelInterposeGetNext(76))(device, descriptorPool, flags);
+	vkelInterposeEndCall(76, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkAllocateDescriptorSets(VkDevice device, const VkDescriptorSetAllocateInfo* pAllocateInfo, VkDescriptorSet* pDescriptorSets)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkAllocateDescriptorSets) vkelInterposeGetNext(77))(device, pAllocateInfo, pDescriptorSets);
+	vkelInterposeEndCall(77, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkFreeDescriptorSets(VkDevice device, VkDescriptorPool descriptorPool, uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkFreeDescriptorSets) vkelInterposeGetNext(78))(device, descriptorPool, descriptorSetCount, pDescriptorSets);
+	vkelInterposeEndCall(78, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkUpdateDescriptorSets(VkDevice device, uint32_t descriptorWriteCount, const VkWriteDescriptorSet* pDescriptorWrites, uint32_t descriptorCopyCount, const VkCopyDescriptorSet* pDescriptorCopies)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkUpdateDescriptorSets) vkelInterposeGetNext(79))(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
+	vkelInterposeEndCall(79, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateFramebuffer(VkDevice device, const VkFramebufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkFramebuffer* pFramebuffer)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkCreateFramebuffer) vkelInterposeGetNext(80))(device, pCreateInfo, pAllocator, pFramebuffer);
+	vkelInterposeEndCall(80, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkDestroyFramebuffer(VkDevice device, VkFramebuffer framebuffer, const VkAllocationCallbacks* pAllocator)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkDestroyFramebuffer) vkelInterposeGetNext(81))(device, framebuffer, pAllocator);
+	vkelInterposeEndCall(81, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateRenderPass(VkDevice device, const VkRenderPassCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkCreateRenderPass) vkelInterposeGetNext(82))(device, pCreateInfo, pAllocator, pRenderPass);
+	vkelInterposeEndCall(82, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkDestroyRenderPass(VkDevice device, VkRenderPass renderPass, const VkAllocationCallbacks* pAllocator)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkDestroyRenderPass) vkelInterposeGetNext(83))(device, renderPass, pAllocator);
+	vkelInterposeEndCall(83, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkGetRenderAreaGranularity(VkDevice device, VkRenderPass renderPass, VkExtent2D* pGranularity)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkGetRenderAreaGranularity) vkelInterposeGetNext(84))(device, renderPass, pGranularity);
+	vkelInterposeEndCall(84, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateCommandPool(VkDevice device, const VkCommandPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkCommandPool* pCommandPool)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkCreateCommandPool) vkelInterposeGetNext(85))(device, pCreateInfo, pAllocator, pCommandPool);
+	vkelInterposeEndCall(85, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkDestroyCommandPool(VkDevice device, VkCommandPool commandPool, const VkAllocationCallbacks* pAllocator)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkDestroyCommandPool) vkelInterposeGetNext(86))(device, commandPool, pAllocator);
+	vkelInterposeEndCall(86, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkResetCommandPool(VkDevice device, VkCommandPool commandPool, VkCommandPoolResetFlags flags)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkResetCommandPool) vkelInterposeGetNext(87))(device, commandPool, flags);
+	vkelInterposeEndCall(87, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkAllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo* pAllocateInfo, VkCommandBuffer* pCommandBuffers)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkAllocateCommandBuffers) vkelInterposeGetNext(88))(device, pAllocateInfo, pCommandBuffers);
+	vkelInterposeEndCall(88, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkFreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount, const VkCommandBuffer* pCommandBuffers)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkFreeCommandBuffers) vkelInterposeGetNext(89))(device, commandPool, commandBufferCount, pCommandBuffers);
+	vkelInterposeEndCall(89, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkBeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo* pBeginInfo)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkBeginCommandBuffer) vkelInterposeGetNext(90))(commandBuffer, pBeginInfo);
+	vkelInterposeEndCall(90, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEndCommandBuffer(VkCommandBuffer commandBuffer)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkEndCommandBuffer) vkelInterposeGetNext(91))(commandBuffer);
+	vkelInterposeEndCall(91, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkResetCommandBuffer) vkelInterposeGetNext(92))(commandBuffer, flags);
+	vkelInterposeEndCall(92, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdBindPipeline) vkelInterposeGetNext(93))(commandBuffer, pipelineBindPoint, pipeline);
+	vkelInterposeEndCall(93, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdSetViewport(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkViewport* pViewports)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdSetViewport) vkelInterposeGetNext(94))(commandBuffer, firstViewport, viewportCount, pViewports);
+	vkelInterposeEndCall(94, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdSetScissor(VkCommandBuffer commandBuffer, uint32_t firstScissor, uint32_t scissorCount, const VkRect2D* pScissors)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdSetScissor) vkelInterposeGetNext(95))(commandBuffer, firstScissor, scissorCount, pScissors);
+	vkelInterposeEndCall(95, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdSetLineWidth(VkCommandBuffer commandBuffer, float lineWidth)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdSetLineWidth) vkelInterposeGetNext(96))(commandBuffer, lineWidth);
+	vkelInterposeEndCall(96, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdSetDepthBias(VkCommandBuffer commandBuffer, float depthBiasConstantFactor, float depthBiasClamp, float depthBiasSlopeFactor)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdSetDepthBias) vkelInterposeGetNext(97))(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
+	vkelInterposeEndCall(97, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdSetBlendConstants(VkCommandBuffer commandBuffer, const float blendConstants[4])
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdSetBlendConstants) vkelInterposeGetNext(98))(commandBuffer, blendConstants);
+	vkelInterposeEndCall(98, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdSetDepthBounds(VkCommandBuffer commandBuffer, float minDepthBounds, float maxDepthBounds)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdSetDepthBounds) vkelInterposeGetNext(99))(commandBuffer, minDepthBounds, maxDepthBounds);
+	vkelInterposeEndCall(99, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdSetStencilCompareMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t compareMask)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdSetStencilCompareMask) vkelInterposeGetNext(100))(commandBuffer, faceMask, compareMask);
+	vkelInterposeEndCall(100, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdSetStencilWriteMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t writeMask)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdSetStencilWriteMask) vkelInterposeGetNext(101))(commandBuffer, faceMask, writeMask);
+	vkelInterposeEndCall(101, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdSetStencilReference(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t reference)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdSetStencilReference) vkelInterposeGetNext(102))(commandBuffer, faceMask, reference);
+	vkelInterposeEndCall(102, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdBindDescriptorSets(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t firstSet, uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets, uint32_t dynamicOffsetCount, const uint32_t* pDynamicOffsets)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdBindDescriptorSets) vkelInterposeGetNext(103))(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
+	vkelInterposeEndCall(103, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkIndexType indexType)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdBindIndexBuffer) vkelInterposeGetNext(104))(commandBuffer, buffer, offset, indexType);
+	vkelInterposeEndCall(104, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdBindVertexBuffers(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, const VkBuffer* pBuffers, const VkDeviceSize* pOffsets)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdBindVertexBuffers) vkelInterposeGetNext(105))(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
+	vkelInterposeEndCall(105, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdDraw) vkelInterposeGetNext(106))(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
+	vkelInterposeEndCall(106, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdDrawIndexed) vkelInterposeGetNext(107))(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
+	vkelInterposeEndCall(107, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdDrawIndirect) vkelInterposeGetNext(108))(commandBuffer, buffer, offset, drawCount, stride);
+	vkelInterposeEndCall(108, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdDrawIndexedIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdDrawIndexedIndirect) vkelInterposeGetNext(109))(commandBuffer, buffer, offset, drawCount, stride);
+	vkelInterposeEndCall(109, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdDispatch(VkCommandBuffer commandBuffer, uint32_t x, uint32_t y, uint32_t z)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdDispatch) vkelInterposeGetNext(110))(commandBuffer, x, y, z);
+	vkelInterposeEndCall(110, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdDispatchIndirect) vkelInterposeGetNext(111))(commandBuffer, buffer, offset);
+	vkelInterposeEndCall(111, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, uint32_t regionCount, const VkBufferCopy* pRegions)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdCopyBuffer) vkelInterposeGetNext(112))(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
+	vkelInterposeEndCall(112, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdCopyImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageCopy* pRegions)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdCopyImage) vkelInterposeGetNext(113))(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+	vkelInterposeEndCall(113, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdBlitImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageBlit* pRegions, VkFilter filter)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdBlitImage) vkelInterposeGetNext(114))(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
+	vkelInterposeEndCall(114, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdCopyBufferToImage(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkBufferImageCopy* pRegions)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdCopyBufferToImage) vkelInterposeGetNext(115))(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
+	vkelInterposeEndCall(115, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdCopyImageToBuffer(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkBuffer dstBuffer, uint32_t regionCount, const VkBufferImageCopy* pRegions)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdCopyImageToBuffer) vkelInterposeGetNext(116))(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
+	vkelInterposeEndCall(116, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize dataSize, const void* pData)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdUpdateBuffer) vkelInterposeGetNext(117))(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
+	vkelInterposeEndCall(117, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize size, uint32_t data)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdFillBuffer) vkelInterposeGetNext(118))(commandBuffer, dstBuffer, dstOffset, size, data);
+	vkelInterposeEndCall(118, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdClearColorImage(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const VkClearColorValue* pColor, uint32_t rangeCount, const VkImageSubresourceRange* pRanges)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdClearColorImage) vkelInterposeGetNext(119))(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
+	vkelInterposeEndCall(119, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdClearDepthStencilImage(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const VkClearDepthStencilValue* pDepthStencil, uint32_t rangeCount, const VkImageSubresourceRange* pRanges)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdClearDepthStencilImage) vkelInterposeGetNext(120))(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
+	vkelInterposeEndCall(120, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdClearAttachments(VkCommandBuffer commandBuffer, uint32_t attachmentCount, const VkClearAttachment* pAttachments, uint32_t rectCount, const VkClearRect* pRects)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdClearAttachments) vkelInterposeGetNext(121))(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
+	vkelInterposeEndCall(121, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdResolveImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageResolve* pRegions)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdResolveImage) vkelInterposeGetNext(122))(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+	vkelInterposeEndCall(122, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdSetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdSetEvent) vkelInterposeGetNext(123))(commandBuffer, event, stageMask);
+	vkelInterposeEndCall(123, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdResetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdResetEvent) vkelInterposeGetNext(124))(commandBuffer, event, stageMask);
+	vkelInterposeEndCall(124, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers, uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdWaitEvents) vkelInterposeGetNext(125))(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+	vkelInterposeEndCall(125, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdPipelineBarrier(VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, VkDependencyFlags dependencyFlags, uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers, uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdPipelineBarrier) vkelInterposeGetNext(126))(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+	vkelInterposeEndCall(126, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query, VkQueryControlFlags flags)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdBeginQuery) vkelInterposeGetNext(127))(commandBuffer, queryPool, query, flags);
+	vkelInterposeEndCall(127, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdEndQuery) vkelInterposeGetNext(128))(commandBuffer, queryPool, query);
+	vkelInterposeEndCall(128, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdResetQueryPool(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdResetQueryPool) vkelInterposeGetNext(129))(commandBuffer, queryPool, firstQuery, queryCount);
+	vkelInterposeEndCall(129, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdWriteTimestamp(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage, VkQueryPool queryPool, uint32_t query)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdWriteTimestamp) vkelInterposeGetNext(130))(commandBuffer, pipelineStage, queryPool, query);
+	vkelInterposeEndCall(130, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdCopyQueryPoolResults(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize stride, VkQueryResultFlags flags)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdCopyQueryPoolResults) vkelInterposeGetNext(131))(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
+	vkelInterposeEndCall(131, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout layout, VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size, const void* pValues)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdPushConstants) vkelInterposeGetNext(132))(commandBuffer, layout, stageFlags, offset, size, pValues);
+	vkelInterposeEndCall(132, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin, VkSubpassContents contents)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdBeginRenderPass) vkelInterposeGetNext(133))(commandBuffer, pRenderPassBegin, contents);
+	vkelInterposeEndCall(133, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpassContents contents)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdNextSubpass) vkelInterposeGetNext(134))(commandBuffer, contents);
+	vkelInterposeEndCall(134, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdEndRenderPass(VkCommandBuffer commandBuffer)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdEndRenderPass) vkelInterposeGetNext(135))(commandBuffer);
+	vkelInterposeEndCall(135, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkCmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount, const VkCommandBuffer* pCommandBuffers)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkCmdExecuteCommands) vkelInterposeGetNext(136))(commandBuffer, commandBufferCount, pCommandBuffers);
+	vkelInterposeEndCall(136, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkDestroySurfaceKHR(VkInstance instance, VkSurfaceKHR surface, const VkAllocationCallbacks* pAllocator)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkDestroySurfaceKHR) vkelInterposeGetNext(137))(instance, surface, pAllocator);
+	vkelInterposeEndCall(137, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkGetPhysicalDeviceSurfaceSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, VkSurfaceKHR surface, VkBool32* pSupported)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkGetPhysicalDeviceSurfaceSupportKHR) vkelInterposeGetNext(138))(physicalDevice, queueFamilyIndex, surface, pSupported);
+	vkelInterposeEndCall(138, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkGetPhysicalDeviceSurfaceCapabilitiesKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, VkSurfaceCapabilitiesKHR* pSurfaceCapabilities)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR) vkelInterposeGetNext(139))(physicalDevice, surface, pSurfaceCapabilities);
+	vkelInterposeEndCall(139, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkGetPhysicalDeviceSurfaceFormatsKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pSurfaceFormatCount, VkSurfaceFormatKHR* pSurfaceFormats)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkGetPhysicalDeviceSurfaceFormatsKHR) vkelInterposeGetNext(140))(physicalDevice, surface, pSurfaceFormatCount, pSurfaceFormats);
+	vkelInterposeEndCall(140, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkGetPhysicalDeviceSurfacePresentModesKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pPresentModeCount, VkPresentModeKHR* pPresentModes)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkGetPhysicalDeviceSurfacePresentModesKHR) vkelInterposeGetNext(141))(physicalDevice, surface, pPresentModeCount, pPresentModes);
+	vkelInterposeEndCall(141, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchain)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkCreateSwapchainKHR) vkelInterposeGetNext(142))(device, pCreateInfo, pAllocator, pSwapchain);
+	vkelInterposeEndCall(142, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR void VKAPI_CALL vkDestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain, const VkAllocationCallbacks* pAllocator)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	((PFN_vkDestroySwapchainKHR) vkelInterposeGetNext(143))(device, swapchain, pAllocator);
+	vkelInterposeEndCall(143, start);
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkGetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchain, uint32_t* pSwapchainImageCount, VkImage* pSwapchainImages)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkGetSwapchainImagesKHR) vkelInterposeGetNext(144))(device, swapchain, pSwapchainImageCount, pSwapchainImages);
+	vkelInterposeEndCall(144, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkAcquireNextImageKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout, VkSemaphore semaphore, VkFence fence, uint32_t* pImageIndex)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkAcquireNextImageKHR) vkelInterposeGetNext(145))(device, swapchain, timeout, semaphore, fence, pImageIndex);
+	vkelInterposeEndCall(145, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR* pPresentInfo)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkQueuePresentKHR) vkelInterposeGetNext(146))(queue, pPresentInfo);
+	vkelInterposeEndCall(146, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkGetPhysicalDeviceDisplayPropertiesKHR(VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayPropertiesKHR* pProperties)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkGetPhysicalDeviceDisplayPropertiesKHR) vkelInterposeGetNext(147))(physicalDevice, pPropertyCount, pProperties);
+	vkelInterposeEndCall(147, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkGetPhysicalDeviceDisplayPlanePropertiesKHR(VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayPlanePropertiesKHR* pProperties)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkGetPhysicalDeviceDisplayPlanePropertiesKHR) vkelInterposeGetNext(148))(physicalDevice, pPropertyCount, pProperties);
+	vkelInterposeEndCall(148, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkGetDisplayPlaneSupportedDisplaysKHR(VkPhysicalDevice physicalDevice, uint32_t planeIndex, uint32_t* pDisplayCount, VkDisplayKHR* pDisplays)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkGetDisplayPlaneSupportedDisplaysKHR) vkelInterposeGetNext(149))(physicalDevice, planeIndex, pDisplayCount, pDisplays);
+	vkelInterposeEndCall(149, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkGetDisplayModePropertiesKHR(VkPhysicalDevice physicalDevice, VkDisplayKHR display, uint32_t* pPropertyCount, VkDisplayModePropertiesKHR* pProperties)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkGetDisplayModePropertiesKHR) vkelInterposeGetNext(150))(physicalDevice, display, pPropertyCount, pProperties);
+	vkelInterposeEndCall(150, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateDisplayModeKHR(VkPhysicalDevice physicalDevice, VkDisplayKHR display, const VkDisplayModeCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDisplayModeKHR* pMode)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkCreateDisplayModeKHR) vkelInterposeGetNext(151))(physicalDevice, display, pCreateInfo, pAllocator, pMode);
+	vkelInterposeEndCall(151, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkGetDisplayPlaneCapabilitiesKHR(VkPhysicalDevice physicalDevice, VkDisplayModeKHR mode, uint32_t planeIndex, VkDisplayPlaneCapabilitiesKHR* pCapabilities)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkGetDisplayPlaneCapabilitiesKHR) vkelInterposeGetNext(152))(physicalDevice, mode, planeIndex, pCapabilities);
+	vkelInterposeEndCall(152, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateDisplayPlaneSurfaceKHR(VkInstance instance, const VkDisplaySurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkCreateDisplayPlaneSurfaceKHR) vkelInterposeGetNext(153))(instance, pCreateInfo, pAllocator, pSurface);
+	vkelInterposeEndCall(153, start);
+	return result;
+}
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateSharedSwapchainsKHR(VkDevice device, uint32_t swapchainCount, const VkSwapchainCreateInfoKHR* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchains)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkCreateSharedSwapchainsKHR) vkelInterposeGetNext(154))(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
+	vkelInterposeEndCall(154, start);
+	return result;
+}
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateXlibSurfaceKHR(VkInstance instance, const VkXlibSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkCreateXlibSurfaceKHR) vkelInterposeGetNext(155))(instance, pCreateInfo, pAllocator, pSurface);
+	vkelInterposeEndCall(155, start);
+	return result;
+}
+#endif /* VK_USE_PLATFORM_XLIB_KHR */
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkBool32 VKAPI_CALL vkGetPhysicalDeviceXlibPresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, Display* dpy, VisualID visualID)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkBool32 result = ((PFN_vkGetPhysicalDeviceXlibPresentationSupportKHR) vkelInterposeGetNext(156))(physicalDevice, queueFamilyIndex, dpy, visualID);
+	vkelInterposeEndCall(156, start);
+	return result;
+}
+#endif /* VK_USE_PLATFORM_XLIB_KHR */
+#ifdef VK_USE_PLATFORM_XCB_KHR
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateXcbSurfaceKHR(VkInstance instance, const VkXcbSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkCreateXcbSurfaceKHR) vkelInterposeGetNext(157))(instance, pCreateInfo, pAllocator, pSurface);
+	vkelInterposeEndCall(157, start);
+	return result;
+}
+#endif /* VK_USE_PLATFORM_XCB_KHR */
+#ifdef VK_USE_PLATFORM_XCB_KHR
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkBool32 VKAPI_CALL vkGetPhysicalDeviceXcbPresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, xcb_connection_t* connection, xcb_visualid_t visual_id)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkBool32 result = ((PFN_vkGetPhysicalDeviceXcbPresentationSupportKHR) vkelInterposeGetNext(158))(physicalDevice, queueFamilyIndex, connection, visual_id);
+	vkelInterposeEndCall(158, start);
+	return result;
+}
+#endif /* VK_USE_PLATFORM_XCB_KHR */
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateWaylandSurfaceKHR(VkInstance instance, const VkWaylandSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkCreateWaylandSurfaceKHR) vkelInterposeGetNext(159))(instance, pCreateInfo, pAllocator, pSurface);
+	vkelInterposeEndCall(159, start);
+	return result;
+}
+#endif /* VK_USE_PLATFORM_WAYLAND_KHR */
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkBool32 VKAPI_CALL vkGetPhysicalDeviceWaylandPresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, struct wl_display* display)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkBool32 result = ((PFN_vkGetPhysicalDeviceWaylandPresentationSupportKHR) vkelInterposeGetNext(160))(physicalDevice, queueFamilyIndex, display);
+	vkelInterposeEndCall(160, start);
+	return result;
+}
+#endif /* VK_USE_PLATFORM_WAYLAND_KHR */
+#ifdef VK_USE_PLATFORM_MIR_KHR
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateMirSurfaceKHR(VkInstance instance, const VkMirSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkCreateMirSurfaceKHR) vkelInterposeGetNext(161))(instance, pCreateInfo, pAllocator, pSurface);
+	vkelInterposeEndCall(161, start);
+	return result;
+}
+#endif /* VK_USE_PLATFORM_MIR_KHR */
+#ifdef VK_USE_PLATFORM_MIR_KHR
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkBool32 VKAPI_CALL vkGetPhysicalDeviceMirPresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, MirConnection* connection)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkBool32 result = ((PFN_vkGetPhysicalDeviceMirPresentationSupportKHR) vkelInterposeGetNext(162))(physicalDevice, queueFamilyIndex, connection);
+	vkelInterposeEndCall(162, start);
+	return result;
+}
+#endif /* VK_USE_PLATFORM_MIR_KHR */
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateAndroidSurfaceKHR(VkInstance instance, const VkAndroidSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkCreateAndroidSurfaceKHR) vkelInterposeGetNext(163))(instance, pCreateInfo, pAllocator, pSurface);
+	vkelInterposeEndCall(163, start);
+	return result;
+}
+#endif /* VK_USE_PLATFORM_ANDROID_KHR */
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateWin32SurfaceKHR(VkInstance instance, const VkWin32SurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = ((PFN_vkCreateWin32SurfaceKHR) vkelInterposeGetNext(164))(instance, pCreateInfo, pAllocator, pSurface);
+	vkelInterposeEndCall(164, start);
+	return result;
+}
+#endif /* VK_USE_PLATFORM_WIN32_KHR */
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR VkBool32 VKAPI_CALL vkGetPhysicalDeviceWin32PresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkBool32 result = ((PFN_vkGetPhysicalDeviceWin32PresentationSupportKHR) vkelInterposeGetNext(165))(physicalDevice, queueFamilyIndex);
+	vkelInterposeEndCall(165, start);
+	return result;
+}
+#endif /* VK_USE_PLATFORM_WIN32_KHR */
+
+
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator)
+{
+	PFN_vkDestroyDevice function = (PFN_vkDestroyDevice) vkelInterposeGetDeviceFunction(device, 12);
+	const void *dispatchKey = vkelInterposeGetDispatchKey(device);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(device, pAllocator);
+	vkelInterposeEndCall(12, start);
+	vkelInterposeRemoveDevice(dispatchKey);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceGetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue* pQueue)
+{
+	PFN_vkGetDeviceQueue function = (PFN_vkGetDeviceQueue) vkelInterposeGetDeviceFunction(device, 17);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(device, queueFamilyIndex, queueIndex, pQueue);
+	vkelInterposeEndCall(17, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence)
+{
+	PFN_vkQueueSubmit function = (PFN_vkQueueSubmit) vkelInterposeGetDeviceFunction(queue, 18);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(queue, submitCount, pSubmits, fence);
+	vkelInterposeEndCall(18, start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceQueueWaitIdle(VkQueue queue)
+{
+	PFN_vkQueueWaitIdle function = (PFN_vkQueueWaitIdle) vkelInterposeGetDeviceFunction(queue, 19);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(queue);
+	vkelInterposeEndCall(19, start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceDeviceWaitIdle(VkDevice device)
+{
+	PFN_vkDeviceWaitIdle function = (PFN_vkDeviceWaitIdle) vkelInterposeGetDeviceFunction(device, 20);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device);
+	vkelInterposeEndCall(20, start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceAllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo, const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory)
+{
+	PFN_vkAllocateMemory function = (PFN_vkAllocateMemory) vkelInterposeGetDeviceFunction(device, 21);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, pAllocateInfo, pAllocator, pMemory);
+	vkelInterposeEndCall(21, start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceFreeMemory(VkDevice device, VkDeviceMemory memory, const VkAllocationCallbacks* pAllocator)
+{
+	PFN_vkFreeMemory function = (PFN_vkFreeMemory) vkelInterposeGetDeviceFunction(device, 22);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(device, memory, pAllocator);
+	vkelInterposeEndCall(22, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceMapMemory(VkDevice device, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size, VkMemoryMapFlags flags, void** ppData)
+{
+	PFN_vkMapMemory function = (PFN_vkMapMemory) vkelInterposeGetDeviceFunction(device, 23);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, memory, offset, size, flags, ppData);
+	vkelInterposeEndCall(23, start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceUnmapMemory(VkDevice device, VkDeviceMemory memory)
+{
+	PFN_vkUnmapMemory function = (PFN_vkUnmapMemory) vkelInterposeGetDeviceFunction(device, 24);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(device, memory);
+	vkelInterposeEndCall(24, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceFlushMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount, const VkMappedMemoryRange* pMemoryRanges)
+{
+	PFN_vkFlushMappedMemoryRanges function = (PFN_vkFlushMappedMemoryRanges) vkelInterposeGetDeviceFunction(device, 25);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, memoryRangeCount, pMemoryRanges);
+	vkelInterposeEndCall(25, start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceInvalidateMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount, const VkMappedMemoryRange* pMemoryRanges)
+{
+	PFN_vkInvalidateMappedMemoryRanges function = (PFN_vkInvalidateMappedMemoryRanges) vkelInterposeGetDeviceFunction(device, 26);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, memoryRangeCount, pMemoryRanges);
+	vkelInterposeEndCall(26, start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceGetDeviceMemoryCommitment(VkDevice device, VkDeviceMemory memory, VkDeviceSize* pCommittedMemoryInBytes)
+{
+	PFN_vkGetDeviceMemoryCommitment function = (PFN_vkGetDeviceMemoryCommitment) vkelInterposeGetDeviceFunction(device, 27);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(device, memory, pCommittedMemoryInBytes);
+	vkelInterposeEndCall(27, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceBindBufferMemory(VkDevice device, VkBuffer buffer, VkDeviceMemory memory, VkDeviceSize memoryOffset)
+{
+	PFN_vkBindBufferMemory function = (PFN_vkBindBufferMemory) vkelInterposeGetDeviceFunction(device, 28);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, buffer, memory, memoryOffset);
+	vkelInterposeEndCall(28, start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceBindImageMemory(VkDevice device, VkImage image, VkDeviceMemory memory, VkDeviceSize memoryOffset)
+{
+	PFN_vkBindImageMemory function = (PFN_vkBindImageMemory) vkelInterposeGetDeviceFunction(device, 29);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, image, memory, memoryOffset);
+	vkelInterposeEndCall(29, start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceGetBufferMemoryRequirements(VkDevice device, VkBuffer buffer, VkMemoryRequirements* pMemoryRequirements)
+{
+	PFN_vkGetBufferMemoryRequirements function = (PFN_vkGetBufferMemoryRequirements) vkelInterposeGetDeviceFunction(device, 30);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(device, buffer, pMemoryRequirements);
+	vkelInterposeEndCall(30, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceGetImageMemoryRequirements(VkDevice device, VkImage image, VkMemoryRequirements* pMemoryRequirements)
+{
+	PFN_vkGetImageMemoryRequirements function = (PFN_vkGetImageMemoryRequirements) vkelInterposeGetDeviceFunction(device, 31);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(device, image, pMemoryRequirements);
+	vkelInterposeEndCall(31, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceGetImageSparseMemoryRequirements(VkDevice device, VkImage image, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements* pSparseMemoryRequirements)
+{
+	PFN_vkGetImageSparseMemoryRequirements function = (PFN_vkGetImageSparseMemoryRequirements) vkelInterposeGetDeviceFunction(device, 32);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+	vkelInterposeEndCall(32, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceQueueBindSparse(VkQueue queue, uint32_t bindInfoCount, const VkBindSparseInfo* pBindInfo, VkFence fence)
+{
+	PFN_vkQueueBindSparse function = (PFN_vkQueueBindSparse) vkelInterposeGetDeviceFunction(queue, 34);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(queue, bindInfoCount, pBindInfo, fence);
+	vkelInterposeEndCall(34, start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceCreateFence(VkDevice device, const VkFenceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkFence* pFence)
+{
+	PFN_vkCreateFence function = (PFN_vkCreateFence) vkelInterposeGetDeviceFunction(device, 35);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, pCreateInfo, pAllocator, pFence);
+	vkelInterposeEndCall(35, start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceDestroyFence(VkDevice device, VkFence fence, const VkAllocationCallbacks* pAllocator)
+{
+	PFN_vkDestroyFence function = (PFN_vkDestroyFence) vkelInterposeGetDeviceFunction(device, 36);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(device, fence, pAllocator);
+	vkelInterposeEndCall(36, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceResetFences(VkDevice device, uint32_t fenceCount, const VkFence* pFences)
+{
+	PFN_vkResetFences function = (PFN_vkResetFences) vkelInterposeGetDeviceFunction(device, 37);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, fenceCount, pFences);
+	vkelInterposeEndCall(37, start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceGetFenceStatus(VkDevice device, VkFence fence)
+{
+	PFN_vkGetFenceStatus function = (PFN_vkGetFenceStatus) vkelInterposeGetDeviceFunction(device, 38);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, fence);
+	vkelInterposeEndCall(38, start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence* pFences, VkBool32 waitAll, uint64_t timeout)
+{
+	PFN_vkWaitForFences function = (PFN_vkWaitForFences) vkelInterposeGetDeviceFunction(device, 39);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, fenceCount, pFences, waitAll, timeout);
+	vkelInterposeEndCall(39, start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceCreateSemaphore(VkDevice device, const VkSemaphoreCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSemaphore* pSemaphore)
+{
+	PFN_vkCreateSemaphore function = (PFN_vkCreateSemaphore) vkelInterposeGetDeviceFunction(device, 40);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, pCreateInfo, pAllocator, pSemaphore);
+	vkelInterposeEndCall(40, start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceDestroySemaphore(VkDevice device, VkSemaphore semaphore, const VkAllocationCallbacks* pAllocator)
+{
+	PFN_vkDestroySemaphore function = (PFN_vkDestroySemaphore) vkelInterposeGetDeviceFunction(device, 41);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(device, semaphore, pAllocator);
+	vkelInterposeEndCall(41, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceCreateEvent(VkDevice device, const VkEventCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkEvent* pEvent)
+{
+	PFN_vkCreateEvent function = (PFN_vkCreateEvent) vkelInterposeGetDeviceFunction(device, 42);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, pCreateInfo, pAllocator, pEvent);
+	vkelInterposeEndCall(42, start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceDestroyEvent(VkDevice device, VkEvent event, const VkAllocationCallbacks* pAllocator)
+{
+	PFN_vkDestroyEvent function = (PFN_vkDestroyEvent) vkelInterposeGetDeviceFunction(device, 43);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(device, event, pAllocator);
+	vkelInterposeEndCall(43, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceGetEventStatus(VkDevice device, VkEvent event)
+{
+	PFN_vkGetEventStatus function = (PFN_vkGetEventStatus) vkelInterposeGetDeviceFunction(device, 44);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, event);
+	vkelInterposeEndCall(44, start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceSetEvent(VkDevice device, VkEvent event)
+{
+	PFN_vkSetEvent function = (PFN_vkSetEvent) vkelInterposeGetDeviceFunction(device, 45);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, event);
+	vkelInterposeEndCall(45, start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceResetEvent(VkDevice device, VkEvent event)
+{
+	PFN_vkResetEvent function = (PFN_vkResetEvent) vkelInterposeGetDeviceFunction(device, 46);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, event);
+	vkelInterposeEndCall(46, start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceCreateQueryPool(VkDevice device, const VkQueryPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkQueryPool* pQueryPool)
+{
+	PFN_vkCreateQueryPool function = (PFN_vkCreateQueryPool) vkelInterposeGetDeviceFunction(device, 47);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, pCreateInfo, pAllocator, pQueryPool);
+	vkelInterposeEndCall(47, start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceDestroyQueryPool(VkDevice device, VkQueryPool queryPool, const VkAllocationCallbacks* pAllocator)
+{
+	PFN_vkDestroyQueryPool function = (PFN_vkDestroyQueryPool) vkelInterposeGetDeviceFunction(device, 48);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(device, queryPool, pAllocator);
+	vkelInterposeEndCall(48, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceGetQueryPoolResults(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, size_t dataSize, void* pData, VkDeviceSize stride, VkQueryResultFlags flags)
+{
+	PFN_vkGetQueryPoolResults function = (PFN_vkGetQueryPoolResults) vkelInterposeGetDeviceFunction(device, 49);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
+	vkelInterposeEndCall(49, start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceCreateBuffer(VkDevice device, const VkBufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBuffer* pBuffer)
+{
+	PFN_vkCreateBuffer function = (PFN_vkCreateBuffer) vkelInterposeGetDeviceFunction(device, 50);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, pCreateInfo, pAllocator, pBuffer);
+	vkelInterposeEndCall(50, start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceDestroyBuffer(VkDevice device, VkBuffer buffer, const VkAllocationCallbacks* pAllocator)
+{
+	PFN_vkDestroyBuffer function = (PFN_vkDestroyBuffer) vkelInterposeGetDeviceFunction(device, 51);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(device, buffer, pAllocator);
+	vkelInterposeEndCall(51, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceCreateBufferView(VkDevice device, const VkBufferViewCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBufferView* pView)
+{
+	PFN_vkCreateBufferView function = (PFN_vkCreateBufferView) vkelInterposeGetDeviceFunction(device, 52);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, pCreateInfo, pAllocator, pView);
+	vkelInterposeEndCall(52, start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceDestroyBufferView(VkDevice device, VkBufferView bufferView, const VkAllocationCallbacks* pAllocator)
+{
+	PFN_vkDestroyBufferView function = (PFN_vkDestroyBufferView) vkelInterposeGetDeviceFunction(device, 53);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(device, bufferView, pAllocator);
+	vkelInterposeEndCall(53, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceCreateImage(VkDevice device, const VkImageCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkImage* pImage)
+{
+	PFN_vkCreateImage function = (PFN_vkCreateImage) vkelInterposeGetDeviceFunction(device, 54);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, pCreateInfo, pAllocator, pImage);
+	vkelInterposeEndCall(54, start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceDestroyImage(VkDevice device, VkImage image, const VkAllocationCallbacks* pAllocator)
+{
+	PFN_vkDestroyImage function = (PFN_vkDestroyImage) vkelInterposeGetDeviceFunction(device, 55);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(device, image, pAllocator);
+	vkelInterposeEndCall(55, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceGetImageSubresourceLayout(VkDevice device, VkImage image, const VkImageSubresource* pSubresource, VkSubresourceLayout* pLayout)
+{
+	PFN_vkGetImageSubresourceLayout function = (PFN_vkGetImageSubresourceLayout) vkelInterposeGetDeviceFunction(device, 56);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(device, image, pSubresource, pLayout);
+	vkelInterposeEndCall(56, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceCreateImageView(VkDevice device, const VkImageViewCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkImageView* pView)
+{
+	PFN_vkCreateImageView function = (PFN_vkCreateImageView) vkelInterposeGetDeviceFunction(device, 57);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, pCreateInfo, pAllocator, pView);
+	vkelInterposeEndCall(57, start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceDestroyImageView(VkDevice device, VkImageView imageView, const VkAllocationCallbacks* pAllocator)
+{
+	PFN_vkDestroyImageView function = (PFN_vkDestroyImageView) vkelInterposeGetDeviceFunction(device, 58);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(device, imageView, pAllocator);
+	vkelInterposeEndCall(58, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule)
+{
+	PFN_vkCreateShaderModule function = (PFN_vkCreateShaderModule) vkelInterposeGetDeviceFunction(device, 59);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, pCreateInfo, pAllocator, pShaderModule);
+	vkelInterposeEndCall(59, start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceDestroyShaderModule(VkDevice device, VkShaderModule shaderModule, const VkAllocationCallbacks* pAllocator)
+{
+	PFN_vkDestroyShaderModule function = (PFN_vkDestroyShaderModule) vkelInterposeGetDeviceFunction(device, 60);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(device, shaderModule, pAllocator);
+	vkelInterposeEndCall(60, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceCreatePipelineCache(VkDevice device, const VkPipelineCacheCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineCache* pPipelineCache)
+{
+	PFN_vkCreatePipelineCache function = (PFN_vkCreatePipelineCache) vkelInterposeGetDeviceFunction(device, 61);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, pCreateInfo, pAllocator, pPipelineCache);
+	vkelInterposeEndCall(61, start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceDestroyPipelineCache(VkDevice device, VkPipelineCache pipelineCache, const VkAllocationCallbacks* pAllocator)
+{
+	PFN_vkDestroyPipelineCache function = (PFN_vkDestroyPipelineCache) vkelInterposeGetDeviceFunction(device, 62);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(device, pipelineCache, pAllocator);
+	vkelInterposeEndCall(62, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceGetPipelineCacheData(VkDevice device, VkPipelineCache pipelineCache, size_t* pDataSize, void* pData)
+{
+	PFN_vkGetPipelineCacheData function = (PFN_vkGetPipelineCacheData) vkelInterposeGetDeviceFunction(device, 63);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, pipelineCache, pDataSize, pData);
+	vkelInterposeEndCall(63, start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceMergePipelineCaches(VkDevice device, VkPipelineCache dstCache, uint32_t srcCacheCount, const VkPipelineCache* pSrcCaches)
+{
+	PFN_vkMergePipelineCaches function = (PFN_vkMergePipelineCaches) vkelInterposeGetDeviceFunction(device, 64);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, dstCache, srcCacheCount, pSrcCaches);
+	vkelInterposeEndCall(64, start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkGraphicsPipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines)
+{
+	PFN_vkCreateGraphicsPipelines function = (PFN_vkCreateGraphicsPipelines) vkelInterposeGetDeviceFunction(device, 65);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+	vkelInterposeEndCall(65, start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceCreateComputePipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkComputePipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines)
+{
+	PFN_vkCreateComputePipelines function = (PFN_vkCreateComputePipelines) vkelInterposeGetDeviceFunction(device, 66);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+	vkelInterposeEndCall(66, start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceDestroyPipeline(VkDevice device, VkPipeline pipeline, const VkAllocationCallbacks* pAllocator)
+{
+	PFN_vkDestroyPipeline function = (PFN_vkDestroyPipeline) vkelInterposeGetDeviceFunction(device, 67);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(device, pipeline, pAllocator);
+	vkelInterposeEndCall(67, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceCreatePipelineLayout(VkDevice device, const VkPipelineLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineLayout* pPipelineLayout)
+{
+	PFN_vkCreatePipelineLayout function = (PFN_vkCreatePipelineLayout) vkelInterposeGetDeviceFunction(device, 68);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, pCreateInfo, pAllocator, pPipelineLayout);
+	vkelInterposeEndCall(68, start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceDestroyPipelineLayout(VkDevice device, VkPipelineLayout pipelineLayout, const VkAllocationCallbacks* pAllocator)
+{
+	PFN_vkDestroyPipelineLayout function = (PFN_vkDestroyPipelineLayout) vkelInterposeGetDeviceFunction(device, 69);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(device, pipelineLayout, pAllocator);
+	vkelInterposeEndCall(69, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceCreateSampler(VkDevice device, const VkSamplerCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSampler* pSampler)
+{
+	PFN_vkCreateSampler function = (PFN_vkCreateSampler) vkelInterposeGetDeviceFunction(device, 70);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, pCreateInfo, pAllocator, pSampler);
+	vkelInterposeEndCall(70, start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceDestroySampler(VkDevice device, VkSampler sampler, const VkAllocationCallbacks* pAllocator)
+{
+	PFN_vkDestroySampler function = (PFN_vkDestroySampler) vkelInterposeGetDeviceFunction(device, 71);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(device, sampler, pAllocator);
+	vkelInterposeEndCall(71, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceCreateDescriptorSetLayout(VkDevice device, const VkDescriptorSetLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorSetLayout* pSetLayout)
+{
+	PFN_vkCreateDescriptorSetLayout function = (PFN_vkCreateDescriptorSetLayout) vkelInterposeGetDeviceFunction(device, 72);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, pCreateInfo, pAllocator, pSetLayout);
+	vkelInterposeEndCall(72, start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceDestroyDescriptorSetLayout(VkDevice device, VkDescriptorSetLayout descriptorSetLayout, const VkAllocationCallbacks* pAllocator)
+{
+	PFN_vkDestroyDescriptorSetLayout function = (PFN_vkDestroyDescriptorSetLayout) vkelInterposeGetDeviceFunction(device, 73);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(device, descriptorSetLayout, pAllocator);
+	vkelInterposeEndCall(73, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceCreateDescriptorPool(VkDevice device, const VkDescriptorPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorPool* pDescriptorPool)
+{
+	PFN_vkCreateDescriptorPool function = (PFN_vkCreateDescriptorPool) vkelInterposeGetDeviceFunction(device, 74);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, pCreateInfo, pAllocator, pDescriptorPool);
+	vkelInterposeEndCall(74, start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceDestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool, const VkAllocationCallbacks* pAllocator)
+{
+	PFN_vkDestroyDescriptorPool function = (PFN_vkDestroyDescriptorPool) vkelInterposeGetDeviceFunction(device, 75);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(device, descriptorPool, pAllocator);
+	vkelInterposeEndCall(75, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceResetDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool, VkDescriptorPoolResetFlags flags)
+{
+	PFN_vkResetDescriptorPool function = (PFN_vkResetDescriptorPool) vkelInterposeGetDeviceFunction(device, 76);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, descriptorPool, flags);
+	vkelInterposeEndCall(76, start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceAllocateDescriptorSets(VkDevice device, const VkDescriptorSetAllocateInfo* pAllocateInfo, VkDescriptorSet* pDescriptorSets)
+{
+	PFN_vkAllocateDescriptorSets function = (PFN_vkAllocateDescriptorSets) vkelInterposeGetDeviceFunction(device, 77);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, pAllocateInfo, pDescriptorSets);
+	vkelInterposeEndCall(77, start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceFreeDescriptorSets(VkDevice device, VkDescriptorPool descriptorPool, uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets)
+{
+	PFN_vkFreeDescriptorSets function = (PFN_vkFreeDescriptorSets) vkelInterposeGetDeviceFunction(device, 78);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, descriptorPool, descriptorSetCount, pDescriptorSets);
+	vkelInterposeEndCall(78, start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceUpdateDescriptorSets(VkDevice device, uint32_t descriptorWriteCount, const VkWriteDescriptorSet* pDescriptorWrites, uint32_t descriptorCopyCount, const VkCopyDescriptorSet* pDescriptorCopies)
+{
+	PFN_vkUpdateDescriptorSets function = (PFN_vkUpdateDescriptorSets) vkelInterposeGetDeviceFunction(device, 79);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
+	vkelInterposeEndCall(79, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceCreateFramebuffer(VkDevice device, const VkFramebufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkFramebuffer* pFramebuffer)
+{
+	PFN_vkCreateFramebuffer function = (PFN_vkCreateFramebuffer) vkelInterposeGetDeviceFunction(device, 80);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, pCreateInfo, pAllocator, pFramebuffer);
+	vkelInterposeEndCall(80, start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceDestroyFramebuffer(VkDevice device, VkFramebuffer framebuffer, const VkAllocationCallbacks* pAllocator)
+{
+	PFN_vkDestroyFramebuffer function = (PFN_vkDestroyFramebuffer) vkelInterposeGetDeviceFunction(device, 81);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(device, framebuffer, pAllocator);
+	vkelInterposeEndCall(81, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceCreateRenderPass(VkDevice device, const VkRenderPassCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass)
+{
+	PFN_vkCreateRenderPass function = (PFN_vkCreateRenderPass) vkelInterposeGetDeviceFunction(device, 82);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, pCreateInfo, pAllocator, pRenderPass);
+	vkelInterposeEndCall(82, start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceDestroyRenderPass(VkDevice device, VkRenderPass renderPass, const VkAllocationCallbacks* pAllocator)
+{
+	PFN_vkDestroyRenderPass function = (PFN_vkDestroyRenderPass) vkelInterposeGetDeviceFunction(device, 83);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(device, renderPass, pAllocator);
+	vkelInterposeEndCall(83, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceGetRenderAreaGranularity(VkDevice device, VkRenderPass renderPass, VkExtent2D* pGranularity)
+{
+	PFN_vkGetRenderAreaGranularity function = (PFN_vkGetRenderAreaGranularity) vkelInterposeGetDeviceFunction(device, 84);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(device, renderPass, pGranularity);
+	vkelInterposeEndCall(84, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceCreateCommandPool(VkDevice device, const VkCommandPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkCommandPool* pCommandPool)
+{
+	PFN_vkCreateCommandPool function = (PFN_vkCreateCommandPool) vkelInterposeGetDeviceFunction(device, 85);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, pCreateInfo, pAllocator, pCommandPool);
+	vkelInterposeEndCall(85, start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceDestroyCommandPool(VkDevice device, VkCommandPool commandPool, const VkAllocationCallbacks* pAllocator)
+{
+	PFN_vkDestroyCommandPool function = (PFN_vkDestroyCommandPool) vkelInterposeGetDeviceFunction(device, 86);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(device, commandPool, pAllocator);
+	vkelInterposeEndCall(86, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceResetCommandPool(VkDevice device, VkCommandPool commandPool, VkCommandPoolResetFlags flags)
+{
+	PFN_vkResetCommandPool function = (PFN_vkResetCommandPool) vkelInterposeGetDeviceFunction(device, 87);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, commandPool, flags);
+	vkelInterposeEndCall(87, start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceAllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo* pAllocateInfo, VkCommandBuffer* pCommandBuffers)
+{
+	PFN_vkAllocateCommandBuffers function = (PFN_vkAllocateCommandBuffers) vkelInterposeGetDeviceFunction(device, 88);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, pAllocateInfo, pCommandBuffers);
+	vkelInterposeEndCall(88, start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceFreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount, const VkCommandBuffer* pCommandBuffers)
+{
+	PFN_vkFreeCommandBuffers function = (PFN_vkFreeCommandBuffers) vkelInterposeGetDeviceFunction(device, 89);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(device, commandPool, commandBufferCount, pCommandBuffers);
+	vkelInterposeEndCall(89, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceBeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo* pBeginInfo)
+{
+	PFN_vkBeginCommandBuffer function = (PFN_vkBeginCommandBuffer) vkelInterposeGetDeviceFunction(commandBuffer, 90);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(commandBuffer, pBeginInfo);
+	vkelInterposeEndCall(90, start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceEndCommandBuffer(VkCommandBuffer commandBuffer)
+{
+	PFN_vkEndCommandBuffer function = (PFN_vkEndCommandBuffer) vkelInterposeGetDeviceFunction(commandBuffer, 91);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(commandBuffer);
+	vkelInterposeEndCall(91, start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags)
+{
+	PFN_vkResetCommandBuffer function = (PFN_vkResetCommandBuffer) vkelInterposeGetDeviceFunction(commandBuffer, 92);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(commandBuffer, flags);
+	vkelInterposeEndCall(92, start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline)
+{
+	PFN_vkCmdBindPipeline function = (PFN_vkCmdBindPipeline) vkelInterposeGetDeviceFunction(commandBuffer, 93);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, pipelineBindPoint, pipeline);
+	vkelInterposeEndCall(93, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdSetViewport(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkViewport* pViewports)
+{
+	PFN_vkCmdSetViewport function = (PFN_vkCmdSetViewport) vkelInterposeGetDeviceFunction(commandBuffer, 94);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, firstViewport, viewportCount, pViewports);
+	vkelInterposeEndCall(94, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdSetScissor(VkCommandBuffer commandBuffer, uint32_t firstScissor, uint32_t scissorCount, const VkRect2D* pScissors)
+{
+	PFN_vkCmdSetScissor function = (PFN_vkCmdSetScissor) vkelInterposeGetDeviceFunction(commandBuffer, 95);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, firstScissor, scissorCount, pScissors);
+	vkelInterposeEndCall(95, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdSetLineWidth(VkCommandBuffer commandBuffer, float lineWidth)
+{
+	PFN_vkCmdSetLineWidth function = (PFN_vkCmdSetLineWidth) vkelInterposeGetDeviceFunction(commandBuffer, 96);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, lineWidth);
+	vkelInterposeEndCall(96, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdSetDepthBias(VkCommandBuffer commandBuffer, float depthBiasConstantFactor, float depthBiasClamp, float depthBiasSlopeFactor)
+{
+	PFN_vkCmdSetDepthBias function = (PFN_vkCmdSetDepthBias) vkelInterposeGetDeviceFunction(commandBuffer, 97);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
+	vkelInterposeEndCall(97, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdSetBlendConstants(VkCommandBuffer commandBuffer, const float blendConstants[4])
+{
+	PFN_vkCmdSetBlendConstants function = (PFN_vkCmdSetBlendConstants) vkelInterposeGetDeviceFunction(commandBuffer, 98);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, blendConstants);
+	vkelInterposeEndCall(98, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdSetDepthBounds(VkCommandBuffer commandBuffer, float minDepthBounds, float maxDepthBounds)
+{
+	PFN_vkCmdSetDepthBounds function = (PFN_vkCmdSetDepthBounds) vkelInterposeGetDeviceFunction(commandBuffer, 99);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, minDepthBounds, maxDepthBounds);
+	vkelInterposeEndCall(99, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdSetStencilCompareMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t compareMask)
+{
+	PFN_vkCmdSetStencilCompareMask function = (PFN_vkCmdSetStencilCompareMask) vkelInterposeGetDeviceFunction(commandBuffer, 100);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, faceMask, compareMask);
+	vkelInterposeEndCall(100, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdSetStencilWriteMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t writeMask)
+{
+	PFN_vkCmdSetStencilWriteMask function = (PFN_vkCmdSetStencilWriteMask) vkelInterposeGetDeviceFunction(commandBuffer, 101);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, faceMask, writeMask);
+	vkelInterposeEndCall(101, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdSetStencilReference(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t reference)
+{
+	PFN_vkCmdSetStencilReference function = (PFN_vkCmdSetStencilReference) vkelInterposeGetDeviceFunction(commandBuffer, 102);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, faceMask, reference);
+	vkelInterposeEndCall(102, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdBindDescriptorSets(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t firstSet, uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets, uint32_t dynamicOffsetCount, const uint32_t* pDynamicOffsets)
+{
+	PFN_vkCmdBindDescriptorSets function = (PFN_vkCmdBindDescriptorSets) vkelInterposeGetDeviceFunction(commandBuffer, 103);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
+	vkelInterposeEndCall(103, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkIndexType indexType)
+{
+	PFN_vkCmdBindIndexBuffer function = (PFN_vkCmdBindIndexBuffer) vkelInterposeGetDeviceFunction(commandBuffer, 104);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, buffer, offset, indexType);
+	vkelInterposeEndCall(104, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdBindVertexBuffers(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, const VkBuffer* pBuffers, const VkDeviceSize* pOffsets)
+{
+	PFN_vkCmdBindVertexBuffers function = (PFN_vkCmdBindVertexBuffers) vkelInterposeGetDeviceFunction(commandBuffer, 105);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
+	vkelInterposeEndCall(105, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance)
+{
+	PFN_vkCmdDraw function = (PFN_vkCmdDraw) vkelInterposeGetDeviceFunction(commandBuffer, 106);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
+	vkelInterposeEndCall(106, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance)
+{
+	PFN_vkCmdDrawIndexed function = (PFN_vkCmdDrawIndexed) vkelInterposeGetDeviceFunction(commandBuffer, 107);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
+	vkelInterposeEndCall(107, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride)
+{
+	PFN_vkCmdDrawIndirect function = (PFN_vkCmdDrawIndirect) vkelInterposeGetDeviceFunction(commandBuffer, 108);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, buffer, offset, drawCount, stride);
+	vkelInterposeEndCall(108, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdDrawIndexedIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride)
+{
+	PFN_vkCmdDrawIndexedIndirect function = (PFN_vkCmdDrawIndexedIndirect) vkelInterposeGetDeviceFunction(commandBuffer, 109);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, buffer, offset, drawCount, stride);
+	vkelInterposeEndCall(109, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdDispatch(VkCommandBuffer commandBuffer, uint32_t x, uint32_t y, uint32_t z)
+{
+	PFN_vkCmdDispatch function = (PFN_vkCmdDispatch) vkelInterposeGetDeviceFunction(commandBuffer, 110);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, x, y, z);
+	vkelInterposeEndCall(110, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset)
+{
+	PFN_vkCmdDispatchIndirect function = (PFN_vkCmdDispatchIndirect) vkelInterposeGetDeviceFunction(commandBuffer, 111);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, buffer, offset);
+	vkelInterposeEndCall(111, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, uint32_t regionCount, const VkBufferCopy* pRegions)
+{
+	PFN_vkCmdCopyBuffer function = (PFN_vkCmdCopyBuffer) vkelInterposeGetDeviceFunction(commandBuffer, 112);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
+	vkelInterposeEndCall(112, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdCopyImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageCopy* pRegions)
+{
+	PFN_vkCmdCopyImage function = (PFN_vkCmdCopyImage) vkelInterposeGetDeviceFunction(commandBuffer, 113);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+	vkelInterposeEndCall(113, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdBlitImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageBlit* pRegions, VkFilter filter)
+{
+	PFN_vkCmdBlitImage function = (PFN_vkCmdBlitImage) vkelInterposeGetDeviceFunction(commandBuffer, 114);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
+	vkelInterposeEndCall(114, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdCopyBufferToImage(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkBufferImageCopy* pRegions)
+{
+	PFN_vkCmdCopyBufferToImage function = (PFN_vkCmdCopyBufferToImage) vkelInterposeGetDeviceFunction(commandBuffer, 115);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
+	vkelInterposeEndCall(115, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdCopyImageToBuffer(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkBuffer dstBuffer, uint32_t regionCount, const VkBufferImageCopy* pRegions)
+{
+	PFN_vkCmdCopyImageToBuffer function = (PFN_vkCmdCopyImageToBuffer) vkelInterposeGetDeviceFunction(commandBuffer, 116);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
+	vkelInterposeEndCall(116, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize dataSize, const void* pData)
+{
+	PFN_vkCmdUpdateBuffer function = (PFN_vkCmdUpdateBuffer) vkelInterposeGetDeviceFunction(commandBuffer, 117);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
+	vkelInterposeEndCall(117, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize size, uint32_t data)
+{
+	PFN_vkCmdFillBuffer function = (PFN_vkCmdFillBuffer) vkelInterposeGetDeviceFunction(commandBuffer, 118);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, dstBuffer, dstOffset, size, data);
+	vkelInterposeEndCall(118, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdClearColorImage(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const VkClearColorValue* pColor, uint32_t rangeCount, const VkImageSubresourceRange* pRanges)
+{
+	PFN_vkCmdClearColorImage function = (PFN_vkCmdClearColorImage) vkelInterposeGetDeviceFunction(commandBuffer, 119);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
+	vkelInterposeEndCall(119, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdClearDepthStencilImage(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const VkClearDepthStencilValue* pDepthStencil, uint32_t rangeCount, const VkImageSubresourceRange* pRanges)
+{
+	PFN_vkCmdClearDepthStencilImage function = (PFN_vkCmdClearDepthStencilImage) vkelInterposeGetDeviceFunction(commandBuffer, 120);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
+	vkelInterposeEndCall(120, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdClearAttachments(VkCommandBuffer commandBuffer, uint32_t attachmentCount, const VkClearAttachment* pAttachments, uint32_t rectCount, const VkClearRect* pRects)
+{
+	PFN_vkCmdClearAttachments function = (PFN_vkCmdClearAttachments) vkelInterposeGetDeviceFunction(commandBuffer, 121);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
+	vkelInterposeEndCall(121, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdResolveImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageResolve* pRegions)
+{
+	PFN_vkCmdResolveImage function = (PFN_vkCmdResolveImage) vkelInterposeGetDeviceFunction(commandBuffer, 122);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+	vkelInterposeEndCall(122, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdSetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask)
+{
+	PFN_vkCmdSetEvent function = (PFN_vkCmdSetEvent) vkelInterposeGetDeviceFunction(commandBuffer, 123);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, event, stageMask);
+	vkelInterposeEndCall(123, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdResetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask)
+{
+	PFN_vkCmdResetEvent function = (PFN_vkCmdResetEvent) vkelInterposeGetDeviceFunction(commandBuffer, 124);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, event, stageMask);
+	vkelInterposeEndCall(124, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers, uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers)
+{
+	PFN_vkCmdWaitEvents function = (PFN_vkCmdWaitEvents) vkelInterposeGetDeviceFunction(commandBuffer, 125);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+	vkelInterposeEndCall(125, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdPipelineBarrier(VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, VkDependencyFlags dependencyFlags, uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers, uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers)
+{
+	PFN_vkCmdPipelineBarrier function = (PFN_vkCmdPipelineBarrier) vkelInterposeGetDeviceFunction(commandBuffer, 126);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+	vkelInterposeEndCall(126, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query, VkQueryControlFlags flags)
+{
+	PFN_vkCmdBeginQuery function = (PFN_vkCmdBeginQuery) vkelInterposeGetDeviceFunction(commandBuffer, 127);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, queryPool, query, flags);
+	vkelInterposeEndCall(127, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query)
+{
+	PFN_vkCmdEndQuery function = (PFN_vkCmdEndQuery) vkelInterposeGetDeviceFunction(commandBuffer, 128);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, queryPool, query);
+	vkelInterposeEndCall(128, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdResetQueryPool(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount)
+{
+	PFN_vkCmdResetQueryPool function = (PFN_vkCmdResetQueryPool) vkelInterposeGetDeviceFunction(commandBuffer, 129);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, queryPool, firstQuery, queryCount);
+	vkelInterposeEndCall(129, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdWriteTimestamp(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage, VkQueryPool queryPool, uint32_t query)
+{
+	PFN_vkCmdWriteTimestamp function = (PFN_vkCmdWriteTimestamp) vkelInterposeGetDeviceFunction(commandBuffer, 130);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, pipelineStage, queryPool, query);
+	vkelInterposeEndCall(130, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdCopyQueryPoolResults(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize stride, VkQueryResultFlags flags)
+{
+	PFN_vkCmdCopyQueryPoolResults function = (PFN_vkCmdCopyQueryPoolResults) vkelInterposeGetDeviceFunction(commandBuffer, 131);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
+	vkelInterposeEndCall(131, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout layout, VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size, const void* pValues)
+{
+	PFN_vkCmdPushConstants function = (PFN_vkCmdPushConstants) vkelInterposeGetDeviceFunction(commandBuffer, 132);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, layout, stageFlags, offset, size, pValues);
+	vkelInterposeEndCall(132, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin, VkSubpassContents contents)
+{
+	PFN_vkCmdBeginRenderPass function = (PFN_vkCmdBeginRenderPass) vkelInterposeGetDeviceFunction(commandBuffer, 133);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, pRenderPassBegin, contents);
+	vkelInterposeEndCall(133, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpassContents contents)
+{
+	PFN_vkCmdNextSubpass function = (PFN_vkCmdNextSubpass) vkelInterposeGetDeviceFunction(commandBuffer, 134);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, contents);
+	vkelInterposeEndCall(134, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdEndRenderPass(VkCommandBuffer commandBuffer)
+{
+	PFN_vkCmdEndRenderPass function = (PFN_vkCmdEndRenderPass) vkelInterposeGetDeviceFunction(commandBuffer, 135);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer);
+	vkelInterposeEndCall(135, start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceCmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount, const VkCommandBuffer* pCommandBuffers)
+{
+	PFN_vkCmdExecuteCommands function = (PFN_vkCmdExecuteCommands) vkelInterposeGetDeviceFunction(commandBuffer, 136);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(commandBuffer, commandBufferCount, pCommandBuffers);
+	vkelInterposeEndCall(136, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceCreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchain)
+{
+	PFN_vkCreateSwapchainKHR function = (PFN_vkCreateSwapchainKHR) vkelInterposeGetDeviceFunction(device, 142);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, pCreateInfo, pAllocator, pSwapchain);
+	vkelInterposeEndCall(142, start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelInterposeDeviceDestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain, const VkAllocationCallbacks* pAllocator)
+{
+	PFN_vkDestroySwapchainKHR function = (PFN_vkDestroySwapchainKHR) vkelInterposeGetDeviceFunction(device, 143);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	function(device, swapchain, pAllocator);
+	vkelInterposeEndCall(143, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceGetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchain, uint32_t* pSwapchainImageCount, VkImage* pSwapchainImages)
+{
+	PFN_vkGetSwapchainImagesKHR function = (PFN_vkGetSwapchainImagesKHR) vkelInterposeGetDeviceFunction(device, 144);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, swapchain, pSwapchainImageCount, pSwapchainImages);
+	vkelInterposeEndCall(144, start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceAcquireNextImageKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout, VkSemaphore semaphore, VkFence fence, uint32_t* pImageIndex)
+{
+	PFN_vkAcquireNextImageKHR function = (PFN_vkAcquireNextImageKHR) vkelInterposeGetDeviceFunction(device, 145);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, swapchain, timeout, semaphore, fence, pImageIndex);
+	vkelInterposeEndCall(145, start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR* pPresentInfo)
+{
+	PFN_vkQueuePresentKHR function = (PFN_vkQueuePresentKHR) vkelInterposeGetDeviceFunction(queue, 146);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(queue, pPresentInfo);
+	vkelInterposeEndCall(146, start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelInterposeDeviceCreateSharedSwapchainsKHR(VkDevice device, uint32_t swapchainCount, const VkSwapchainCreateInfoKHR* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchains)
+{
+	PFN_vkCreateSharedSwapchainsKHR function = (PFN_vkCreateSharedSwapchainsKHR) vkelInterposeGetDeviceFunction(device, 154);
+	uint64_t start = vkelInterposeGetNanoseconds();
+	VkResult result = function(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
+	vkelInterposeEndCall(154, start);
+	return result;
+}
+
+
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetInstanceProcAddr(VkInstance instance, const char* pName);
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetDeviceProcAddr(VkDevice device, const char* pName);
+
+typedef struct VkelInterposeCommand {
+	const char *pName;
+	PFN_vkVoidFunction function;
+	uint32_t index;
+	PFN_vkVoidFunction deviceFunction;
+} VkelInterposeCommand;
+
+// Sorted by name for bsearch()
+static const VkelInterposeCommand vkelInterposeCommands[] = {
+	{ "vkAcquireNextImageKHR", (PFN_vkVoidFunction) vkAcquireNextImageKHR, 145, (PFN_vkVoidFunction) vkelInterposeDeviceAcquireNextImageKHR },
+	{ "vkAllocateCommandBuffers", (PFN_vkVoidFunction) vkAllocateCommandBuffers, 88, (PFN_vkVoidFunction) vkelInterposeDeviceAllocateCommandBuffers },
+	{ "vkAllocateDescriptorSets", (PFN_vkVoidFunction) vkAllocateDescriptorSets, 77, (PFN_vkVoidFunction) vkelInterposeDeviceAllocateDescriptorSets },
+	{ "vkAllocateMemory", (PFN_vkVoidFunction) vkAllocateMemory, 21, (PFN_vkVoidFunction) vkelInterposeDeviceAllocateMemory },
+	{ "vkBeginCommandBuffer", (PFN_vkVoidFunction) vkBeginCommandBuffer, 90, (PFN_vkVoidFunction) vkelInterposeDeviceBeginCommandBuffer },
+	{ "vkBindBufferMemory", (PFN_vkVoidFunction) vkBindBufferMemory, 28, (PFN_vkVoidFunction) vkelInterposeDeviceBindBufferMemory },
+	{ "vkBindImageMemory", (PFN_vkVoidFunction) vkBindImageMemory, 29, (PFN_vkVoidFunction) vkelInterposeDeviceBindImageMemory },
+	{ "vkCmdBeginQuery", (PFN_vkVoidFunction) vkCmdBeginQuery, 127, (PFN_vkVoidFunction) vkelInterposeDeviceCmdBeginQuery },
+	{ "vkCmdBeginRenderPass", (PFN_vkVoidFunction) vkCmdBeginRenderPass, 133, (PFN_vkVoidFunction) vkelInterposeDeviceCmdBeginRenderPass },
+	{ "vkCmdBindDescriptorSets", (PFN_vkVoidFunction) vkCmdBindDescriptorSets, 103, (PFN_vkVoidFunction) vkelInterposeDeviceCmdBindDescriptorSets },
+	{ "vkCmdBindIndexBuffer", (PFN_vkVoidFunction) vkCmdBindIndexBuffer, 104, (PFN_vkVoidFunction) vkelInterposeDeviceCmdBindIndexBuffer },
+	{ "vkCmdBindPipeline", (PFN_vkVoidFunction) vkCmdBindPipeline, 93, (PFN_vkVoidFunction) vkelInterposeDeviceCmdBindPipeline },
+	{ "vkCmdBindVertexBuffers", (PFN_vkVoidFunction) vkCmdBindVertexBuffers, 105, (PFN_vkVoidFunction) vkelInterposeDeviceCmdBindVertexBuffers },
+	{ "vkCmdBlitImage", (PFN_vkVoidFunction) vkCmdBlitImage, 114, (PFN_vkVoidFunction) vkelInterposeDeviceCmdBlitImage },
+	{ "vkCmdClearAttachments", (PFN_vkVoidFunction) vkCmdClearAttachments, 121, (PFN_vkVoidFunction) vkelInterposeDeviceCmdClearAttachments },
+	{ "vkCmdClearColorImage", (PFN_vkVoidFunction) vkCmdClearColorImage, 119, (PFN_vkVoidFunction) vkelInterposeDeviceCmdClearColorImage },
+	{ "vkCmdClearDepthStencilImage", (PFN_vkVoidFunction) vkCmdClearDepthStencilImage, 120, (PFN_vkVoidFunction) vkelInterposeDeviceCmdClearDepthStencilImage },
+	{ "vkCmdCopyBuffer", (PFN_vkVoidFunction) vkCmdCopyBuffer, 112, (PFN_vkVoidFunction) vkelInterposeDeviceCmdCopyBuffer },
+	{ "vkCmdCopyBufferToImage", (PFN_vkVoidFunction) vkCmdCopyBufferToImage, 115, (PFN_vkVoidFunction) vkelInterposeDeviceCmdCopyBufferToImage },
+	{ "vkCmdCopyImage", (PFN_vkVoidFunction) vkCmdCopyImage, 113, (PFN_vkVoidFunction) vkelInterposeDeviceCmdCopyImage },
+	{ "vkCmdCopyImageToBuffer", (PFN_vkVoidFunction) vkCmdCopyImageToBuffer, 116, (PFN_vkVoidFunction) vkelInterposeDeviceCmdCopyImageToBuffer },
+	{ "vkCmdCopyQueryPoolResults", (PFN_vkVoidFunction) vkCmdCopyQueryPoolResults, 131, (PFN_vkVoidFunction) vkelInterposeDeviceCmdCopyQueryPoolResults },
+	{ "vkCmdDispatch", (PFN_vkVoidFunction) vkCmdDispatch, 110, (PFN_vkVoidFunction) vkelInterposeDeviceCmdDispatch },
+	{ "vkCmdDispatchIndirect", (PFN_vkVoidFunction) vkCmdDispatchIndirect, 111, (PFN_vkVoidFunction) vkelInterposeDeviceCmdDispatchIndirect },
+	{ "vkCmdDraw", (PFN_vkVoidFunction) vkCmdDraw, 106, (PFN_vkVoidFunction) vkelInterposeDeviceCmdDraw },
+	{ "vkCmdDrawIndexed", (PFN_vkVoidFunction) vkCmdDrawIndexed, 107, (PFN_vkVoidFunction) vkelInterposeDeviceCmdDrawIndexed },
+	{ "vkCmdDrawIndexedIndirect", (PFN_vkVoidFunction) vkCmdDrawIndexedIndirect, 109, (PFN_vkVoidFunction) vkelInterposeDeviceCmdDrawIndexedIndirect },
+	{ "vkCmdDrawIndirect", (PFN_vkVoidFunction) vkCmdDrawIndirect, 108, (PFN_vkVoidFunction) vkelInterposeDeviceCmdDrawIndirect },
+	{ "vkCmdEndQuery", (PFN_vkVoidFunction) vkCmdEndQuery, 128, (PFN_vkVoidFunction) vkelInterposeDeviceCmdEndQuery },
+	{ "vkCmdEndRenderPass", (PFN_vkVoidFunction) vkCmdEndRenderPass, 135, (PFN_vkVoidFunction) vkelInterposeDeviceCmdEndRenderPass },
+	{ "vkCmdExecuteCommands", (PFN_vkVoidFunction) vkCmdExecuteCommands, 136, (PFN_vkVoidFunction) vkelInterposeDeviceCmdExecuteCommands },
+	{ "vkCmdFillBuffer", (PFN_vkVoidFunction) vkCmdFillBuffer, 118, (PFN_vkVoidFunction) vkelInterposeDeviceCmdFillBuffer },
+	{ "vkCmdNextSubpass", (PFN_vkVoidFunction) vkCmdNextSubpass, 134, (PFN_vkVoidFunction) vkelInterposeDeviceCmdNextSubpass },
+	{ "vkCmdPipelineBarrier", (PFN_vkVoidFunction) vkCmdPipelineBarrier, 126, (PFN_vkVoidFunction) vkelInterposeDeviceCmdPipelineBarrier },
+	{ "vkCmdPushConstants", (PFN_vkVoidFunction) vkCmdPushConstants, 132, (PFN_vkVoidFunction) vkelInterposeDeviceCmdPushConstants },
+	{ "vkCmdResetEvent", (PFN_vkVoidFunction) vkCmdResetEvent, 124, (PFN_vkVoidFunction) vkelInterposeDeviceCmdResetEvent },
+	{ "vkCmdResetQueryPool", (PFN_vkVoidFunction) vkCmdResetQueryPool, 129, (PFN_vkVoidFunction) vkelInterposeDeviceCmdResetQueryPool },
+	{ "vkCmdResolveImage", (PFN_vkVoidFunction) vkCmdResolveImage, 122, (PFN_vkVoidFunction) vkelInterposeDeviceCmdResolveImage },
+	{ "vkCmdSetBlendConstants", (PFN_vkVoidFunction) vkCmdSetBlendConstants, 98, (PFN_vkVoidFunction) vkelInterposeDeviceCmdSetBlendConstants },
+	{ "vkCmdSetDepthBias", (PFN_vkVoidFunction) vkCmdSetDepthBias, 97, (PFN_vkVoidFunction) vkelInterposeDeviceCmdSetDepthBias },
+	{ "vkCmdSetDepthBounds", (PFN_vkVoidFunction) vkCmdSetDepthBounds, 99, (PFN_vkVoidFunction) vkelInterposeDeviceCmdSetDepthBounds },
+	{ "vkCmdSetEvent", (PFN_vkVoidFunction) vkCmdSetEvent, 123, (PFN_vkVoidFunction) vkelInterposeDeviceCmdSetEvent },
+	{ "vkCmdSetLineWidth", (PFN_vkVoidFunction) vkCmdSetLineWidth, 96, (PFN_vkVoidFunction) vkelInterposeDeviceCmdSetLineWidth },
+	{ "vkCmdSetScissor", (PFN_vkVoidFunction) vkCmdSetScissor, 95, (PFN_vkVoidFunction) vkelInterposeDeviceCmdSetScissor },
+	{ "vkCmdSetStencilCompareMask", (PFN_vkVoidFunction) vkCmdSetStencilCompareMask, 100, (PFN_vkVoidFunction) vkelInterposeDeviceCmdSetStencilCompareMask },
+	{ "vkCmdSetStencilReference", (PFN_vkVoidFunction) vkCmdSetStencilReference, 102, (PFN_vkVoidFunction) vkelInterposeDeviceCmdSetStencilReference },
+	{ "vkCmdSetStencilWriteMask", (PFN_vkVoidFunction) vkCmdSetStencilWriteMask, 101, (PFN_vkVoidFunction) vkelInterposeDeviceCmdSetStencilWriteMask },
+	{ "vkCmdSetViewport", (PFN_vkVoidFunction) vkCmdSetViewport, 94, (PFN_vkVoidFunction) vkelInterposeDeviceCmdSetViewport },
+	{ "vkCmdUpdateBuffer", (PFN_vkVoidFunction) vkCmdUpdateBuffer, 117, (PFN_vkVoidFunction) vkelInterposeDeviceCmdUpdateBuffer },
+	{ "vkCmdWaitEvents", (PFN_vkVoidFunction) vkCmdWaitEvents, 125, (PFN_vkVoidFunction) vkelInterposeDeviceCmdWaitEvents },
+	{ "vkCmdWriteTimestamp", (PFN_vkVoidFunction) vkCmdWriteTimestamp, 130, (PFN_vkVoidFunction) vkelInterposeDeviceCmdWriteTimestamp },
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+	{ "vkCreateAndroidSurfaceKHR", (PFN_vkVoidFunction) vkCreateAndroidSurfaceKHR, 163, NULL },
+#endif /* VK_USE_PLATFORM_ANDROID_KHR */
+	{ "vkCreateBuffer", (PFN_vkVoidFunction) vkCreateBuffer, 50, (PFN_vkVoidFunction) vkelInterposeDeviceCreateBuffer },
+	{ "vkCreateBufferView", (PFN_vkVoidFunction) vkCreateBufferView, 52, (PFN_vkVoidFunction) vkelInterposeDeviceCreateBufferView },
+	{ "vkCreateCommandPool", (PFN_vkVoidFunction) vkCreateCommandPool, 85, (PFN_vkVoidFunction) vkelInterposeDeviceCreateCommandPool },
+	{ "vkCreateComputePipelines", (PFN_vkVoidFunction) vkCreateComputePipelines, 66, (PFN_vkVoidFunction) vkelInterposeDeviceCreateComputePipelines },
+	{ "vkCreateDescriptorPool", (PFN_vkVoidFunction) vkCreateDescriptorPool, 74, (PFN_vkVoidFunction) vkelInterposeDeviceCreateDescriptorPool },
+	{ "vkCreateDescriptorSetLayout", (PFN_vkVoidFunction) vkCreateDescriptorSetLayout, 72, (PFN_vkVoidFunction) vkelInterposeDeviceCreateDescriptorSetLayout },
+	{ "vkCreateDevice", (PFN_vkVoidFunction) vkCreateDevice, 11, NULL },
+	{ "vkCreateDisplayModeKHR", (PFN_vkVoidFunction) vkCreateDisplayModeKHR, 151, NULL },
+	{ "vkCreateDisplayPlaneSurfaceKHR", (PFN_vkVoidFunction) vkCreateDisplayPlaneSurfaceKHR, 153, NULL },
+	{ "vkCreateEvent", (PFN_vkVoidFunction) vkCreateEvent, 42, (PFN_vkVoidFunction) vkelInterposeDeviceCreateEvent },
+	{ "vkCreateFence", (PFN_vkVoidFunction) vkCreateFence, 35, (PFN_vkVoidFunction) vkelInterposeDeviceCreateFence },
+	{ "vkCreateFramebuffer", (PFN_vkVoidFunction) vkCreateFramebuffer, 80, (PFN_vkVoidFunction) vkelInterposeDeviceCreateFramebuffer },
+	{ "vkCreateGraphicsPipelines", (PFN_vkVoidFunction) vkCreateGraphicsPipelines, 65, (PFN_vkVoidFunction) vkelInterposeDeviceCreateGraphicsPipelines },
+	{ "vkCreateImage", (PFN_vkVoidFunction) vkCreateImage, 54, (PFN_vkVoidFunction) vkelInterposeDeviceCreateImage },
+	{ "vkCreateImageView", (PFN_vkVoidFunction) vkCreateImageView, 57, (PFN_vkVoidFunction) vkelInterposeDeviceCreateImageView },
+	{ "vkCreateInstance", (PFN_vkVoidFunction) vkCreateInstance, 0, NULL },
+#ifdef VK_USE_PLATFORM_MIR_KHR
+	{ "vkCreateMirSurfaceKHR", (PFN_vkVoidFunction) vkCreateMirSurfaceKHR, 161, NULL },
+#endif /* VK_USE_PLATFORM_MIR_KHR */
+	{ "vkCreatePipelineCache", (PFN_vkVoidFunction) vkCreatePipelineCache, 61, (PFN_vkVoidFunction) vkelInterposeDeviceCreatePipelineCache },
+	{ "vkCreatePipelineLayout", (PFN_vkVoidFunction) vkCreatePipelineLayout, 68, (PFN_vkVoidFunction) vkelInterposeDeviceCreatePipelineLayout },
+	{ "vkCreateQueryPool", (PFN_vkVoidFunction) vkCreateQueryPool, 47, (PFN_vkVoidFunction) vkelInterposeDeviceCreateQueryPool },
+	{ "vkCreateRenderPass", (PFN_vkVoidFunction) vkCreateRenderPass, 82, (PFN_vkVoidFunction) vkelInterposeDeviceCreateRenderPass },
+	{ "vkCreateSampler", (PFN_vkVoidFunction) vkCreateSampler, 70, (PFN_vkVoidFunction) vkelInterposeDeviceCreateSampler },
+	{ "vkCreateSemaphore", (PFN_vkVoidFunction) vkCreateSemaphore, 40, (PFN_vkVoidFunction) vkelInterposeDeviceCreateSemaphore },
+	{ "vkCreateShaderModule", (PFN_vkVoidFunction) vkCreateShaderModule, 59, (PFN_vkVoidFunction) vkelInterposeDeviceCreateShaderModule },
+	{ "vkCreateSharedSwapchainsKHR", (PFN_vkVoidFunction) vkCreateSharedSwapchainsKHR, 154, (PFN_vkVoidFunction) vkelInterposeDeviceCreateSharedSwapchainsKHR },
+	{ "vkCreateSwapchainKHR", (PFN_vkVoidFunction) vkCreateSwapchainKHR, 142, (PFN_vkVoidFunction) vkelInterposeDeviceCreateSwapchainKHR },
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+	{ "vkCreateWaylandSurfaceKHR", (PFN_vkVoidFunction) vkCreateWaylandSurfaceKHR, 159, NULL },
+#endif /* VK_USE_PLATFORM_WAYLAND_KHR */
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+	{ "vkCreateWin32SurfaceKHR", (PFN_vkVoidFunction) vkCreateWin32SurfaceKHR, 164, NULL },
+#endif /* VK_USE_PLATFORM_WIN32_KHR */
+#ifdef VK_USE_PLATFORM_XCB_KHR
+	{ "vkCreateXcbSurfaceKHR", (PFN_vkVoidFunction) vkCreateXcbSurfaceKHR, 157, NULL },
+#endif /* VK_USE_PLATFORM_XCB_KHR */
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+	{ "vkCreateXlibSurfaceKHR", (PFN_vkVoidFunction) vkCreateXlibSurfaceKHR, 155, NULL },
+#endif /* VK_USE_PLATFORM_XLIB_KHR */
+	{ "vkDestroyBuffer", (PFN_vkVoidFunction) vkDestroyBuffer, 51, (PFN_vkVoidFunction) vkelInterposeDeviceDestroyBuffer },
+	{ "vkDestroyBufferView", (PFN_vkVoidFunction) vkDestroyBufferView, 53, (PFN_vkVoidFunction) vkelInterposeDeviceDestroyBufferView },
+	{ "vkDestroyCommandPool", (PFN_vkVoidFunction) vkDestroyCommandPool, 86, (PFN_vkVoidFunction) vkelInterposeDeviceDestroyCommandPool },
+	{ "vkDestroyDescriptorPool", (PFN_vkVoidFunction) vkDestroyDescriptorPool, 75, (PFN_vkVoidFunction) vkelInterposeDeviceDestroyDescriptorPool },
+	{ "vkDestroyDescriptorSetLayout", (PFN_vkVoidFunction) vkDestroyDescriptorSetLayout, 73, (PFN_vkVoidFunction) vkelInterposeDeviceDestroyDescriptorSetLayout },
+	{ "vkDestroyDevice", (PFN_vkVoidFunction) vkDestroyDevice, 12, (PFN_vkVoidFunction) vkelInterposeDeviceDestroyDevice },
+	{ "vkDestroyEvent", (PFN_vkVoidFunction) vkDestroyEvent, 43, (PFN_vkVoidFunction) vkelInterposeDeviceDestroyEvent },
+	{ "vkDestroyFence", (PFN_vkVoidFunction) vkDestroyFence, 36, (PFN_vkVoidFunction) vkelInterposeDeviceDestroyFence },
+	{ "vkDestroyFramebuffer", (PFN_vkVoidFunction) vkDestroyFramebuffer, 81, (PFN_vkVoidFunction) vkelInterposeDeviceDestroyFramebuffer },
+	{ "vkDestroyImage", (PFN_vkVoidFunction) vkDestroyImage, 55, (PFN_vkVoidFunction) vkelInterposeDeviceDestroyImage },
+	{ "vkDestroyImageView", (PFN_vkVoidFunction) vkDestroyImageView, 58, (PFN_vkVoidFunction) vkelInterposeDeviceDestroyImageView },
+	{ "vkDestroyInstance", (PFN_vkVoidFunction) vkDestroyInstance, 1, NULL },
+	{ "vkDestroyPipeline", (PFN_vkVoidFunction) vkDestroyPipeline, 67, (PFN_vkVoidFunction) vkelInterposeDeviceDestroyPipeline },
+	{ "vkDestroyPipelineCache", (PFN_vkVoidFunction) vkDestroyPipelineCache, 62, (PFN_vkVoidFunction) vkelInterposeDeviceDestroyPipelineCache },
+	{ "vkDestroyPipelineLayout", (PFN_vkVoidFunction) vkDestroyPipelineLayout, 69, (PFN_vkVoidFunction) vkelInterposeDeviceDestroyPipelineLayout },
+	{ "vkDestroyQueryPool", (PFN_vkVoidFunction) vkDestroyQueryPool, 48, (PFN_vkVoidFunction) vkelInterposeDeviceDestroyQueryPool },
+	{ "vkDestroyRenderPass", (PFN_vkVoidFunction) vkDestroyRenderPass, 83, (PFN_vkVoidFunction) vkelInterposeDeviceDestroyRenderPass },
+	{ "vkDestroySampler", (PFN_vkVoidFunction) vkDestroySampler, 71, (PFN_vkVoidFunction) vkelInterposeDeviceDestroySampler },
+	{ "vkDestroySemaphore", (PFN_vkVoidFunction) vkDestroySemaphore, 41, (PFN_vkVoidFunction) vkelInterposeDeviceDestroySemaphore },
+	{ "vkDestroyShaderModule", (PFN_vkVoidFunction) vkDestroyShaderModule, 60, (PFN_vkVoidFunction) vkelInterposeDeviceDestroyShaderModule },
+	{ "vkDestroySurfaceKHR", (PFN_vkVoidFunction) vkDestroySurfaceKHR, 137, NULL },
+	{ "vkDestroySwapchainKHR", (PFN_vkVoidFunction) vkDestroySwapchainKHR, 143, (PFN_vkVoidFunction) vkelInterposeDeviceDestroySwapchainKHR },
+	{ "vkDeviceWaitIdle", (PFN_vkVoidFunction) vkDeviceWaitIdle, 20, (PFN_vkVoidFunction) vkelInterposeDeviceDeviceWaitIdle },
+	{ "vkEndCommandBuffer", (PFN_vkVoidFunction) vkEndCommandBuffer, 91, (PFN_vkVoidFunction) vkelInterposeDeviceEndCommandBuffer },
+	{ "vkEnumerateDeviceExtensionProperties", (PFN_vkVoidFunction) vkEnumerateDeviceExtensionProperties, 14, NULL },
+	{ "vkEnumerateDeviceLayerProperties", (PFN_vkVoidFunction) vkEnumerateDeviceLayerProperties, 16, NULL },
+	{ "vkEnumerateInstanceExtensionProperties", (PFN_vkVoidFunction) vkEnumerateInstanceExtensionProperties, 13, NULL },
+	{ "vkEnumerateInstanceLayerProperties", (PFN_vkVoidFunction) vkEnumerateInstanceLayerProperties, 15, NULL },
+	{ "vkEnumeratePhysicalDevices", (PFN_vkVoidFunction) vkEnumeratePhysicalDevices, 2, NULL },
+	{ "vkFlushMappedMemoryRanges", (PFN_vkVoidFunction) vkFlushMappedMemoryRanges, 25, (PFN_vkVoidFunction) vkelInterposeDeviceFlushMappedMemoryRanges },
+	{ "vkFreeCommandBuffers", (PFN_vkVoidFunction) vkFreeCommandBuffers, 89, (PFN_vkVoidFunction) vkelInterposeDeviceFreeCommandBuffers },
+	{ "vkFreeDescriptorSets", (PFN_vkVoidFunction) vkFreeDescriptorSets, 78, (PFN_vkVoidFunction) vkelInterposeDeviceFreeDescriptorSets },
+	{ "vkFreeMemory", (PFN_vkVoidFunction) vkFreeMemory, 22, (PFN_vkVoidFunction) vkelInterposeDeviceFreeMemory },
+	{ "vkGetBufferMemoryRequirements", (PFN_vkVoidFunction) vkGetBufferMemoryRequirements, 30, (PFN_vkVoidFunction) vkelInterposeDeviceGetBufferMemoryRequirements },
+	{ "vkGetDeviceMemoryCommitment", (PFN_vkVoidFunction) vkGetDeviceMemoryCommitment, 27, (PFN_vkVoidFunction) vkelInterposeDeviceGetDeviceMemoryCommitment },
+	{ "vkGetDeviceProcAddr", (PFN_vkVoidFunction) vkGetDeviceProcAddr, 10, NULL },
+	{ "vkGetDeviceQueue", (PFN_vkVoidFunction) vkGetDeviceQueue, 17, (PFN_vkVoidFunction) vkelInterposeDeviceGetDeviceQueue },
+	{ "vkGetDisplayModePropertiesKHR", (PFN_vkVoidFunction) vkGetDisplayModePropertiesKHR, 150, NULL },
+	{ "vkGetDisplayPlaneCapabilitiesKHR", (PFN_vkVoidFunction) vkGetDisplayPlaneCapabilitiesKHR, 152, NULL },
+	{ "vkGetDisplayPlaneSupportedDisplaysKHR", (PFN_vkVoidFunction) vkGetDisplayPlaneSupportedDisplaysKHR, 149, NULL },
+	{ "vkGetEventStatus", (PFN_vkVoidFunction) vkGetEventStatus, 44, (PFN_vkVoidFunction) vkelInterposeDeviceGetEventStatus },
+	{ "vkGetFenceStatus", (PFN_vkVoidFunction) vkGetFenceStatus, 38, (PFN_vkVoidFunction) vkelInterposeDeviceGetFenceStatus },
+	{ "vkGetImageMemoryRequirements", (PFN_vkVoidFunction) vkGetImageMemoryRequirements, 31, (PFN_vkVoidFunction) vkelInterposeDeviceGetImageMemoryRequirements },
+	{ "vkGetImageSparseMemoryRequirements", (PFN_vkVoidFunction) vkGetImageSparseMemoryRequirements, 32, (PFN_vkVoidFunction) vkelInterposeDeviceGetImageSparseMemoryRequirements },
+	{ "vkGetImageSubresourceLayout", (PFN_vkVoidFunction) vkGetImageSubresourceLayout, 56, (PFN_vkVoidFunction) vkelInterposeDeviceGetImageSubresourceLayout },
+	{ "vkGetInstanceProcAddr", (PFN_vkVoidFunction) vkGetInstanceProcAddr, 9, NULL },
+	{ "vkGetPhysicalDeviceDisplayPlanePropertiesKHR", (PFN_vkVoidFunction) vkGetPhysicalDeviceDisplayPlanePropertiesKHR, 148, NULL },
+	{ "vkGetPhysicalDeviceDisplayPropertiesKHR", (PFN_vkVoidFunction) vkGetPhysicalDeviceDisplayPropertiesKHR, 147, NULL },
+	{ "vkGetPhysicalDeviceFeatures", (PFN_vkVoidFunction) vkGetPhysicalDeviceFeatures, 3, NULL },
+	{ "vkGetPhysicalDeviceFormatProperties", (PFN_vkVoidFunction) vkGetPhysicalDeviceFormatProperties, 4, NULL },
+	{ "vkGetPhysicalDeviceImageFormatProperties", (PFN_vkVoidFunction) vkGetPhysicalDeviceImageFormatProperties, 5, NULL },
+	{ "vkGetPhysicalDeviceMemoryProperties", (PFN_vkVoidFunction) vkGetPhysicalDeviceMemoryProperties, 8, NULL },
+#ifdef VK_USE_PLATFORM_MIR_KHR
+	{ "vkGetPhysicalDeviceMirPresentationSupportKHR", (PFN_vkVoidFunction) vkGetPhysicalDeviceMirPresentationSupportKHR, 162, NULL },
+#endif /* VK_USE_PLATFORM_MIR_KHR */
+	{ "vkGetPhysicalDeviceProperties", (PFN_vkVoidFunction) vkGetPhysicalDeviceProperties, 6, NULL },
+	{ "vkGetPhysicalDeviceQueueFamilyProperties", (PFN_vkVoidFunction) vkGetPhysicalDeviceQueueFamilyProperties, 7, NULL },
+	{ "vkGetPhysicalDeviceSparseImageFormatProperties", (PFN_vkVoidFunction) vkGetPhysicalDeviceSparseImageFormatProperties, 33, NULL },
+	{ "vkGetPhysicalDeviceSurfaceCapabilitiesKHR", (PFN_vkVoidFunction) vkGetPhysicalDeviceSurfaceCapabilitiesKHR, 139, NULL },
+	{ "vkGetPhysicalDeviceSurfaceFormatsKHR", (PFN_vkVoidFunction) vkGetPhysicalDeviceSurfaceFormatsKHR, 140, NULL },
+	{ "vkGetPhysicalDeviceSurfacePresentModesKHR", (PFN_vkVoidFunction) vkGetPhysicalDeviceSurfacePresentModesKHR, 141, NULL },
+	{ "vkGetPhysicalDeviceSurfaceSupportKHR", (PFN_vkVoidFunction) vkGetPhysicalDeviceSurfaceSupportKHR, 138, NULL },
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+	{ "vkGetPhysicalDeviceWaylandPresentationSupportKHR", (PFN_vkVoidFunction) vkGetPhysicalDeviceWaylandPresentationSupportKHR, 160, NULL },
+#endif /* VK_USE_PLATFORM_WAYLAND_KHR */
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+	{ "vkGetPhysicalDeviceWin32PresentationSupportKHR", (PFN_vkVoidFunction) vkGetPhysicalDeviceWin32PresentationSupportKHR, 165, NULL },
+#endif /* VK_USE_PLATFORM_WIN32_KHR */
+#ifdef VK_USE_PLATFORM_XCB_KHR
+	{ "vkGetPhysicalDeviceXcbPresentationSupportKHR", (PFN_vkVoidFunction) vkGetPhysicalDeviceXcbPresentationSupportKHR, 158, NULL },
+#endif /* VK_USE_PLATFORM_XCB_KHR */
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+	{ "vkGetPhysicalDeviceXlibPresentationSupportKHR", (PFN_vkVoidFunction) vkGetPhysicalDeviceXlibPresentationSupportKHR, 156, NULL },
+#endif /* VK_USE_PLATFORM_XLIB_KHR */
+	{ "vkGetPipelineCacheData", (PFN_vkVoidFunction) vkGetPipelineCacheData, 63, (PFN_vkVoidFunction) vkelInterposeDeviceGetPipelineCacheData },
+	{ "vkGetQueryPoolResults", (PFN_vkVoidFunction) vkGetQueryPoolResults, 49, (PFN_vkVoidFunction) vkelInterposeDeviceGetQueryPoolResults },
+	{ "vkGetRenderAreaGranularity", (PFN_vkVoidFunction) vkGetRenderAreaGranularity, 84, (PFN_vkVoidFunction) vkelInterposeDeviceGetRenderAreaGranularity },
+	{ "vkGetSwapchainImagesKHR", (PFN_vkVoidFunction) vkGetSwapchainImagesKHR, 144, (PFN_vkVoidFunction) vkelInterposeDeviceGetSwapchainImagesKHR },
+	{ "vkInvalidateMappedMemoryRanges", (PFN_vkVoidFunction) vkInvalidateMappedMemoryRanges, 26, (PFN_vkVoidFunction) vkelInterposeDeviceInvalidateMappedMemoryRanges },
+	{ "vkMapMemory", (PFN_vkVoidFunction) vkMapMemory, 23, (PFN_vkVoidFunction) vkelInterposeDeviceMapMemory },
+	{ "vkMergePipelineCaches", (PFN_vkVoidFunction) vkMergePipelineCaches, 64, (PFN_vkVoidFunction) vkelInterposeDeviceMergePipelineCaches },
+	{ "vkQueueBindSparse", (PFN_vkVoidFunction) vkQueueBindSparse, 34, (PFN_vkVoidFunction) vkelInterposeDeviceQueueBindSparse },
+	{ "vkQueuePresentKHR", (PFN_vkVoidFunction) vkQueuePresentKHR, 146, (PFN_vkVoidFunction) vkelInterposeDeviceQueuePresentKHR },
+	{ "vkQueueSubmit", (PFN_vkVoidFunction) vkQueueSubmit, 18, (PFN_vkVoidFunction) vkelInterposeDeviceQueueSubmit },
+	{ "vkQueueWaitIdle", (PFN_vkVoidFunction) vkQueueWaitIdle, 19, (PFN_vkVoidFunction) vkelInterposeDeviceQueueWaitIdle },
+	{ "vkResetCommandBuffer", (PFN_vkVoidFunction) vkResetCommandBuffer, 92, (PFN_vkVoidFunction) vkelInterposeDeviceResetCommandBuffer },
+	{ "vkResetCommandPool", (PFN_vkVoidFunction) vkResetCommandPool, 87, (PFN_vkVoidFunction) vkelInterposeDeviceResetCommandPool },
+	{ "vkResetDescriptorPool", (PFN_vkVoidFunction) vkResetDescriptorPool, 76, (PFN_vkVoidFunction) vkelInterposeDeviceResetDescriptorPool },
+	{ "vkResetEvent", (PFN_vkVoidFunction) vkResetEvent, 46, (PFN_vkVoidFunction) vkelInterposeDeviceResetEvent },
+	{ "vkResetFences", (PFN_vkVoidFunction) vkResetFences, 37, (PFN_vkVoidFunction) vkelInterposeDeviceResetFences },
+	{ "vkSetEvent", (PFN_vkVoidFunction) vkSetEvent, 45, (PFN_vkVoidFunction) vkelInterposeDeviceSetEvent },
+	{ "vkUnmapMemory", (PFN_vkVoidFunction) vkUnmapMemory, 24, (PFN_vkVoidFunction) vkelInterposeDeviceUnmapMemory },
+	{ "vkUpdateDescriptorSets", (PFN_vkVoidFunction) vkUpdateDescriptorSets, 79, (PFN_vkVoidFunction) vkelInterposeDeviceUpdateDescriptorSets },
+	{ "vkWaitForFences", (PFN_vkVoidFunction) vkWaitForFences, 39, (PFN_vkVoidFunction) vkelInterposeDeviceWaitForFences },
+};
+
+static int vkelInterposeCompareCommand(const void *pName, const void *pCommand)
+{
+	return strcmp((const char*) pName, ((const VkelInterposeCommand*) pCommand)->pName);
+}
+
+static const VkelInterposeCommand* vkelInterposeFindCommand(const char *pName)
+{
+	return (const VkelInterposeCommand*) bsearch(pName, vkelInterposeCommands, sizeof(vkelInterposeCommands) / sizeof(vkelInterposeCommands[0]), sizeof(vkelInterposeCommands[0]), vkelInterposeCompareCommand);
+}
+
+// Hands out the interposed function instead, when the command exists. Other commands (like
+// EXT ones) aren't exported by libvulkan, so they are handed out as is and aren't counted.
+static PFN_vkVoidFunction vkelInterposeWrap(const char *pName, PFN_vkVoidFunction function)
+{
+	const VkelInterposeCommand *pCommand;
+	
+	if (!function)
+		return NULL;
+	
+	pCommand = vkelInterposeFindCommand(pName);
+	
+	return pCommand ? pCommand->function : function;
+}
+
+// Device functions are the driver's own, which skip the trampolines of libvulkan. They are
+// kept for the device, and handed out as a wrapper which times them instead.
+static PFN_vkVoidFunction vkelInterposeWrapDevice(VkDevice device, const char *pName, PFN_vkVoidFunction function)
+{
+	const VkelInterposeCommand *pCommand;
+	VkelInterposeDevice *pDevice;
+	
+	if (!function)
+		return NULL;
+	
+	pCommand = vkelInterposeFindCommand(pName);
+	
+	// Or the next library handed out the interposed function already, which would count twice
+	if (!pCommand || function == pCommand->function)
+		return function;
+	
+	if (!pCommand->deviceFunction || !(pDevice = vkelInterposeAddDevice(vkelInterposeGetDispatchKey(device))))
+		return pCommand->function;
+	
+	__atomic_store_n(&pDevice->functions[pCommand->index], function, __ATOMIC_RELEASE);
+	
+	return pCommand->deviceFunction;
+}
+
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetInstanceProcAddr(VkInstance instance, const char* pName)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	PFN_vkVoidFunction function = vkelInterposeWrap(pName, ((PFN_vkGetInstanceProcAddr) vkelInterposeGetNext(9))(instance, pName));
+	vkelInterposeEndCall(9, start);
+	return function;
+}
+
+VKEL_INTERPOSE_EXPORT VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetDeviceProcAddr(VkDevice device, const char* pName)
+{
+	uint64_t start = vkelInterposeGetNanoseconds();
+	PFN_vkVoidFunction function = vkelInterposeWrapDevice(device, pName, ((PFN_vkGetDeviceProcAddr) vkelInterposeGetNext(10))(device, pName));
+	vkelInterposeEndCall(10, start);
+	return function;
+}
@@ -0,0 +1,2668 @@
+//========================================================================
+// Name
+//     Vulkan (Cross-Platform) Extension Loader
+//
+// Repository
+//     https://github.com/MrVallentin/vkel
+//
+// Overview
+//     This is a simple, dynamic and tiny cross-platform Vulkan
+//     extension loader.
+//
+// Dependencies
+//     Vulkan (library)
+//     Windows (header) - needed for library loading on Windows
+//     dlfcn (header) - needed for library loading on non-Windows OS'
+//     dirent (header) - needed for vkelInitDirectICD() on non-Windows OS'
+//     pthread (header) - needed for vkelInitAsync() on non-Windows OS'
+//     fcntl, unistd (headers) - needed for vkelPrewarm() on non-Windows OS'
+//     Standard C Libraries (stdio, stdlib, string, assert) - needed for NULL, malloc()
+//                                                 calloc(), free(), memset(), assert()
+//
+// Notice
+//     Copyright (c) 2016 Christian Vallentin <mail@vallentinsource.com>
+//
+// Developers & Contributors
+//     Christian Vallentin <mail@vallentinsource.com>
+//
+// Version History
+//     Last Modified Date: May 16, 2016
+//     Revision: 14
+//     Version: 2.0.11
+//
+// Revision History
+//     Revision 12, 2016/05/02
+//       - Fixed "for loop initial declarations are only
+//         allowed in C99 mode".
+//
+//     Revision 3, 2016/02/26
+//       - Rewrote vkel_gen.py, now it parses and directly
+//         adds vulkan.h and vk_platform.h into vkel.h,
+//         along with moving the appropriate copyrights
+//         to the top of vkel.h.
+//       - Fixed/added better differentiation for instance
+//         and device related calls.
+//       - Removed the need for having the vukan.h and
+//         vk_platform.h headers.
+//
+//     Revision 2, 2016/02/24
+//       - Created a Python script for automatically generating
+//         all the extensions and their functions. (Tested with
+//         Python 3.5.1)
+//       - Added cross-platform support, for loading libraries
+//         and getting the function addresses.
+//       - Fixed so platform specific functions defaults to NULL
+//       - Added missing include for dlfcn (used on non-Window OS')
+//
+//     Revision 1, 2016/02/23
+//       - Implemented the basic version supporting a few (manually
+//         written) dynamically loaded functions.
+//
+//------------------------------------------------------------------------
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+// OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//========================================================================
+
+/*
+** Copyright (c) 2015-2016 The Khronos Group Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+// vkel as an implicit Vulkan layer, which counts and times every command of
+// applications without modifying them. See VkLayer_vkel.json.
+//
+// Instrumenting is enabled by setting VKEL_LAYER_INSTRUMENT=1. Otherwise the layer
+// hands out the functions of the next layer as is, so it isn't part of any call.
+
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#	define _POSIX_C_SOURCE 200112L
+#endif
+
+#define VKEL_NO_FUNCTION_MACROS
+#include "vkel.h"
+
+#include <stdio.h> /* fopen(), fprintf() */
+#include <stdlib.h> /* calloc(), free(), getenv() */
+#include <string.h> /* strcmp() */
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+#include <Windows.h>
+#else
+#include <pthread.h>
+#include <time.h>
+#endif
+
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+#	define VKEL_LAYER_EXPORT __declspec(dllexport)
+#else
+#	define VKEL_LAYER_EXPORT __attribute__((visibility("default")))
+#endif
+
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+#	define VkelPlatformMutex SRWLOCK
+#	define VKEL_PLATFORM_MUTEX_INITIALIZER SRWLOCK_INIT
+#	define vkelPlatformLockMutex(mutex) AcquireSRWLockExclusive(mutex)
+#	define vkelPlatformUnlockMutex(mutex) ReleaseSRWLockExclusive(mutex)
+#else
+#	define VkelPlatformMutex pthread_mutex_t
+#	define VKEL_PLATFORM_MUTEX_INITIALIZER PTHREAD_MUTEX_INITIALIZER
+#	define vkelPlatformLockMutex(mutex) pthread_mutex_lock(mutex)
+#	define vkelPlatformUnlockMutex(mutex) pthread_mutex_unlock(mutex)
+#endif
+
+
+static void* vkelAtomicLoadPointer(void* volatile *pPointer)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return __atomic_load_n(pPointer, __ATOMIC_ACQUIRE);
+#elif defined(_MSC_VER)
+	void *pointer = *pPointer;
+	MemoryBarrier();
+	return pointer;
+#else
+#	error vkel needs atomic loads and stores for this compiler
+#endif
+}
+
+static void vkelAtomicStorePointer(void* volatile *pPointer, void *pointer)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	__atomic_store_n(pPointer, pointer, __ATOMIC_RELEASE);
+#elif defined(_MSC_VER)
+	MemoryBarrier();
+	*pPointer = pointer;
+#else
+#	error vkel needs atomic loads and stores for this compiler
+#endif
+}
+
+
+#define VKEL_LAYER_NAME "VK_LAYER_VKEL_instrumentation"
+#define VKEL_LAYER_DESCRIPTION "vkel per command call counts and timings"
+
+#ifndef VKEL_LAYER_MAX_HANDLES
+#	define VKEL_LAYER_MAX_HANDLES 64
+#endif
+
+
+// The loader's side of the layer interface (version 2), as declared by vk_layer.h
+
+typedef enum VkelLayerFunction {
+	VKEL_LAYER_LINK_INFO = 0,
+	VKEL_LOADER_DATA_CALLBACK = 1,
+} VkelLayerFunction;
+
+typedef struct VkelLayerInstanceLink {
+	struct VkelLayerInstanceLink *pNext;
+	PFN_vkGetInstanceProcAddr pfnNextGetInstanceProcAddr;
+	PFN_vkVoidFunction pfnNextGetPhysicalDeviceProcAddr;
+} VkelLayerInstanceLink;
+
+typedef struct VkelLayerInstanceCreateInfo {
+	VkStructureType sType;
+	const void *pNext;
+	VkelLayerFunction function;
+	union {
+		VkelLayerInstanceLink *pLayerInfo;
+		PFN_vkVoidFunction pfnSetInstanceLoaderData;
+	} u;
+} VkelLayerInstanceCreateInfo;
+
+typedef struct VkelLayerDeviceLink {
+	struct VkelLayerDeviceLink *pNext;
+	PFN_vkGetInstanceProcAddr pfnNextGetInstanceProcAddr;
+	PFN_vkGetDeviceProcAddr pfnNextGetDeviceProcAddr;
+} VkelLayerDeviceLink;
+
+typedef struct VkelLayerDeviceCreateInfo {
+	VkStructureType sType;
+	const void *pNext;
+	VkelLayerFunction function;
+	union {
+		VkelLayerDeviceLink *pLayerInfo;
+		PFN_vkVoidFunction pfnSetDeviceLoaderData;
+	} u;
+} VkelLayerDeviceCreateInfo;
+
+typedef enum VkelNegotiateLayerStructType {
+	VKEL_LAYER_NEGOTIATE_UNINTIALIZED = 0,
+	VKEL_LAYER_NEGOTIATE_INTERFACE_STRUCT = 1,
+} VkelNegotiateLayerStructType;
+
+typedef struct VkelNegotiateLayerInterface {
+	VkelNegotiateLayerStructType sType;
+	void *pNext;
+	uint32_t loaderLayerInterfaceVersion;
+	PFN_vkGetInstanceProcAddr pfnGetInstanceProcAddr;
+	PFN_vkGetDeviceProcAddr pfnGetDeviceProcAddr;
+	PFN_vkVoidFunction pfnGetPhysicalDeviceProcAddr;
+} VkelNegotiateLayerInterface;
+
+
+typedef struct VkelLayerInstanceTable {
+	PFN_vkDestroyInstance DestroyInstance;
+	PFN_vkEnumeratePhysicalDevices EnumeratePhysicalDevices;
+	PFN_vkGetPhysicalDeviceFeatures GetPhysicalDeviceFeatures;
+	PFN_vkGetPhysicalDeviceFormatProperties GetPhysicalDeviceFormatProperties;
+	PFN_vkGetPhysicalDeviceImageFormatProperties GetPhysicalDeviceImageFormatProperties;
+	PFN_vkGetPhysicalDeviceProperties GetPhysicalDeviceProperties;
+	PFN_vkGetPhysicalDeviceQueueFamilyProperties GetPhysicalDeviceQueueFamilyProperties;
+	PFN_vkGetPhysicalDeviceMemoryProperties GetPhysicalDeviceMemoryProperties;
+	PFN_vkGetInstanceProcAddr GetInstanceProcAddr;
+	PFN_vkCreateDevice CreateDevice;
+	PFN_vkEnumerateDeviceExtensionProperties EnumerateDeviceExtensionProperties;
+	PFN_vkEnumerateDeviceLayerProperties EnumerateDeviceLayerProperties;
+	PFN_vkGetPhysicalDeviceSparseImageFormatProperties GetPhysicalDeviceSparseImageFormatProperties;
+	PFN_vkDestroySurfaceKHR DestroySurfaceKHR;
+	PFN_vkGetPhysicalDeviceSurfaceSupportKHR GetPhysicalDeviceSurfaceSupportKHR;
+	PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR GetPhysicalDeviceSurfaceCapabilitiesKHR;
+	PFN_vkGetPhysicalDeviceSurfaceFormatsKHR GetPhysicalDeviceSurfaceFormatsKHR;
+	PFN_vkGetPhysicalDeviceSurfacePresentModesKHR GetPhysicalDeviceSurfacePresentModesKHR;
+	PFN_vkGetPhysicalDeviceDisplayPropertiesKHR GetPhysicalDeviceDisplayPropertiesKHR;
+	PFN_vkGetPhysicalDeviceDisplayPlanePropertiesKHR GetPhysicalDeviceDisplayPlanePropertiesKHR;
+	PFN_vkGetDisplayPlaneSupportedDisplaysKHR GetDisplayPlaneSupportedDisplaysKHR;
+	PFN_vkGetDisplayModePropertiesKHR GetDisplayModePropertiesKHR;
+	PFN_vkCreateDisplayModeKHR CreateDisplayModeKHR;
+	PFN_vkGetDisplayPlaneCapabilitiesKHR GetDisplayPlaneCapabilitiesKHR;
+	PFN_vkCreateDisplayPlaneSurfaceKHR CreateDisplayPlaneSurfaceKHR;
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+	PFN_vkCreateXlibSurfaceKHR CreateXlibSurfaceKHR;
+#else
+	PFN_vkVoidFunction CreateXlibSurfaceKHR;
+#endif /* VK_USE_PLATFORM_XLIB_KHR */
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+	PFN_vkGetPhysicalDeviceXlibPresentationSupportKHR GetPhysicalDeviceXlibPresentationSupportKHR;
+#else
+	PFN_vkVoidFunction GetPhysicalDeviceXlibPresentationSupportKHR;
+#endif /* VK_USE_PLATFORM_XLIB_KHR */
+#ifdef VK_USE_PLATFORM_XCB_KHR
+	PFN_vkCreateXcbSurfaceKHR CreateXcbSurfaceKHR;
+#else
+	PFN_vkVoidFunction CreateXcbSurfaceKHR;
+#endif /* VK_USE_PLATFORM_XCB_KHR */
+#ifdef VK_USE_PLATFORM_XCB_KHR
+	PFN_vkGetPhysicalDeviceXcbPresentationSupportKHR GetPhysicalDeviceXcbPresentationSupportKHR;
+#else
+	PFN_vkVoidFunction GetPhysicalDeviceXcbPresentationSupportKHR;
+#endif /* VK_USE_PLATFORM_XCB_KHR */
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+	PFN_vkCreateWaylandSurfaceKHR CreateWaylandSurfaceKHR;
+#else
+	PFN_vkVoidFunction CreateWaylandSurfaceKHR;
+#endif /* VK_USE_PLATFORM_WAYLAND_KHR */
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+	PFN_vkGetPhysicalDeviceWaylandPresentationSupportKHR GetPhysicalDeviceWaylandPresentationSupportKHR;
+#else
+	PFN_vkVoidFunction GetPhysicalDeviceWaylandPresentationSupportKHR;
+#endif /* VK_USE_PLATFORM_WAYLAND_KHR */
+#ifdef VK_USE_PLATFORM_MIR_KHR
+	PFN_vkCreateMirSurfaceKHR CreateMirSurfaceKHR;
+#else
+	PFN_vkVoidFunction CreateMirSurfaceKHR;
+#endif /* VK_USE_PLATFORM_MIR_KHR */
+#ifdef VK_USE_PLATFORM_MIR_KHR
+	PFN_vkGetPhysicalDeviceMirPresentationSupportKHR GetPhysicalDeviceMirPresentationSupportKHR;
+#else
+	PFN_vkVoidFunction GetPhysicalDeviceMirPresentationSupportKHR;
+#endif /* VK_USE_PLATFORM_MIR_KHR */
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+	PFN_vkCreateAndroidSurfaceKHR CreateAndroidSurfaceKHR;
+#else
+	PFN_vkVoidFunction CreateAndroidSurfaceKHR;
+#endif /* VK_USE_PLATFORM_ANDROID_KHR */
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+	PFN_vkCreateWin32SurfaceKHR CreateWin32SurfaceKHR;
+#else
+	PFN_vkVoidFunction CreateWin32SurfaceKHR;
+#endif /* VK_USE_PLATFORM_WIN32_KHR */
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+	PFN_vkGetPhysicalDeviceWin32PresentationSupportKHR GetPhysicalDeviceWin32PresentationSupportKHR;
+#else
+	PFN_vkVoidFunction GetPhysicalDeviceWin32PresentationSupportKHR;
+#endif /* VK_USE_PLATFORM_WIN32_KHR */
+	PFN_vkCreateDebugReportCallbackEXT CreateDebugReportCallbackEXT;
+	PFN_vkDestroyDebugReportCallbackEXT DestroyDebugReportCallbackEXT;
+	PFN_vkDebugReportMessageEXT DebugReportMessageEXT;
+} VkelLayerInstanceTable;
+
+typedef struct VkelLayerInstance {
+	VkInstance instance;
+	PFN_vkGetInstanceProcAddr nextGetInstanceProcAddr;
+	VkelLayerInstanceTable table;
+} VkelLayerInstance;
+
+typedef struct VkelLayerDevice {
+	VkDevice device;
+	PFN_vkGetDeviceProcAddr nextGetDeviceProcAddr;
+	VkelDeviceTable table;
+} VkelLayerDevice;
+
+
+// Instances and devices are found using the loader's dispatch pointer (see vkelGetDispatchKey()),
+// so a VkPhysicalDevice finds its VkInstance and a VkQueue or VkCommandBuffer finds its VkDevice.
+// Lookups don't lock, the entry is published before the key and removed after it.
+typedef struct VkelLayerSlot {
+	void* volatile key;
+	void* volatile entry;
+} VkelLayerSlot;
+
+static VkelPlatformMutex vkelLayerMutex = VKEL_PLATFORM_MUTEX_INITIALIZER;
+
+static VkelLayerSlot vkelLayerInstances[VKEL_LAYER_MAX_HANDLES];
+static VkelLayerSlot vkelLayerDevices[VKEL_LAYER_MAX_HANDLES];
+
+
+static void* vkelLayerFind(VkelLayerSlot *pSlots, const void *dispatchableHandle)
+{
+	void *key = vkelGetDispatchKey(dispatchableHandle);
+	uint32_t i;
+	
+	for (i = 0; i < VKEL_LAYER_MAX_HANDLES; ++i)
+		if (vkelAtomicLoadPointer(&pSlots[i].key) == key)
+			return vkelAtomicLoadPointer(&pSlots[i].entry);
+	
+	return NULL;
+}
+
+static VkBool32 vkelLayerAdd(VkelLayerSlot *pSlots, const void *dispatchableHandle, void *entry)
+{
+	VkBool32 added = VK_FALSE;
+	uint32_t i;
+	
+	vkelPlatformLockMutex(&vkelLayerMutex);
+	
+	for (i = 0; i < VKEL_LAYER_MAX_HANDLES; ++i)
+	{
+		if (!pSlots[i].key)
+		{
+			vkelAtomicStorePointer(&pSlots[i].entry, entry);
+			vkelAtomicStorePointer(&pSlots[i].key, vkelGetDispatchKey(dispatchableHandle));
+			
+			added = VK_TRUE;
+			break;
+		}
+	}
+	
+	vkelPlatformUnlockMutex(&vkelLayerMutex);
+	
+	return added;
+}
+
+static void* vkelLayerRemove(VkelLayerSlot *pSlots, const void *dispatchableHandle)
+{
+	void *key = vkelGetDispatchKey(dispatchableHandle);
+	void *entry = NULL;
+	uint32_t i;
+	
+	vkelPlatformLockMutex(&vkelLayerMutex);
+	
+	for (i = 0; i < VKEL_LAYER_MAX_HANDLES; ++i)
+	{
+		if (pSlots[i].key == key)
+		{
+			entry = pSlots[i].entry;
+			
+			vkelAtomicStorePointer(&pSlots[i].key, NULL);
+			vkelAtomicStorePointer(&pSlots[i].entry, NULL);
+			break;
+		}
+	}
+	
+	vkelPlatformUnlockMutex(&vkelLayerMutex);
+	
+	return entry;
+}
+
+
+static void vkelLayerLoadInstanceTable(VkelLayerInstanceTable *pTable, PFN_vkGetInstanceProcAddr getProcAddr, VkInstance instance)
+{
+	pTable->DestroyInstance = (PFN_vkDestroyInstance) getProcAddr(instance, "vkDestroyInstance");
+	pTable->EnumeratePhysicalDevices = (PFN_vkEnumeratePhysicalDevices) getProcAddr(instance, "vkEnumeratePhysicalDevices");
+	pTable->GetPhysicalDeviceFeatures = (PFN_vkGetPhysicalDeviceFeatures) getProcAddr(instance, "vkGetPhysicalDeviceFeatures");
+	pTable->GetPhysicalDeviceFormatProperties = (PFN_vkGetPhysicalDeviceFormatProperties) getProcAddr(instance, "vkGetPhysicalDeviceFormatProperties");
+	pTable->GetPhysicalDeviceImageFormatProperties = (PFN_vkGetPhysicalDeviceImageFormatProperties) getProcAddr(instance, "vkGetPhysicalDeviceImageFormatProperties");
+	pTable->GetPhysicalDeviceProperties = (PFN_vkGetPhysicalDeviceProperties) getProcAddr(instance, "vkGetPhysicalDeviceProperties");
+	pTable->GetPhysicalDeviceQueueFamilyProperties = (PFN_vkGetPhysicalDeviceQueueFamilyProperties) getProcAddr(instance, "vkGetPhysicalDeviceQueueFamilyProperties");
+	pTable->GetPhysicalDeviceMemoryProperties = (PFN_vkGetPhysicalDeviceMemoryProperties) getProcAddr(instance, "vkGetPhysicalDeviceMemoryProperties");
+	pTable->GetInstanceProcAddr = (PFN_vkGetInstanceProcAddr) getProcAddr(instance, "vkGetInstanceProcAddr");
+	pTable->CreateDevice = (PFN_vkCreateDevice) getProcAddr(instance, "vkCreateDevice");
+	pTable->EnumerateDeviceExtensionProperties = (PFN_vkEnumerateDeviceExtensionProperties) getProcAddr(instance, "vkEnumerateDeviceExtensionProperties");
+	pTable->EnumerateDeviceLayerProperties = (PFN_vkEnumerateDeviceLayerProperties) getProcAddr(instance, "vkEnumerateDeviceLayerProperties");
+	pTable->GetPhysicalDeviceSparseImageFormatProperties = (PFN_vkGetPhysicalDeviceSparseImageFormatProperties) getProcAddr(instance, "vkGetPhysicalDeviceSparseImageFormatProperties");
+	pTable->DestroySurfaceKHR = (PFN_vkDestroySurfaceKHR) getProcAddr(instance, "vkDestroySurfaceKHR");
+	pTable->GetPhysicalDeviceSurfaceSupportKHR = (PFN_vkGetPhysicalDeviceSurfaceSupportKHR) getProcAddr(instance, "vkGetPhysicalDeviceSurfaceSupportKHR");
+	pTable->GetPhysicalDeviceSurfaceCapabilitiesKHR = (PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR) getProcAddr(instance, "vkGetPhysicalDeviceSurfaceCapabilitiesKHR");
+	pTable->GetPhysicalDeviceSurfaceFormatsKHR = (PFN_vkGetPhysicalDeviceSurfaceFormatsKHR) getProcAddr(instance, "vkGetPhysicalDeviceSurfaceFormatsKHR");
+	pTable->GetPhysicalDeviceSurfacePresentModesKHR = (PFN_vkGetPhysicalDeviceSurfacePresentModesKHR) getProcAddr(instance, "vkGetPhysicalDeviceSurfacePresentModesKHR");
+	pTable->GetPhysicalDeviceDisplayPropertiesKHR = (PFN_vkGetPhysicalDeviceDisplayPropertiesKHR) getProcAddr(instance, "vkGetPhysicalDeviceDisplayPropertiesKHR");
+	pTable->GetPhysicalDeviceDisplayPlanePropertiesKHR = (PFN_vkGetPhysicalDeviceDisplayPlanePropertiesKHR) getProcAddr(instance, "vkGetPhysicalDeviceDisplayPlanePropertiesKHR");
+	pTable->GetDisplayPlaneSupportedDisplaysKHR = (PFN_vkGetDisplayPlaneSupportedDisplaysKHR) getProcAddr(instance, "vkGetDisplayPlaneSupportedDisplaysKHR");
+	pTable->GetDisplayModePropertiesKHR = (PFN_vkGetDisplayModePropertiesKHR) getProcAddr(instance, "vkGetDisplayModePropertiesKHR");
+	pTable->CreateDisplayModeKHR = (PFN_vkCreateDisplayModeKHR) getProcAddr(instance, "vkCreateDisplayModeKHR");
+	pTable->GetDisplayPlaneCapabilitiesKHR = (PFN_vkGetDisplayPlaneCapabilitiesKHR) getProcAddr(instance, "vkGetDisplayPlaneCapabilitiesKHR");
+	pTable->CreateDisplayPlaneSurfaceKHR = (PFN_vkCreateDisplayPlaneSurfaceKHR) getProcAddr(instance, "vkCreateDisplayPlaneSurfaceKHR");
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+	pTable->CreateXlibSurfaceKHR = (PFN_vkCreateXlibSurfaceKHR) getProcAddr(instance, "vkCreateXlibSurfaceKHR");
+#endif /* VK_USE_PLATFORM_XLIB_KHR */
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+	pTable->GetPhysicalDeviceXlibPresentationSupportKHR = (PFN_vkGetPhysicalDeviceXlibPresentationSupportKHR) getProcAddr(instance, "vkGetPhysicalDeviceXlibPresentationSupportKHR");
+#endif /* VK_USE_PLATFORM_XLIB_KHR */
+#ifdef VK_USE_PLATFORM_XCB_KHR
+	pTable->CreateXcbSurfaceKHR = (PFN_vkCreateXcbSurfaceKHR) getProcAddr(instance, "vkCreateXcbSurfaceKHR");
+#endif /* VK_USE_PLATFORM_XCB_KHR */
+#ifdef VK_USE_PLATFORM_XCB_KHR
+	pTable->GetPhysicalDeviceXcbPresentationSupportKHR = (PFN_vkGetPhysicalDeviceXcbPresentationSupportKHR) getProcAddr(instance, "vkGetPhysicalDeviceXcbPresentationSupportKHR");
+#endif /* VK_USE_PLATFORM_XCB_KHR */
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+	pTable->CreateWaylandSurfaceKHR = (PFN_vkCreateWaylandSurfaceKHR) getProcAddr(instance, "vkCreateWaylandSurfaceKHR");
+#endif /* VK_USE_PLATFORM_WAYLAND_KHR */
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+	pTable->GetPhysicalDeviceWaylandPresentationSupportKHR = (PFN_vkGetPhysicalDeviceWaylandPresentationSupportKHR) getProcAddr(instance, "vkGetPhysicalDeviceWaylandPresentationSupportKHR");
+#endif /* VK_USE_PLATFORM_WAYLAND_KHR */
+#ifdef VK_USE_PLATFORM_MIR_KHR
+	pTable->CreateMirSurfaceKHR = (PFN_vkCreateMirSurfaceKHR) getProcAddr(instance, "vkCreateMirSurfaceKHR");
+#endif /* VK_USE_PLATFORM_MIR_KHR */
+#ifdef VK_USE_PLATFORM_MIR_KHR
+	pTable->GetPhysicalDeviceMirPresentationSupportKHR = (PFN_vkGetPhysicalDeviceMirPresentationSupportKHR) getProcAddr(instance, "vkGetPhysicalDeviceMirPresentationSupportKHR");
+#endif /* VK_USE_PLATFORM_MIR_KHR */
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+	pTable->CreateAndroidSurfaceKHR = (PFN_vkCreateAndroidSurfaceKHR) getProcAddr(instance, "vkCreateAndroidSurfaceKHR");
+#endif /* VK_USE_PLATFORM_ANDROID_KHR */
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+	pTable->CreateWin32SurfaceKHR = (PFN_vkCreateWin32SurfaceKHR) getProcAddr(instance, "vkCreateWin32SurfaceKHR");
+#endif /* VK_USE_PLATFORM_WIN32_KHR */
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+	pTable->GetPhysicalDeviceWin32PresentationSupportKHR = (PFN_vkGetPhysicalDeviceWin32PresentationSupportKHR) getProcAddr(instance, "vkGetPhysicalDeviceWin32PresentationSupportKHR");
+#endif /* VK_USE_PLATFORM_WIN32_KHR */
+	pTable->CreateDebugReportCallbackEXT = (PFN_vkCreateDebugReportCallbackEXT) getProcAddr(instance, "vkCreateDebugReportCallbackEXT");
+	pTable->DestroyDebugReportCallbackEXT = (PFN_vkDestroyDebugReportCallbackEXT) getProcAddr(instance, "vkDestroyDebugReportCallbackEXT");
+	pTable->DebugReportMessageEXT = (PFN_vkDebugReportMessageEXT) getProcAddr(instance, "vkDebugReportMessageEXT");
+}
+
+static void vkelLayerLoadDeviceTable(VkelDeviceTable *pTable, PFN_vkGetDeviceProcAddr getProcAddr, VkDevice device)
+{
+	pTable->DestroyDevice = (PFN_vkDestroyDevice) getProcAddr(device, "vkDestroyDevice");
+	pTable->GetDeviceQueue = (PFN_vkGetDeviceQueue) getProcAddr(device, "vkGetDeviceQueue");
+	pTable->QueueSubmit = (PFN_vkQueueSubmit) getProcAddr(device, "vkQueueSubmit");
+	pTable->QueueWaitIdle = (PFN_vkQueueWaitIdle) getProcAddr(device, "vkQueueWaitIdle");
+	pTable->DeviceWaitIdle = (PFN_vkDeviceWaitIdle) getProcAddr(device, "vkDeviceWaitIdle");
+	pTable->AllocateMemory = (PFN_vkAllocateMemory) getProcAddr(device, "vkAllocateMemory");
+	pTable->FreeMemory = (PFN_vkFreeMemory) getProcAddr(device, "vkFreeMemory");
+	pTable->MapMemory = (PFN_vkMapMemory) getProcAddr(device, "vkMapMemory");
+	pTable->UnmapMemory = (PFN_vkUnmapMemory) getProcAddr(device, "vkUnmapMemory");
+	pTable->FlushMappedMemoryRanges = (PFN_vkFlushMappedMemoryRanges) getProcAddr(device, "vkFlushMappedMemoryRanges");
+	pTable->InvalidateMappedMemoryRanges = (PFN_vkInvalidateMappedMemoryRanges) getProcAddr(device, "vkInvalidateMappedMemoryRanges");
+	pTable->GetDeviceMemoryCommitment = (PFN_vkGetDeviceMemoryCommitment) getProcAddr(device, "vkGetDeviceMemoryCommitment");
+	pTable->BindBufferMemory = (PFN_vkBindBufferMemory) getProcAddr(device, "vkBindBufferMemory");
+	pTable->BindImageMemory = (PFN_vkBindImageMemory) getProcAddr(device, "vkBindImageMemory");
+	pTable->GetBufferMemoryRequirements = (PFN_vkGetBufferMemoryRequirements) getProcAddr(device, "vkGetBufferMemoryRequirements");
+	pTable->GetImageMemoryRequirements = (PFN_vkGetImageMemoryRequirements) getProcAddr(device, "vkGetImageMemoryRequirements");
+	pTable->GetImageSparseMemoryRequirements = (PFN_vkGetImageSparseMemoryRequirements) getProcAddr(device, "vkGetImageSparseMemoryRequirements");
+	pTable->QueueBindSparse = (PFN_vkQueueBindSparse) getProcAddr(device, "vkQueueBindSparse");
+	pTable->CreateFence = (PFN_vkCreateFence) getProcAddr(device, "vkCreateFence");
+	pTable->DestroyFence = (PFN_vkDestroyFence) getProcAddr(device, "vkDestroyFence");
+	pTable->ResetFences = (PFN_vkResetFences) getProcAddr(device, "vkResetFences");
+	pTable->GetFenceStatus = (PFN_vkGetFenceStatus) getProcAddr(device, "vkGetFenceStatus");
+	pTable->WaitForFences = (PFN_vkWaitForFences) getProcAddr(device, "vkWaitForFences");
+	pTable->CreateSemaphore = (PFN_vkCreateSemaphore) getProcAddr(device, "vkCreateSemaphore");
+	pTable->DestroySemaphore = (PFN_vkDestroySemaphore) getProcAddr(device, "vkDestroySemaphore");
+	pTable->CreateEvent = (PFN_vkCreateEvent) getProcAddr(device, "vkCreateEvent");
+	pTable->DestroyEvent = (PFN_vkDestroyEvent) getProcAddr(device, "vkDestroyEvent");
+	pTable->GetEventStatus = (PFN_vkGetEventStatus) getProcAddr(device, "vkGetEventStatus");
+	pTable->SetEvent = (PFN_vkSetEvent) getProcAddr(device, "vkSetEvent");
+	pTable->ResetEvent = (PFN_vkResetEvent) getProcAddr(device, "vkResetEvent");
+	pTable->CreateQueryPool = (PFN_vkCreateQueryPool) getProcAddr(device, "vkCreateQueryPool");
+	pTable->DestroyQueryPool = (PFN_vkDestroyQueryPool) getProcAddr(device, "vkDestroyQueryPool");
+	pTable->GetQueryPoolResults = (PFN_vkGetQueryPoolResults) getProcAddr(device, "vkGetQueryPoolResults");
+	pTable->CreateBuffer = (PFN_vkCreateBuffer) getProcAddr(device, "vkCreateBuffer");
+	pTable->DestroyBuffer = (PFN_vkDestroyBuffer) getProcAddr(device, "vkDestroyBuffer");
+	pTable->CreateBufferView = (PFN_vkCreateBufferView) getProcAddr(device, "vkCreateBufferView");
+	pTable->DestroyBufferView = (PFN_vkDestroyBufferView) getProcAddr(device, "vkDestroyBufferView");
+	pTable->CreateImage = (PFN_vkCreateImage) getProcAddr(device, "vkCreateImage");
+	pTable->DestroyImage = (PFN_vkDestroyImage) getProcAddr(device, "vkDestroyImage");
+	pTable->GetImageSubresourceLayout = (PFN_vkGetImageSubresourceLayout) getProcAddr(device, "vkGetImageSubresourceLayout");
+	pTable->CreateImageView = (PFN_vkCreateImageView) getProcAddr(device, "vkCreateImageView");
+	pTable->DestroyImageView = (PFN_vkDestroyImageView) getProcAddr(device, "vkDestroyImageView");
+	pTable->CreateShaderModule = (PFN_vkCreateShaderModule) getProcAddr(device, "vkCreateShaderModule");
+	pTable->DestroyShaderModule = (PFN_vkDestroyShaderModule) getProcAddr(device, "vkDestroyShaderModule");
+	pTable->CreatePipelineCache = (PFN_vkCreatePipelineCache) getProcAddr(device, "vkCreatePipelineCache");
+	pTable->DestroyPipelineCache = (PFN_vkDestroyPipelineCache) getProcAddr(device, "vkDestroyPipelineCache");
+	pTable->GetPipelineCacheData = (PFN_vkGetPipelineCacheData) getProcAddr(device, "vkGetPipelineCacheData");
+	pTable->MergePipelineCaches = (PFN_vkMergePipelineCaches) getProcAddr(device, "vkMergePipelineCaches");
+	pTable->CreateGraphicsPipelines = (PFN_vkCreateGraphicsPipelines) getProcAddr(device, "vkCreateGraphicsPipelines");
+	pTable->CreateComputePipelines = (PFN_vkCreateComputePipelines) getProcAddr(device, "vkCreateComputePipelines");
+	pTable->DestroyPipeline = (PFN_vkDestroyPipeline) getProcAddr(device, "vkDestroyPipeline");
+	pTable->CreatePipelineLayout = (PFN_vkCreatePipelineLayout) getProcAddr(device, "vkCreatePipelineLayout");
+	pTable->DestroyPipelineLayout = (PFN_vkDestroyPipelineLayout) getProcAddr(device, "vkDestroyPipelineLayout");
+	pTable->CreateSampler = (PFN_vkCreateSampler) getProcAddr(device, "vkCreateSampler");
+	pTable->DestroySampler = (PFN_vkDestroySampler) getProcAddr(device, "vkDestroySampler");
+	pTable->CreateDescriptorSetLayout = (PFN_vkCreateDescriptorSetLayout) getProcAddr(device, "vkCreateDescriptorSetLayout");
+	pTable->DestroyDescriptorSetLayout = (PFN_vkDestroyDescriptorSetLayout) getProcAddr(device, "vkDestroyDescriptorSetLayout");
+	pTable->CreateDescriptorPool = (PFN_vkCreateDescriptorPool) getProcAddr(device, "vkCreateDescriptorPool");
+	pTable->DestroyDescriptorPool = (PFN_vkDestroyDescriptorPool) getProcAddr(device, "vkDestroyDescriptorPool");
+	pTable->ResetDescriptorPool = (PFN_vkResetDescriptorPool) getProcAddr(device, "vkResetDescriptorPool");
+	pTable->AllocateDescriptorSets = (PFN_vkAllocateDescriptorSets) getProcAddr(device, "vkAllocateDescriptorSets");
+	pTable->FreeDescriptorSets = (PFN_vkFreeDescriptorSets) getProcAddr(device, "vkFreeDescriptorSets");
+	pTable->UpdateDescriptorSets = (PFN_vkUpdateDescriptorSets) getProcAddr(device, "vkUpdateDescriptorSets");
+	pTable->CreateFramebuffer = (PFN_vkCreateFramebuffer) getProcAddr(device, "vkCreateFramebuffer");
+	pTable->DestroyFramebuffer = (PFN_vkDestroyFramebuffer) getProcAddr(device, "vkDestroyFramebuffer");
+	pTable->CreateRenderPass = (PFN_vkCreateRenderPass) getProcAddr(device, "vkCreateRenderPass");
+	pTable->DestroyRenderPass = (PFN_vkDestroyRenderPass) getProcAddr(device, "vkDestroyRenderPass");
+	pTable->GetRenderAreaGranularity = (PFN_vkGetRenderAreaGranularity) getProcAddr(device, "vkGetRenderAreaGranularity");
+	pTable->CreateCommandPool = (PFN_vkCreateCommandPool) getProcAddr(device, "vkCreateCommandPool");
+	pTable->DestroyCommandPool = (PFN_vkDestroyCommandPool) getProcAddr(device, "vkDestroyCommandPool");
+	pTable->ResetCommandPool = (PFN_vkResetCommandPool) getProcAddr(device, "vkResetCommandPool");
+	pTable->AllocateCommandBuffers = (PFN_vkAllocateCommandBuffers) getProcAddr(device, "vkAllocateCommandBuffers");
+	pTable->FreeCommandBuffers = (PFN_vkFreeCommandBuffers) getProcAddr(device, "vkFreeCommandBuffers");
+	pTable->BeginCommandBuffer = (PFN_vkBeginCommandBuffer) getProcAddr(device, "vkBeginCommandBuffer");
+	pTable->EndCommandBuffer = (PFN_vkEndCommandBuffer) getProcAddr(device, "vkEndCommandBuffer");
+	pTable->ResetCommandBuffer = (PFN_vkResetCommandBuffer) getProcAddr(device, "vkResetCommandBuffer");
+	pTable->CmdBindPipeline = (PFN_vkCmdBindPipeline) getProcAddr(device, "vkCmdBindPipeline");
+	pTable->CmdSetViewport = (PFN_vkCmdSetViewport) getProcAddr(device, "vkCmdSetViewport");
+	pTable->CmdSetScissor = (PFN_vkCmdSetScissor) getProcAddr(device, "vkCmdSetScissor");
+	pTable->CmdSetLineWidth = (PFN_vkCmdSetLineWidth) getProcAddr(device, "vkCmdSetLineWidth");
+	pTable->CmdSetDepthBias = (PFN_vkCmdSetDepthBias) getProcAddr(device, "vkCmdSetDepthBias");
+	pTable->CmdSetBlendConstants = (PFN_vkCmdSetBlendConstants) getProcAddr(device, "vkCmdSetBlendConstants");
+	pTable->CmdSetDepthBounds = (PFN_vkCmdSetDepthBounds) getProcAddr(device, "vkCmdSetDepthBounds");
+	pTable->CmdSetStencilCompareMask = (PFN_vkCmdSetStencilCompareMask) getProcAddr(device, "vkCmdSetStencilCompareMask");
+	pTable->CmdSetStencilWriteMask = (PFN_vkCmdSetStencilWriteMask) getProcAddr(device, "vkCmdSetStencilWriteMask");
+	pTable->CmdSetStencilReference = (PFN_vkCmdSetStencilReference) getProcAddr(device, "vkCmdSetStencilReference");
+	pTable->CmdBindDescriptorSets = (PFN_vkCmdBindDescriptorSets) getProcAddr(device, "vkCmdBindDescriptorSets");
+	pTable->CmdBindIndexBuffer = (PFN_vkCmdBindIndexBuffer) getProcAddr(device, "vkCmdBindIndexBuffer");
+	pTable->CmdBindVertexBuffers = (PFN_vkCmdBindVertexBuffers) getProcAddr(device, "vkCmdBindVertexBuffers");
+	pTable->CmdDraw = (PFN_vkCmdDraw) getProcAddr(device, "vkCmdDraw");
+	pTable->CmdDrawIndexed = (PFN_vkCmdDrawIndexed) getProcAddr(device, "vkCmdDrawIndexed");
+	pTable->CmdDrawIndirect = (PFN_vkCmdDrawIndirect) getProcAddr(device, "vkCmdDrawIndirect");
+	pTable->CmdDrawIndexedIndirect = (PFN_vkCmdDrawIndexedIndirect) getProcAddr(device, "vkCmdDrawIndexedIndirect");
+	pTable->CmdDispatch = (PFN_vkCmdDispatch) getProcAddr(device, "vkCmdDispatch");
+	pTable->CmdDispatchIndirect = (PFN_vkCmdDispatchIndirect) getProcAddr(device, "vkCmdDispatchIndirect");
+	pTable->CmdCopyBuffer = (PFN_vkCmdCopyBuffer) getProcAddr(device, "vkCmdCopyBuffer");
+	pTable->CmdCopyImage = (PFN_vkCmdCopyImage) getProcAddr(device, "vkCmdCopyImage");
+	pTable->CmdBlitImage = (PFN_vkCmdBlitImage) getProcAddr(device, "vkCmdBlitImage");
+	pTable->CmdCopyBufferToImage = (PFN_vkCmdCopyBufferToImage) getProcAddr(device, "vkCmdCopyBufferToImage");
+	pTable->CmdCopyImageToBuffer = (PFN_vkCmdCopyImageToBuffer) getProcAddr(device, "vkCmdCopyImageToBuffer");
+	pTable->CmdUpdateBuffer = (PFN_vkCmdUpdateBuffer) getProcAddr(device, "vkCmdUpdateBuffer");
+	pTable->CmdFillBuffer = (PFN_vkCmdFillBuffer) getProcAddr(device, "vkCmdFillBuffer");
+	pTable->CmdClearColorImage = (PFN_vkCmdClearColorImage) getProcAddr(device, "vkCmdClearColorImage");
+	pTable->CmdClearDepthStencilImage = (PFN_vkCmdClearDepthStencilImage) getProcAddr(device, "vkCmdClearDepthStencilImage");
+	pTable->CmdClearAttachments = (PFN_vkCmdClearAttachments) getProcAddr(device, "vkCmdClearAttachments");
+	pTable->CmdResolveImage = (PFN_vkCmdResolveImage) getProcAddr(device, "vkCmdResolveImage");
+	pTable->CmdSetEvent = (PFN_vkCmdSetEvent) getProcAddr(device, "vkCmdSetEvent");
+	pTable->CmdResetEvent = (PFN_vkCmdResetEvent) getProcAddr(device, "vkCmdResetEvent");
+	pTable->CmdWaitEvents = (PFN_vkCmdWaitEvents) getProcAddr(device, "vkCmdWaitEvents");
+	pTable->CmdPipelineBarrier = (PFN_vkCmdPipelineBarrier) getProcAddr(device, "vkCmdPipelineBarrier");
+	pTable->CmdBeginQuery = (PFN_vkCmdBeginQuery) getProcAddr(device, "vkCmdBeginQuery");
+	pTable->CmdEndQuery = (PFN_vkCmdEndQuery) getProcAddr(device, "vkCmdEndQuery");
+	pTable->CmdResetQueryPool = (PFN_vkCmdResetQueryPool) getProcAddr(device, "vkCmdResetQueryPool");
+	pTable->CmdWriteTimestamp = (PFN_vkCmdWriteTimestamp) getProcAddr(device, "vkCmdWriteTimestamp");
+	pTable->CmdCopyQueryPoolResults = (PFN_vkCmdCopyQueryPoolResults) getProcAddr(device, "vkCmdCopyQueryPoolResults");
+	pTable->CmdPushConstants = (PFN_vkCmdPushConstants) getProcAddr(device, "vkCmdPushConstants");
+	pTable->CmdBeginRenderPass = (PFN_vkCmdBeginRenderPass) getProcAddr(device, "vkCmdBeginRenderPass");
+	pTable->CmdNextSubpass = (PFN_vkCmdNextSubpass) getProcAddr(device, "vkCmdNextSubpass");
+	pTable->CmdEndRenderPass = (PFN_vkCmdEndRenderPass) getProcAddr(device, "vkCmdEndRenderPass");
+	pTable->CmdExecuteCommands = (PFN_vkCmdExecuteCommands) getProcAddr(device, "vkCmdExecuteCommands");
+	pTable->CreateSwapchainKHR = (PFN_vkCreateSwapchainKHR) getProcAddr(device, "vkCreateSwapchainKHR");
+	pTable->DestroySwapchainKHR = (PFN_vkDestroySwapchainKHR) getProcAddr(device, "vkDestroySwapchainKHR");
+	pTable->GetSwapchainImagesKHR = (PFN_vkGetSwapchainImagesKHR) getProcAddr(device, "vkGetSwapchainImagesKHR");
+	pTable->AcquireNextImageKHR = (PFN_vkAcquireNextImageKHR) getProcAddr(device, "vkAcquireNextImageKHR");
+	pTable->QueuePresentKHR = (PFN_vkQueuePresentKHR) getProcAddr(device, "vkQueuePresentKHR");
+	pTable->CreateSharedSwapchainsKHR = (PFN_vkCreateSharedSwapchainsKHR) getProcAddr(device, "vkCreateSharedSwapchainsKHR");
+	pTable->DebugMarkerSetObjectTagEXT = (PFN_vkDebugMarkerSetObjectTagEXT) getProcAddr(device, "vkDebugMarkerSetObjectTagEXT");
+	pTable->DebugMarkerSetObjectNameEXT = (PFN_vkDebugMarkerSetObjectNameEXT) getProcAddr(device, "vkDebugMarkerSetObjectNameEXT");
+	pTable->CmdDebugMarkerBeginEXT = (PFN_vkCmdDebugMarkerBeginEXT) getProcAddr(device, "vkCmdDebugMarkerBeginEXT");
+	pTable->CmdDebugMarkerEndEXT = (PFN_vkCmdDebugMarkerEndEXT) getProcAddr(device, "vkCmdDebugMarkerEndEXT");
+	pTable->CmdDebugMarkerInsertEXT = (PFN_vkCmdDebugMarkerInsertEXT) getProcAddr(device, "vkCmdDebugMarkerInsertEXT");
+}
+
+// Instrumenting
+
+typedef struct VkelLayerCommandStats {
+	volatile uint64_t callCount;
+	volatile uint64_t totalNanoseconds;
+} VkelLayerCommandStats;
+
+
+// Read from VKEL_LAYER_INSTRUMENT when the first instance is created
+static VkBool32 vkelLayerInstrument;
+static VkBool32 vkelLayerSettingsRead;
+
+static VkelLayerCommandStats vkelLayerStats[166];
+
+static const char* const vkelLayerCommandNames[166] = {
+	"vkEnumeratePhysicalDevices",
+	"vkGetPhysicalDeviceFeatures",
+	"vkGetPhysicalDeviceFormatProperties",
+	"vkGetPhysicalDeviceImageFormatProperties",
+	"vkGetPhysicalDeviceProperties",
+	"vkGetPhysicalDeviceQueueFamilyProperties",
+	"vkGetPhysicalDeviceMemoryProperties",
+	"vkEnumerateDeviceExtensionProperties",
+	"vkEnumerateDeviceLayerProperties",
+	"vkGetDeviceQueue",
+	"vkQueueSubmit",
+	"vkQueueWaitIdle",
+	"vkDeviceWaitIdle",
+	"vkAllocateMemory",
+	"vkFreeMemory",
+	"vkMapMemory",
+	"vkUnmapMemory",
+	"vkFlushMappedMemoryRanges",
+	"vkInvalidateMappedMemoryRanges",
+	"vkGetDeviceMemoryCommitment",
+	"vkBindBufferMemory",
+	"vkBindImageMemory",
+	"vkGetBufferMemoryRequirements",
+	"vkGetImageMemoryRequirements",
+	"vkGetImageSparseMemoryRequirements",
+	"vkGetPhysicalDeviceSparseImageFormatProperties",
+	"vkQueueBindSparse",
+	"vkCreateFence",
+	"vkDestroyFence",
+	"vkResetFences",
+	"vkGetFenceStatus",
+	"vkWaitForFences",
+	"vkCreateSemaphore",
+	"vkDestroySemaphore",
+	"vkCreateEvent",
+	"vkDestroyEvent",
+	"vkGetEventStatus",
+	"vkSetEvent",
+	"vkResetEvent",
+	"vkCreateQueryPool",
+	"vkDestroyQueryPool",
+	"vkGetQueryPoolResults",
+	"vkCreateBuffer",
+	"vkDestroyBuffer",
+	"vkCreateBufferView",
+	"vkDestroyBufferView",
+	"vkCreateImage",
+	"vkDestroyImage",
+	"vkGetImageSubresourceLayout",
+	"vkCreateImageView",
+	"vkDestroyImageView",
+	"vkCreateShaderModule",
+	"vkDestroyShaderModule",
+	"vkCreatePipelineCache",
+	"vkDestroyPipelineCache",
+	"vkGetPipelineCacheData",
+	"vkMergePipelineCaches",
+	"vkCreateGraphicsPipelines",
+	"vkCreateComputePipelines",
+	"vkDestroyPipeline",
+	"vkCreatePipelineLayout",
+	"vkDestroyPipelineLayout",
+	"vkCreateSampler",
+	"vkDestroySampler",
+	"vkCreateDescriptorSetLayout",
+	"vkDestroyDescriptorSetLayout",
+	"vkCreateDescriptorPool",
+	"vkDestroyDescriptorPool",
+	"vkResetDescriptorPool",
+	"vkAllocateDescriptorSets",
+	"vkFreeDescriptorSets",
+	"vkUpdateDescriptorSets",
+	"vkCreateFramebuffer",
+	"vkDestroyFramebuffer",
+	"vkCreateRenderPass",
+	"vkDestroyRenderPass",
+	"vkGetRenderAreaGranularity",
+	"vkCreateCommandPool",
+	"vkDestroyCommandPool",
+	"vkResetCommandPool",
+	"vkAllocateCommandBuffers",
+	"vkFreeCommandBuffers",
+	"vkBeginCommandBuffer",
+	"vkEndCommandBuffer",
+	"vkResetCommandBuffer",
+	"vkCmdBindPipeline",
+	"vkCmdSetViewport",
+	"vkCmdSetScissor",
+	"vkCmdSetLineWidth",
+	"vkCmdSetDepthBias",
+	"vkCmdSetBlendConstants",
+	"vkCmdSetDepthBounds",
+	"vkCmdSetStencilCompareMask",
+	"vkCmdSetStencilWriteMask",
+	"vkCmdSetStencilReference",
+	"vkCmdBindDescriptorSets",
+	"vkCmdBindIndexBuffer",
+	"vkCmdBindVertexBuffers",
+	"vkCmdDraw",
+	"vkCmdDrawIndexed",
+	"vkCmdDrawIndirect",
+	"vkCmdDrawIndexedIndirect",
+	"vkCmdDispatch",
+	"vkCmdDispatchIndirect",
+	"vkCmdCopyBuffer",
+	"vkCmdCopyImage",
+	"vkCmdBlitImage",
+	"vkCmdCopyBufferToImage",
+	"vkCmdCopyImageToBuffer",
+	"vkCmdUpdateBuffer",
+	"vkCmdFillBuffer",
+	"vkCmdClearColorImage",
+	"vkCmdClearDepthStencilImage",
+	"vkCmdClearAttachments",
+	"vkCmdResolveImage",
+	"vkCmdSetEvent",
+	"vkCmdResetEvent",
+	"vkCmdWaitEvents",
+	"vkCmdPipelineBarrier",
+	"vkCmdBeginQuery",
+	"vkCmdEndQuery",
+	"vkCmdResetQueryPool",
+	"vkCmdWriteTimestamp",
+	"vkCmdCopyQueryPoolResults",
+	"vkCmdPushConstants",
+	"vkCmdBeginRenderPass",
+	"vkCmdNextSubpass",
+	"vkCmdEndRenderPass",
+	"vkCmdExecuteCommands",
+	"vkDestroySurfaceKHR",
+	"vkGetPhysicalDeviceSurfaceSupportKHR",
+	"vkGetPhysicalDeviceSurfaceCapabilitiesKHR",
+	"vkGetPhysicalDeviceSurfaceFormatsKHR",
+	"vkGetPhysicalDeviceSurfacePresentModesKHR",
+	"vkCreateSwapchainKHR",
+	"vkDestroySwapchainKHR",
+	"vkGetSwapchainImagesKHR",
+	"vkAcquireNextImageKHR",
+	"vkQueuePresentKHR",
+	"vkGetPhysicalDeviceDisplayPropertiesKHR",
+	"vkGetPhysicalDeviceDisplayPlanePropertiesKHR",
+	"vkGetDisplayPlaneSupportedDisplaysKHR",
+	"vkGetDisplayModePropertiesKHR",
+	"vkCreateDisplayModeKHR",
+	"vkGetDisplayPlaneCapabilitiesKHR",
+	"vkCreateDisplayPlaneSurfaceKHR",
+	"vkCreateSharedSwapchainsKHR",
+	"vkCreateXlibSurfaceKHR",
+	"vkGetPhysicalDeviceXlibPresentationSupportKHR",
+	"vkCreateXcbSurfaceKHR",
+	"vkGetPhysicalDeviceXcbPresentationSupportKHR",
+	"vkCreateWaylandSurfaceKHR",
+	"vkGetPhysicalDeviceWaylandPresentationSupportKHR",
+	"vkCreateMirSurfaceKHR",
+	"vkGetPhysicalDeviceMirPresentationSupportKHR",
+	"vkCreateAndroidSurfaceKHR",
+	"vkCreateWin32SurfaceKHR",
+	"vkGetPhysicalDeviceWin32PresentationSupportKHR",
+	"vkCreateDebugReportCallbackEXT",
+	"vkDestroyDebugReportCallbackEXT",
+	"vkDebugReportMessageEXT",
+	"vkDebugMarkerSetObjectTagEXT",
+	"vkDebugMarkerSetObjectNameEXT",
+	"vkCmdDebugMarkerBeginEXT",
+	"vkCmdDebugMarkerEndEXT",
+	"vkCmdDebugMarkerInsertEXT",
+};
+
+static void vkelLayerReadSettings(void)
+{
+	const char *pInstrument;
+	
+	if (vkelLayerSettingsRead)
+		return;
+	
+	pInstrument = getenv("VKEL_LAYER_INSTRUMENT");
+	
+	vkelLayerInstrument = (pInstrument && pInstrument[0] && strcmp(pInstrument, "0")) ? VK_TRUE : VK_FALSE;
+	vkelLayerSettingsRead = VK_TRUE;
+}
+
+static uint64_t vkelLayerGetNanoseconds(void)
+{
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+	static LARGE_INTEGER frequency;
+	LARGE_INTEGER counter;
+	
+	if (!frequency.QuadPart)
+		QueryPerformanceFrequency(&frequency);
+	
+	QueryPerformanceCounter(&counter);
+	
+	return (uint64_t) ((double) counter.QuadPart * 1000000000.0 / (double) frequency.QuadPart);
+#else
+	struct timespec now;
+	
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	
+	return (uint64_t) now.tv_sec * 1000000000u + (uint64_t) now.tv_nsec;
+#endif
+}
+
+static void vkelLayerEndCall(VkelLayerCommandStats *pStats, uint64_t start)
+{
+	uint64_t elapsed = vkelLayerGetNanoseconds() - start;
+
+#if defined(__GNUC__) || defined(__clang__)
+	__atomic_fetch_add(&pStats->callCount, 1, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&pStats->totalNanoseconds, elapsed, __ATOMIC_RELAXED);
+#elif defined(_MSC_VER)
+	InterlockedIncrement64((volatile LONG64*) &pStats->callCount);
+	InterlockedExchangeAdd64((volatile LONG64*) &pStats->totalNanoseconds, (LONG64) elapsed);
+#else
+#	error vkel needs atomic additions for this compiler
+#endif
+}
+
+
+// Written to VKEL_LAYER_OUTPUT (or stderr) when the layer is unloaded
+static void vkelLayerWriteReport(void)
+{
+	const char *pPath = getenv("VKEL_LAYER_OUTPUT");
+	FILE *file;
+	uint32_t i;
+	
+	if (!vkelLayerInstrument)
+		return;
+	
+	file = pPath ? fopen(pPath, "w") : stderr;
+	
+	if (!file)
+		return;
+	
+	fprintf(file, "%-48s %12s %14s %10s\n", "command", "calls", "total (us)", "avg (ns)");
+	
+	for (i = 0; i < sizeof(vkelLayerStats) / sizeof(vkelLayerStats[0]); ++i)
+	{
+		unsigned long long callCount = (unsigned long long) vkelLayerStats[i].callCount;
+		unsigned long long totalNanoseconds = (unsigned long long) vkelLayerStats[i].totalNanoseconds;
+		
+		if (callCount)
+			fprintf(file, "%-48s %12llu %14.1f %10llu\n", vkelLayerCommandNames[i], callCount, (double) totalNanoseconds / 1000.0, totalNanoseconds / callCount);
+	}
+	
+	if (file != stderr)
+		fclose(file);
+}
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+BOOL WINAPI DllMain(HINSTANCE hinstDLL, DWORD fdwReason, LPVOID lpvReserved)
+{
+	(void) hinstDLL;
+	(void) lpvReserved;
+	
+	if (fdwReason == DLL_PROCESS_DETACH)
+		vkelLayerWriteReport();
+	
+	return TRUE;
+}
+#else
+// The loader unloads layers when the last instance is destroyed, so atexit() can't be used
+__attribute__((destructor)) static void vkelLayerUnload(void)
+{
+	vkelLayerWriteReport();
+}
+#endif
+
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerEnumeratePhysicalDevices(VkInstance instance, uint32_t* pPhysicalDeviceCount, VkPhysicalDevice* pPhysicalDevices)
+{
+	const VkelLayerInstance *pEntry = (const VkelLayerInstance*) vkelLayerFind(vkelLayerInstances, instance);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.EnumeratePhysicalDevices(instance, pPhysicalDeviceCount, pPhysicalDevices);
+	vkelLayerEndCall(&vkelLayerStats[0], start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerGetPhysicalDeviceFeatures(VkPhysicalDevice physicalDevice, VkPhysicalDeviceFeatures* pFeatures)
+{
+	const VkelLayerInstance *pEntry = (const VkelLayerInstance*) vkelLayerFind(vkelLayerInstances, physicalDevice);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.GetPhysicalDeviceFeatures(physicalDevice, pFeatures);
+	vkelLayerEndCall(&vkelLayerStats[1], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerGetPhysicalDeviceFormatProperties(VkPhysicalDevice physicalDevice, VkFormat format, VkFormatProperties* pFormatProperties)
+{
+	const VkelLayerInstance *pEntry = (const VkelLayerInstance*) vkelLayerFind(vkelLayerInstances, physicalDevice);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.GetPhysicalDeviceFormatProperties(physicalDevice, format, pFormatProperties);
+	vkelLayerEndCall(&vkelLayerStats[2], start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerGetPhysicalDeviceImageFormatProperties(VkPhysicalDevice physicalDevice, VkFormat format, VkImageType type, VkImageTiling tiling, VkImageUsageFlags usage, VkImageCreateFlags flags, VkImageFormatProperties* pImageFormatProperties)
+{
+	const VkelLayerInstance *pEntry = (const VkelLayerInstance*) vkelLayerFind(vkelLayerInstances, physicalDevice);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.GetPhysicalDeviceImageFormatProperties(physicalDevice, format, type, tiling, usage, flags, pImageFormatProperties);
+	vkelLayerEndCall(&vkelLayerStats[3], start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerGetPhysicalDeviceProperties(VkPhysicalDevice physicalDevice, VkPhysicalDeviceProperties* pProperties)
+{
+	const VkelLayerInstance *pEntry = (const VkelLayerInstance*) vkelLayerFind(vkelLayerInstances, physicalDevice);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.GetPhysicalDeviceProperties(physicalDevice, pProperties);
+	vkelLayerEndCall(&vkelLayerStats[4], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerGetPhysicalDeviceQueueFamilyProperties(VkPhysicalDevice physicalDevice, uint32_t* pQueueFamilyPropertyCount, VkQueueFamilyProperties* pQueueFamilyProperties)
+{
+	const VkelLayerInstance *pEntry = (const VkelLayerInstance*) vkelLayerFind(vkelLayerInstances, physicalDevice);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.GetPhysicalDeviceQueueFamilyProperties(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
+	vkelLayerEndCall(&vkelLayerStats[5], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerGetPhysicalDeviceMemoryProperties(VkPhysicalDevice physicalDevice, VkPhysicalDeviceMemoryProperties* pMemoryProperties)
+{
+	const VkelLayerInstance *pEntry = (const VkelLayerInstance*) vkelLayerFind(vkelLayerInstances, physicalDevice);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.GetPhysicalDeviceMemoryProperties(physicalDevice, pMemoryProperties);
+	vkelLayerEndCall(&vkelLayerStats[6], start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerEnumerateDeviceExtensionProperties(VkPhysicalDevice physicalDevice, const char* pLayerName, uint32_t* pPropertyCount, VkExtensionProperties* pProperties)
+{
+	const VkelLayerInstance *pEntry = (const VkelLayerInstance*) vkelLayerFind(vkelLayerInstances, physicalDevice);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.EnumerateDeviceExtensionProperties(physicalDevice, pLayerName, pPropertyCount, pProperties);
+	vkelLayerEndCall(&vkelLayerStats[7], start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerEnumerateDeviceLayerProperties(VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkLayerProperties* pProperties)
+{
+	const VkelLayerInstance *pEntry = (const VkelLayerInstance*) vkelLayerFind(vkelLayerInstances, physicalDevice);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.EnumerateDeviceLayerProperties(physicalDevice, pPropertyCount, pProperties);
+	vkelLayerEndCall(&vkelLayerStats[8], start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerGetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue* pQueue)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.GetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
+	vkelLayerEndCall(&vkelLayerStats[9], start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, queue);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.QueueSubmit(queue, submitCount, pSubmits, fence);
+	vkelLayerEndCall(&vkelLayerStats[10], start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerQueueWaitIdle(VkQueue queue)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, queue);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.QueueWaitIdle(queue);
+	vkelLayerEndCall(&vkelLayerStats[11], start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerDeviceWaitIdle(VkDevice device)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.DeviceWaitIdle(device);
+	vkelLayerEndCall(&vkelLayerStats[12], start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerAllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo, const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.AllocateMemory(device, pAllocateInfo, pAllocator, pMemory);
+	vkelLayerEndCall(&vkelLayerStats[13], start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerFreeMemory(VkDevice device, VkDeviceMemory memory, const VkAllocationCallbacks* pAllocator)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.FreeMemory(device, memory, pAllocator);
+	vkelLayerEndCall(&vkelLayerStats[14], start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerMapMemory(VkDevice device, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size, VkMemoryMapFlags flags, void** ppData)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.MapMemory(device, memory, offset, size, flags, ppData);
+	vkelLayerEndCall(&vkelLayerStats[15], start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerUnmapMemory(VkDevice device, VkDeviceMemory memory)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.UnmapMemory(device, memory);
+	vkelLayerEndCall(&vkelLayerStats[16], start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerFlushMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount, const VkMappedMemoryRange* pMemoryRanges)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.FlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
+	vkelLayerEndCall(&vkelLayerStats[17], start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerInvalidateMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount, const VkMappedMemoryRange* pMemoryRanges)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.InvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
+	vkelLayerEndCall(&vkelLayerStats[18], start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerGetDeviceMemoryCommitment(VkDevice device, VkDeviceMemory memory, VkDeviceSize* pCommittedMemoryInBytes)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.GetDeviceMemoryCommitment(device, memory, pCommittedMemoryInBytes);
+	vkelLayerEndCall(&vkelLayerStats[19], start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerBindBufferMemory(VkDevice device, VkBuffer buffer, VkDeviceMemory memory, VkDeviceSize memoryOffset)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.BindBufferMemory(device, buffer, memory, memoryOffset);
+	vkelLayerEndCall(&vkelLayerStats[20], start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerBindImageMemory(VkDevice device, VkImage image, VkDeviceMemory memory, VkDeviceSize memoryOffset)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.BindImageMemory(device, image, memory, memoryOffset);
+	vkelLayerEndCall(&vkelLayerStats[21], start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerGetBufferMemoryRequirements(VkDevice device, VkBuffer buffer, VkMemoryRequirements* pMemoryRequirements)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.GetBufferMemoryRequirements(device, buffer, pMemoryRequirements);
+	vkelLayerEndCall(&vkelLayerStats[22], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerGetImageMemoryRequirements(VkDevice device, VkImage image, VkMemoryRequirements* pMemoryRequirements)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.GetImageMemoryRequirements(device, image, pMemoryRequirements);
+	vkelLayerEndCall(&vkelLayerStats[23], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerGetImageSparseMemoryRequirements(VkDevice device, VkImage image, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements* pSparseMemoryRequirements)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.GetImageSparseMemoryRequirements(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+	vkelLayerEndCall(&vkelLayerStats[24], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerGetPhysicalDeviceSparseImageFormatProperties(VkPhysicalDevice physicalDevice, VkFormat format, VkImageType type, VkSampleCountFlagBits samples, VkImageUsageFlags usage, VkImageTiling tiling, uint32_t* pPropertyCount, VkSparseImageFormatProperties* pProperties)
+{
+	const VkelLayerInstance *pEntry = (const VkelLayerInstance*) vkelLayerFind(vkelLayerInstances, physicalDevice);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.GetPhysicalDeviceSparseImageFormatProperties(physicalDevice, format, type, samples, usage, tiling, pPropertyCount, pProperties);
+	vkelLayerEndCall(&vkelLayerStats[25], start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerQueueBindSparse(VkQueue queue, uint32_t bindInfoCount, const VkBindSparseInfo* pBindInfo, VkFence fence)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, queue);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.QueueBindSparse(queue, bindInfoCount, pBindInfo, fence);
+	vkelLayerEndCall(&vkelLayerStats[26], start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerCreateFence(VkDevice device, const VkFenceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkFence* pFence)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.CreateFence(device, pCreateInfo, pAllocator, pFence);
+	vkelLayerEndCall(&vkelLayerStats[27], start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerDestroyFence(VkDevice device, VkFence fence, const VkAllocationCallbacks* pAllocator)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.DestroyFence(device, fence, pAllocator);
+	vkelLayerEndCall(&vkelLayerStats[28], start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerResetFences(VkDevice device, uint32_t fenceCount, const VkFence* pFences)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.ResetFences(device, fenceCount, pFences);
+	vkelLayerEndCall(&vkelLayerStats[29], start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerGetFenceStatus(VkDevice device, VkFence fence)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.GetFenceStatus(device, fence);
+	vkelLayerEndCall(&vkelLayerStats[30], start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence* pFences, VkBool32 waitAll, uint64_t timeout)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.WaitForFences(device, fenceCount, pFences, waitAll, timeout);
+	vkelLayerEndCall(&vkelLayerStats[31], start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerCreateSemaphore(VkDevice device, const VkSemaphoreCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSemaphore* pSemaphore)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.CreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore);
+	vkelLayerEndCall(&vkelLayerStats[32], start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerDestroySemaphore(VkDevice device, VkSemaphore semaphore, const VkAllocationCallbacks* pAllocator)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.DestroySemaphore(device, semaphore, pAllocator);
+	vkelLayerEndCall(&vkelLayerStats[33], start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerCreateEvent(VkDevice device, const VkEventCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkEvent* pEvent)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.CreateEvent(device, pCreateInfo, pAllocator, pEvent);
+	vkelLayerEndCall(&vkelLayerStats[34], start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerDestroyEvent(VkDevice device, VkEvent event, const VkAllocationCallbacks* pAllocator)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.DestroyEvent(device, event, pAllocator);
+	vkelLayerEndCall(&vkelLayerStats[35], start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerGetEventStatus(VkDevice device, VkEvent event)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.GetEventStatus(device, event);
+	vkelLayerEndCall(&vkelLayerStats[36], start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerSetEvent(VkDevice device, VkEvent event)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.SetEvent(device, event);
+	vkelLayerEndCall(&vkelLayerStats[37], start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerResetEvent(VkDevice device, VkEvent event)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.ResetEvent(device, event);
+	vkelLayerEndCall(&vkelLayerStats[38], start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerCreateQueryPool(VkDevice device, const VkQueryPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkQueryPool* pQueryPool)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.CreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool);
+	vkelLayerEndCall(&vkelLayerStats[39], start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerDestroyQueryPool(VkDevice device, VkQueryPool queryPool, const VkAllocationCallbacks* pAllocator)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.DestroyQueryPool(device, queryPool, pAllocator);
+	vkelLayerEndCall(&vkelLayerStats[40], start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerGetQueryPoolResults(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, size_t dataSize, void* pData, VkDeviceSize stride, VkQueryResultFlags flags)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.GetQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
+	vkelLayerEndCall(&vkelLayerStats[41], start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerCreateBuffer(VkDevice device, const VkBufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBuffer* pBuffer)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.CreateBuffer(device, pCreateInfo, pAllocator, pBuffer);
+	vkelLayerEndCall(&vkelLayerStats[42], start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerDestroyBuffer(VkDevice device, VkBuffer buffer, const VkAllocationCallbacks* pAllocator)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.DestroyBuffer(device, buffer, pAllocator);
+	vkelLayerEndCall(&vkelLayerStats[43], start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerCreateBufferView(VkDevice device, const VkBufferViewCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBufferView* pView)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.CreateBufferView(device, pCreateInfo, pAllocator, pView);
+	vkelLayerEndCall(&vkelLayerStats[44], start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerDestroyBufferView(VkDevice device, VkBufferView bufferView, const VkAllocationCallbacks* pAllocator)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.DestroyBufferView(device, bufferView, pAllocator);
+	vkelLayerEndCall(&vkelLayerStats[45], start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerCreateImage(VkDevice device, const VkImageCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkImage* pImage)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.CreateImage(device, pCreateInfo, pAllocator, pImage);
+	vkelLayerEndCall(&vkelLayerStats[46], start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerDestroyImage(VkDevice device, VkImage image, const VkAllocationCallbacks* pAllocator)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.DestroyImage(device, image, pAllocator);
+	vkelLayerEndCall(&vkelLayerStats[47], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerGetImageSubresourceLayout(VkDevice device, VkImage image, const VkImageSubresource* pSubresource, VkSubresourceLayout* pLayout)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.GetImageSubresourceLayout(device, image, pSubresource, pLayout);
+	vkelLayerEndCall(&vkelLayerStats[48], start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerCreateImageView(VkDevice device, const VkImageViewCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkImageView* pView)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.CreateImageView(device, pCreateInfo, pAllocator, pView);
+	vkelLayerEndCall(&vkelLayerStats[49], start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerDestroyImageView(VkDevice device, VkImageView imageView, const VkAllocationCallbacks* pAllocator)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.DestroyImageView(device, imageView, pAllocator);
+	vkelLayerEndCall(&vkelLayerStats[50], start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.CreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule);
+	vkelLayerEndCall(&vkelLayerStats[51], start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerDestroyShaderModule(VkDevice device, VkShaderModule shaderModule, const VkAllocationCallbacks* pAllocator)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.DestroyShaderModule(device, shaderModule, pAllocator);
+	vkelLayerEndCall(&vkelLayerStats[52], start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerCreatePipelineCache(VkDevice device, const VkPipelineCacheCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineCache* pPipelineCache)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.CreatePipelineCache(device, pCreateInfo, pAllocator, pPipelineCache);
+	vkelLayerEndCall(&vkelLayerStats[53], start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerDestroyPipelineCache(VkDevice device, VkPipelineCache pipelineCache, const VkAllocationCallbacks* pAllocator)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.DestroyPipelineCache(device, pipelineCache, pAllocator);
+	vkelLayerEndCall(&vkelLayerStats[54], start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerGetPipelineCacheData(VkDevice device, VkPipelineCache pipelineCache, size_t* pDataSize, void* pData)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.GetPipelineCacheData(device, pipelineCache, pDataSize, pData);
+	vkelLayerEndCall(&vkelLayerStats[55], start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerMergePipelineCaches(VkDevice device, VkPipelineCache dstCache, uint32_t srcCacheCount, const VkPipelineCache* pSrcCaches)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.MergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches);
+	vkelLayerEndCall(&vkelLayerStats[56], start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkGraphicsPipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.CreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+	vkelLayerEndCall(&vkelLayerStats[57], start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerCreateComputePipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkComputePipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.CreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+	vkelLayerEndCall(&vkelLayerStats[58], start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerDestroyPipeline(VkDevice device, VkPipeline pipeline, const VkAllocationCallbacks* pAllocator)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.DestroyPipeline(device, pipeline, pAllocator);
+	vkelLayerEndCall(&vkelLayerStats[59], start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerCreatePipelineLayout(VkDevice device, const VkPipelineLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineLayout* pPipelineLayout)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.CreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout);
+	vkelLayerEndCall(&vkelLayerStats[60], start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerDestroyPipelineLayout(VkDevice device, VkPipelineLayout pipelineLayout, const VkAllocationCallbacks* pAllocator)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.DestroyPipelineLayout(device, pipelineLayout, pAllocator);
+	vkelLayerEndCall(&vkelLayerStats[61], start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerCreateSampler(VkDevice device, const VkSamplerCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSampler* pSampler)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.CreateSampler(device, pCreateInfo, pAllocator, pSampler);
+	vkelLayerEndCall(&vkelLayerStats[62], start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerDestroySampler(VkDevice device, VkSampler sampler, const VkAllocationCallbacks* pAllocator)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.DestroySampler(device, sampler, pAllocator);
+	vkelLayerEndCall(&vkelLayerStats[63], start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerCreateDescriptorSetLayout(VkDevice device, const VkDescriptorSetLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorSetLayout* pSetLayout)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.CreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout);
+	vkelLayerEndCall(&vkelLayerStats[64], start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerDestroyDescriptorSetLayout(VkDevice device, VkDescriptorSetLayout descriptorSetLayout, const VkAllocationCallbacks* pAllocator)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.DestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
+	vkelLayerEndCall(&vkelLayerStats[65], start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerCreateDescriptorPool(VkDevice device, const VkDescriptorPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorPool* pDescriptorPool)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.CreateDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool);
+	vkelLayerEndCall(&vkelLayerStats[66], start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerDestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool, const VkAllocationCallbacks* pAllocator)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.DestroyDescriptorPool(device, descriptorPool, pAllocator);
+	vkelLayerEndCall(&vkelLayerStats[67], start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerResetDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool, VkDescriptorPoolResetFlags flags)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.ResetDescriptorPool(device, descriptorPool, flags);
+	vkelLayerEndCall(&vkelLayerStats[68], start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerAllocateDescriptorSets(VkDevice device, const VkDescriptorSetAllocateInfo* pAllocateInfo, VkDescriptorSet* pDescriptorSets)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.AllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
+	vkelLayerEndCall(&vkelLayerStats[69], start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerFreeDescriptorSets(VkDevice device, VkDescriptorPool descriptorPool, uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.FreeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets);
+	vkelLayerEndCall(&vkelLayerStats[70], start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerUpdateDescriptorSets(VkDevice device, uint32_t descriptorWriteCount, const VkWriteDescriptorSet* pDescriptorWrites, uint32_t descriptorCopyCount, const VkCopyDescriptorSet* pDescriptorCopies)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.UpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
+	vkelLayerEndCall(&vkelLayerStats[71], start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerCreateFramebuffer(VkDevice device, const VkFramebufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkFramebuffer* pFramebuffer)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.CreateFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer);
+	vkelLayerEndCall(&vkelLayerStats[72], start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerDestroyFramebuffer(VkDevice device, VkFramebuffer framebuffer, const VkAllocationCallbacks* pAllocator)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.DestroyFramebuffer(device, framebuffer, pAllocator);
+	vkelLayerEndCall(&vkelLayerStats[73], start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerCreateRenderPass(VkDevice device, const VkRenderPassCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.CreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass);
+	vkelLayerEndCall(&vkelLayerStats[74], start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerDestroyRenderPass(VkDevice device, VkRenderPass renderPass, const VkAllocationCallbacks* pAllocator)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.DestroyRenderPass(device, renderPass, pAllocator);
+	vkelLayerEndCall(&vkelLayerStats[75], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerGetRenderAreaGranularity(VkDevice device, VkRenderPass renderPass, VkExtent2D* pGranularity)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.GetRenderAreaGranularity(device, renderPass, pGranularity);
+	vkelLayerEndCall(&vkelLayerStats[76], start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerCreateCommandPool(VkDevice device, const VkCommandPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkCommandPool* pCommandPool)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.CreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool);
+	vkelLayerEndCall(&vkelLayerStats[77], start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerDestroyCommandPool(VkDevice device, VkCommandPool commandPool, const VkAllocationCallbacks* pAllocator)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.DestroyCommandPool(device, commandPool, pAllocator);
+	vkelLayerEndCall(&vkelLayerStats[78], start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerResetCommandPool(VkDevice device, VkCommandPool commandPool, VkCommandPoolResetFlags flags)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.ResetCommandPool(device, commandPool, flags);
+	vkelLayerEndCall(&vkelLayerStats[79], start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerAllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo* pAllocateInfo, VkCommandBuffer* pCommandBuffers)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.AllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers);
+	vkelLayerEndCall(&vkelLayerStats[80], start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerFreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount, const VkCommandBuffer* pCommandBuffers)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.FreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
+	vkelLayerEndCall(&vkelLayerStats[81], start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerBeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo* pBeginInfo)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.BeginCommandBuffer(commandBuffer, pBeginInfo);
+	vkelLayerEndCall(&vkelLayerStats[82], start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerEndCommandBuffer(VkCommandBuffer commandBuffer)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.EndCommandBuffer(commandBuffer);
+	vkelLayerEndCall(&vkelLayerStats[83], start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.ResetCommandBuffer(commandBuffer, flags);
+	vkelLayerEndCall(&vkelLayerStats[84], start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
+	vkelLayerEndCall(&vkelLayerStats[85], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdSetViewport(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkViewport* pViewports)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
+	vkelLayerEndCall(&vkelLayerStats[86], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdSetScissor(VkCommandBuffer commandBuffer, uint32_t firstScissor, uint32_t scissorCount, const VkRect2D* pScissors)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
+	vkelLayerEndCall(&vkelLayerStats[87], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdSetLineWidth(VkCommandBuffer commandBuffer, float lineWidth)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdSetLineWidth(commandBuffer, lineWidth);
+	vkelLayerEndCall(&vkelLayerStats[88], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdSetDepthBias(VkCommandBuffer commandBuffer, float depthBiasConstantFactor, float depthBiasClamp, float depthBiasSlopeFactor)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
+	vkelLayerEndCall(&vkelLayerStats[89], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdSetBlendConstants(VkCommandBuffer commandBuffer, const float blendConstants[4])
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdSetBlendConstants(commandBuffer, blendConstants);
+	vkelLayerEndCall(&vkelLayerStats[90], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdSetDepthBounds(VkCommandBuffer commandBuffer, float minDepthBounds, float maxDepthBounds)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
+	vkelLayerEndCall(&vkelLayerStats[91], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdSetStencilCompareMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t compareMask)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
+	vkelLayerEndCall(&vkelLayerStats[92], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdSetStencilWriteMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t writeMask)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
+	vkelLayerEndCall(&vkelLayerStats[93], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdSetStencilReference(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t reference)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdSetStencilReference(commandBuffer, faceMask, reference);
+	vkelLayerEndCall(&vkelLayerStats[94], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdBindDescriptorSets(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t firstSet, uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets, uint32_t dynamicOffsetCount, const uint32_t* pDynamicOffsets)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
+	vkelLayerEndCall(&vkelLayerStats[95], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkIndexType indexType)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
+	vkelLayerEndCall(&vkelLayerStats[96], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdBindVertexBuffers(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, const VkBuffer* pBuffers, const VkDeviceSize* pOffsets)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
+	vkelLayerEndCall(&vkelLayerStats[97], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
+	vkelLayerEndCall(&vkelLayerStats[98], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
+	vkelLayerEndCall(&vkelLayerStats[99], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
+	vkelLayerEndCall(&vkelLayerStats[100], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdDrawIndexedIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
+	vkelLayerEndCall(&vkelLayerStats[101], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdDispatch(VkCommandBuffer commandBuffer, uint32_t x, uint32_t y, uint32_t z)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdDispatch(commandBuffer, x, y, z);
+	vkelLayerEndCall(&vkelLayerStats[102], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdDispatchIndirect(commandBuffer, buffer, offset);
+	vkelLayerEndCall(&vkelLayerStats[103], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, uint32_t regionCount, const VkBufferCopy* pRegions)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
+	vkelLayerEndCall(&vkelLayerStats[104], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdCopyImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageCopy* pRegions)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+	vkelLayerEndCall(&vkelLayerStats[105], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdBlitImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageBlit* pRegions, VkFilter filter)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
+	vkelLayerEndCall(&vkelLayerStats[106], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdCopyBufferToImage(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkBufferImageCopy* pRegions)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
+	vkelLayerEndCall(&vkelLayerStats[107], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdCopyImageToBuffer(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkBuffer dstBuffer, uint32_t regionCount, const VkBufferImageCopy* pRegions)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
+	vkelLayerEndCall(&vkelLayerStats[108], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize dataSize, const void* pData)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
+	vkelLayerEndCall(&vkelLayerStats[109], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize size, uint32_t data)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
+	vkelLayerEndCall(&vkelLayerStats[110], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdClearColorImage(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const VkClearColorValue* pColor, uint32_t rangeCount, const VkImageSubresourceRange* pRanges)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
+	vkelLayerEndCall(&vkelLayerStats[111], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdClearDepthStencilImage(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const VkClearDepthStencilValue* pDepthStencil, uint32_t rangeCount, const VkImageSubresourceRange* pRanges)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
+	vkelLayerEndCall(&vkelLayerStats[112], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdClearAttachments(VkCommandBuffer commandBuffer, uint32_t attachmentCount, const VkClearAttachment* pAttachments, uint32_t rectCount, const VkClearRect* pRects)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
+	vkelLayerEndCall(&vkelLayerStats[113], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdResolveImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageResolve* pRegions)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+	vkelLayerEndCall(&vkelLayerStats[114], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdSetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdSetEvent(commandBuffer, event, stageMask);
+	vkelLayerEndCall(&vkelLayerStats[115], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdResetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdResetEvent(commandBuffer, event, stageMask);
+	vkelLayerEndCall(&vkelLayerStats[116], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers, uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+	vkelLayerEndCall(&vkelLayerStats[117], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdPipelineBarrier(VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, VkDependencyFlags dependencyFlags, uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers, uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+	vkelLayerEndCall(&vkelLayerStats[118], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query, VkQueryControlFlags flags)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdBeginQuery(commandBuffer, queryPool, query, flags);
+	vkelLayerEndCall(&vkelLayerStats[119], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdEndQuery(commandBuffer, queryPool, query);
+	vkelLayerEndCall(&vkelLayerStats[120], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdResetQueryPool(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
+	vkelLayerEndCall(&vkelLayerStats[121], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdWriteTimestamp(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage, VkQueryPool queryPool, uint32_t query)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
+	vkelLayerEndCall(&vkelLayerStats[122], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdCopyQueryPoolResults(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize stride, VkQueryResultFlags flags)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
+	vkelLayerEndCall(&vkelLayerStats[123], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout layout, VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size, const void* pValues)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
+	vkelLayerEndCall(&vkelLayerStats[124], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin, VkSubpassContents contents)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
+	vkelLayerEndCall(&vkelLayerStats[125], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpassContents contents)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdNextSubpass(commandBuffer, contents);
+	vkelLayerEndCall(&vkelLayerStats[126], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdEndRenderPass(VkCommandBuffer commandBuffer)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdEndRenderPass(commandBuffer);
+	vkelLayerEndCall(&vkelLayerStats[127], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount, const VkCommandBuffer* pCommandBuffers)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
+	vkelLayerEndCall(&vkelLayerStats[128], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerDestroySurfaceKHR(VkInstance instance, VkSurfaceKHR surface, const VkAllocationCallbacks* pAllocator)
+{
+	const VkelLayerInstance *pEntry = (const VkelLayerInstance*) vkelLayerFind(vkelLayerInstances, instance);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.DestroySurfaceKHR(instance, surface, pAllocator);
+	vkelLayerEndCall(&vkelLayerStats[129], start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerGetPhysicalDeviceSurfaceSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, VkSurfaceKHR surface, VkBool32* pSupported)
+{
+	const VkelLayerInstance *pEntry = (const VkelLayerInstance*) vkelLayerFind(vkelLayerInstances, physicalDevice);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.GetPhysicalDeviceSurfaceSupportKHR(physicalDevice, queueFamilyIndex, surface, pSupported);
+	vkelLayerEndCall(&vkelLayerStats[130], start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerGetPhysicalDeviceSurfaceCapabilitiesKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, VkSurfaceCapabilitiesKHR* pSurfaceCapabilities)
+{
+	const VkelLayerInstance *pEntry = (const VkelLayerInstance*) vkelLayerFind(vkelLayerInstances, physicalDevice);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.GetPhysicalDeviceSurfaceCapabilitiesKHR(physicalDevice, surface, pSurfaceCapabilities);
+	vkelLayerEndCall(&vkelLayerStats[131], start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerGetPhysicalDeviceSurfaceFormatsKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pSurfaceFormatCount, VkSurfaceFormatKHR* pSurfaceFormats)
+{
+	const VkelLayerInstance *pEntry = (const VkelLayerInstance*) vkelLayerFind(vkelLayerInstances, physicalDevice);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.GetPhysicalDeviceSurfaceFormatsKHR(physicalDevice, surface, pSurfaceFormatCount, pSurfaceFormats);
+	vkelLayerEndCall(&vkelLayerStats[132], start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerGetPhysicalDeviceSurfacePresentModesKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pPresentModeCount, VkPresentModeKHR* pPresentModes)
+{
+	const VkelLayerInstance *pEntry = (const VkelLayerInstance*) vkelLayerFind(vkelLayerInstances, physicalDevice);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.GetPhysicalDeviceSurfacePresentModesKHR(physicalDevice, surface, pPresentModeCount, pPresentModes);
+	vkelLayerEndCall(&vkelLayerStats[133], start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerCreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchain)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.CreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain);
+	vkelLayerEndCall(&vkelLayerStats[134], start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerDestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain, const VkAllocationCallbacks* pAllocator)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.DestroySwapchainKHR(device, swapchain, pAllocator);
+	vkelLayerEndCall(&vkelLayerStats[135], start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerGetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchain, uint32_t* pSwapchainImageCount, VkImage* pSwapchainImages)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.GetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages);
+	vkelLayerEndCall(&vkelLayerStats[136], start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerAcquireNextImageKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout, VkSemaphore semaphore, VkFence fence, uint32_t* pImageIndex)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.AcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex);
+	vkelLayerEndCall(&vkelLayerStats[137], start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR* pPresentInfo)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, queue);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.QueuePresentKHR(queue, pPresentInfo);
+	vkelLayerEndCall(&vkelLayerStats[138], start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerGetPhysicalDeviceDisplayPropertiesKHR(VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayPropertiesKHR* pProperties)
+{
+	const VkelLayerInstance *pEntry = (const VkelLayerInstance*) vkelLayerFind(vkelLayerInstances, physicalDevice);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.GetPhysicalDeviceDisplayPropertiesKHR(physicalDevice, pPropertyCount, pProperties);
+	vkelLayerEndCall(&vkelLayerStats[139], start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerGetPhysicalDeviceDisplayPlanePropertiesKHR(VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayPlanePropertiesKHR* pProperties)
+{
+	const VkelLayerInstance *pEntry = (const VkelLayerInstance*) vkelLayerFind(vkelLayerInstances, physicalDevice);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.GetPhysicalDeviceDisplayPlanePropertiesKHR(physicalDevice, pPropertyCount, pProperties);
+	vkelLayerEndCall(&vkelLayerStats[140], start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerGetDisplayPlaneSupportedDisplaysKHR(VkPhysicalDevice physicalDevice, uint32_t planeIndex, uint32_t* pDisplayCount, VkDisplayKHR* pDisplays)
+{
+	const VkelLayerInstance *pEntry = (const VkelLayerInstance*) vkelLayerFind(vkelLayerInstances, physicalDevice);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.GetDisplayPlaneSupportedDisplaysKHR(physicalDevice, planeIndex, pDisplayCount, pDisplays);
+	vkelLayerEndCall(&vkelLayerStats[141], start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerGetDisplayModePropertiesKHR(VkPhysicalDevice physicalDevice, VkDisplayKHR display, uint32_t* pPropertyCount, VkDisplayModePropertiesKHR* pProperties)
+{
+	const VkelLayerInstance *pEntry = (const VkelLayerInstance*) vkelLayerFind(vkelLayerInstances, physicalDevice);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.GetDisplayModePropertiesKHR(physicalDevice, display, pPropertyCount, pProperties);
+	vkelLayerEndCall(&vkelLayerStats[142], start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerCreateDisplayModeKHR(VkPhysicalDevice physicalDevice, VkDisplayKHR display, const VkDisplayModeCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDisplayModeKHR* pMode)
+{
+	const VkelLayerInstance *pEntry = (const VkelLayerInstance*) vkelLayerFind(vkelLayerInstances, physicalDevice);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.CreateDisplayModeKHR(physicalDevice, display, pCreateInfo, pAllocator, pMode);
+	vkelLayerEndCall(&vkelLayerStats[143], start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerGetDisplayPlaneCapabilitiesKHR(VkPhysicalDevice physicalDevice, VkDisplayModeKHR mode, uint32_t planeIndex, VkDisplayPlaneCapabilitiesKHR* pCapabilities)
+{
+	const VkelLayerInstance *pEntry = (const VkelLayerInstance*) vkelLayerFind(vkelLayerInstances, physicalDevice);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.GetDisplayPlaneCapabilitiesKHR(physicalDevice, mode, planeIndex, pCapabilities);
+	vkelLayerEndCall(&vkelLayerStats[144], start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerCreateDisplayPlaneSurfaceKHR(VkInstance instance, const VkDisplaySurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+	const VkelLayerInstance *pEntry = (const VkelLayerInstance*) vkelLayerFind(vkelLayerInstances, instance);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.CreateDisplayPlaneSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
+	vkelLayerEndCall(&vkelLayerStats[145], start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerCreateSharedSwapchainsKHR(VkDevice device, uint32_t swapchainCount, const VkSwapchainCreateInfoKHR* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchains)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.CreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
+	vkelLayerEndCall(&vkelLayerStats[146], start);
+	return result;
+}
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerCreateXlibSurfaceKHR(VkInstance instance, const VkXlibSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+	const VkelLayerInstance *pEntry = (const VkelLayerInstance*) vkelLayerFind(vkelLayerInstances, instance);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.CreateXlibSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
+	vkelLayerEndCall(&vkelLayerStats[147], start);
+	return result;
+}
+#endif /* VK_USE_PLATFORM_XLIB_KHR */
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+static VKAPI_ATTR VkBool32 VKAPI_CALL vkelLayerGetPhysicalDeviceXlibPresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, Display* dpy, VisualID visualID)
+{
+	const VkelLayerInstance *pEntry = (const VkelLayerInstance*) vkelLayerFind(vkelLayerInstances, physicalDevice);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkBool32 result = pEntry->table.GetPhysicalDeviceXlibPresentationSupportKHR(physicalDevice, queueFamilyIndex, dpy, visualID);
+	vkelLayerEndCall(&vkelLayerStats[148], start);
+	return result;
+}
+#endif /* VK_USE_PLATFORM_XLIB_KHR */
+#ifdef VK_USE_PLATFORM_XCB_KHR
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerCreateXcbSurfaceKHR(VkInstance instance, const VkXcbSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+	const VkelLayerInstance *pEntry = (const VkelLayerInstance*) vkelLayerFind(vkelLayerInstances, instance);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.CreateXcbSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
+	vkelLayerEndCall(&vkelLayerStats[149], start);
+	return result;
+}
+#endif /* VK_USE_PLATFORM_XCB_KHR */
+#ifdef VK_USE_PLATFORM_XCB_KHR
+static VKAPI_ATTR VkBool32 VKAPI_CALL vkelLayerGetPhysicalDeviceXcbPresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, xcb_connection_t* connection, xcb_visualid_t visual_id)
+{
+	const VkelLayerInstance *pEntry = (const VkelLayerInstance*) vkelLayerFind(vkelLayerInstances, physicalDevice);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkBool32 result = pEntry->table.GetPhysicalDeviceXcbPresentationSupportKHR(physicalDevice, queueFamilyIndex, connection, visual_id);
+	vkelLayerEndCall(&vkelLayerStats[150], start);
+	return result;
+}
+#endif /* VK_USE_PLATFORM_XCB_KHR */
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerCreateWaylandSurfaceKHR(VkInstance instance, const VkWaylandSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+	const VkelLayerInstance *pEntry = (const VkelLayerInstance*) vkelLayerFind(vkelLayerInstances, instance);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.CreateWaylandSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
+	vkelLayerEndCall(&vkelLayerStats[151], start);
+	return result;
+}
+#endif /* VK_USE_PLATFORM_WAYLAND_KHR */
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+static VKAPI_ATTR VkBool32 VKAPI_CALL vkelLayerGetPhysicalDeviceWaylandPresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, struct wl_display* display)
+{
+	const VkelLayerInstance *pEntry = (const VkelLayerInstance*) vkelLayerFind(vkelLayerInstances, physicalDevice);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkBool32 result = pEntry->table.GetPhysicalDeviceWaylandPresentationSupportKHR(physicalDevice, queueFamilyIndex, display);
+	vkelLayerEndCall(&vkelLayerStats[152], start);
+	return result;
+}
+#endif /* VK_USE_PLATFORM_WAYLAND_KHR */
+#ifdef VK_USE_PLATFORM_MIR_KHR
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerCreateMirSurfaceKHR(VkInstance instance, const VkMirSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+	const VkelLayerInstance *pEntry = (const VkelLayerInstance*) vkelLayerFind(vkelLayerInstances, instance);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.CreateMirSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
+	vkelLayerEndCall(&vkelLayerStats[153], start);
+	return result;
+}
+#endif /* VK_USE_PLATFORM_MIR_KHR */
+#ifdef VK_USE_PLATFORM_MIR_KHR
+static VKAPI_ATTR VkBool32 VKAPI_CALL vkelLayerGetPhysicalDeviceMirPresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, MirConnection* connection)
+{
+	const VkelLayerInstance *pEntry = (const VkelLayerInstance*) vkelLayerFind(vkelLayerInstances, physicalDevice);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkBool32 result = pEntry->table.GetPhysicalDeviceMirPresentationSupportKHR(physicalDevice, queueFamilyIndex, connection);
+	vkelLayerEndCall(&vkelLayerStats[154], start);
+	return result;
+}
+#endif /* VK_USE_PLATFORM_MIR_KHR */
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerCreateAndroidSurfaceKHR(VkInstance instance, const VkAndroidSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+	const VkelLayerInstance *pEntry = (const VkelLayerInstance*) vkelLayerFind(vkelLayerInstances, instance);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.CreateAndroidSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
+	vkelLayerEndCall(&vkelLayerStats[155], start);
+	return result;
+}
+#endif /* VK_USE_PLATFORM_ANDROID_KHR */
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerCreateWin32SurfaceKHR(VkInstance instance, const VkWin32SurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface)
+{
+	const VkelLayerInstance *pEntry = (const VkelLayerInstance*) vkelLayerFind(vkelLayerInstances, instance);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.CreateWin32SurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
+	vkelLayerEndCall(&vkelLayerStats[156], start);
+	return result;
+}
+#endif /* VK_USE_PLATFORM_WIN32_KHR */
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+static VKAPI_ATTR VkBool32 VKAPI_CALL vkelLayerGetPhysicalDeviceWin32PresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex)
+{
+	const VkelLayerInstance *pEntry = (const VkelLayerInstance*) vkelLayerFind(vkelLayerInstances, physicalDevice);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkBool32 result = pEntry->table.GetPhysicalDeviceWin32PresentationSupportKHR(physicalDevice, queueFamilyIndex);
+	vkelLayerEndCall(&vkelLayerStats[157], start);
+	return result;
+}
+#endif /* VK_USE_PLATFORM_WIN32_KHR */
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerCreateDebugReportCallbackEXT(VkInstance instance, const VkDebugReportCallbackCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDebugReportCallbackEXT* pCallback)
+{
+	const VkelLayerInstance *pEntry = (const VkelLayerInstance*) vkelLayerFind(vkelLayerInstances, instance);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.CreateDebugReportCallbackEXT(instance, pCreateInfo, pAllocator, pCallback);
+	vkelLayerEndCall(&vkelLayerStats[158], start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerDestroyDebugReportCallbackEXT(VkInstance instance, VkDebugReportCallbackEXT callback, const VkAllocationCallbacks* pAllocator)
+{
+	const VkelLayerInstance *pEntry = (const VkelLayerInstance*) vkelLayerFind(vkelLayerInstances, instance);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.DestroyDebugReportCallbackEXT(instance, callback, pAllocator);
+	vkelLayerEndCall(&vkelLayerStats[159], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerDebugReportMessageEXT(VkInstance instance, VkDebugReportFlagsEXT flags, VkDebugReportObjectTypeEXT objectType, uint64_t object, size_t location, int32_t messageCode, const char* pLayerPrefix, const char* pMessage)
+{
+	const VkelLayerInstance *pEntry = (const VkelLayerInstance*) vkelLayerFind(vkelLayerInstances, instance);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.DebugReportMessageEXT(instance, flags, objectType, object, location, messageCode, pLayerPrefix, pMessage);
+	vkelLayerEndCall(&vkelLayerStats[160], start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerDebugMarkerSetObjectTagEXT(VkDevice device, VkDebugMarkerObjectTagInfoEXT* pTagInfo)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.DebugMarkerSetObjectTagEXT(device, pTagInfo);
+	vkelLayerEndCall(&vkelLayerStats[161], start);
+	return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerDebugMarkerSetObjectNameEXT(VkDevice device, VkDebugMarkerObjectNameInfoEXT* pNameInfo)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	uint64_t start = vkelLayerGetNanoseconds();
+	VkResult result = pEntry->table.DebugMarkerSetObjectNameEXT(device, pNameInfo);
+	vkelLayerEndCall(&vkelLayerStats[162], start);
+	return result;
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdDebugMarkerBeginEXT(VkCommandBuffer commandBuffer, VkDebugMarkerMarkerInfoEXT* pMarkerInfo)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo);
+	vkelLayerEndCall(&vkelLayerStats[163], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdDebugMarkerEndEXT(VkCommandBuffer commandBuffer)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdDebugMarkerEndEXT(commandBuffer);
+	vkelLayerEndCall(&vkelLayerStats[164], start);
+}
+static VKAPI_ATTR void VKAPI_CALL vkelLayerCmdDebugMarkerInsertEXT(VkCommandBuffer commandBuffer, VkDebugMarkerMarkerInfoEXT* pMarkerInfo)
+{
+	const VkelLayerDevice *pEntry = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, commandBuffer);
+	uint64_t start = vkelLayerGetNanoseconds();
+	pEntry->table.CmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo);
+	vkelLayerEndCall(&vkelLayerStats[165], start);
+}
+
+
+typedef struct VkelLayerCommand {
+	const char *pName;
+	PFN_vkVoidFunction function;
+} VkelLayerCommand;
+
+// Sorted by name for bsearch()
+static const VkelLayerCommand vkelLayerCommands[] = {
+	{ "vkAcquireNextImageKHR", (PFN_vkVoidFunction) vkelLayerAcquireNextImageKHR },
+	{ "vkAllocateCommandBuffers", (PFN_vkVoidFunction) vkelLayerAllocateCommandBuffers },
+	{ "vkAllocateDescriptorSets", (PFN_vkVoidFunction) vkelLayerAllocateDescriptorSets },
+	{ "vkAllocateMemory", (PFN_vkVoidFunction) vkelLayerAllocateMemory },
+	{ "vkBeginCommandBuffer", (PFN_vkVoidFunction) vkelLayerBeginCommandBuffer },
+	{ "vkBindBufferMemory", (PFN_vkVoidFunction) vkelLayerBindBufferMemory },
+	{ "vkBindImageMemory", (PFN_vkVoidFunction) vkelLayerBindImageMemory },
+	{ "vkCmdBeginQuery", (PFN_vkVoidFunction) vkelLayerCmdBeginQuery },
+	{ "vkCmdBeginRenderPass", (PFN_vkVoidFunction) vkelLayerCmdBeginRenderPass },
+	{ "vkCmdBindDescriptorSets", (PFN_vkVoidFunction) vkelLayerCmdBindDescriptorSets },
+	{ "vkCmdBindIndexBuffer", (PFN_vkVoidFunction) vkelLayerCmdBindIndexBuffer },
+	{ "vkCmdBindPipeline", (PFN_vkVoidFunction) vkelLayerCmdBindPipeline },
+	{ "vkCmdBindVertexBuffers", (PFN_vkVoidFunction) vkelLayerCmdBindVertexBuffers },
+	{ "vkCmdBlitImage", (PFN_vkVoidFunction) vkelLayerCmdBlitImage },
+	{ "vkCmdClearAttachments", (PFN_vkVoidFunction) vkelLayerCmdClearAttachments },
+	{ "vkCmdClearColorImage", (PFN_vkVoidFunction) vkelLayerCmdClearColorImage },
+	{ "vkCmdClearDepthStencilImage", (PFN_vkVoidFunction) vkelLayerCmdClearDepthStencilImage },
+	{ "vkCmdCopyBuffer", (PFN_vkVoidFunction) vkelLayerCmdCopyBuffer },
+	{ "vkCmdCopyBufferToImage", (PFN_vkVoidFunction) vkelLayerCmdCopyBufferToImage },
+	{ "vkCmdCopyImage", (PFN_vkVoidFunction) vkelLayerCmdCopyImage },
+	{ "vkCmdCopyImageToBuffer", (PFN_vkVoidFunction) vkelLayerCmdCopyImageToBuffer },
+	{ "vkCmdCopyQueryPoolResults", (PFN_vkVoidFunction) vkelLayerCmdCopyQueryPoolResults },
+	{ "vkCmdDebugMarkerBeginEXT", (PFN_vkVoidFunction) vkelLayerCmdDebugMarkerBeginEXT },
+	{ "vkCmdDebugMarkerEndEXT", (PFN_vkVoidFunction) vkelLayerCmdDebugMarkerEndEXT },
+	{ "vkCmdDebugMarkerInsertEXT", (PFN_vkVoidFunction) vkelLayerCmdDebugMarkerInsertEXT },
+	{ "vkCmdDispatch", (PFN_vkVoidFunction) vkelLayerCmdDispatch },
+	{ "vkCmdDispatchIndirect", (PFN_vkVoidFunction) vkelLayerCmdDispatchIndirect },
+	{ "vkCmdDraw", (PFN_vkVoidFunction) vkelLayerCmdDraw },
+	{ "vkCmdDrawIndexed", (PFN_vkVoidFunction) vkelLayerCmdDrawIndexed },
+	{ "vkCmdDrawIndexedIndirect", (PFN_vkVoidFunction) vkelLayerCmdDrawIndexedIndirect },
+	{ "vkCmdDrawIndirect", (PFN_vkVoidFunction) vkelLayerCmdDrawIndirect },
+	{ "vkCmdEndQuery", (PFN_vkVoidFunction) vkelLayerCmdEndQuery },
+	{ "vkCmdEndRenderPass", (PFN_vkVoidFunction) vkelLayerCmdEndRenderPass },
+	{ "vkCmdExecuteCommands", (PFN_vkVoidFunction) vkelLayerCmdExecuteCommands },
+	{ "vkCmdFillBuffer", (PFN_vkVoidFunction) vkelLayerCmdFillBuffer },
+	{ "vkCmdNextSubpass", (PFN_vkVoidFunction) vkelLayerCmdNextSubpass },
+	{ "vkCmdPipelineBarrier", (PFN_vkVoidFunction) vkelLayerCmdPipelineBarrier },
+	{ "vkCmdPushConstants", (PFN_vkVoidFunction) vkelLayerCmdPushConstants },
+	{ "vkCmdResetEvent", (PFN_vkVoidFunction) vkelLayerCmdResetEvent },
+	{ "vkCmdResetQueryPool", (PFN_vkVoidFunction) vkelLayerCmdResetQueryPool },
+	{ "vkCmdResolveImage", (PFN_vkVoidFunction) vkelLayerCmdResolveImage },
+	{ "vkCmdSetBlendConstants", (PFN_vkVoidFunction) vkelLayerCmdSetBlendConstants },
+	{ "vkCmdSetDepthBias", (PFN_vkVoidFunction) vkelLayerCmdSetDepthBias },
+	{ "vkCmdSetDepthBounds", (PFN_vkVoidFunction) vkelLayerCmdSetDepthBounds },
+	{ "vkCmdSetEvent", (PFN_vkVoidFunction) vkelLayerCmdSetEvent },
+	{ "vkCmdSetLineWidth", (PFN_vkVoidFunction) vkelLayerCmdSetLineWidth },
+	{ "vkCmdSetScissor", (PFN_vkVoidFunction) vkelLayerCmdSetScissor },
+	{ "vkCmdSetStencilCompareMask", (PFN_vkVoidFunction) vkelLayerCmdSetStencilCompareMask },
+	{ "vkCmdSetStencilReference", (PFN_vkVoidFunction) vkelLayerCmdSetStencilReference },
+	{ "vkCmdSetStencilWriteMask", (PFN_vkVoidFunction) vkelLayerCmdSetStencilWriteMask },
+	{ "vkCmdSetViewport", (PFN_vkVoidFunction) vkelLayerCmdSetViewport },
+	{ "vkCmdUpdateBuffer", (PFN_vkVoidFunction) vkelLayerCmdUpdateBuffer },
+	{ "vkCmdWaitEvents", (PFN_vkVoidFunction) vkelLayerCmdWaitEvents },
+	{ "vkCmdWriteTimestamp", (PFN_vkVoidFunction) vkelLayerCmdWriteTimestamp },
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+	{ "vkCreateAndroidSurfaceKHR", (PFN_vkVoidFunction) vkelLayerCreateAndroidSurfaceKHR },
+#endif /* VK_USE_PLATFORM_ANDROID_KHR */
+	{ "vkCreateBuffer", (PFN_vkVoidFunction) vkelLayerCreateBuffer },
+	{ "vkCreateBufferView", (PFN_vkVoidFunction) vkelLayerCreateBufferView },
+	{ "vkCreateCommandPool", (PFN_vkVoidFunction) vkelLayerCreateCommandPool },
+	{ "vkCreateComputePipelines", (PFN_vkVoidFunction) vkelLayerCreateComputePipelines },
+	{ "vkCreateDebugReportCallbackEXT", (PFN_vkVoidFunction) vkelLayerCreateDebugReportCallbackEXT },
+	{ "vkCreateDescriptorPool", (PFN_vkVoidFunction) vkelLayerCreateDescriptorPool },
+	{ "vkCreateDescriptorSetLayout", (PFN_vkVoidFunction) vkelLayerCreateDescriptorSetLayout },
+	{ "vkCreateDisplayModeKHR", (PFN_vkVoidFunction) vkelLayerCreateDisplayModeKHR },
+	{ "vkCreateDisplayPlaneSurfaceKHR", (PFN_vkVoidFunction) vkelLayerCreateDisplayPlaneSurfaceKHR },
+	{ "vkCreateEvent", (PFN_vkVoidFunction) vkelLayerCreateEvent },
+	{ "vkCreateFence", (PFN_vkVoidFunction) vkelLayerCreateFence },
+	{ "vkCreateFramebuffer", (PFN_vkVoidFunction) vkelLayerCreateFramebuffer },
+	{ "vkCreateGraphicsPipelines", (PFN_vkVoidFunction) vkelLayerCreateGraphicsPipelines },
+	{ "vkCreateImage", (PFN_vkVoidFunction) vkelLayerCreateImage },
+	{ "vkCreateImageView", (PFN_vkVoidFunction) vkelLayerCreateImageView },
+#ifdef VK_USE_PLATFORM_MIR_KHR
+	{ "vkCreateMirSurfaceKHR", (PFN_vkVoidFunction) vkelLayerCreateMirSurfaceKHR },
+#endif /* VK_USE_PLATFORM_MIR_KHR */
+	{ "vkCreatePipelineCache", (PFN_vkVoidFunction) vkelLayerCreatePipelineCache },
+	{ "vkCreatePipelineLayout", (PFN_vkVoidFunction) vkelLayerCreatePipelineLayout },
+	{ "vkCreateQueryPool", (PFN_vkVoidFunction) vkelLayerCreateQueryPool },
+	{ "vkCreateRenderPass", (PFN_vkVoidFunction) vkelLayerCreateRenderPass },
+	{ "vkCreateSampler", (PFN_vkVoidFunction) vkelLayerCreateSampler },
+	{ "vkCreateSemaphore", (PFN_vkVoidFunction) vkelLayerCreateSemaphore },
+	{ "vkCreateShaderModule", (PFN_vkVoidFunction) vkelLayerCreateShaderModule },
+	{ "vkCreateSharedSwapchainsKHR", (PFN_vkVoidFunction) vkelLayerCreateSharedSwapchainsKHR },
+	{ "vkCreateSwapchainKHR", (PFN_vkVoidFunction) vkelLayerCreateSwapchainKHR },
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+	{ "vkCreateWaylandSurfaceKHR", (PFN_vkVoidFunction) vkelLayerCreateWaylandSurfaceKHR },
+#endif /* VK_USE_PLATFORM_WAYLAND_KHR */
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+	{ "vkCreateWin32SurfaceKHR", (PFN_vkVoidFunction) vkelLayerCreateWin32SurfaceKHR },
+#endif /* VK_USE_PLATFORM_WIN32_KHR */
+#ifdef VK_USE_PLATFORM_XCB_KHR
+	{ "vkCreateXcbSurfaceKHR", (PFN_vkVoidFunction) vkelLayerCreateXcbSurfaceKHR },
+#endif /* VK_USE_PLATFORM_XCB_KHR */
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+	{ "vkCreateXlibSurfaceKHR", (PFN_vkVoidFunction) vkelLayerCreateXlibSurfaceKHR },
+#endif /* VK_USE_PLATFORM_XLIB_KHR */
+	{ "vkDebugMarkerSetObjectNameEXT", (PFN_vkVoidFunction) vkelLayerDebugMarkerSetObjectNameEXT },
+	{ "vkDebugMarkerSetObjectTagEXT", (PFN_vkVoidFunction) vkelLayerDebugMarkerSetObjectTagEXT },
+	{ "vkDebugReportMessageEXT", (PFN_vkVoidFunction) vkelLayerDebugReportMessageEXT },
+	{ "vkDestroyBuffer", (PFN_vkVoidFunction) vkelLayerDestroyBuffer },
+	{ "vkDestroyBufferView", (PFN_vkVoidFunction) vkelLayerDestroyBufferView },
+	{ "vkDestroyCommandPool", (PFN_vkVoidFunction) vkelLayerDestroyCommandPool },
+	{ "vkDestroyDebugReportCallbackEXT", (PFN_vkVoidFunction) vkelLayerDestroyDebugReportCallbackEXT },
+	{ "vkDestroyDescriptorPool", (PFN_vkVoidFunction) vkelLayerDestroyDescriptorPool },
+	{ "vkDestroyDescriptorSetLayout", (PFN_vkVoidFunction) vkelLayerDestroyDescriptorSetLayout },
+	{ "vkDestroyEvent", (PFN_vkVoidFunction) vkelLayerDestroyEvent },
+	{ "vkDestroyFence", (PFN_vkVoidFunction) vkelLayerDestroyFence },
+	{ "vkDestroyFramebuffer", (PFN_vkVoidFunction) vkelLayerDestroyFramebuffer },
+	{ "vkDestroyImage", (PFN_vkVoidFunction) vkelLayerDestroyImage },
+	{ "vkDestroyImageView", (PFN_vkVoidFunction) vkelLayerDestroyImageView },
+	{ "vkDestroyPipeline", (PFN_vkVoidFunction) vkelLayerDestroyPipeline },
+	{ "vkDestroyPipelineCache", (PFN_vkVoidFunction) vkelLayerDestroyPipelineCache },
+	{ "vkDestroyPipelineLayout", (PFN_vkVoidFunction) vkelLayerDestroyPipelineLayout },
+	{ "vkDestroyQueryPool", (PFN_vkVoidFunction) vkelLayerDestroyQueryPool },
+	{ "vkDestroyRenderPass", (PFN_vkVoidFunction) vkelLayerDestroyRenderPass },
+	{ "vkDestroySampler", (PFN_vkVoidFunction) vkelLayerDestroySampler },
+	{ "vkDestroySemaphore", (PFN_vkVoidFunction) vkelLayerDestroySemaphore },
+	{ "vkDestroyShaderModule", (PFN_vkVoidFunction) vkelLayerDestroyShaderModule },
+	{ "vkDestroySurfaceKHR", (PFN_vkVoidFunction) vkelLayerDestroySurfaceKHR },
+	{ "vkDestroySwapchainKHR", (PFN_vkVoidFunction) vkelLayerDestroySwapchainKHR },
+	{ "vkDeviceWaitIdle", (PFN_vkVoidFunction) vkelLayerDeviceWaitIdle },
+	{ "vkEndCommandBuffer", (PFN_vkVoidFunction) vkelLayerEndCommandBuffer },
+	{ "vkEnumerateDeviceExtensionProperties", (PFN_vkVoidFunction) vkelLayerEnumerateDeviceExtensionProperties },
+	{ "vkEnumerateDeviceLayerProperties", (PFN_vkVoidFunction) vkelLayerEnumerateDeviceLayerProperties },
+	{ "vkEnumeratePhysicalDevices", (PFN_vkVoidFunction) vkelLayerEnumeratePhysicalDevices },
+	{ "vkFlushMappedMemoryRanges", (PFN_vkVoidFunction) vkelLayerFlushMappedMemoryRanges },
+	{ "vkFreeCommandBuffers", (PFN_vkVoidFunction) vkelLayerFreeCommandBuffers },
+	{ "vkFreeDescriptorSets", (PFN_vkVoidFunction) vkelLayerFreeDescriptorSets },
+	{ "vkFreeMemory", (PFN_vkVoidFunction) vkelLayerFreeMemory },
+	{ "vkGetBufferMemoryRequirements", (PFN_vkVoidFunction) vkelLayerGetBufferMemoryRequirements },
+	{ "vkGetDeviceMemoryCommitment", (PFN_vkVoidFunction) vkelLayerGetDeviceMemoryCommitment },
+	{ "vkGetDeviceQueue", (PFN_vkVoidFunction) vkelLayerGetDeviceQueue },
+	{ "vkGetDisplayModePropertiesKHR", (PFN_vkVoidFunction) vkelLayerGetDisplayModePropertiesKHR },
+	{ "vkGetDisplayPlaneCapabilitiesKHR", (PFN_vkVoidFunction) vkelLayerGetDisplayPlaneCapabilitiesKHR },
+	{ "vkGetDisplayPlaneSupportedDisplaysKHR", (PFN_vkVoidFunction) vkelLayerGetDisplayPlaneSupportedDisplaysKHR },
+	{ "vkGetEventStatus", (PFN_vkVoidFunction) vkelLayerGetEventStatus },
+	{ "vkGetFenceStatus", (PFN_vkVoidFunction) vkelLayerGetFenceStatus },
+	{ "vkGetImageMemoryRequirements", (PFN_vkVoidFunction) vkelLayerGetImageMemoryRequirements },
+	{ "vkGetImageSparseMemoryRequirements", (PFN_vkVoidFunction) vkelLayerGetImageSparseMemoryRequirements },
+	{ "vkGetImageSubresourceLayout", (PFN_vkVoidFunction) vkelLayerGetImageSubresourceLayout },
+	{ "vkGetPhysicalDeviceDisplayPlanePropertiesKHR", (PFN_vkVoidFunction) vkelLayerGetPhysicalDeviceDisplayPlanePropertiesKHR },
+	{ "vkGetPhysicalDeviceDisplayPropertiesKHR", (PFN_vkVoidFunction) vkelLayerGetPhysicalDeviceDisplayPropertiesKHR },
+	{ "vkGetPhysicalDeviceFeatures", (PFN_vkVoidFunction) vkelLayerGetPhysicalDeviceFeatures },
+	{ "vkGetPhysicalDeviceFormatProperties", (PFN_vkVoidFunction) vkelLayerGetPhysicalDeviceFormatProperties },
+	{ "vkGetPhysicalDeviceImageFormatProperties", (PFN_vkVoidFunction) vkelLayerGetPhysicalDeviceImageFormatProperties },
+	{ "vkGetPhysicalDeviceMemoryProperties", (PFN_vkVoidFunction) vkelLayerGetPhysicalDeviceMemoryProperties },
+#ifdef VK_USE_PLATFORM_MIR_KHR
+	{ "vkGetPhysicalDeviceMirPresentationSupportKHR", (PFN_vkVoidFunction) vkelLayerGetPhysicalDeviceMirPresentationSupportKHR },
+#endif /* VK_USE_PLATFORM_MIR_KHR */
+	{ "vkGetPhysicalDeviceProperties", (PFN_vkVoidFunction) vkelLayerGetPhysicalDeviceProperties },
+	{ "vkGetPhysicalDeviceQueueFamilyProperties", (PFN_vkVoidFunction) vkelLayerGetPhysicalDeviceQueueFamilyProperties },
+	{ "vkGetPhysicalDeviceSparseImageFormatProperties", (PFN_vkVoidFunction) vkelLayerGetPhysicalDeviceSparseImageFormatProperties },
+	{ "vkGetPhysicalDeviceSurfaceCapabilitiesKHR", (PFN_vkVoidFunction) vkelLayerGetPhysicalDeviceSurfaceCapabilitiesKHR },
+	{ "vkGetPhysicalDeviceSurfaceFormatsKHR", (PFN_vkVoidFunction) vkelLayerGetPhysicalDeviceSurfaceFormatsKHR },
+	{ "vkGetPhysicalDeviceSurfacePresentModesKHR", (PFN_vkVoidFunction) vkelLayerGetPhysicalDeviceSurfacePresentModesKHR },
+	{ "vkGetPhysicalDeviceSurfaceSupportKHR", (PFN_vkVoidFunction) vkelLayerGetPhysicalDeviceSurfaceSupportKHR },
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+	{ "vkGetPhysicalDeviceWaylandPresentationSupportKHR", (PFN_vkVoidFunction) vkelLayerGetPhysicalDeviceWaylandPresentationSupportKHR },
+#endif /* VK_USE_PLATFORM_WAYLAND_KHR */
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+	{ "vkGetPhysicalDeviceWin32PresentationSupportKHR", (PFN_vkVoidFunction) vkelLayerGetPhysicalDeviceWin32PresentationSupportKHR },
+#endif /* VK_USE_PLATFORM_WIN32_KHR */
+#ifdef VK_USE_PLATFORM_XCB_KHR
+	{ "vkGetPhysicalDeviceXcbPresentationSupportKHR", (PFN_vkVoidFunction) vkelLayerGetPhysicalDeviceXcbPresentationSupportKHR },
+#endif /* VK_USE_PLATFORM_XCB_KHR */
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+	{ "vkGetPhysicalDeviceXlibPresentationSupportKHR", (PFN_vkVoidFunction) vkelLayerGetPhysicalDeviceXlibPresentationSupportKHR },
+#endif /* VK_USE_PLATFORM_XLIB_KHR */
+	{ "vkGetPipelineCacheData", (PFN_vkVoidFunction) vkelLayerGetPipelineCacheData },
+	{ "vkGetQueryPoolResults", (PFN_vkVoidFunction) vkelLayerGetQueryPoolResults },
+	{ "vkGetRenderAreaGranularity", (PFN_vkVoidFunction) vkelLayerGetRenderAreaGranularity },
+	{ "vkGetSwapchainImagesKHR", (PFN_vkVoidFunction) vkelLayerGetSwapchainImagesKHR },
+	{ "vkInvalidateMappedMemoryRanges", (PFN_vkVoidFunction) vkelLayerInvalidateMappedMemoryRanges },
+	{ "vkMapMemory", (PFN_vkVoidFunction) vkelLayerMapMemory },
+	{ "vkMergePipelineCaches", (PFN_vkVoidFunction) vkelLayerMergePipelineCaches },
+	{ "vkQueueBindSparse", (PFN_vkVoidFunction) vkelLayerQueueBindSparse },
+	{ "vkQueuePresentKHR", (PFN_vkVoidFunction) vkelLayerQueuePresentKHR },
+	{ "vkQueueSubmit", (PFN_vkVoidFunction) vkelLayerQueueSubmit },
+	{ "vkQueueWaitIdle", (PFN_vkVoidFunction) vkelLayerQueueWaitIdle },
+	{ "vkResetCommandBuffer", (PFN_vkVoidFunction) vkelLayerResetCommandBuffer },
+	{ "vkResetCommandPool", (PFN_vkVoidFunction) vkelLayerResetCommandPool },
+	{ "vkResetDescriptorPool", (PFN_vkVoidFunction) vkelLayerResetDescriptorPool },
+	{ "vkResetEvent", (PFN_vkVoidFunction) vkelLayerResetEvent },
+	{ "vkResetFences", (PFN_vkVoidFunction) vkelLayerResetFences },
+	{ "vkSetEvent", (PFN_vkVoidFunction) vkelLayerSetEvent },
+	{ "vkUnmapMemory", (PFN_vkVoidFunction) vkelLayerUnmapMemory },
+	{ "vkUpdateDescriptorSets", (PFN_vkVoidFunction) vkelLayerUpdateDescriptorSets },
+	{ "vkWaitForFences", (PFN_vkVoidFunction) vkelLayerWaitForFences },
+};
+
+static int vkelLayerCompareCommand(const void *pName, const void *pCommand)
+{
+	return strcmp((const char*) pName, ((const VkelLayerCommand*) pCommand)->pName);
+}
+
+// Returns the wrapper if instrumenting, otherwise the next layer's function
+static PFN_vkVoidFunction vkelLayerGetInstrumentedProcAddr(const char *pName, PFN_vkVoidFunction next)
+{
+	const VkelLayerCommand *pCommand;
+	
+	if (!next || !vkelLayerInstrument)
+		return next;
+	
+	pCommand = (const VkelLayerCommand*) bsearch(pName, vkelLayerCommands, sizeof(vkelLayerCommands) / sizeof(vkelLayerCommands[0]), sizeof(vkelLayerCommands[0]), vkelLayerCompareCommand);
+	
+	return pCommand ? pCommand->function : next;
+}
+
+
+// Chain
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerCreateInstance(const VkInstanceCreateInfo *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkInstance *pInstance)
+{
+	VkelLayerInstanceCreateInfo *pChainInfo = (VkelLayerInstanceCreateInfo*) pCreateInfo->pNext;
+	PFN_vkGetInstanceProcAddr nextGetInstanceProcAddr;
+	PFN_vkCreateInstance nextCreateInstance;
+	VkelLayerInstance *pEntry;
+	VkResult result;
+	
+	while (pChainInfo && !(pChainInfo->sType == VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO && pChainInfo->function == VKEL_LAYER_LINK_INFO))
+		pChainInfo = (VkelLayerInstanceCreateInfo*) pChainInfo->pNext;
+	
+	if (!pChainInfo || !pChainInfo->u.pLayerInfo)
+		return VK_ERROR_INITIALIZATION_FAILED;
+	
+	nextGetInstanceProcAddr = pChainInfo->u.pLayerInfo->pfnNextGetInstanceProcAddr;
+	nextCreateInstance = (PFN_vkCreateInstance) nextGetInstanceProcAddr(VK_NULL_HANDLE, "vkCreateInstance");
+	
+	if (!nextCreateInstance)
+		return VK_ERROR_INITIALIZATION_FAILED;
+	
+	vkelLayerReadSettings();
+	
+	// The next layer takes the following link
+	pChainInfo->u.pLayerInfo = pChainInfo->u.pLayerInfo->pNext;
+	
+	result = nextCreateInstance(pCreateInfo, pAllocator, pInstance);
+	
+	if (result != VK_SUCCESS)
+		return result;
+	
+	pEntry = (VkelLayerInstance*) calloc(1, sizeof(VkelLayerInstance));
+	
+	if (pEntry)
+	{
+		pEntry->instance = *pInstance;
+		pEntry->nextGetInstanceProcAddr = nextGetInstanceProcAddr;
+		
+		vkelLayerLoadInstanceTable(&pEntry->table, nextGetInstanceProcAddr, *pInstance);
+		
+		if (vkelLayerAdd(vkelLayerInstances, *pInstance, pEntry))
+			return VK_SUCCESS;
+		
+		pEntry->table.DestroyInstance(*pInstance, pAllocator);
+		free(pEntry);
+		
+		return VK_ERROR_TOO_MANY_OBJECTS;
+	}
+	
+	((PFN_vkDestroyInstance) nextGetInstanceProcAddr(*pInstance, "vkDestroyInstance"))(*pInstance, pAllocator);
+	
+	return VK_ERROR_OUT_OF_HOST_MEMORY;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelLayerDestroyInstance(VkInstance instance, const VkAllocationCallbacks *pAllocator)
+{
+	VkelLayerInstance *pEntry;
+	
+	if (!instance)
+		return;
+	
+	pEntry = (VkelLayerInstance*) vkelLayerRemove(vkelLayerInstances, instance);
+	
+	if (!pEntry)
+		return;
+	
+	pEntry->table.DestroyInstance(instance, pAllocator);
+	
+	free(pEntry);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vkelLayerCreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkDevice *pDevice)
+{
+	VkelLayerDeviceCreateInfo *pChainInfo = (VkelLayerDeviceCreateInfo*) pCreateInfo->pNext;
+	const VkelLayerInstance *pInstance = (const VkelLayerInstance*) vkelLayerFind(vkelLayerInstances, physicalDevice);
+	PFN_vkGetDeviceProcAddr nextGetDeviceProcAddr;
+	PFN_vkCreateDevice nextCreateDevice;
+	VkelLayerDevice *pEntry;
+	VkResult result;
+	
+	while (pChainInfo && !(pChainInfo->sType == VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO && pChainInfo->function == VKEL_LAYER_LINK_INFO))
+		pChainInfo = (VkelLayerDeviceCreateInfo*) pChainInfo->pNext;
+	
+	if (!pChainInfo || !pChainInfo->u.pLayerInfo || !pInstance)
+		return VK_ERROR_INITIALIZATION_FAILED;
+	
+	nextGetDeviceProcAddr = pChainInfo->u.pLayerInfo->pfnNextGetDeviceProcAddr;
+	nextCreateDevice = (PFN_vkCreateDevice) pChainInfo->u.pLayerInfo->pfnNextGetInstanceProcAddr(pInstance->instance, "vkCreateDevice");
+	
+	if (!nextCreateDevice)
+		return VK_ERROR_INITIALIZATION_FAILED;
+	
+	// The next layer takes the following link
+	pChainInfo->u.pLayerInfo = pChainInfo->u.pLayerInfo->pNext;
+	
+	result = nextCreateDevice(physicalDevice, pCreateInfo, pAllocator, pDevice);
+	
+	if (result != VK_SUCCESS)
+		return result;
+	
+	pEntry = (VkelLayerDevice*) calloc(1, sizeof(VkelLayerDevice));
+	
+	if (pEntry)
+	{
+		pEntry->device = *pDevice;
+		pEntry->nextGetDeviceProcAddr = nextGetDeviceProcAddr;
+		
+		vkelLayerLoadDeviceTable(&pEntry->table, nextGetDeviceProcAddr, *pDevice);
+		
+		if (vkelLayerAdd(vkelLayerDevices, *pDevice, pEntry))
+			return VK_SUCCESS;
+		
+		pEntry->table.DestroyDevice(*pDevice, pAllocator);
+		free(pEntry);
+		
+		return VK_ERROR_TOO_MANY_OBJECTS;
+	}
+	
+	((PFN_vkDestroyDevice) nextGetDeviceProcAddr(*pDevice, "vkDestroyDevice"))(*pDevice, pAllocator);
+	
+	return VK_ERROR_OUT_OF_HOST_MEMORY;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vkelLayerDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator)
+{
+	VkelLayerDevice *pEntry;
+	
+	if (!device)
+		return;
+	
+	pEntry = (VkelLayerDevice*) vkelLayerRemove(vkelLayerDevices, device);
+	
+	if (!pEntry)
+		return;
+	
+	pEntry->table.DestroyDevice(device, pAllocator);
+	
+	free(pEntry);
+}
+
+
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkelLayerGetInstanceProcAddr(VkInstance instance, const char *pName);
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkelLayerGetDeviceProcAddr(VkDevice device, const char *pName);
+
+static PFN_vkVoidFunction vkelLayerGetInterceptedProcAddr(const char *pName)
+{
+	if (!strcmp(pName, "vkGetInstanceProcAddr"))
+		return (PFN_vkVoidFunction) vkelLayerGetInstanceProcAddr;
+	
+	if (!strcmp(pName, "vkGetDeviceProcAddr"))
+		return (PFN_vkVoidFunction) vkelLayerGetDeviceProcAddr;
+	
+	if (!strcmp(pName, "vkCreateInstance"))
+		return (PFN_vkVoidFunction) vkelLayerCreateInstance;
+	
+	if (!strcmp(pName, "vkDestroyInstance"))
+		return (PFN_vkVoidFunction) vkelLayerDestroyInstance;
+	
+	if (!strcmp(pName, "vkCreateDevice"))
+		return (PFN_vkVoidFunction) vkelLayerCreateDevice;
+	
+	if (!strcmp(pName, "vkDestroyDevice"))
+		return (PFN_vkVoidFunction) vkelLayerDestroyDevice;
+	
+	return NULL;
+}
+
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkelLayerGetInstanceProcAddr(VkInstance instance, const char *pName)
+{
+	PFN_vkVoidFunction function = vkelLayerGetInterceptedProcAddr(pName);
+	const VkelLayerInstance *pInstance;
+	
+	if (function || !instance)
+		return function;
+	
+	pInstance = (const VkelLayerInstance*) vkelLayerFind(vkelLayerInstances, instance);
+	
+	if (!pInstance)
+		return NULL;
+	
+	return vkelLayerGetInstrumentedProcAddr(pName, pInstance->nextGetInstanceProcAddr(instance, pName));
+}
+
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkelLayerGetDeviceProcAddr(VkDevice device, const char *pName)
+{
+	const VkelLayerDevice *pDevice;
+	
+	if (!strcmp(pName, "vkGetDeviceProcAddr"))
+		return (PFN_vkVoidFunction) vkelLayerGetDeviceProcAddr;
+	
+	if (!strcmp(pName, "vkDestroyDevice"))
+		return (PFN_vkVoidFunction) vkelLayerDestroyDevice;
+	
+	pDevice = (const VkelLayerDevice*) vkelLayerFind(vkelLayerDevices, device);
+	
+	if (!pDevice)
+		return NULL;
+	
+	return vkelLayerGetInstrumentedProcAddr(pName, pDevice->nextGetDeviceProcAddr(device, pName));
+}
+
+
+// Exports
+
+VKEL_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVersion(VkelNegotiateLayerInterface *pVersionStruct)
+{
+	if (!pVersionStruct || pVersionStruct->sType != VKEL_LAYER_NEGOTIATE_INTERFACE_STRUCT)
+		return VK_ERROR_INITIALIZATION_FAILED;
+	
+	// Version 2 is the first that's negotiated, and the only one the layer implements
+	if (pVersionStruct->loaderLayerInterfaceVersion < 2)
+		return VK_ERROR_INITIALIZATION_FAILED;
+	
+	pVersionStruct->loaderLayerInterfaceVersion = 2;
+	pVersionStruct->pfnGetInstanceProcAddr = vkelLayerGetInstanceProcAddr;
+	pVersionStruct->pfnGetDeviceProcAddr = vkelLayerGetDeviceProcAddr;
+	pVersionStruct->pfnGetPhysicalDeviceProcAddr = NULL;
+	
+	return VK_SUCCESS;
+}
+
+// Loaders that don't negotiate look these up by name
+VKEL_LAYER_EXPORT VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetInstanceProcAddr(VkInstance instance, const char *pName)
+{
+	return vkelLayerGetInstanceProcAddr(instance, pName);
+}
+
+VKEL_LAYER_EXPORT VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetDeviceProcAddr(VkDevice device, const char *pName)
+{
+	return vkelLayerGetDeviceProcAddr(device, pName);
+}
+
+
+VKEL_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateInstanceLayerProperties(uint32_t *pPropertyCount, VkLayerProperties *pProperties)
+{
+	if (!pProperties)
+	{
+		*pPropertyCount = 1;
+		return VK_SUCCESS;
+	}
+	
+	if (*pPropertyCount < 1)
+		return VK_INCOMPLETE;
+	
+	memset(pProperties, 0, sizeof(VkLayerProperties));
+	
+	strcpy(pProperties->layerName, VKEL_LAYER_NAME);
+	strcpy(pProperties->description, VKEL_LAYER_DESCRIPTION);
+	
+	pProperties->specVersion = VK_MAKE_VERSION(1, 0, VK_HEADER_VERSION);
+	pProperties->implementationVersion = 1;
+	
+	*pPropertyCount = 1;
+	
+	return VK_SUCCESS;
+}
+
+VKEL_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateInstanceExtensionProperties(const char *pLayerName, uint32_t *pPropertyCount, VkExtensionProperties *pProperties)
+{
+	(void) pProperties;
+	
+	if (!pLayerName || strcmp(pLayerName, VKEL_LAYER_NAME))
+		return VK_ERROR_LAYER_NOT_PRESENT;
+	
+	*pPropertyCount = 0;
+	
+	return VK_SUCCESS;
+}
+
+VKEL_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateDeviceLayerProperties(VkPhysicalDevice physicalDevice, uint32_t *pPropertyCount, VkLayerProperties *pProperties)
+{
+	(void) physicalDevice;
+	
+	return vkEnumerateInstanceLayerProperties(pPropertyCount, pProperties);
+}
+
+VKEL_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateDeviceExtensionProperties(VkPhysicalDevice physicalDevice, const char *pLayerName, uint32_t *pPropertyCount, VkExtensionProperties *pProperties)
+{
+	const VkelLayerInstance *pInstance;
+	
+	if (pLayerName && !strcmp(pLayerName, VKEL_LAYER_NAME))
+	{
+		*pPropertyCount = 0;
+		return VK_SUCCESS;
+	}
+	
+	pInstance = physicalDevice ? (const VkelLayerInstance*) vkelLayerFind(vkelLayerInstances, physicalDevice) : NULL;
+	
+	if (!pInstance)
+		return VK_ERROR_LAYER_NOT_PRESENT;
+	
+	return pInstance->table.EnumerateDeviceExtensionProperties(physicalDevice, pLayerName, pPropertyCount, pProperties);
+}
@@ -0,0 +1,587 @@
+//========================================================================
+// Name
+//     Vulkan (Cross-Platform) Extension Loader
+//
+// Repository
+//     https://github.com/MrVallentin/vkel
+//
+// Overview
+//     This is a simple, dynamic and tiny cross-platform Vulkan
+//     extension loader.
+//
+// Dependencies
+//     Vulkan (library)
+//     Windows (header) - needed for library loading on Windows
+//     dlfcn (header) - needed for library loading on non-Windows OS'
+//     dirent (header) - needed for vkelInitDirectICD() on non-Windows OS'
+//     pthread (header) - needed for vkelInitAsync() on non-Windows OS'
+//     fcntl, unistd (headers) - needed for vkelPrewarm() on non-Windows OS'
+//     Standard C Libraries (stdio, stdlib, string, assert) - needed for NULL, malloc()
+//                                                 calloc(), free(), memset(), assert()
+//
+// Notice
+//     Copyright (c) 2016 Christian Vallentin <mail@vallentinsource.com>
+//
+// Developers & Contributors
+//     Christian Vallentin <mail@vallentinsource.com>
+//
+// Version History
+//     Last Modified Date: May 16, 2016
+//     Revision: 14
+//     Version: 2.0.11
+//
+// Revision History
+//     Revision 12, 2016/05/02
+//       - Fixed "for loop initial declarations are only
+//         allowed in C99 mode".
+//
+//     Revision 3, 2016/02/26
+//       - Rewrote vkel_gen.py, now it parses and directly
+//         adds vulkan.h and vk_platform.h into vkel.h,
+//         along with moving the appropriate copyrights
+//         to the top of vkel.h.
+//       - Fixed/added better differentiation for instance
+//         and device related calls.
+//       - Removed the need for having the vukan.h and
+//         vk_platform.h headers.
+//
+//     Revision 2, 2016/02/24
+//       - Created a Python script for automatically generating
+//         all the extensions and their functions. (Tested with
+//         Python 3.5.1)
+//       - Added cross-platform support, for loading libraries
+//         and getting the function addresses.
+//       - Fixed so platform specific functions defaults to NULL
+//       - Added missing include for dlfcn (used on non-Window OS')
+//
+//     Revision 1, 2016/02/23
+//       - Implemented the basic version supporting a few (manually
+//         written) dynamically loaded functions.
+//
+//------------------------------------------------------------------------
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+// OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//========================================================================
+
+/*
+** Copyright (c) 2015-2016 The Khronos Group Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+// vkel as a drop-in replacement for libvulkan.so.1, for binaries that can't be rebuilt.
+// It loads an ICD directly (like vkelInitDirectICD()) and every exported command is a thunk
+// which jumps straight into the ICD, through a table filled by vkCreateInstance(). That
+// skips the loader's trampolines, as well as its layers and support for multiple ICDs:
+//
+//     gcc -O2 -fPIC -shared -fvisibility=hidden -Wl,-soname,libvulkan.so.1 -o libvulkan.so.1 vkel_shim.c vkel.c -ldl -lpthread
+//     LD_LIBRARY_PATH=. ./application
+//
+// The ICD is read from the manifest in VKEL_SHIM_ICD, otherwise the first one found in
+// VK_ICD_FILENAMES, /usr/share/vulkan/icd.d or /etc/vulkan/icd.d is used. Only a single
+// instance is supported at a time.
+
+#define VKEL_NO_FUNCTION_MACROS
+#include "vkel.h"
+
+#include <stdio.h> /* fprintf() */
+#include <stdlib.h> /* abort(), getenv() */
+#include <string.h> /* strcmp() */
+
+
+#if !defined(__x86_64__) && !defined(__aarch64__)
+#	error vkel_shim.c has thunks for x86-64 and AArch64 only
+#endif
+
+#if !defined(__ELF__)
+#	error vkel_shim.c replaces libvulkan.so.1 and needs an ELF target
+#endif
+
+#define VKEL_SHIM_EXPORT __attribute__((visibility("default")))
+
+
+#define VKEL_SHIM_COMMAND_COUNT 166
+
+// Read by the thunks, so it must be neither static nor exported
+__attribute__((visibility("hidden"), used)) PFN_vkVoidFunction vkelShimTable[VKEL_SHIM_COMMAND_COUNT];
+
+static const char* const vkelShimCommandNames[VKEL_SHIM_COMMAND_COUNT] = {
+	"vkCreateInstance",
+	"vkDestroyInstance",
+	"vkEnumeratePhysicalDevices",
+	"vkGetPhysicalDeviceFeatures",
+	"vkGetPhysicalDeviceFormatProperties",
+	"vkGetPhysicalDeviceImageFormatProperties",
+	"vkGetPhysicalDeviceProperties",
+	"vkGetPhysicalDeviceQueueFamilyProperties",
+	"vkGetPhysicalDeviceMemoryProperties",
+	"vkGetInstanceProcAddr",
+	"vkGetDeviceProcAddr",
+	"vkCreateDevice",
+	"vkDestroyDevice",
+	"vkEnumerateInstanceExtensionProperties",
+	"vkEnumerateDeviceExtensionProperties",
+	"vkEnumerateInstanceLayerProperties",
+	"vkEnumerateDeviceLayerProperties",
+	"vkGetDeviceQueue",
+	"vkQueueSubmit",
+	"vkQueueWaitIdle",
+	"vkDeviceWaitIdle",
+	"vkAllocateMemory",
+	"vkFreeMemory",
+	"vkMapMemory",
+	"vkUnmapMemory",
+	"vkFlushMappedMemoryRanges",
+	"vkInvalidateMappedMemoryRanges",
+	"vkGetDeviceMemoryCommitment",
+	"vkBindBufferMemory",
+	"vkBindImageMemory",
+	"vkGetBufferMemoryRequirements",
+	"vkGetImageMemoryRequirements",
+	"vkGetImageSparseMemoryRequirements",
+	"vkGetPhysicalDeviceSparseImageFormatProperties",
+	"vkQueueBindSparse",
+	"vkCreateFence",
+	"vkDestroyFence",
+	"vkResetFences",
+	"vkGetFenceStatus",
+	"vkWaitForFences",
+	"vkCreateSemaphore",
+	"vkDestroySemaphore",
+	"vkCreateEvent",
+	"vkDestroyEvent",
+	"vkGetEventStatus",
+	"vkSetEvent",
+	"vkResetEvent",
+	"vkCreateQueryPool",
+	"vkDestroyQueryPool",
+	"vkGetQueryPoolResults",
+	"vkCreateBuffer",
+	"vkDestroyBuffer",
+	"vkCreateBufferView",
+	"vkDestroyBufferView",
+	"vkCreateImage",
+	"vkDestroyImage",
+	"vkGetImageSubresourceLayout",
+	"vkCreateImageView",
+	"vkDestroyImageView",
+	"vkCreateShaderModule",
+	"vkDestroyShaderModule",
+	"vkCreatePipelineCache",
+	"vkDestroyPipelineCache",
+	"vkGetPipelineCacheData",
+	"vkMergePipelineCaches",
+	"vkCreateGraphicsPipelines",
+	"vkCreateComputePipelines",
+	"vkDestroyPipeline",
+	"vkCreatePipelineLayout",
+	"vkDestroyPipelineLayout",
+	"vkCreateSampler",
+	"vkDestroySampler",
+	"vkCreateDescriptorSetLayout",
+	"vkDestroyDescriptorSetLayout",
+	"vkCreateDescriptorPool",
+	"vkDestroyDescriptorPool",
+	"vkResetDescriptorPool",
+	"vkAllocateDescriptorSets",
+	"vkFreeDescriptorSets",
+	"vkUpdateDescriptorSets",
+	"vkCreateFramebuffer",
+	"vkDestroyFramebuffer",
+	"vkCreateRenderPass",
+	"vkDestroyRenderPass",
+	"vkGetRenderAreaGranularity",
+	"vkCreateCommandPool",
+	"vkDestroyCommandPool",
+	"vkResetCommandPool",
+	"vkAllocateCommandBuffers",
+	"vkFreeCommandBuffers",
+	"vkBeginCommandBuffer",
+	"vkEndCommandBuffer",
+	"vkResetCommandBuffer",
+	"vkCmdBindPipeline",
+	"vkCmdSetViewport",
+	"vkCmdSetScissor",
+	"vkCmdSetLineWidth",
+	"vkCmdSetDepthBias",
+	"vkCmdSetBlendConstants",
+	"vkCmdSetDepthBounds",
+	"vkCmdSetStencilCompareMask",
+	"vkCmdSetStencilWriteMask",
+	"vkCmdSetStencilReference",
+	"vkCmdBindDescriptorSets",
+	"vkCmdBindIndexBuffer",
+	"vkCmdBindVertexBuffers",
+	"vkCmdDraw",
+	"vkCmdDrawIndexed",
+	"vkCmdDrawIndirect",
+	"vkCmdDrawIndexedIndirect",
+	"vkCmdDispatch",
+	"vkCmdDispatchIndirect",
+	"vkCmdCopyBuffer",
+	"vkCmdCopyImage",
+	"vkCmdBlitImage",
+	"vkCmdCopyBufferToImage",
+	"vkCmdCopyImageToBuffer",
+	"vkCmdUpdateBuffer",
+	"vkCmdFillBuffer",
+	"vkCmdClearColorImage",
+	"vkCmdClearDepthStencilImage",
+	"vkCmdClearAttachments",
+	"vkCmdResolveImage",
+	"vkCmdSetEvent",
+	"vkCmdResetEvent",
+	"vkCmdWaitEvents",
+	"vkCmdPipelineBarrier",
+	"vkCmdBeginQuery",
+	"vkCmdEndQuery",
+	"vkCmdResetQueryPool",
+	"vkCmdWriteTimestamp",
+	"vkCmdCopyQueryPoolResults",
+	"vkCmdPushConstants",
+	"vkCmdBeginRenderPass",
+	"vkCmdNextSubpass",
+	"vkCmdEndRenderPass",
+	"vkCmdExecuteCommands",
+	"vkDestroySurfaceKHR",
+	"vkGetPhysicalDeviceSurfaceSupportKHR",
+	"vkGetPhysicalDeviceSurfaceCapabilitiesKHR",
+	"vkGetPhysicalDeviceSurfaceFormatsKHR",
+	"vkGetPhysicalDeviceSurfacePresentModesKHR",
+	"vkCreateSwapchainKHR",
+	"vkDestroySwapchainKHR",
+	"vkGetSwapchainImagesKHR",
+	"vkAcquireNextImageKHR",
+	"vkQueuePresentKHR",
+	"vkGetPhysicalDeviceDisplayPropertiesKHR",
+	"vkGetPhysicalDeviceDisplayPlanePropertiesKHR",
+	"vkGetDisplayPlaneSupportedDisplaysKHR",
+	"vkGetDisplayModePropertiesKHR",
+	"vkCreateDisplayModeKHR",
+	"vkGetDisplayPlaneCapabilitiesKHR",
+	"vkCreateDisplayPlaneSurfaceKHR",
+	"vkCreateSharedSwapchainsKHR",
+	"vkCreateXlibSurfaceKHR",
+	"vkGetPhysicalDeviceXlibPresentationSupportKHR",
+	"vkCreateXcbSurfaceKHR",
+	"vkGetPhysicalDeviceXcbPresentationSupportKHR",
+	"vkCreateWaylandSurfaceKHR",
+	"vkGetPhysicalDeviceWaylandPresentationSupportKHR",
+	"vkCreateMirSurfaceKHR",
+	"vkGetPhysicalDeviceMirPresentationSupportKHR",
+	"vkCreateAndroidSurfaceKHR",
+	"vkCreateWin32SurfaceKHR",
+	"vkGetPhysicalDeviceWin32PresentationSupportKHR",
+};
+
+// A single indirect jump on x86-64, while AArch64 needs the address in a register first.
+// x16 is the intra-procedure-call scratch register, so it's free to use here.
+#if defined(__x86_64__)
+#	define VKEL_SHIM_JUMP(index) "\tjmp *vkelShimTable+8*" #index "(%rip)\n"
+#elif defined(__aarch64__)
+#	define VKEL_SHIM_JUMP(index) \
+		"\tadrp x16, vkelShimTable+8*" #index "\n" \
+		"\tldr x16, [x16, #:lo12:vkelShimTable+8*" #index "]\n" \
+		"\tbr x16\n"
+#endif
+
+#define VKEL_SHIM_THUNK(name, index) \
+	__asm__( \
+		"\t.pushsection .text\n" \
+		"\t.globl " #name "\n" \
+		"\t.type " #name ", %function\n" \
+		"\t.p2align 4\n" \
+		#name ":\n" \
+		VKEL_SHIM_JUMP(index) \
+		"\t.size " #name ", .-" #name "\n" \
+		"\t.popsection\n");
+
+
+// Where the commands the ICD doesn't have (or that are called before vkCreateInstance()) end up
+static void vkelShimUnavailable(void)
+{
+	fprintf(stderr, "vkel: called a Vulkan command which isn't available, or before vkCreateInstance()\n");
+	abort();
+}
+
+static void vkelShimFillTable(VkInstance instance)
+{
+	uint32_t i;
+	
+	for (i = 0; i < VKEL_SHIM_COMMAND_COUNT; ++i)
+	{
+		PFN_vkVoidFunction function = vkelGetInstanceProcAddr(instance, vkelShimCommandNames[i]);
+		
+		__atomic_store_n(&vkelShimTable[i], function ? function : (PFN_vkVoidFunction) vkelShimUnavailable, __ATOMIC_RELEASE);
+	}
+}
+
+__attribute__((constructor)) static void vkelShimLoad(void)
+{
+	uint32_t i;
+	
+	if (vkelInitDirectICD(getenv("VKEL_SHIM_ICD")))
+		vkelShimFillTable(VK_NULL_HANDLE);
+	else
+	{
+		fprintf(stderr, "vkel: no Vulkan ICD could be loaded\n");
+		
+		for (i = 0; i < VKEL_SHIM_COMMAND_COUNT; ++i)
+			vkelShimTable[i] = (PFN_vkVoidFunction) vkelShimUnavailable;
+	}
+}
+
+__attribute__((destructor)) static void vkelShimUnload(void)
+{
+	vkelUninit();
+}
+
+
+VKEL_SHIM_THUNK(vkDestroyInstance, 1)
+VKEL_SHIM_THUNK(vkEnumeratePhysicalDevices, 2)
+VKEL_SHIM_THUNK(vkGetPhysicalDeviceFeatures, 3)
+VKEL_SHIM_THUNK(vkGetPhysicalDeviceFormatProperties, 4)
+VKEL_SHIM_THUNK(vkGetPhysicalDeviceImageFormatProperties, 5)
+VKEL_SHIM_THUNK(vkGetPhysicalDeviceProperties, 6)
+VKEL_SHIM_THUNK(vkGetPhysicalDeviceQueueFamilyProperties, 7)
+VKEL_SHIM_THUNK(vkGetPhysicalDeviceMemoryProperties, 8)
+VKEL_SHIM_THUNK(vkGetDeviceProcAddr, 10)
+VKEL_SHIM_THUNK(vkCreateDevice, 11)
+VKEL_SHIM_THUNK(vkDestroyDevice, 12)
+VKEL_SHIM_THUNK(vkEnumerateInstanceExtensionProperties, 13)
+VKEL_SHIM_THUNK(vkEnumerateDeviceExtensionProperties, 14)
+VKEL_SHIM_THUNK(vkEnumerateInstanceLayerProperties, 15)
+VKEL_SHIM_THUNK(vkEnumerateDeviceLayerProperties, 16)
+VKEL_SHIM_THUNK(vkGetDeviceQueue, 17)
+VKEL_SHIM_THUNK(vkQueueSubmit, 18)
+VKEL_SHIM_THUNK(vkQueueWaitIdle, 19)
+VKEL_SHIM_THUNK(vkDeviceWaitIdle, 20)
+VKEL_SHIM_THUNK(vkAllocateMemory, 21)
+VKEL_SHIM_THUNK(vkFreeMemory, 22)
+VKEL_SHIM_THUNK(vkMapMemory, 23)
+VKEL_SHIM_THUNK(vkUnmapMemory, 24)
+VKEL_SHIM_THUNK(vkFlushMappedMemoryRanges, 25)
+VKEL_SHIM_THUNK(vkInvalidateMappedMemoryRanges, 26)
+VKEL_SHIM_THUNK(vkGetDeviceMemoryCommitment, 27)
+VKEL_SHIM_THUNK(vkBindBufferMemory, 28)
+VKEL_SHIM_THUNK(vkBindImageMemory, 29)
+VKEL_SHIM_THUNK(vkGetBufferMemoryRequirements, 30)
+VKEL_SHIM_THUNK(vkGetImageMemoryRequirements, 31)
+VKEL_SHIM_THUNK(vkGetImageSparseMemoryRequirements, 32)
+VKEL_SHIM_THUNK(vkGetPhysicalDeviceSparseImageFormatProperties, 33)
+VKEL_SHIM_THUNK(vkQueueBindSparse, 34)
+VKEL_SHIM_THUNK(vkCreateFence, 35)
+VKEL_SHIM_THUNK(vkDestroyFence, 36)
+VKEL_SHIM_THUNK(vkResetFences, 37)
+VKEL_SHIM_THUNK(vkGetFenceStatus, 38)
+VKEL_SHIM_THUNK(vkWaitForFences, 39)
+VKEL_SHIM_THUNK(vkCreateSemaphore, 40)
+VKEL_SHIM_THUNK(vkDestroySemaphore, 41)
+VKEL_SHIM_THUNK(vkCreateEvent, 42)
+VKEL_SHIM_THUNK(vkDestroyEvent, 43)
+VKEL_SHIM_THUNK(vkGetEventStatus, 44)
+VKEL_SHIM_THUNK(vkSetEvent, 45)
+VKEL_SHIM_THUNK(vkResetEvent, 46)
+VKEL_SHIM_THUNK(vkCreateQueryPool, 47)
+VKEL_SHIM_THUNK(vkDestroyQueryPool, 48)
+VKEL_SHIM_THUNK(vkGetQueryPoolResults, 49)
+VKEL_SHIM_THUNK(vkCreateBuffer, 50)
+VKEL_SHIM_THUNK(vkDestroyBuffer, 51)
+VKEL_SHIM_THUNK(vkCreateBufferView, 52)
+VKEL_SHIM_THUNK(vkDestroyBufferView, 53)
+VKEL_SHIM_THUNK(vkCreateImage, 54)
+VKEL_SHIM_THUNK(vkDestroyImage, 55)
+VKEL_SHIM_THUNK(vkGetImageSubresourceLayout, 56)
+VKEL_SHIM_THUNK(vkCreateImageView, 57)
+VKEL_SHIM_THUNK(vkDestroyImageView, 58)
+VKEL_SHIM_THUNK(vkCreateShaderModule, 59)
+VKEL_SHIM_THUNK(vkDestroyShaderModule, 60)
+VKEL_SHIM_THUNK(vkCreatePipelineCache, 61)
+VKEL_SHIM_THUNK(vkDestroyPipelineCache, 62)
+VKEL_SHIM_THUNK(vkGetPipelineCacheData, 63)
+VKEL_SHIM_THUNK(vkMergePipelineCaches, 64)
+VKEL_SHIM_THUNK(vkCreateGraphicsPipelines, 65)
+VKEL_SHIM_THUNK(vkCreateComputePipelines, 66)
+VKEL_SHIM_THUNK(vkDestroyPipeline, 67)
+VKEL_SHIM_THUNK(vkCreatePipelineLayout, 68)
+VKEL_SHIM_THUNK(vkDestroyPipelineLayout, 69)
+VKEL_SHIM_THUNK(vkCreateSampler, 70)
+VKEL_SHIM_THUNK(vkDestroySampler, 71)
+VKEL_SHIM_THUNK(vkCreateDescriptorSetLayout, 72)
+VKEL_SHIM_THUNK(vkDestroyDescriptorSetLayout, 73)
+VKEL_SHIM_THUNK(vkCreateDescriptorPool, 74)
+VKEL_SHIM_THUNK(vkDestroyDescriptorPool, 75)
+VKEL_SHIM_THUNK(vkResetDescriptorPool, 76)
+VKEL_SHIM_THUNK(vkAllocateDescriptorSets, 77)
+VKEL_SHIM_THUNK(vkFreeDescriptorSets, 78)
+VKEL_SHIM_THUNK(vkUpdateDescriptorSets, 79)
+VKEL_SHIM_THUNK(vkCreateFramebuffer, 80)
+VKEL_SHIM_THUNK(vkDestroyFramebuffer, 81)
+VKEL_SHIM_THUNK(vkCreateRenderPass, 82)
+VKEL_SHIM_THUNK(vkDestroyRenderPass, 83)
+VKEL_SHIM_THUNK(vkGetRenderAreaGranularity, 84)
+VKEL_SHIM_THUNK(vkCreateCommandPool, 85)
+VKEL_SHIM_THUNK(vkDestroyCommandPool, 86)
+VKEL_SHIM_THUNK(vkResetCommandPool, 87)
+VKEL_SHIM_THUNK(vkAllocateCommandBuffers, 88)
+VKEL_SHIM_THUNK(vkFreeCommandBuffers, 89)
+VKEL_SHIM_THUNK(vkBeginCommandBuffer, 90)
+VKEL_SHIM_THUNK(vkEndCommandBuffer, 91)
+VKEL_SHIM_THUNK(vkResetCommandBuffer, 92)
+VKEL_SHIM_THUNK(vkCmdBindPipeline, 93)
+VKEL_SHIM_THUNK(vkCmdSetViewport, 94)
+VKEL_SHIM_THUNK(vkCmdSetScissor, 95)
+VKEL_SHIM_THUNK(vkCmdSetLineWidth, 96)
+VKEL_SHIM_THUNK(vkCmdSetDepthBias, 97)
+VKEL_SHIM_THUNK(vkCmdSetBlendConstants, 98)
+VKEL_SHIM_THUNK(vkCmdSetDepthBounds, 99)
+VKEL_SHIM_THUNK(vkCmdSetStencilCompareMask, 100)
+VKEL_SHIM_THUNK(vkCmdSetStencilWriteMask, 101)
+VKEL_SHIM_THUNK(vkCmdSetStencilReference, 102)
+VKEL_SHIM_THUNK(vkCmdBindDescriptorSets, 103)
+VKEL_SHIM_THUNK(vkCmdBindIndexBuffer, 104)
+VKEL_SHIM_THUNK(vkCmdBindVertexBuffers, 105)
+VKEL_SHIM_THUNK(vkCmdDraw, 106)
+VKEL_SHIM_THUNK(vkCmdDrawIndexed, 107)
+VKEL_SHIM_THUNK(vkCmdDrawIndirect, 108)
+VKEL_SHIM_THUNK(vkCmdDrawIndexedIndirect, 109)
+VKEL_SHIM_THUNK(vkCmdDispatch, 110)
+VKEL_SHIM_THUNK(vkCmdDispatchIndirect, 111)
+VKEL_SHIM_THUNK(vkCmdCopyBuffer, 112)
+VKEL_SHIM_THUNK(vkCmdCopyImage, 113)
+VKEL_SHIM_THUNK(vkCmdBlitImage, 114)
+VKEL_SHIM_THUNK(vkCmdCopyBufferToImage, 115)
+VKEL_SHIM_THUNK(vkCmdCopyImageToBuffer, 116)
+VKEL_SHIM_THUNK(vkCmdUpdateBuffer, 117)
+VKEL_SHIM_THUNK(vkCmdFillBuffer, 118)
+VKEL_SHIM_THUNK(vkCmdClearColorImage, 119)
+VKEL_SHIM_THUNK(vkCmdClearDepthStencilImage, 120)
+VKEL_SHIM_THUNK(vkCmdClearAttachments, 121)
+VKEL_SHIM_THUNK(vkCmdResolveImage, 122)
+VKEL_SHIM_THUNK(vkCmdSetEvent, 123)
+VKEL_SHIM_THUNK(vkCmdResetEvent, 124)
+VKEL_SHIM_THUNK(vkCmdWaitEvents, 125)
+VKEL_SHIM_THUNK(vkCmdPipelineBarrier, 126)
+VKEL_SHIM_THUNK(vkCmdBeginQuery, 127)
+VKEL_SHIM_THUNK(vkCmdEndQuery, 128)
+VKEL_SHIM_THUNK(vkCmdResetQueryPool, 129)
+VKEL_SHIM_THUNK(vkCmdWriteTimestamp, 130)
+VKEL_SHIM_THUNK(vkCmdCopyQueryPoolResults, 131)
+VKEL_SHIM_THUNK(vkCmdPushConstants, 132)
+VKEL_SHIM_THUNK(vkCmdBeginRenderPass, 133)
+VKEL_SHIM_THUNK(vkCmdNextSubpass, 134)
+VKEL_SHIM_THUNK(vkCmdEndRenderPass, 135)
+VKEL_SHIM_THUNK(vkCmdExecuteCommands, 136)
+VKEL_SHIM_THUNK(vkDestroySurfaceKHR, 137)
+VKEL_SHIM_THUNK(vkGetPhysicalDeviceSurfaceSupportKHR, 138)
+VKEL_SHIM_THUNK(vkGetPhysicalDeviceSurfaceCapabilitiesKHR, 139)
+VKEL_SHIM_THUNK(vkGetPhysicalDeviceSurfaceFormatsKHR, 140)
+VKEL_SHIM_THUNK(vkGetPhysicalDeviceSurfacePresentModesKHR, 141)
+VKEL_SHIM_THUNK(vkCreateSwapchainKHR, 142)
+VKEL_SHIM_THUNK(vkDestroySwapchainKHR, 143)
+VKEL_SHIM_THUNK(vkGetSwapchainImagesKHR, 144)
+VKEL_SHIM_THUNK(vkAcquireNextImageKHR, 145)
+VKEL_SHIM_THUNK(vkQueuePresentKHR, 146)
+VKEL_SHIM_THUNK(vkGetPhysicalDeviceDisplayPropertiesKHR, 147)
+VKEL_SHIM_THUNK(vkGetPhysicalDeviceDisplayPlanePropertiesKHR, 148)
+VKEL_SHIM_THUNK(vkGetDisplayPlaneSupportedDisplaysKHR, 149)
+VKEL_SHIM_THUNK(vkGetDisplayModePropertiesKHR, 150)
+VKEL_SHIM_THUNK(vkCreateDisplayModeKHR, 151)
+VKEL_SHIM_THUNK(vkGetDisplayPlaneCapabilitiesKHR, 152)
+VKEL_SHIM_THUNK(vkCreateDisplayPlaneSurfaceKHR, 153)
+VKEL_SHIM_THUNK(vkCreateSharedSwapchainsKHR, 154)
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+VKEL_SHIM_THUNK(vkCreateXlibSurfaceKHR, 155)
+#endif /* VK_USE_PLATFORM_XLIB_KHR */
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+VKEL_SHIM_THUNK(vkGetPhysicalDeviceXlibPresentationSupportKHR, 156)
+#endif /* VK_USE_PLATFORM_XLIB_KHR */
+#ifdef VK_USE_PLATFORM_XCB_KHR
+VKEL_SHIM_THUNK(vkCreateXcbSurfaceKHR, 157)
+#endif /* VK_USE_PLATFORM_XCB_KHR */
+#ifdef VK_USE_PLATFORM_XCB_KHR
+VKEL_SHIM_THUNK(vkGetPhysicalDeviceXcbPresentationSupportKHR, 158)
+#endif /* VK_USE_PLATFORM_XCB_KHR */
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+VKEL_SHIM_THUNK(vkCreateWaylandSurfaceKHR, 159)
+#endif /* VK_USE_PLATFORM_WAYLAND_KHR */
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+VKEL_SHIM_THUNK(vkGetPhysicalDeviceWaylandPresentationSupportKHR, 160)
+#endif /* VK_USE_PLATFORM_WAYLAND_KHR */
+#ifdef VK_USE_PLATFORM_MIR_KHR
+VKEL_SHIM_THUNK(vkCreateMirSurfaceKHR, 161)
+#endif /* VK_USE_PLATFORM_MIR_KHR */
+#ifdef VK_USE_PLATFORM_MIR_KHR
+VKEL_SHIM_THUNK(vkGetPhysicalDeviceMirPresentationSupportKHR, 162)
+#endif /* VK_USE_PLATFORM_MIR_KHR */
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+VKEL_SHIM_THUNK(vkCreateAndroidSurfaceKHR, 163)
+#endif /* VK_USE_PLATFORM_ANDROID_KHR */
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+VKEL_SHIM_THUNK(vkCreateWin32SurfaceKHR, 164)
+#endif /* VK_USE_PLATFORM_WIN32_KHR */
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+VKEL_SHIM_THUNK(vkGetPhysicalDeviceWin32PresentationSupportKHR, 165)
+#endif /* VK_USE_PLATFORM_WIN32_KHR */
+
+VKEL_SHIM_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateInstance(const VkInstanceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkInstance* pInstance);
+VKEL_SHIM_EXPORT VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetInstanceProcAddr(VkInstance instance, const char* pName);
+
+VKAPI_ATTR VkResult VKAPI_CALL vkCreateInstance(const VkInstanceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkInstance* pInstance)
+{
+	if (!vkelTable.CreateInstance)
+		return VK_ERROR_INITIALIZATION_FAILED;
+	
+	VkResult result = vkelTable.CreateInstance(pCreateInfo, pAllocator, pInstance);
+	
+	if (result != VK_SUCCESS)
+		return result;
+	
+	// The ICD's own functions, so calls through the thunks never touch vkel again
+	vkelInstanceInit(*pInstance);
+	vkelShimFillTable(*pInstance);
+	
+	return VK_SUCCESS;
+}
+
+// Everything else is handed out as is, which is as direct as it gets
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetInstanceProcAddr(VkInstance instance, const char* pName)
+{
+	if (!strcmp(pName, "vkGetInstanceProcAddr"))
+		return (PFN_vkVoidFunction) vkGetInstanceProcAddr;
+	
+	if (!strcmp(pName, "vkCreateInstance"))
+		return (PFN_vkVoidFunction) vkCreateInstance;
+	
+	return vkelGetInstanceProcAddr(instance, pName);
+}